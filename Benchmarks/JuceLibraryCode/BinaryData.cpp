@@ -0,0 +1,2562 @@
+/* ==================================== JUCER_BINARY_RESOURCE ====================================
+
+   This is an auto-generated file: Any edits you make may be overwritten!
+
+*/
+
+namespace BinaryData
+{
+
+//================== background.png ==================
+static const unsigned char temp_binary_data_0[] =
+{ 137,80,78,71,13,10,26,10,0,0,0,13,73,72,68,82,0,0,5,138,0,0,4,110,8,6,0,0,0,125,74,3,161,0,0,0,9,112,72,89,115,0,0,11,18,0,0,11,18,1,210,221,126,252,0,0,32,0,73,68,65,84,120,156,236,189,11,108,92,231,149,231,121,200,98,61,89,15,190,36,146,34,69,81,148,
+18,197,15,217,242,42,86,226,199,202,211,182,98,59,74,236,77,70,30,57,147,241,198,27,35,30,44,144,96,145,1,22,8,16,116,3,221,152,69,3,1,26,59,193,34,1,6,241,32,89,7,217,158,216,107,35,233,56,15,219,241,26,176,59,126,199,137,108,69,177,37,235,65,81,162,
+72,74,20,201,98,21,235,93,228,226,127,89,215,42,81,245,188,247,124,183,238,173,123,126,0,145,110,75,188,42,94,222,251,125,231,251,159,115,254,167,227,19,255,240,135,53,170,195,183,39,98,20,241,121,234,253,181,134,73,228,138,244,253,211,113,182,235,9,
+235,116,119,118,208,183,118,244,144,207,211,193,118,71,222,189,148,166,223,94,78,183,229,29,222,238,247,208,225,177,168,161,251,117,34,158,165,167,102,86,148,124,46,157,199,183,70,105,168,187,171,225,191,95,92,93,163,223,207,172,208,59,137,156,210,207,
+229,52,190,243,137,94,182,119,34,87,92,163,239,125,180,168,228,14,236,13,251,232,192,112,119,83,159,21,159,231,185,233,36,253,53,149,87,242,153,4,115,252,237,174,62,234,96,90,142,95,159,75,209,255,183,152,97,253,141,220,211,27,160,219,7,67,172,215,252,
+237,249,36,189,155,84,191,6,13,117,117,210,254,129,32,109,143,248,42,190,51,233,194,42,77,37,243,244,244,172,218,117,90,16,4,193,105,232,235,231,88,216,75,158,13,155,84,50,95,164,183,47,103,44,141,37,57,227,52,82,116,118,217,21,236,162,195,219,162,108,
+215,123,126,58,41,241,186,77,65,60,190,127,48,68,97,111,103,67,31,112,42,145,167,103,102,146,180,178,90,87,82,49,4,183,14,163,34,158,116,58,88,19,15,141,134,169,47,80,255,220,13,29,235,231,83,9,154,45,172,42,251,169,161,233,124,125,44,74,189,1,99,191,
+119,156,15,159,158,90,166,51,217,34,251,103,179,3,143,142,68,104,44,226,101,249,36,184,87,63,56,181,164,236,253,117,50,117,223,6,108,140,156,139,19,192,245,112,221,227,233,66,27,222,210,214,129,7,252,232,66,134,246,110,10,178,124,134,100,126,149,94,105,
+211,141,196,140,72,12,62,25,243,211,195,68,74,197,226,39,206,45,107,239,201,129,193,16,245,250,187,170,10,78,88,224,206,36,114,34,136,84,224,214,42,34,146,81,112,45,92,83,69,112,15,113,237,195,83,121,250,226,96,72,123,190,106,129,223,57,222,117,188,159,
+178,177,217,147,7,7,130,108,34,49,248,244,64,144,61,176,127,51,158,101,21,138,177,103,88,33,18,3,4,232,218,154,39,235,158,32,8,66,83,124,188,126,218,4,206,179,11,248,211,114,150,253,7,251,252,112,55,235,245,238,216,20,20,161,216,166,32,142,193,215,29,
+49,63,93,31,245,87,44,218,65,28,62,153,204,209,209,120,78,105,177,6,4,76,110,29,102,119,175,95,132,226,13,96,77,252,225,228,178,118,191,247,245,248,105,48,232,165,190,50,145,118,33,83,164,185,116,158,222,94,202,42,21,136,117,190,58,18,49,44,18,83,233,
+188,250,133,225,48,253,100,106,185,45,207,137,47,92,92,161,71,67,49,150,51,254,75,51,43,114,150,174,66,93,161,248,0,115,181,145,206,254,129,16,29,63,183,172,228,218,110,6,25,244,137,136,207,212,226,162,243,66,27,191,56,88,60,205,46,46,16,243,238,201,
+20,149,110,182,72,166,28,159,92,127,79,32,26,143,110,200,116,30,75,228,44,217,176,156,202,158,158,0,251,39,223,215,31,80,22,220,227,125,67,242,161,123,46,69,123,34,62,218,236,247,208,128,255,202,239,124,58,149,167,185,108,145,62,76,229,101,83,179,57,
+19,81,31,235,7,196,122,133,0,150,243,125,199,51,244,151,133,12,221,216,199,243,158,188,61,223,158,221,39,130,32,8,130,58,144,244,222,221,23,96,57,244,99,79,155,205,243,199,197,97,47,127,209,148,96,111,94,139,103,181,47,42,21,24,5,61,235,21,198,11,249,
+162,146,103,172,18,16,45,185,225,126,150,219,9,196,216,191,210,98,217,214,197,179,232,246,107,166,163,184,26,208,130,238,29,8,210,47,46,166,84,125,212,150,129,247,15,21,211,102,138,254,168,180,95,88,85,224,226,68,234,62,133,170,22,147,62,6,33,83,168,
+12,178,71,102,218,21,192,203,51,43,109,219,206,126,176,63,200,34,164,83,169,202,15,85,121,86,136,118,154,104,44,85,248,77,161,98,157,177,34,192,194,243,164,7,167,130,51,81,241,156,224,192,240,43,102,49,246,197,249,52,141,71,124,13,183,88,86,99,118,165,
+32,207,172,32,8,130,208,52,136,121,80,213,117,112,52,108,234,230,45,102,138,218,158,198,13,10,53,56,59,132,116,164,187,214,57,172,183,240,91,223,198,143,202,86,110,84,60,203,2,31,208,22,184,64,33,200,27,139,106,146,103,173,6,239,164,25,177,88,44,88,234,
+83,87,40,230,108,219,182,226,186,118,3,109,234,209,174,78,90,46,172,90,214,98,132,128,11,98,49,218,22,154,205,72,161,149,6,193,90,59,103,87,118,51,85,207,81,233,253,184,171,55,208,182,62,206,78,71,197,50,227,150,181,171,29,184,62,228,165,116,113,181,
+37,30,93,42,2,241,245,3,3,239,90,131,253,226,151,231,19,166,178,242,56,156,255,243,116,130,245,115,9,130,32,8,238,1,231,142,192,204,10,221,109,208,226,1,231,151,103,166,19,74,10,55,54,118,243,113,94,215,42,161,120,200,219,73,35,254,46,26,244,95,73,98,
+79,166,11,116,54,83,144,14,53,23,130,170,85,17,201,236,7,236,78,184,207,153,183,245,6,218,178,170,152,74,98,49,252,133,31,26,14,55,236,89,140,51,203,203,23,83,150,20,68,110,156,7,160,255,110,177,95,101,139,171,116,33,85,176,181,117,168,154,157,207,197,
+224,129,184,119,48,68,163,221,94,242,116,94,253,162,223,95,26,56,118,126,37,79,47,206,165,148,90,6,96,211,135,199,45,22,156,125,3,193,134,170,197,48,160,237,215,115,169,182,14,24,48,160,128,123,1,222,213,227,23,161,216,166,108,124,7,133,246,6,194,240,
+238,152,143,198,43,188,231,240,207,157,76,228,218,54,179,110,6,61,43,255,165,209,72,211,149,197,8,184,218,213,3,77,16,4,65,176,14,189,43,229,206,205,161,166,98,117,116,180,252,179,34,145,216,233,224,28,120,75,111,160,98,39,229,222,210,255,98,24,219,59,
+139,25,25,140,236,34,150,197,182,208,150,140,134,248,165,185,145,16,127,85,186,157,192,186,255,228,116,66,75,134,65,20,199,207,187,113,189,211,61,197,79,38,242,150,13,220,174,53,28,17,251,155,207,227,161,93,62,15,253,93,143,95,219,195,158,176,161,37,
+175,8,197,140,60,190,53,90,183,130,23,194,213,182,136,143,30,143,248,44,121,40,116,127,37,8,164,99,161,46,205,239,212,239,233,160,110,111,167,102,204,158,131,112,157,202,211,177,100,206,21,226,201,152,130,5,24,194,10,22,39,17,159,236,7,18,51,34,22,183,
+63,240,142,59,176,185,187,230,250,139,247,20,45,88,248,130,39,21,218,83,229,80,121,5,136,197,63,58,19,215,252,204,26,241,44,214,7,42,74,146,76,16,4,65,224,2,103,150,83,169,60,221,53,16,172,59,216,23,9,96,120,227,139,237,209,181,116,119,118,52,220,89,
+138,74,60,124,237,118,65,193,144,176,142,12,82,180,39,155,252,252,58,5,151,221,166,221,129,14,83,94,57,141,53,48,226,233,176,92,159,129,155,192,125,91,194,77,117,150,98,157,254,238,39,123,233,217,115,9,91,217,17,137,80,204,0,178,6,143,77,196,154,22,164,
+244,135,226,199,167,227,202,7,146,233,19,92,221,206,128,130,5,24,244,121,61,34,20,219,144,226,26,17,247,246,8,129,76,176,15,168,150,105,182,250,8,66,40,50,206,191,153,73,182,196,150,194,40,152,184,172,18,28,14,17,100,161,234,250,134,176,143,38,194,62,
+205,231,91,191,183,56,148,35,193,120,50,153,163,35,137,156,28,38,5,65,16,4,118,16,79,151,15,246,141,117,117,126,92,21,183,92,40,82,34,183,74,31,36,115,150,237,223,104,209,191,93,193,112,119,85,173,255,72,158,27,177,147,130,48,255,117,127,151,116,9,217,
+8,196,125,28,131,205,202,89,147,95,173,109,113,139,168,107,5,88,195,172,94,199,32,18,223,63,98,204,107,31,58,226,225,109,81,122,126,58,105,155,68,78,221,149,71,85,69,94,177,77,54,32,163,34,177,14,190,15,223,111,133,88,44,8,110,99,38,149,215,42,248,57,
+73,230,157,35,44,182,59,232,148,48,234,103,136,96,12,86,11,168,162,85,17,72,164,11,171,20,236,50,55,32,110,35,199,87,172,105,11,197,33,125,118,49,35,254,117,130,32,8,66,203,184,106,176,111,139,187,87,184,207,195,170,206,193,168,162,51,51,115,0,177,17,
+6,162,255,96,50,206,254,217,132,230,121,123,41,75,55,51,14,55,35,57,199,8,130,18,48,156,212,168,72,92,206,231,134,187,233,92,186,96,11,93,176,238,41,54,158,83,179,152,168,186,174,213,60,50,30,53,29,56,224,251,113,29,65,104,87,224,29,91,254,213,109,145,
+29,196,91,11,252,66,215,219,151,69,60,179,3,176,123,57,96,80,36,214,129,29,5,90,51,85,48,149,228,21,117,113,168,148,233,232,130,32,8,130,96,61,39,151,121,43,188,206,43,74,252,98,168,147,217,89,44,16,139,15,246,243,138,147,130,49,32,22,37,152,53,147,215,
+46,169,79,186,160,170,29,207,16,108,57,203,191,30,30,238,214,58,1,173,58,7,58,13,233,90,117,46,40,62,226,0,186,32,252,141,237,64,221,138,98,136,34,28,234,120,165,235,58,157,195,67,221,108,21,99,184,206,131,3,65,250,213,188,248,61,10,237,1,2,129,157,240,
+198,174,50,133,20,67,176,254,188,152,81,234,45,7,97,13,155,46,215,0,67,92,75,124,189,236,1,252,11,57,126,175,104,233,195,179,202,253,28,98,138,237,223,198,252,77,121,84,213,130,251,144,42,8,130,32,8,66,99,188,58,159,214,172,25,184,246,116,12,53,231,6,
+133,24,141,78,254,175,199,238,190,0,189,178,152,17,11,10,27,240,187,153,21,173,37,157,3,116,187,169,60,199,224,25,188,163,63,88,213,46,99,136,186,180,247,8,150,113,152,115,33,207,216,213,192,222,141,219,106,68,196,103,245,220,211,27,96,211,26,0,134,224,
+161,66,185,213,5,66,117,85,78,44,38,220,15,88,187,136,45,245,134,44,52,203,77,146,189,85,206,180,162,137,190,103,51,82,233,167,131,44,242,183,198,99,154,37,64,173,128,21,21,11,248,59,255,105,71,143,22,88,168,226,151,231,19,108,87,126,121,118,69,217,231,
+20,26,7,213,196,156,235,47,38,130,171,224,125,166,86,89,236,153,79,203,179,39,8,130,32,8,45,1,149,157,92,123,250,123,243,105,37,109,197,187,99,124,86,107,16,61,62,203,124,206,21,140,1,177,232,44,147,110,242,179,73,117,67,244,81,65,124,104,172,177,1,138,
+120,190,246,110,10,106,54,39,56,55,10,235,168,208,41,38,101,70,149,114,110,233,231,63,71,238,31,224,247,197,111,150,134,82,22,16,71,56,171,138,219,65,108,129,89,53,87,86,89,7,215,195,117,165,98,81,29,24,126,129,141,137,19,84,198,74,54,116,29,35,131,197,
+208,254,143,192,162,119,102,69,73,117,49,2,172,227,75,89,218,213,99,46,224,197,53,228,221,180,7,24,180,198,9,146,22,16,159,185,7,82,162,67,100,34,234,163,136,207,92,16,204,153,236,16,4,65,61,152,95,177,127,32,72,99,97,47,5,60,157,87,197,139,72,252,192,
+63,31,214,72,98,39,35,8,206,1,123,250,214,176,87,171,246,50,202,66,166,160,172,123,116,156,57,54,194,64,91,153,85,96,15,126,58,157,164,111,79,196,76,197,147,24,146,165,202,247,20,150,18,70,10,56,16,127,195,83,251,233,169,101,71,13,151,86,197,159,150,
+179,236,58,197,201,132,53,243,77,220,12,247,76,26,176,41,216,250,4,74,67,59,29,196,145,237,12,66,11,181,145,216,178,167,71,77,5,26,174,43,98,148,58,176,9,97,114,63,196,73,46,254,44,65,148,6,170,130,141,14,22,3,250,247,170,16,139,81,141,121,24,70,243,
+6,215,48,172,91,82,209,105,31,70,21,84,160,239,8,121,105,86,193,179,247,253,211,113,83,193,61,2,123,17,147,4,97,29,236,51,168,154,219,18,242,94,179,143,207,174,20,232,116,50,71,111,198,179,45,77,222,126,109,36,92,115,136,42,18,169,248,115,124,193,123,
+242,231,83,137,150,14,45,209,109,162,134,66,93,87,37,121,33,104,207,166,10,116,50,153,83,106,17,37,8,78,226,135,147,203,154,215,170,145,246,112,172,81,79,156,83,83,209,137,170,76,206,214,103,42,89,115,9,246,1,241,164,145,103,111,109,141,232,133,11,73,
+101,250,2,218,238,205,116,249,225,185,85,57,92,218,73,160,96,229,68,60,203,214,53,9,205,227,93,169,40,86,202,61,138,186,82,57,135,167,26,254,12,253,127,243,216,223,55,242,23,143,37,243,180,43,232,165,176,207,184,192,214,78,98,203,231,6,67,74,126,129,
+158,78,162,215,21,12,224,18,174,144,207,175,210,39,162,60,89,119,44,192,79,207,136,128,136,161,4,255,243,54,243,131,29,183,71,124,116,46,145,163,37,5,126,74,88,195,188,197,53,26,237,246,54,220,13,128,224,234,141,139,41,250,181,120,135,219,138,125,61,
+1,83,123,81,37,224,11,246,145,34,65,246,205,197,44,141,251,61,212,211,68,123,29,68,154,103,207,37,232,125,69,3,111,4,193,73,64,4,249,119,91,34,180,111,83,144,250,3,93,21,5,17,172,9,168,246,219,219,19,160,88,71,135,178,247,185,26,168,34,254,230,142,30,
+237,243,53,138,223,211,73,123,251,2,148,206,22,233,130,197,67,158,33,186,63,50,22,165,93,49,63,197,252,158,107,246,111,252,255,248,239,216,151,247,198,252,90,236,52,211,38,131,168,5,193,12,168,250,107,38,158,212,99,201,103,230,212,157,23,182,248,187,
+232,122,5,86,17,175,74,252,107,43,244,103,111,48,216,213,208,153,11,201,137,159,79,45,211,9,69,22,137,232,198,59,184,37,108,250,252,135,61,189,191,171,83,59,171,185,157,203,217,34,237,142,249,89,116,166,231,166,147,116,137,185,91,82,184,154,137,96,151,
+22,123,170,96,110,37,79,151,91,88,72,208,84,74,10,89,80,12,92,187,121,160,249,146,120,248,49,201,160,182,250,120,184,253,44,132,107,64,102,237,198,68,158,101,224,131,180,132,175,115,47,211,96,49,112,96,115,183,178,138,11,180,208,225,11,131,40,119,70,
+125,85,55,225,226,234,154,54,145,26,195,70,90,89,233,37,180,15,104,27,196,96,130,3,131,161,154,109,171,24,52,242,231,203,25,105,247,20,44,7,214,87,219,187,189,20,243,94,73,104,196,243,69,122,47,158,109,105,85,59,42,94,155,233,86,209,189,15,39,34,62,250,
+201,212,178,37,21,74,16,137,31,155,136,25,62,216,105,246,110,211,234,42,190,54,2,47,201,102,218,91,81,189,125,112,52,76,59,227,89,122,170,133,201,113,220,231,125,61,126,26,12,94,29,191,161,146,92,214,76,193,74,244,120,18,231,98,88,76,133,189,158,171,
+68,99,136,195,201,124,145,78,47,231,228,252,43,176,162,63,123,216,179,209,137,220,23,184,186,8,33,91,92,165,11,169,130,38,242,171,62,195,112,13,150,166,210,236,167,33,124,102,151,11,155,248,249,95,154,89,209,246,92,51,188,60,179,66,127,85,52,155,73,176,
+134,209,64,107,7,218,53,221,83,130,205,238,237,165,44,61,48,28,110,168,245,1,153,172,231,102,212,121,226,8,206,6,155,92,180,171,147,206,103,10,150,190,8,207,204,36,233,235,222,168,230,141,100,20,44,192,226,167,180,94,77,204,57,88,12,235,10,170,199,84,
+222,91,173,179,97,118,69,59,116,222,176,161,69,248,88,34,39,235,85,13,208,98,51,177,193,7,47,187,186,74,31,44,231,196,54,167,14,154,95,118,105,144,136,190,246,149,35,207,158,208,10,144,56,171,54,205,31,19,202,97,217,131,10,247,15,22,51,150,11,30,205,
+138,196,229,96,127,199,160,28,43,196,226,71,198,205,119,212,64,44,62,119,114,73,249,26,208,172,72,92,14,158,147,135,137,44,23,139,177,94,222,177,41,88,213,194,7,113,195,237,131,33,91,88,121,8,238,66,91,19,69,8,54,5,146,232,159,233,11,208,112,200,123,
+149,232,8,177,61,83,92,165,169,100,222,18,209,211,105,32,230,110,117,220,205,237,139,125,91,111,128,126,113,49,197,122,77,39,130,162,182,192,204,138,225,248,231,245,185,148,101,150,81,72,150,33,121,187,49,97,129,68,217,185,100,94,18,101,38,56,214,226,
+247,219,144,249,16,22,106,189,226,79,23,13,16,187,33,155,138,135,2,157,105,146,221,23,42,129,96,0,83,28,97,208,93,233,80,133,195,232,153,68,78,121,64,128,67,35,14,143,15,13,135,155,174,44,198,103,252,195,69,235,22,96,187,179,39,226,99,247,69,187,46,236,
+163,51,89,245,27,11,158,177,89,89,167,234,2,65,29,201,193,193,80,87,213,54,75,248,109,222,183,70,154,183,150,19,45,134,178,22,251,162,137,168,46,180,26,236,199,135,182,70,26,18,56,177,198,163,155,236,147,61,126,109,106,186,21,7,118,180,180,98,56,170,
+25,32,22,127,113,48,164,84,216,68,28,204,53,200,228,43,99,17,205,135,82,21,123,195,62,211,131,114,32,22,223,147,41,90,22,227,55,227,201,9,33,249,241,157,61,210,197,40,184,142,179,10,172,5,146,138,43,59,17,91,30,26,13,87,237,178,66,188,137,181,21,201,
+74,124,157,77,228,180,238,44,193,30,92,191,65,216,231,96,68,193,12,18,167,2,157,225,66,166,64,95,24,14,55,92,216,134,119,246,5,139,42,137,107,21,25,128,62,79,151,246,110,223,212,31,116,236,217,176,17,150,21,198,195,173,78,142,53,236,81,92,141,51,153,
+130,230,151,243,206,82,150,94,91,200,104,255,139,255,255,140,34,47,28,187,112,125,183,143,221,35,19,92,74,23,181,251,215,142,32,216,255,204,166,160,118,223,58,171,172,42,56,176,14,4,186,52,207,190,30,84,224,165,212,61,71,249,53,162,247,18,57,42,230,87,
+105,83,21,207,195,141,160,66,254,233,243,9,250,64,225,231,114,26,159,142,249,105,115,144,119,224,69,39,117,180,237,123,224,52,80,201,117,120,91,148,34,190,206,186,94,124,248,115,188,191,168,8,56,181,156,163,164,34,241,181,215,211,193,238,7,245,202,165,
+148,18,111,108,65,176,35,120,175,255,167,173,145,170,123,113,53,188,157,29,180,167,199,79,31,197,213,189,223,58,255,126,36,162,121,228,154,5,158,193,243,169,130,50,159,190,195,13,138,237,141,0,207,98,149,158,116,95,217,26,97,57,216,195,31,243,200,82,
+86,139,163,84,130,65,160,253,6,226,139,161,144,87,19,161,196,239,82,112,11,120,23,111,10,251,88,167,239,79,38,115,202,222,33,236,65,15,141,69,168,219,219,248,26,143,57,15,170,227,75,161,113,110,141,250,105,75,55,111,44,142,231,87,124,177,175,128,115,
+9,58,249,161,85,120,168,163,106,76,180,152,41,210,27,151,210,218,220,36,213,158,196,250,60,134,90,197,67,229,88,117,54,108,21,152,47,113,151,1,91,222,122,192,138,176,213,115,203,100,156,169,65,230,210,121,37,211,96,113,221,118,195,168,119,223,205,37,
+223,47,149,213,53,84,202,216,225,11,149,54,59,35,94,218,228,239,250,56,115,135,234,97,12,185,154,78,229,53,225,210,237,190,73,149,24,240,243,191,7,27,219,87,132,214,128,64,94,243,206,108,18,8,17,120,231,127,124,58,174,36,27,122,44,153,211,218,140,185,
+64,6,94,108,100,4,149,92,191,161,74,102,33,95,108,217,126,130,61,217,200,123,173,131,189,92,229,251,77,165,225,117,156,49,214,173,189,1,37,21,54,168,202,230,174,168,66,11,246,113,5,85,115,176,241,128,215,48,7,248,153,63,27,243,43,173,42,254,230,120,180,
+170,213,68,35,160,2,241,193,194,106,203,42,139,241,12,247,121,61,52,88,58,216,199,11,171,90,117,152,236,53,130,42,254,188,152,49,220,170,94,137,163,113,53,157,79,88,55,141,238,65,170,227,75,65,176,35,186,86,65,165,189,37,232,185,178,151,91,233,67,108,
+102,30,67,59,191,187,176,189,50,19,175,84,98,202,6,137,110,17,138,13,130,192,211,200,80,191,90,192,139,169,221,90,229,204,14,120,193,75,135,138,18,213,98,49,149,252,128,240,37,180,30,238,131,183,208,60,102,2,121,82,44,38,65,96,67,117,63,151,144,244,182,
+84,47,8,10,128,56,12,129,178,154,189,17,18,20,199,151,178,244,202,98,198,146,129,107,58,240,211,53,11,222,111,180,12,255,112,82,205,224,209,61,204,211,251,241,59,128,159,62,247,125,134,168,203,13,119,135,142,206,78,102,47,201,235,20,10,197,176,243,168,
+53,244,179,81,16,167,163,26,203,202,67,41,62,251,77,125,129,170,162,60,10,16,142,46,100,44,127,239,133,246,231,72,34,71,251,6,130,44,9,33,196,88,170,4,40,88,30,153,65,245,254,35,8,118,102,61,217,216,154,132,227,163,219,141,107,58,84,118,54,252,199,19,
+139,172,159,171,213,252,110,102,69,235,190,229,196,14,149,245,252,222,9,46,2,155,40,39,115,109,104,103,192,49,224,5,98,241,215,76,8,86,130,243,200,137,5,64,203,249,210,168,185,64,158,74,1,1,188,141,85,240,220,108,146,229,57,65,187,150,248,141,11,156,
+64,144,132,213,210,161,177,72,77,15,124,28,230,225,23,251,173,29,61,90,71,139,21,112,250,233,66,200,219,165,72,212,84,209,169,178,141,65,120,220,136,191,147,63,140,14,120,212,132,230,205,206,99,168,7,58,175,186,153,44,55,54,242,105,198,66,12,85,123,208,
+70,80,229,245,159,118,244,104,221,46,181,132,58,36,194,245,247,254,14,230,132,136,224,110,144,120,120,129,193,143,29,177,21,98,44,21,224,60,199,97,213,131,253,7,251,153,32,8,214,128,119,151,163,144,203,83,138,145,219,9,12,43,95,96,180,221,125,207,38,
+195,59,69,40,54,1,6,250,21,153,170,1,112,29,125,64,96,187,192,121,32,197,160,172,33,70,223,45,129,143,249,44,127,130,3,118,31,66,235,192,187,203,85,213,141,170,95,21,239,46,170,138,255,96,114,50,50,14,67,191,153,145,193,40,2,31,16,139,32,0,53,83,237,
+142,119,237,224,104,152,190,108,114,112,91,35,236,238,229,21,166,48,156,86,5,42,172,189,198,21,137,218,220,52,105,27,221,16,170,4,93,21,226,251,173,204,3,114,85,60,75,27,129,224,251,200,246,88,83,149,156,248,25,97,19,96,197,123,47,184,7,84,1,191,108,
+82,44,126,105,102,69,153,53,210,24,99,82,244,150,126,17,138,91,201,100,154,255,252,199,93,132,39,240,128,115,28,180,24,182,235,41,58,27,182,146,103,207,39,89,116,65,216,88,216,197,97,64,148,55,147,252,158,105,146,54,215,117,236,4,103,69,8,89,88,21,34,
+52,199,69,5,126,123,42,196,103,161,113,184,131,239,123,25,253,132,203,65,37,176,209,3,17,68,226,167,167,150,197,47,82,96,3,98,220,225,177,168,97,145,235,198,190,128,242,10,41,110,15,181,77,65,241,147,119,2,42,4,93,85,92,23,229,175,174,87,249,94,33,57,
+100,198,23,22,239,189,84,22,11,156,24,141,141,16,23,61,59,149,80,102,195,135,247,144,51,17,134,98,36,41,34,106,29,72,74,112,119,128,202,249,207,158,236,87,48,172,77,197,53,91,9,42,128,97,183,104,70,44,134,72,108,133,221,106,163,200,234,106,146,119,18,
+57,122,222,228,208,17,124,63,174,211,78,168,24,240,130,233,154,130,253,56,162,224,217,61,34,86,0,45,133,115,106,54,24,14,241,182,60,151,131,3,17,14,54,201,38,170,95,80,177,240,228,100,92,68,98,129,149,175,142,68,76,239,123,104,91,223,94,101,170,181,89,
+84,216,68,112,180,16,11,87,163,194,122,9,195,19,157,66,159,130,231,127,68,97,252,200,97,211,4,161,121,136,105,208,160,32,80,41,54,250,217,153,120,195,21,154,39,226,89,250,193,169,37,165,131,177,38,20,88,44,237,235,145,36,75,43,153,100,78,42,188,161,112,
+64,170,96,156,177,48,255,57,78,197,53,91,141,46,22,167,13,216,70,96,173,182,147,72,76,50,204,142,7,136,188,231,78,46,105,6,223,205,28,18,113,24,120,242,76,123,78,109,85,49,224,5,89,104,180,36,182,155,168,238,116,224,137,134,0,243,147,76,21,49,88,40,69,
+192,107,29,183,50,182,22,233,168,30,78,136,131,205,95,79,45,105,85,89,183,244,6,52,239,204,141,96,189,157,77,21,232,157,197,140,165,19,130,5,117,160,58,105,227,193,115,46,157,183,124,120,21,149,6,215,113,181,184,31,216,220,173,196,138,106,212,65,85,165,
+240,14,175,244,30,155,97,78,193,190,130,231,141,219,218,32,91,228,127,118,85,181,145,171,16,160,253,10,60,154,85,120,73,83,105,13,226,24,28,6,238,26,8,210,83,22,119,23,34,121,116,115,204,79,155,2,30,10,123,215,223,183,226,218,26,197,179,171,116,100,41,
+35,241,182,195,65,44,141,189,4,201,199,235,194,62,26,41,37,237,195,190,78,74,230,86,41,183,186,70,231,83,121,58,150,204,41,91,35,202,137,249,249,223,195,193,32,126,38,25,72,220,42,94,153,79,211,120,152,199,46,232,47,11,25,75,158,67,42,157,117,162,27,
+138,98,84,13,103,109,7,124,10,138,2,84,205,99,104,53,56,127,252,211,201,37,45,62,64,119,125,189,119,3,85,196,24,134,119,92,129,149,139,89,218,74,40,190,190,66,213,154,85,130,0,30,138,239,125,180,168,61,20,104,219,174,85,145,135,44,195,159,47,103,218,
+122,65,82,21,148,111,92,212,133,117,223,32,180,111,108,9,117,93,117,192,66,176,127,49,93,160,183,22,50,202,23,159,95,207,165,232,91,76,129,194,75,23,219,207,134,197,73,56,249,29,67,5,141,62,152,174,124,63,72,23,87,37,249,208,38,96,189,131,13,81,53,113,
+14,255,253,230,129,160,182,207,190,50,151,178,76,232,184,149,177,181,29,63,3,14,246,110,126,102,47,101,11,236,66,241,180,130,150,86,36,37,110,102,110,159,60,189,172,230,153,229,22,223,209,197,97,213,161,222,174,220,196,88,20,129,100,123,247,92,74,75,
+190,171,6,2,241,231,135,187,171,88,209,116,104,103,152,251,187,195,244,185,213,53,122,235,82,90,4,20,135,131,189,228,76,54,77,116,185,181,130,170,71,133,1,187,208,82,244,121,33,102,236,119,168,180,159,188,168,216,151,21,235,222,129,193,16,245,250,187,
+42,90,160,160,163,203,13,26,141,17,84,116,143,181,251,114,128,103,8,95,122,66,54,230,189,122,191,109,69,97,11,206,22,251,250,2,180,37,228,189,38,201,141,24,113,58,149,215,186,186,245,243,135,227,133,98,136,1,187,99,190,170,213,140,15,20,215,180,182,136,
+163,241,156,37,162,177,254,80,80,153,39,26,42,158,78,151,90,51,220,178,240,168,200,26,147,222,62,184,168,228,210,142,163,158,96,130,96,31,198,243,248,66,53,229,203,179,43,202,68,19,28,108,48,252,2,3,153,204,0,79,53,17,244,4,14,164,106,184,253,64,5,200,
+125,91,194,13,5,151,154,208,49,18,166,125,153,2,253,112,82,237,160,88,120,19,143,69,120,91,232,80,253,165,29,236,25,89,118,80,247,210,201,68,158,173,75,133,74,1,176,10,81,19,1,62,170,65,184,188,159,215,214,72,217,16,147,15,226,89,186,61,192,231,23,63,
+169,40,158,64,146,27,241,139,221,129,85,4,87,53,177,206,158,136,239,227,100,167,42,14,15,117,211,174,6,219,245,33,14,64,60,193,16,76,187,181,196,10,130,96,15,176,102,141,134,186,12,239,217,56,163,254,242,124,66,105,146,236,107,35,225,134,134,177,33,118,
+196,154,135,162,191,159,77,46,183,101,215,183,96,45,40,214,107,117,181,48,226,149,7,134,106,105,70,164,21,18,224,11,115,19,208,221,253,220,108,210,185,30,197,56,152,61,58,18,161,67,99,145,154,11,19,42,28,241,231,248,123,248,251,170,38,63,87,66,23,141,
+209,246,83,46,32,187,129,130,162,197,62,163,192,187,207,137,64,48,249,70,19,147,245,241,30,64,52,193,70,169,10,12,191,48,51,105,249,221,75,105,229,7,36,161,62,78,18,147,4,247,0,113,3,107,88,179,21,8,125,129,46,250,246,68,76,233,125,82,49,40,108,68,129,
+175,183,138,68,225,154,162,45,25,251,73,51,190,227,245,248,179,194,248,235,231,83,9,182,107,189,175,176,226,239,205,120,150,213,255,88,149,151,36,108,15,184,57,173,96,56,215,136,159,255,189,143,41,238,232,105,70,36,46,7,137,144,239,126,178,87,229,71,
+19,92,192,66,134,191,16,36,238,32,255,245,118,6,182,57,56,199,53,11,146,184,170,7,75,35,6,108,68,36,46,7,130,49,206,217,42,236,248,4,193,74,96,203,248,232,120,172,41,155,52,252,93,124,143,35,43,138,81,54,109,100,178,56,42,126,254,99,32,166,101,173,164,
+106,81,45,43,249,53,82,177,182,94,150,223,155,182,105,221,111,80,240,197,70,249,205,241,168,178,10,59,8,189,23,50,5,109,184,75,163,149,54,56,184,162,26,89,213,148,101,167,129,245,109,34,228,37,127,89,82,43,94,88,165,83,169,188,37,109,190,16,147,238,103,
+190,166,138,225,76,130,123,192,154,103,68,220,208,129,200,161,114,221,115,18,104,171,228,28,86,153,84,120,72,127,117,46,101,186,75,133,74,7,81,149,73,72,84,28,189,55,159,54,109,65,129,202,100,85,213,196,84,234,252,249,227,124,90,171,150,50,139,74,47,
+73,120,227,194,246,128,19,21,133,26,131,74,134,238,121,149,217,3,60,56,16,52,181,142,162,186,24,130,139,84,22,11,70,81,225,233,254,158,5,5,38,40,50,251,108,204,175,117,8,247,5,60,31,235,15,136,109,33,126,35,17,133,68,156,21,182,49,118,230,183,151,211,
+244,65,50,167,205,89,168,247,123,198,189,59,186,144,209,190,71,37,88,179,140,118,252,160,48,1,231,109,204,161,114,123,101,49,126,95,220,243,102,228,108,168,30,136,196,70,109,97,240,251,118,156,80,140,210,105,35,34,177,78,184,244,253,152,236,234,246,5,
+93,37,42,130,1,112,204,229,131,53,134,74,237,212,102,64,133,29,170,74,158,158,85,227,5,140,36,204,127,169,51,88,140,74,126,84,199,151,178,244,202,98,70,222,69,34,58,216,191,126,136,171,38,176,223,93,26,244,247,218,229,180,114,91,5,110,49,105,70,108,32,
+4,19,124,206,164,247,29,149,214,61,216,65,185,221,119,110,42,153,55,37,22,109,228,53,3,21,68,141,130,228,225,216,66,70,107,131,51,10,14,34,191,153,73,42,251,140,58,16,120,3,93,157,134,239,45,68,98,43,4,56,60,255,163,33,175,41,171,20,8,239,191,184,152,
+98,253,92,229,32,89,9,111,92,46,79,68,220,91,183,131,216,145,195,75,27,130,139,172,163,130,81,184,61,221,139,171,107,74,91,186,33,16,223,213,27,160,189,155,42,127,102,104,17,56,235,226,11,67,171,172,16,62,237,142,62,64,17,122,205,13,97,159,182,223,148,
+15,66,155,207,22,104,42,85,176,164,56,8,201,49,14,91,168,71,183,199,180,57,84,110,6,231,184,102,171,178,235,161,162,195,64,184,2,10,207,238,220,108,174,48,192,113,66,241,67,35,17,211,25,13,124,255,87,71,34,74,166,138,11,235,168,24,240,130,128,192,237,
+25,189,175,140,69,88,174,131,195,236,208,124,90,233,253,212,7,139,33,208,218,216,154,141,73,233,110,31,130,163,131,133,252,11,195,225,134,134,12,33,24,61,212,29,161,91,19,121,122,102,38,169,76,96,231,22,147,48,80,81,16,140,128,164,22,151,96,132,131,156,
+219,5,14,36,8,191,27,245,177,220,83,136,176,170,135,5,66,144,212,45,196,154,5,159,79,117,75,107,57,184,183,15,22,86,155,142,125,22,44,240,209,46,7,123,199,67,20,54,36,22,67,36,254,201,148,250,207,138,1,106,28,149,207,224,119,38,44,177,106,17,87,16,63,
+205,43,24,184,8,48,207,130,11,89,71,5,163,224,204,129,245,174,143,201,174,233,164,162,193,159,84,18,137,191,62,22,109,120,0,40,246,41,8,202,19,17,159,182,70,186,189,0,6,103,188,89,172,19,45,92,43,110,234,231,209,33,240,187,117,123,130,12,231,56,110,161,
+248,213,121,117,9,103,129,180,202,126,179,154,169,163,60,138,81,161,200,53,177,25,130,203,29,140,131,82,132,171,209,7,188,112,162,50,32,112,2,152,154,201,53,48,135,152,15,14,181,64,176,132,10,216,242,47,17,137,215,209,109,116,154,93,215,112,192,71,0,
+171,202,115,29,130,71,145,41,200,197,161,160,213,38,254,130,49,80,17,130,129,177,67,204,3,155,154,97,103,148,47,48,69,192,164,194,111,46,93,228,95,207,150,11,234,196,205,223,51,9,103,176,241,178,2,120,31,190,62,151,106,170,77,17,221,23,79,78,198,45,183,
+25,67,101,241,19,104,83,93,169,191,230,33,70,122,126,58,105,185,37,10,246,228,39,167,19,77,251,73,194,110,226,7,147,113,75,4,16,28,200,57,98,72,116,45,169,218,127,96,179,197,205,178,162,216,104,48,196,87,23,132,117,20,241,168,213,232,251,81,249,151,149,
+115,103,4,30,158,61,207,211,225,161,37,2,21,117,70,54,43,18,151,131,239,81,25,159,11,141,129,34,131,102,103,90,212,2,195,237,220,12,246,81,78,93,7,215,146,179,161,58,180,179,27,67,103,191,163,42,138,247,49,87,168,226,122,50,60,75,29,168,226,56,188,45,
+202,114,125,12,204,81,21,16,56,133,3,76,213,53,58,42,172,65,132,38,238,191,73,27,29,4,163,42,59,35,32,38,153,181,57,129,216,204,117,40,16,212,83,238,195,87,105,125,152,74,228,233,100,50,103,217,190,137,118,105,174,106,98,157,61,61,1,246,42,88,136,145,
+176,210,105,212,151,189,17,206,167,212,5,208,248,249,183,47,101,77,117,13,64,224,180,50,200,135,112,8,15,72,180,1,215,178,232,177,250,25,173,4,18,229,250,186,140,42,36,188,79,229,192,154,11,93,87,173,238,144,66,139,244,159,150,179,116,91,111,128,198,
+35,190,138,247,20,98,204,100,50,71,175,160,3,201,226,4,47,172,56,48,64,205,232,26,128,131,168,202,184,17,239,61,183,111,227,49,5,237,216,16,117,57,5,19,240,153,190,0,29,159,182,102,111,175,103,99,134,42,119,12,171,148,243,156,51,192,186,135,196,159,217,
+142,1,149,137,74,196,214,102,10,211,240,189,15,13,135,181,132,156,208,26,198,194,188,3,129,97,199,135,152,212,205,157,205,24,220,251,248,206,30,150,107,169,234,244,17,214,217,29,227,41,138,113,140,82,4,101,156,243,16,70,37,191,98,84,244,201,96,59,53,
+224,16,121,54,145,99,105,85,120,225,130,136,77,49,198,106,98,29,84,215,169,110,29,22,42,243,192,80,216,244,1,19,98,30,188,141,85,120,162,225,185,24,54,57,160,9,98,179,219,237,61,22,116,126,0,0,32,0,73,68,65,84,98,156,194,222,176,143,14,12,215,110,83,
+66,37,59,190,144,100,197,160,49,213,30,115,55,40,168,254,141,249,213,84,71,163,114,177,154,143,97,179,64,124,82,45,122,24,181,73,64,210,22,251,113,43,246,13,84,178,98,173,195,23,98,183,160,167,147,122,189,157,180,88,18,48,207,102,10,182,107,247,133,192,
+109,231,118,85,136,191,154,223,240,197,148,150,188,236,243,94,137,51,80,41,223,234,248,248,31,79,44,106,131,40,155,109,85,71,236,249,83,11,132,76,120,146,114,189,247,168,66,87,33,198,143,50,181,249,151,227,239,84,223,101,130,119,188,145,193,200,16,229,
+48,172,7,98,50,252,200,229,76,103,127,176,38,246,251,61,134,147,149,42,19,149,72,76,112,20,210,32,86,130,118,161,122,166,136,80,25,206,57,43,58,136,73,103,93,108,63,129,243,28,222,61,179,69,68,72,20,73,53,177,90,198,195,60,231,39,199,88,79,140,43,106,
+115,186,142,233,70,10,149,65,160,110,182,85,1,7,112,17,51,137,189,178,14,108,239,230,205,184,10,141,193,213,18,2,118,247,5,148,181,184,161,141,250,121,3,135,109,84,18,63,125,118,89,222,91,135,240,240,112,55,29,28,109,60,113,129,131,59,254,254,65,38,255,
+55,43,241,112,151,214,149,192,80,78,174,9,206,71,45,242,244,198,251,141,247,180,209,61,26,54,50,255,237,212,146,45,222,107,136,65,56,128,67,80,215,109,141,220,238,9,105,22,136,148,229,22,81,118,17,220,96,205,209,168,245,136,86,69,124,118,217,18,145,152,
+152,223,251,215,28,52,4,75,85,194,77,7,98,221,35,219,99,77,21,8,65,48,70,151,22,4,102,193,254,32,89,137,248,178,25,155,51,12,90,134,181,143,202,61,136,179,123,249,14,7,198,72,66,117,70,24,45,124,156,10,222,61,35,231,66,157,247,230,211,226,113,175,24,
+36,253,185,58,157,28,243,196,111,82,144,17,39,109,130,175,163,108,154,29,9,218,7,31,223,26,53,36,140,97,65,193,97,86,80,67,204,43,1,117,43,224,106,9,161,146,95,224,158,136,79,89,5,34,130,130,115,39,151,52,79,235,122,239,48,170,13,79,196,179,174,183,137,
+113,18,95,222,28,50,52,40,12,160,146,46,187,186,38,65,95,169,218,245,15,23,83,90,101,155,25,208,70,109,229,212,116,84,117,28,63,29,215,218,211,209,78,222,231,247,144,223,115,37,46,202,22,87,233,66,170,64,175,42,30,126,42,8,181,208,43,179,245,231,52,226,
+237,164,112,41,126,193,228,244,120,190,72,239,197,213,249,17,87,131,235,189,135,255,179,147,42,15,211,10,215,2,36,210,141,222,79,196,67,16,139,225,79,46,179,48,236,15,226,75,124,193,79,22,86,1,213,170,64,145,0,58,186,152,85,30,107,32,201,192,217,189,
+140,152,25,133,28,146,196,108,15,172,232,164,112,2,120,103,151,207,46,107,29,31,141,10,146,72,168,194,46,198,202,61,26,239,243,150,64,23,197,202,214,149,73,116,187,219,176,251,140,147,62,70,109,199,49,66,177,79,81,197,92,180,171,189,133,50,188,36,168,
+154,30,9,93,93,57,138,65,57,240,64,60,146,200,89,242,178,192,175,15,94,125,152,150,220,200,162,130,160,0,254,53,210,154,32,180,35,92,45,33,58,59,195,234,132,98,218,224,185,249,224,64,144,6,131,94,173,162,8,213,153,16,146,86,242,107,116,58,153,19,193,
+208,97,192,110,226,198,62,115,3,58,224,51,120,218,70,213,135,245,200,42,24,60,167,131,119,112,52,212,101,88,120,71,32,253,76,139,60,13,53,193,216,162,42,76,65,48,138,29,159,83,188,247,129,206,14,195,158,171,72,174,106,246,31,14,130,121,86,245,199,64,
+84,187,207,164,232,142,51,6,172,189,84,205,111,16,248,41,47,46,128,37,94,180,36,236,156,183,120,24,242,68,136,191,203,242,83,33,175,114,155,46,193,26,144,144,20,214,193,123,249,189,143,22,53,109,103,119,175,95,75,220,110,108,216,67,241,80,50,111,77,146,
+71,7,123,72,173,89,22,123,75,255,139,121,22,239,44,58,43,65,219,10,164,134,190,77,129,0,176,127,48,84,53,51,58,68,235,135,217,59,55,135,180,54,87,43,42,152,244,138,16,4,1,24,40,212,183,97,80,64,113,109,141,46,166,11,244,214,66,70,4,98,139,144,77,207,
+122,56,91,66,116,34,204,254,237,181,88,175,240,151,42,255,118,96,63,211,128,204,3,155,187,149,28,202,177,95,152,29,120,179,145,5,197,130,246,83,51,43,116,48,183,218,180,111,41,42,137,33,18,75,21,156,32,56,15,172,85,153,213,53,45,166,110,102,127,71,37,
+177,106,145,88,197,58,138,129,140,42,192,1,159,163,162,19,149,156,176,175,144,1,119,206,163,149,214,70,126,5,69,105,131,176,66,145,28,172,229,64,164,228,118,26,187,44,254,231,215,176,113,14,195,173,165,217,34,173,120,143,27,245,181,167,178,153,43,187,
+22,50,244,226,124,186,173,42,140,23,24,181,29,199,8,197,168,128,29,82,240,113,231,179,237,37,72,34,147,242,197,193,198,91,137,17,208,226,64,59,17,241,89,54,4,66,111,53,18,154,3,62,94,220,62,197,103,86,36,147,102,53,156,45,33,58,102,166,51,11,238,4,135,
+104,174,22,75,28,202,85,13,134,69,139,51,231,80,146,183,44,240,255,69,226,21,237,109,240,39,172,103,215,130,42,98,171,146,181,130,32,168,3,162,228,169,84,158,238,26,8,214,141,193,49,184,14,158,196,86,85,51,113,175,163,170,44,225,140,14,55,171,196,245,
+81,17,138,5,193,173,160,146,53,194,60,4,94,186,38,235,211,42,125,7,103,26,35,150,69,232,170,68,215,253,79,166,150,219,70,44,230,44,56,113,140,80,60,159,41,210,39,99,252,215,189,216,70,217,33,136,196,95,31,139,26,18,141,244,33,16,79,79,45,203,196,96,155,
+18,207,21,155,158,252,93,11,100,91,69,176,23,4,119,178,147,217,254,100,79,204,79,103,20,84,198,77,37,243,108,226,1,68,89,171,186,85,244,129,96,118,177,127,18,4,65,61,56,160,161,171,160,123,46,165,205,14,128,55,162,254,238,163,48,101,57,191,74,199,146,
+57,203,59,7,254,124,153,175,170,24,34,183,10,196,31,86,16,4,46,96,119,192,217,73,97,118,48,191,160,14,51,190,246,84,210,192,160,159,253,96,50,222,54,191,37,88,107,160,98,218,44,142,17,138,17,88,113,183,78,129,83,109,228,77,130,74,98,51,149,133,168,46,
+70,201,254,143,206,196,37,176,178,33,47,205,165,232,240,182,40,219,7,155,75,137,189,71,43,224,108,9,209,65,219,186,224,44,90,217,158,5,54,90,255,152,101,192,175,38,156,128,119,225,119,34,62,22,187,150,63,182,96,48,42,18,175,103,178,105,34,169,24,22,4,
+215,128,24,250,227,106,86,27,188,251,168,132,107,116,70,72,61,158,155,81,211,71,175,194,31,118,91,160,203,114,15,74,120,118,246,251,61,218,176,104,88,116,172,20,101,224,171,83,200,42,56,251,206,73,241,85,75,224,92,243,0,230,38,9,246,131,195,215,158,74,
+98,241,193,254,96,219,116,247,157,76,230,220,37,20,35,251,142,44,118,189,54,206,166,174,185,82,104,27,63,64,100,83,140,14,208,41,7,217,124,8,206,79,201,130,104,59,80,9,183,144,41,176,85,21,171,10,246,133,218,96,205,65,101,35,167,79,113,66,124,77,109,
+15,166,245,31,64,50,207,223,117,149,111,218,253,165,234,254,197,108,65,75,6,89,85,241,202,89,185,165,93,207,167,206,39,251,229,217,21,186,127,36,108,234,26,216,239,229,176,46,8,130,91,121,242,76,156,190,177,163,199,148,111,231,235,115,41,109,184,173,
+10,84,248,195,90,5,196,225,91,250,3,215,216,123,232,103,86,20,58,201,144,110,251,131,193,188,183,51,127,202,233,54,179,184,116,18,28,177,35,88,176,120,168,162,208,56,92,190,246,0,86,172,127,90,206,182,133,54,136,68,245,190,129,160,233,123,227,168,97,
+118,240,243,58,212,29,97,189,94,187,112,247,102,190,106,107,8,206,67,243,105,25,170,99,67,158,61,159,164,199,38,98,166,189,138,223,195,239,87,81,176,47,212,103,50,153,99,73,236,232,156,148,137,202,182,101,168,171,147,190,50,22,169,233,149,134,131,59,
+18,64,232,24,192,97,242,231,83,9,199,189,159,220,194,115,57,90,213,245,116,210,112,192,143,123,42,19,240,5,65,112,51,216,83,94,184,144,164,251,182,132,13,137,197,199,151,172,155,92,239,20,176,191,31,26,13,55,84,192,129,24,0,123,60,146,150,178,31,217,
+19,116,0,37,243,171,108,241,140,149,5,105,40,70,184,57,230,215,42,217,117,178,171,171,244,193,178,123,231,2,225,231,222,190,148,53,101,95,134,249,64,63,156,180,230,125,197,176,243,29,33,175,102,89,164,19,47,172,106,221,239,162,201,84,102,119,95,128,245,
+122,255,67,212,223,54,85,197,47,204,172,208,161,49,115,186,169,163,132,98,180,15,97,58,225,141,12,15,5,38,13,91,221,142,164,10,248,122,113,15,179,186,173,55,160,124,18,179,211,64,123,195,103,99,126,154,8,251,180,234,57,61,144,64,80,177,144,41,106,98,
+157,106,191,73,4,250,191,159,49,151,33,69,176,175,106,16,137,221,65,187,255,190,254,192,53,85,157,84,242,47,157,73,229,233,69,133,21,51,58,71,227,124,66,49,62,247,17,241,154,182,37,120,222,62,55,220,221,84,98,7,135,73,36,131,240,158,59,41,184,87,109,
+127,162,139,197,205,222,207,179,137,28,253,116,90,186,39,4,65,16,176,142,158,59,181,68,143,140,71,27,30,110,7,161,196,138,253,72,69,219,191,74,32,18,27,41,220,64,149,241,183,39,98,244,253,211,237,227,135,217,78,188,61,159,54,229,119,90,142,21,5,105,135,
+135,186,105,103,212,87,245,57,220,134,56,116,117,141,78,46,231,52,43,47,183,129,159,249,176,193,65,153,56,95,161,19,67,53,24,196,118,75,111,160,170,150,115,119,41,198,254,243,98,70,6,116,150,129,110,122,206,238,92,48,1,91,192,54,17,138,161,115,246,206,
+172,152,90,207,60,253,127,243,216,223,179,126,42,197,124,184,146,167,155,194,62,83,211,123,97,240,252,243,54,90,44,111,239,9,208,150,110,94,111,47,111,71,7,189,189,36,139,17,149,4,226,207,245,5,181,172,204,214,176,87,19,137,203,23,38,252,223,49,191,135,
+182,71,124,180,183,39,64,129,53,162,51,25,117,45,42,23,114,69,154,91,201,211,167,162,62,234,108,178,44,4,34,177,27,3,5,4,244,255,235,68,140,174,235,241,107,107,71,165,219,134,32,171,199,239,161,189,125,1,218,21,244,106,237,39,170,184,148,95,213,254,13,
+142,118,253,183,46,165,165,37,202,134,224,153,67,245,80,167,129,234,127,188,215,59,34,62,58,17,207,82,82,209,225,153,235,249,211,185,148,46,210,123,138,133,4,172,125,255,122,57,163,221,219,254,10,201,158,114,80,69,252,47,231,147,244,242,130,84,192,9,
+130,32,232,96,79,121,125,33,67,222,226,26,245,248,58,201,239,169,188,15,164,11,171,116,122,57,71,255,245,236,178,182,246,170,38,216,217,65,215,51,118,90,129,231,231,82,148,87,164,63,127,115,71,15,121,13,138,20,184,231,187,195,94,122,71,206,89,182,227,
+92,182,104,90,103,160,146,214,240,210,130,58,193,9,113,16,158,193,193,80,87,221,179,32,254,124,32,208,165,21,129,157,90,206,41,139,43,237,202,177,100,158,210,217,34,109,15,123,27,62,55,163,26,252,255,58,19,87,122,175,160,47,252,47,163,81,173,42,182,222,
+243,134,63,135,206,128,216,253,120,50,167,108,93,115,18,183,70,253,236,250,23,238,243,171,109,84,76,135,245,172,152,95,213,158,29,35,56,78,40,6,199,150,115,52,226,235,210,196,185,102,193,193,251,255,185,208,94,213,69,255,102,32,196,238,15,217,110,47,
+138,81,80,173,125,120,52,66,19,177,198,94,48,136,141,16,147,85,47,228,151,11,171,154,96,130,127,167,219,91,89,248,44,71,23,77,94,117,97,80,138,170,206,135,199,163,228,109,66,176,195,251,116,103,95,128,62,138,171,11,168,46,164,243,180,59,230,55,101,35,
+130,64,230,153,57,241,19,183,35,8,224,187,76,252,110,241,78,227,249,120,77,145,208,185,45,224,161,205,65,190,166,162,99,75,89,165,9,178,171,254,173,100,158,94,189,156,214,2,127,84,187,21,138,235,157,29,151,179,5,250,235,82,150,254,239,243,9,122,115,49,
+171,173,147,130,32,8,194,181,96,189,198,58,137,88,31,107,233,197,116,129,206,173,228,181,47,172,161,16,147,177,214,90,5,18,232,16,178,204,90,171,233,160,2,239,53,69,86,25,143,111,141,26,58,131,150,131,115,22,196,122,171,246,77,161,113,166,86,204,197,
+231,120,246,254,121,58,161,236,12,168,87,179,55,155,168,192,207,179,167,199,175,244,108,99,87,244,66,131,30,8,180,93,149,19,100,168,32,62,191,146,167,255,247,92,130,94,93,82,91,100,0,125,225,63,108,139,54,61,88,26,231,83,20,165,93,88,201,211,82,209,221,
+106,241,39,66,94,118,161,24,204,167,10,218,126,212,46,64,44,198,207,52,214,68,5,54,214,176,103,207,37,168,227,19,255,240,7,199,62,101,40,213,191,115,115,168,161,31,26,135,200,87,231,82,244,110,27,122,121,34,96,225,28,242,167,243,159,63,92,96,191,166,
+147,128,87,208,163,227,49,195,109,13,120,201,126,50,181,172,212,138,66,231,193,129,32,13,6,189,87,109,56,201,124,145,46,101,138,218,33,192,173,126,196,16,137,205,216,116,64,132,250,241,233,184,178,251,167,37,34,198,162,134,158,49,43,159,47,161,57,48,
+216,6,195,107,56,192,240,32,21,190,144,88,223,30,223,209,195,118,189,255,243,196,162,60,139,130,32,8,130,97,48,117,30,3,133,56,120,121,102,69,73,155,54,68,186,199,119,242,236,157,16,166,190,247,209,34,203,181,4,94,16,159,127,97,56,220,180,181,163,21,
+177,249,119,63,217,107,42,161,162,250,108,35,212,6,149,196,95,31,139,154,178,13,133,174,245,163,51,113,87,199,221,170,244,175,103,167,18,109,99,79,187,17,104,167,59,195,62,26,139,84,22,216,209,9,1,43,85,125,239,116,148,71,241,70,240,67,224,75,255,161,
+135,66,93,87,9,46,229,222,177,226,233,34,52,203,67,35,17,83,222,55,216,0,30,26,14,211,147,211,9,229,247,126,221,115,88,42,192,203,65,48,143,161,45,102,64,32,134,65,37,170,6,25,96,112,198,211,83,203,77,7,163,88,200,159,153,73,138,48,103,83,48,253,156,
+11,92,75,133,80,140,193,24,120,142,170,5,11,205,0,207,127,121,22,5,65,16,4,51,188,178,152,209,218,176,205,250,78,226,252,167,234,220,183,127,128,71,200,166,146,117,29,10,26,220,58,108,204,206,32,62,135,224,123,239,64,176,225,217,72,136,133,94,156,79,
+43,141,135,32,142,153,173,186,199,247,63,48,28,150,161,138,45,2,207,148,217,217,82,152,147,244,197,193,16,61,53,227,222,174,210,233,84,94,137,80,156,46,182,111,2,69,215,78,169,148,12,11,150,42,235,241,51,99,205,219,136,169,187,11,33,230,134,13,158,23,
+203,133,85,203,55,188,242,31,90,16,56,64,85,3,199,128,64,136,48,48,91,111,215,204,148,157,65,16,100,100,178,247,70,48,205,26,21,162,170,166,125,99,97,254,193,100,92,75,120,237,27,8,214,156,182,12,171,9,12,199,144,231,201,190,96,95,52,235,109,87,14,174,
+133,107,170,168,252,64,178,225,91,161,30,83,135,114,28,200,95,20,155,34,65,16,4,193,36,16,216,94,154,89,161,131,163,198,147,252,168,210,253,229,121,117,5,26,99,97,222,86,231,61,61,1,17,138,109,10,158,71,12,118,127,99,49,163,217,162,140,132,188,215,156,
+13,17,151,159,78,230,232,88,50,167,37,224,85,130,88,144,75,24,195,117,84,197,150,66,141,251,238,237,108,56,241,80,15,12,69,31,66,215,112,27,217,36,52,131,170,1,168,149,4,211,118,100,253,231,172,253,179,26,90,109,234,77,216,188,111,141,104,49,91,160,151,
+230,82,50,100,201,2,84,100,84,146,46,93,116,116,118,51,45,226,224,142,254,160,8,123,45,128,243,157,216,221,235,87,38,20,235,232,9,47,100,248,38,66,94,242,151,173,175,241,194,42,157,74,229,93,27,12,56,137,141,201,83,14,112,205,89,5,207,31,14,65,168,104,
+55,106,127,162,31,200,165,154,88,16,4,65,224,0,22,129,1,19,147,218,255,112,49,165,244,160,31,168,50,252,207,40,49,63,239,245,4,126,16,123,67,48,110,53,247,50,89,154,233,224,122,63,157,110,175,185,77,118,7,9,7,78,238,26,8,186,182,170,248,116,42,79,183,
+51,95,19,137,31,225,10,77,41,41,104,143,65,43,119,189,42,61,252,57,170,240,48,241,29,55,92,90,27,212,50,167,32,32,186,224,98,97,115,111,216,103,186,237,173,28,45,107,235,237,20,145,207,66,238,97,222,136,35,62,243,213,229,141,130,3,142,91,178,153,237,
+72,191,201,1,55,149,232,102,92,143,54,162,219,159,124,105,52,82,179,154,125,35,240,225,251,205,76,82,158,85,65,16,4,129,21,36,205,51,197,53,58,48,220,221,112,60,142,2,23,36,46,85,239,73,28,157,106,229,120,184,47,40,180,45,156,3,136,193,112,136,127,16,
+152,80,155,113,230,98,146,45,46,254,29,98,173,199,186,223,204,217,165,30,167,219,112,150,153,25,26,94,113,80,69,188,171,199,223,244,63,5,145,236,219,19,49,250,254,233,184,69,63,146,251,64,246,125,63,243,139,114,52,238,222,23,101,44,196,239,119,179,35,
+228,165,89,177,71,177,140,137,48,127,85,167,74,251,9,129,7,216,188,140,111,8,164,39,211,5,75,43,250,99,94,126,161,184,71,129,248,92,14,130,45,12,197,184,171,55,80,215,31,18,85,196,71,23,50,154,151,164,84,18,11,130,32,8,42,192,217,230,195,83,249,186,251,
+18,132,130,227,75,89,217,147,26,0,69,43,55,132,125,52,138,233,247,101,93,107,185,213,53,58,159,202,91,98,159,32,24,135,187,154,157,179,40,74,104,12,78,173,134,20,92,207,105,188,61,159,54,220,125,178,17,156,111,222,20,173,230,42,26,82,196,140,138,196,
+58,168,198,19,177,88,45,156,47,10,170,192,221,108,149,48,224,231,23,138,99,140,158,165,66,125,186,189,18,252,184,5,28,124,208,122,53,94,165,19,96,47,252,170,45,20,55,145,141,230,182,2,154,78,169,111,133,194,125,249,237,229,180,118,143,246,68,124,180,
+217,239,185,106,45,156,207,22,104,42,85,208,14,239,130,32,8,130,160,26,125,95,194,23,18,193,195,126,207,199,182,92,176,228,186,144,41,88,222,213,82,92,93,51,61,76,236,170,235,173,169,23,183,187,59,59,180,193,87,240,52,173,6,102,170,220,62,24,162,19,241,
+44,253,122,46,37,162,187,13,145,226,115,103,179,93,81,209,135,155,103,33,161,251,228,150,222,0,203,92,41,248,227,203,186,119,53,117,79,179,187,130,93,166,68,98,29,136,197,95,27,9,139,23,142,34,184,94,20,100,83,158,155,149,223,145,224,108,252,204,89,119,
+193,158,96,0,224,157,155,67,117,171,34,240,231,123,55,5,181,170,164,231,166,147,74,3,170,101,5,131,65,84,92,179,26,8,146,100,56,172,32,8,130,96,39,176,111,219,65,12,65,245,109,144,81,40,190,168,120,150,15,196,169,102,230,16,64,76,254,86,216,167,89,82,
+137,181,148,32,240,17,148,179,169,18,158,153,78,208,163,227,49,83,21,242,72,144,73,33,204,181,212,125,98,31,24,49,62,121,118,35,219,34,62,109,194,166,160,134,159,76,45,155,30,66,135,108,138,180,29,9,78,39,153,151,224,182,221,129,72,124,119,19,254,133,
+84,18,140,15,141,69,180,239,85,5,166,151,115,22,8,225,90,50,17,93,16,4,65,16,90,207,84,146,87,172,126,107,65,157,165,89,179,34,177,14,254,62,190,79,85,5,164,96,140,34,115,181,163,5,197,236,66,25,170,18,93,103,51,238,30,192,6,221,10,137,45,20,59,26,1,
+34,177,91,7,2,214,163,166,106,139,106,226,32,179,176,251,192,48,159,240,44,92,13,42,193,224,51,137,33,67,205,130,151,235,183,231,147,146,77,41,85,11,8,206,38,167,64,39,182,178,170,83,168,13,6,78,154,177,218,193,247,170,60,0,205,49,90,69,112,94,75,16,
+4,65,16,4,227,60,61,203,39,40,224,236,117,92,81,69,49,236,38,48,164,214,104,149,29,190,15,223,223,205,88,61,45,152,131,251,124,154,41,202,185,198,106,140,138,153,213,192,245,196,46,97,125,214,202,15,78,45,209,84,162,113,49,30,247,238,245,185,148,136,
+196,53,168,169,2,239,31,8,177,255,131,131,10,6,133,9,87,192,98,129,202,226,119,47,165,27,190,43,240,36,126,114,50,46,34,113,137,243,10,50,126,147,138,91,203,132,171,57,178,196,95,161,33,85,157,246,0,135,150,3,12,126,236,95,80,152,180,124,110,134,207,
+190,135,243,90,130,32,88,203,173,17,159,54,231,227,241,173,209,143,191,48,24,85,186,235,4,193,185,96,120,30,7,47,51,138,206,27,185,119,32,104,122,208,21,190,31,215,17,236,1,119,53,59,247,245,132,250,76,50,107,45,220,215,115,50,208,192,158,156,78,208,
+179,83,9,173,74,184,154,40,143,238,123,232,100,16,150,101,72,125,109,106,170,182,125,12,198,208,27,129,17,59,42,149,85,101,80,237,2,14,2,58,231,51,5,75,127,222,242,161,68,159,141,249,105,34,236,187,102,184,18,170,142,167,83,121,58,18,207,138,7,213,6,
+48,245,23,3,29,184,192,66,229,230,225,128,173,0,162,238,125,107,124,131,31,22,92,222,214,99,39,48,1,157,99,82,51,252,220,97,65,161,194,143,119,182,176,74,239,205,167,233,102,147,7,44,92,99,86,42,217,5,225,26,208,17,48,17,242,126,60,216,74,231,131,100,
+206,22,49,13,196,97,120,125,86,218,131,16,143,33,198,72,228,138,244,187,153,149,150,199,195,72,190,125,42,228,165,193,13,93,22,115,217,34,125,152,202,75,181,146,32,108,0,85,197,223,14,117,105,243,119,140,114,54,145,83,86,128,128,119,250,198,190,64,3,
+127,179,62,184,206,139,243,105,89,7,108,0,158,187,191,99,152,27,165,243,234,124,227,69,101,2,15,71,227,185,154,67,37,155,5,215,19,174,230,138,159,253,138,22,43,150,123,67,195,166,163,21,107,25,180,207,207,244,5,104,56,228,37,111,103,199,199,177,33,236,
+100,82,24,204,154,42,176,118,171,112,81,83,40,230,56,140,87,98,52,208,126,66,49,170,67,238,29,12,209,104,183,183,226,52,92,248,0,193,55,213,202,67,1,94,4,100,74,36,91,210,28,240,186,65,149,245,70,113,221,40,71,21,250,143,217,29,4,171,219,2,235,247,209,
+106,177,28,217,68,142,65,156,224,165,185,20,203,117,4,243,112,253,78,193,206,176,79,217,224,182,95,205,167,41,208,213,105,248,243,162,98,233,87,18,196,11,194,85,32,185,179,175,70,165,28,134,86,162,90,228,237,249,116,75,134,50,162,130,248,115,195,221,
+21,227,192,141,64,100,58,188,45,170,197,27,79,156,91,182,250,163,210,144,183,147,238,26,8,214,60,180,30,40,174,105,21,75,191,158,75,137,80,36,8,101,252,124,42,65,143,140,71,13,89,52,34,73,164,114,184,251,158,136,143,253,122,50,228,214,30,32,54,228,136,
+131,145,168,176,170,16,1,118,113,72,68,110,10,116,145,175,179,67,179,208,184,148,41,104,201,72,183,117,51,227,44,124,7,147,198,128,216,65,10,209,106,179,94,56,208,186,226,1,232,131,95,25,139,84,77,42,34,86,196,159,237,242,121,180,36,16,222,75,149,123,
+67,179,116,124,226,31,254,80,53,242,251,187,79,245,41,249,71,225,7,210,78,226,229,215,70,194,218,160,190,70,65,117,226,179,231,147,82,41,102,99,144,129,122,100,123,204,244,7,68,53,49,90,27,220,116,192,186,62,228,165,221,49,31,141,135,125,215,36,155,112,
+128,159,76,228,232,141,197,140,37,67,19,191,243,137,94,211,9,175,86,29,226,133,107,225,122,47,203,249,207,31,46,40,189,211,168,44,108,54,168,199,65,192,142,153,101,65,104,21,72,58,126,117,36,210,212,225,10,157,83,176,226,178,106,255,133,72,124,191,193,
+1,208,16,142,190,127,58,206,254,153,170,1,193,253,206,205,161,134,247,71,196,50,24,118,44,22,101,130,112,53,176,147,105,102,93,178,98,127,127,120,184,155,181,106,81,134,61,217,139,111,79,196,76,85,179,167,11,171,244,79,39,151,148,255,76,7,251,131,180,
+187,175,118,23,32,206,133,120,39,208,9,237,22,144,164,125,116,60,102,234,124,138,61,25,3,220,164,43,220,190,24,141,9,241,187,125,242,76,220,22,58,161,8,197,38,49,186,88,163,212,252,199,167,237,241,16,8,149,193,65,202,204,192,44,0,159,28,183,100,251,176,
+241,61,48,20,110,56,96,254,203,66,70,121,59,27,50,121,143,77,196,26,170,238,170,132,213,135,119,161,54,72,66,28,26,139,176,222,37,43,222,81,180,28,125,126,184,187,238,94,97,151,86,116,193,157,148,183,198,109,60,192,32,112,157,73,229,233,197,185,148,229,
+113,11,68,226,175,143,69,53,187,152,102,209,2,238,201,184,242,196,36,246,154,199,119,246,152,186,134,85,73,73,51,177,205,203,51,43,45,169,44,132,157,219,238,94,63,133,189,158,107,236,60,32,122,192,107,83,146,107,66,171,168,183,199,163,171,20,131,105,
+49,115,192,138,245,179,89,241,186,30,82,48,97,47,176,223,60,186,221,152,208,104,133,8,133,243,224,67,35,145,166,246,108,36,118,159,153,78,88,82,68,100,7,112,158,121,96,36,108,88,44,254,237,249,164,36,110,109,140,153,194,1,178,145,78,88,83,40,254,238,
+39,123,13,11,44,181,104,23,161,216,108,70,79,196,98,251,243,229,205,33,195,62,95,173,58,80,181,2,84,122,30,30,139,54,189,225,89,81,241,101,84,44,22,145,216,126,64,44,224,244,15,39,139,147,57,120,22,247,245,248,105,48,232,189,234,191,207,165,243,244,246,
+82,86,246,2,161,37,224,185,124,96,184,241,36,159,213,173,113,102,69,15,43,246,153,255,125,103,143,161,22,244,141,60,63,157,84,58,56,21,45,192,7,71,205,13,242,180,114,205,196,97,235,238,161,238,134,98,11,136,113,111,92,108,175,142,69,193,121,64,52,30,
+13,92,89,175,172,158,83,67,34,20,187,134,102,127,207,232,104,254,225,164,218,223,163,209,243,32,185,176,74,214,200,189,194,61,122,110,58,105,105,17,26,206,94,253,126,15,197,188,235,154,215,233,100,142,142,89,104,93,226,52,56,10,7,200,194,202,255,90,212,
+20,138,205,10,161,213,80,221,234,107,5,205,218,77,84,195,14,15,129,93,65,203,246,166,128,71,171,32,41,103,33,83,164,35,75,25,165,135,169,114,154,109,209,68,27,205,11,51,43,174,169,36,54,19,20,144,133,237,193,141,6,84,56,108,190,127,57,45,254,176,54,132,
+163,202,127,35,110,170,250,23,132,141,24,77,164,33,118,249,217,228,178,242,131,2,87,114,8,19,174,85,181,182,114,38,176,84,198,132,168,204,254,214,142,30,211,118,76,136,113,254,203,41,245,113,171,17,219,30,18,235,30,65,16,161,216,69,52,210,177,102,85,
+183,154,153,238,31,29,171,45,163,90,13,238,217,189,3,193,134,138,210,96,1,99,213,188,128,70,158,43,136,214,103,18,57,217,111,55,192,169,159,182,186,184,182,230,46,130,9,124,187,152,133,226,116,27,100,31,112,176,226,16,137,1,42,80,112,200,144,10,136,43,
+212,11,112,240,103,247,119,135,233,238,226,26,189,60,187,162,92,48,70,85,240,145,68,142,238,234,13,104,135,150,106,67,116,112,120,122,127,33,67,111,198,179,174,242,36,254,194,176,241,214,25,128,128,226,161,225,48,61,57,157,96,253,92,27,65,144,139,119,
+119,255,64,144,198,194,94,109,160,130,46,142,96,179,203,22,87,233,244,114,78,4,226,26,96,173,42,199,234,74,153,69,5,45,105,11,121,241,247,18,220,137,25,107,158,96,169,245,245,123,31,45,42,189,119,159,30,8,178,92,7,62,137,175,44,102,148,236,205,176,68,
+224,2,247,21,7,52,21,235,42,98,24,142,33,213,136,129,144,180,83,217,49,117,79,41,222,50,2,190,239,48,145,28,94,5,215,50,159,229,27,200,77,165,235,89,133,30,167,151,23,10,33,62,95,200,22,233,131,229,156,101,69,66,78,1,123,197,241,82,247,227,198,24,29,
+88,169,47,64,240,52,35,18,83,233,76,136,189,202,45,158,197,136,73,126,113,49,165,89,49,98,104,228,104,168,139,162,93,87,238,225,114,161,72,231,83,5,77,135,176,74,91,104,52,209,132,120,2,251,237,119,34,62,250,229,249,132,216,230,149,4,118,206,34,219,207,
+108,10,218,87,40,70,144,245,119,140,19,230,193,137,37,231,183,226,223,203,220,250,140,131,144,8,197,235,47,215,161,173,145,134,15,173,88,160,224,255,178,199,130,76,55,22,103,108,90,248,66,5,109,159,215,163,77,112,5,152,218,58,157,45,184,198,87,169,28,
+28,22,205,6,5,96,44,226,213,252,154,84,87,118,162,250,77,14,143,205,129,192,243,150,254,64,213,182,106,43,189,247,206,102,120,131,16,36,119,220,248,222,10,214,3,207,190,27,194,56,4,172,39,169,116,90,113,8,208,193,196,126,51,246,98,216,131,113,160,80,
+181,255,238,173,48,16,213,40,184,142,170,201,253,27,187,158,204,114,115,204,175,228,192,197,49,41,95,231,150,222,128,50,161,24,66,145,217,10,109,252,172,183,174,228,45,23,149,240,204,238,140,120,181,131,190,126,208,70,53,166,254,158,187,197,142,76,104,
+45,23,153,91,247,185,175,87,137,90,21,140,62,143,71,251,239,40,210,66,145,208,31,231,211,114,110,174,64,43,239,9,42,99,141,90,53,110,100,239,166,160,178,196,174,93,193,207,170,237,15,45,222,35,140,84,195,34,190,58,188,45,170,220,58,203,9,124,134,233,
+29,208,65,140,14,11,174,86,221,215,186,233,2,120,209,113,85,207,162,106,175,29,170,245,70,187,189,13,252,173,198,209,50,50,138,42,72,156,2,126,126,44,50,70,64,48,142,133,205,42,63,89,120,39,105,254,73,214,89,52,218,150,125,76,213,94,96,119,204,39,22,
+0,54,2,135,245,67,163,97,234,11,212,222,38,48,88,8,239,32,252,152,222,155,87,107,217,129,64,106,42,145,215,18,11,28,92,144,231,77,80,12,14,79,95,28,12,85,157,64,63,68,93,218,159,193,222,232,232,66,198,178,195,17,18,64,28,158,186,120,247,85,197,47,99,
+33,190,138,56,176,51,172,70,40,222,56,92,205,44,49,102,225,153,74,137,138,106,221,80,70,224,72,16,87,227,144,73,15,101,29,120,27,91,117,184,66,162,251,190,225,238,138,247,24,239,72,249,123,46,34,151,160,26,36,30,155,177,204,171,5,206,238,71,20,191,71,
+15,14,4,233,230,6,207,19,248,153,144,72,250,84,204,167,220,111,87,104,156,207,86,137,113,140,130,235,201,58,105,45,102,45,19,80,188,119,238,228,146,171,189,139,49,12,154,155,235,162,173,19,138,235,70,141,24,88,130,77,130,131,151,219,164,146,79,197,128,
+191,93,204,226,179,211,64,37,177,25,176,176,193,207,78,176,14,84,86,115,30,60,171,9,41,130,245,232,45,233,245,68,226,141,32,208,87,253,30,190,195,24,56,190,34,54,35,130,66,176,70,194,19,182,145,181,13,135,95,84,209,192,223,111,187,95,157,8,167,131,46,
+1,46,14,48,119,89,233,12,248,121,133,98,159,130,216,237,86,166,66,10,213,244,41,16,159,175,87,112,32,194,222,211,236,190,83,13,188,83,86,252,126,48,244,248,208,88,164,161,120,72,23,185,30,29,137,104,73,36,65,80,1,146,141,72,60,114,128,235,168,76,94,34,
+102,108,84,36,46,7,235,4,132,45,193,30,140,50,239,7,220,215,19,106,131,100,13,135,101,2,44,201,220,12,87,23,92,57,17,70,173,165,89,26,250,151,159,60,19,167,162,201,77,2,149,102,237,80,142,94,201,255,135,131,141,83,240,221,4,90,87,57,196,119,180,26,14,
+49,84,72,9,141,49,161,96,19,87,113,240,20,154,199,168,111,41,233,254,144,10,197,98,84,157,163,170,216,44,127,89,200,136,237,132,160,12,163,67,62,81,169,137,239,27,82,28,24,114,84,19,235,244,50,11,186,170,224,244,236,212,89,150,169,223,172,236,99,182,
+187,219,211,163,38,102,215,121,120,184,219,80,187,53,186,98,190,58,98,174,64,66,16,106,1,171,60,12,6,51,3,190,95,165,87,44,18,57,102,44,113,32,108,225,12,41,180,30,110,49,75,69,98,87,168,206,77,253,60,29,194,136,121,85,105,101,110,133,219,222,172,25,
+26,122,171,81,66,254,227,211,113,195,149,197,240,44,145,1,81,66,37,32,236,114,30,222,30,24,230,105,89,20,234,227,151,77,188,45,225,72,220,32,240,71,59,186,42,158,153,73,154,58,0,225,123,49,60,66,16,84,128,74,65,35,34,177,14,190,239,33,133,34,18,119,16,
+207,109,189,160,138,164,130,196,144,12,111,225,133,187,104,162,79,161,69,6,252,136,205,116,66,33,246,61,200,116,56,23,132,74,60,51,157,48,124,118,199,247,61,163,120,200,244,221,12,69,5,186,253,145,208,90,184,237,136,84,36,118,133,202,160,154,152,51,142,
+227,236,88,19,90,75,195,233,31,136,197,152,110,125,124,41,171,13,47,106,132,68,174,72,79,156,92,114,189,177,181,80,157,253,140,30,183,96,144,217,211,80,16,220,4,103,226,6,67,73,84,129,54,72,28,96,140,136,197,248,158,159,76,137,175,157,160,14,120,18,155,
+109,63,195,161,203,73,85,25,42,62,107,142,185,221,57,153,83,83,253,107,182,227,110,35,115,105,103,120,167,47,228,249,7,92,197,252,206,233,10,219,207,96,185,2,187,25,213,221,3,130,123,65,215,212,147,147,241,166,99,37,252,125,124,159,202,174,43,236,25,
+92,109,218,42,227,77,161,49,184,108,74,117,84,36,118,133,202,108,13,243,38,104,57,59,214,4,162,5,147,157,33,102,104,90,17,120,26,62,195,179,43,90,246,97,34,234,35,191,167,243,227,133,30,193,50,2,251,139,233,2,189,181,144,105,203,74,139,99,137,156,233,
+105,204,149,136,43,8,184,157,192,22,102,97,23,25,177,86,78,135,20,4,39,195,153,184,225,240,186,170,5,14,48,16,124,239,29,8,54,212,250,139,32,22,94,123,42,219,40,133,214,0,171,147,177,176,151,2,158,206,171,170,34,240,59,159,73,229,233,197,185,148,101,
+195,53,80,77,204,229,183,126,83,95,192,213,195,92,206,167,248,6,87,130,249,172,154,152,52,158,43,178,249,234,130,183,151,248,7,238,193,178,231,16,227,245,112,136,87,33,34,121,28,82,158,126,71,204,207,54,163,225,174,129,32,61,53,99,221,12,23,125,189,172,
+116,152,79,23,86,233,196,82,86,186,64,219,8,188,167,63,152,140,107,213,235,187,251,106,139,179,86,198,73,187,123,249,108,102,84,199,155,66,125,32,102,113,86,1,171,74,236,10,215,162,194,218,192,173,90,12,246,80,110,161,188,149,26,161,225,55,90,11,34,92,
+24,72,224,176,54,246,42,196,0,0,32,0,73,68,65,84,137,138,106,238,88,246,204,138,59,167,239,35,209,192,77,84,50,89,150,48,151,229,95,184,84,84,40,9,141,51,198,156,85,70,197,136,74,161,11,149,197,176,144,120,99,49,67,183,245,6,104,36,228,189,166,253,109,
+118,165,64,167,147,57,122,51,158,85,58,144,69,176,30,36,172,225,171,86,109,63,198,129,120,91,196,71,143,71,124,218,115,240,196,57,245,149,228,123,24,135,103,65,136,130,111,59,68,62,187,115,62,195,47,194,30,75,242,38,230,143,196,249,5,88,240,210,92,138,
+14,111,227,241,201,68,39,158,170,164,6,188,221,185,132,247,73,69,7,64,110,177,65,21,59,195,124,239,249,184,118,45,245,66,49,246,227,219,54,135,106,158,95,112,192,197,96,177,235,122,3,218,0,114,41,186,104,31,32,254,226,11,150,41,131,126,143,22,47,233,
+76,167,242,90,76,255,110,210,186,223,55,183,56,37,69,66,173,5,137,88,206,181,91,85,98,87,184,22,175,2,43,73,183,106,49,83,201,188,41,223,245,74,188,167,40,118,109,4,233,211,55,192,98,182,192,90,61,2,225,89,54,55,62,38,194,62,87,87,97,89,197,135,169,60,
+29,100,252,183,84,85,40,9,141,19,96,78,220,88,245,46,226,185,17,207,97,119,129,105,231,205,84,17,225,0,243,221,79,246,106,243,22,84,86,23,143,50,119,201,140,7,187,216,133,98,21,162,174,138,14,50,188,215,39,226,89,150,10,109,36,10,206,40,72,110,82,233,
+103,199,245,57,14,201,63,159,82,231,9,250,206,98,134,77,40,126,67,209,186,158,93,229,125,55,147,138,146,207,67,140,239,57,18,90,176,159,80,25,255,160,138,184,153,195,43,62,211,253,35,97,218,190,148,93,239,36,21,218,6,77,12,78,18,81,139,187,171,184,11,
+174,164,72,168,181,32,17,107,100,176,103,53,84,37,118,133,107,113,202,156,9,39,240,234,124,154,85,40,70,133,114,43,29,26,100,85,53,0,170,71,56,57,33,139,33,43,220,7,13,161,50,168,206,68,133,18,23,199,21,180,219,10,205,33,193,130,224,4,154,21,137,117,
+48,164,241,177,137,152,230,197,173,138,104,151,253,91,96,17,116,54,58,107,162,17,210,10,133,247,87,230,211,44,222,135,47,93,84,43,118,161,90,221,172,87,241,123,243,105,165,73,12,36,28,56,246,236,119,47,165,149,137,154,176,173,227,228,92,82,77,53,62,151,
+183,170,78,159,194,169,230,205,138,196,229,224,251,100,130,189,32,8,245,64,34,22,9,83,14,84,38,118,133,107,225,246,151,118,51,136,225,184,222,3,240,220,116,178,165,119,83,132,98,3,224,144,181,192,84,145,131,131,133,100,235,121,153,78,73,187,138,85,188,
+58,207,147,52,193,38,245,138,84,129,11,130,80,7,216,77,152,241,35,132,88,124,104,52,236,152,219,236,103,22,164,116,230,24,247,201,19,10,147,124,16,36,255,96,178,91,224,229,153,21,75,14,157,168,86,55,42,22,31,183,200,23,246,153,153,164,161,33,160,58,248,
+94,149,254,165,136,175,185,14,173,72,134,184,221,107,119,87,176,203,116,117,19,236,95,84,38,215,4,65,104,15,94,99,218,27,84,39,118,133,171,41,114,86,14,148,56,230,226,78,121,142,194,1,42,37,76,90,61,239,77,118,126,131,60,123,62,201,242,16,252,222,194,
+1,22,118,68,69,91,160,155,23,39,171,193,225,251,47,12,21,64,47,205,172,136,127,172,13,224,158,222,47,213,253,2,39,67,37,255,76,179,192,58,10,2,138,19,200,42,170,244,120,110,134,167,74,1,162,158,106,49,238,181,120,86,19,123,141,128,239,123,205,162,174,
+45,84,146,64,44,110,166,144,0,231,179,231,167,147,150,21,12,96,159,197,16,80,35,98,49,14,45,248,94,213,252,145,233,121,146,110,61,162,207,15,119,179,92,231,129,97,231,36,215,4,103,192,173,77,45,91,52,176,86,168,14,186,86,140,238,213,58,86,37,118,117,
+16,11,162,107,162,252,203,109,137,177,41,230,206,27,156,37,173,26,32,109,87,204,20,14,80,105,94,133,21,115,85,234,33,30,197,6,209,15,4,104,99,245,24,52,1,199,225,192,237,222,196,111,95,206,104,62,104,92,184,105,113,194,70,182,127,32,72,91,66,93,87,13,
+5,68,102,240,98,186,96,217,164,127,120,195,162,13,211,168,143,36,130,2,43,7,104,8,213,73,21,86,89,167,71,127,176,44,191,87,129,143,253,12,34,177,14,4,148,227,167,227,236,191,29,238,129,46,89,69,9,52,236,13,176,58,48,43,188,191,108,145,192,9,177,247,66,
+166,64,95,24,14,95,51,176,178,18,240,188,127,97,102,197,242,65,128,184,175,63,156,92,214,14,159,120,198,170,173,167,16,216,207,36,114,45,233,40,131,88,252,131,201,56,29,236,15,210,238,190,64,93,27,5,124,86,136,183,86,205,126,192,191,3,127,123,51,239,
+17,236,80,84,222,91,8,237,141,60,135,141,162,226,57,197,51,200,181,159,59,97,192,160,224,44,80,40,196,25,111,186,253,60,109,23,176,87,7,58,59,12,13,162,181,42,177,139,243,243,189,131,33,26,11,251,42,90,238,225,179,183,114,143,182,26,110,95,221,147,114,
+246,251,88,39,124,116,123,172,105,171,42,171,134,111,55,130,236,252,38,208,31,130,71,198,163,218,164,224,70,129,152,137,74,98,217,212,214,55,246,251,214,248,188,81,221,176,56,97,131,67,117,71,245,192,253,202,164,127,100,164,48,28,71,181,96,252,212,204,
+10,125,185,184,214,244,32,3,43,171,189,236,142,62,137,186,156,120,97,149,78,165,242,150,13,249,187,144,42,208,46,166,192,93,134,116,182,15,219,253,30,154,8,121,201,95,150,20,157,76,23,44,23,225,198,194,60,131,184,0,231,1,181,156,169,84,129,110,236,227,
+187,222,105,133,247,24,149,192,129,174,78,195,7,4,8,205,86,190,227,168,50,130,192,137,181,114,103,196,75,91,66,94,10,123,175,196,94,56,216,205,166,10,116,50,153,107,249,190,130,118,65,61,17,1,193,110,180,108,0,178,93,134,237,194,66,2,150,79,159,141,249,
+175,17,102,113,47,23,50,69,58,157,204,209,155,241,172,229,29,63,56,36,25,245,34,71,140,253,179,73,181,135,172,233,84,158,77,40,54,99,5,82,139,155,25,134,64,150,131,74,59,43,159,93,61,38,26,9,93,89,247,113,223,231,178,69,41,46,104,3,142,46,102,13,137,
+137,149,192,89,199,42,170,237,63,16,119,144,40,198,160,79,183,15,230,198,58,49,147,45,210,125,195,221,87,221,163,106,88,153,216,197,58,118,219,230,80,93,221,1,226,30,98,163,239,68,124,244,203,243,137,150,91,0,168,68,247,213,229,72,8,226,236,39,150,170,
+235,224,190,126,239,163,69,109,78,0,138,233,234,61,115,136,187,80,124,97,167,179,115,199,39,254,225,15,210,239,205,0,22,158,91,250,3,53,5,99,188,60,104,133,147,23,232,106,112,239,56,130,5,28,14,254,241,196,34,239,135,179,25,183,70,124,116,223,150,112,
+211,194,186,85,213,235,215,135,188,116,71,127,176,238,102,131,247,0,67,138,220,30,76,117,119,118,208,93,189,129,186,85,93,24,64,4,63,104,43,218,177,254,118,87,31,75,226,198,78,25,81,161,121,244,103,19,129,114,181,64,31,65,205,209,133,140,38,54,89,33,
+36,253,221,167,24,21,88,34,122,250,236,178,146,224,255,59,159,232,101,25,118,5,1,9,194,168,106,224,251,220,76,101,49,98,153,23,46,72,71,148,160,158,199,183,70,155,58,188,194,246,227,135,138,69,98,42,37,207,30,217,30,99,185,150,170,132,249,55,199,163,
+154,205,14,23,103,19,57,250,169,5,131,117,112,38,184,169,47,80,83,96,130,176,244,246,124,90,10,13,28,14,215,94,169,106,47,47,7,231,155,70,133,79,156,113,126,61,151,18,75,61,34,186,35,230,167,157,72,68,134,186,174,250,93,183,34,177,107,102,176,167,27,
+186,192,191,251,201,94,195,93,242,58,175,207,165,108,147,12,183,27,208,112,246,244,4,40,230,239,36,79,233,160,157,45,174,210,66,182,168,13,242,181,99,50,66,132,98,102,80,237,121,67,196,167,85,103,232,196,243,69,122,47,158,109,235,108,148,89,56,2,218,
+118,95,196,177,192,152,177,233,176,242,254,232,21,136,3,1,15,69,187,214,171,110,144,105,191,152,45,90,90,33,107,103,112,143,14,143,69,155,10,146,173,216,128,155,21,141,42,1,33,233,191,157,90,114,189,71,149,83,193,179,249,165,209,72,67,7,34,42,5,252,152,
+204,171,186,26,132,91,40,86,245,62,161,165,127,239,38,243,54,25,207,78,37,44,171,218,70,236,130,33,127,181,246,97,188,215,24,130,7,127,99,121,183,5,171,168,103,227,65,37,171,137,63,95,206,88,122,64,125,116,36,66,99,17,115,93,14,16,60,255,203,169,37,182,
+207,84,14,151,8,167,163,58,249,139,228,228,215,199,162,77,85,106,227,51,253,243,116,66,4,57,135,98,246,92,67,22,21,37,64,236,188,187,73,191,111,196,69,79,79,45,91,234,183,43,84,135,163,40,237,137,147,237,125,174,193,94,123,120,91,212,240,247,99,40,175,
+20,67,58,143,33,111,39,245,121,61,148,46,174,94,179,94,181,133,80,140,67,45,126,64,189,109,27,45,177,11,249,162,136,81,14,195,104,155,33,185,64,36,198,33,254,27,59,122,76,87,122,182,251,38,231,20,140,136,196,58,168,84,120,74,241,16,76,51,239,34,137,255,
+186,163,49,243,108,170,182,146,113,138,80,12,190,53,30,51,213,154,110,197,123,94,13,28,168,202,147,221,24,74,9,191,113,121,167,133,86,131,103,179,223,239,161,152,215,163,21,97,92,206,22,91,86,189,4,97,243,91,59,122,76,137,177,63,59,19,87,38,36,57,73,
+40,54,34,18,235,160,243,2,67,22,69,44,118,38,102,170,60,97,57,241,125,5,179,6,202,49,34,18,235,136,88,108,15,184,206,208,248,125,194,74,160,157,193,189,50,50,127,75,68,98,103,161,87,250,87,74,118,99,79,61,157,200,105,221,162,142,21,138,27,105,217,70,
+166,254,253,5,107,43,12,4,115,124,109,36,172,249,235,54,138,91,252,158,185,90,8,173,8,170,132,218,32,115,247,232,120,243,230,246,229,88,225,237,108,84,44,22,145,216,185,112,60,155,42,133,15,110,161,88,229,179,42,194,135,32,180,63,118,78,172,57,201,122,
+162,89,139,145,141,192,158,235,201,233,132,146,207,38,168,199,72,39,155,21,54,51,28,22,51,86,89,72,9,213,49,187,190,148,227,22,107,133,70,245,24,232,10,191,155,89,145,174,121,135,0,143,245,253,131,161,134,58,70,145,24,241,244,255,205,99,127,239,180,31,
+18,42,248,67,91,35,180,53,236,173,153,241,64,224,134,191,179,55,230,167,229,108,145,46,73,133,113,93,224,193,52,230,239,162,235,187,189,20,236,236,160,112,103,7,45,21,173,59,172,190,151,200,209,220,74,158,198,66,93,228,247,84,127,136,33,16,127,20,207,
+209,127,61,187,76,23,44,28,98,208,10,144,221,187,115,51,207,192,7,220,83,220,223,203,82,85,220,50,254,253,72,132,98,126,115,67,112,48,220,229,200,82,150,242,10,95,205,55,23,179,218,179,55,208,224,65,19,27,202,179,231,18,244,254,138,181,3,206,4,62,14,
+13,195,122,192,220,179,185,53,232,165,183,151,212,136,31,183,245,6,76,251,167,149,243,223,47,168,243,219,196,187,121,108,57,71,219,3,94,10,251,26,31,118,171,205,49,184,144,20,145,88,16,28,0,226,227,83,137,156,102,181,213,232,80,107,20,177,192,170,231,
+79,138,7,178,109,15,116,53,188,127,55,194,95,151,178,116,38,195,47,6,224,76,183,187,201,65,200,27,65,76,181,146,41,210,76,155,159,7,218,149,227,169,66,67,103,63,42,197,154,111,93,74,211,83,22,84,47,254,187,45,145,166,246,239,74,96,93,40,230,87,233,156,
+84,21,183,140,131,195,221,108,67,243,123,124,157,218,249,168,221,129,30,243,234,124,154,122,240,115,174,117,104,154,26,228,32,124,165,48,252,46,85,160,23,103,87,232,55,151,210,150,105,10,40,192,216,23,245,211,221,3,33,186,127,168,155,238,222,28,162,187,
+6,130,218,215,174,160,151,182,5,60,180,148,43,82,82,226,231,138,124,121,115,136,238,24,12,53,156,216,198,121,139,47,130,176,136,135,135,215,39,7,54,3,84,243,67,99,17,234,181,160,10,207,137,64,28,190,181,55,80,213,107,13,155,50,14,175,86,77,114,45,159,
+22,94,222,102,8,48,129,251,124,166,224,170,204,213,126,147,126,177,27,249,76,95,128,142,91,48,144,68,184,22,84,39,112,100,181,177,200,163,163,2,83,235,85,130,54,162,161,249,52,221,59,24,162,225,144,183,226,230,130,108,50,166,87,75,231,134,179,193,179,
+105,214,111,19,160,130,22,7,127,21,123,237,76,42,223,84,199,73,45,210,22,4,182,16,123,209,170,141,251,177,111,32,88,51,131,143,182,238,215,46,167,45,243,36,22,4,129,7,196,197,168,24,196,123,126,75,111,160,106,23,1,4,98,180,231,90,53,252,19,179,81,140,
+182,244,87,66,213,30,191,143,41,198,189,109,32,72,239,42,22,223,5,117,232,103,63,20,40,224,220,179,41,224,161,112,233,236,167,15,124,178,210,2,137,43,94,167,210,51,46,250,67,107,128,15,54,151,72,12,204,216,242,57,145,95,205,227,156,169,246,172,217,8,
+208,131,62,61,16,172,42,114,226,93,197,215,141,125,1,25,38,89,1,136,196,55,26,72,200,58,74,40,198,128,152,102,69,226,114,224,49,148,41,174,73,32,81,2,153,153,135,134,195,117,197,1,188,148,120,184,112,239,255,56,159,182,84,16,18,241,137,104,75,136,247,
+53,133,224,39,180,134,61,38,214,175,141,224,0,168,90,40,6,240,180,182,98,210,185,208,90,56,159,77,248,94,169,56,20,97,42,48,151,80,124,66,81,213,115,37,112,47,240,165,15,249,244,151,85,69,199,11,171,50,224,83,16,218,0,253,61,215,7,195,140,7,215,99,183,
+185,108,81,155,155,98,181,79,41,132,55,36,114,57,132,13,36,178,84,128,53,177,209,161,169,245,128,64,143,123,47,107,169,179,65,204,105,7,175,211,235,194,60,177,6,149,10,214,228,217,108,13,195,38,59,56,43,129,161,111,98,181,96,13,208,170,190,56,24,106,
+74,255,195,223,253,86,216,39,254,224,37,96,55,97,68,36,38,39,9,197,168,122,229,152,34,126,96,184,155,62,60,149,119,125,150,1,193,217,23,134,195,77,249,39,66,48,198,196,208,129,128,167,101,67,118,220,72,189,54,172,102,241,50,182,110,11,205,49,194,40,210,
+75,224,41,112,50,224,231,11,7,134,152,147,91,58,8,204,33,88,152,173,242,65,151,204,122,149,132,181,32,96,149,160,85,16,218,27,236,201,248,178,67,119,0,188,35,205,76,177,7,107,107,68,207,205,168,73,22,79,48,23,46,236,8,121,105,86,42,55,5,6,56,227,117,
+48,226,239,162,217,188,20,170,89,205,96,144,191,56,106,52,32,66,177,85,52,82,208,88,9,104,86,152,31,32,98,49,105,158,196,70,113,140,80,124,71,63,79,107,18,30,28,100,38,220,44,116,34,59,211,172,72,92,14,50,53,95,46,174,209,47,46,166,84,125,68,65,33,156,
+45,56,66,115,24,125,231,170,129,170,37,17,138,157,13,218,44,111,136,248,104,162,84,189,146,93,93,165,233,84,193,242,110,10,174,22,75,42,237,179,170,128,96,97,100,34,115,57,191,60,47,67,143,4,65,104,127,180,118,254,37,115,22,20,47,92,72,106,85,158,42,
+240,51,23,46,196,26,244,137,230,0,123,247,190,30,191,38,68,233,222,254,201,124,145,18,249,85,173,251,69,132,36,161,156,65,84,182,74,115,158,32,52,12,156,4,204,88,226,225,44,242,165,209,8,253,232,76,220,181,5,162,176,196,50,211,181,227,8,161,152,211,39,
+8,140,135,125,212,221,233,94,239,18,8,229,102,5,43,148,176,31,79,230,197,79,209,129,172,137,101,143,32,180,28,248,109,221,210,31,168,56,0,9,246,10,232,222,112,242,52,97,116,1,169,216,31,32,88,252,248,116,220,176,88,252,252,116,82,14,240,130,32,184,6,
+180,241,31,46,217,85,53,203,123,243,105,203,60,97,157,2,4,226,7,134,195,21,207,165,125,158,46,66,135,47,246,112,116,174,88,109,215,39,8,194,213,204,165,243,172,26,18,56,175,96,168,167,112,53,232,152,229,112,18,128,72,106,197,76,31,187,178,211,164,133,
+142,117,169,87,19,112,122,39,82,41,195,240,41,151,250,180,66,116,55,227,243,92,206,125,195,221,92,31,75,168,65,145,89,217,205,139,185,187,32,180,12,28,50,191,61,17,211,132,224,122,83,242,225,45,137,182,225,195,67,206,91,107,207,42,12,164,117,177,184,
+153,129,116,56,180,63,125,118,89,68,15,65,16,92,7,196,226,215,231,82,13,23,10,232,235,101,43,44,122,236,12,6,99,125,99,71,79,67,194,147,110,215,247,248,86,115,214,31,66,123,144,149,179,87,75,56,190,194,95,176,32,197,6,234,185,139,113,144,255,238,190,
+128,214,77,239,70,204,90,1,58,66,40,230,244,78,212,25,84,96,110,238,4,246,25,52,179,174,4,178,52,215,203,96,52,229,92,100,222,144,22,50,226,145,217,42,22,153,239,125,186,40,182,19,78,2,34,49,42,97,155,29,46,132,74,176,111,142,171,61,108,114,63,155,170,
+59,118,32,22,255,211,201,37,77,252,64,229,117,53,32,38,163,245,250,123,31,45,74,112,47,8,130,107,65,101,235,255,113,124,65,91,15,43,37,217,32,34,99,45,197,154,106,213,122,57,199,236,29,57,169,240,51,67,36,190,127,36,220,180,125,27,68,101,36,135,5,103,
+49,159,229,125,150,78,75,7,110,75,192,58,198,89,111,85,43,222,20,248,24,103,28,38,233,230,2,81,179,86,128,142,176,158,232,99,246,245,36,221,164,222,133,101,232,156,47,30,216,21,86,211,94,44,92,129,115,210,63,120,117,94,188,165,91,197,165,108,129,205,
+167,24,21,63,110,55,232,119,26,143,140,71,13,123,235,246,5,186,180,202,98,85,211,192,167,83,121,182,103,115,42,97,221,158,0,241,67,111,237,197,65,62,90,86,165,45,45,191,130,32,8,87,163,106,15,49,194,135,169,60,29,100,188,158,170,78,22,36,121,239,219,
+18,54,252,253,90,119,144,194,253,91,224,103,42,85,160,27,251,120,46,43,241,122,107,153,74,230,216,206,209,71,23,101,88,166,106,208,253,206,61,235,196,141,30,225,219,25,138,98,29,81,81,172,114,48,142,155,128,223,11,247,189,84,81,237,45,92,13,178,161,92,
+25,76,4,43,82,85,215,58,142,198,249,218,222,39,147,210,66,239,36,30,28,8,214,181,154,168,7,42,139,135,20,13,235,57,194,56,41,254,100,139,158,77,216,74,232,194,177,136,196,130,32,8,246,6,157,39,92,137,197,19,241,172,178,78,150,67,163,205,87,18,111,68,
+229,254,45,240,243,110,50,71,73,166,97,209,71,23,36,30,105,37,63,157,78,178,84,21,163,19,67,98,75,245,4,61,252,235,228,136,11,43,138,57,146,83,142,80,249,176,80,155,153,216,87,137,156,11,189,130,250,188,238,180,219,104,7,126,62,149,160,199,119,246,152,
+254,73,220,62,237,127,87,176,139,70,3,87,150,189,229,194,170,165,158,165,168,190,191,99,165,192,50,88,225,21,241,14,116,20,55,245,243,248,109,97,136,206,19,231,150,217,127,116,4,20,179,12,207,38,246,235,215,24,69,103,65,16,4,161,125,121,225,226,10,61,
+30,49,31,223,170,138,137,32,238,246,5,120,142,203,170,246,111,65,13,175,206,165,232,224,168,241,74,114,42,21,232,188,98,161,184,136,206,170,61,61,129,171,186,177,49,235,6,54,134,232,80,117,107,177,208,11,23,146,154,117,140,81,32,52,255,108,82,222,93,
+193,93,56,67,40,206,241,11,197,151,100,98,165,224,32,224,199,137,105,253,102,54,57,76,175,118,99,128,160,79,168,30,12,117,85,172,8,185,191,228,57,245,187,153,21,75,238,207,75,23,87,232,240,88,212,84,117,255,187,151,210,52,203,84,233,32,168,7,129,187,
+217,106,36,157,65,147,131,9,106,241,220,108,146,30,29,143,153,122,54,95,152,145,214,90,65,16,4,161,49,16,203,32,166,49,51,225,30,190,202,170,98,162,253,140,67,149,54,5,165,96,199,73,160,170,120,103,60,107,106,8,252,75,51,43,202,103,54,128,123,122,3,244,
+233,129,96,149,248,173,67,179,94,192,23,132,235,151,103,87,92,55,216,87,251,121,13,158,163,33,18,67,104,158,109,98,128,178,32,216,1,179,5,64,142,16,138,79,39,115,44,21,120,229,168,28,120,32,8,42,48,179,201,65,36,118,227,244,106,120,194,161,221,175,30,
+154,127,220,182,168,182,160,170,174,246,64,229,230,31,46,166,232,238,225,110,67,223,143,246,202,223,186,208,95,221,201,92,23,229,243,24,135,224,12,225,89,69,144,143,131,54,14,53,70,43,104,94,158,89,17,207,122,65,16,4,161,41,16,211,68,124,157,134,4,57,
+196,68,42,219,193,55,49,206,201,49,58,163,64,104,29,79,205,172,208,195,68,134,158,77,196,68,239,90,96,197,245,248,214,104,195,58,9,132,100,156,35,183,47,101,93,231,153,173,159,163,63,55,220,221,240,187,8,187,9,84,18,91,41,18,195,91,246,186,176,79,91,
+19,163,93,30,173,11,30,5,142,24,254,105,197,243,212,106,84,12,106,159,118,233,217,196,172,134,234,8,161,248,88,50,71,183,15,134,216,174,135,214,88,55,30,102,241,51,31,98,190,230,114,161,253,205,249,225,237,124,91,111,64,243,183,217,56,236,9,194,34,94,
+194,55,21,122,163,149,131,77,238,220,201,37,250,202,88,68,19,55,235,129,204,49,236,38,220,88,73,252,205,241,104,211,237,130,250,116,234,239,159,142,43,251,92,0,173,249,153,226,26,29,24,238,110,170,122,243,47,11,25,250,197,69,25,70,232,52,34,204,29,49,
+81,133,62,135,8,66,23,206,196,155,170,122,199,58,131,228,135,88,78,8,130,32,8,70,128,32,119,79,166,88,163,42,242,106,172,218,119,194,204,182,125,168,252,20,159,83,103,129,103,243,96,110,181,225,170,119,232,12,47,88,148,56,55,114,214,161,146,103,246,97,
+155,13,183,180,2,156,163,241,133,66,162,177,176,183,234,236,16,8,196,127,190,108,237,188,139,59,98,126,218,55,16,172,216,69,63,22,89,247,216,61,80,92,211,60,175,97,103,98,133,238,208,10,80,80,133,245,157,115,174,214,156,75,135,73,66,159,106,116,79,173,
+132,167,255,111,30,251,123,213,31,210,44,201,213,53,26,246,118,82,63,147,71,20,94,176,143,92,90,81,188,221,223,69,49,134,41,136,58,239,45,102,233,92,155,190,124,221,157,29,244,111,135,186,233,222,225,48,109,14,118,85,220,76,194,190,78,218,26,246,210,
+222,158,0,5,214,136,206,88,96,105,130,247,225,205,197,44,205,173,228,41,236,233,160,80,87,39,117,118,116,104,149,134,104,143,201,35,243,152,46,210,111,103,146,244,47,115,41,186,236,194,86,25,4,0,91,195,198,170,56,253,158,78,218,29,246,210,59,75,106,15,
+31,51,185,34,157,74,228,40,226,233,168,187,182,33,33,241,194,236,10,253,171,226,207,36,168,225,238,77,33,214,74,162,115,43,121,165,107,205,82,113,141,142,44,101,201,183,74,52,16,232,170,249,217,81,205,245,47,23,146,244,65,74,186,116,4,65,16,4,227,96,
+95,211,227,162,136,215,83,113,239,129,128,240,193,82,150,126,61,187,98,201,190,115,103,127,208,81,251,183,160,6,232,6,136,119,80,87,140,115,87,37,225,101,49,83,164,55,46,165,233,233,153,21,186,100,129,61,28,134,36,111,143,26,183,197,64,124,231,45,174,
+185,242,121,60,150,204,211,235,11,25,122,117,62,173,221,3,188,151,248,58,22,207,210,127,191,144,212,254,204,170,251,2,189,225,171,91,34,180,167,63,80,87,208,195,90,180,165,219,75,159,234,246,209,165,116,65,139,215,219,145,205,93,157,154,246,194,1,246,
+140,223,94,76,81,222,125,227,201,180,159,25,250,20,180,42,35,56,162,162,152,74,67,10,198,195,62,211,217,5,44,226,110,110,219,198,52,122,61,43,101,22,188,120,71,218,212,227,8,109,31,95,26,141,52,236,141,141,231,18,85,239,163,33,47,61,51,147,180,36,203,
+135,42,225,227,211,73,229,255,142,211,192,192,186,70,236,38,106,129,236,188,21,85,31,104,245,71,165,194,208,124,154,118,132,188,52,26,234,210,218,140,168,52,112,19,173,70,31,36,115,44,147,75,221,8,186,1,110,8,251,180,247,210,87,58,232,181,226,190,38,
+243,69,234,243,56,102,187,213,192,26,134,189,18,95,123,195,62,26,220,144,96,68,118,254,195,84,190,109,43,26,4,65,16,4,235,209,227,34,162,21,45,22,47,159,128,143,150,100,167,199,67,231,45,18,159,112,239,246,196,252,215,116,67,162,218,245,66,42,79,71,227,
+57,177,138,106,18,60,155,90,87,223,197,148,22,95,150,15,137,63,155,41,88,26,15,97,254,202,205,12,254,217,183,109,14,185,190,194,189,149,63,63,68,226,175,143,69,175,233,88,174,7,254,62,58,255,158,158,90,110,203,51,226,27,139,25,186,177,47,192,114,45,20,
+136,186,249,172,130,231,123,32,224,49,100,159,227,152,147,171,89,239,68,42,9,155,191,153,113,183,176,134,22,173,106,109,13,205,210,174,47,30,22,109,163,195,198,32,194,63,68,97,122,114,58,161,228,179,9,245,249,188,65,239,223,141,160,85,195,170,224,1,235,
+219,44,218,39,165,117,159,5,28,144,14,108,238,174,234,203,132,247,20,45,132,168,212,198,112,65,213,65,86,142,249,242,203,22,119,9,104,158,104,146,147,18,4,65,16,44,100,125,111,110,173,8,178,144,41,178,206,201,81,109,5,135,51,204,67,195,225,170,69,65,
+56,255,65,48,192,215,29,22,197,64,237,136,22,183,183,112,168,52,215,144,69,116,163,162,50,217,141,115,108,236,0,222,213,102,69,98,29,232,20,40,106,251,209,153,120,219,233,49,28,67,78,169,148,24,123,69,172,126,232,215,115,41,122,168,179,179,233,98,81,
+117,70,135,10,192,97,21,198,240,57,3,101,246,248,158,118,205,186,52,11,60,107,205,210,206,149,217,95,29,137,152,170,92,199,75,120,176,159,111,74,178,208,56,200,176,55,226,221,220,8,120,6,48,52,76,112,22,240,248,122,100,123,172,161,131,29,254,14,254,238,
+29,38,38,90,55,194,145,37,222,32,197,109,211,170,5,65,16,4,161,21,112,238,223,105,197,73,94,36,201,191,181,163,167,97,49,0,49,16,10,99,84,199,64,2,63,219,25,207,39,19,140,3,151,133,198,65,183,158,217,46,111,36,126,238,101,74,26,216,13,232,76,39,76,20,
+80,233,115,154,164,243,113,189,75,20,69,140,16,223,155,193,81,66,49,149,42,98,33,248,162,18,172,81,166,18,121,250,193,169,37,17,137,75,224,62,188,60,99,220,188,30,217,153,159,76,45,51,127,42,123,128,96,137,163,114,96,119,95,64,203,234,11,214,114,3,179,
+176,123,157,4,79,142,2,239,239,221,6,42,202,241,61,42,15,74,16,118,215,152,226,148,4,119,121,178,32,8,130,32,8,21,225,220,191,49,28,75,21,176,66,48,210,13,137,191,143,24,104,59,227,252,26,65,61,156,131,190,184,7,54,10,141,177,127,48,196,114,167,96,209,
+48,196,60,52,219,46,192,134,200,136,88,44,5,162,149,129,248,254,196,169,37,237,158,214,42,188,133,118,250,236,84,194,57,214,19,229,224,151,254,196,185,101,186,62,228,165,91,123,3,52,20,234,186,102,193,212,61,152,222,134,25,185,60,36,215,0,193,61,83,92,
+163,3,195,221,77,109,54,168,36,134,72,220,174,217,153,91,122,121,252,112,112,79,239,234,13,184,218,15,187,21,76,24,28,96,87,141,62,9,156,29,3,14,57,70,68,98,29,124,239,98,126,85,153,103,31,54,101,179,222,217,224,119,38,146,124,130,32,8,130,32,52,199,
+251,151,211,166,253,96,113,40,87,105,103,246,192,80,216,148,120,8,145,25,69,85,82,125,231,62,58,164,174,201,114,112,102,225,176,1,213,193,60,150,217,54,181,88,128,88,124,71,170,64,119,110,14,53,180,198,225,188,5,171,5,89,203,42,83,107,14,0,40,63,7,59,
+82,40,214,193,15,162,255,48,168,222,220,22,88,255,113,196,156,191,49,96,229,49,61,89,160,187,6,130,117,13,174,33,188,191,191,144,105,107,195,123,100,227,140,250,4,85,98,2,213,173,34,20,59,26,191,167,61,51,180,237,8,60,137,205,114,223,112,55,253,245,212,
+146,146,187,243,244,236,10,125,39,98,110,32,235,217,68,78,185,191,161,32,8,60,28,30,234,166,177,176,151,2,158,206,171,14,226,16,140,48,224,242,165,185,148,188,207,130,224,0,224,223,138,246,124,51,214,102,28,182,127,213,224,232,134,148,2,23,65,176,142,
+137,144,57,203,137,141,96,104,55,181,177,70,131,2,199,35,137,28,237,137,248,104,103,216,119,77,145,40,156,6,230,179,5,109,8,94,43,189,195,157,70,189,57,0,142,22,138,203,65,214,64,4,226,230,209,179,10,221,115,41,237,229,219,236,247,208,128,255,202,99,
+49,157,202,107,211,237,181,97,70,109,78,31,115,235,13,167,232,44,8,66,117,208,93,194,97,25,131,236,62,60,195,84,173,119,79,158,137,211,99,19,49,242,24,176,165,129,229,196,79,167,101,162,156,224,110,80,20,160,31,20,54,122,251,161,227,9,49,75,171,15,10,
+247,244,6,180,73,242,213,170,180,112,184,233,243,116,209,225,109,81,90,200,20,232,217,243,73,154,181,120,64,101,57,16,153,42,29,188,236,114,63,5,193,14,124,255,116,156,190,61,17,51,36,22,63,63,157,84,154,20,186,62,202,99,157,5,219,60,17,138,5,65,61,126,
+102,123,74,159,11,236,46,161,245,65,48,126,205,102,131,223,119,5,187,104,52,112,245,25,244,88,34,215,210,184,142,11,195,39,107,253,166,160,213,59,187,186,74,211,169,2,157,207,20,164,58,162,9,112,152,192,253,139,249,59,201,211,209,65,197,181,53,138,103,
+87,105,46,157,183,124,250,168,254,242,185,153,241,32,127,222,4,85,202,114,192,178,142,120,190,72,67,140,249,47,76,187,22,236,207,174,48,95,102,126,103,196,171,76,40,70,208,240,227,211,113,122,100,60,74,193,174,198,171,213,145,41,135,221,146,32,184,25,
+36,113,106,217,101,33,57,139,47,248,245,253,101,33,67,47,206,167,45,111,61,68,21,113,51,22,51,125,129,46,45,121,132,117,193,234,67,5,18,108,232,162,168,214,254,90,126,63,165,149,83,16,214,197,226,199,183,70,27,78,76,235,195,148,84,158,141,145,60,227,
+72,148,83,41,137,133,86,100,177,108,180,63,240,205,230,178,140,168,229,85,42,168,97,132,185,162,152,107,13,16,26,7,241,222,206,168,175,98,241,207,237,131,33,42,174,174,209,201,229,156,214,81,234,84,154,122,170,134,186,58,233,129,225,48,13,134,186,174,
+89,156,182,149,134,72,181,195,77,81,13,30,44,88,61,92,187,192,119,104,226,1,94,118,120,97,65,28,120,110,166,181,149,38,130,57,80,165,44,66,177,117,156,89,201,179,248,192,234,32,105,35,216,159,242,46,8,179,108,98,188,86,37,176,158,255,211,201,37,122,112,
+32,168,9,48,181,170,139,81,69,12,79,98,73,192,10,86,114,207,6,175,126,59,20,1,124,121,115,72,123,95,26,5,127,23,7,49,43,103,42,52,43,18,235,96,13,176,90,44,110,118,240,39,98,214,255,24,242,106,162,87,171,69,36,60,159,221,158,14,234,241,123,164,72,69,
+176,28,36,109,81,44,117,96,48,68,189,254,107,207,195,32,93,88,165,169,100,222,146,179,240,182,0,111,204,130,150,120,17,138,237,15,236,139,204,88,161,148,131,107,9,214,130,110,29,78,113,119,81,10,155,44,227,214,136,143,238,219,18,174,155,168,65,108,135,
+152,240,187,81,31,253,126,102,69,27,140,234,52,26,126,66,113,168,109,196,200,95,191,41,127,27,243,211,11,23,146,142,188,41,170,128,208,222,76,219,49,22,144,111,236,232,145,251,104,17,113,5,7,52,177,67,177,22,188,39,247,49,102,217,223,94,114,119,149,189,
+83,232,99,180,121,177,202,50,6,93,35,248,194,129,243,230,152,159,98,101,214,55,72,80,224,217,147,36,161,96,21,120,14,63,63,220,93,245,224,217,202,34,128,131,253,193,166,68,98,29,188,203,95,31,139,90,34,22,227,224,96,38,73,137,184,16,157,6,72,34,169,166,
+89,145,88,7,149,199,95,26,141,208,143,206,196,45,175,44,134,56,188,187,215,127,205,243,169,23,169,160,186,110,46,37,197,21,130,53,32,49,113,124,114,189,203,103,99,219,177,211,103,185,112,183,196,11,106,56,186,152,213,170,22,57,128,95,190,224,108,178,
+82,21,110,9,70,10,2,16,223,221,63,18,38,154,118,158,158,215,144,80,108,228,166,64,168,193,77,217,190,148,149,234,226,82,32,1,63,186,102,209,239,163,19,31,46,167,113,33,195,91,145,34,173,60,173,1,45,178,28,85,197,168,232,151,3,167,51,48,51,32,174,213,
+104,7,78,169,134,19,90,200,55,199,163,154,5,66,45,90,85,4,0,123,132,189,155,234,23,41,84,3,98,241,23,7,67,165,9,207,234,184,123,200,252,48,77,116,148,65,16,85,41,52,193,14,11,147,195,141,2,177,248,161,225,48,61,57,173,110,48,215,70,26,121,62,17,43,75,
+113,133,208,10,100,15,23,90,1,246,137,79,15,4,77,199,191,232,92,147,231,215,122,38,211,5,218,203,248,175,78,75,97,154,114,204,22,4,56,81,207,171,107,146,104,180,149,78,7,223,187,177,141,209,141,28,218,26,49,245,83,227,225,218,165,192,67,87,184,2,90,173,
+56,197,221,73,23,12,0,180,35,72,76,21,77,86,59,161,58,9,149,73,130,51,128,168,207,69,82,172,98,4,23,241,157,79,244,214,21,225,202,209,147,215,183,150,42,57,85,115,71,191,113,145,88,7,182,9,240,221,84,5,98,51,174,100,21,170,102,85,114,23,131,176,128,33,
+130,215,51,251,43,86,195,232,243,121,152,65,184,23,4,55,162,162,187,82,80,3,172,128,204,128,179,206,207,167,172,75,250,9,87,64,199,49,231,121,227,79,203,210,1,171,18,184,2,192,110,194,44,159,51,208,205,213,74,106,70,95,102,149,115,29,180,70,180,203,244,
+63,35,96,240,129,145,41,247,27,121,96,36,76,199,45,104,75,116,51,168,70,53,210,226,90,137,163,113,247,9,197,168,86,26,241,119,209,96,217,161,28,65,231,169,84,222,82,175,102,120,61,62,190,179,199,240,247,163,34,73,170,137,27,3,251,196,246,110,239,199,
+214,9,250,112,83,43,219,47,151,11,124,67,12,101,128,161,224,22,48,193,223,168,104,104,69,101,4,196,93,46,15,191,125,125,1,58,163,168,170,248,51,76,49,3,224,242,156,172,4,246,103,136,230,28,236,142,249,148,91,107,153,121,62,113,118,185,117,37,47,149,197,
+66,219,131,247,240,129,226,26,91,178,234,148,69,149,137,16,94,246,15,4,105,75,168,139,252,158,43,117,107,217,226,42,93,72,21,232,213,249,180,196,225,117,64,37,240,243,211,201,245,253,216,0,86,158,117,48,116,241,179,49,191,54,196,31,118,113,250,243,138,
+2,173,217,84,85,73,206,69,0,0,32,0,73,68,65,84,129,78,38,115,116,36,145,115,213,192,212,247,23,50,44,246,33,83,9,107,207,216,110,4,51,218,56,108,45,161,7,34,145,237,20,183,133,154,17,56,71,43,157,14,110,176,27,167,182,15,149,134,211,113,128,182,68,136,
+50,18,248,170,3,83,210,113,144,50,27,112,161,194,209,77,254,196,168,46,186,181,55,160,85,26,85,226,238,146,209,254,27,243,105,122,215,130,74,107,4,62,8,158,144,185,107,54,73,243,188,216,188,52,68,245,161,156,235,190,145,8,126,172,26,200,121,62,85,96,
+19,64,78,74,39,128,192,12,4,186,27,194,62,237,128,68,37,79,109,36,36,114,171,107,116,62,149,167,55,227,89,203,15,71,152,59,97,86,148,68,140,168,114,173,188,46,204,87,181,188,69,97,5,236,102,230,110,47,84,40,171,104,5,222,193,120,15,198,181,223,141,186,
+131,14,58,17,205,62,159,216,255,91,177,151,239,13,251,104,103,196,171,61,115,176,234,160,82,167,10,222,121,55,138,33,130,122,208,193,200,17,3,33,78,183,66,112,66,1,85,181,179,177,207,227,161,93,62,143,150,236,65,12,233,70,237,160,25,180,53,174,201,243,
+14,196,217,39,207,88,55,60,21,235,121,53,155,12,252,55,156,29,241,5,91,164,63,206,167,29,239,243,221,40,248,57,175,139,249,77,205,70,193,239,242,133,139,98,241,170,154,193,16,95,156,167,173,213,14,17,138,61,253,127,243,216,223,87,250,3,4,170,55,49,90,
+70,132,125,157,90,118,208,109,28,220,28,162,1,198,137,180,125,190,78,122,71,6,108,41,35,143,216,189,184,70,219,77,180,213,98,209,126,250,124,130,146,46,57,8,96,26,253,191,25,234,166,88,157,214,94,36,58,62,17,245,209,118,127,23,157,92,201,175,223,107,
+133,92,200,21,233,163,120,78,171,112,198,250,83,15,248,116,253,244,204,50,157,96,246,170,110,55,144,252,250,230,142,30,109,211,172,151,93,197,125,223,219,23,32,111,113,141,206,40,188,175,231,178,69,186,173,55,96,186,115,3,239,238,175,102,87,148,63,155,
+130,59,64,5,205,191,29,234,166,123,135,195,180,53,236,213,222,7,124,225,57,197,255,98,205,196,127,223,219,19,160,88,71,7,125,100,161,79,224,161,209,8,117,154,44,143,192,207,129,190,141,227,41,53,159,251,246,190,96,221,125,165,81,112,24,85,21,131,254,
+143,253,65,150,174,49,157,120,182,168,100,189,220,29,246,209,150,110,30,177,24,63,47,58,176,84,197,57,135,183,70,76,223,83,60,223,42,159,207,141,32,97,254,200,88,148,110,232,245,83,127,224,106,59,18,252,223,120,150,17,91,226,125,15,172,145,210,61,81,
+112,23,107,171,68,215,51,8,197,111,92,74,107,241,148,42,16,63,254,111,59,123,40,218,224,186,142,125,242,206,190,128,22,203,187,229,76,101,4,156,119,254,245,114,70,187,191,189,62,79,213,189,29,49,46,134,210,254,104,106,217,146,251,137,24,232,171,91,34,
+90,167,110,35,235,57,254,14,98,162,97,111,39,29,75,186,163,216,106,106,37,79,187,99,126,195,251,221,11,23,86,232,35,217,75,148,130,34,77,232,23,92,224,245,156,91,201,211,101,7,116,76,84,21,138,191,48,24,162,30,102,79,55,43,3,54,187,240,249,161,110,242,
+50,30,32,124,157,29,218,102,32,168,3,65,82,49,191,106,72,44,214,68,226,169,101,58,159,115,71,11,200,195,195,221,116,93,147,9,37,28,150,62,213,237,163,99,203,57,229,130,28,2,33,248,54,157,88,202,210,128,183,147,252,158,14,205,147,171,88,250,66,69,223,
+133,149,60,189,56,187,66,191,185,148,150,64,180,14,72,32,126,109,34,214,116,64,131,192,15,1,172,210,192,207,100,130,7,188,117,41,45,67,61,4,22,96,155,240,31,182,69,105,184,129,42,78,188,79,16,240,110,10,91,179,46,34,232,229,170,192,143,249,60,244,250,
+130,154,152,100,95,79,160,161,36,95,163,204,167,10,116,73,65,181,220,157,204,66,241,185,149,188,18,17,241,198,136,143,181,250,121,50,153,87,114,63,57,11,85,84,62,159,229,220,17,243,211,23,70,195,13,117,163,185,81,12,17,212,130,247,176,191,179,195,212,
+251,141,234,221,95,94,76,41,251,156,136,1,31,51,16,63,66,244,220,211,227,23,177,184,1,176,158,64,35,192,153,39,155,95,213,246,18,253,235,249,217,21,122,97,62,109,233,154,3,145,184,90,167,105,45,144,104,115,203,250,152,44,157,67,183,6,189,90,65,85,163,
+104,149,196,23,86,44,233,210,117,59,72,86,113,22,125,146,194,130,0,110,170,254,212,220,173,116,96,48,136,197,194,93,85,197,30,14,67,147,242,235,49,30,70,132,234,188,22,95,175,218,70,27,76,163,54,20,104,45,196,96,129,51,10,179,241,118,226,96,127,208,176,
+216,128,54,155,175,142,68,44,107,41,67,123,213,79,167,101,56,157,89,204,12,229,84,237,25,137,119,118,52,212,101,248,153,132,199,151,91,218,221,4,181,192,106,226,240,88,180,105,11,35,172,139,95,31,139,210,79,166,150,149,182,166,95,199,88,25,209,204,193,
+166,213,164,139,106,18,184,240,212,68,187,52,23,231,93,94,29,196,233,249,108,197,243,9,145,248,110,3,3,106,176,87,61,76,68,79,41,242,206,22,220,5,172,243,70,66,94,67,109,236,176,156,248,231,105,181,67,205,30,25,55,62,175,7,223,135,239,255,39,153,211,
+211,16,56,243,204,182,56,158,197,25,209,136,72,172,131,245,113,111,34,239,10,33,20,186,1,226,190,187,122,3,180,187,47,80,55,118,68,55,207,43,240,240,22,95,98,75,208,103,240,112,2,43,58,39,156,57,171,170,193,220,2,39,232,246,186,79,228,228,26,46,32,88,
+15,132,39,12,117,192,148,112,248,241,85,251,93,66,32,62,190,148,165,223,94,118,79,18,4,66,200,222,77,230,166,209,195,159,12,7,44,93,148,23,236,13,199,80,78,213,158,166,56,112,63,172,251,63,53,1,42,105,158,153,145,68,130,192,195,67,35,17,195,123,63,14,
+249,15,13,135,233,73,133,135,118,127,167,51,196,93,206,33,149,84,58,140,169,96,33,91,100,29,66,167,170,171,33,91,228,77,62,156,85,36,104,59,229,249,164,82,231,128,17,145,88,199,77,98,136,160,22,36,23,33,54,97,255,104,70,160,131,72,172,58,57,9,143,90,
+179,73,27,124,63,174,35,9,125,251,3,203,137,221,12,9,191,3,195,221,244,238,71,238,88,27,241,254,65,71,120,101,49,67,123,34,62,218,9,221,97,195,153,235,116,50,71,199,146,185,150,8,196,232,244,185,57,230,191,70,52,61,178,148,145,185,62,109,12,127,217,112,
+13,202,167,154,10,66,37,208,154,116,239,96,72,171,104,15,120,58,63,246,64,45,174,174,81,170,176,62,9,215,202,73,145,88,140,215,171,61,86,52,255,185,241,178,74,251,236,234,26,157,78,229,93,83,65,92,14,196,115,14,246,13,4,69,40,118,8,28,67,57,33,158,169,
+14,244,241,190,222,147,41,86,29,156,81,14,90,183,142,46,100,92,149,228,17,212,114,135,201,193,36,0,135,124,236,55,170,6,162,246,153,252,124,86,49,159,41,210,39,99,60,255,24,196,16,85,188,181,144,209,6,120,114,0,175,124,85,204,49,198,42,72,144,203,64,
+54,162,3,155,205,15,253,222,63,24,18,161,88,96,1,239,36,146,140,216,135,16,95,235,195,20,43,97,101,252,115,75,63,79,151,0,174,35,66,177,253,249,44,195,80,120,42,157,25,220,86,80,132,119,24,63,175,93,126,230,90,131,8,193,253,221,97,186,111,109,189,202,
+217,74,125,198,74,178,171,252,194,252,92,218,25,182,42,150,10,197,201,188,251,4,53,108,196,82,85,220,24,181,166,224,162,146,17,21,59,152,132,251,183,49,63,189,127,57,77,191,178,120,56,34,14,237,170,14,238,78,131,203,223,18,65,44,42,114,220,40,182,59,
+137,7,153,18,3,96,119,175,95,121,160,143,235,191,25,207,106,193,42,218,123,54,174,43,16,141,62,136,103,181,191,35,98,135,179,65,149,3,90,213,251,252,158,143,147,209,11,153,34,197,243,69,109,120,153,85,83,189,117,110,97,242,86,221,29,243,41,219,111,16,
+139,245,121,44,13,255,12,129,202,153,219,7,67,44,215,58,173,176,226,5,21,192,92,177,222,239,20,218,16,64,140,60,192,244,57,39,165,130,72,235,172,226,72,160,34,14,106,133,24,130,125,125,34,234,187,170,136,167,184,182,70,23,211,5,45,249,33,126,253,206,
+69,23,154,246,134,125,52,232,247,104,150,20,58,243,217,2,93,204,22,233,72,34,103,89,252,195,101,1,227,36,171,35,55,131,184,155,11,84,214,74,65,81,107,248,230,120,148,250,26,240,230,69,81,31,236,5,191,27,245,209,179,231,18,109,183,119,76,167,10,108,197,
+0,58,51,14,209,61,170,254,246,185,61,215,64,194,133,94,42,220,7,178,28,115,235,160,29,104,118,192,1,22,164,155,75,1,238,247,79,199,219,238,126,216,157,235,27,24,206,212,12,215,133,125,116,38,43,21,157,118,102,221,95,158,135,144,69,129,62,14,64,16,140,
+165,250,164,61,193,64,54,88,153,84,18,189,32,222,192,178,0,129,43,108,69,158,155,73,90,34,24,67,56,50,91,77,172,51,174,29,180,212,136,134,10,139,86,89,65,71,15,170,84,204,38,38,17,55,97,168,169,74,48,159,224,240,182,168,169,127,97,33,83,80,126,192,66,
+5,161,89,219,40,240,134,194,117,21,73,30,78,203,17,85,220,192,40,134,192,95,159,44,18,67,32,16,223,212,31,164,202,14,131,29,218,129,24,95,168,110,255,249,84,194,242,100,155,192,135,86,169,14,87,173,22,118,77,221,195,148,60,45,191,158,196,117,246,134,
+35,129,166,227,148,14,168,118,227,219,19,177,166,45,181,160,227,32,14,122,126,58,217,86,118,20,88,111,184,138,22,0,134,234,59,229,254,84,61,177,163,197,159,155,15,150,221,87,129,240,97,156,247,103,158,105,179,138,86,163,83,112,1,22,48,44,100,130,181,
+244,214,104,101,51,130,95,42,238,109,15,103,160,38,3,57,5,179,28,30,234,166,251,71,194,13,85,70,226,192,242,141,29,61,154,176,172,154,62,198,129,23,248,217,134,152,215,90,29,120,202,113,145,86,44,34,97,96,139,217,4,57,196,81,213,158,126,16,120,49,171,
+192,40,176,215,122,246,188,122,159,116,248,31,38,77,222,139,119,47,169,29,162,243,30,163,96,170,210,202,35,202,248,126,70,187,172,17,67,16,51,163,208,162,145,49,52,136,177,31,223,105,205,218,41,8,130,80,137,90,246,41,130,26,80,73,108,102,238,194,231,
+134,187,53,125,167,157,88,96,156,201,48,167,64,99,85,69,213,223,226,171,204,109,253,78,82,207,57,65,22,98,141,177,8,248,197,185,148,13,126,42,62,190,50,22,49,37,28,97,33,227,108,139,23,234,19,99,94,252,7,252,246,175,28,18,4,193,30,64,36,70,165,112,51,
+64,20,129,176,172,90,240,224,78,162,113,10,207,229,32,22,227,138,75,166,146,106,147,215,16,36,95,50,97,199,128,138,100,171,60,200,225,207,103,68,44,134,72,252,227,211,113,75,42,55,209,105,129,234,103,163,226,187,21,247,83,183,242,224,224,232,162,186,
+42,93,167,197,46,70,42,196,128,21,107,167,32,8,130,208,122,80,177,223,136,221,68,45,160,235,60,48,28,110,171,223,38,103,34,255,57,7,13,79,175,122,170,65,192,138,150,77,46,78,184,216,95,230,141,139,60,226,46,126,31,237,212,2,134,197,136,99,82,56,170,35,
+218,45,115,101,103,226,204,207,32,252,210,4,123,83,228,204,118,9,130,65,176,103,52,43,18,151,211,142,85,14,70,121,159,65,236,131,192,105,197,240,18,180,79,255,246,124,178,105,241,16,113,231,83,10,61,127,43,129,251,129,182,203,70,63,43,226,186,127,60,
+177,104,105,108,135,153,0,79,79,45,55,93,89,108,229,253,252,35,67,177,10,126,7,210,162,190,206,215,70,194,166,43,196,4,65,16,172,70,229,32,90,225,90,184,6,79,106,22,112,109,20,111,35,70,51,211,53,166,243,94,11,102,167,152,161,230,111,16,138,55,135,62,
+128,96,173,93,39,33,54,2,2,85,179,37,235,184,135,79,156,91,182,234,35,91,2,215,98,4,246,75,85,177,101,44,50,183,156,102,219,208,119,187,221,136,103,249,126,231,237,232,179,46,88,195,109,155,205,121,132,169,174,114,224,94,27,23,20,14,0,198,48,88,179,182,
+17,191,183,80,132,133,88,252,228,100,156,166,18,245,43,152,33,128,66,88,182,90,36,214,65,197,246,247,62,90,164,215,231,82,154,245,65,249,154,135,152,26,247,253,108,34,71,79,156,92,106,89,92,7,177,248,71,103,226,244,151,133,250,66,106,43,238,39,71,220,
+140,202,105,149,76,59,196,10,14,135,117,179,131,120,52,239,201,33,17,139,133,230,225,78,214,72,242,199,254,112,22,26,186,113,190,85,171,192,94,193,57,48,178,221,180,25,163,93,99,58,248,222,95,49,59,54,168,166,102,109,57,20,239,23,46,36,181,182,35,163,
+32,40,126,242,140,12,28,251,225,228,178,225,182,47,28,50,218,241,30,114,46,70,219,17,4,187,56,25,97,37,152,196,255,0,211,228,116,240,65,82,166,167,219,29,120,154,222,223,205,35,176,37,21,138,95,66,251,242,96,131,190,154,245,224,28,178,178,145,179,140,
+30,102,216,247,85,251,234,254,108,114,217,240,140,0,4,188,86,219,137,225,126,60,57,157,208,188,155,49,72,108,52,228,37,95,217,103,71,119,202,84,170,176,62,192,201,6,216,125,152,38,108,40,126,113,49,69,47,206,167,105,79,196,167,13,84,43,247,202,133,16,
+58,151,45,182,236,126,154,137,155,81,213,173,122,48,224,28,227,212,114,149,162,243,189,76,67,120,180,161,146,18,103,11,6,64,114,140,227,204,167,218,19,95,224,225,116,50,199,22,107,157,148,51,162,101,236,51,209,177,87,137,177,48,239,240,123,59,240,255,
+179,247,174,177,113,93,87,158,239,34,235,93,172,7,95,18,73,81,166,40,89,177,252,146,45,91,177,29,63,174,53,237,119,236,56,157,180,211,74,79,198,29,143,131,246,220,15,201,135,12,208,64,3,65,95,32,131,25,4,8,110,3,55,31,28,224,162,51,147,140,211,153,92,
+199,215,65,220,113,94,78,187,141,107,117,252,182,19,63,162,216,146,101,137,122,80,20,37,138,100,145,197,122,23,121,241,63,228,145,75,100,61,206,57,123,159,125,94,235,7,20,58,109,169,74,197,195,115,246,94,251,191,214,250,47,136,197,251,137,76,119,55,162,
+146,216,107,34,49,117,18,138,105,173,50,130,38,173,137,197,42,125,215,188,192,119,142,230,180,246,47,51,153,125,100,229,252,86,73,76,54,76,193,149,37,90,50,198,152,200,87,132,39,209,211,90,165,210,49,137,135,45,63,162,139,34,24,156,3,79,196,202,242,10,
+157,43,213,148,30,224,177,15,220,187,66,82,132,186,231,125,230,179,206,168,97,71,70,158,71,166,93,83,211,33,188,97,207,150,113,64,154,80,240,108,35,54,67,140,134,89,1,102,196,56,84,202,58,41,128,66,48,62,131,127,159,43,203,164,128,251,246,37,216,195,
+185,208,34,14,113,243,99,151,100,12,63,83,56,119,160,210,93,69,18,227,131,66,149,238,146,148,52,183,51,97,190,57,33,71,176,193,254,15,175,226,32,206,155,97,196,248,195,249,18,221,34,33,97,129,207,81,65,79,119,23,125,42,27,163,29,169,168,54,204,89,127,
+198,113,102,153,45,213,53,241,242,165,0,91,106,118,226,213,92,153,62,57,152,16,94,27,113,189,249,58,171,99,40,33,87,216,13,201,56,52,186,16,136,197,187,114,101,250,244,72,79,199,216,25,103,2,56,52,120,85,11,53,20,61,32,40,56,121,100,222,212,97,2,45,99,
+48,126,102,145,248,98,126,56,153,215,74,251,209,254,58,148,12,183,20,94,208,174,248,235,169,37,219,43,34,24,198,10,152,68,47,67,40,126,221,131,217,53,85,108,143,133,232,174,205,61,77,15,200,99,233,213,205,28,135,84,76,244,199,36,123,28,246,237,4,158,
+166,215,10,182,17,97,95,224,53,205,59,220,154,141,209,230,88,232,162,161,77,168,218,60,91,174,43,15,222,99,33,121,29,40,56,252,217,37,116,190,116,190,72,15,245,164,133,63,231,69,69,107,35,98,52,136,113,16,207,97,7,213,170,234,11,221,97,152,212,236,229,
+128,151,241,38,40,150,216,149,8,183,61,148,65,32,62,178,80,81,106,115,135,61,23,251,239,222,77,98,251,34,14,146,118,38,204,101,118,239,141,196,66,68,246,58,122,92,4,246,32,84,186,111,73,70,40,181,54,44,148,197,58,239,129,253,86,84,56,68,53,177,138,4,
+37,246,194,86,223,21,247,32,94,136,193,111,28,76,208,115,83,75,90,151,37,115,49,88,27,225,51,47,154,28,56,192,133,37,140,75,193,89,246,208,209,213,110,127,172,25,56,87,52,130,170,122,63,216,228,24,78,51,235,135,9,4,107,119,13,37,41,27,13,109,104,87,68,
+171,228,84,161,74,175,205,150,88,12,104,3,174,165,94,37,140,235,185,181,97,186,228,41,22,82,24,15,128,138,46,84,149,137,4,1,240,154,228,32,191,57,56,28,221,97,96,120,12,2,89,28,82,119,164,163,244,203,169,188,173,135,77,180,204,160,170,211,234,64,28,28,
+228,101,78,141,101,236,163,221,65,73,79,92,220,182,57,169,29,4,84,5,66,94,233,26,193,161,241,134,197,234,133,100,142,21,224,27,107,183,237,196,122,116,155,4,36,178,175,74,71,105,52,25,166,88,119,55,77,23,171,52,85,174,115,21,33,227,40,141,135,50,84,181,
+102,26,196,207,131,139,21,199,146,23,72,210,98,255,237,139,91,219,23,113,110,122,246,140,119,246,197,213,138,51,251,147,88,87,38,35,116,239,72,207,5,113,184,145,245,98,29,196,36,183,216,205,48,173,129,133,162,85,171,35,196,143,176,74,178,155,47,142,244,
+24,46,130,193,61,248,208,88,154,198,207,21,233,87,18,134,195,250,13,196,19,131,241,144,229,162,34,12,79,229,231,154,241,2,110,183,25,19,193,116,63,146,22,172,41,88,172,131,130,118,61,89,24,102,60,136,72,16,128,41,182,79,79,177,104,216,140,251,7,18,166,
+43,148,112,72,221,63,150,209,38,217,219,41,22,35,89,104,197,51,82,19,137,79,46,114,37,162,203,65,187,229,151,70,211,134,218,188,33,220,34,81,132,44,250,143,39,23,109,175,104,247,18,88,219,30,141,100,44,137,71,168,46,132,111,172,83,224,25,93,181,117,8,
+236,175,143,113,57,110,74,90,96,221,67,146,22,251,175,149,100,214,243,83,75,202,147,66,110,199,104,162,156,214,196,186,251,183,166,104,103,174,236,216,240,74,198,24,186,213,145,89,177,88,149,141,165,25,145,184,17,196,235,185,26,91,36,52,3,207,228,23,
+117,127,115,19,28,230,231,217,17,114,213,58,13,155,151,6,91,82,95,225,115,129,106,208,141,188,37,30,166,236,90,50,29,107,211,233,146,245,174,37,251,166,186,184,148,189,169,40,141,37,195,23,181,210,46,212,234,116,170,80,163,183,23,43,124,216,85,196,41,
+137,67,127,104,173,45,54,104,172,175,70,119,162,170,6,27,249,253,149,101,83,194,38,42,137,33,164,240,179,182,17,172,79,86,219,88,113,72,125,96,36,69,143,79,216,59,248,210,172,103,36,218,5,81,9,194,34,177,187,129,72,252,232,152,121,113,19,247,1,222,247,
+131,19,11,182,62,211,21,137,3,52,237,6,215,1,215,195,236,245,212,215,70,134,97,188,3,14,96,72,210,98,255,53,250,188,107,149,196,147,121,37,109,235,43,146,230,11,208,90,59,173,157,152,17,137,27,129,16,245,249,250,138,163,73,54,166,51,186,88,12,251,69,
+35,49,164,170,57,61,184,239,68,236,244,112,207,138,136,49,126,6,231,196,59,75,117,67,214,35,176,149,113,162,67,0,157,84,183,15,38,104,11,58,169,26,108,206,48,124,251,100,190,234,201,33,100,86,120,39,87,54,61,164,173,29,103,185,16,82,9,56,191,237,235,
+139,107,191,187,102,93,56,180,246,108,97,8,181,89,171,202,174,79,252,151,223,5,66,173,65,149,222,238,254,120,199,69,10,89,172,95,76,23,88,196,82,192,223,239,234,151,22,188,194,211,249,59,71,237,21,200,220,128,110,253,210,23,107,238,111,237,132,79,31,
+173,13,92,219,55,152,104,27,104,33,224,131,127,39,251,121,181,230,63,95,218,219,114,145,55,202,91,138,218,224,58,221,139,120,38,223,155,43,251,182,29,199,111,124,126,115,146,174,238,183,62,100,20,118,9,118,30,210,173,84,178,183,66,229,48,54,35,177,7,
+2,56,248,181,115,69,18,195,120,155,78,207,59,4,98,12,170,84,121,206,144,185,118,62,117,124,193,182,46,72,196,145,143,93,218,43,244,25,63,61,177,200,49,166,71,208,197,185,177,84,228,162,161,87,168,66,60,145,175,210,129,153,162,178,2,3,25,177,183,95,135,
+207,203,2,98,214,158,116,148,118,174,13,8,116,131,231,56,238,65,35,243,183,144,108,195,156,150,32,8,198,223,184,172,207,146,61,76,51,236,220,47,152,85,80,96,118,215,72,143,225,66,26,60,111,102,188,213,125,47,20,91,169,146,82,153,233,15,50,102,170,18,
+59,225,244,20,118,21,124,121,52,69,219,210,198,38,255,99,83,123,238,116,94,121,139,38,158,183,203,147,17,26,138,125,252,188,161,237,225,163,66,149,219,43,59,96,181,146,102,61,216,4,254,175,143,230,213,125,241,181,96,235,170,181,123,147,125,214,189,135,
+140,3,58,248,222,71,243,182,61,231,159,29,76,8,15,83,212,249,175,31,204,74,249,28,51,52,235,102,154,44,84,105,186,92,103,31,62,134,241,25,240,216,29,79,92,28,223,226,89,255,160,80,85,94,136,34,107,237,196,217,232,219,31,218,231,73,99,181,245,191,17,22,
+235,24,179,200,138,189,201,230,24,136,145,11,188,238,239,27,77,153,250,204,32,20,165,201,218,47,130,82,192,231,36,34,107,215,11,83,75,134,18,51,190,182,158,128,104,245,181,75,123,77,183,171,226,239,195,160,62,113,42,207,7,56,27,193,244,244,199,118,138,
+139,19,8,94,253,46,18,155,173,8,65,114,30,27,224,246,249,178,242,41,224,218,51,195,221,211,166,217,153,50,150,4,232,4,178,244,56,164,170,76,116,93,240,53,101,60,201,62,73,2,44,62,199,46,95,57,84,114,92,51,144,16,238,66,129,144,224,4,88,23,57,158,96,152,
+96,128,253,215,45,197,38,178,214,206,55,109,172,166,195,121,77,84,36,166,53,43,36,120,52,178,5,0,99,148,173,73,121,82,200,85,169,40,199,194,30,192,138,72,12,112,14,199,121,220,207,2,40,246,139,203,122,99,148,8,139,85,216,63,121,98,81,218,119,98,54,130,
+115,190,72,130,203,168,93,142,216,93,224,114,30,181,56,92,66,7,165,220,195,130,173,40,76,107,32,46,189,35,33,240,124,230,148,191,23,163,175,142,103,44,183,13,194,175,230,6,131,85,200,140,179,244,91,156,154,222,140,245,149,76,12,211,142,45,201,136,148,
+235,35,235,115,90,241,174,160,165,10,58,45,158,101,15,96,134,97,2,198,43,130,182,64,152,53,96,103,65,198,30,137,113,234,21,146,146,238,76,48,200,132,229,197,222,49,73,45,251,140,125,160,3,242,222,45,230,69,98,29,156,199,209,17,237,103,48,87,166,46,208,
+249,242,155,201,60,207,165,177,17,36,86,31,180,144,232,88,207,231,182,166,59,254,29,223,170,160,240,9,179,50,113,188,17,136,204,15,14,139,255,34,152,214,32,115,5,115,109,171,96,49,242,115,155,251,157,125,113,234,143,139,137,126,34,27,34,163,14,81,127,
+52,134,177,138,172,123,15,159,211,99,227,65,9,251,197,172,192,32,84,216,241,112,240,202,48,76,208,128,200,107,53,214,134,96,0,225,192,78,178,130,213,107,141,164,163,28,75,49,206,48,106,115,178,156,17,7,131,20,69,187,43,208,185,176,203,199,5,57,250,208,
+73,116,108,155,5,186,140,106,219,203,160,129,193,117,50,134,123,227,204,118,107,135,78,30,223,238,166,187,5,134,242,52,130,197,224,74,94,248,109,5,214,8,102,43,139,17,184,6,97,49,250,164,132,150,112,108,136,251,135,229,248,111,49,12,35,23,4,155,72,8,
+57,21,116,202,222,223,182,9,38,182,58,241,221,137,5,75,246,17,28,188,50,12,19,100,16,107,155,21,139,33,20,64,48,240,82,130,77,102,133,168,81,80,165,136,125,28,179,68,240,114,114,79,103,156,99,161,198,150,39,110,71,214,108,36,12,243,246,51,88,243,225,
+73,127,220,96,220,12,79,226,239,29,153,231,56,91,1,232,22,151,197,117,125,237,245,82,95,238,98,24,26,35,67,105,215,217,157,141,242,96,59,155,65,165,216,235,243,101,45,211,215,110,17,71,235,240,225,156,90,223,93,167,64,144,41,235,62,222,153,137,194,156,
+211,139,151,33,48,224,64,38,115,221,98,220,11,14,145,215,13,196,155,122,128,161,197,23,19,191,85,173,113,197,186,247,42,108,49,172,8,215,240,166,77,137,142,211,153,17,188,194,43,141,43,137,25,134,9,58,216,87,118,229,202,244,233,145,158,182,150,102,94,
+142,181,43,10,135,5,98,31,66,65,199,250,216,77,31,60,141,162,150,35,11,149,64,156,89,24,196,27,28,103,184,153,207,74,154,199,1,250,98,193,72,4,253,112,114,213,174,13,215,238,146,84,132,82,145,143,247,141,114,125,153,102,203,117,122,109,182,196,67,204,
+21,1,15,126,153,29,200,112,95,64,39,104,171,33,187,190,188,203,199,36,26,211,147,2,223,69,102,21,28,228,245,105,197,8,190,70,147,97,138,117,175,62,12,185,106,157,142,45,85,3,149,169,186,73,82,85,60,128,152,130,138,7,22,75,220,203,108,169,46,45,211,61,
+205,131,92,92,9,146,63,240,132,106,151,16,128,120,140,108,241,55,50,81,250,151,169,37,219,215,60,217,67,127,84,37,85,209,74,141,23,60,216,247,244,198,47,242,248,174,175,172,208,217,98,141,131,87,134,97,152,117,96,77,60,116,52,167,197,132,55,246,198,104,
+40,241,241,25,167,188,188,76,239,47,84,148,199,218,101,137,226,238,57,1,123,34,163,224,218,61,60,158,233,56,240,9,177,55,246,243,191,75,71,233,137,99,222,170,204,14,10,147,133,170,180,216,123,130,227,13,87,211,184,214,137,130,110,221,32,157,171,81,208,
+71,54,14,52,181,10,68,78,189,147,241,120,169,214,82,240,244,11,253,17,249,29,51,184,126,173,206,110,190,20,138,7,37,103,121,252,238,29,138,135,236,242,100,132,134,98,31,223,124,185,218,50,125,84,168,210,153,170,51,11,160,54,52,99,206,145,127,218,53,232,
+34,185,44,174,74,243,52,94,55,115,52,95,145,18,172,162,50,249,3,238,128,112,29,102,167,44,227,128,137,191,191,125,222,254,170,174,185,82,93,216,211,31,228,29,216,47,32,104,112,171,27,195,48,140,57,32,112,104,135,127,114,254,240,127,180,80,165,91,36,125,
+150,221,137,114,136,67,95,217,145,237,216,205,210,8,146,195,120,143,215,108,60,130,192,239,23,202,180,119,147,120,165,41,98,111,238,62,118,55,61,17,185,93,155,124,174,118,6,88,230,161,219,127,188,137,131,0,206,33,19,139,21,122,101,174,228,152,134,101,
+39,141,90,157,10,216,64,41,192,160,124,253,246,193,36,141,165,155,103,216,238,88,19,16,94,153,41,210,91,121,62,136,171,166,95,130,112,195,120,135,87,115,229,166,45,140,102,153,200,87,124,159,81,245,26,168,36,54,35,18,55,130,106,164,27,108,238,166,56,
+186,88,161,189,113,241,131,146,200,96,82,134,97,24,38,152,160,179,69,70,194,18,98,157,221,231,149,71,182,155,19,137,117,240,30,136,197,223,58,28,240,42,24,151,1,49,9,54,43,151,117,24,234,212,137,247,102,89,48,116,59,97,27,135,45,51,246,131,194,198,47,
+140,164,90,234,86,180,86,220,121,117,127,92,123,253,113,182,68,191,157,41,242,153,88,0,22,138,3,202,253,3,9,67,25,84,4,109,247,111,77,209,245,75,53,250,241,228,34,63,108,10,201,87,235,212,31,226,71,84,37,119,54,152,186,47,212,150,149,86,42,226,217,122,
+115,166,72,183,8,12,72,192,33,233,23,211,5,169,223,139,17,7,118,19,34,220,61,210,99,235,189,248,226,92,73,27,0,43,146,164,192,189,247,34,87,86,48,12,195,48,22,64,81,10,206,27,34,188,105,115,107,52,6,67,139,236,147,16,139,241,25,236,89,236,46,94,156,41,
+54,173,78,52,10,146,28,191,58,175,174,50,31,197,7,176,39,68,231,41,138,138,224,21,187,84,93,161,233,98,117,173,75,128,105,70,174,188,220,209,46,198,12,167,20,216,220,48,171,160,184,241,129,145,148,169,100,34,196,226,209,100,132,126,112,98,193,55,250,
+21,236,109,246,42,252,247,124,169,66,97,234,232,176,196,31,13,7,96,63,241,197,145,30,211,153,83,180,196,63,58,150,241,213,195,230,118,42,146,187,231,120,67,107,78,187,193,98,247,173,13,195,122,111,174,188,106,135,98,51,248,55,6,227,33,203,149,13,207,
+78,230,249,249,116,25,184,191,68,171,196,237,62,92,202,72,82,188,201,89,123,134,97,24,198,34,168,4,222,41,80,217,121,102,169,102,123,156,38,90,117,122,225,51,88,40,118,21,168,42,126,234,196,2,237,31,203,152,142,215,32,18,227,108,172,2,88,152,221,209,
+36,89,17,13,133,8,243,19,113,86,191,118,48,161,61,11,250,204,31,230,99,48,239,72,166,62,196,51,48,212,128,74,98,20,220,88,177,130,133,176,12,253,234,241,137,156,55,127,248,117,204,86,229,91,43,29,111,163,15,249,210,124,119,166,36,247,34,158,41,248,103,
+33,64,37,177,213,64,71,127,216,24,53,28,149,216,62,135,9,214,188,161,93,12,124,230,190,190,35,171,137,99,237,50,204,152,12,142,191,243,213,241,140,246,30,187,249,201,212,146,214,6,103,6,36,179,94,152,90,98,127,52,23,178,187,79,252,96,9,198,82,246,14,
+85,197,1,219,236,125,167,131,247,169,72,164,48,12,195,48,254,5,29,81,115,22,206,112,120,15,186,30,237,4,34,93,151,132,206,117,124,70,99,247,26,227,14,96,127,2,177,216,204,172,5,8,178,170,10,168,80,44,0,11,51,35,66,54,4,227,111,92,214,167,228,204,226,
+37,222,177,24,227,54,163,200,94,227,202,128,221,132,200,188,48,173,59,126,64,220,94,207,13,32,169,101,101,143,108,5,214,176,118,235,151,47,87,144,131,146,253,169,142,248,196,159,23,101,251,162,134,253,126,122,216,220,14,132,151,21,73,177,199,92,153,69,
+226,70,244,97,36,16,129,141,210,31,15,107,239,81,37,22,191,60,93,48,212,205,128,69,254,137,137,28,189,36,49,0,98,228,145,146,52,161,86,102,187,92,43,112,223,189,117,206,92,219,34,60,192,240,62,134,97,24,134,17,1,7,86,84,126,253,209,132,223,235,137,197,
+170,18,177,238,138,76,84,218,103,237,72,201,251,44,70,30,16,139,255,241,88,78,139,131,218,197,223,16,147,81,156,129,170,93,85,34,49,230,85,152,65,247,196,102,177,248,99,80,48,181,40,169,93,247,15,231,185,56,66,5,24,92,215,206,147,216,40,208,191,134,5,
+196,102,55,241,7,137,133,57,127,90,104,175,29,248,210,122,66,150,49,61,173,109,6,126,17,96,48,184,78,6,240,178,84,233,197,20,100,166,11,53,45,51,44,202,243,236,91,123,17,34,195,72,240,222,111,127,104,255,48,18,36,10,48,224,110,79,58,74,59,225,157,214,
+221,165,221,11,8,94,103,75,117,154,41,215,232,237,92,89,11,108,25,247,34,163,2,73,7,190,116,118,119,6,96,109,135,7,214,173,3,137,182,107,15,18,20,47,157,47,114,21,59,195,48,12,35,149,159,157,45,208,161,124,181,229,100,123,90,19,136,223,152,43,41,219,
+131,224,7,203,248,31,8,191,136,131,240,130,72,53,18,11,81,108,237,188,144,171,45,211,233,82,77,105,220,141,234,115,179,34,177,142,202,51,139,87,248,245,212,18,237,223,38,214,29,141,115,24,119,209,169,1,123,128,44,174,74,69,233,140,15,126,111,208,37,175,
+235,139,11,15,127,213,206,113,29,52,78,223,78,202,18,53,166,215,57,224,19,129,13,254,46,50,50,50,164,121,33,117,209,222,84,212,246,201,194,12,105,217,106,180,15,89,17,53,117,176,16,176,237,196,199,124,217,96,235,86,43,240,94,85,195,72,16,176,98,17,231,
+106,97,6,108,141,219,47,20,3,28,188,241,66,246,253,210,100,132,178,13,21,41,56,40,125,84,168,106,9,89,134,97,24,134,177,115,31,34,90,210,58,34,19,161,238,139,254,140,97,236,230,227,123,208,57,110,222,44,86,228,165,242,204,226,5,16,67,31,154,47,91,22,
+223,193,19,199,252,225,119,235,5,198,37,118,95,160,147,195,47,2,255,47,167,242,150,60,213,117,144,236,120,246,76,190,227,223,243,173,80,140,67,236,243,83,75,66,19,116,209,250,228,23,49,244,242,164,92,127,203,177,100,152,133,98,69,252,244,228,162,229,
+236,39,90,108,120,160,193,197,108,75,139,111,58,60,140,132,113,130,131,139,106,215,92,236,163,103,56,73,193,48,12,195,56,200,106,5,39,119,79,49,193,226,179,131,9,41,93,105,59,97,155,194,103,150,11,64,52,223,143,46,61,147,98,49,236,32,159,59,157,167,51,
+236,79,172,4,20,57,138,22,124,54,34,163,67,219,45,232,158,234,86,196,98,136,196,120,175,145,130,31,223,10,197,180,54,65,55,62,181,68,183,109,78,154,190,136,176,174,64,235,147,95,24,138,201,241,201,212,25,140,249,250,214,113,21,200,126,62,117,124,129,
+30,186,36,109,170,178,120,182,84,163,239,78,176,72,220,8,130,46,25,32,112,195,103,253,124,134,45,88,220,8,170,143,174,72,69,105,116,93,130,204,9,187,142,250,242,138,80,71,64,35,28,156,50,12,195,48,140,122,48,96,90,150,208,48,93,84,87,165,10,251,132,102,
+22,30,16,11,48,172,253,143,185,50,23,254,184,148,29,146,124,177,17,131,170,176,46,243,18,16,139,239,44,215,181,138,109,35,98,60,10,175,158,60,177,200,113,184,66,182,197,89,107,106,135,46,22,63,48,146,50,108,67,129,46,115,84,18,27,237,10,245,253,111,0,
+45,219,240,19,186,107,115,143,161,13,30,158,196,176,155,224,77,147,113,19,216,220,191,117,120,142,30,187,36,211,241,62,70,240,247,230,76,145,253,147,154,48,148,144,87,89,191,250,89,44,20,187,9,88,37,60,56,156,106,249,140,224,191,95,221,31,215,54,202,
+231,207,46,41,17,140,115,149,186,54,8,81,20,158,176,204,48,12,195,48,206,128,152,250,150,33,57,179,94,94,159,183,191,83,7,213,120,95,26,77,183,140,135,32,26,195,146,16,175,235,21,198,68,140,113,146,18,7,209,169,178,46,243,18,120,166,241,130,53,199,88,
+42,178,97,104,52,42,136,49,12,254,245,243,37,122,67,113,71,31,195,24,1,107,54,6,192,222,154,141,105,243,140,90,217,204,90,245,244,15,132,84,143,139,136,246,123,61,171,186,37,25,161,84,195,228,67,61,171,122,36,95,97,47,80,230,34,16,104,193,182,163,177,
+34,187,188,188,66,71,11,85,71,2,42,221,70,2,195,13,224,181,211,19,233,72,217,150,183,0,0,32,0,73,68,65,84,162,88,168,91,27,110,86,94,94,166,215,102,75,28,8,180,161,95,208,248,189,17,153,159,197,136,131,77,210,104,247,8,14,78,15,111,207,106,83,171,237,
+94,243,49,72,82,116,112,6,241,132,101,134,241,36,168,226,186,54,27,163,108,228,227,253,2,213,132,16,138,184,50,137,97,188,5,146,204,162,85,197,168,76,180,251,217,71,87,149,153,150,100,252,76,248,251,168,78,99,177,216,61,200,234,70,35,159,249,179,202,
+198,141,254,205,40,124,185,62,19,163,29,233,232,134,106,81,172,67,232,112,192,192,115,204,178,241,43,199,75,172,103,24,165,113,158,209,149,235,186,105,69,124,214,3,85,211,237,6,83,122,167,200,73,14,74,22,106,254,14,36,176,64,239,27,76,172,122,209,54,
+225,150,181,234,243,215,103,138,142,36,23,244,44,40,195,48,171,155,226,29,35,61,166,175,132,254,30,59,159,97,36,110,112,48,76,71,173,39,22,120,194,50,195,92,12,158,249,241,196,199,33,172,147,9,220,102,32,153,251,201,193,68,83,161,6,162,204,181,131,9,
+109,93,192,4,118,183,36,119,215,95,83,30,92,201,48,23,243,236,84,158,30,219,217,43,116,85,208,190,110,39,40,112,249,220,214,180,105,203,69,109,232,217,88,134,158,152,200,241,51,207,48,14,114,255,64,130,246,110,106,109,149,136,24,2,47,196,24,191,59,91,
+240,109,145,35,68,112,104,45,141,197,157,34,64,96,15,2,50,181,78,54,255,8,8,8,246,239,144,248,163,158,42,248,247,97,51,90,153,136,133,11,66,211,149,153,24,253,120,114,209,215,89,61,102,35,245,21,254,125,187,1,28,138,30,28,181,62,180,20,207,186,221,98,
+8,14,134,95,217,145,181,92,29,242,204,41,123,15,150,12,227,5,240,172,239,235,139,211,238,254,120,211,253,217,233,4,174,206,215,119,100,13,37,134,240,119,208,109,128,9,236,78,85,52,117,186,166,136,27,231,74,117,122,101,166,200,150,108,76,224,65,37,240,
+111,38,243,116,159,197,152,227,229,233,130,237,213,196,159,25,74,90,22,86,176,6,192,190,139,135,96,187,3,153,51,46,142,242,250,237,122,176,31,63,58,150,49,236,55,139,231,21,58,196,214,100,152,126,50,229,207,97,133,167,11,213,150,69,123,102,225,103,192,
+60,242,204,111,24,87,3,17,4,193,190,44,222,246,169,87,15,68,98,44,186,102,50,241,200,234,97,97,239,145,216,34,196,216,195,172,196,103,32,87,230,138,11,55,0,145,67,100,42,46,222,187,79,210,144,195,86,224,96,248,47,83,75,90,208,111,22,28,74,217,78,134,
+9,58,104,165,198,62,139,42,155,118,207,187,158,192,253,218,120,214,145,61,217,168,72,220,8,38,175,195,35,81,53,184,166,95,187,180,183,227,53,197,161,245,254,173,41,122,100,52,205,113,14,19,120,224,85,138,125,217,44,239,40,152,29,130,110,72,81,81,5,103,
+154,245,173,203,140,51,20,36,38,21,78,113,27,191,235,129,167,184,81,145,184,17,60,243,159,223,44,199,63,221,109,188,40,105,104,60,58,51,95,101,123,89,211,132,6,254,236,43,223,84,241,15,221,144,142,210,3,67,61,180,55,27,163,187,135,146,116,101,79,84,251,
+223,161,149,21,58,93,97,63,36,21,212,107,43,244,9,9,19,84,15,231,202,244,7,31,10,197,8,140,30,216,106,173,74,0,6,248,151,247,68,149,12,168,96,172,211,23,234,162,75,82,114,2,224,223,157,43,240,218,229,2,254,98,107,90,184,226,98,32,30,166,183,102,75,84,
+181,177,72,28,247,202,135,185,10,93,150,138,104,190,226,157,64,80,243,211,147,139,244,238,82,48,237,146,24,245,192,79,247,129,161,36,221,216,27,215,226,180,61,153,40,237,73,59,31,167,233,126,155,169,168,241,218,6,236,201,123,123,227,244,246,124,217,214,
+231,186,17,12,155,29,72,88,107,212,27,140,135,41,82,95,161,99,138,14,243,102,61,76,65,54,22,210,226,156,131,11,21,101,215,180,25,159,29,76,208,237,3,73,186,99,115,130,254,183,129,132,118,158,216,153,12,83,173,190,66,231,217,247,153,81,0,214,195,195,243,
+101,67,251,57,44,102,254,249,84,158,94,94,176,255,220,116,123,95,156,182,244,136,199,184,88,197,14,230,57,246,112,154,177,88,88,219,27,68,65,145,194,51,211,133,0,95,73,247,3,187,137,203,122,173,39,121,54,39,194,52,83,168,209,57,159,217,198,228,151,87,
+104,160,187,75,251,249,68,120,237,92,145,139,110,44,96,187,80,140,42,137,207,143,166,53,129,18,65,62,94,56,212,235,255,123,103,38,74,183,15,36,180,44,40,111,74,246,50,85,169,211,174,68,196,212,97,107,61,16,47,126,116,114,209,209,67,130,93,60,108,242,
+208,180,30,28,76,235,213,101,58,201,131,32,92,11,14,225,88,111,186,4,139,162,224,58,241,228,105,243,21,37,140,92,180,1,165,125,114,90,146,230,138,117,109,141,180,19,4,60,175,206,149,105,122,169,74,35,241,16,69,187,187,168,187,225,102,196,125,149,175,
+214,233,173,153,18,253,211,100,158,69,15,70,9,72,228,255,245,182,12,93,211,23,167,222,88,232,66,156,134,61,173,49,78,235,237,34,58,164,216,118,10,21,172,255,97,91,102,195,52,114,35,224,103,80,149,192,133,200,126,83,27,79,65,35,108,237,137,208,129,243,
+114,170,103,218,161,181,183,110,207,90,138,119,240,123,24,8,59,19,175,67,136,127,96,75,15,13,39,87,227,216,72,119,215,133,243,4,196,148,171,122,99,116,125,38,170,117,207,241,218,201,216,77,227,126,158,10,117,17,30,167,46,234,162,250,202,106,37,40,134,
+164,255,246,204,18,253,242,92,81,217,253,248,239,6,147,66,103,60,29,136,223,175,242,92,4,199,193,58,43,227,204,130,34,5,214,88,220,139,110,161,39,90,244,50,150,140,248,242,185,61,89,172,105,177,156,149,56,144,214,10,28,159,61,103,127,108,229,71,108,243,
+40,30,14,119,211,35,6,3,81,44,128,104,189,251,187,116,148,158,56,150,227,73,208,54,2,47,93,51,254,55,141,64,36,198,68,92,63,122,241,194,114,66,134,89,250,141,131,9,223,154,202,251,133,119,207,23,181,65,66,34,188,171,224,48,207,116,102,36,102,125,64,220,
+122,134,240,89,138,180,127,100,181,15,77,176,7,32,227,60,95,30,77,209,182,116,231,78,35,196,105,88,55,119,100,162,244,157,163,57,101,223,27,214,50,34,123,51,98,29,236,239,118,239,203,159,182,48,76,115,61,184,198,168,150,253,185,164,86,203,86,192,195,
+84,36,41,142,54,215,43,115,21,101,195,161,113,158,48,234,241,174,251,62,163,205,223,238,235,200,48,164,239,231,22,172,40,236,160,223,194,217,174,25,178,134,71,49,226,136,158,89,180,179,187,67,30,248,140,49,62,149,141,9,237,201,58,120,110,209,45,228,150,
+161,190,178,128,238,244,131,19,11,150,244,43,136,196,191,224,106,122,203,216,178,19,32,168,251,155,75,123,45,77,92,69,48,56,108,49,99,192,116,70,127,216,204,250,21,235,34,177,223,22,31,29,12,164,147,1,22,105,246,246,114,55,56,60,46,10,84,142,226,189,
+124,0,117,7,49,246,203,100,24,203,160,66,211,136,72,220,8,132,56,248,240,170,2,67,214,68,185,209,102,15,114,90,187,46,50,216,33,193,30,172,29,50,60,76,193,13,125,226,191,23,35,232,231,9,179,149,86,16,86,238,84,244,29,25,198,45,200,16,155,24,119,129,243,
+198,172,128,37,17,10,240,24,119,179,85,162,110,112,69,202,222,24,194,41,160,95,61,62,145,163,183,12,86,6,67,183,194,240,80,12,249,243,99,129,163,42,108,169,40,134,216,107,181,77,2,193,32,222,255,173,195,115,178,191,22,179,134,254,176,193,15,167,213,164,
+235,70,244,108,140,159,31,52,12,111,144,197,120,34,172,172,210,198,139,224,160,218,31,9,105,213,160,243,213,101,42,46,175,208,241,82,77,233,253,133,138,184,191,221,217,107,186,141,5,34,177,202,106,58,134,97,24,59,128,136,102,117,223,131,40,10,145,217,
+238,201,248,123,83,81,79,84,217,236,18,244,206,107,36,105,115,161,196,85,146,14,145,99,105,53,9,113,116,38,90,61,79,220,50,148,164,131,139,21,238,82,100,2,67,190,186,204,213,192,62,228,187,19,11,218,158,107,102,207,134,47,49,134,40,171,92,255,176,207,
+66,168,28,109,16,62,43,203,43,116,170,80,165,131,249,138,54,88,159,217,136,172,78,0,160,93,123,31,119,189,254,234,124,145,126,191,80,214,98,153,29,169,232,134,103,226,204,82,141,142,230,43,218,224,58,22,136,197,145,46,20,99,33,19,245,88,193,251,85,28,
+66,130,14,30,54,188,112,24,27,75,134,105,48,246,241,237,176,80,171,211,76,169,206,15,154,5,210,18,252,193,252,8,218,127,175,235,139,183,108,27,57,177,88,165,55,230,74,202,68,246,127,56,50,111,42,240,194,230,195,107,146,187,152,150,40,252,148,121,157,
+99,108,0,137,49,61,160,141,133,186,180,245,15,29,61,139,213,101,237,240,228,212,30,123,179,224,132,108,172,155,16,72,237,28,14,50,36,209,90,102,71,50,98,155,80,188,85,194,176,33,29,209,248,185,19,131,18,15,164,232,158,178,115,191,198,140,19,209,68,193,
+95,141,165,29,73,238,66,48,217,147,141,105,113,181,30,99,160,194,105,182,84,231,67,44,99,27,184,191,100,8,197,102,187,78,25,251,193,249,3,9,222,79,14,38,58,174,139,56,175,60,59,149,87,38,18,99,189,187,107,115,79,203,243,20,18,139,72,220,161,240,236,197,
+153,34,11,198,235,224,228,142,57,112,255,156,153,43,209,191,178,143,186,237,72,21,138,209,34,38,171,50,19,159,131,207,227,74,0,251,121,43,95,209,94,65,69,182,85,68,38,44,239,32,230,7,16,64,60,48,146,234,232,43,132,64,2,175,93,179,37,250,217,89,53,126,
+66,8,188,32,118,220,53,148,164,190,88,120,67,229,18,134,139,205,149,107,244,252,116,129,167,165,186,144,15,10,85,186,95,210,215,58,202,93,0,140,68,48,156,228,158,193,4,93,221,196,58,1,107,33,94,88,239,112,232,123,111,182,164,37,109,85,1,31,92,209,225,
+56,224,246,193,36,29,242,72,242,140,109,106,86,241,82,124,178,221,164,45,74,51,80,253,174,242,44,129,231,254,11,35,169,166,21,215,16,119,180,179,77,79,216,145,231,158,241,63,72,62,202,168,246,159,116,40,30,194,179,122,85,58,74,167,74,53,142,185,155,240,
+175,107,226,24,6,208,238,233,141,83,54,214,77,161,181,205,28,131,144,207,149,234,116,0,66,172,66,237,4,69,64,119,24,244,232,135,237,209,120,42,74,207,78,230,185,243,150,97,60,128,84,161,248,118,201,62,112,248,60,54,96,103,236,6,155,213,67,18,255,13,167,
+2,44,55,2,145,120,255,88,198,84,85,16,132,21,180,206,252,64,209,224,196,245,131,197,110,88,59,156,190,177,24,220,228,73,39,244,32,117,125,187,20,2,213,215,207,151,148,93,59,220,31,168,68,23,61,24,161,122,198,175,254,235,140,122,32,22,25,29,186,129,181,
+113,239,166,132,182,230,97,216,172,138,53,79,150,15,238,166,4,39,69,193,41,1,255,200,245,172,112,145,169,6,4,35,89,126,171,55,246,198,148,204,21,48,19,239,232,207,253,166,120,152,158,158,202,115,117,49,35,5,84,170,27,169,56,237,196,43,10,43,245,80,37,
+123,221,64,188,169,21,92,177,182,76,39,242,85,214,2,214,129,24,219,13,103,20,51,34,177,14,238,205,135,198,210,84,60,150,227,184,123,13,156,65,204,14,105,107,5,58,194,25,245,232,73,174,29,107,246,94,229,229,101,154,44,212,60,95,245,44,85,40,222,146,148,
+235,100,33,251,243,220,2,42,24,111,234,143,83,127,44,68,177,208,199,27,35,90,134,222,158,87,39,178,48,31,131,150,64,89,135,18,110,97,95,5,98,201,231,182,166,45,93,87,108,152,152,204,14,19,122,213,240,243,215,26,172,93,237,126,167,253,161,48,221,55,154,
+162,59,234,43,244,194,153,37,37,215,18,118,37,162,66,241,43,60,156,144,145,132,25,145,184,17,84,25,126,105,52,173,196,222,166,49,238,16,193,110,155,4,153,216,185,47,203,172,124,43,213,237,173,4,195,33,114,216,158,241,36,82,185,74,66,53,177,206,80,2,251,
+131,189,107,60,158,123,179,73,113,90,235,164,250,204,178,51,177,14,227,63,144,112,64,165,58,146,16,86,249,227,108,73,137,53,0,132,21,120,144,183,123,102,32,30,239,234,141,209,55,50,81,205,111,151,227,115,247,0,91,173,219,4,44,172,176,94,62,254,209,60,
+39,201,136,232,92,185,38,77,40,62,85,224,74,124,149,180,75,116,97,88,52,44,87,48,223,232,215,83,75,158,236,146,144,106,138,34,235,240,97,215,231,57,13,68,22,76,11,223,191,109,117,210,56,90,226,176,65,234,47,28,20,33,178,252,253,174,126,173,53,148,81,
+199,132,68,235,141,131,1,182,241,104,4,66,175,136,239,18,90,148,100,219,130,48,214,193,154,132,181,203,104,181,20,214,50,120,76,218,13,58,2,112,176,177,10,60,211,130,108,189,195,200,5,118,19,86,3,126,196,0,24,50,203,172,34,211,131,220,110,107,25,28,4,
+100,128,234,57,59,153,145,232,61,202,173,195,31,131,36,143,213,98,3,196,58,168,204,99,24,25,192,206,4,30,181,86,64,101,227,111,21,36,206,209,149,246,55,151,246,26,126,102,144,148,68,76,121,131,196,4,18,35,198,189,155,197,60,228,241,222,125,125,27,173,
+185,130,200,123,57,121,103,144,183,57,153,162,140,175,142,103,52,33,184,211,96,124,232,125,56,63,127,121,52,229,185,159,145,221,179,21,161,139,44,184,89,58,1,187,161,107,7,19,154,168,204,168,65,214,34,141,224,140,77,250,87,51,205,151,73,56,248,220,202,
+162,137,43,64,198,244,90,11,201,43,84,130,168,72,122,193,211,26,130,175,89,240,188,254,98,90,141,31,54,227,127,176,238,53,243,36,54,195,238,254,184,86,157,200,172,206,79,64,183,143,40,249,234,178,237,45,174,191,150,80,17,10,219,9,187,91,172,101,37,178,
+97,249,195,172,130,132,182,232,124,150,27,185,56,132,145,8,108,140,204,138,197,16,137,85,88,190,161,146,248,238,145,30,75,62,249,44,22,187,3,196,58,50,188,176,119,11,198,75,126,1,73,87,171,201,157,70,14,243,144,84,37,96,13,251,198,101,125,212,111,114,
+144,49,138,68,189,166,237,177,80,172,0,8,37,86,68,22,136,202,44,22,171,65,214,34,253,18,15,38,209,184,42,37,39,144,211,6,191,240,52,88,71,193,134,136,140,169,85,176,246,13,119,200,182,202,0,173,187,111,157,51,254,252,161,10,25,109,254,28,84,121,27,116,
+234,32,145,161,191,240,255,59,197,205,18,170,99,80,101,179,135,15,194,23,120,79,160,91,64,231,117,5,21,114,104,41,156,21,244,42,126,87,65,252,128,68,182,149,164,218,122,222,176,217,119,111,193,67,131,172,119,103,197,159,87,116,95,237,149,20,55,153,5,
+251,51,214,78,84,59,61,118,73,70,235,4,98,49,206,219,32,174,65,124,243,242,116,193,80,178,13,177,147,170,185,32,15,109,77,9,217,22,221,161,160,83,141,105,143,172,51,30,226,29,238,28,93,229,249,179,98,73,98,60,231,92,248,162,134,191,26,75,91,94,195,160,
+237,121,169,178,216,159,38,192,46,2,135,86,43,34,177,14,110,40,4,110,42,124,11,131,206,179,103,242,244,200,120,123,191,172,118,64,120,226,86,204,85,182,74,220,248,71,99,97,58,83,229,86,26,167,120,112,68,124,67,195,166,250,157,163,57,219,127,2,180,92,
+254,126,161,172,9,118,227,233,232,6,235,19,4,82,176,153,121,17,83,161,185,242,223,179,64,216,192,125,57,148,12,55,173,74,66,101,230,116,161,70,207,78,229,149,78,255,30,140,201,9,169,118,166,162,244,146,4,49,175,21,152,135,32,90,1,73,107,207,147,221,188,
+56,87,210,58,19,172,218,24,161,74,206,206,107,217,200,119,39,22,180,42,19,43,7,8,136,204,42,6,174,1,28,38,191,150,138,186,58,214,129,23,233,125,146,62,11,179,63,236,100,139,164,120,103,40,22,34,202,219,250,85,47,2,231,147,79,143,244,108,232,116,132,135,
+53,158,185,123,215,214,81,62,127,120,23,12,82,194,128,59,36,31,177,175,68,27,214,166,202,242,10,157,42,84,181,63,87,149,48,199,61,103,182,10,111,61,88,183,80,128,165,106,189,100,54,146,145,88,192,51,158,8,243,217,153,72,235,122,122,97,106,201,244,112,
+64,90,139,197,158,82,148,232,9,58,88,123,140,184,3,180,3,149,197,88,11,189,224,89,44,85,40,150,117,248,104,252,60,175,131,193,79,162,224,154,122,229,134,242,50,16,142,176,208,90,25,72,130,10,29,180,191,51,171,68,37,182,78,171,62,60,49,23,35,99,77,23,
+221,84,205,128,231,88,123,22,207,22,180,22,254,109,107,135,146,217,106,157,197,97,31,128,74,183,123,183,164,218,182,173,226,207,112,223,194,3,241,185,211,121,101,3,112,100,197,63,50,215,207,102,64,56,187,175,71,60,1,116,76,193,117,197,193,231,153,83,
+139,150,246,101,28,158,158,158,92,180,237,187,53,227,251,71,115,244,240,120,166,163,103,93,35,232,102,82,41,198,225,154,90,141,117,84,121,152,210,154,239,179,232,222,129,164,145,221,207,191,200,44,134,70,70,33,56,43,234,74,67,1,74,167,245,74,95,71,145,
+252,224,65,98,222,5,207,59,146,101,170,18,102,237,184,73,146,213,192,142,76,148,136,133,98,199,144,149,20,103,46,70,127,70,49,36,208,232,222,12,107,45,196,72,118,219,107,49,171,92,35,201,18,19,73,218,67,10,10,168,68,145,218,15,44,59,107,127,96,198,219,
+194,27,196,93,17,163,247,70,62,109,33,195,196,152,7,11,237,19,19,57,195,54,20,56,136,162,181,139,39,86,51,126,68,102,251,233,157,14,12,173,192,1,9,149,10,154,181,12,139,196,158,7,247,16,60,10,141,122,27,226,239,225,239,243,112,216,139,129,224,35,90,13,
+172,194,79,87,7,251,50,132,205,188,137,103,24,130,166,182,151,43,126,238,81,193,254,15,71,230,233,208,124,89,187,70,237,192,239,224,55,147,121,71,42,54,245,107,106,230,62,128,47,177,170,246,116,146,228,251,44,195,102,195,111,192,210,206,76,82,139,7,137,
+49,178,216,44,201,26,42,21,81,87,124,192,48,42,129,88,140,216,165,211,222,133,189,27,150,49,255,120,44,199,34,177,34,176,7,90,241,86,111,134,202,2,42,17,164,166,132,112,248,184,163,190,34,69,28,197,3,224,245,10,218,219,7,173,251,122,174,199,43,55,148,
+31,192,193,18,7,55,76,161,70,171,86,51,195,126,28,88,39,22,43,244,202,92,137,5,40,155,41,115,43,141,99,140,196,228,173,59,59,82,81,173,13,146,97,172,128,196,171,85,175,108,216,63,29,90,170,114,87,78,3,90,149,238,182,140,229,247,191,162,184,131,6,7,33,
+28,136,48,37,29,3,112,90,197,153,216,155,33,210,254,202,225,121,1,154,136,126,102,73,59,88,236,233,197,247,93,21,55,208,41,87,94,94,166,215,102,75,142,223,143,184,166,143,127,52,223,241,154,66,116,127,101,166,168,13,23,84,9,174,207,241,197,138,214,166,
+105,5,173,29,87,81,50,67,6,21,5,177,14,252,135,173,158,39,208,201,113,242,163,121,165,118,62,140,191,8,73,82,89,100,137,53,140,53,38,11,85,105,29,84,124,198,219,8,116,5,20,160,245,76,23,52,219,152,108,184,155,54,197,195,84,90,94,166,197,202,50,77,151,
+235,244,65,161,202,86,19,138,185,34,35,55,89,138,226,23,183,159,139,165,247,14,188,112,102,73,203,60,203,248,28,175,211,31,151,43,238,178,253,132,90,26,91,181,182,199,66,148,8,173,22,224,115,11,123,103,102,202,53,105,65,196,20,103,74,29,99,40,193,67,
+38,24,119,32,106,227,132,247,127,251,195,57,91,127,22,116,162,72,241,254,85,16,252,35,150,64,53,171,149,120,13,66,172,19,193,45,14,69,16,128,241,194,0,156,241,117,213,105,19,197,154,235,188,14,81,64,225,230,150,253,118,215,52,87,91,166,143,28,238,198,
+248,225,100,94,171,128,53,43,110,214,151,87,232,137,99,106,218,58,33,164,247,73,136,247,207,9,14,67,236,4,188,221,225,61,108,21,136,115,240,134,103,207,98,134,9,54,211,18,207,101,71,217,159,184,37,186,109,12,227,14,210,146,135,235,143,38,195,68,246,30,
+75,132,145,46,20,35,32,222,62,95,22,10,70,112,8,97,47,172,141,108,141,251,95,40,70,32,123,85,58,74,3,177,16,149,106,203,180,84,95,161,131,139,21,199,43,24,86,219,58,88,176,52,202,137,66,141,174,238,23,255,28,84,4,241,144,3,231,200,85,235,218,96,27,134,
+113,18,84,101,138,118,42,225,253,248,28,59,99,11,89,9,178,35,138,42,55,181,107,49,153,239,232,249,220,200,59,51,69,87,12,17,210,45,101,24,255,95,83,12,66,197,148,112,163,149,197,24,12,248,211,83,234,6,89,162,186,78,134,80,252,190,205,207,253,61,22,59,
+50,26,193,250,134,56,157,171,138,25,38,184,160,154,245,46,9,29,228,232,0,98,219,4,239,128,181,31,251,8,44,100,226,161,238,11,113,35,206,234,249,106,157,62,200,85,124,221,57,42,219,242,38,214,45,87,120,182,3,91,20,0,180,122,237,71,5,172,5,177,24,34,177,
+151,90,197,218,33,201,158,56,16,160,29,110,103,38,218,116,90,56,218,141,177,8,189,63,87,226,41,183,30,1,45,170,183,87,151,133,135,188,188,55,203,86,5,78,114,94,98,0,55,93,100,81,135,177,6,90,247,101,128,207,177,83,40,134,21,209,213,130,195,122,176,215,
+189,173,48,81,174,85,188,30,154,213,246,224,203,178,177,166,130,49,188,118,167,11,53,122,118,74,157,248,198,48,141,160,178,24,93,117,119,13,37,169,47,22,110,122,159,98,248,221,123,115,234,171,221,101,60,247,168,74,182,91,48,25,73,202,233,16,186,177,55,
+198,177,56,99,9,136,73,253,33,9,93,55,130,30,251,140,24,168,116,197,249,108,239,38,177,249,15,175,243,58,226,25,218,13,64,69,194,0,207,245,45,241,48,125,114,48,161,185,2,248,177,224,83,214,250,229,37,108,251,105,33,246,222,89,174,211,77,155,18,77,197,
+191,245,160,77,204,111,83,117,177,143,177,179,112,123,144,157,122,100,123,182,99,86,18,127,14,159,201,43,250,226,90,59,33,31,86,221,207,129,233,2,221,191,213,186,13,13,2,193,23,217,211,214,81,112,224,182,234,11,187,158,215,231,185,125,138,177,134,44,
+27,39,217,118,80,235,65,139,254,31,103,197,68,35,28,190,156,240,157,211,61,117,33,198,161,123,73,103,161,182,204,29,94,140,43,64,71,221,161,137,85,219,3,189,251,140,92,112,143,202,120,238,95,80,224,249,45,107,184,246,170,37,21,11,60,140,121,78,230,171,
+212,31,23,151,30,166,184,155,196,113,112,62,219,145,142,90,238,166,128,85,23,219,42,184,31,163,58,141,14,254,30,44,205,182,251,168,240,83,167,34,57,151,123,84,241,220,7,43,216,42,139,67,100,192,11,19,199,119,100,162,90,201,118,99,21,0,170,84,160,206,
+31,93,168,248,50,59,93,215,70,94,203,43,43,62,232,179,195,26,218,128,205,250,35,98,1,250,202,142,44,125,255,40,139,197,110,7,85,197,59,115,101,173,74,205,10,207,78,230,217,168,223,5,160,74,75,116,152,102,177,182,204,207,171,135,216,155,138,210,206,116,
+132,50,225,144,86,65,128,164,13,134,112,193,90,225,237,92,153,91,5,219,240,219,153,34,141,38,35,150,14,79,56,56,57,61,132,77,19,227,120,22,2,227,114,176,159,156,113,81,34,89,228,185,135,200,204,54,42,173,233,233,238,162,79,101,99,218,64,220,198,138,54,
+236,75,103,10,53,205,170,135,5,39,111,128,179,254,53,3,9,225,97,116,175,113,183,161,227,224,124,246,203,169,60,237,31,203,152,78,66,161,131,226,199,147,139,190,188,46,126,3,154,139,145,130,207,245,192,85,0,5,163,126,178,162,128,176,43,107,254,18,121,
+68,215,83,82,63,173,137,192,1,108,47,56,145,175,10,121,53,55,130,138,107,63,9,45,200,80,221,61,210,99,233,189,88,176,176,112,125,235,176,203,29,192,25,109,106,235,23,137,76,137,197,8,254,127,119,182,192,7,167,53,134,35,221,212,31,9,81,177,238,140,151,
+215,175,167,150,104,255,182,140,208,103,188,56,109,127,181,20,35,14,134,89,221,59,210,179,193,50,6,135,0,205,155,178,39,172,85,205,65,208,124,246,76,158,135,122,54,1,135,167,31,156,88,160,71,199,50,166,68,35,92,83,62,56,49,140,55,177,250,220,67,36,254,
+153,130,106,98,175,114,107,54,70,183,109,78,54,21,162,240,223,198,210,17,237,117,227,96,130,158,155,90,226,184,209,3,188,114,182,32,212,169,134,189,82,117,50,19,3,205,119,36,35,20,107,16,204,220,56,60,85,53,56,147,60,49,145,163,47,140,166,13,175,123,
+122,172,195,133,64,238,7,118,19,86,68,98,29,60,231,110,152,51,37,11,136,222,55,111,78,10,39,186,200,67,5,84,161,129,63,251,202,55,93,240,61,124,201,249,82,157,246,10,250,150,233,124,152,171,208,193,188,127,54,164,71,198,210,212,35,96,10,222,221,213,69,
+187,18,17,250,253,2,87,17,184,29,220,183,75,165,58,141,36,194,29,179,206,154,0,117,58,79,239,46,5,59,248,130,96,119,255,230,30,250,236,104,74,91,67,174,204,198,232,154,190,56,237,27,76,104,247,125,162,139,232,164,34,209,248,124,109,89,75,236,12,90,108,
+23,212,126,167,231,248,32,236,118,112,32,127,96,107,202,80,101,72,42,218,77,187,179,49,58,189,84,165,121,5,94,129,183,13,24,179,176,234,4,190,234,75,10,42,145,170,43,68,7,23,42,148,238,234,210,134,126,180,67,243,36,62,95,162,159,156,89,210,222,199,48,
+140,55,193,243,11,139,165,212,10,105,251,101,187,53,11,67,156,208,53,245,111,10,45,153,16,63,200,0,223,93,69,236,253,197,145,30,205,239,210,200,218,143,125,11,113,82,189,186,172,44,54,98,172,113,172,84,211,226,88,196,17,102,129,184,242,248,68,78,217,
+149,71,92,244,133,173,105,250,228,64,130,46,73,69,104,75,207,199,47,220,111,55,247,197,41,219,213,69,167,203,245,192,238,223,249,229,21,109,221,195,179,183,41,222,250,156,135,42,226,87,206,21,233,153,179,5,71,174,213,157,125,113,186,161,55,70,183,244,
+37,104,103,50,76,195,145,144,118,47,50,205,129,13,217,77,130,30,212,96,52,22,246,149,86,131,226,45,171,231,225,70,222,56,87,244,196,253,199,227,236,109,68,107,141,91,18,159,130,14,7,11,63,249,188,64,116,146,225,81,197,211,151,91,3,91,143,27,7,226,148,
+141,134,46,10,178,33,74,192,219,11,109,91,42,51,242,176,161,192,11,65,215,214,100,152,91,218,91,128,22,203,47,141,166,219,174,25,122,101,231,117,125,113,173,237,75,197,53,195,250,243,88,36,100,122,45,131,109,197,247,78,46,216,246,189,24,57,224,185,188,
+195,100,135,7,14,3,104,57,124,234,196,130,237,247,32,214,8,25,237,94,176,186,82,5,170,101,80,41,136,65,87,87,165,162,90,219,52,14,198,168,214,134,208,130,159,233,84,161,74,175,230,202,92,89,195,48,62,2,246,49,240,239,220,147,142,94,136,119,116,16,235,
+156,40,212,180,120,72,53,16,217,18,97,241,41,235,42,124,21,33,234,88,177,45,195,62,54,87,93,14,124,165,167,219,65,92,216,110,56,86,51,16,79,62,121,66,77,215,141,145,88,156,214,226,32,12,116,131,87,175,170,120,220,173,192,254,5,47,84,95,163,11,114,40,
+182,186,238,77,151,235,52,89,174,57,210,129,6,177,243,211,35,61,27,236,243,134,215,228,47,84,188,106,197,44,60,168,119,3,183,15,202,153,79,35,211,170,193,13,224,60,252,119,233,168,144,231,255,108,169,230,25,75,142,174,79,252,151,223,241,9,197,102,190,
+113,89,159,80,53,212,203,211,5,95,121,188,124,121,52,69,219,214,134,144,136,114,200,135,102,233,34,96,83,252,220,214,180,161,5,12,11,213,79,79,241,230,232,22,16,92,153,245,250,130,208,174,66,168,211,129,223,252,181,6,171,146,248,217,244,6,56,16,125,237,
+210,94,203,65,15,170,68,236,174,240,177,226,103,223,140,223,76,230,121,48,27,195,48,129,100,255,112,143,176,29,30,10,87,254,219,161,89,91,47,31,42,182,30,187,180,215,242,251,145,136,251,199,99,57,78,192,121,0,36,4,80,53,222,46,254,192,61,119,56,167,46,
+158,68,76,100,214,66,134,28,136,199,153,246,152,93,239,222,153,41,250,114,94,150,85,68,181,171,70,252,166,99,161,72,209,170,119,51,172,100,189,100,157,202,214,19,10,128,109,196,158,222,152,102,151,96,22,136,45,191,240,217,194,117,247,80,146,34,146,22,
+31,248,69,189,58,199,246,19,180,38,166,252,249,37,105,195,11,23,42,75,112,95,226,254,204,115,64,237,40,8,76,247,111,77,155,110,197,195,239,250,242,140,58,11,128,67,133,26,29,70,107,109,119,23,101,34,161,13,247,26,2,229,83,75,85,250,127,79,46,210,107,
+11,44,200,121,129,207,108,74,210,72,79,196,242,55,197,58,98,119,187,239,233,74,93,107,241,20,9,90,181,67,220,20,39,46,24,134,9,38,176,1,187,173,63,110,233,44,162,3,193,206,110,27,188,7,134,146,52,32,208,117,8,209,177,88,97,11,10,47,128,214,107,216,65,
+21,203,117,74,133,186,105,133,86,168,139,186,168,178,188,66,231,139,117,122,119,174,68,79,156,90,84,106,189,248,165,45,157,43,137,155,129,248,228,146,68,68,179,97,96,156,5,213,234,227,25,115,5,105,195,201,136,38,0,250,201,230,83,132,127,183,73,78,69,
+49,136,116,117,249,202,126,2,154,9,180,19,88,240,153,57,151,160,43,226,255,60,50,111,235,119,147,77,24,217,60,110,125,180,23,84,108,126,255,104,142,30,30,207,152,106,251,242,91,6,70,39,36,195,5,124,141,88,72,188,141,206,15,160,146,216,74,197,29,15,6,
+116,7,247,12,38,44,77,75,167,181,67,209,93,155,123,148,89,60,96,61,211,42,59,184,90,216,23,88,105,239,93,207,149,153,152,237,83,231,159,57,181,40,52,84,241,5,190,95,25,134,9,56,255,50,181,100,185,59,67,75,182,41,88,71,199,83,226,29,135,176,230,178,123,
+79,98,228,129,78,31,55,116,251,96,62,8,134,35,90,5,113,60,172,188,248,222,115,14,116,62,90,181,59,64,5,242,13,75,85,238,60,99,58,130,179,240,183,63,156,211,42,215,113,142,106,39,109,161,138,248,181,115,69,79,106,122,221,240,103,249,79,219,179,218,226,
+200,216,7,110,168,127,56,50,175,137,191,197,54,173,254,104,177,129,95,206,247,142,204,251,82,36,102,236,1,118,19,86,129,88,140,236,43,227,12,168,38,190,90,112,232,37,130,34,94,195,25,179,192,238,68,196,103,75,71,133,7,25,60,213,223,177,216,93,131,206,
+28,14,252,25,134,9,58,88,7,15,89,168,120,196,65,247,137,99,246,15,17,67,28,35,99,79,178,154,120,103,130,205,13,125,226,3,232,111,148,52,52,146,49,15,42,130,141,218,227,181,226,110,147,243,58,152,96,131,228,41,236,152,96,109,7,253,14,182,158,72,170,226,
+127,31,95,172,104,255,29,197,120,94,213,244,180,211,29,134,171,60,52,150,166,190,169,37,206,130,217,12,110,20,188,176,152,93,149,142,210,64,44,68,217,72,72,27,14,177,80,91,230,195,44,99,26,100,179,68,3,107,8,61,168,74,86,57,224,142,89,229,83,18,42,58,
+193,238,108,148,7,184,48,166,72,72,236,200,128,232,108,183,55,31,252,227,166,202,117,186,119,75,170,109,246,190,17,191,118,230,48,12,195,88,1,7,219,59,203,117,186,121,115,210,208,58,234,213,121,22,240,58,118,98,128,22,227,93,68,170,137,117,160,169,168,
+136,135,152,141,220,51,36,110,151,128,226,41,84,37,179,95,177,60,114,10,7,73,59,133,91,186,34,100,115,81,25,16,166,197,150,234,43,142,76,227,13,26,8,184,206,4,244,240,90,71,217,52,201,177,159,80,57,197,222,173,140,165,228,84,146,222,212,31,167,67,147,
+121,63,94,34,87,51,40,169,242,101,83,204,95,147,101,25,111,177,42,58,219,191,30,35,16,59,249,209,60,61,56,146,162,161,100,184,169,208,129,45,102,186,192,147,172,25,134,97,154,161,23,173,160,208,96,103,38,218,212,103,17,126,138,239,205,149,61,155,104,
+75,72,154,133,194,4,3,153,93,121,253,17,22,138,157,96,68,210,239,112,7,252,141,3,46,20,163,251,221,140,93,106,59,142,45,113,17,147,87,217,160,44,220,53,210,67,31,124,84,101,207,98,198,54,78,228,171,194,147,151,117,78,178,233,188,180,133,92,214,6,203,
+152,35,19,150,35,20,115,171,165,55,64,229,62,146,50,253,177,144,230,177,142,196,89,174,188,76,211,197,170,167,43,24,102,21,38,237,32,254,234,158,220,24,226,153,105,88,3,185,51,135,97,24,198,24,141,243,6,244,181,244,224,98,197,23,9,54,213,66,29,246,246,
+219,7,147,212,191,46,22,67,65,203,7,185,10,119,182,4,136,161,88,136,136,235,110,148,35,195,182,134,180,170,112,62,79,201,210,106,80,184,193,49,185,119,217,32,20,227,33,219,215,23,167,95,157,231,146,123,198,30,14,204,20,165,9,197,65,111,13,65,96,47,11,
+89,27,44,195,48,27,193,33,18,94,226,27,159,179,46,45,217,3,251,151,107,6,18,218,84,121,21,3,131,72,162,184,171,249,113,57,212,226,203,1,40,195,48,140,56,110,88,75,143,151,228,216,159,229,21,238,71,176,18,252,171,177,52,165,163,205,197,165,254,80,152,
+110,137,135,233,147,131,9,109,168,42,239,89,12,227,110,36,206,220,247,44,56,135,252,125,135,33,109,70,56,204,150,182,202,129,245,205,150,120,152,178,107,69,52,185,218,50,157,46,213,44,37,79,155,246,42,239,238,247,167,80,188,55,21,213,178,124,163,13,149,
+147,51,229,26,157,45,215,233,237,197,10,87,81,43,66,179,221,88,170,9,15,64,58,206,193,214,69,149,116,76,176,129,88,199,184,19,180,247,26,73,142,33,32,195,223,251,122,50,76,79,158,88,180,189,170,11,226,46,14,212,240,212,19,97,130,237,170,24,134,97,24,
+65,112,14,147,113,62,152,80,116,62,64,177,198,125,163,41,67,127,23,73,98,252,221,237,243,234,146,193,140,113,100,118,69,77,240,188,23,198,7,188,123,190,40,52,28,16,231,82,94,235,212,113,107,54,166,13,211,108,117,166,195,121,15,195,108,95,156,43,25,214,
+60,155,126,18,54,51,63,77,208,199,133,251,207,151,246,210,253,91,83,180,119,83,66,11,64,244,215,213,253,113,205,155,249,107,248,243,129,4,245,176,167,149,18,208,54,92,23,16,230,177,248,252,144,253,116,25,31,48,41,105,0,221,153,2,7,166,110,4,67,49,204,
+118,80,160,50,233,225,241,140,146,159,230,117,9,93,25,239,229,88,40,102,24,134,97,196,121,73,66,161,210,43,10,108,30,208,37,100,84,36,190,232,125,189,49,45,46,75,218,147,28,0,0,32,0,73,68,65,84,96,220,133,158,56,151,129,172,202,120,134,113,18,116,109,
+35,113,103,5,104,60,79,28,203,241,239,79,1,168,32,254,218,120,86,211,51,219,21,254,224,207,160,131,254,167,237,89,237,61,70,104,249,105,35,6,63,192,205,64,244,125,100,52,221,241,194,209,154,56,142,139,247,232,88,198,240,197,99,196,248,254,209,156,37,
+177,152,23,159,143,145,233,121,198,21,169,206,240,190,164,106,204,35,92,213,233,58,112,144,180,154,141,135,29,197,99,151,216,47,22,191,148,43,211,92,201,122,37,205,137,197,42,253,73,82,178,131,97,24,134,9,54,216,79,176,175,88,229,173,115,69,37,86,72,
+176,146,178,10,226,130,97,238,8,116,29,50,42,209,113,239,114,135,178,51,136,20,160,53,82,228,33,200,23,64,97,31,170,80,205,128,223,3,52,30,30,38,109,63,208,44,247,143,101,76,205,41,130,38,186,223,160,222,217,114,151,138,121,188,178,22,34,49,68,223,177,
+180,185,202,104,92,104,163,23,143,17,3,11,8,22,18,51,11,242,108,169,198,139,207,58,100,109,140,121,133,195,168,152,143,129,103,144,213,140,173,14,68,254,183,217,138,197,117,124,122,164,71,232,43,105,157,47,10,14,147,191,156,202,91,74,20,65,96,126,122,
+138,59,59,24,134,97,24,121,96,95,177,146,192,132,31,166,10,235,196,59,251,226,194,115,61,30,28,49,95,141,204,216,11,42,209,69,139,102,222,224,161,133,142,145,171,200,57,199,158,224,65,249,23,1,251,136,223,76,230,59,234,53,24,92,7,91,208,111,29,158,99,
+157,70,1,208,58,161,89,90,217,139,240,30,188,119,184,67,33,109,232,243,127,249,213,111,54,251,131,169,66,141,62,244,176,199,206,103,54,37,105,155,197,65,95,161,238,46,186,36,17,161,215,77,102,80,24,243,228,151,87,232,229,217,18,69,234,43,212,27,237,166,
+88,168,249,13,187,88,169,211,91,51,37,250,201,153,37,237,61,204,199,140,68,66,52,24,23,243,115,3,207,78,230,233,60,47,236,142,48,87,174,209,53,125,113,203,255,244,107,231,138,116,136,61,209,92,5,4,222,155,55,37,133,191,210,96,164,155,222,177,57,9,48,
+95,95,161,211,75,85,218,145,138,26,14,56,112,136,255,193,137,5,174,156,97,24,134,97,164,82,93,33,58,184,80,161,237,241,8,165,162,198,146,165,127,156,45,209,211,211,5,37,191,136,63,223,210,211,242,188,98,148,158,72,55,29,224,193,241,174,66,59,95,214,87,
+104,187,69,253,0,247,224,191,177,118,224,24,11,229,58,93,37,97,88,254,207,78,229,89,107,88,199,233,74,93,211,107,166,151,170,218,128,179,90,125,213,243,86,127,189,59,87,162,39,78,45,218,126,94,97,62,230,47,134,123,104,115,194,186,254,3,189,115,52,22,
+166,223,47,180,94,179,90,126,122,206,195,130,17,252,149,225,61,44,2,42,139,225,89,236,199,161,126,110,4,22,10,186,141,2,134,67,232,67,218,22,106,203,60,33,184,3,50,38,147,66,136,103,161,209,57,80,85,252,194,212,146,102,147,99,22,84,208,200,180,32,97,
+228,112,149,197,131,198,122,68,130,0,51,224,30,252,199,99,57,218,215,23,215,6,218,182,18,140,81,109,243,222,108,137,247,70,134,97,24,198,54,144,132,68,219,51,230,204,92,215,23,111,217,90,139,86,127,84,113,170,180,64,74,69,196,187,78,181,225,181,137,48,
+199,222,46,3,118,92,155,99,33,211,58,2,98,241,159,157,85,147,168,104,4,69,9,235,227,205,160,158,9,240,44,137,14,195,124,7,190,188,92,52,213,18,92,99,94,179,156,7,149,192,151,101,197,147,34,120,86,224,162,128,51,96,51,90,62,73,167,61,108,196,126,131,64,
+101,94,35,56,44,243,97,88,61,44,12,155,231,185,211,121,75,67,53,104,173,85,228,201,19,139,206,254,0,14,177,127,184,135,182,36,195,90,101,136,46,140,65,8,131,13,199,235,231,75,74,239,69,4,167,224,182,205,73,195,85,157,168,94,112,34,48,101,58,131,234,92,
+25,68,21,218,64,225,96,142,61,15,19,113,47,79,70,104,104,157,5,211,116,185,78,111,177,23,54,195,48,12,163,8,196,70,120,225,96,220,31,9,209,120,34,76,229,229,21,154,42,215,181,161,97,78,116,181,136,20,102,52,178,53,206,66,177,27,65,92,125,182,92,55,28,
+143,195,23,91,181,94,0,251,147,235,6,226,218,60,139,245,220,50,148,212,10,128,126,61,181,20,184,251,11,201,165,191,221,217,219,244,186,116,2,215,236,231,18,6,60,51,140,221,92,159,17,23,137,117,246,100,99,116,172,133,150,208,84,40,70,9,121,43,101,217,
+237,192,175,195,172,47,113,43,176,57,160,58,153,7,245,48,110,7,130,230,246,249,178,54,77,217,44,16,153,131,150,61,197,196,233,107,6,18,77,131,125,60,247,253,161,213,105,214,251,106,203,244,163,137,5,101,215,7,135,161,143,10,85,218,55,152,104,155,41,68,
+198,28,147,193,121,109,242,63,33,7,230,5,224,224,173,9,194,108,63,204,48,12,195,184,0,12,168,195,139,227,30,70,5,136,199,49,251,227,83,217,24,93,145,141,109,168,104,135,86,130,225,119,240,53,86,49,60,81,7,21,196,15,143,103,58,10,161,233,104,136,246,111,
+203,104,231,5,136,167,65,2,231,182,191,26,75,107,215,192,40,152,129,244,221,137,96,93,39,191,128,138,216,45,241,48,101,195,221,142,39,17,85,49,154,148,163,117,82,135,207,106,42,20,155,157,110,232,38,182,73,240,106,109,4,153,107,191,6,37,120,176,174,72,
+69,55,220,32,147,133,42,189,159,175,120,54,89,16,84,96,65,113,195,82,149,238,221,146,50,84,237,128,202,217,39,142,5,111,48,224,87,199,51,212,111,112,157,64,32,246,216,206,94,205,196,95,85,117,49,2,206,159,76,45,209,240,76,145,46,77,70,180,141,79,7,27,
+224,193,124,69,105,80,202,56,139,172,97,149,12,195,48,12,195,48,140,49,32,52,53,90,35,226,220,156,8,117,59,166,11,64,36,254,202,142,172,169,2,2,180,150,127,125,71,150,190,115,52,103,235,119,115,19,56,215,226,231,109,87,20,164,131,179,240,155,51,69,182,
+240,243,24,40,12,133,85,30,10,228,82,45,6,178,57,97,75,164,138,254,22,86,76,86,104,101,235,68,205,132,98,100,200,94,244,240,195,210,215,97,122,159,89,98,130,83,109,221,8,54,186,187,54,247,180,244,240,193,127,223,187,41,161,101,33,159,63,187,196,130,177,
+135,128,152,249,198,161,89,205,82,1,195,24,154,181,76,97,106,233,31,206,151,2,185,41,126,121,52,101,88,36,110,4,213,197,11,199,23,148,182,112,105,213,51,57,30,138,225,85,142,230,43,66,62,105,58,21,22,138,25,134,97,24,198,53,32,129,43,163,219,135,197,
+41,111,177,122,30,118,238,76,140,74,98,43,247,29,42,107,113,254,249,225,100,176,218,196,96,35,129,23,102,31,237,233,141,83,79,164,75,179,26,44,215,151,105,169,186,66,111,207,171,181,24,100,228,128,110,255,7,71,83,29,109,97,224,48,128,215,46,31,218,52,
+26,181,168,20,229,162,83,44,178,42,207,156,90,244,116,169,118,214,130,39,77,59,50,18,6,22,184,9,12,133,48,58,48,11,34,199,195,219,179,218,144,173,151,88,176,50,12,22,48,167,91,30,80,93,76,120,209,234,176,12,248,160,29,92,172,4,218,160,31,129,194,54,129,
+1,99,159,219,154,166,111,127,56,39,245,59,49,114,65,134,89,247,214,77,175,77,74,95,172,44,107,222,186,31,20,170,74,159,73,60,111,240,137,19,229,44,251,23,50,140,39,129,135,228,238,190,152,54,248,170,177,162,9,34,83,174,82,167,231,167,11,236,79,202,48,
+30,228,212,82,85,40,158,164,181,162,13,213,224,124,178,43,21,161,193,216,197,73,108,116,146,98,242,61,119,171,185,23,84,199,90,241,221,213,193,253,26,212,225,137,90,17,149,203,4,97,189,171,187,17,39,206,42,94,195,140,142,165,131,193,148,208,243,158,152,
+244,207,60,38,104,182,42,196,226,11,59,5,254,193,231,167,188,95,61,58,81,172,209,94,137,159,119,206,195,67,253,214,99,229,225,2,250,123,88,44,110,14,2,175,221,217,40,141,167,54,86,240,162,237,225,72,190,226,232,181,227,9,165,171,236,19,20,237,240,187,
+69,160,198,131,14,220,201,253,3,9,109,0,105,171,141,243,174,250,10,189,55,91,82,54,112,4,73,25,12,198,48,227,145,214,140,223,78,243,176,66,134,105,4,67,173,48,200,99,71,58,122,81,203,28,58,226,78,23,170,244,94,174,226,104,171,33,14,227,72,44,182,90,139,
+80,17,134,206,22,183,248,71,34,54,220,153,138,210,112,50,124,209,80,215,51,133,154,227,241,11,195,184,145,215,102,75,194,66,241,97,133,54,143,70,59,73,15,231,202,244,139,233,2,11,85,46,228,10,9,131,250,111,31,76,210,161,128,249,21,187,13,236,183,55,14,
+38,90,218,37,220,143,181,129,159,195,166,96,29,195,128,73,43,160,178,248,243,155,147,190,169,44,158,45,213,165,116,173,130,185,82,107,237,55,244,249,191,252,234,55,241,23,158,153,92,164,63,249,64,76,74,117,119,209,53,18,22,83,157,137,124,149,142,249,
+64,44,198,195,245,231,151,164,173,191,63,29,165,147,139,21,154,175,243,162,165,131,234,197,47,109,73,211,205,155,19,52,16,15,55,109,7,202,198,66,218,181,219,155,141,209,116,161,202,215,207,33,224,235,117,211,96,66,248,31,207,70,67,244,242,44,183,10,186,
+9,60,135,255,251,182,44,237,200,70,219,182,228,225,207,182,244,68,232,154,84,148,14,46,84,168,170,224,81,196,222,122,149,133,1,147,58,16,145,14,204,243,253,198,48,58,72,8,221,51,146,162,75,82,145,13,213,85,16,57,177,23,95,153,141,209,174,68,132,78,23,
+171,148,87,124,208,66,231,10,98,45,163,237,193,169,104,55,221,220,23,167,143,22,42,202,191,43,146,220,15,143,101,104,87,54,166,197,42,141,223,25,255,155,227,23,134,105,206,249,218,178,182,198,164,162,214,42,60,145,136,249,254,41,53,213,109,16,166,176,
+38,25,249,174,88,63,119,103,248,121,119,27,72,62,202,208,54,122,34,221,116,64,81,177,4,179,238,218,119,119,209,127,220,154,105,91,208,162,131,231,112,111,111,92,59,67,156,227,42,255,11,252,229,150,180,22,151,88,101,115,34,76,51,133,154,47,174,233,182,
+120,72,251,121,100,112,114,169,74,7,243,205,139,43,186,97,43,240,248,68,206,55,62,180,248,57,242,18,111,0,12,142,242,3,200,36,139,34,227,51,252,2,22,252,71,199,50,90,134,202,8,200,28,194,198,3,1,27,163,158,27,5,196,186,70,68,218,190,24,249,232,207,97,
+59,35,254,245,224,239,226,61,61,18,252,5,59,161,85,243,91,172,26,194,65,50,104,147,170,25,166,29,95,28,233,209,170,222,140,180,219,161,210,226,145,241,172,150,36,87,5,18,146,240,179,55,11,126,30,76,104,87,9,98,145,135,198,210,45,171,154,26,113,91,252,
+130,235,12,91,143,97,222,143,25,7,193,254,140,174,33,179,192,122,6,131,164,85,128,100,144,217,78,82,60,239,251,21,197,72,140,49,182,74,26,212,111,100,208,57,35,31,253,172,98,166,2,20,113,1,246,104,60,195,204,234,90,38,163,130,246,6,137,197,164,78,242,
+138,68,127,123,116,225,181,34,180,116,243,35,223,244,220,213,233,64,255,90,229,152,40,90,53,151,15,6,13,160,77,83,180,237,158,214,42,95,184,170,216,154,56,165,195,149,217,206,112,251,64,210,114,229,199,122,14,176,245,132,107,64,69,191,149,192,1,130,255,
+104,52,76,239,40,240,44,67,150,22,130,198,160,137,64,31,222,133,255,52,177,160,188,194,144,97,48,8,245,51,35,41,186,99,115,146,246,13,38,46,188,110,235,143,211,229,201,40,45,85,235,90,53,157,106,208,50,104,182,245,22,85,177,151,103,98,244,246,124,89,
+73,7,193,223,140,103,180,65,57,86,192,251,122,145,92,42,216,223,193,182,55,21,165,123,44,8,218,136,95,156,170,198,129,48,252,208,214,20,221,185,57,73,123,251,227,90,69,57,254,47,238,77,36,130,19,43,228,139,238,63,198,91,188,58,87,166,221,77,186,27,90,
+129,4,240,255,60,150,83,50,47,4,103,149,191,222,102,109,248,25,222,163,42,70,98,58,115,215,38,121,103,152,72,125,133,215,74,197,88,61,171,0,216,66,125,180,168,190,227,200,109,220,49,184,218,189,45,10,42,146,223,154,45,41,137,9,237,4,247,195,72,164,91,
+248,154,64,235,124,174,77,151,129,47,211,241,47,206,149,180,205,88,148,151,124,210,158,113,85,74,204,71,171,145,245,198,235,65,228,158,193,132,37,145,88,7,222,133,12,195,136,129,236,178,209,138,254,102,224,189,170,50,245,24,46,249,155,201,188,161,125,
+233,248,98,133,254,225,200,124,160,7,79,50,234,129,101,194,223,239,234,167,93,189,177,166,21,187,16,14,112,208,129,175,238,151,45,136,140,34,224,57,197,48,18,43,224,103,249,140,132,68,121,39,208,26,44,234,71,110,245,103,52,3,196,163,187,44,204,170,208,
+185,87,224,189,86,64,146,237,111,119,246,106,131,65,91,137,113,248,239,248,243,191,251,68,31,87,25,51,202,249,238,196,2,189,60,93,104,187,191,175,172,144,214,93,132,129,200,170,246,246,125,125,157,91,220,219,129,24,73,101,71,6,211,154,242,178,188,123,
+102,129,99,75,165,136,158,85,240,12,239,147,96,157,232,117,54,197,228,84,213,147,102,219,32,239,179,156,228,23,29,246,157,78,224,189,207,158,201,183,253,91,190,140,168,96,254,141,193,124,34,188,117,174,232,232,48,20,153,108,149,40,134,108,242,201,195,
+101,21,28,178,68,15,115,104,235,98,11,10,134,17,3,3,36,221,240,25,70,193,196,101,28,18,33,24,67,12,70,213,48,54,105,109,104,212,82,141,222,153,41,210,127,253,96,150,126,56,217,126,211,102,24,217,160,138,24,150,9,70,219,82,49,196,233,235,59,178,202,126,
+15,183,14,136,29,146,46,203,198,180,206,42,59,193,144,32,81,32,198,223,32,56,32,171,19,159,202,54,79,4,24,69,101,252,2,209,247,43,59,178,134,171,53,241,115,225,239,179,88,204,168,230,95,231,74,218,254,254,212,241,5,109,47,199,158,142,23,196,97,236,249,
+255,237,208,172,150,48,86,201,46,9,150,107,123,248,172,226,10,38,37,118,154,188,193,85,226,74,145,97,117,128,24,38,232,86,48,34,5,122,235,25,151,228,237,235,52,208,59,159,58,177,96,73,44,198,123,240,222,51,29,58,196,124,171,250,189,149,175,80,124,106,
+201,180,55,19,173,77,155,84,53,25,95,5,81,137,139,139,204,207,242,34,159,146,20,52,93,153,137,241,36,113,133,28,205,87,164,77,7,101,220,193,184,132,238,134,213,207,80,123,120,67,144,206,129,58,227,22,32,76,90,17,20,80,61,251,216,37,25,219,125,180,33,
+240,202,88,187,175,207,196,108,141,235,250,37,29,98,174,200,68,109,93,31,174,144,16,195,160,21,86,69,252,2,209,215,108,219,60,254,62,222,247,173,195,115,182,125,47,134,105,133,54,151,64,27,12,239,236,25,18,162,146,17,255,241,78,12,74,172,226,99,172,115,
+112,177,162,117,77,136,82,103,59,51,229,136,84,19,55,178,39,173,102,223,101,188,5,102,179,65,240,125,96,36,101,88,76,199,44,183,103,78,45,26,154,79,231,235,29,0,15,212,92,117,89,107,149,51,178,97,66,93,127,115,166,168,101,134,25,166,25,178,170,179,89,
+180,84,139,172,32,203,202,224,18,198,30,68,170,226,116,100,124,6,195,152,1,7,248,198,182,183,98,125,217,209,97,194,119,12,91,183,18,192,62,6,203,133,85,97,196,30,70,37,9,21,163,216,187,61,80,0,16,235,182,183,26,86,70,85,142,172,131,111,59,144,132,176,
+226,173,74,107,98,177,138,36,70,43,144,220,232,143,132,46,84,45,77,20,107,116,188,84,211,170,127,24,70,5,178,90,171,249,172,226,14,206,172,117,160,137,198,172,231,138,124,134,81,137,76,123,187,108,192,59,101,100,220,255,58,57,159,217,175,224,12,241,248,
+68,142,238,31,72,104,133,31,173,52,79,8,196,232,114,129,69,175,209,120,196,247,59,0,236,35,142,31,203,105,149,160,168,164,104,22,36,227,194,77,44,86,180,9,130,157,74,176,189,200,66,173,78,195,146,126,213,149,128,7,186,50,43,170,113,152,240,227,253,230,
+70,16,100,65,228,21,245,144,124,111,142,179,185,12,195,152,7,7,6,88,40,52,59,120,35,0,158,200,87,232,69,180,44,43,220,19,238,20,244,176,4,159,30,233,161,67,71,237,155,224,63,196,30,153,210,240,210,244,116,81,129,202,9,129,11,67,2,111,110,50,195,98,239,
+218,255,61,177,88,165,3,51,5,71,19,67,12,195,120,19,20,178,137,22,188,60,59,197,214,102,94,197,43,201,110,187,152,45,213,165,237,235,115,62,213,94,208,53,135,23,188,229,183,196,195,23,146,11,229,229,21,58,90,168,90,138,61,2,145,42,132,106,142,42,97,188,
+214,87,243,204,86,235,190,23,235,102,74,117,186,76,146,157,224,41,159,248,54,187,1,84,156,176,80,172,142,39,79,44,210,99,59,123,45,255,123,240,148,229,110,3,134,97,204,128,152,227,11,35,169,182,85,152,16,107,225,65,7,43,148,223,157,45,40,107,47,220,221,
+39,110,67,32,154,124,99,152,245,220,41,193,211,145,214,62,71,197,158,109,228,25,167,181,74,236,135,211,89,109,6,138,159,236,237,24,247,129,78,21,25,228,249,140,226,26,176,150,97,207,182,186,231,162,146,144,135,36,123,151,160,23,234,201,178,144,68,97,
+134,95,102,144,181,2,130,176,172,132,116,224,234,216,33,26,227,6,209,95,65,16,234,14,230,229,249,221,201,252,172,160,131,86,68,70,29,8,144,48,100,196,10,240,245,250,209,132,51,109,172,76,115,68,38,189,234,200,248,12,134,105,5,4,164,71,199,50,134,91,245,
+33,24,99,174,130,170,97,97,177,144,156,16,208,206,1,108,94,105,17,204,87,229,4,229,71,109,140,177,188,114,56,218,33,193,127,94,230,231,180,195,236,51,14,246,110,74,208,23,45,204,79,97,24,163,64,36,144,17,223,160,138,143,113,15,40,120,177,226,51,140,142,
+74,213,195,20,25,121,9,27,112,46,224,154,129,44,253,233,189,89,46,248,50,3,143,6,14,0,16,195,15,75,168,80,194,103,4,189,2,22,54,30,50,64,0,199,126,117,234,249,249,76,81,203,170,155,1,65,217,247,143,230,56,19,239,50,38,36,4,13,50,62,131,97,90,241,153,
+161,164,37,79,88,136,197,42,108,2,100,249,189,101,108,244,206,59,45,233,112,52,83,182,247,144,245,65,78,206,90,98,119,5,172,140,10,193,57,22,143,46,112,79,19,171,9,35,160,131,96,175,2,33,155,9,46,50,226,155,35,28,35,185,10,156,67,48,168,115,214,196,190,
+136,51,207,119,108,180,135,98,90,35,43,97,3,166,3,110,89,4,253,9,221,56,34,224,119,241,34,119,6,155,130,133,226,128,240,139,233,130,208,98,165,61,92,22,171,49,253,196,169,130,156,195,38,11,84,206,129,172,250,83,199,23,12,61,15,103,150,106,90,80,198,34,
+177,251,120,79,130,48,35,227,51,24,166,25,16,122,47,19,168,12,190,151,43,14,53,112,208,146,33,110,30,202,219,91,77,11,129,87,116,162,60,246,27,187,193,60,14,81,222,231,201,235,26,152,51,113,117,191,117,155,140,187,248,25,103,108,68,52,190,193,186,171,
+202,6,137,49,199,119,39,22,232,55,147,249,150,3,182,87,86,72,19,147,113,214,113,170,146,24,62,169,232,142,194,128,45,188,240,191,183,7,112,230,128,140,243,62,206,171,111,177,110,160,89,54,137,36,170,159,157,204,115,145,158,73,120,156,105,64,192,131,129,
+7,228,161,177,180,165,31,248,249,169,165,192,87,19,3,4,77,183,109,78,10,87,98,5,73,160,66,107,38,134,73,162,13,180,209,95,8,65,232,233,66,85,187,22,170,91,98,49,165,255,219,31,206,105,19,251,111,234,143,83,127,44,116,161,13,27,45,196,231,74,117,58,128,
+193,82,44,16,95,4,90,204,111,28,136,83,42,242,113,176,87,95,89,161,179,197,26,189,54,91,210,174,171,42,112,207,220,176,88,181,60,129,31,131,133,252,238,83,197,56,199,13,130,62,171,152,90,140,138,67,59,15,7,178,166,72,159,178,185,37,242,245,153,162,86,
+101,109,21,8,176,42,158,245,127,153,90,162,251,70,83,150,222,11,145,249,123,39,237,183,55,194,208,102,36,48,172,254,222,113,207,188,106,179,120,84,94,150,179,239,202,250,156,86,236,27,76,8,189,31,191,3,136,39,44,198,49,118,128,53,111,215,108,201,114,
+50,227,192,116,65,249,239,101,255,112,15,109,79,71,55,172,79,88,119,166,10,85,250,237,116,129,227,242,53,222,88,172,104,47,90,139,205,245,206,30,236,199,42,99,241,245,96,77,187,113,48,161,197,48,205,192,217,15,123,122,80,214,61,20,217,137,20,13,16,219,
+37,92,196,15,78,44,104,118,79,102,58,121,176,126,96,254,7,159,249,204,163,76,40,198,34,118,69,38,74,177,238,213,133,35,87,173,211,177,165,234,133,69,142,177,31,60,32,197,99,57,218,63,150,49,124,72,192,195,5,129,153,31,174,143,193,98,227,133,67,171,27,
+64,22,121,119,127,243,201,250,8,34,176,121,226,117,235,82,141,158,61,147,87,158,140,64,48,117,104,146,167,0,119,2,235,247,29,195,61,45,214,141,46,218,150,142,106,47,84,48,252,244,84,94,89,32,255,244,84,158,30,141,152,11,24,104,173,117,250,105,158,254,
+236,43,154,37,125,224,175,56,93,172,106,150,51,170,177,154,192,104,100,44,25,182,85,40,70,82,172,63,36,30,6,218,125,40,197,129,242,202,76,204,242,32,147,231,207,170,169,168,66,60,187,125,190,76,187,122,205,31,10,127,122,114,209,150,239,180,30,236,177,
+34,211,243,17,255,216,93,145,243,254,66,69,219,79,100,124,142,157,108,145,96,15,179,51,21,85,46,152,96,173,188,125,48,73,253,235,246,205,89,45,65,94,112,84,100,98,228,242,179,179,5,26,77,70,76,199,72,104,241,86,89,193,136,193,147,55,111,78,82,87,139,
+163,41,98,79,172,9,143,165,163,218,172,17,39,246,116,55,227,6,45,197,232,80,79,156,253,52,123,173,76,140,126,60,185,232,251,10,79,221,50,1,222,244,86,192,121,133,237,18,62,6,247,203,227,19,57,77,95,48,114,77,161,185,32,6,148,53,220,45,104,132,6,254,236,
+43,223,180,235,103,30,14,119,211,191,31,77,211,253,35,61,244,137,76,148,122,99,33,74,69,187,181,215,96,60,76,59,51,81,186,125,32,161,181,111,29,180,185,45,144,89,101,190,190,66,111,207,151,105,32,220,77,3,241,246,135,46,120,18,255,232,228,34,157,110,
+209,218,18,84,78,150,235,52,18,233,124,253,154,129,76,234,255,60,177,64,213,0,116,62,96,88,11,68,226,80,119,231,164,4,214,132,221,217,24,157,94,170,106,247,40,227,30,80,225,241,169,205,73,67,191,199,68,184,155,246,244,198,168,84,89,86,178,110,224,57,
+58,184,80,161,203,123,162,218,191,109,4,4,93,200,72,115,251,145,63,128,232,241,55,219,179,116,77,95,92,139,49,32,18,227,94,197,11,235,202,112,50,162,197,25,189,93,68,135,36,89,7,117,2,237,149,215,8,86,20,3,20,68,254,126,193,62,17,41,211,213,69,151,164,
+196,196,46,180,190,190,58,103,191,208,117,40,111,238,57,215,121,97,106,137,222,93,82,23,95,34,150,237,69,252,107,80,68,68,37,241,211,39,22,149,138,115,199,74,53,75,49,204,31,103,75,244,91,5,149,77,216,59,240,204,182,18,141,140,128,214,235,39,79,219,155,
+12,188,219,162,216,222,72,177,182,98,235,51,222,8,206,100,127,51,158,161,235,7,18,218,218,168,175,147,141,235,229,85,189,49,186,62,19,165,137,197,42,229,121,143,244,5,136,145,140,156,249,72,183,25,156,46,208,11,10,133,41,196,152,215,13,26,127,222,177,
+182,226,94,102,221,192,61,232,67,61,205,36,115,177,222,96,79,199,253,233,247,51,241,135,69,107,123,46,158,199,103,38,23,233,44,87,209,111,0,215,20,58,85,185,186,76,145,174,213,253,75,7,90,11,44,63,254,191,179,69,122,238,124,145,117,5,1,108,19,138,81,
+129,182,127,91,134,210,209,238,182,139,63,254,12,162,241,109,253,113,58,91,168,209,121,126,24,108,71,19,87,242,85,122,107,182,68,197,202,178,86,69,208,77,93,218,131,117,40,87,166,15,22,42,244,179,169,37,250,195,162,255,23,111,171,224,250,153,93,244,33,
+80,61,123,58,31,136,5,31,34,177,217,86,27,28,84,46,207,196,232,163,197,10,31,80,92,2,214,113,136,196,102,232,238,234,162,237,169,8,125,152,83,243,123,196,26,245,250,124,153,82,43,171,123,73,43,65,27,1,215,219,231,75,244,191,166,242,188,174,249,132,207,
+14,38,232,206,45,169,142,73,12,196,25,56,92,66,0,81,33,106,110,137,133,233,74,193,86,67,90,11,118,237,20,145,32,24,222,220,103,44,153,215,138,127,62,149,87,18,183,233,73,161,209,104,152,178,6,124,14,181,3,214,169,60,253,222,1,95,63,36,36,14,207,151,105,
+52,22,190,232,240,210,8,4,98,172,145,255,247,241,5,71,226,94,196,48,145,250,138,161,68,129,46,30,169,16,137,117,122,187,140,139,237,205,192,1,210,110,33,73,212,122,130,20,60,227,58,250,153,44,102,32,209,130,100,219,222,254,56,21,203,117,46,20,241,1,250,
+153,111,166,80,163,84,119,119,211,245,19,207,56,98,239,127,62,157,167,247,21,37,84,105,173,146,248,58,11,207,17,98,189,94,82,151,252,101,218,243,153,77,73,75,93,32,72,252,98,79,127,39,0,221,229,120,6,113,78,217,210,99,108,95,67,37,236,255,56,190,192,
+34,113,27,112,198,68,28,139,61,20,118,145,250,235,213,185,146,118,189,207,177,101,170,48,93,159,248,47,191,147,126,100,70,64,98,213,167,13,230,236,108,71,193,120,5,4,57,159,28,76,116,180,242,208,42,113,102,138,129,168,98,196,16,39,171,94,216,180,182,
+57,170,240,106,100,218,163,85,31,93,218,107,185,170,11,149,134,78,76,90,134,175,235,208,186,131,16,166,5,243,32,8,127,97,53,206,80,113,95,138,174,129,58,42,214,66,84,100,67,64,178,194,241,197,10,253,208,1,235,30,92,95,120,64,55,107,113,213,18,222,243,
+101,173,85,211,45,251,109,163,127,36,185,192,67,178,17,116,244,65,240,28,79,109,244,5,213,170,114,22,43,154,175,177,19,51,42,190,190,35,75,233,168,249,225,71,197,218,50,253,195,145,121,91,190,83,35,255,199,229,253,194,159,161,226,25,199,94,254,216,206,
+94,75,239,197,48,44,182,162,240,31,87,54,36,97,138,245,101,199,218,178,255,126,87,191,229,24,19,93,3,255,253,163,121,246,44,118,24,25,241,206,79,79,44,6,198,146,81,223,115,91,21,83,161,168,236,15,115,37,246,174,103,92,129,116,143,98,28,58,172,138,196,
+224,222,45,41,58,201,11,63,227,17,48,233,28,131,93,246,164,163,180,53,25,166,76,248,226,67,205,209,124,133,14,230,43,129,26,4,120,235,128,88,149,13,90,151,16,120,176,47,182,179,220,51,212,218,47,206,8,56,224,99,63,80,125,200,212,4,97,182,31,246,53,16,
+62,16,43,88,1,247,37,42,145,237,244,56,196,218,245,144,132,207,169,40,16,58,241,124,34,65,111,54,110,131,224,238,132,72,76,107,215,87,223,31,26,5,143,217,106,221,149,123,173,155,139,31,112,189,126,50,5,15,231,37,237,0,219,191,54,168,212,13,215,242,201,
+19,139,244,200,246,172,169,193,123,168,140,252,209,132,154,68,179,140,97,144,42,158,241,135,199,173,37,130,192,231,182,166,181,193,191,140,191,112,67,124,13,203,9,145,24,19,239,189,125,48,65,79,157,81,227,65,207,52,103,119,86,220,79,30,159,17,148,51,
+223,133,61,119,106,233,162,248,5,28,47,213,216,22,143,113,21,210,133,98,4,21,34,96,225,127,104,107,138,190,171,40,208,99,24,81,176,168,107,153,63,206,254,105,7,77,171,3,135,26,217,149,98,161,216,105,182,26,108,143,106,199,93,67,73,58,196,107,57,35,153,
+7,71,82,66,7,204,107,6,236,21,138,105,173,42,196,236,0,161,245,28,81,84,5,175,9,153,147,121,186,123,164,199,144,13,5,42,118,221,114,56,231,125,66,30,56,192,186,73,104,71,193,8,68,202,199,46,49,230,125,169,186,27,9,30,136,162,211,236,237,126,198,81,205,
+110,214,215,187,17,8,225,232,156,251,87,30,166,196,72,102,76,208,31,31,108,135,221,1,11,197,142,130,110,20,81,86,63,35,120,191,71,142,95,24,183,35,85,40,70,48,33,154,93,7,253,241,176,35,149,104,12,195,136,113,169,132,41,224,96,84,210,231,48,214,17,241,
+45,213,73,69,196,132,50,134,105,198,80,82,44,116,129,200,12,1,197,206,74,79,180,14,98,178,183,85,52,79,109,133,149,168,184,22,120,161,202,11,7,248,245,226,18,190,207,84,161,74,191,157,46,112,199,23,163,20,136,191,56,19,220,212,31,167,145,100,228,162,
+115,134,126,95,190,54,91,82,126,102,120,47,39,38,20,171,120,198,111,28,16,31,170,121,121,54,202,66,49,35,157,120,200,122,2,67,71,134,230,192,88,7,197,65,50,126,7,248,12,12,1,118,202,2,133,89,229,206,117,67,152,15,46,86,56,222,51,9,174,225,142,134,228,
+73,121,121,153,222,95,168,120,214,86,87,170,80,188,187,79,124,120,139,14,2,194,67,14,181,53,218,9,14,97,91,146,97,74,134,187,47,8,49,8,22,203,245,101,58,186,80,177,189,202,201,47,232,215,49,182,46,208,112,234,192,192,172,146,21,168,92,105,68,180,18,143,
+17,99,125,176,96,21,14,226,25,217,64,48,18,169,38,214,217,211,27,183,53,112,67,151,201,141,131,9,74,69,172,173,137,239,205,58,227,177,203,109,188,140,27,65,76,231,182,51,1,170,193,110,88,172,54,245,202,54,194,155,10,230,86,200,72,214,114,194,151,177,
+3,25,251,56,227,44,253,18,215,134,132,118,158,103,161,88,53,136,169,63,61,210,211,116,30,192,45,67,73,77,163,122,127,174,196,250,84,27,96,135,7,55,4,20,186,54,3,131,30,239,93,89,29,178,235,181,24,91,170,80,156,148,36,18,129,205,9,233,174,24,142,2,79,
+68,180,187,54,219,24,33,166,68,67,33,186,118,48,65,87,247,199,233,181,115,69,206,222,183,160,221,117,164,181,135,17,47,248,39,194,223,142,51,97,12,195,48,114,104,244,48,117,202,75,109,107,139,64,204,44,22,102,100,153,230,153,83,139,180,127,44,99,58,97,
+130,22,250,95,157,231,160,156,97,220,206,211,83,121,122,52,146,49,157,220,198,129,81,69,156,31,145,208,25,228,84,194,87,223,111,70,98,33,154,175,46,83,113,121,133,91,181,25,134,97,36,97,196,214,9,235,63,244,169,43,250,226,244,196,177,28,235,42,235,64,
+97,21,4,245,78,64,183,218,213,27,163,191,75,71,61,117,29,165,170,177,50,90,149,47,124,150,143,82,141,95,29,207,180,204,50,172,7,215,16,55,220,64,44,196,149,61,235,48,51,1,27,127,15,83,158,49,164,199,171,229,254,65,38,31,160,225,127,110,4,83,249,101,128,
+76,52,227,109,112,88,191,185,47,78,227,233,232,134,234,88,60,167,240,171,125,113,206,153,234,87,17,68,124,59,141,130,54,202,167,78,44,152,18,139,33,18,255,120,114,209,246,239,198,48,140,56,88,247,126,112,98,129,30,29,51,46,22,67,36,94,29,32,104,63,94,
+60,74,237,77,69,233,250,190,120,83,1,227,161,181,235,247,226,76,49,80,67,162,253,200,202,10,87,21,123,29,89,131,123,105,173,248,128,81,135,25,77,133,214,4,227,175,236,200,210,247,143,178,88,172,131,226,69,136,232,102,240,218,117,180,255,164,20,112,144,
+173,49,42,18,55,130,172,3,236,21,152,85,32,182,155,89,208,116,48,201,125,151,207,170,211,221,204,132,36,203,143,217,18,183,31,57,137,44,235,22,88,234,48,222,229,214,108,140,30,25,207,106,157,46,205,44,20,240,223,246,110,74,208,215,46,237,213,14,247,94,
+34,87,86,115,111,66,44,126,252,163,121,77,220,104,7,146,42,47,79,23,52,63,86,158,122,205,48,222,1,207,235,227,19,57,122,235,92,177,109,114,20,137,181,95,157,202,43,19,137,73,82,178,182,174,104,61,234,233,238,162,47,142,244,208,253,91,83,109,171,220,46,
+91,219,151,110,21,28,36,200,56,75,190,42,30,231,23,89,176,114,156,57,9,231,53,124,6,199,61,234,128,54,101,69,83,65,49,227,35,219,179,222,253,193,37,2,109,201,172,72,172,227,165,235,200,10,154,141,220,217,34,35,110,20,136,197,187,114,229,192,251,237,226,
+58,90,17,219,117,62,183,53,173,77,206,102,236,7,217,229,7,235,43,194,173,138,170,166,253,51,173,129,125,139,149,64,162,145,211,5,174,16,240,42,159,223,156,212,4,98,35,224,121,199,225,62,62,181,164,121,243,218,9,218,181,141,180,121,117,34,39,225,144,106,
+20,28,128,32,14,13,207,20,233,170,84,148,6,227,33,202,132,87,159,173,201,66,149,166,203,117,122,139,215,60,134,241,52,176,139,193,235,202,100,132,198,27,10,20,202,203,43,116,180,80,117,100,80,19,196,184,254,144,216,81,175,160,72,140,51,83,149,141,61,
+71,31,22,106,247,158,195,216,195,123,115,101,225,189,252,68,158,173,72,156,230,253,92,153,110,137,139,253,30,223,231,103,88,25,16,56,69,180,41,172,189,40,100,12,122,215,251,131,163,41,161,247,123,229,58,74,21,138,145,117,150,101,63,81,95,241,126,102,
+233,147,22,51,13,141,192,96,252,208,209,156,204,175,229,57,110,218,36,118,29,241,48,66,108,102,223,103,53,96,8,211,94,129,223,153,234,105,255,76,115,126,61,181,68,251,183,101,44,95,29,44,225,65,15,36,188,10,170,131,141,138,196,141,224,224,126,186,84,
+179,93,16,65,21,145,168,117,196,1,7,6,115,160,85,250,12,239,67,12,227,107,144,48,119,139,151,238,7,185,10,221,34,232,235,142,65,219,118,131,196,164,149,33,198,170,246,28,70,62,56,147,225,156,108,181,176,132,99,76,119,240,106,174,76,215,180,232,58,51,
+2,58,45,94,101,161,88,25,159,30,17,239,86,71,87,7,5,248,217,131,216,46,195,190,206,11,215,81,170,245,68,174,34,111,163,62,235,241,42,218,27,210,81,41,3,32,80,209,23,100,235,4,92,71,25,201,135,235,6,204,139,30,140,53,224,87,42,226,49,252,252,212,18,183,
+32,185,0,116,50,204,10,120,134,189,114,182,224,163,171,17,28,208,254,123,151,64,32,121,215,102,251,45,147,254,112,94,76,108,69,181,60,123,172,49,12,227,119,32,198,137,216,79,160,0,200,238,105,247,240,193,183,146,152,212,81,177,231,48,246,240,130,128,
+72,242,220,233,60,255,86,92,0,206,107,207,9,216,233,60,199,103,62,165,136,118,138,210,154,247,61,244,153,160,114,147,192,126,229,181,235,40,85,40,126,93,240,240,214,200,111,167,189,45,50,236,233,149,39,76,234,213,74,198,0,0,32,0,73,68,65,84,94,27,96,
+31,46,89,215,81,197,224,34,102,21,108,248,152,246,111,229,112,2,31,79,110,193,94,21,235,208,190,170,191,156,226,187,19,11,154,168,102,22,12,56,227,10,126,111,178,71,48,201,137,150,182,237,49,241,64,180,29,184,183,68,146,24,79,158,224,97,113,12,195,4,
+3,17,49,238,95,20,248,41,99,88,170,8,42,246,28,198,30,48,108,28,67,199,205,130,24,211,137,65,229,136,205,209,113,117,255,64,226,194,11,94,217,195,22,171,105,253,2,58,40,94,176,176,86,224,61,110,233,190,8,2,50,69,201,43,50,193,21,138,55,75,44,224,220,
+222,227,220,25,223,8,82,75,85,177,104,223,33,193,159,20,83,191,189,94,237,147,141,201,219,52,178,145,224,6,64,50,175,35,42,179,131,238,247,172,10,125,218,255,3,35,41,195,237,132,24,4,3,127,191,32,3,139,148,43,178,177,13,215,12,83,133,79,44,86,233,141,
+185,146,242,160,234,59,71,115,218,48,73,163,62,225,8,224,185,29,208,187,236,148,48,148,110,79,54,70,199,108,174,40,255,233,169,188,54,57,216,108,199,9,14,165,92,77,204,48,76,80,208,4,181,201,188,54,220,217,12,170,196,184,81,9,201,240,43,82,81,58,86,14,
+118,252,232,85,244,251,243,142,225,158,142,250,1,42,220,145,188,80,45,18,67,32,254,204,80,114,181,85,188,9,119,172,197,232,207,157,93,210,44,166,130,8,188,194,97,3,99,228,220,135,225,117,191,156,202,179,101,140,98,50,18,139,230,98,221,193,77,142,132,
+186,228,216,236,146,7,52,62,233,158,6,168,36,20,241,181,196,38,240,236,148,247,219,73,100,222,68,65,70,230,117,220,26,103,161,88,37,8,0,126,112,98,129,246,245,197,181,193,140,173,252,171,16,92,29,152,41,4,58,96,64,53,12,134,46,182,243,248,26,75,71,180,
+215,13,139,85,122,122,42,175,180,85,11,149,197,16,177,119,247,197,154,182,45,193,43,110,174,92,211,196,59,22,225,188,205,112,82,60,44,24,140,217,111,151,132,251,236,91,135,231,12,39,49,156,58,96,50,12,195,56,141,46,198,221,61,210,211,49,185,166,122,173,
+180,226,77,188,158,116,148,187,6,189,12,238,53,188,244,56,51,25,238,190,112,159,226,126,196,64,69,120,101,219,109,131,210,12,196,231,251,199,50,29,69,108,196,231,143,165,123,181,42,217,160,14,88,196,57,238,241,137,156,86,117,189,51,29,161,77,177,240,
+133,231,27,226,240,185,114,141,142,44,86,185,115,148,97,60,130,244,211,28,132,184,223,88,200,92,235,252,244,228,34,11,13,204,5,86,135,26,202,17,139,23,248,190,82,14,196,76,125,18,56,130,173,45,241,48,101,215,50,154,19,197,26,29,47,213,2,239,77,101,52,
+8,213,65,48,250,104,36,163,137,240,42,175,29,218,253,117,59,9,180,47,233,153,233,83,165,26,39,96,124,132,12,111,125,149,116,74,98,224,144,121,100,161,194,85,238,12,195,4,26,93,140,251,236,96,130,46,235,141,81,60,212,77,141,181,24,24,18,122,34,95,245,
+228,90,153,9,179,245,132,31,104,140,51,221,128,217,248,156,214,6,44,210,90,133,109,80,129,16,204,98,176,251,96,29,196,125,148,151,221,253,59,177,165,236,199,76,230,90,7,126,166,79,28,203,249,70,36,206,87,235,212,31,10,238,16,58,89,228,202,226,211,237,
+117,130,82,73,6,139,13,24,173,55,182,133,228,170,117,122,39,87,118,84,208,67,166,153,219,140,46,6,237,108,102,131,80,90,171,192,249,210,104,154,190,119,114,193,254,47,217,4,174,202,100,220,68,227,225,18,235,223,214,181,10,99,246,201,102,24,134,185,24,
+173,42,211,129,202,76,59,89,168,113,108,201,200,5,241,57,58,253,172,36,207,33,22,127,84,168,6,214,134,194,141,180,42,40,208,59,34,159,159,46,248,190,232,5,103,183,251,36,125,214,209,0,39,2,102,75,117,205,27,95,6,239,47,184,251,58,218,166,100,234,153,
+235,253,195,61,154,167,79,43,7,1,191,86,251,156,43,213,13,123,122,118,34,200,15,35,126,118,25,15,99,49,0,89,52,108,130,159,28,76,52,13,106,134,41,172,217,63,96,48,217,175,167,150,184,2,212,37,192,243,204,106,5,39,158,11,12,209,8,114,213,130,95,192,62,
+57,150,138,104,86,59,184,31,144,56,69,55,5,170,187,14,204,20,149,38,80,49,35,64,116,205,117,242,208,142,181,141,215,55,134,97,24,111,128,150,116,81,251,137,153,146,218,61,71,223,179,215,23,178,224,76,123,174,88,215,44,20,185,59,214,219,192,54,175,157,
+29,92,39,238,221,220,67,79,76,242,224,92,167,25,14,119,211,35,219,179,45,207,90,208,167,160,215,192,54,21,67,146,209,165,230,103,160,3,52,235,190,51,75,144,11,49,222,158,47,209,125,61,214,156,19,26,65,146,194,237,133,87,182,151,188,106,2,240,153,165,
+11,85,62,59,82,81,173,204,122,178,80,243,117,203,50,14,247,16,230,68,193,77,20,228,135,17,63,251,205,155,147,45,19,13,70,129,224,226,103,30,187,36,99,72,220,193,230,128,205,144,7,142,57,15,170,21,90,13,198,48,202,117,125,113,22,138,61,12,90,128,175,25,
+72,108,88,223,86,3,218,46,109,15,193,235,248,98,133,126,104,97,50,184,21,102,202,226,66,241,169,2,11,181,12,195,48,76,103,38,11,85,97,161,248,160,162,130,26,156,101,219,85,153,162,139,22,251,231,99,59,123,57,206,246,56,162,103,120,216,196,13,71,186,185,
+170,216,65,96,147,103,198,10,21,130,241,55,46,235,163,239,31,245,79,135,251,122,222,155,43,211,45,67,73,161,207,64,65,73,144,129,184,123,71,125,69,216,170,111,218,3,103,37,101,238,255,16,132,33,250,161,85,26,7,94,252,111,63,87,253,96,129,145,241,32,29,
+102,17,136,222,61,47,214,34,135,12,191,159,131,53,12,115,50,43,236,32,0,66,69,4,227,28,123,210,81,225,127,27,135,171,30,131,246,62,140,187,192,115,123,237,224,70,145,184,25,219,210,81,250,250,142,172,146,239,255,138,96,98,18,213,208,111,179,53,9,195,
+48,12,99,0,209,61,7,103,45,21,98,28,68,39,20,90,24,21,7,16,103,127,217,226,188,30,198,89,224,77,44,82,77,172,115,105,50,194,191,73,135,64,37,241,189,91,204,63,127,72,246,60,60,158,241,201,85,216,8,244,55,84,78,91,5,154,138,83,182,135,110,226,5,65,93,
+9,215,17,157,39,110,135,199,196,218,8,110,128,186,192,176,41,28,184,57,27,189,234,167,134,86,9,171,96,122,179,95,65,69,162,85,139,19,173,90,49,193,62,218,78,145,149,228,189,189,77,146,197,13,163,14,28,30,205,62,183,232,6,248,170,130,224,21,7,238,63,206,
+90,63,184,191,57,83,12,252,128,74,134,97,24,198,24,216,115,222,58,103,173,32,4,231,164,231,207,218,31,227,91,21,157,144,228,69,156,206,120,139,68,72,78,124,46,43,206,103,204,243,208,214,148,229,110,100,88,202,248,249,185,133,189,134,85,125,202,207,154,
+138,25,80,85,140,174,17,171,224,58,122,161,106,157,87,48,27,193,13,96,245,129,194,3,140,225,126,204,42,223,57,154,179,36,22,255,102,50,239,235,193,91,104,91,23,225,211,35,92,85,204,48,42,65,114,102,155,197,106,114,136,203,240,34,183,155,223,206,20,53,
+223,72,179,160,3,134,7,200,49,12,195,48,102,248,213,249,162,165,14,202,223,157,45,40,25,146,44,34,58,161,115,104,152,5,67,134,81,6,226,108,209,57,81,162,231,107,183,243,125,147,186,10,116,41,191,107,42,102,65,49,167,89,177,24,150,178,94,186,142,188,115,
+217,12,110,132,167,142,155,203,220,32,67,238,103,127,28,171,64,44,54,106,231,161,85,99,31,95,240,245,130,246,89,131,109,235,237,64,149,34,7,176,12,163,14,209,228,204,117,3,246,11,197,168,8,254,193,137,5,83,246,73,56,228,255,132,43,13,24,134,97,24,11,
+96,255,48,218,205,130,24,255,87,167,242,74,102,52,32,70,22,21,157,110,231,170,98,134,81,198,77,253,226,113,50,206,215,55,72,176,8,116,43,208,152,160,171,188,60,93,208,214,211,86,64,216,132,24,250,173,195,115,44,18,55,1,98,49,132,223,118,215,80,7,150,
+31,255,253,163,121,79,93,71,238,89,86,0,188,152,241,128,193,19,22,195,171,90,137,123,16,147,143,44,84,216,110,162,13,240,197,65,208,118,207,80,146,70,146,145,139,188,194,176,152,229,171,117,205,168,61,8,85,109,151,164,228,120,95,33,128,229,123,206,187,
+20,235,156,80,242,18,162,211,134,209,18,135,53,208,238,68,226,210,154,15,217,173,217,24,221,56,152,104,233,215,151,175,46,211,129,233,2,189,165,104,152,16,195,48,12,227,79,126,118,182,64,135,242,85,186,161,47,174,13,3,91,15,14,227,239,205,150,232,197,
+185,146,50,139,163,27,37,12,38,31,147,20,175,51,106,152,173,202,169,82,159,86,80,237,206,108,100,179,36,91,197,43,50,81,223,139,163,208,75,240,66,21,246,174,158,8,13,37,86,215,170,92,181,78,199,150,170,44,14,27,0,215,8,47,36,22,246,244,198,41,27,235,
+166,208,154,216,87,174,47,211,233,66,141,14,204,20,61,89,0,202,66,177,66,52,49,238,204,210,134,135,241,104,190,66,167,74,53,95,15,247,147,9,30,52,12,68,12,58,169,136,152,224,164,147,149,244,57,140,57,222,207,87,104,239,38,177,42,19,28,154,84,180,93,50,
+114,144,229,9,126,85,58,74,103,20,37,195,80,177,133,215,149,201,8,141,55,124,255,242,242,10,29,45,84,249,254,99,24,134,97,164,241,167,66,85,123,129,43,27,134,129,33,41,238,196,126,163,159,213,68,72,112,231,158,167,128,111,54,146,224,162,3,237,62,88,187,
+143,25,181,132,68,219,109,215,136,117,7,231,185,133,6,181,170,67,89,243,139,103,62,22,140,253,68,24,19,243,121,240,140,90,248,97,100,24,6,7,30,209,64,244,61,129,161,99,140,122,182,122,120,240,96,227,225,157,97,24,134,97,84,236,59,12,227,4,175,207,20,
+233,14,1,171,48,216,113,177,190,194,48,140,151,233,254,218,165,189,116,191,207,13,187,25,134,97,220,200,115,2,158,174,168,38,126,145,7,135,49,12,195,48,12,195,48,140,52,208,73,101,101,168,47,173,197,231,191,152,46,240,47,195,33,234,43,114,4,250,242,50,
+91,251,49,193,38,12,143,87,180,63,143,38,35,244,227,201,69,206,126,49,29,217,30,11,81,34,180,90,5,201,217,126,231,128,31,115,127,72,188,66,49,39,201,139,139,49,15,158,159,93,179,37,186,218,194,224,133,231,167,150,120,189,246,24,176,24,98,24,134,97,24,
+198,27,200,16,139,140,12,58,98,220,199,211,147,139,244,200,120,246,162,121,56,70,126,215,79,157,88,224,248,220,65,206,22,107,180,77,194,32,186,247,23,216,159,215,9,246,166,162,52,20,11,105,218,36,88,168,213,105,166,84,167,131,249,138,102,11,195,168,227,
+130,202,52,220,19,166,71,199,50,244,248,68,142,47,63,179,1,248,132,53,27,46,241,16,145,150,113,125,63,87,166,87,185,205,70,41,39,243,85,225,73,204,224,29,5,83,163,153,214,96,120,11,130,80,12,186,52,2,130,208,223,157,229,225,97,94,4,150,67,40,116,16,181,
+79,11,194,176,78,134,241,3,240,37,191,54,27,187,104,22,192,116,177,74,175,207,151,61,57,216,132,97,130,198,107,179,37,97,209,41,207,5,25,158,4,162,212,19,19,57,250,194,104,154,250,226,157,231,185,192,78,238,153,83,139,60,187,193,97,100,60,179,136,213,
+121,144,155,90,224,112,176,187,63,190,33,49,51,76,97,186,44,75,116,203,80,146,206,44,213,232,217,51,121,22,140,21,113,145,202,132,69,16,191,164,95,157,103,239,92,102,21,120,88,127,97,36,213,116,250,176,14,238,155,91,226,73,186,166,63,174,181,210,115,
+149,177,26,126,62,83,164,107,7,197,135,161,241,16,69,231,249,201,212,18,237,93,172,210,237,67,201,182,158,197,188,65,90,99,56,210,77,215,103,98,180,41,30,166,104,247,106,0,50,83,174,209,137,66,77,185,224,62,93,168,105,137,89,171,44,86,248,0,194,48,136,
+77,182,197,195,23,13,88,156,40,214,92,19,127,64,32,126,112,52,213,116,136,21,158,127,236,221,120,150,159,60,177,232,26,193,184,113,96,37,134,85,78,149,235,28,207,49,129,7,49,50,98,101,51,85,165,235,121,94,177,13,1,158,229,221,217,40,109,73,70,46,196,
+148,248,25,206,20,106,116,36,95,209,108,21,24,99,32,222,70,17,221,173,217,24,221,56,152,104,26,163,67,32,62,52,95,214,236,224,156,44,152,194,190,211,56,11,227,224,98,37,144,9,73,60,179,216,95,211,81,235,195,218,15,243,51,162,12,196,115,40,86,53,146,140,
+65,252,132,42,127,20,76,241,58,214,26,61,70,110,228,120,169,102,122,125,234,250,225,79,254,180,225,29,223,251,104,222,119,66,4,132,130,171,82,81,26,140,135,40,19,94,189,17,39,11,85,202,213,150,233,237,197,10,87,194,54,193,204,131,219,200,11,83,75,252,
+240,42,98,255,112,15,237,234,53,86,137,218,140,223,76,230,3,151,49,29,14,119,211,61,67,73,26,73,70,46,10,252,17,68,163,234,3,1,189,147,226,185,126,88,215,69,77,110,185,177,14,214,253,7,135,83,109,133,89,4,248,7,166,213,85,104,227,254,123,108,103,175,
+229,247,63,117,124,129,147,59,76,96,193,51,189,111,48,209,178,3,3,235,56,134,124,58,121,96,55,187,47,59,185,15,35,206,251,204,80,146,198,83,209,166,66,152,27,174,39,195,56,205,13,233,40,221,55,154,178,244,45,102,75,53,250,238,196,130,146,159,192,72,204,
+67,107,157,160,191,156,202,115,229,171,5,112,141,251,27,58,68,138,245,101,199,175,35,246,156,157,153,40,133,186,55,174,225,245,229,21,58,178,80,161,167,206,88,159,137,226,69,32,154,239,223,150,177,244,205,177,239,125,251,195,185,64,93,47,167,176,170,
+53,17,235,77,77,105,229,0,160,131,130,179,151,206,23,13,23,1,52,21,138,95,158,46,248,166,181,21,126,186,119,109,238,105,187,105,114,32,220,156,175,141,103,45,61,184,224,71,199,114,28,128,40,226,235,59,178,150,178,166,200,126,7,45,112,248,242,104,202,
+80,59,146,202,192,158,177,7,172,253,251,199,50,134,171,128,80,61,240,19,129,225,130,102,248,236,96,194,82,55,64,16,159,89,134,209,129,111,221,93,35,61,134,158,105,167,132,16,171,201,91,39,196,98,51,107,36,183,84,51,65,199,202,179,13,145,238,251,71,115,
+74,170,58,205,198,60,186,151,46,63,211,222,5,9,140,187,71,122,154,10,196,235,193,239,251,137,99,106,238,69,183,96,37,193,163,242,153,101,136,62,191,57,105,105,78,15,233,247,244,68,142,139,168,12,58,0,52,114,98,177,74,79,79,229,59,234,158,161,207,255,
+229,87,191,185,254,63,70,186,186,232,247,11,222,87,232,209,38,242,231,151,164,41,21,109,221,202,13,176,192,110,233,137,208,229,61,81,58,87,172,209,60,15,29,208,44,72,118,100,173,251,251,236,72,69,233,85,246,209,84,194,171,115,101,186,62,19,165,88,168,
+253,125,222,200,241,197,10,253,88,145,40,230,22,32,168,111,78,26,91,64,209,46,124,91,127,156,62,204,85,40,207,201,35,207,97,246,192,4,6,226,97,26,232,238,162,15,150,236,111,181,62,4,251,137,112,55,13,154,240,24,71,22,248,159,78,231,109,253,94,12,67,107,
+135,171,43,122,34,180,35,17,214,94,209,46,162,243,14,31,154,80,37,129,120,206,200,129,152,214,214,240,203,51,49,250,104,81,221,26,142,10,166,125,195,61,150,222,123,105,58,74,7,20,218,190,153,93,35,241,247,84,95,207,86,220,217,23,167,221,169,8,221,62,
+144,164,190,80,151,43,238,79,198,255,28,204,87,77,237,219,197,218,50,61,113,108,65,137,224,164,85,229,109,55,55,116,13,107,169,91,158,105,198,60,186,8,218,109,112,232,5,126,223,123,122,99,129,58,215,156,174,212,169,88,174,211,246,84,196,208,117,82,249,
+204,50,107,197,156,91,172,117,106,208,218,61,157,14,117,105,107,115,144,209,171,178,205,216,26,102,99,33,77,247,60,184,80,161,106,155,229,160,169,80,12,97,245,192,140,183,125,138,33,18,223,49,98,46,96,215,15,22,111,207,151,219,94,180,32,240,23,91,141,
+31,200,154,129,96,165,94,93,166,147,156,169,86,2,196,98,4,176,3,177,112,219,65,89,200,148,190,122,182,72,207,156,85,235,151,230,52,95,29,207,80,111,204,156,47,44,130,138,43,51,81,122,121,150,19,30,94,227,225,75,50,29,19,132,205,216,156,8,211,76,161,70,
+231,20,100,167,17,216,32,128,29,235,137,180,93,107,49,80,227,149,179,5,122,122,154,43,137,25,123,121,236,146,12,221,63,210,67,159,200,68,233,146,84,228,194,235,170,222,24,221,62,144,208,90,110,157,8,200,17,4,255,245,182,140,233,152,4,127,127,52,22,86,
+86,248,240,215,99,105,83,9,219,70,176,111,99,15,87,113,125,113,61,255,195,182,76,83,255,228,118,224,122,238,72,70,180,65,124,170,193,181,249,247,163,105,122,96,75,143,118,79,14,195,123,53,218,237,138,251,147,9,14,184,191,166,151,170,52,150,12,183,124,
+214,177,103,163,67,233,123,39,22,149,9,114,127,49,220,163,197,47,102,81,189,70,50,114,192,122,8,91,5,179,131,145,113,174,217,157,141,209,75,1,58,215,64,44,254,183,243,37,237,154,245,69,67,77,5,99,8,196,111,156,43,210,255,58,157,231,164,137,66,238,221,
+156,212,138,116,68,192,251,223,154,45,5,90,183,251,210,150,180,165,217,55,136,1,183,199,35,109,215,255,166,66,49,240,178,80,140,12,5,42,79,172,128,77,179,211,69,243,59,104,239,188,92,192,247,86,39,68,93,244,14,79,12,85,6,2,88,84,36,193,253,20,222,182,
+161,174,46,66,113,60,94,231,138,117,250,221,185,130,214,90,127,172,20,44,127,83,84,31,93,102,241,126,142,116,119,41,59,188,51,114,64,146,240,202,62,235,235,87,127,56,164,108,253,71,0,139,128,29,130,113,42,212,77,56,119,174,52,60,179,239,206,149,232,9,
+180,123,7,236,153,101,212,130,202,164,255,56,158,161,76,44,212,242,224,137,255,142,74,58,39,58,45,238,238,79,104,130,160,21,32,38,170,74,90,223,61,100,173,154,88,7,135,88,28,104,237,6,215,115,220,226,68,120,28,44,84,23,1,224,254,252,226,120,251,228,159,
+126,127,222,220,23,167,143,22,184,66,146,177,15,84,175,163,56,227,240,124,153,202,213,101,173,11,23,214,44,152,123,243,230,249,18,61,121,58,175,52,102,212,124,198,45,250,39,211,218,26,121,114,177,194,221,180,30,2,73,179,180,133,98,8,90,211,57,130,120,
+174,193,207,139,253,21,250,86,164,190,66,39,151,170,116,48,87,166,255,231,116,94,43,8,226,56,91,61,247,12,25,179,18,235,196,92,177,78,83,1,29,244,141,51,239,158,1,107,214,29,100,32,70,22,147,241,93,10,60,137,69,128,42,143,11,31,84,131,236,161,152,245,
+41,161,141,12,39,125,121,123,185,158,159,35,201,227,241,142,0,153,92,39,176,128,2,109,104,18,251,194,122,134,157,41,235,150,57,180,182,254,163,50,77,165,231,21,188,73,131,54,84,146,113,7,176,75,48,227,225,135,67,38,134,49,126,239,200,188,178,246,204,
+221,22,253,235,116,176,38,216,29,207,33,33,41,138,72,23,151,25,68,6,224,146,162,235,169,99,214,99,18,135,206,175,236,200,178,199,36,99,59,184,191,206,204,149,28,159,233,179,199,98,210,167,145,43,82,81,58,86,230,115,131,87,176,82,61,216,8,6,223,5,249,
+92,227,151,57,92,94,39,21,177,150,236,88,143,166,91,5,212,153,239,70,11,243,110,154,125,70,171,152,174,233,111,168,226,225,172,34,170,137,69,23,80,112,157,132,160,223,171,140,26,244,113,237,132,140,44,17,195,136,98,182,189,118,61,168,84,186,65,66,32,
+206,168,65,70,130,106,212,164,77,9,195,120,149,135,44,118,95,61,178,61,171,228,39,70,76,39,26,75,24,29,238,33,194,128,164,4,187,12,193,185,29,72,130,137,30,206,84,92,79,90,107,175,190,215,130,127,33,4,247,135,199,173,77,187,103,24,175,145,21,140,113,
+73,226,185,143,177,31,89,73,201,97,9,247,13,35,15,77,191,146,36,156,50,193,0,247,140,12,177,29,159,113,101,139,61,160,233,105,248,76,193,187,229,247,87,8,86,147,233,244,197,67,202,171,202,24,239,129,150,175,203,147,17,45,155,133,54,32,36,89,202,245,21,
+154,46,215,233,173,60,87,8,58,141,172,67,247,246,158,8,87,124,122,4,25,9,170,32,103,167,25,123,65,96,151,88,243,182,60,94,170,117,156,56,108,39,152,226,111,181,138,21,207,25,222,255,148,205,85,73,9,139,158,191,235,177,59,158,203,70,228,8,197,118,211,
+47,233,123,170,136,143,31,28,73,153,246,224,212,65,130,24,9,94,39,247,237,198,103,29,252,169,192,22,86,140,124,54,9,122,124,50,222,98,84,82,183,238,85,233,168,86,17,207,56,3,244,131,125,125,113,218,145,142,106,154,83,35,115,165,58,189,159,43,211,171,
+185,178,163,49,34,227,110,118,72,76,240,141,39,194,77,99,148,166,171,205,17,15,11,92,50,179,162,8,168,131,40,20,207,148,107,82,170,178,253,140,190,192,163,37,182,149,48,117,87,125,133,222,156,41,114,139,139,15,240,138,8,192,48,140,251,128,96,116,99,127,
+156,198,83,209,13,251,5,188,45,223,157,117,166,125,89,107,63,21,96,204,162,111,176,19,216,29,207,29,205,87,164,196,77,167,60,226,147,168,34,62,30,18,20,68,110,221,148,80,46,20,67,64,223,55,152,104,250,172,63,68,171,67,206,94,156,41,114,17,10,35,141,133,
+42,188,37,185,34,56,40,196,186,185,234,212,235,192,222,244,182,205,201,150,250,1,132,227,91,226,73,186,166,63,78,207,77,45,249,54,201,136,226,58,25,197,61,185,128,218,76,197,20,216,149,109,136,194,112,104,9,170,55,239,122,70,98,161,64,86,0,156,149,52,
+164,228,204,146,63,141,225,113,232,255,220,214,116,199,114,127,44,126,183,12,37,105,71,42,74,63,158,92,228,172,32,195,40,64,70,224,49,173,112,80,19,227,111,238,31,72,208,222,77,173,61,196,176,143,96,159,192,129,224,25,12,46,84,120,239,137,122,226,138,
+218,250,168,196,238,88,78,150,192,123,168,232,141,184,201,238,235,9,239,108,171,213,196,58,41,197,9,94,12,130,190,107,164,253,112,30,204,60,192,235,173,115,69,250,213,121,246,132,101,196,41,75,176,139,92,168,113,204,195,48,42,248,226,72,207,234,236,27,
+3,32,62,124,104,44,77,125,83,75,190,212,230,224,96,32,195,202,234,35,238,214,177,141,13,81,254,129,233,130,127,126,58,198,18,178,30,184,163,62,180,94,64,181,200,254,177,140,41,79,24,84,25,61,58,150,209,170,144,25,111,146,171,114,16,237,21,100,88,39,77,
+150,121,250,49,35,14,14,4,237,68,226,70,82,107,123,203,118,73,94,183,157,144,101,203,99,183,127,251,172,132,181,55,175,160,122,19,2,111,93,48,25,188,168,96,106,183,12,129,87,197,245,220,42,161,157,94,84,104,54,3,42,196,238,223,154,50,156,164,196,186,
+240,249,205,73,117,95,144,241,45,239,75,56,107,157,242,176,229,100,208,144,117,182,246,74,247,138,159,64,220,101,84,36,110,228,142,145,158,150,30,178,94,230,143,18,196,111,20,37,114,135,142,125,92,164,118,253,113,182,196,190,170,13,76,5,180,170,12,15,
+220,97,193,135,23,85,125,175,250,48,251,245,224,176,241,131,64,35,104,35,185,71,194,100,74,198,28,178,218,185,223,225,46,11,207,32,26,120,112,208,193,200,192,202,129,0,123,11,186,85,188,148,84,204,216,92,85,140,103,17,126,125,34,156,86,84,109,114,100,
+65,44,126,254,245,148,154,41,244,39,22,197,174,199,4,251,245,95,4,10,8,110,179,32,250,94,221,31,215,170,144,25,70,4,116,161,136,116,112,226,188,198,157,196,222,65,198,185,102,101,197,59,221,43,126,1,251,196,39,5,116,128,123,71,122,124,119,77,160,57,138,
+118,159,191,20,224,206,28,153,221,175,173,236,59,46,68,248,104,131,250,217,89,239,87,19,79,74,60,16,28,15,112,182,13,30,106,21,129,118,38,120,243,250,205,106,1,21,35,34,30,132,56,20,240,68,83,245,136,86,105,225,57,224,128,202,59,32,240,16,17,150,130,
+28,116,48,114,128,208,107,245,64,128,202,226,125,146,170,125,219,177,32,201,211,237,160,2,209,240,149,25,177,103,242,69,193,247,27,5,131,253,138,22,175,43,14,75,170,246,153,55,4,133,134,87,120,238,194,69,192,147,216,170,221,209,237,67,92,85,204,136,35,
+18,183,252,206,7,103,255,160,33,122,174,17,45,6,99,204,115,125,38,38,100,139,135,216,240,86,11,213,200,110,231,249,179,75,150,245,38,20,184,6,121,72,236,7,133,170,144,86,215,200,219,45,98,249,48,130,83,108,48,126,185,208,191,95,40,27,110,245,108,7,174,
+75,144,61,101,81,197,243,252,212,146,214,74,103,22,108,64,126,28,224,182,83,66,229,199,205,125,113,95,36,100,188,4,170,180,246,111,203,88,254,198,111,42,18,25,188,206,103,7,19,180,35,19,165,88,195,148,247,114,125,153,142,46,84,232,231,138,175,225,47,
+167,242,90,27,191,217,160,44,232,65,7,35,135,61,233,141,131,172,204,128,33,169,118,251,151,98,200,215,125,18,62,231,140,130,33,34,72,254,92,189,88,253,255,217,123,247,216,200,206,114,205,247,245,165,174,46,187,124,75,219,78,59,125,113,154,116,46,116,
+46,244,78,32,9,74,180,59,33,9,129,100,224,132,105,152,61,123,136,136,118,246,25,137,253,7,127,140,132,180,181,183,196,214,28,109,9,9,105,144,38,28,157,51,140,64,65,8,65,6,68,134,0,33,33,19,157,100,8,9,13,129,132,208,132,78,250,234,110,183,219,221,110,
+95,203,117,47,251,232,89,93,213,93,182,171,92,107,125,107,213,183,110,207,79,42,237,157,196,101,202,171,214,250,190,247,123,222,247,125,94,37,47,59,20,65,232,236,16,248,238,201,37,121,98,34,109,201,255,25,135,254,111,158,94,106,235,231,170,7,107,220,
+222,185,188,145,188,182,202,175,103,178,90,174,39,98,200,187,108,138,168,78,29,160,182,2,73,33,149,86,226,26,56,252,163,170,152,221,156,196,14,120,166,199,102,178,150,159,25,156,215,116,87,19,163,219,102,223,64,76,122,163,235,109,150,80,229,58,95,40,
+203,75,51,89,22,103,180,224,251,147,203,242,228,158,126,165,247,194,34,9,73,77,162,151,189,253,246,69,94,232,16,65,171,254,71,71,196,51,147,75,150,207,108,88,187,194,174,167,64,167,60,153,41,218,138,65,164,122,45,155,105,158,93,39,63,244,239,191,114,
+33,64,109,182,153,213,53,217,155,136,72,42,106,175,114,243,133,115,43,18,164,235,162,194,116,177,34,179,217,178,177,48,153,61,244,64,104,249,97,64,125,174,31,221,110,93,52,223,72,164,163,67,14,45,48,147,171,147,139,229,85,25,237,238,148,97,5,207,195,
+185,124,89,126,192,128,106,75,32,16,255,219,107,250,100,180,39,98,136,196,88,43,106,47,252,243,104,50,34,247,12,37,36,178,186,38,39,52,117,105,44,84,214,228,236,74,73,174,239,139,153,94,187,176,81,6,117,237,10,11,24,128,5,145,86,215,125,214,140,3,195,
+73,73,219,240,26,198,61,123,122,185,104,220,199,237,228,67,27,18,59,86,129,192,249,198,188,158,253,236,40,158,231,158,168,165,1,122,120,166,159,213,124,144,64,12,250,254,98,81,118,39,187,77,125,86,20,37,252,223,167,244,137,196,53,254,178,82,146,177,72,
+167,12,89,216,23,113,61,159,187,160,47,233,119,71,127,76,34,54,108,88,206,172,148,228,237,54,87,188,223,220,19,149,15,244,217,43,34,88,42,84,228,125,151,132,49,196,70,31,78,199,100,34,209,109,188,80,17,159,225,224,101,95,130,125,175,82,90,149,221,38,
+125,227,117,159,215,112,175,253,199,137,244,166,130,130,26,240,20,199,154,121,83,127,204,56,199,163,240,139,52,6,207,40,100,226,81,5,223,218,23,207,174,200,89,13,126,248,100,61,31,115,160,123,4,177,225,27,1,44,196,67,172,123,108,185,40,219,99,221,45,
+245,59,36,128,95,153,201,202,243,44,226,50,56,153,45,203,254,254,184,242,112,106,92,207,255,121,54,211,116,223,239,26,250,235,39,190,98,243,51,122,142,179,185,146,236,75,155,23,8,54,2,255,182,151,230,120,3,2,136,229,111,45,20,100,168,187,83,122,35,93,
+77,175,41,14,59,16,215,255,119,64,69,80,12,24,186,217,129,118,96,4,65,175,114,113,211,206,225,76,201,114,2,9,34,200,127,61,161,255,0,239,39,158,188,166,79,246,244,199,90,14,13,194,127,191,38,21,49,14,10,248,46,116,80,11,60,174,138,116,109,41,218,101,
+170,221,19,191,156,99,59,181,31,65,117,210,99,227,41,185,111,91,210,56,96,226,62,67,43,56,146,19,31,74,71,13,27,146,139,26,170,94,235,185,163,63,110,59,89,253,254,114,169,237,201,234,74,121,77,246,216,16,185,254,231,153,140,182,107,91,90,19,57,188,84,
+148,222,142,14,217,150,216,90,220,68,224,251,155,11,57,173,162,102,61,8,184,127,187,80,144,25,136,177,241,46,137,118,118,72,103,221,34,137,138,174,243,217,138,252,124,58,35,47,186,104,117,131,181,56,181,38,114,117,207,214,98,131,91,215,51,177,118,105,
+223,80,229,127,156,94,110,187,232,121,91,111,180,229,245,107,69,167,116,104,23,197,176,110,30,188,166,87,238,24,78,24,215,184,246,218,63,24,151,143,14,198,101,44,210,165,109,175,38,206,113,186,80,49,146,140,241,206,142,166,73,32,55,206,107,136,253,208,
+105,17,53,153,152,196,254,137,68,166,174,68,164,31,57,146,45,91,18,139,81,177,253,194,217,140,209,77,68,244,130,65,116,55,58,96,27,129,138,219,160,106,8,216,171,177,15,162,64,113,181,178,102,20,214,213,146,237,136,65,166,86,202,242,230,92,94,126,114,
+110,69,142,113,16,227,101,16,27,227,156,163,122,127,65,116,127,119,139,97,166,29,31,248,151,95,5,50,117,140,135,242,177,29,189,150,223,135,139,253,237,201,165,80,219,78,52,3,45,118,59,227,221,178,171,238,144,6,243,235,99,217,82,224,135,63,169,222,79,
+141,248,207,127,153,115,250,227,17,147,160,250,245,230,161,68,75,97,243,212,114,81,190,51,149,225,101,221,130,131,163,61,74,173,84,111,207,230,180,91,81,192,27,252,166,84,84,198,147,17,67,180,1,179,133,178,76,102,203,108,249,245,41,56,120,62,190,59,109,
+170,85,77,247,243,252,164,81,97,175,238,103,15,126,52,185,172,197,6,229,139,187,250,100,80,161,219,2,98,131,78,187,132,122,240,60,195,198,105,87,111,212,104,221,175,129,248,237,248,114,209,56,108,112,32,165,121,106,215,115,56,214,189,238,190,197,119,
+140,9,251,111,108,209,150,216,110,84,239,79,93,251,204,195,67,9,219,118,119,58,159,37,172,155,127,187,171,207,84,181,59,14,231,79,159,88,212,98,47,67,156,167,118,102,27,171,38,202,49,160,29,179,119,220,120,150,191,252,129,1,37,59,38,198,226,173,193,51,
+253,185,29,189,155,172,60,234,193,26,243,220,116,134,207,178,75,80,67,32,237,6,22,86,247,143,245,152,94,103,177,191,195,159,190,149,149,73,96,133,98,169,86,129,90,241,60,65,37,241,15,167,51,20,137,201,38,112,47,253,237,238,180,35,23,134,139,188,251,52,
+243,211,61,155,45,27,217,90,6,83,91,131,22,127,59,190,207,223,60,186,192,107,76,148,169,85,39,89,245,129,253,250,241,69,45,23,221,79,66,49,248,210,68,122,203,67,230,70,116,94,75,66,172,222,159,71,22,10,218,60,56,81,153,107,215,75,25,150,30,63,152,214,
+243,121,255,241,186,1,75,235,38,170,223,191,117,156,98,49,81,7,241,246,45,138,195,93,133,241,162,105,16,23,221,212,27,149,137,234,60,157,194,234,170,76,101,203,129,156,25,228,71,254,249,250,65,219,159,26,29,144,255,229,216,66,24,47,31,49,1,146,254,143,
+140,166,90,158,63,144,56,194,16,65,248,67,183,194,222,73,198,227,224,2,60,117,108,193,152,32,142,225,48,205,4,99,84,161,96,170,54,43,203,72,51,204,60,76,102,192,195,73,220,199,168,52,162,5,136,50,247,219,60,24,63,50,150,114,173,26,145,248,31,84,18,91,
+181,150,130,208,132,42,120,29,2,210,82,185,34,163,54,195,171,185,146,62,15,65,136,190,102,197,109,55,43,137,73,56,49,123,127,162,181,250,143,23,245,118,172,28,207,150,228,46,155,191,99,54,175,231,89,71,117,182,213,117,19,63,143,10,228,175,29,165,56,65,
+212,184,193,166,109,223,3,35,73,86,21,155,0,98,250,185,249,188,39,133,97,20,91,37,234,10,115,16,223,132,173,235,7,90,211,64,92,125,118,5,56,203,97,219,100,11,240,76,33,62,135,96,252,161,190,152,92,21,239,190,220,69,11,166,178,37,121,55,83,180,164,105,
+5,90,40,150,234,68,64,76,15,199,11,165,255,97,180,77,32,206,48,169,56,117,189,30,180,187,135,133,218,66,53,209,27,93,183,57,98,179,196,98,245,250,124,158,207,158,79,81,105,5,174,231,170,132,189,96,137,132,23,136,189,42,45,172,82,157,58,61,170,161,99,
+224,232,114,201,214,20,98,172,145,186,215,70,4,151,232,20,64,18,40,29,93,63,143,0,85,133,23,114,21,121,117,150,211,232,137,59,24,135,159,238,78,67,52,26,131,133,80,117,13,192,189,89,92,93,147,201,76,201,149,73,254,56,112,161,202,171,222,2,197,42,135,
+53,20,169,224,217,86,221,183,97,83,129,202,105,86,38,18,171,224,153,85,221,175,107,140,41,12,108,35,222,0,214,60,136,187,26,173,143,88,55,15,205,230,90,182,190,7,133,119,23,11,114,87,220,94,145,205,59,139,44,104,36,173,193,249,225,231,14,205,191,8,188,
+80,92,15,218,56,117,181,114,146,224,241,219,249,188,109,161,248,245,144,4,218,91,249,246,65,52,198,235,131,131,113,99,234,242,139,179,57,218,189,248,136,189,45,6,73,153,65,117,208,40,33,102,39,186,55,227,158,225,68,219,5,37,116,39,221,99,67,60,250,131,
+75,251,4,68,224,35,39,89,45,76,188,9,18,60,94,172,44,132,216,113,96,172,71,233,189,176,157,208,145,20,178,219,5,180,111,32,70,161,152,88,230,38,155,251,181,84,7,120,17,127,129,10,226,79,140,165,182,172,160,69,124,132,117,243,182,129,184,252,112,106,57,
+240,133,67,240,250,255,171,225,132,242,253,140,110,46,106,88,68,55,161,18,138,253,206,237,189,81,233,235,238,148,165,242,42,167,150,186,0,22,232,187,87,202,202,222,147,111,94,200,133,162,130,246,179,99,61,166,171,233,32,22,111,79,70,56,64,210,71,140,
+219,172,38,38,196,14,118,15,141,59,82,122,170,147,94,152,94,81,26,94,130,195,64,88,42,108,8,9,2,120,94,111,236,139,89,142,36,2,173,80,0,0,32,0,73,68,65,84,13,81,81,247,211,153,172,150,43,144,138,216,235,226,177,226,17,77,8,9,47,86,231,67,65,76,126,124,
+87,218,176,10,13,242,57,16,127,219,75,211,43,242,240,120,202,242,123,49,120,12,158,178,68,47,240,87,31,73,68,100,176,154,240,168,172,173,201,98,97,85,222,90,200,135,70,135,227,137,223,227,160,221,235,182,161,248,166,9,197,15,137,72,174,188,234,90,187,
+93,88,249,222,212,178,252,253,238,180,229,74,49,180,18,59,213,6,224,101,62,189,45,105,185,229,26,65,194,103,198,82,242,244,212,114,224,175,15,33,68,157,251,108,122,29,130,174,14,61,213,73,72,44,14,76,175,88,170,52,196,62,241,61,174,131,132,248,14,60,
+183,95,216,209,103,218,131,18,7,255,103,207,44,107,19,70,88,149,73,8,209,1,42,137,173,174,55,248,249,191,217,222,27,248,249,7,232,54,139,91,140,11,177,87,60,51,185,228,216,172,36,210,26,8,196,55,15,37,100,243,113,161,195,208,227,30,234,73,201,129,202,
+154,252,110,54,23,248,78,27,117,83,45,210,86,208,222,253,229,15,12,24,211,148,55,138,196,53,240,239,225,253,131,41,198,183,59,208,222,67,90,131,160,254,191,157,88,52,14,244,102,129,183,49,42,102,131,14,178,200,168,16,86,1,150,30,119,219,240,244,36,250,
+96,251,41,33,230,64,165,225,143,38,151,141,202,193,86,192,134,135,157,21,132,248,19,60,183,120,126,241,28,183,2,49,33,170,231,120,240,55,15,226,75,204,153,185,145,126,181,190,226,176,3,85,119,16,202,136,63,128,237,160,234,192,54,116,100,132,225,28,104,
+37,46,68,135,25,69,98,189,124,105,34,45,183,12,55,18,137,215,131,228,6,52,58,12,218,13,50,172,40,246,32,16,125,31,218,110,190,53,1,126,159,198,207,79,101,104,73,161,1,28,8,158,58,185,104,108,136,251,6,227,77,51,167,97,51,234,191,67,81,36,174,1,159,42,
+182,92,251,3,12,16,178,227,51,156,107,243,48,49,226,12,56,148,239,75,71,101,87,42,186,110,157,67,162,12,131,57,224,185,166,83,216,92,242,225,125,99,204,70,56,182,96,28,128,246,164,162,50,154,236,190,124,45,57,216,147,144,224,128,181,240,199,231,179,198,
+243,124,83,42,42,19,169,245,5,28,24,102,252,214,98,193,149,67,255,218,154,180,60,248,122,13,236,63,183,15,196,55,205,6,121,172,186,118,194,203,157,49,163,183,129,175,184,221,120,113,154,190,172,190,1,197,107,118,8,203,57,112,171,184,16,218,193,217,108,
+201,24,138,252,166,134,65,167,228,10,16,137,173,218,44,33,193,1,177,56,168,213,240,20,138,61,6,38,196,62,120,181,117,255,26,0,177,248,244,209,133,182,79,116,39,151,128,149,4,94,8,102,119,213,13,248,42,172,174,201,241,108,41,116,25,192,93,41,123,85,237,
+200,66,143,70,58,41,152,248,128,51,43,37,217,105,163,139,1,150,57,196,187,244,116,118,24,118,48,205,134,119,226,89,197,244,102,12,230,128,231,154,174,96,22,137,208,135,108,254,142,66,197,157,245,5,135,31,138,26,132,4,31,196,48,231,230,243,158,234,190,
+201,87,86,155,118,39,154,161,162,185,211,1,54,102,91,117,168,97,15,66,251,54,188,161,97,251,193,78,12,239,114,116,169,104,75,64,252,141,137,42,125,226,62,168,250,87,29,224,91,3,207,53,226,207,176,60,207,140,11,189,195,231,183,167,148,189,248,33,22,195,
+26,47,136,29,183,90,173,39,80,41,139,11,233,132,207,96,80,121,108,60,101,43,235,255,57,133,225,57,196,30,200,12,214,68,99,188,176,80,132,77,36,70,128,224,132,7,222,246,24,115,87,126,0,147,231,215,20,227,56,28,56,233,171,238,93,16,164,195,107,179,153,
+72,92,15,158,121,12,230,208,217,46,104,183,26,253,248,18,43,52,8,33,225,194,110,114,22,201,97,93,96,32,178,89,27,51,28,208,177,95,245,216,168,88,37,237,5,241,158,170,125,4,90,239,143,228,202,252,134,124,64,162,203,25,73,105,39,7,102,19,205,160,72,211,
+78,241,19,64,225,76,16,105,187,80,12,81,248,63,237,233,151,127,190,126,208,168,120,133,159,7,94,248,103,120,235,30,28,53,111,232,29,116,112,163,14,218,92,32,145,13,217,155,224,34,75,244,226,84,128,48,18,227,100,109,191,240,194,217,140,210,39,253,229,
+52,69,98,47,131,74,98,171,30,115,70,101,151,38,239,200,63,92,84,207,216,35,185,241,147,217,224,15,21,37,132,144,122,32,214,169,38,119,193,139,51,89,45,215,19,103,70,213,129,200,196,187,60,125,98,209,114,85,250,114,177,18,248,225,102,132,16,247,185,199,
+1,145,23,133,51,65,156,23,214,54,161,216,204,48,54,120,22,161,29,229,159,246,14,178,202,88,68,30,24,73,58,242,123,238,25,118,230,247,16,162,155,2,219,7,77,3,155,14,55,171,104,96,3,240,139,41,243,98,49,14,169,191,160,143,186,167,129,216,107,166,146,184,
+17,15,90,152,226,108,7,116,108,204,229,213,42,140,94,63,175,71,236,32,132,16,175,161,154,220,125,123,54,167,197,210,14,241,140,106,85,22,246,45,14,186,243,46,184,127,190,117,124,209,116,71,16,42,137,191,126,124,209,149,191,7,177,245,254,84,212,152,67,
+131,23,254,255,81,155,150,10,132,16,239,114,117,210,153,2,203,91,251,131,167,101,182,165,244,212,234,48,54,88,45,64,80,30,138,117,133,186,37,121,208,161,106,202,65,197,137,163,126,3,247,89,95,119,167,156,201,179,53,201,109,230,74,206,88,109,76,115,178,
+107,83,112,136,186,119,32,46,19,189,209,77,21,159,152,162,126,52,83,212,238,117,5,209,23,190,232,176,188,217,202,219,9,65,255,115,211,25,250,167,123,156,219,109,36,108,83,213,195,149,14,191,226,111,156,92,178,60,116,226,200,66,33,144,254,97,132,16,98,
+6,236,215,187,23,10,150,252,98,177,110,234,234,194,184,181,55,106,203,194,12,131,87,255,204,193,103,158,5,241,223,215,142,46,24,133,97,183,13,197,27,22,145,161,138,248,249,233,21,87,206,116,72,52,220,61,148,48,236,76,26,129,56,246,181,139,57,222,99,77,
+112,234,28,200,235,235,30,208,85,32,118,166,99,157,210,85,245,65,157,203,87,228,173,133,124,160,139,124,98,14,117,69,247,68,130,103,129,228,184,80,108,103,24,27,130,151,251,10,149,208,30,230,156,186,81,131,12,172,74,246,244,69,27,78,208,69,128,241,206,
+60,197,0,55,192,240,22,76,106,181,59,200,224,148,98,165,96,208,129,0,119,255,88,79,211,67,20,170,105,240,194,196,224,159,77,103,180,122,100,35,248,71,229,7,214,254,59,250,99,50,146,184,82,213,115,60,83,228,243,232,35,84,171,137,107,236,72,118,107,27,
+108,135,123,14,147,134,155,29,234,106,160,146,29,149,196,188,15,9,33,97,7,197,56,183,175,148,228,192,104,243,120,66,92,90,55,247,216,28,136,124,105,160,50,173,173,188,206,255,170,27,244,136,238,227,241,120,183,28,94,46,186,90,72,208,106,120,162,84,253,
+176,31,235,233,149,93,23,46,205,163,33,235,113,226,28,136,162,23,162,31,36,111,208,205,209,104,79,192,125,255,80,79,74,30,100,44,221,146,32,234,120,142,11,197,168,44,179,51,140,237,206,109,73,222,132,100,19,200,114,125,108,172,167,161,64,92,3,213,101,
+168,76,191,62,29,53,42,206,136,94,80,121,178,255,42,117,159,159,247,22,11,156,92,221,0,12,10,59,96,178,173,31,149,198,7,119,244,201,51,147,75,218,7,42,34,200,191,84,121,196,0,218,143,56,209,182,59,172,121,24,37,252,11,113,208,252,240,96,92,198,146,145,
+203,65,46,68,14,76,249,199,0,39,14,78,36,132,144,43,160,50,12,175,90,245,88,125,23,98,166,84,145,211,153,146,43,94,238,81,155,86,90,78,12,84,38,122,65,229,176,219,29,161,102,68,226,122,112,206,137,117,117,200,143,105,101,181,137,67,179,57,211,231,149,
+70,252,73,115,87,36,185,84,128,103,166,203,164,214,253,79,141,165,57,21,59,131,0,60,138,163,167,58,28,216,172,180,130,54,2,55,34,110,218,48,30,238,46,221,96,12,116,54,98,213,202,4,3,1,49,40,17,126,88,108,117,215,199,43,243,121,217,55,24,87,10,214,49,
+17,249,21,14,153,218,196,238,88,151,229,160,11,215,255,83,227,189,242,223,78,44,82,120,39,129,199,56,104,90,240,202,38,132,16,114,69,48,38,36,172,32,65,110,69,36,174,129,247,28,201,148,104,147,176,1,216,223,161,179,209,234,64,100,169,90,123,232,234,72,
+35,151,48,43,18,215,3,141,5,221,124,65,26,52,233,148,254,182,88,8,158,230,228,104,141,180,83,67,212,118,7,112,106,160,25,206,59,148,85,205,56,228,19,228,5,208,206,110,69,36,174,129,202,99,84,183,19,125,64,148,124,78,81,176,249,213,249,172,209,182,68,
+214,115,255,54,181,204,60,90,191,238,229,128,80,98,129,92,133,207,31,33,132,16,66,194,129,157,33,188,240,51,38,155,249,225,212,178,81,252,99,133,249,124,69,190,55,181,204,171,169,17,20,119,90,21,137,107,192,142,226,190,0,157,49,209,125,232,4,240,114,
+14,26,142,10,197,78,13,81,11,107,251,208,111,230,156,185,193,14,93,12,206,141,106,71,236,69,117,123,144,22,50,63,128,236,250,207,207,100,44,5,9,47,79,175,104,31,194,230,7,80,77,220,202,127,117,43,246,41,84,73,144,240,2,171,18,171,193,253,70,166,88,93,
+67,8,33,68,129,217,130,189,98,25,84,36,186,5,138,90,112,222,192,235,246,144,22,59,249,13,196,216,118,252,116,17,159,239,118,104,8,125,144,64,209,207,83,199,22,76,63,143,248,185,111,79,46,177,3,82,51,31,183,145,36,1,240,52,14,10,175,58,208,209,140,162,
+228,32,118,232,56,106,61,17,177,233,47,85,15,50,29,110,251,22,233,6,127,47,14,234,118,132,114,188,63,40,55,170,19,86,38,152,172,75,207,107,189,160,117,104,234,100,89,30,220,214,179,229,112,44,4,7,47,157,95,209,238,165,235,23,110,176,57,216,5,235,8,218,
+234,216,26,231,77,112,176,124,96,36,41,227,61,145,117,222,235,8,54,208,21,242,218,133,156,246,181,252,100,166,40,215,165,213,42,12,192,187,108,27,36,132,16,162,192,91,139,5,37,27,128,26,199,93,216,127,154,13,216,126,168,58,96,251,249,233,149,208,157,
+101,253,130,221,24,27,76,36,35,60,195,52,0,162,47,172,9,48,99,165,153,21,5,206,128,191,159,207,211,110,194,5,112,254,176,171,175,224,140,25,20,173,14,54,165,184,31,237,20,103,253,49,160,3,46,29,21,138,237,12,177,219,8,166,160,134,113,115,125,246,204,
+178,28,220,217,167,252,254,151,3,228,237,252,97,7,42,34,19,221,157,198,130,72,175,98,189,32,163,252,244,212,178,140,70,58,229,166,84,84,98,157,29,178,61,25,49,42,70,150,74,171,114,60,91,98,112,213,130,237,14,12,23,27,139,117,81,40,246,32,143,14,39,228,
+150,38,217,120,236,163,8,224,96,185,115,71,190,44,63,58,147,209,182,126,29,154,203,43,11,197,8,178,248,76,19,66,8,81,1,251,135,234,97,61,83,90,149,55,52,118,166,153,29,176,141,243,28,6,61,115,168,106,48,137,57,88,32,23,68,208,45,138,87,79,103,135,236,
+140,95,121,174,121,46,113,151,155,28,234,122,184,37,29,11,140,86,135,196,198,151,63,48,160,84,172,137,164,160,27,3,96,117,224,168,245,68,197,193,182,129,195,33,29,176,128,7,238,109,197,155,13,193,72,144,202,222,7,29,106,233,113,106,65,36,214,129,96,140,
+138,238,159,95,204,25,139,48,166,4,227,159,41,40,233,129,65,172,247,64,5,82,51,145,120,35,24,26,241,196,68,218,72,118,233,0,207,229,159,20,44,144,208,201,242,220,57,14,148,35,132,16,162,206,247,20,252,77,193,11,211,43,218,90,215,81,69,135,68,238,86,34,
+241,186,159,239,143,201,231,21,102,173,16,18,20,240,108,66,28,174,189,136,187,76,56,80,77,15,210,145,96,89,175,60,125,98,209,242,254,3,145,248,235,199,23,219,246,153,220,198,209,211,103,209,193,77,58,204,21,160,200,74,252,122,38,107,233,61,16,151,131,
+150,177,142,117,233,17,71,8,241,34,78,172,167,5,122,126,121,10,248,23,90,29,30,129,195,232,99,227,250,14,153,72,230,188,103,161,50,11,65,213,51,147,75,28,70,73,8,33,196,22,16,148,176,159,88,157,115,161,83,124,122,236,26,235,179,83,118,246,70,57,51,133,
+16,66,60,12,180,199,175,190,63,111,202,95,27,54,129,208,222,130,44,18,139,211,214,19,152,26,168,58,65,177,30,168,243,97,7,85,151,168,170,126,100,44,181,101,27,214,156,230,214,100,226,109,16,136,14,197,186,140,44,223,98,169,34,39,86,74,129,52,87,15,3,
+23,242,229,45,61,158,205,48,205,202,109,79,241,225,171,212,134,63,160,178,24,207,182,46,191,245,31,76,175,200,125,249,138,49,172,98,171,54,44,250,140,19,66,8,113,18,236,39,24,134,245,201,145,228,150,86,72,110,236,63,232,8,50,91,73,188,17,236,255,156,
+153,226,29,78,230,202,178,223,230,167,225,92,6,127,2,235,152,91,251,227,50,88,231,157,140,217,32,167,51,165,192,90,8,212,3,125,96,212,89,9,48,80,160,3,26,157,156,247,12,39,228,234,100,247,186,194,197,66,101,85,142,47,21,67,113,159,136,211,66,49,166,6,
+58,33,20,191,51,175,207,103,202,203,64,252,197,205,42,213,69,13,126,163,35,137,136,204,228,74,178,82,89,11,124,192,129,69,123,176,203,254,45,186,20,112,17,29,139,89,163,132,2,54,1,60,143,15,174,137,204,100,203,242,220,52,19,10,126,2,1,232,126,69,97,81,
+170,149,158,108,241,242,14,88,195,85,15,152,96,223,64,76,235,154,143,255,45,120,62,126,36,29,147,241,100,68,162,117,159,125,169,92,145,119,22,139,188,191,8,33,132,56,14,42,139,145,176,28,157,205,25,115,46,250,34,157,50,28,235,54,246,158,229,226,170,17,
+31,185,145,160,196,224,58,85,176,255,35,14,96,241,134,55,64,252,242,96,105,85,82,17,181,238,85,248,98,51,73,238,47,240,252,29,24,237,105,88,0,1,189,1,69,25,55,15,37,140,193,100,65,22,2,81,68,230,132,94,7,61,42,168,64,47,161,183,188,195,66,49,46,234,169,
+229,162,209,98,163,74,174,188,202,140,107,3,140,192,98,25,255,62,28,25,12,49,42,42,43,198,162,109,151,32,7,101,216,244,30,188,58,181,229,32,73,252,55,136,200,240,58,253,229,244,10,131,84,159,96,103,176,11,120,71,193,107,150,180,15,84,47,216,193,238,132,
+98,21,112,88,55,246,99,238,201,132,16,66,52,3,75,163,115,30,218,127,236,36,123,165,26,7,48,6,247,14,135,102,115,114,96,172,71,233,243,28,10,73,69,97,80,64,55,128,25,113,20,103,102,204,17,153,232,139,6,214,86,0,107,16,138,200,182,210,14,204,16,150,170,
+218,48,227,184,9,236,119,166,50,134,216,171,2,252,62,190,123,114,41,236,223,9,169,242,170,3,11,80,144,109,76,32,18,99,160,134,217,133,30,1,46,126,30,131,56,136,63,64,91,165,202,96,151,249,124,69,94,161,184,231,41,234,91,220,8,33,132,16,226,31,110,231,
+96,236,192,241,218,98,65,38,151,173,87,69,98,142,195,107,22,102,57,16,119,81,153,15,130,226,140,39,175,233,11,236,55,135,78,99,59,152,241,241,37,254,167,45,211,194,32,246,90,21,139,43,171,107,242,194,89,182,198,147,43,224,94,176,187,16,61,63,29,204,182,
+1,216,77,160,146,88,5,149,65,28,196,29,80,85,252,171,243,214,6,91,66,88,254,217,116,70,219,4,112,66,8,33,132,144,32,211,215,205,1,219,65,228,135,176,229,179,112,214,132,176,252,83,139,3,231,137,123,224,188,124,231,182,164,210,255,62,58,58,131,154,32,
+130,181,105,69,241,156,136,194,78,216,89,146,224,211,150,210,66,8,124,95,59,186,32,159,223,158,50,101,67,193,129,108,164,25,88,200,254,241,186,1,165,118,175,35,11,5,57,146,11,102,198,11,158,196,170,45,35,184,150,104,193,161,247,142,63,64,213,194,124,
+105,85,30,28,235,105,233,165,134,96,247,123,83,203,20,137,61,8,6,32,68,187,88,85,76,72,88,64,247,206,199,141,117,187,107,221,126,141,195,217,133,92,69,94,157,205,6,54,70,33,36,104,192,134,233,174,17,53,193,137,120,23,196,203,56,107,162,234,116,171,1,
+190,40,194,248,221,108,142,246,152,62,227,129,145,164,45,139,133,123,71,146,129,181,139,249,209,233,101,57,184,211,122,213,52,11,59,195,67,91,123,208,97,67,81,155,26,184,35,21,145,174,13,79,234,116,182,36,191,153,203,51,80,38,91,242,173,227,139,134,191,
+174,21,177,24,34,113,144,133,208,145,164,189,71,215,24,200,65,161,216,55,96,232,198,159,143,45,200,221,233,152,220,216,23,91,231,91,140,224,245,92,182,44,191,157,207,115,184,152,135,153,43,84,108,249,12,175,81,251,39,196,96,119,172,75,110,77,199,140,
+225,86,181,181,16,73,178,217,66,89,94,159,207,27,190,166,110,243,197,93,125,77,103,44,32,150,193,231,62,216,211,231,153,88,229,198,100,68,246,165,163,210,215,221,101,124,54,236,43,115,249,138,167,174,41,33,110,179,102,211,215,51,200,195,159,252,14,4,
+96,188,246,167,162,50,18,235,146,237,201,136,20,145,212,203,151,101,166,80,145,55,51,244,150,246,35,227,61,17,91,159,58,209,221,105,104,89,65,20,70,161,191,125,243,232,130,60,190,59,221,52,65,82,15,146,220,156,117,20,46,58,62,240,47,191,226,241,147,248,
+2,120,5,181,26,236,133,32,238,245,243,217,64,103,124,81,165,164,146,1,220,200,127,254,203,156,211,31,45,48,212,18,92,87,39,187,37,214,117,169,138,23,21,161,103,179,101,195,59,155,153,84,98,21,187,207,45,132,48,84,189,16,18,86,122,58,59,228,51,99,41,217,
+209,187,245,193,239,79,115,121,121,113,54,231,90,103,197,151,38,210,150,146,66,232,170,251,134,75,243,57,70,35,157,242,200,104,170,101,108,133,107,250,99,139,54,72,132,4,13,51,231,144,173,96,220,77,172,130,243,8,170,98,199,146,145,77,98,30,108,62,39,
+51,37,118,136,110,193,63,95,63,104,251,119,252,122,38,216,186,130,84,135,253,161,136,172,81,81,30,4,226,163,75,69,222,103,46,129,226,136,193,72,151,145,192,90,44,175,26,93,198,186,10,195,56,213,106,11,112,40,249,72,58,38,227,88,156,235,30,156,165,114,
+69,206,100,203,52,178,215,12,68,18,136,45,31,30,140,27,27,38,192,158,137,89,95,53,17,47,12,139,216,120,147,42,37,171,160,205,138,45,84,155,105,118,16,128,109,192,222,104,151,49,16,129,162,29,177,10,50,247,24,174,169,90,85,140,54,117,66,194,10,4,205,127,
+183,163,175,165,253,14,248,224,96,220,168,6,251,246,228,146,118,177,24,149,196,86,159,113,84,30,63,58,156,208,62,65,28,135,143,131,59,250,76,85,18,185,121,77,9,241,10,240,229,124,114,79,191,210,167,57,229,98,21,30,214,79,8,13,53,216,125,230,15,112,78,
+131,191,110,179,42,118,84,187,226,76,242,229,222,168,60,123,102,153,29,218,68,25,67,63,57,183,98,36,38,110,170,179,141,61,188,92,100,113,148,11,64,131,188,183,58,132,177,81,220,251,72,101,77,78,102,138,242,10,138,215,218,216,241,69,161,184,9,15,15,37,
+100,255,85,137,134,255,113,84,186,229,186,116,76,238,24,78,200,171,51,89,182,163,104,4,155,224,145,41,26,168,19,231,193,230,104,182,253,6,66,50,188,179,97,139,194,13,212,155,212,54,217,137,222,168,12,196,175,28,144,138,213,205,245,157,197,162,246,195,
+210,247,39,151,149,14,153,65,246,91,39,222,1,107,224,29,253,49,25,73,92,169,216,93,44,85,60,209,69,241,153,237,189,166,68,226,26,120,230,255,102,123,175,214,132,30,18,217,205,236,38,90,113,243,144,94,161,24,235,227,167,198,123,77,237,119,53,112,77,63,
+57,146,148,31,184,60,36,24,195,133,110,232,139,74,172,243,202,253,128,150,126,221,66,59,9,31,88,7,81,93,104,213,171,24,149,159,223,113,225,236,130,179,108,35,161,225,177,234,80,54,36,160,49,52,153,120,15,84,120,226,187,51,3,214,113,116,172,253,98,42,
+67,91,0,98,11,172,113,231,88,68,230,42,72,226,35,62,219,42,230,197,51,15,45,114,87,42,106,12,189,111,87,241,106,215,208,95,63,241,21,15,94,35,215,64,240,252,127,238,76,203,68,186,245,16,62,124,73,31,232,139,202,88,164,83,14,103,152,157,37,122,152,72,
+116,203,53,41,123,158,75,224,240,98,65,206,22,25,32,214,248,143,19,105,137,91,152,106,221,217,209,33,251,210,49,121,109,142,27,170,215,128,199,220,231,118,244,25,207,73,98,195,119,138,182,170,161,120,183,220,152,142,201,80,103,135,156,206,149,165,164,
+169,64,46,179,186,38,185,66,229,146,71,184,73,80,133,244,61,151,133,25,18,108,32,16,255,187,237,189,114,239,104,82,70,147,17,73,69,59,47,191,134,227,221,178,127,48,46,31,234,139,202,201,229,146,113,15,235,6,98,135,153,152,108,35,248,252,149,210,170,156,
+214,36,132,124,110,60,181,105,189,49,11,42,198,240,61,232,138,37,63,54,152,144,93,10,211,220,177,118,206,102,203,114,193,5,207,98,8,196,255,97,103,159,236,77,199,164,63,214,181,238,62,197,125,123,239,112,66,246,38,34,242,251,37,118,251,145,246,113,34,
+95,54,158,213,97,147,73,33,116,18,125,239,212,178,214,181,19,66,195,223,94,211,103,172,155,205,146,65,233,88,151,220,60,16,151,212,154,200,251,76,68,123,10,36,29,239,29,237,177,252,145,118,167,34,242,191,47,242,76,82,15,246,5,187,156,94,41,25,207,61,
+33,237,166,214,233,101,54,150,196,153,118,119,111,180,109,177,174,90,68,27,80,32,18,127,97,71,223,186,234,51,51,64,209,255,244,54,78,194,37,122,56,236,80,182,152,89,231,43,32,115,175,114,192,71,0,254,249,237,169,246,125,48,98,25,12,252,123,120,60,101,
+186,157,26,107,126,143,133,65,153,118,193,115,135,225,17,185,22,21,154,240,91,127,123,54,231,74,21,18,9,15,16,60,48,44,182,149,239,38,236,20,80,13,127,187,130,184,104,151,125,131,113,229,223,112,219,128,250,123,173,146,182,49,172,18,92,109,115,72,173,
+21,236,92,211,219,53,94,211,26,216,163,31,218,222,122,93,199,125,252,229,15,12,24,247,53,33,237,2,109,218,207,156,90,50,68,224,102,96,15,71,55,208,215,53,119,158,193,102,226,160,133,179,44,186,103,121,134,245,22,168,38,84,1,162,17,236,243,200,21,208,
+69,104,23,218,52,18,29,168,116,122,213,56,48,214,99,12,37,118,26,90,79,212,129,54,101,171,34,113,13,8,14,71,50,37,250,62,145,182,131,128,19,27,159,202,66,82,99,171,224,54,140,32,217,163,202,142,148,126,225,132,52,6,153,88,108,150,86,192,154,255,192,112,
+66,235,160,38,60,195,95,59,186,96,84,141,220,51,156,148,193,186,125,39,83,170,200,233,12,219,168,73,251,169,137,196,141,134,151,52,3,98,157,104,108,111,189,177,193,0,31,43,224,249,134,112,210,78,15,183,26,86,174,99,35,106,131,83,219,141,221,107,218,106,
+152,160,211,192,191,217,108,11,182,84,19,184,176,145,250,234,251,243,90,63,39,9,23,134,21,222,241,197,77,150,61,133,213,85,121,119,169,232,90,49,6,134,83,90,125,190,121,134,245,14,136,11,237,172,207,35,26,19,142,126,224,196,114,209,210,254,177,17,158,
+151,137,46,160,67,90,177,88,219,200,129,109,73,249,243,201,69,71,63,45,87,147,42,56,72,52,243,36,54,203,221,67,9,110,178,68,11,239,206,231,229,22,27,237,52,239,204,179,53,179,6,42,228,154,13,138,48,3,222,203,193,128,222,224,254,109,214,91,245,164,122,
+72,122,107,177,160,221,171,207,56,104,114,40,34,113,137,199,198,83,74,226,230,129,209,30,109,34,200,128,141,160,185,6,134,56,233,16,138,253,194,174,132,253,208,31,73,57,29,235,37,68,56,149,88,199,240,236,28,237,225,148,118,210,118,144,248,189,148,216,
+117,63,185,139,142,170,86,221,33,205,120,112,172,71,254,124,108,65,199,199,36,91,240,97,27,221,30,82,61,147,224,92,195,174,209,75,96,15,248,167,116,76,249,156,247,60,173,223,136,38,236,116,122,73,181,48,2,133,0,78,106,145,20,138,171,220,228,64,85,32,
+54,103,93,149,43,110,128,146,248,157,117,158,92,115,165,10,15,95,46,129,160,244,186,254,152,146,93,194,92,190,76,81,179,142,27,44,248,197,54,99,34,21,229,53,117,25,8,23,170,7,36,112,199,96,92,78,48,32,36,33,193,206,224,53,136,112,186,146,99,105,90,8,
+120,146,132,81,253,220,126,161,248,1,139,67,195,234,49,58,133,60,32,20,227,92,128,100,197,169,124,89,86,92,240,248,38,225,97,143,141,179,44,42,217,116,37,128,72,115,234,135,116,170,210,199,125,115,29,47,156,205,92,234,134,178,8,7,73,187,3,246,76,232,
+114,227,232,126,170,43,102,152,45,148,3,219,249,128,217,58,118,58,9,106,236,77,81,40,110,11,19,14,181,143,95,155,140,200,185,54,77,30,116,11,220,188,31,26,136,55,20,97,50,165,85,249,227,92,94,222,88,44,48,0,214,204,119,79,46,89,110,27,70,11,205,55,78,
+178,130,177,30,39,130,50,226,62,55,216,92,195,175,110,131,183,19,33,8,120,239,28,136,27,131,195,234,91,202,176,119,158,92,46,202,235,243,121,87,18,174,118,171,150,246,13,196,180,8,197,139,26,189,61,237,98,215,18,10,182,51,58,40,56,16,171,205,105,250,
+172,227,61,234,235,178,155,149,117,168,234,129,151,243,70,155,14,60,247,103,179,37,121,101,54,199,66,11,226,56,163,54,109,7,38,146,17,10,197,36,112,96,15,24,155,205,89,234,78,193,32,105,118,164,232,7,195,139,155,117,248,67,135,66,7,232,129,124,69,126,
+54,157,9,212,90,53,18,179,55,227,162,198,112,204,89,105,183,243,179,99,61,198,65,134,56,67,144,170,95,122,170,166,248,24,12,213,172,82,15,7,223,187,70,146,242,247,187,211,70,38,154,232,3,237,110,223,58,190,104,84,8,155,1,63,135,161,26,132,4,145,152,205,
+76,172,29,95,40,66,26,129,170,219,39,175,237,55,2,219,141,247,23,254,25,255,254,241,93,105,163,93,88,55,131,54,247,107,93,126,186,103,29,152,52,126,74,211,180,242,105,155,85,28,135,52,77,171,159,182,121,184,130,32,174,75,228,180,235,251,236,68,199,144,
+21,16,55,227,92,245,216,142,222,134,94,206,120,238,81,233,236,214,115,79,130,141,221,138,180,152,198,193,190,132,232,4,157,184,24,64,217,106,184,29,134,80,254,122,38,203,65,210,154,193,222,249,15,187,210,166,108,96,97,177,240,183,187,185,135,234,160,
+147,1,203,37,6,21,135,216,5,21,60,176,95,216,209,103,186,149,59,85,157,178,75,177,88,47,16,139,81,33,140,77,13,213,194,107,27,246,63,252,51,254,61,54,71,86,18,55,102,38,103,191,69,99,81,83,117,21,105,78,95,132,107,15,241,14,16,139,238,50,209,54,143,131,
+61,6,48,234,158,58,111,87,232,117,162,69,206,12,168,24,201,216,16,37,207,173,232,107,247,127,113,70,125,32,38,14,175,186,42,95,209,150,104,103,18,252,201,140,127,188,47,117,119,12,253,205,246,94,83,195,113,107,207,125,216,207,94,132,144,245,56,113,158,
+56,163,41,57,234,55,96,35,129,33,167,56,19,163,98,24,231,99,236,133,185,242,170,17,43,252,98,42,35,255,215,145,57,90,9,186,0,52,167,1,139,90,28,246,208,27,217,13,218,86,12,21,176,22,176,128,215,2,102,155,96,150,185,124,197,150,191,101,208,64,176,107,
+245,129,53,134,135,236,232,147,167,142,45,208,134,66,51,216,212,184,177,169,113,100,165,100,107,48,32,120,59,164,235,166,151,184,144,47,107,159,198,79,72,35,96,215,100,70,44,170,7,213,197,147,217,178,188,233,19,17,110,99,82,178,157,28,154,205,93,142,
+81,173,242,123,141,251,34,18,183,111,91,108,111,173,241,236,153,229,118,125,172,134,188,51,151,87,30,224,252,202,172,251,67,187,188,8,90,102,173,158,35,112,95,207,151,86,57,8,155,56,130,93,251,27,39,108,105,136,61,94,157,205,201,222,126,245,4,82,101,
+117,141,190,186,45,48,6,73,179,98,216,51,96,239,180,170,57,213,120,100,123,74,78,5,64,119,242,234,218,187,46,213,30,102,101,190,232,208,23,52,19,0,191,20,28,114,85,69,115,4,40,159,180,49,124,132,16,221,32,96,200,217,240,193,68,96,206,160,204,125,236,
+122,153,162,154,128,16,39,184,71,113,15,84,125,159,10,72,142,219,161,164,49,168,69,1,195,188,194,231,125,111,177,160,93,120,71,123,43,6,224,88,1,85,76,186,247,144,159,95,204,41,93,211,55,47,232,245,214,181,155,144,56,174,233,251,135,133,159,170,240,126,
+247,144,189,68,53,33,53,206,101,237,173,35,199,153,176,112,29,36,28,81,233,170,202,209,37,255,116,124,16,130,14,246,125,54,102,102,64,119,250,72,0,58,115,156,90,123,157,142,121,54,245,100,61,168,88,181,225,119,142,58,116,97,255,18,128,77,22,131,235,236,
+128,74,170,30,250,92,17,31,241,156,141,204,242,203,28,118,224,9,222,90,46,218,106,167,254,243,18,171,194,137,125,208,74,174,234,119,141,247,237,119,104,176,110,43,222,90,176,87,105,107,215,143,215,42,223,158,92,178,36,108,34,241,243,83,27,86,16,118,192,
+0,28,216,65,85,90,136,233,88,175,208,2,235,198,176,53,81,184,166,16,222,33,48,235,196,238,128,191,195,154,174,237,77,54,158,91,20,102,208,182,141,56,193,159,108,116,183,193,226,135,131,236,188,193,247,39,213,58,76,140,61,133,103,18,226,35,174,79,70,108,
+91,153,221,16,0,161,24,107,175,74,242,126,35,135,219,45,20,235,60,168,120,9,84,172,216,17,25,164,26,68,251,189,244,29,2,175,19,22,28,183,246,134,239,30,34,254,197,104,67,178,88,5,6,240,30,183,14,249,100,61,88,123,209,78,173,2,14,72,97,181,93,34,206,178,
+205,166,224,227,212,228,227,86,96,221,178,83,173,105,199,143,87,5,60,223,16,54,255,100,226,25,71,213,235,55,79,47,185,26,143,193,10,234,95,223,155,55,4,99,136,214,136,47,55,122,33,194,43,209,205,110,20,179,215,20,159,27,127,199,15,166,245,11,16,207,219,
+248,223,196,0,223,115,54,59,77,204,50,97,243,220,52,65,159,69,226,0,232,160,80,237,142,122,193,133,231,155,52,6,235,214,47,44,22,176,32,49,249,244,9,14,44,39,254,194,137,152,87,213,182,194,107,188,110,211,214,11,177,156,211,29,95,13,21,193,61,189,17,
+223,248,228,57,201,75,211,43,242,240,120,74,233,55,34,144,14,130,111,219,206,184,51,62,205,233,110,189,3,68,220,2,194,122,237,154,229,42,204,198,251,25,100,225,15,138,152,246,6,131,72,204,204,189,183,64,181,219,68,111,212,114,208,160,219,31,148,56,199,
+237,189,81,217,221,19,145,116,117,152,33,218,174,220,244,107,31,142,217,219,67,183,67,48,210,84,181,249,250,249,172,169,129,123,27,193,16,24,93,2,92,61,16,54,127,124,62,43,175,207,231,141,10,206,122,113,14,246,97,103,178,37,121,195,99,9,123,175,207,15,
+216,120,77,199,81,221,83,237,8,91,42,87,228,76,182,108,116,107,184,117,77,33,164,67,240,29,180,24,155,34,9,242,163,51,254,241,160,140,185,216,133,135,53,244,134,190,232,186,193,127,110,175,163,68,157,231,206,101,140,33,245,86,170,244,32,48,208,39,219,
+91,32,153,187,116,106,73,62,53,222,219,242,187,196,26,137,245,206,141,125,153,56,3,138,52,55,138,166,239,102,138,129,215,21,182,59,148,36,133,117,174,223,215,48,104,175,123,22,11,150,103,156,0,84,35,191,216,6,29,178,97,228,117,149,205,131,142,95,177,
+243,5,65,100,214,233,219,70,220,5,237,197,183,13,196,55,9,82,72,24,96,34,56,146,6,188,31,252,7,132,223,189,139,5,249,248,88,143,244,70,27,139,141,240,14,67,149,19,125,137,215,115,95,213,178,102,169,188,234,106,149,53,42,228,204,78,207,197,243,250,171,
+243,89,38,120,124,200,163,195,9,185,121,40,33,29,27,206,79,232,136,129,248,137,170,170,231,166,121,112,218,10,8,65,67,177,46,75,131,115,176,254,125,199,229,33,48,216,91,207,113,128,171,163,212,174,169,120,240,154,126,227,228,146,124,105,34,221,116,79,
+110,196,11,103,249,236,183,2,2,241,129,209,158,134,34,20,214,209,59,183,37,141,78,73,38,196,253,5,158,229,103,38,151,228,19,99,41,83,113,16,58,48,116,91,202,212,179,49,81,193,36,197,21,112,206,64,231,9,226,235,235,211,81,73,69,186,140,231,21,137,48,204,
+9,192,172,129,87,103,179,60,143,248,24,12,114,131,71,111,163,117,24,190,247,232,120,124,117,38,27,202,2,206,48,130,206,173,207,86,109,92,205,2,145,248,103,211,153,182,36,244,59,190,243,131,63,55,252,173,255,249,47,115,161,253,146,62,189,45,105,76,32,
+55,3,132,6,136,196,65,121,128,145,145,121,108,71,175,237,223,227,118,224,209,46,224,35,135,236,174,25,15,202,160,94,131,48,113,223,6,191,110,6,175,235,193,245,185,109,40,46,137,6,29,4,110,11,234,91,5,95,82,245,48,69,229,13,19,58,254,195,172,104,132,195,
+20,4,35,157,137,139,199,183,247,202,142,94,245,10,9,84,118,161,194,83,39,16,221,111,25,110,61,80,11,207,12,44,29,8,113,131,39,175,233,107,105,141,134,152,28,29,34,186,247,29,51,159,109,43,96,237,161,51,190,56,56,218,99,58,65,132,189,252,235,199,217,210,
+238,71,16,163,221,60,24,111,120,102,65,18,224,208,92,222,181,68,57,238,65,136,33,27,147,189,53,152,236,37,65,6,29,201,102,139,90,164,250,188,186,97,255,212,110,172,104,110,91,17,52,221,178,213,25,182,6,238,11,204,227,104,87,215,23,133,226,38,64,48,197,
+36,226,173,2,63,124,57,65,171,28,197,228,230,39,175,237,183,253,123,116,7,189,58,128,72,124,112,71,159,165,118,174,160,46,236,36,220,140,118,119,202,223,238,234,107,40,16,111,196,109,113,105,99,59,215,98,121,85,142,101,75,20,136,125,138,213,202,66,240,
+205,163,11,218,14,155,56,152,171,216,57,212,120,121,122,197,21,191,108,60,211,15,140,36,101,108,195,96,17,248,30,46,22,43,242,210,12,171,150,136,251,236,77,116,203,135,7,227,235,238,83,220,163,217,242,170,188,51,95,112,45,238,180,251,220,127,247,196,
+162,54,193,78,229,179,162,181,29,149,221,196,159,224,108,55,24,185,178,111,186,217,162,141,189,230,241,221,230,172,49,220,72,246,18,210,110,172,138,196,53,220,40,36,104,55,232,208,62,48,214,99,235,127,5,85,215,255,229,216,130,31,254,92,75,224,62,249,
+72,58,102,230,189,99,187,0,0,32,0,73,68,65,84,216,172,213,235,145,168,32,158,202,150,228,173,197,66,219,227,134,134,42,168,19,83,247,252,14,54,81,188,32,14,98,200,68,189,127,24,132,6,55,61,219,218,9,196,19,60,112,170,83,219,107,28,15,152,215,21,30,86,
+51,62,81,27,65,182,252,190,124,133,149,168,45,168,137,121,177,234,245,45,84,214,100,166,80,97,171,141,7,65,144,255,196,68,90,186,76,122,42,98,115,251,226,174,62,215,14,153,198,61,228,31,171,74,178,5,168,124,181,42,18,3,28,74,209,190,169,3,120,228,170,
+10,70,168,134,124,203,165,3,49,132,116,183,45,37,8,105,133,49,120,214,131,247,41,38,141,171,62,247,56,115,233,18,137,177,127,195,82,194,42,240,136,134,192,204,88,214,159,24,214,50,30,73,142,91,137,31,81,109,252,208,246,148,156,214,152,236,37,230,128,
+192,183,7,2,86,178,251,242,217,24,250,193,217,108,73,222,89,44,210,243,122,11,238,109,96,93,105,6,84,222,30,201,148,2,117,109,17,243,218,21,138,85,134,209,251,1,232,140,110,207,185,104,40,20,95,40,176,106,164,6,130,183,176,249,87,226,129,131,47,142,42,
+168,32,12,218,53,195,162,174,42,158,255,213,112,194,115,3,118,188,2,2,141,59,134,19,77,175,237,61,165,85,57,52,155,115,165,194,142,52,230,177,241,148,233,32,191,6,14,153,16,249,126,18,128,129,159,196,61,224,73,172,2,14,49,240,65,212,81,149,132,117,30,
+182,67,42,123,232,59,115,121,238,19,132,248,16,136,112,168,246,82,105,161,125,89,99,133,216,61,195,155,125,221,205,2,155,41,10,197,196,14,176,104,177,26,63,138,230,100,47,217,26,20,208,53,243,191,198,89,14,5,82,120,221,189,82,150,239,77,45,51,166,217,
+0,170,251,237,104,44,7,182,37,229,207,39,131,99,5,132,251,67,117,239,148,106,129,197,43,220,151,218,70,67,117,230,232,50,179,64,97,6,15,92,198,70,230,249,181,0,250,242,238,179,225,159,3,145,226,35,10,3,18,131,206,103,199,122,140,44,226,86,2,60,254,27,
+126,230,179,54,179,141,196,25,208,246,107,117,250,124,13,85,145,143,16,169,14,188,81,21,56,192,29,67,246,61,208,204,2,111,122,171,157,89,248,121,122,218,19,226,95,208,18,108,245,185,71,82,73,103,117,216,142,148,186,127,58,172,166,70,77,216,77,17,210,
+8,220,59,170,62,222,181,100,47,113,151,154,5,163,153,106,88,124,215,255,112,109,191,33,140,146,43,220,148,178,119,31,227,218,239,142,89,175,70,246,50,47,206,90,143,153,107,96,32,57,147,17,237,99,211,211,11,129,144,237,222,225,6,15,28,134,129,168,160,
+59,232,213,193,141,27,60,27,85,152,176,185,49,4,13,8,191,86,38,122,226,103,41,22,187,207,253,54,60,24,33,242,109,28,14,72,136,89,118,247,168,11,28,98,36,157,244,6,214,223,158,92,50,186,107,204,48,185,92,50,126,158,16,226,111,240,28,79,154,44,182,193,
+44,15,221,201,33,51,115,5,182,226,38,138,117,68,145,59,76,14,79,108,134,206,100,47,217,140,138,5,35,126,246,51,219,237,15,200,15,18,227,73,123,177,44,152,112,224,119,120,9,232,78,63,155,206,24,213,193,86,64,37,50,59,142,219,203,166,136,225,5,14,222,34,
+85,203,141,31,77,46,91,122,104,241,192,6,177,34,106,204,129,204,221,160,130,23,81,80,129,31,177,21,145,184,6,222,115,99,192,54,71,191,97,87,108,99,194,132,168,146,214,44,244,218,5,129,47,134,56,98,56,93,179,14,29,84,80,224,191,63,205,246,76,66,2,1,158,
+99,60,207,136,159,27,9,198,136,169,49,228,248,155,199,22,104,227,64,66,197,72,194,95,201,94,178,158,7,182,176,9,220,10,84,192,62,204,142,194,203,68,21,172,87,54,18,115,224,119,120,13,232,78,79,29,91,48,149,104,197,62,250,243,51,153,192,13,246,243,34,
+235,122,64,112,96,161,249,56,169,129,123,97,238,228,162,220,59,156,216,82,216,67,213,20,236,38,130,122,239,56,177,32,219,173,72,14,18,247,216,168,74,13,154,55,147,223,136,216,124,22,20,230,144,17,226,107,80,237,128,215,198,169,243,115,165,138,103,134,
+11,17,66,156,165,54,16,91,170,93,105,32,87,89,13,221,204,19,66,72,48,80,41,240,169,177,183,63,70,107,45,210,146,90,162,21,123,230,190,116,84,174,78,70,214,37,39,160,55,29,207,20,57,247,73,35,134,80,12,101,30,30,31,44,223,38,27,193,65,246,7,211,43,50,
+58,155,147,107,147,17,73,119,119,202,85,241,110,185,144,191,212,82,251,110,166,24,248,192,183,224,192,98,100,199,243,57,72,192,87,73,117,40,160,84,51,211,16,92,40,176,184,131,29,143,88,226,47,240,172,222,144,138,202,246,170,200,177,84,174,200,108,190,
+98,76,247,119,227,249,67,112,168,234,111,8,42,107,238,6,149,94,154,58,79,8,209,135,151,138,40,112,222,179,83,184,112,88,195,64,208,70,160,19,109,79,111,68,250,186,187,36,21,237,148,76,113,85,138,171,107,114,52,83,228,217,149,144,54,99,215,130,17,231,
+62,196,148,76,148,57,131,19,186,132,151,169,79,180,18,119,233,70,11,212,43,179,57,30,96,200,150,24,135,220,144,6,99,211,14,108,108,115,138,38,237,65,227,106,197,65,104,245,108,143,117,203,185,18,125,212,221,192,238,33,179,200,199,192,243,32,152,191,127,
+91,207,38,81,118,84,186,229,186,180,200,93,35,73,195,102,8,195,39,116,102,244,209,166,125,151,141,110,132,201,12,131,78,66,72,184,153,206,150,100,167,162,207,48,246,255,115,101,189,103,69,236,71,159,24,75,109,26,158,85,43,56,216,209,27,145,59,134,19,
+134,109,34,133,5,111,83,88,181,119,239,184,157,236,13,51,187,18,246,207,110,137,46,60,179,60,4,216,45,122,48,126,7,215,58,162,137,78,84,139,122,93,36,198,164,125,12,65,194,139,83,79,137,110,16,124,90,53,88,223,200,81,14,136,52,72,59,48,49,123,36,96,211,
+94,253,68,166,100,47,200,155,201,49,184,241,50,119,167,99,198,68,235,86,65,236,7,7,227,242,133,29,125,198,112,19,157,204,229,205,13,135,219,8,206,151,207,156,227,252,5,66,72,184,121,113,70,221,211,241,119,179,122,91,199,33,18,99,63,218,40,18,111,4,162,
+241,99,59,122,141,253,139,120,151,119,151,236,157,131,152,236,37,65,224,176,77,61,0,29,202,172,204,38,186,176,159,34,106,19,163,221,157,242,200,88,74,70,146,221,155,218,157,31,18,145,229,98,69,222,153,47,112,24,4,209,194,59,115,121,217,127,149,154,25,
+63,68,230,183,92,106,215,35,196,73,94,154,201,202,193,157,125,74,191,17,98,221,79,52,31,52,137,121,112,40,255,232,182,164,233,138,113,28,222,33,22,63,165,209,51,252,71,103,50,242,119,215,246,91,182,64,249,35,189,241,8,33,196,168,8,126,123,54,39,183,12,
+91,139,103,113,230,210,121,222,130,197,24,68,98,43,29,76,216,191,206,230,203,20,81,60,202,111,151,139,114,192,70,87,218,171,140,31,93,35,232,86,7,58,65,113,38,186,249,85,61,159,15,241,57,32,26,64,97,238,129,209,30,177,95,222,215,6,14,142,246,200,147,
+123,250,141,170,166,102,7,194,222,104,151,209,134,250,197,93,106,162,5,33,86,120,101,62,111,76,168,87,1,254,223,52,93,191,196,140,3,1,252,201,156,90,85,33,177,207,145,92,217,56,48,170,64,177,206,219,192,110,194,234,1,78,247,52,107,136,28,47,156,205,88,
+122,207,145,133,2,19,20,132,16,82,5,235,33,214,69,179,96,207,255,250,113,189,67,132,49,68,219,234,126,132,159,199,62,70,188,203,203,138,157,61,184,95,117,219,158,144,43,56,98,193,104,179,35,49,72,252,116,38,171,52,187,232,189,234,112,100,66,218,9,116,
+216,135,182,167,140,61,213,115,66,49,62,28,166,99,154,101,48,222,45,255,120,221,128,219,31,155,4,28,8,189,63,155,206,88,182,160,224,162,190,158,191,56,224,171,116,74,177,253,156,56,195,247,39,151,165,98,49,241,129,131,38,197,58,239,130,106,98,85,207,
+52,43,251,181,19,160,42,233,153,83,75,166,214,98,84,206,209,114,130,16,66,214,131,117,241,215,51,89,105,101,251,122,106,185,168,93,36,70,53,177,106,181,29,246,177,81,27,3,147,73,123,193,254,109,37,73,33,213,248,145,251,184,187,192,130,209,206,80,118,
+20,90,113,22,214,21,160,41,60,123,102,217,82,1,218,228,114,201,16,152,9,105,39,176,249,173,63,215,117,13,253,245,19,95,241,202,21,127,116,56,33,55,13,198,45,191,175,179,163,67,246,165,34,242,91,139,155,15,33,86,88,168,172,201,177,229,162,76,36,35,146,
+104,225,181,11,17,227,55,23,114,242,220,5,138,99,245,148,214,68,198,34,157,50,164,56,212,14,194,251,31,104,227,225,42,153,213,53,121,127,177,40,251,210,49,233,50,225,81,11,95,217,255,122,98,41,208,215,196,239,220,213,31,151,171,123,34,74,127,5,50,206,
+167,151,139,198,250,168,139,139,229,85,121,109,46,47,145,202,154,244,116,119,72,87,71,135,224,127,30,47,76,194,63,190,84,148,31,159,201,200,155,244,52,36,132,144,134,156,200,151,229,213,139,57,201,21,42,146,234,234,148,53,89,147,14,233,144,11,185,138,
+76,101,75,198,26,234,70,161,195,45,189,81,217,109,99,30,77,1,30,158,44,40,240,44,135,51,37,99,239,30,239,137,180,180,145,66,162,226,255,157,92,14,243,229,242,12,131,157,29,202,113,226,235,23,114,114,154,150,48,235,64,204,124,120,169,40,189,29,29,178,
+109,139,97,129,53,61,225,199,231,179,198,25,154,144,118,1,219,223,79,237,232,93,247,219,61,229,81,124,179,141,22,86,84,22,67,5,167,103,49,105,39,200,136,194,147,19,67,51,246,164,162,198,196,229,122,144,113,61,185,92,148,215,231,243,204,158,54,225,149,
+217,156,236,74,69,45,183,21,98,179,124,133,85,169,158,0,45,128,95,125,127,222,232,0,217,211,23,109,40,24,231,202,171,242,135,139,121,174,201,62,96,123,82,45,248,175,113,117,188,219,21,95,72,220,91,188,191,8,33,68,29,84,121,254,214,67,9,120,187,67,143,
+99,154,135,172,18,235,96,223,62,188,92,148,123,134,19,70,82,160,254,60,128,88,127,46,95,145,87,103,179,134,221,25,241,6,63,191,152,147,137,222,104,203,225,146,27,65,37,44,59,107,27,131,202,98,8,192,208,12,110,74,69,101,56,222,37,125,221,151,174,239,108,
+161,44,231,11,21,99,198,17,237,43,221,3,218,226,68,106,125,226,242,173,133,188,167,246,76,167,192,108,184,141,120,70,40,134,224,96,117,64,205,70,110,27,10,158,80,140,42,235,137,190,168,164,34,93,151,175,15,90,197,50,165,138,81,53,197,118,110,119,120,
+173,206,82,2,109,110,131,145,46,163,53,135,180,6,2,58,124,155,15,140,89,243,146,195,123,194,44,190,195,30,0,213,236,181,67,16,252,158,97,229,225,102,0,97,180,3,158,91,145,189,137,110,25,175,171,18,199,1,128,126,114,225,193,238,193,158,16,66,8,33,225,
+1,49,98,45,134,244,34,40,8,26,79,118,95,22,238,192,241,76,81,14,103,138,161,61,139,124,123,114,201,24,98,108,86,44,134,181,194,15,167,173,205,149,8,35,184,159,206,177,232,193,83,124,126,123,74,118,54,233,108,121,168,39,37,15,174,93,154,189,19,36,29,110,
+36,185,89,22,246,140,80,188,35,101,175,162,9,180,178,3,240,19,152,54,248,177,177,158,134,149,122,16,140,49,204,15,83,139,63,56,24,151,95,78,175,4,50,179,225,23,140,5,158,213,195,150,128,200,158,175,172,201,253,99,173,7,104,161,186,224,165,233,21,121,
+51,19,206,123,124,127,42,42,247,140,36,37,213,192,119,239,225,170,29,7,42,173,221,188,7,81,245,193,202,15,255,82,180,153,108,112,98,72,37,33,132,16,82,96,245,28,113,145,173,98,110,120,96,99,144,62,226,110,248,197,134,173,210,19,127,47,196,226,7,170,250,
+195,86,188,121,33,103,84,33,19,226,39,96,191,240,196,68,186,165,181,34,180,184,91,170,197,156,186,125,252,219,1,10,190,26,21,236,122,198,163,248,190,109,73,71,126,15,124,143,252,238,77,5,145,24,211,6,59,77,148,88,227,103,208,250,13,143,177,179,69,30,
+214,137,127,152,46,86,228,173,133,130,225,207,212,31,237,218,180,40,67,32,126,235,98,94,254,199,217,140,156,10,169,16,245,217,177,30,249,200,182,228,150,98,58,252,158,225,23,124,118,165,164,213,39,150,4,135,225,238,78,185,198,70,178,246,255,187,144,53,
+188,171,9,33,132,16,91,172,173,201,205,3,214,231,213,212,120,253,98,94,46,176,120,131,40,128,42,226,7,170,211,254,183,2,113,247,245,61,81,195,99,54,108,190,177,248,123,255,178,82,50,196,114,248,129,71,58,58,12,219,69,188,230,10,21,57,188,80,144,95,204,
+172,200,31,56,35,130,248,12,179,34,113,61,177,174,78,249,80,95,84,222,152,247,183,189,202,173,189,209,134,231,64,79,121,20,147,43,34,177,85,140,247,76,101,88,89,76,124,69,205,159,73,206,103,13,107,133,68,215,165,12,126,174,178,234,138,231,169,151,128,
+72,108,118,242,55,130,218,131,59,250,228,153,201,165,208,95,55,98,29,180,82,162,74,70,5,78,179,38,132,16,226,20,136,97,32,58,53,170,232,108,5,222,71,27,56,162,2,42,137,173,88,226,193,126,1,54,12,152,91,19,70,106,118,9,156,19,65,130,194,99,227,41,75,34,
+113,13,116,249,195,170,226,59,83,193,179,89,161,80,236,49,14,140,90,243,109,173,7,239,165,80,76,252,202,37,129,147,34,39,184,49,25,49,45,18,215,128,88,252,169,241,94,249,47,199,22,218,249,209,136,3,212,188,231,99,93,87,14,194,133,202,170,107,190,243,
+8,248,81,29,98,245,158,3,175,211,39,159,16,66,136,131,188,48,189,34,143,109,152,190,110,134,87,103,178,174,124,13,104,219,189,127,36,41,3,177,245,237,187,149,213,53,57,179,82,146,23,103,178,156,219,224,97,122,58,59,12,43,60,171,64,44,126,120,40,65,139,
+5,66,124,14,214,240,193,184,186,44,10,63,99,84,36,7,109,157,247,140,169,239,154,67,173,27,75,62,254,130,48,89,177,85,187,203,86,224,189,247,217,104,215,34,132,120,131,187,135,18,74,159,3,21,56,119,43,136,125,68,15,232,24,249,199,235,6,12,95,43,100,160,
+177,102,215,94,53,223,249,127,218,59,104,252,156,110,224,183,151,177,88,25,12,113,57,172,222,225,132,16,66,218,3,170,130,255,52,103,173,82,209,173,253,232,201,107,250,228,224,206,62,67,100,216,232,24,136,234,52,8,8,79,238,233,231,249,204,195,124,36,29,
+83,62,127,239,237,103,204,77,136,223,185,95,177,171,178,158,123,134,213,206,238,94,160,89,103,128,103,42,138,51,165,138,113,80,182,139,159,43,106,175,79,219,23,7,240,59,130,220,6,130,140,207,45,233,152,164,35,151,238,149,197,82,69,222,94,44,112,144,22,
+9,12,163,145,78,99,96,134,42,123,82,81,99,88,32,241,22,102,109,133,112,208,196,207,141,205,234,157,166,11,27,152,103,207,44,203,39,198,82,166,38,90,227,80,254,131,105,111,78,43,39,132,16,226,111,96,75,86,168,172,201,254,171,90,31,190,33,42,27,54,102,
+154,249,210,68,218,244,217,21,246,78,61,93,29,129,154,146,31,20,38,82,234,231,111,20,104,192,58,143,182,111,222,0,177,118,95,247,149,58,72,90,99,88,3,58,203,135,7,227,50,150,92,239,87,11,157,238,208,197,124,96,59,215,83,17,251,26,228,213,73,127,27,53,
+228,202,171,146,232,94,95,67,236,153,191,8,45,183,183,216,84,226,151,125,62,204,205,137,155,212,137,223,225,69,144,137,255,171,225,196,166,140,239,168,116,27,217,92,12,62,251,221,108,142,27,130,9,112,45,145,80,192,189,130,235,137,106,254,210,234,154,
+76,103,75,242,155,185,60,69,119,151,25,180,249,12,143,250,124,163,10,34,104,71,178,234,61,143,253,240,200,74,73,235,243,136,131,14,38,90,223,59,16,151,125,131,141,59,92,80,117,140,246,94,86,18,19,66,8,105,39,104,233,127,55,83,148,59,6,227,178,43,21,221,
+180,39,77,46,151,228,183,243,121,87,124,137,31,173,118,6,89,193,141,125,157,180,102,208,68,114,124,43,16,183,83,40,118,15,196,216,143,140,165,26,22,217,32,65,3,125,232,249,233,21,62,119,91,128,107,8,143,222,102,246,11,131,93,221,198,57,230,64,101,77,
+158,62,177,24,56,139,5,59,29,253,53,234,237,4,253,200,31,46,230,55,205,171,241,140,162,128,12,235,7,7,227,74,38,210,53,158,247,121,117,83,196,198,223,94,195,137,27,221,107,124,113,87,95,75,223,24,252,221,184,185,33,128,126,227,228,82,224,174,129,19,32,
+75,8,15,219,141,247,8,42,24,241,239,208,30,135,215,185,149,178,124,243,52,175,161,91,236,74,216,91,150,131,184,6,248,157,207,41,120,45,2,60,175,95,125,127,94,235,95,143,202,98,28,206,241,130,87,246,88,172,75,98,157,29,178,88,94,149,179,249,50,15,67,132,
+16,66,180,129,61,231,132,113,190,91,185,60,244,216,11,3,143,111,86,180,8,251,248,88,143,28,57,30,206,1,104,94,197,110,220,60,18,235,18,9,222,28,43,95,96,166,91,15,9,29,216,195,28,89,40,200,51,231,216,9,183,17,136,196,79,76,164,77,105,112,120,86,96,165,
+243,139,169,12,231,98,5,12,20,91,222,54,20,95,87,85,236,41,233,251,151,54,132,222,83,203,69,102,138,28,244,122,246,10,102,68,226,122,240,179,104,5,35,235,193,70,138,77,210,76,48,132,140,236,151,63,48,96,108,28,68,63,139,28,120,18,40,240,28,169,218,42,
+225,121,221,107,51,113,96,7,84,105,33,112,128,104,12,59,19,138,196,132,16,66,220,2,123,16,246,37,183,247,34,116,230,109,244,35,54,139,19,54,139,196,89,172,206,103,216,200,73,234,15,174,96,214,210,173,6,58,144,15,142,90,31,90,24,116,30,223,109,78,36,174,
+7,215,61,72,58,65,208,244,51,85,190,123,114,201,24,194,90,195,83,223,48,50,19,200,246,88,5,45,5,223,153,242,127,42,175,180,106,255,46,117,226,119,120,5,4,98,42,19,40,17,132,61,234,99,67,113,167,193,66,254,224,213,214,218,222,33,80,169,86,65,18,123,204,
+219,12,88,81,17,78,188,195,29,54,7,157,220,194,225,132,132,248,22,36,122,112,48,197,192,171,218,11,255,204,68,44,33,254,197,142,167,173,84,207,55,196,59,204,229,237,37,30,230,74,76,162,235,70,229,108,43,85,177,216,141,129,209,94,5,241,136,106,69,125,
+144,116,130,124,197,126,145,150,221,117,196,11,192,82,228,91,199,23,13,75,87,241,146,245,68,13,180,4,220,190,82,146,143,141,245,152,202,110,4,169,141,0,70,225,240,128,177,251,59,130,194,157,219,212,39,80,162,37,140,3,35,46,1,207,33,149,202,7,8,238,8,
+102,233,251,172,23,84,203,60,82,89,83,222,184,103,11,20,138,189,196,72,34,98,235,211,164,3,234,59,79,136,93,48,248,115,123,172,251,82,219,111,181,170,235,84,190,108,216,167,184,13,14,177,56,68,53,170,30,172,205,86,64,82,239,185,233,140,39,188,254,122,
+58,59,100,103,188,251,178,245,145,151,174,37,33,132,180,147,163,153,162,236,232,85,139,213,230,243,21,57,103,179,192,131,88,7,158,196,170,85,253,7,70,123,104,155,80,229,58,27,197,40,136,111,144,12,15,66,71,255,100,166,100,196,101,118,120,107,33,24,122,
+9,98,82,216,30,34,137,224,201,169,71,120,120,241,194,7,220,145,138,108,154,192,7,149,27,131,183,94,156,201,6,202,76,251,165,153,172,97,15,96,247,119,4,1,100,251,84,55,0,169,250,238,82,228,188,116,88,85,169,202,174,1,175,154,176,95,67,55,120,103,46,111,
+106,210,119,35,94,231,247,69,8,9,48,240,41,189,127,91,207,166,193,53,251,171,255,247,189,197,130,252,116,38,235,154,200,105,182,29,22,159,31,190,128,168,222,112,43,150,133,216,126,239,112,98,211,97,177,254,90,190,50,155,163,16,66,8,9,44,176,214,186,99,
+56,33,169,136,245,78,143,215,89,148,228,10,35,54,6,119,215,108,221,194,110,89,106,87,107,1,31,30,140,203,145,0,116,245,163,232,244,159,210,49,229,235,1,109,50,104,201,7,92,19,79,143,199,15,155,225,56,22,44,216,104,168,250,87,225,189,65,89,244,110,237,
+183,223,150,133,214,176,176,139,156,118,219,222,55,38,105,136,30,94,153,207,203,68,111,84,6,44,78,98,126,243,2,15,244,94,99,177,84,49,42,8,85,41,172,242,251,36,164,198,221,233,152,28,24,219,218,99,16,162,231,63,164,162,242,204,228,146,118,47,83,36,103,
+173,120,38,162,115,14,98,241,191,190,167,119,104,165,84,175,229,71,183,37,183,236,94,193,181,220,229,210,181,36,36,168,44,113,22,133,231,120,246,204,178,28,220,97,110,150,75,13,36,210,222,204,176,50,85,55,216,103,237,10,156,176,117,11,187,80,124,67,159,
+125,11,142,193,88,112,186,30,255,120,49,39,183,40,90,151,190,28,80,205,146,42,144,199,248,254,228,178,146,161,54,222,131,247,146,43,244,68,108,238,34,1,192,110,219,187,84,51,142,68,47,168,132,251,217,116,230,178,71,144,25,16,176,98,232,24,241,22,111,
+47,90,247,221,175,231,221,37,30,66,8,17,147,34,113,13,28,246,113,232,223,173,249,16,163,226,217,7,177,24,222,197,58,185,49,25,49,174,165,25,81,196,173,107,73,136,87,177,219,98,204,182,119,239,129,68,216,75,211,43,166,227,110,196,220,63,176,49,132,159,
+168,115,147,3,231,82,218,186,137,196,58,237,203,128,177,174,224,72,137,176,44,85,153,149,134,247,4,117,77,247,116,69,113,24,65,251,225,11,103,51,134,65,187,217,108,25,68,98,188,39,72,54,28,78,208,109,113,130,39,105,76,31,171,138,93,1,65,235,83,199,22,
+228,111,182,247,110,106,177,174,7,65,237,239,102,115,161,175,158,247,42,168,88,40,42,122,78,99,109,231,129,146,232,4,149,58,240,254,187,42,209,181,110,78,4,166,32,159,89,113,207,242,11,30,186,31,181,56,183,0,207,220,39,198,82,242,212,201,197,182,125,
+174,122,208,202,170,218,17,102,167,141,214,42,184,150,143,88,168,122,22,23,174,229,70,112,109,63,62,214,35,169,72,215,186,216,24,247,229,133,92,197,51,94,207,36,28,96,95,62,160,184,175,115,224,176,119,65,117,240,212,201,178,60,184,173,167,169,103,113,
+166,180,42,135,102,115,134,93,5,33,36,88,192,205,224,209,242,170,169,202,98,156,209,94,63,159,13,244,249,155,66,177,7,65,0,114,250,216,66,211,65,40,245,192,110,2,149,196,12,144,55,179,88,224,53,113,2,182,200,185,7,42,139,191,121,122,201,168,254,218,151,
+142,74,95,119,151,12,198,187,100,165,180,42,133,202,154,28,207,20,229,141,197,2,7,14,121,28,8,249,119,141,88,31,206,249,71,86,136,19,141,60,58,156,104,26,28,67,52,222,217,27,149,39,123,163,242,246,108,78,251,176,216,123,7,226,74,162,12,236,123,246,167,
+162,90,218,131,111,177,49,20,6,226,39,186,119,116,36,134,62,146,142,121,254,90,214,243,249,237,41,227,222,107,4,238,75,36,82,159,220,211,47,191,158,9,246,129,141,120,11,180,26,91,177,153,145,170,176,128,164,6,241,46,176,111,123,122,106,217,240,111,191,
+54,25,145,116,93,177,12,134,124,98,224,52,113,151,51,121,251,201,150,197,0,13,255,87,101,38,87,218,178,16,201,12,115,249,224,93,71,196,183,135,22,10,13,139,38,196,3,133,19,58,161,80,236,81,112,227,125,253,248,162,81,69,1,163,240,109,137,110,233,170,150,
+81,84,214,214,228,124,174,44,191,153,203,7,214,95,199,137,197,139,155,128,51,215,145,21,141,238,131,192,148,193,169,127,129,120,49,20,235,178,52,81,119,46,95,214,46,198,145,240,130,225,193,102,239,79,136,201,241,238,78,173,115,36,236,76,163,222,211,27,
+209,34,110,218,109,101,221,221,19,209,178,223,98,126,131,42,186,174,101,141,47,238,234,51,61,144,23,201,184,158,174,14,174,155,68,11,120,86,119,47,20,44,173,77,94,232,254,132,0,58,24,233,146,92,101,149,190,227,91,0,193,248,28,171,134,61,9,180,15,36,93,
+236,248,20,219,181,133,11,2,16,67,85,61,121,107,64,103,8,34,88,167,81,168,85,3,137,124,20,206,133,205,215,154,66,177,199,193,13,25,132,105,146,86,65,160,111,119,241,122,149,135,5,219,155,64,142,213,196,196,103,160,173,26,21,115,16,67,80,125,141,202,57,
+180,10,34,235,125,52,83,116,173,93,16,162,218,65,147,130,23,90,83,235,3,20,66,218,9,2,96,171,66,44,126,126,239,98,65,91,208,172,50,141,190,6,58,49,252,128,46,207,68,59,201,99,157,215,242,190,129,184,105,145,184,6,226,29,196,61,236,178,35,58,192,190,126,
+95,161,34,119,110,75,110,41,90,193,126,10,195,210,220,18,25,32,14,223,59,156,48,6,83,214,119,19,224,115,157,204,20,229,208,92,158,162,177,143,64,17,217,120,117,109,68,117,109,24,135,178,205,100,203,202,123,25,238,251,176,15,178,147,170,24,138,206,116,
+85,203,44,136,245,97,73,204,134,181,104,142,66,49,241,44,16,75,84,55,1,188,151,7,133,75,155,0,42,19,173,30,182,106,252,225,98,184,218,56,17,124,221,63,146,52,124,16,107,193,52,2,138,76,169,34,135,46,230,89,93,237,113,208,22,125,127,131,1,77,16,153,240,
+130,231,220,109,3,113,99,80,160,27,135,34,28,42,33,174,193,107,179,81,96,134,128,237,249,233,21,6,176,68,43,7,70,205,13,136,219,8,238,227,35,199,221,241,172,13,34,126,232,130,66,242,77,23,119,90,244,164,174,241,216,120,74,190,113,146,137,54,162,7,116,
+12,225,133,174,140,29,169,200,229,238,79,80,168,172,202,59,243,5,87,45,81,182,26,2,138,88,233,186,116,204,120,189,121,33,199,129,200,30,166,54,63,0,126,246,27,147,18,16,236,32,156,134,201,171,29,127,43,44,135,84,248,29,11,201,46,131,51,199,193,157,106,
+195,116,105,143,23,124,40,20,19,207,130,138,186,127,188,110,96,147,55,76,43,42,85,95,87,114,137,31,157,201,200,223,93,219,111,185,69,7,2,115,88,252,254,16,128,225,112,217,72,80,71,32,61,216,213,109,120,209,221,91,94,149,239,158,92,98,18,194,131,108,117,
+24,170,7,62,155,152,224,255,204,228,146,43,98,177,209,37,82,21,215,112,223,97,122,243,225,229,34,239,169,144,128,138,247,235,147,17,25,137,93,18,220,10,171,107,114,60,91,114,173,154,11,201,49,21,191,90,128,100,7,238,97,222,187,151,128,208,59,106,35,172,
+62,177,226,253,22,78,93,126,132,168,114,87,109,43,86,77,140,59,193,198,231,27,44,150,87,229,173,229,34,103,9,4,28,157,86,60,102,49,27,23,129,253,87,37,36,214,213,33,63,62,159,245,194,71,39,117,96,61,220,106,200,61,254,61,10,171,112,214,131,189,73,24,
+138,90,16,119,192,151,222,234,252,15,20,146,209,203,254,10,198,153,196,162,133,142,208,30,47,52,116,13,253,245,19,95,9,251,69,32,222,229,253,197,162,220,218,31,147,78,147,39,6,136,196,223,58,190,40,25,6,228,151,193,181,200,21,43,178,167,207,188,47,33,
+42,27,255,235,137,112,136,237,16,58,158,152,72,75,143,137,182,223,72,103,135,113,63,226,190,228,61,230,29,118,199,186,228,223,92,211,107,250,243,32,249,116,125,95,76,222,90,40,72,201,197,175,17,247,208,137,124,153,247,82,8,128,128,244,201,171,146,242,
+241,177,148,92,223,31,147,171,123,34,198,235,154,84,68,110,30,136,203,254,116,76,74,165,85,153,46,234,21,140,111,237,141,26,159,65,149,66,105,213,184,135,219,205,126,197,1,108,224,108,174,36,135,51,237,23,97,47,230,43,178,127,48,174,244,94,84,132,125,
+255,172,30,155,177,189,137,136,164,162,106,86,30,115,133,138,188,173,65,132,184,255,170,132,244,199,212,171,151,115,133,138,156,213,252,44,61,60,148,144,71,182,175,127,190,241,218,221,27,149,59,135,18,50,212,217,33,167,115,101,87,247,28,18,30,172,198,
+69,0,243,112,102,179,101,185,80,98,242,207,43,64,36,70,161,138,153,99,48,126,6,103,61,55,214,63,55,64,236,129,154,226,209,164,185,24,134,182,110,141,65,124,100,245,58,254,63,147,188,142,97,192,84,164,136,3,14,166,238,195,47,12,129,16,254,255,81,27,126,
+113,132,152,5,25,195,127,125,111,222,88,148,90,129,236,22,68,98,86,55,109,6,217,229,111,30,93,48,108,20,90,129,107,253,245,16,181,19,127,110,71,175,165,170,117,252,236,227,187,211,109,253,76,196,26,247,111,179,222,58,15,209,233,222,1,53,81,135,16,43,
+224,192,254,133,29,125,242,193,193,120,83,177,19,214,40,15,143,167,228,179,38,171,191,156,194,206,96,51,48,100,67,204,179,194,73,27,226,228,209,101,61,149,186,136,61,204,196,42,141,208,217,194,121,220,198,48,186,163,154,6,217,197,58,237,157,49,250,186,
+245,157,81,112,70,250,135,93,105,163,34,115,171,100,6,158,127,172,3,61,22,187,228,8,81,225,158,97,53,235,150,3,138,150,47,164,61,124,76,33,38,64,245,113,88,64,85,235,51,167,150,140,2,167,102,224,236,139,234,99,138,196,205,193,117,132,78,176,213,117,196,
+127,251,197,84,134,215,49,68,108,217,159,5,65,248,238,161,196,38,159,216,253,213,255,139,128,248,181,139,57,78,227,39,109,7,139,18,42,63,239,25,78,200,213,201,110,137,117,93,58,4,84,214,214,228,124,174,44,47,206,100,41,16,183,0,215,231,171,239,207,27,
+217,233,59,134,226,134,15,111,61,211,217,146,252,102,46,31,42,127,84,36,191,84,76,252,113,24,124,116,56,193,182,27,15,0,17,78,213,203,124,223,96,156,158,124,164,173,64,20,250,196,88,202,176,60,49,3,188,34,31,46,174,106,187,47,11,171,246,246,205,188,166,
+125,247,245,249,188,113,109,172,86,21,99,144,229,155,154,196,77,169,250,38,162,67,197,74,242,17,135,47,157,123,201,27,139,5,249,171,225,173,69,205,70,224,90,186,53,12,212,203,124,198,194,243,141,159,131,88,252,212,73,122,123,147,246,129,125,7,51,25,84,
+192,61,138,184,138,195,237,220,7,190,215,86,237,23,165,90,89,140,247,122,209,14,165,29,212,91,186,225,92,135,4,118,188,171,67,166,178,101,90,187,89,0,215,169,86,40,6,173,160,62,225,74,187,142,112,210,244,116,253,233,109,73,35,251,189,21,56,156,63,214,
+211,43,251,22,11,242,131,233,112,44,70,196,61,176,128,133,101,211,107,39,168,46,230,80,182,75,236,27,176,230,201,84,207,117,240,115,162,80,236,58,19,38,91,165,26,1,161,132,7,34,210,78,30,24,78,152,22,145,106,160,50,241,247,75,5,57,167,161,253,23,7,169,
+157,189,234,85,197,43,38,186,84,156,0,215,226,87,231,179,166,253,54,107,60,123,102,89,203,231,171,129,56,5,157,77,102,197,98,136,196,186,59,120,224,149,251,210,244,138,81,193,110,22,84,100,233,188,150,51,185,146,114,2,16,28,214,20,227,192,3,214,170,32,
+135,245,0,221,153,76,82,146,118,177,211,166,79,247,213,241,110,198,69,30,96,183,141,189,217,176,27,12,225,153,153,130,166,51,80,39,32,210,204,122,2,173,143,173,68,226,122,80,229,241,228,53,106,19,19,9,33,196,45,84,170,137,107,36,52,182,182,146,230,196,
+108,182,241,38,186,248,61,146,246,128,170,46,43,177,84,61,247,14,39,180,124,43,118,15,85,58,15,101,168,102,125,217,100,81,2,132,205,159,159,201,184,34,118,212,91,102,173,53,209,209,241,239,223,158,205,185,102,243,132,42,107,43,215,18,194,178,206,107,
+121,104,65,189,114,25,179,42,116,85,144,221,166,104,95,100,117,112,16,33,58,73,51,190,245,4,170,190,252,82,181,201,35,132,16,59,108,74,57,34,203,13,225,215,42,200,252,163,10,57,136,211,82,225,199,60,88,215,166,127,42,95,230,244,98,66,136,209,154,195,
+172,43,33,164,17,215,219,168,118,223,101,120,7,235,169,6,130,191,255,160,66,5,154,170,31,175,29,32,22,207,151,86,27,218,162,213,152,92,46,201,11,231,87,180,84,100,111,69,205,199,15,251,196,238,158,136,164,35,93,178,88,170,200,137,149,146,39,246,13,92,
+203,179,249,178,225,241,222,236,90,190,183,88,144,87,102,115,218,175,37,132,94,84,91,171,36,115,143,46,233,185,182,72,4,89,237,22,168,1,79,114,118,179,16,66,8,33,164,17,136,49,62,146,142,25,179,68,6,227,93,70,226,8,137,251,185,124,197,152,53,1,27,177,
+118,235,145,235,34,67,8,162,104,121,84,5,149,51,240,145,115,59,56,119,10,248,220,220,60,24,55,2,186,141,204,231,43,242,135,249,60,253,218,8,9,49,58,7,230,144,198,20,108,110,146,185,10,189,203,72,123,24,177,49,232,205,78,37,145,85,126,116,38,35,79,238,
+233,183,244,46,84,196,194,143,215,13,48,23,3,47,8,109,176,158,169,117,21,44,150,87,229,88,182,228,185,24,212,203,118,79,16,42,141,25,16,145,78,217,30,235,190,124,207,206,20,42,242,151,108,201,213,162,136,239,79,46,91,190,47,113,136,210,101,81,102,183,
+189,255,82,55,11,133,98,226,60,118,227,154,147,33,154,85,66,8,33,94,3,26,100,163,89,18,248,103,36,246,241,194,127,127,103,46,223,86,27,171,117,81,206,157,14,76,128,199,239,240,123,85,49,14,31,173,134,207,224,191,193,43,239,198,190,152,124,111,106,153,
+21,198,132,132,16,122,97,185,207,225,76,81,238,26,81,155,210,13,81,129,21,93,193,1,129,213,245,233,232,186,65,157,153,82,69,14,93,204,251,178,242,31,226,157,14,209,19,213,155,152,100,253,208,118,243,158,181,47,156,205,184,62,32,6,207,46,159,95,103,192,
+125,118,174,84,20,113,71,251,111,136,213,251,18,150,19,79,159,224,144,184,86,96,200,213,142,84,68,226,93,157,198,208,43,36,125,242,149,85,153,204,148,56,7,36,32,96,93,196,240,201,70,133,78,173,64,92,196,33,245,132,16,226,14,176,0,54,227,238,0,209,24,
+5,190,189,209,206,182,205,138,91,39,20,111,183,209,38,89,99,23,140,215,125,44,20,67,36,62,184,163,207,116,53,15,20,125,76,48,254,246,228,18,197,98,178,37,251,83,209,117,21,102,94,173,126,10,19,8,136,85,43,247,154,121,79,18,189,24,2,199,74,89,105,240,
+17,50,177,196,255,236,77,116,203,167,198,123,27,62,203,131,93,221,134,208,116,160,114,73,68,242,211,244,107,157,123,3,132,244,165,83,75,77,175,99,141,162,15,175,35,241,47,181,251,242,145,237,169,45,231,2,96,15,168,89,125,232,194,111,221,40,72,164,221,
+185,45,105,136,195,245,224,159,113,109,225,155,252,143,125,81,249,229,244,10,45,181,2,192,161,217,156,229,225,159,194,184,200,83,168,218,239,128,68,114,96,118,0,0,32,0,73,68,65,84,28,247,104,215,64,146,31,133,147,208,213,234,139,14,177,79,253,121,169,
+32,111,45,23,169,25,145,134,168,88,0,227,231,63,93,89,107,75,161,110,215,208,95,63,241,149,218,63,60,56,106,125,67,217,8,14,24,175,206,250,115,146,47,188,64,254,253,206,62,203,67,170,240,243,187,227,17,99,74,57,33,27,193,67,255,127,140,247,202,245,253,
+49,185,186,39,114,249,133,105,182,251,7,227,50,22,233,148,139,200,254,115,211,208,206,246,104,151,12,43,182,143,206,100,203,124,230,61,194,124,161,44,55,91,236,136,129,224,245,63,206,102,164,196,199,206,215,192,255,245,223,92,211,219,114,112,11,254,59,
+214,219,92,161,34,103,139,122,170,80,35,29,29,114,163,194,204,7,49,42,161,87,229,13,205,29,11,23,203,171,242,218,92,222,184,70,169,174,78,35,158,171,172,137,241,186,144,171,200,175,46,100,229,153,233,21,238,85,68,43,184,47,127,61,151,151,153,149,146,
+164,186,58,4,121,140,14,233,144,197,98,197,168,130,253,241,153,140,188,186,160,95,220,90,168,172,25,98,128,234,208,168,95,204,100,181,237,63,143,14,39,228,246,6,34,241,70,58,59,58,100,79,95,84,235,58,73,218,195,233,66,69,110,78,69,45,157,105,97,171,248,
+236,204,10,227,34,143,208,35,29,114,77,74,173,136,239,183,23,114,114,34,79,11,17,221,224,204,255,201,241,94,217,150,232,222,244,236,165,162,157,198,217,127,95,95,76,150,10,21,185,192,66,49,82,7,18,12,184,119,84,192,253,54,155,45,59,126,79,217,51,216,
+10,24,247,14,52,246,35,54,3,170,217,80,49,138,73,210,65,165,126,168,31,7,250,181,6,137,7,84,155,183,26,118,130,76,16,6,23,61,51,185,196,54,90,205,160,205,242,159,210,177,150,135,167,70,184,229,207,73,54,131,231,6,19,252,205,86,207,24,62,150,236,2,241,
+61,163,221,157,242,224,213,230,237,18,192,199,198,122,180,85,203,161,125,247,65,197,246,223,35,11,238,37,161,188,236,169,75,194,203,145,92,89,142,76,121,107,223,197,176,63,204,103,81,121,159,174,253,7,29,23,183,12,91,155,63,163,115,157,36,237,3,221,174,
+102,206,33,82,21,137,217,29,235,45,96,111,119,219,80,220,114,1,27,170,137,105,141,167,31,179,150,1,136,9,31,219,209,43,3,211,43,156,117,181,5,27,231,80,72,181,27,59,168,21,217,247,90,220,167,55,114,251,64,220,113,219,160,117,21,197,118,63,96,13,191,86,
+20,127,242,234,148,173,1,50,177,142,14,121,59,96,129,21,196,225,79,140,36,229,147,99,41,185,99,40,97,84,71,225,117,231,80,66,246,167,99,2,89,230,124,177,194,236,243,6,204,138,196,53,80,145,114,125,95,76,206,174,148,140,42,21,162,143,92,177,98,84,208,
+88,225,215,51,89,121,135,30,110,158,2,213,51,43,249,138,140,37,186,183,92,199,141,138,153,169,101,38,101,2,192,191,219,222,107,120,115,89,1,21,115,123,19,250,58,128,186,86,215,140,10,18,43,176,218,157,16,127,112,58,87,150,253,253,214,170,138,241,124,
+255,207,179,25,109,149,249,255,97,71,175,196,186,172,175,147,187,98,93,129,59,211,132,13,236,33,135,151,138,18,93,21,163,123,174,217,125,250,167,185,188,252,104,122,133,34,177,7,57,190,84,148,91,251,99,198,51,105,134,75,94,237,75,236,252,209,12,42,137,
+247,89,76,26,34,54,60,189,92,228,185,127,3,16,136,255,237,213,189,114,215,182,164,81,81,191,177,27,27,26,212,80,103,135,177,255,6,41,78,134,214,166,218,161,4,210,177,46,121,115,46,239,232,53,89,87,81,172,106,124,95,79,209,167,55,59,110,74,187,127,251,
+142,94,251,30,207,94,226,238,116,76,62,186,45,217,84,116,193,245,194,16,169,155,7,227,242,236,25,10,47,245,160,58,221,172,72,92,3,215,25,67,20,159,58,201,97,44,58,49,170,102,44,12,204,129,72,204,76,189,55,65,71,7,38,245,223,218,27,149,61,169,168,12,198,
+47,173,235,16,135,47,20,202,114,116,185,20,232,174,143,176,161,226,75,13,70,146,250,154,169,80,45,50,158,236,182,228,57,246,220,84,134,7,118,66,124,0,158,83,116,167,88,153,109,242,171,243,89,173,254,227,170,30,167,227,61,193,58,211,132,21,220,163,152,
+138,255,202,124,222,136,141,210,117,213,169,94,171,206,131,149,84,95,245,243,45,149,87,89,213,94,29,234,249,173,227,139,242,216,120,74,6,91,88,229,205,229,203,242,163,51,238,15,154,13,27,40,14,179,42,18,215,184,127,91,143,118,127,125,47,3,237,201,76,
+119,40,58,121,224,1,253,179,233,76,32,244,39,232,144,118,138,85,107,236,140,119,59,90,85,188,110,197,57,155,45,89,54,80,222,200,185,172,63,253,112,6,35,106,129,212,70,110,76,70,2,49,45,214,236,131,42,85,193,24,65,50,173,19,46,97,103,195,128,184,140,107,
+207,86,20,189,32,24,61,125,116,65,30,25,75,53,21,159,48,84,226,251,147,203,12,192,170,67,113,246,13,196,36,21,233,186,108,219,129,225,126,153,82,69,222,153,47,184,42,164,227,192,131,231,135,207,80,176,185,221,98,149,110,61,184,103,97,91,161,235,89,198,
+52,98,12,154,104,213,162,142,68,59,68,98,78,156,39,196,63,32,238,69,252,139,65,144,91,21,156,224,249,126,105,122,69,107,178,242,62,139,222,253,245,216,169,108,34,222,163,22,27,121,13,236,197,205,98,239,7,215,46,205,3,129,213,91,152,99,111,252,237,223,
+56,185,100,216,200,220,63,146,52,98,239,154,168,132,10,98,248,181,31,186,152,167,176,238,18,31,73,199,148,69,62,220,247,16,9,169,159,88,211,158,164,170,153,96,223,253,111,39,22,125,95,92,145,176,216,245,163,139,117,171,242,59,139,69,219,66,241,159,124,
+122,56,31,137,57,35,20,7,1,136,221,86,39,229,98,129,132,88,252,212,177,133,208,87,66,33,99,111,39,43,132,74,72,138,92,250,65,32,86,203,234,178,170,161,49,8,232,63,183,163,183,97,133,18,196,55,252,123,116,25,64,68,166,168,78,218,73,159,69,207,190,141,
+220,212,27,149,115,26,19,26,152,70,124,36,83,50,60,196,54,118,31,161,155,11,158,196,168,248,10,251,254,73,136,31,193,33,31,135,85,196,127,55,246,197,214,137,94,152,116,127,60,83,148,55,52,250,18,59,5,98,33,198,63,164,93,224,254,194,156,129,102,174,10,
+70,82,183,167,91,158,152,72,203,47,167,87,66,127,47,26,62,237,39,89,125,234,53,38,82,234,133,11,224,134,84,84,78,20,252,105,219,234,20,40,178,67,23,187,85,144,156,253,228,72,210,40,200,32,206,179,78,40,70,21,203,221,43,101,229,118,78,4,67,126,109,235,
+157,97,38,231,50,15,90,20,137,107,64,28,133,229,2,90,156,194,76,218,166,128,49,104,209,178,130,56,79,216,131,209,70,64,36,70,176,110,166,202,8,130,49,126,22,237,114,20,139,9,185,4,98,172,90,181,112,109,56,44,171,135,9,9,6,65,236,102,129,7,36,33,237,0,
+213,177,102,45,223,16,119,226,103,151,78,45,25,98,41,33,94,194,238,185,61,230,128,229,128,223,121,96,56,161,92,100,135,34,215,209,217,156,86,75,39,167,153,43,57,163,67,230,42,206,94,131,77,138,214,247,166,150,149,124,134,141,150,201,115,222,154,70,108,
+5,167,190,32,191,31,250,236,122,53,171,90,46,4,9,120,230,216,193,174,87,54,33,237,0,254,104,86,90,81,241,179,120,15,33,237,96,201,102,2,226,176,203,201,32,4,180,20,137,9,33,237,228,76,222,158,168,198,68,47,105,23,104,25,183,138,202,123,8,105,55,118,189,
+101,251,28,178,63,245,51,187,108,216,201,129,15,245,217,115,68,112,27,156,9,50,54,133,110,104,177,78,91,152,108,42,29,174,13,102,104,229,181,181,241,131,225,61,126,86,242,113,97,237,14,243,155,92,246,255,161,239,6,155,237,19,88,44,131,226,211,172,202,
+82,185,34,163,155,31,45,66,124,11,42,63,90,13,209,104,4,222,131,247,178,2,196,255,160,2,246,206,129,184,12,199,186,47,119,29,213,134,4,30,154,203,107,247,87,67,213,63,252,11,77,14,2,95,7,60,253,40,128,16,66,130,14,246,222,53,197,117,50,231,210,26,9,159,
+202,219,54,12,132,198,57,19,51,112,126,59,159,103,130,45,0,192,59,91,69,92,195,123,104,135,66,188,6,98,97,171,3,236,235,185,96,51,161,231,119,112,190,176,91,36,103,20,233,249,188,163,29,22,116,251,175,74,40,191,255,100,27,92,29,26,158,252,107,94,91,240,
+252,104,229,89,252,222,98,65,126,58,147,13,132,175,158,221,47,232,183,46,14,112,114,138,171,20,196,160,141,12,132,188,34,118,185,104,47,184,134,133,75,88,192,230,112,83,42,42,177,186,74,85,216,192,248,213,194,38,168,220,51,108,221,55,170,6,6,111,208,
+83,205,223,60,60,148,104,184,55,34,48,198,11,113,194,159,230,242,242,226,108,78,107,44,128,33,55,42,86,89,71,151,184,190,16,66,194,1,206,105,123,251,173,87,91,253,225,162,222,51,13,58,26,63,49,150,106,40,184,64,32,132,183,59,94,123,231,242,134,231,59,
+241,47,152,99,161,202,29,67,113,10,197,30,2,197,97,251,210,81,185,42,214,125,249,217,197,57,118,182,80,150,215,231,243,190,46,34,52,11,10,38,236,8,197,139,33,47,92,24,100,69,181,1,230,148,160,51,95,37,137,134,100,234,43,179,206,11,229,77,79,88,56,236,
+193,24,26,158,31,16,114,198,147,17,137,86,197,156,226,234,154,156,201,150,228,112,166,24,168,5,0,95,16,130,41,149,172,6,22,197,32,100,185,163,14,76,57,182,235,209,235,119,222,205,20,109,37,28,176,185,6,29,8,196,143,140,54,158,114,12,238,175,172,201,239,
+102,115,242,191,2,144,124,9,2,118,252,183,82,12,0,124,205,103,199,122,76,13,185,253,224,96,220,200,232,63,117,114,81,219,159,139,73,232,102,125,179,107,160,154,248,153,115,28,122,65,8,9,7,88,239,190,108,113,200,242,92,190,172,53,254,66,76,136,129,216,
+102,62,227,7,171,7,105,14,47,242,47,49,27,19,254,25,83,122,3,12,31,251,204,88,106,211,112,94,128,179,29,94,120,86,223,188,144,11,252,236,162,163,203,37,83,113,114,35,32,240,189,197,196,7,169,106,175,207,77,101,228,177,29,214,45,118,126,117,62,219,22,
+77,182,229,74,141,255,81,4,11,79,79,45,203,55,79,47,25,47,252,255,255,43,128,89,34,124,65,207,158,177,238,209,140,150,3,120,59,7,1,216,38,216,37,236,131,1,81,145,111,167,42,248,245,128,139,163,251,83,81,121,124,87,122,203,74,64,28,2,238,26,73,26,34,21,
+33,196,29,240,172,90,9,126,81,81,241,105,133,169,197,170,192,62,226,151,22,196,2,136,196,24,176,72,8,33,97,226,233,19,139,198,250,103,134,229,98,69,190,161,185,11,8,133,3,86,132,108,236,75,119,43,10,51,132,16,123,64,36,254,194,142,190,134,34,241,70,80,
+56,21,244,179,28,186,96,161,5,169,240,206,92,62,16,93,249,118,56,229,128,245,70,49,32,215,16,69,167,63,63,147,177,164,69,190,60,189,210,182,33,186,156,154,181,1,136,124,240,91,54,251,192,67,16,252,246,228,82,96,30,242,89,197,133,174,158,169,16,84,196,
+182,226,53,197,236,41,50,175,65,110,211,65,107,225,253,99,61,166,15,4,56,12,80,44,38,196,29,238,25,177,46,250,162,130,100,84,163,253,16,90,80,191,121,116,161,165,159,38,196,15,136,196,244,38,38,132,132,13,172,123,255,250,222,252,150,69,12,240,50,134,
+5,223,215,53,39,211,208,186,174,98,33,116,199,176,122,231,30,33,68,157,191,217,222,107,201,106,1,103,57,88,152,5,153,159,77,91,19,247,164,90,104,248,10,59,103,13,13,205,238,32,183,51,1,242,174,71,226,225,233,147,139,45,103,159,97,63,255,238,137,197,182,
+137,196,178,149,245,68,152,129,88,140,246,89,152,237,223,60,24,111,104,69,129,135,251,15,243,249,182,126,57,110,0,59,145,187,20,196,129,26,120,208,195,224,71,212,10,100,132,6,166,87,228,128,5,145,19,62,114,65,111,207,129,255,156,85,239,29,4,24,55,46,
+22,57,192,196,69,42,56,65,138,154,45,205,165,247,18,191,129,106,98,213,225,18,176,171,58,167,49,248,133,8,242,181,163,11,198,224,68,248,105,167,99,157,210,213,209,97,220,123,231,115,101,249,205,92,158,3,21,9,33,161,7,93,161,163,221,157,114,71,127,76,
+70,18,87,170,1,143,103,138,174,89,125,193,223,84,5,236,79,40,62,208,61,72,149,216,167,80,89,149,104,151,154,133,68,166,196,239,219,77,80,201,175,146,216,65,101,241,239,151,10,129,213,8,106,133,134,102,45,116,160,35,5,169,208,208,46,127,156,203,219,210,
+159,14,7,108,182,17,158,19,56,56,212,207,114,130,189,223,84,182,36,133,213,53,109,246,191,20,138,183,0,65,19,94,248,146,234,141,182,81,34,31,212,7,27,55,29,4,75,85,175,157,67,109,48,210,246,43,72,34,228,43,107,166,42,104,255,20,130,225,28,16,158,84,205,
+254,239,30,74,80,40,118,17,136,109,59,123,213,14,115,231,41,208,249,146,145,152,186,15,224,68,42,234,138,232,0,49,248,200,105,14,78,36,132,144,102,32,177,246,19,35,86,247,70,188,222,215,109,99,175,73,70,40,20,251,144,227,75,69,185,69,177,34,252,47,139,
+244,115,117,147,61,41,181,179,128,184,80,68,160,27,172,69,168,4,189,119,56,209,84,71,65,213,49,236,38,130,94,24,102,149,55,22,11,77,139,51,91,17,228,110,108,252,93,151,159,25,23,238,25,10,197,38,56,23,178,42,217,159,206,100,229,31,82,214,6,95,72,181,
+4,62,104,21,214,118,65,251,192,95,142,149,228,35,233,152,220,144,142,173,19,74,81,125,125,54,91,50,166,84,134,225,254,218,99,194,203,170,25,200,94,195,19,139,153,87,119,120,113,38,43,79,42,10,197,120,47,33,132,16,66,136,147,196,28,24,192,77,244,131,68,
+5,108,170,172,12,162,149,170,200,198,33,215,238,98,198,151,184,25,110,21,17,232,4,231,121,12,218,28,157,205,201,181,201,200,186,1,255,152,225,244,102,192,42,95,157,162,54,39,204,108,69,118,13,84,102,83,116,111,31,20,138,201,38,240,176,90,105,159,144,
+128,13,244,115,26,92,207,90,117,122,152,177,83,53,2,118,198,187,89,85,236,18,168,64,130,119,225,222,126,107,157,6,120,15,61,97,9,33,132,16,226,52,5,22,15,248,22,12,162,125,104,123,202,210,199,127,249,156,249,225,181,196,121,118,219,232,52,3,169,104,120,
+70,99,25,69,134,44,158,179,132,85,251,14,120,248,254,112,58,227,169,191,33,104,112,152,29,105,72,173,125,98,171,193,23,53,96,155,0,79,103,86,123,18,18,92,158,57,183,34,115,22,38,211,226,103,159,97,80,239,91,236,28,192,151,202,108,5,38,132,16,210,26,59,
+251,197,52,109,39,124,11,6,209,254,98,202,188,200,131,159,197,123,8,33,193,197,152,19,118,108,193,208,150,154,13,7,68,71,246,203,211,43,134,135,47,181,167,246,194,138,98,210,20,100,195,48,248,2,25,196,91,211,49,25,142,173,191,93,48,252,66,151,153,54,
+33,196,125,190,113,114,73,30,29,78,200,205,67,9,233,104,146,236,197,236,186,63,94,204,85,61,16,137,95,177,51,216,244,104,139,73,189,132,16,66,8,120,103,177,168,52,23,5,98,1,187,204,252,13,132,223,211,71,23,228,115,59,122,165,55,218,184,90,117,185,88,
+145,239,79,46,179,59,205,3,216,245,3,207,20,249,29,146,214,64,252,53,230,54,157,207,202,141,201,136,140,197,186,12,155,33,88,119,76,21,202,212,157,52,66,161,152,180,4,27,195,137,128,15,90,35,237,103,182,80,86,154,148,91,131,7,2,111,0,1,24,175,131,163,
+61,114,85,188,75,82,213,65,159,152,68,125,33,95,97,21,113,64,80,29,108,10,27,34,122,176,17,66,8,49,3,98,187,187,87,172,199,135,110,15,207,222,155,232,150,241,120,183,44,149,87,89,233,106,3,8,192,95,63,190,104,252,130,251,6,226,235,126,81,216,45,251,188,
+8,98,60,213,193,228,56,7,18,98,5,236,15,60,255,187,7,133,98,66,136,22,142,100,74,198,240,10,21,38,89,161,232,57,40,8,59,203,104,119,167,60,48,146,148,177,100,100,157,55,87,174,188,42,147,153,146,43,215,219,234,96,83,180,137,253,140,126,97,132,16,66,44,
+240,220,185,140,60,190,43,109,122,175,65,18,211,141,225,217,216,167,31,27,79,201,96,124,253,241,249,161,234,94,253,202,76,150,162,177,13,40,12,123,159,119,23,11,114,87,92,173,219,236,117,126,191,132,248,138,174,161,191,126,226,43,252,202,8,33,237,230,
+66,105,85,246,38,34,74,195,12,94,154,201,26,239,39,36,136,192,206,227,225,241,94,233,143,117,109,154,2,30,233,236,144,225,120,183,220,57,16,151,99,75,69,201,104,244,227,42,173,137,156,93,41,25,147,170,91,29,224,33,18,191,52,189,34,127,206,177,98,132,
+16,66,136,121,176,175,153,221,107,32,18,255,96,90,127,226,180,182,79,39,186,27,199,176,216,171,247,244,69,141,56,247,247,75,28,98,21,36,70,35,157,178,35,222,45,183,247,197,36,210,209,33,169,206,14,89,104,226,159,26,116,78,228,203,114,115,42,218,244,57,
+104,6,60,103,127,199,36,10,33,190,162,227,3,255,242,43,186,64,19,66,180,0,191,107,179,211,76,107,32,184,248,113,8,173,79,122,58,59,228,222,129,184,76,244,70,215,181,121,161,237,235,248,114,81,94,153,207,211,196,63,0,192,194,99,111,191,57,123,7,248,63,
+255,247,99,11,218,189,250,112,47,62,48,156,48,108,40,26,61,187,56,184,191,50,155,163,111,24,33,132,16,101,106,113,15,246,196,84,100,189,16,133,206,178,223,206,231,93,105,67,134,37,130,21,207,126,12,2,199,140,23,226,111,224,143,122,96,91,178,161,213,2,
+60,178,95,157,201,134,210,106,203,234,89,14,231,150,111,79,46,241,204,226,34,232,134,184,169,55,42,135,151,139,244,251,38,166,161,80,76,2,13,60,196,62,60,24,151,65,24,161,119,117,74,161,178,42,115,133,138,252,102,46,47,71,88,249,230,10,86,2,12,183,42,
+71,220,230,238,116,76,62,186,45,185,229,53,170,85,112,210,15,214,191,96,125,58,184,179,207,210,231,199,247,254,213,247,231,93,251,155,235,7,75,156,204,149,229,84,190,204,224,159,16,66,136,163,64,52,222,89,181,120,112,211,163,18,2,203,223,93,219,223,116,
+128,111,51,126,61,147,165,149,130,143,249,236,88,143,169,25,13,97,61,167,224,44,247,137,177,84,75,191,98,36,120,126,56,157,97,156,232,2,56,99,124,124,172,167,225,160,72,12,137,124,126,122,133,90,8,217,18,223,8,197,52,184,39,86,192,226,248,200,246,212,
+150,173,49,240,19,123,110,42,195,69,210,5,112,0,248,228,72,178,105,16,22,230,76,61,68,226,3,99,61,166,127,254,229,233,21,87,188,250,136,125,254,211,158,126,203,237,123,194,3,40,33,132,16,162,5,43,93,63,245,224,140,241,181,163,11,252,146,124,200,167,183,
+37,45,205,84,9,171,88,44,213,51,203,109,3,241,117,130,49,10,26,206,101,203,174,117,0,16,145,207,111,79,201,206,222,104,203,43,49,151,47,203,55,78,178,251,129,108,6,218,171,167,135,217,221,222,27,149,123,71,146,13,15,210,104,1,98,54,132,52,2,247,205,67,
+219,83,45,175,13,238,43,84,243,253,98,42,195,225,19,154,65,102,25,65,85,207,76,86,174,79,70,100,36,118,41,192,40,172,174,201,241,108,73,78,20,42,33,186,26,87,128,15,154,21,145,24,160,242,248,88,182,196,182,127,159,129,42,37,21,145,24,236,27,136,81,40,
+38,132,16,66,218,204,110,19,98,75,35,84,247,119,226,46,232,154,178,58,120,27,69,47,251,151,75,161,44,110,121,205,165,193,146,164,57,95,220,213,183,105,224,102,51,240,115,95,154,72,203,215,143,47,242,138,18,3,20,91,126,106,188,215,232,106,246,172,80,252,
+228,53,125,50,218,179,245,199,67,41,61,132,190,35,11,5,78,224,39,6,184,185,205,136,196,245,224,231,151,78,45,49,225,224,2,16,140,141,192,42,19,186,63,189,33,247,14,39,44,191,7,11,57,222,23,214,106,6,191,114,147,226,225,19,36,121,0,37,196,243,32,30,185,
+127,36,41,3,177,238,117,109,235,240,26,159,201,150,229,185,233,12,189,2,9,241,56,86,102,106,108,4,21,89,76,234,250,139,219,7,172,137,196,53,238,28,78,208,10,142,184,14,134,110,154,21,137,107,64,79,67,5,242,119,166,120,24,15,59,27,139,45,61,41,20,35,179,
+209,200,79,165,25,104,9,58,40,66,177,152,24,25,16,21,240,62,55,125,63,9,145,106,85,130,10,187,82,16,29,185,254,133,133,174,78,245,131,43,33,65,0,85,95,251,210,81,233,235,190,18,43,46,149,43,242,206,98,209,19,173,174,91,181,171,67,52,70,33,196,147,123,
+250,61,99,35,179,63,21,149,61,189,145,117,215,115,182,80,150,35,153,18,91,135,9,33,161,97,71,111,68,233,79,133,245,2,108,245,232,197,75,220,228,230,33,235,5,71,0,54,21,232,116,100,242,58,188,224,251,223,88,108,233,57,161,24,153,16,43,34,113,13,4,228,
+247,21,42,129,204,220,66,221,191,161,47,42,177,206,75,85,100,139,165,138,188,189,88,96,5,236,6,112,157,84,51,255,120,31,222,79,11,10,226,22,16,62,84,193,253,139,193,18,97,181,236,8,27,107,60,135,144,144,2,123,158,71,70,83,13,59,206,70,165,219,72,182,
+221,189,82,150,239,77,45,187,118,96,183,226,105,10,27,53,113,113,238,198,86,3,137,112,141,209,130,125,59,135,17,145,16,131,253,214,234,32,187,26,75,20,93,124,197,238,152,117,253,161,30,12,95,100,98,141,184,5,52,52,213,181,10,220,51,156,96,209,101,29,
+16,78,31,24,73,202,88,50,114,89,95,194,126,144,175,172,202,100,166,20,184,107,245,185,29,155,139,45,61,39,20,171,102,66,192,95,13,39,2,37,20,227,176,129,67,207,198,135,30,135,33,28,66,96,22,255,242,185,21,138,155,85,110,237,87,107,23,170,127,63,175,37,
+241,43,137,46,36,146,40,20,251,133,51,121,245,68,31,130,20,66,194,6,14,241,7,119,244,181,76,8,67,224,252,135,107,251,229,169,99,11,218,197,77,216,77,88,29,124,5,177,248,240,114,81,123,37,143,217,235,137,10,187,47,68,250,228,219,147,75,20,139,73,232,192,
+126,171,234,55,204,51,133,191,184,20,71,19,226,79,70,18,234,5,71,224,234,164,167,71,151,105,165,217,48,64,104,114,216,15,16,231,253,83,58,38,175,159,15,198,112,113,196,174,141,10,117,61,181,34,66,24,181,147,9,169,85,133,250,29,100,48,96,191,129,155,112,
+171,235,129,191,23,37,226,184,110,4,134,236,246,50,193,118,223,79,8,33,102,65,71,72,69,81,116,65,38,155,144,118,130,160,17,254,154,94,138,169,80,249,106,182,107,8,63,247,133,29,125,109,255,76,27,249,184,197,97,164,53,30,168,86,22,235,2,45,210,181,97,
+37,102,64,197,241,223,108,87,179,246,114,26,196,200,184,55,189,118,127,146,96,162,186,223,98,224,58,241,23,115,37,126,103,196,191,164,99,246,100,189,24,19,37,6,208,224,26,137,196,27,129,70,135,68,127,16,116,184,15,55,25,224,233,169,212,129,19,153,140,
+32,84,133,254,237,174,62,75,217,107,122,52,19,179,224,128,117,71,127,108,93,214,113,38,87,146,159,204,230,120,13,93,198,110,128,122,202,70,133,42,113,135,63,205,229,229,22,139,3,12,209,246,196,181,158,180,3,236,15,143,140,165,100,36,185,126,248,218,67,
+85,209,227,249,233,21,215,44,175,238,78,199,26,218,35,108,5,126,30,239,211,57,145,93,197,58,13,140,247,216,171,4,178,202,71,210,49,73,69,172,29,10,81,169,13,139,36,183,90,171,33,12,163,115,112,163,184,141,251,243,220,10,135,3,146,246,128,253,246,203,
+10,214,118,207,115,192,176,239,56,87,90,53,186,117,85,109,12,105,59,225,62,216,39,246,13,196,12,209,19,223,35,10,50,138,171,107,114,62,87,150,23,103,178,129,222,35,186,236,84,91,18,131,39,175,233,179,28,199,5,193,254,182,183,73,60,232,169,212,129,19,
+153,12,187,217,20,183,65,169,187,74,139,19,110,82,84,0,17,210,8,8,0,95,220,213,103,12,207,129,48,133,3,95,237,133,127,254,231,235,7,141,197,145,184,7,2,212,76,73,45,128,193,33,153,45,193,254,3,9,26,171,85,71,47,156,229,84,98,226,60,168,204,196,254,128,
+61,161,209,89,3,129,243,193,157,125,174,85,78,220,166,56,137,126,79,74,95,197,169,157,24,76,247,128,202,27,20,7,167,222,174,248,61,216,5,241,11,42,119,154,9,56,181,225,128,172,48,38,237,224,217,51,203,150,126,235,219,179,57,206,145,241,41,39,51,106,197,
+102,239,105,76,72,146,205,224,156,251,229,15,12,24,251,4,226,149,218,94,129,189,21,186,202,206,106,140,243,168,197,226,12,63,49,151,183,87,112,84,9,249,0,20,196,112,141,230,95,152,225,206,109,122,187,194,156,38,21,105,44,142,7,174,198,220,239,217,20,
+51,165,238,205,80,109,121,12,10,118,23,72,187,239,247,42,56,56,61,49,145,150,193,248,214,139,31,22,71,108,178,163,138,94,108,196,62,135,20,43,187,127,31,192,33,158,97,225,235,199,23,77,139,197,191,158,201,210,243,144,56,14,246,136,141,147,142,155,97,
+116,48,185,32,22,91,173,38,174,161,58,193,94,133,241,22,123,172,151,80,189,158,110,88,116,65,36,110,21,191,212,192,125,76,177,152,56,13,68,223,103,78,45,25,213,166,173,192,62,237,118,151,30,172,101,80,253,111,103,72,114,88,121,101,54,103,234,123,222,
+200,43,236,204,116,13,8,124,16,129,205,84,130,163,56,42,168,150,157,232,16,182,195,249,144,39,183,238,183,97,1,6,249,209,207,73,136,102,73,130,192,149,160,22,124,60,228,199,238,13,166,218,242,24,20,222,90,200,203,67,61,230,14,187,141,192,251,131,6,68,
+223,143,141,245,152,174,86,194,38,251,248,238,180,124,245,253,249,240,222,72,46,130,22,233,27,251,98,150,50,154,168,98,120,83,177,2,34,108,224,240,132,150,235,137,84,244,242,53,158,207,87,228,66,161,44,239,44,22,93,107,27,132,88,220,172,173,90,170,109,
+255,223,159,92,102,91,53,105,11,15,94,109,109,223,52,58,152,22,11,172,152,219,128,157,1,149,58,25,181,104,57,81,143,85,187,10,187,96,93,52,43,18,215,56,48,218,195,132,26,113,28,172,119,136,141,33,50,237,72,69,214,117,127,66,88,156,206,150,92,109,109,
+71,124,115,239,64,220,88,159,235,159,211,199,224,179,188,92,146,223,206,231,105,141,96,2,116,247,253,234,124,86,14,88,40,190,122,121,122,197,120,31,113,135,199,174,177,230,159,31,4,171,128,70,32,65,101,213,206,174,30,172,95,97,102,32,102,79,22,157,232,
+139,138,248,52,97,180,88,104,60,180,213,83,66,113,166,84,145,193,46,123,31,105,174,224,223,170,80,187,211,42,165,90,25,20,214,0,25,127,247,1,69,111,41,4,121,65,188,110,143,141,167,44,183,180,226,250,33,16,166,15,170,59,124,111,106,217,24,26,100,70,44,
+134,72,252,3,250,224,153,2,94,165,31,221,182,185,117,25,149,117,120,93,151,142,201,190,197,130,252,116,38,235,138,141,7,2,214,90,208,122,95,181,189,123,169,188,74,193,131,180,21,213,33,194,232,96,58,114,124,145,95,78,29,118,132,115,213,193,150,42,248,
+73,208,184,109,200,186,213,5,214,120,172,161,65,19,1,136,55,240,98,108,188,59,214,101,12,167,108,150,200,65,103,5,94,251,24,51,154,2,69,27,249,202,154,220,63,214,179,229,153,18,103,71,136,202,58,125,240,201,122,16,195,168,88,55,193,42,32,136,123,196,
+169,229,162,82,119,58,44,12,195,94,140,98,215,148,192,207,195,0,155,21,91,122,234,47,58,237,192,36,247,223,204,249,247,161,119,194,95,185,47,228,182,1,47,43,6,112,170,239,243,50,168,38,182,90,137,83,227,58,69,255,66,98,31,136,148,223,60,189,36,111,94,
+104,222,254,6,47,99,180,55,50,224,55,7,68,226,3,45,2,126,169,222,247,95,216,225,190,87,119,77,52,166,72,28,76,106,45,193,61,154,125,105,27,129,202,56,21,116,119,48,169,180,2,75,181,99,64,39,86,61,199,107,156,89,209,91,233,167,122,61,113,152,212,137,202,
+204,14,112,125,218,125,251,9,136,119,181,103,221,78,21,55,33,91,129,123,235,224,142,62,83,213,254,136,113,62,27,114,155,66,179,160,83,239,169,99,11,70,44,190,113,126,8,254,25,133,26,79,159,92,164,72,236,50,170,231,85,191,91,5,52,227,59,83,25,203,113,
+72,165,122,238,36,225,5,231,205,70,238,19,158,170,40,70,201,252,205,67,9,101,69,31,129,47,91,33,195,13,110,244,221,11,5,163,173,196,44,71,22,10,129,20,100,238,177,177,1,226,25,12,115,117,186,23,248,249,197,156,241,194,33,115,87,221,144,164,147,185,50,
+219,7,45,128,195,186,149,22,66,84,23,127,122,91,82,126,124,62,220,45,88,196,89,144,172,192,64,182,141,222,176,16,50,255,48,159,119,237,176,233,151,185,14,24,48,164,114,32,156,210,188,86,62,63,189,98,12,253,179,138,238,150,79,213,235,121,92,163,205,209,
+125,54,6,231,53,27,204,210,110,106,237,255,251,6,227,155,18,147,16,151,48,135,128,194,18,113,146,71,70,83,150,58,41,241,220,239,95,46,209,178,204,4,40,220,168,197,226,196,123,160,32,202,78,8,115,169,147,59,120,223,45,236,236,204,122,251,231,202,171,242,
+221,147,20,137,137,200,31,47,110,182,46,241,92,138,251,117,27,135,115,171,83,105,189,6,252,65,236,178,68,15,75,163,45,236,23,83,153,150,173,156,248,239,248,185,160,90,44,164,109,30,148,194,94,157,238,21,32,10,215,2,85,188,40,18,91,227,254,109,214,171,
+103,62,56,24,103,5,24,113,4,8,71,143,111,239,53,146,21,141,6,136,225,223,225,191,61,121,77,159,43,21,198,42,86,77,110,160,50,40,8,197,3,175,107,110,45,69,177,2,146,207,86,248,181,11,190,166,170,215,243,13,138,156,77,65,82,242,239,119,167,101,255,85,141,
+189,230,81,241,137,103,29,235,129,23,186,9,136,255,193,61,167,50,165,255,206,0,86,82,146,240,113,147,205,193,165,78,116,114,123,149,111,156,92,50,98,139,92,147,216,2,251,249,219,179,57,249,218,209,133,208,91,78,212,104,50,207,205,52,126,158,147,38,213,
+130,221,185,13,179,54,60,55,204,14,237,182,67,177,46,75,21,161,0,55,187,223,171,137,49,173,82,101,195,175,135,21,160,151,192,117,192,11,21,41,104,65,172,175,46,129,23,246,95,22,139,244,175,107,1,158,67,66,252,12,14,227,170,107,234,77,169,168,156,227,
+26,65,108,98,214,111,28,63,3,219,147,167,78,234,245,253,45,42,250,250,235,6,190,186,104,1,134,8,103,22,120,71,186,225,199,139,228,243,193,234,192,156,86,224,32,231,70,44,114,174,106,95,116,151,133,41,223,47,77,175,104,245,111,63,188,92,180,244,249,234,
+105,54,193,187,93,96,175,65,251,191,153,103,9,94,177,159,145,148,60,61,229,239,226,22,226,62,55,164,212,132,50,36,40,145,12,231,0,54,18,102,252,210,81,165,74,205,198,14,149,215,245,162,58,246,86,138,195,155,153,47,148,149,45,59,193,241,37,255,107,112,
+72,48,160,112,165,118,110,241,156,80,44,213,32,251,209,242,170,169,201,141,136,5,95,56,155,9,132,64,106,215,122,67,213,27,47,200,212,15,136,34,214,184,232,227,193,144,132,128,157,54,54,252,241,100,4,190,0,188,142,68,25,216,77,88,73,84,224,240,254,240,
+80,66,107,155,171,234,16,97,157,195,215,106,212,174,139,25,177,24,83,232,221,108,241,71,28,187,119,177,32,247,143,36,141,73,218,245,113,29,226,214,153,108,89,158,155,206,184,122,88,67,108,20,235,236,104,121,61,107,3,155,116,183,170,227,218,224,90,169,
+196,196,231,53,23,142,124,114,100,243,160,212,173,128,88,140,245,129,54,20,196,14,219,147,234,67,208,7,35,93,20,138,137,175,57,147,183,183,206,207,105,158,97,224,22,216,75,89,248,210,154,151,102,178,74,214,97,82,141,235,126,162,208,169,229,69,224,87,
+141,66,203,191,26,78,120,83,40,150,170,104,122,104,161,32,15,140,36,101,188,39,178,105,162,37,14,41,71,151,138,129,179,13,128,57,190,213,106,234,26,223,159,100,117,2,185,130,221,10,117,187,27,176,31,169,207,186,50,227,26,110,162,108,13,38,54,185,67,161,
+189,23,222,166,58,133,226,67,23,243,242,208,246,205,147,142,91,161,123,248,90,13,92,27,248,180,223,61,148,104,184,191,77,46,151,228,213,217,172,156,240,64,162,211,176,161,240,184,247,95,237,122,222,62,16,55,196,203,122,32,16,195,203,24,54,21,110,9,74,
+16,212,85,226,24,157,158,207,168,204,84,241,123,134,103,57,133,98,66,136,10,123,19,221,114,75,58,182,206,102,240,173,133,112,13,65,198,30,171,154,76,148,234,57,153,144,250,251,9,3,123,85,98,14,59,214,185,94,164,86,104,233,89,161,88,170,25,16,76,111,172,
+129,225,90,240,224,13,242,192,58,8,223,95,74,118,91,158,40,14,235,13,138,90,164,30,36,90,204,84,229,55,2,137,152,176,12,134,132,56,252,200,88,74,70,146,235,171,190,208,242,26,212,132,20,33,164,189,192,59,210,204,20,250,141,160,42,17,3,44,117,121,145,
+227,80,121,111,121,85,18,22,60,233,113,48,211,61,124,173,30,92,27,188,208,238,95,223,53,112,42,95,214,106,141,16,20,106,215,19,220,88,87,161,232,5,63,124,84,93,255,221,181,253,150,132,0,28,244,116,198,195,215,42,86,117,178,253,159,216,165,200,245,46,
+116,64,32,254,248,88,79,67,157,224,161,158,148,60,184,118,73,180,10,75,55,173,106,50,49,72,21,160,196,57,80,77,251,165,137,180,37,29,14,115,41,130,250,188,249,202,197,27,7,154,48,136,87,152,86,105,197,70,2,55,40,23,59,178,17,163,213,100,69,237,121,249,
+211,92,56,2,12,36,159,158,152,72,27,65,70,163,131,40,58,25,80,225,255,229,15,12,24,130,50,241,23,115,37,245,170,194,41,14,13,36,54,24,180,49,76,116,87,66,111,14,31,19,175,173,88,73,192,238,203,11,137,105,136,194,53,145,19,47,138,196,246,169,191,158,94,
+0,247,25,238,55,179,32,118,198,65,79,39,105,27,177,129,157,117,130,144,51,54,158,83,14,70,246,31,56,179,160,53,126,43,17,11,103,25,20,186,28,28,181,62,200,217,143,32,153,168,98,73,255,71,141,157,91,196,95,64,135,51,163,159,224,190,67,161,102,144,139,
+201,168,124,120,20,220,164,184,249,182,58,188,33,32,126,230,212,18,171,29,73,83,112,96,178,234,37,137,251,42,12,137,7,100,229,209,114,189,209,214,190,242,165,21,0,0,32,0,73,68,65,84,166,17,168,242,131,160,76,252,5,42,181,230,21,61,200,222,213,236,199,
+73,130,69,191,66,53,177,91,64,140,251,150,137,4,53,172,8,16,115,112,104,46,209,9,238,55,220,119,184,255,182,226,212,114,209,136,157,9,9,11,111,40,90,151,188,71,203,19,223,129,98,21,43,54,81,40,114,121,84,177,171,212,79,88,77,38,74,136,206,185,68,29,232,
+39,136,59,16,87,108,140,61,114,112,55,88,40,200,127,63,182,16,248,251,200,211,214,19,97,7,55,31,94,16,180,246,246,68,100,36,113,169,189,237,120,166,72,255,84,98,26,8,0,143,239,78,155,26,180,130,205,51,44,7,173,79,141,247,90,250,121,8,202,152,4,170,187,
+90,137,216,227,245,217,156,60,60,110,205,131,21,62,167,94,240,56,37,230,192,30,249,225,193,184,140,213,181,128,87,214,214,100,50,3,191,90,119,108,153,166,109,220,63,139,46,124,94,92,35,172,253,184,150,24,192,150,170,171,116,44,84,86,229,157,249,224,182,
+214,17,239,131,110,194,255,159,189,119,143,141,172,60,215,61,95,187,238,23,87,217,110,119,219,238,110,220,23,26,58,92,154,75,58,176,55,144,3,19,32,64,72,64,201,33,234,100,114,50,97,130,194,232,72,217,127,100,70,71,138,20,237,145,18,157,163,72,145,182,
+180,163,163,68,26,109,206,36,34,195,236,147,32,216,176,67,66,128,97,163,233,30,110,9,33,105,46,13,116,211,23,183,187,221,182,27,183,237,114,149,235,94,229,209,179,92,213,93,182,235,178,190,85,229,90,183,231,39,89,135,3,229,108,123,121,173,111,125,223,
+243,62,239,243,254,228,227,121,205,81,119,67,127,80,6,131,43,247,39,238,205,115,233,162,105,207,185,246,51,180,225,100,207,148,204,249,153,171,207,121,237,160,69,184,163,48,220,146,207,186,125,64,23,197,219,159,100,116,13,248,172,2,209,227,32,69,50,219,
+241,245,49,181,51,11,64,252,32,98,8,157,174,23,104,197,235,201,148,124,126,52,210,210,252,3,225,175,54,214,148,144,70,104,115,38,92,126,175,80,40,182,1,218,141,170,69,110,240,197,78,212,193,6,1,7,172,111,109,139,202,88,212,95,55,98,1,174,99,196,77,184,
+165,194,138,105,158,42,19,202,171,32,162,2,85,125,22,105,236,3,38,245,239,73,228,116,15,27,74,21,202,242,212,20,55,145,118,1,197,155,250,249,116,43,177,49,248,122,167,82,116,237,38,167,219,24,6,122,194,196,150,96,59,12,96,35,238,5,130,128,213,28,237,
+39,211,5,185,213,192,247,225,93,99,70,65,18,123,193,29,149,161,189,181,96,111,136,150,118,180,173,127,42,238,151,159,115,29,176,5,24,72,217,231,215,63,80,241,213,243,105,230,98,219,12,20,118,84,103,23,85,185,125,40,228,138,206,227,234,187,1,145,27,99,
+81,223,170,185,11,56,227,38,242,37,121,121,38,237,154,249,59,132,116,2,10,197,132,184,132,106,5,21,142,156,93,17,159,54,41,23,19,95,143,46,21,92,247,226,196,33,200,40,110,217,116,57,137,223,76,45,201,87,74,203,114,237,96,176,233,111,133,152,138,167,38,
+147,204,58,181,9,122,7,78,192,85,19,244,246,118,245,185,197,61,116,76,161,64,81,69,27,196,197,67,60,33,182,1,98,175,145,73,233,104,93,237,54,223,221,25,147,193,96,235,159,19,159,193,250,202,40,15,123,160,103,143,131,194,196,139,83,75,204,38,182,33,215,
+43,238,35,106,129,104,234,38,120,62,35,164,115,80,40,38,27,10,167,146,91,15,43,58,114,186,77,180,141,1,50,113,14,159,177,37,207,156,79,203,209,84,65,110,26,8,202,88,223,234,141,51,4,226,191,206,103,229,53,230,246,217,6,100,239,169,56,108,52,119,113,34,
+215,213,162,24,218,123,119,70,253,74,221,11,47,159,231,33,135,16,187,129,231,246,192,88,76,247,179,142,119,206,193,46,199,59,160,147,74,143,72,92,5,235,43,220,121,20,94,236,1,246,56,111,204,103,229,211,177,128,108,171,137,97,202,151,151,229,120,42,207,
+253,141,141,105,231,220,225,169,215,70,74,72,23,217,21,240,200,85,81,255,170,117,105,54,87,148,137,116,81,235,250,36,214,133,66,49,217,16,246,71,253,114,203,80,72,6,130,235,95,110,200,255,124,107,62,203,170,54,33,164,171,212,78,243,71,17,107,139,175,
+151,89,196,54,229,186,77,234,67,90,190,48,26,145,163,93,116,200,193,25,252,242,212,146,220,61,26,209,37,32,189,50,181,196,251,145,16,27,130,231,22,45,253,159,221,18,110,249,172,195,217,249,251,169,84,215,77,19,159,49,48,216,74,235,136,160,80,108,27,240,
+206,65,20,133,92,176,110,140,28,98,20,98,222,94,215,27,86,8,113,58,56,103,125,99,91,95,221,110,27,252,187,107,7,69,110,103,167,131,165,161,80,76,58,10,22,133,175,142,70,215,57,246,106,193,127,195,215,222,185,172,86,1,39,132,56,11,28,4,110,31,10,95,28,
+56,36,22,24,46,182,22,28,210,41,202,217,19,56,227,140,152,100,140,102,252,181,3,220,18,115,19,37,249,226,104,180,110,225,84,216,18,76,136,35,128,99,243,92,182,40,119,111,137,52,140,161,64,28,205,239,102,210,93,23,137,49,91,193,200,92,6,172,179,136,43,
+163,168,71,218,1,239,236,27,55,5,87,229,198,222,87,201,142,61,190,152,167,107,189,5,185,50,227,168,136,189,128,139,88,79,151,77,212,215,43,15,141,245,201,192,212,18,187,30,44,8,133,98,210,81,190,61,22,107,120,24,94,11,178,180,176,128,32,91,139,144,110,
+130,201,222,131,30,99,203,95,162,64,113,177,25,86,29,46,70,156,195,182,176,241,173,139,25,162,7,10,18,63,27,79,92,108,191,219,28,244,138,191,183,71,38,211,5,153,201,149,216,122,71,136,67,192,179,254,216,153,69,25,241,245,202,53,81,191,4,42,19,248,19,
+197,178,28,78,230,77,139,94,187,166,206,240,58,189,140,6,60,34,201,110,255,196,196,41,52,203,197,246,244,174,236,11,127,16,243,203,47,78,38,56,40,186,1,31,46,230,235,14,160,212,195,20,11,208,164,203,192,52,248,229,237,125,74,197,201,59,71,35,50,95,40,
+211,48,97,49,40,20,147,142,113,255,166,250,81,19,205,64,91,219,109,233,34,171,72,164,171,124,148,200,203,173,10,89,125,181,28,162,192,217,16,43,15,23,35,206,33,208,219,107,248,119,137,121,141,127,111,187,64,68,58,149,227,250,65,136,211,65,4,192,116,151,
+51,136,55,138,225,16,58,4,185,110,17,117,244,238,9,33,24,63,178,59,78,177,184,1,40,110,223,89,90,54,212,21,240,199,57,103,172,67,196,62,220,51,20,210,156,194,170,220,59,26,145,15,78,44,240,47,109,33,204,59,49,17,71,129,234,209,190,38,211,118,155,113,
+179,129,220,52,66,218,225,223,230,179,146,47,169,59,123,48,217,156,155,216,250,124,107,91,84,125,184,88,136,181,74,210,93,22,249,252,18,66,136,110,78,178,227,129,24,0,113,19,42,123,66,136,197,15,109,143,242,82,55,224,207,6,76,42,56,179,116,115,128,47,
+33,208,131,180,108,123,3,64,92,198,140,43,98,29,116,157,210,209,66,117,203,64,80,118,246,249,87,85,8,32,180,140,167,242,242,94,34,79,171,184,203,249,219,120,192,80,165,83,106,22,6,182,223,146,110,242,236,217,164,28,216,17,211,253,127,17,89,106,104,41,
+37,235,65,254,161,145,182,184,7,182,69,229,232,113,86,143,137,26,16,46,26,101,128,182,130,89,155,132,16,183,129,226,248,173,195,97,67,191,245,217,44,133,38,162,142,145,225,137,136,168,128,129,128,226,230,122,240,12,111,10,120,52,147,133,30,146,249,18,
+207,44,22,1,58,218,160,207,35,115,133,146,214,109,226,100,118,32,90,205,160,30,4,198,194,94,234,65,22,162,229,73,11,113,2,251,55,215,95,236,113,35,160,106,128,175,155,146,5,121,202,132,41,190,196,26,12,41,70,78,172,101,24,25,104,41,103,254,49,171,185,
+148,219,194,151,6,252,45,22,75,114,60,89,224,98,104,34,216,136,190,48,153,146,207,143,70,52,39,67,51,80,20,123,252,84,194,157,23,74,7,55,235,220,184,174,5,131,77,32,50,211,165,109,15,174,174,172,97,102,111,118,113,96,186,101,75,88,121,160,29,14,78,132,
+16,226,70,176,254,169,14,244,196,222,199,76,209,14,238,52,8,15,59,67,94,45,231,25,195,2,57,132,214,250,24,29,158,8,174,143,7,40,20,55,0,113,109,15,22,203,114,221,166,80,211,253,15,156,196,20,137,205,5,226,240,29,67,33,217,25,245,175,122,22,170,38,203,
+131,24,236,237,64,209,120,103,155,157,162,67,1,118,154,90,137,166,127,141,175,141,70,116,219,199,199,250,124,242,109,95,76,126,57,177,232,56,177,184,186,81,193,64,135,108,121,89,11,219,62,157,45,82,20,175,33,230,237,254,52,121,171,131,251,230,171,163,
+81,237,217,88,203,136,120,181,103,235,246,66,89,115,182,114,227,107,14,112,23,158,201,20,229,129,209,168,12,135,189,235,54,94,156,200,172,143,149,12,67,99,96,200,142,83,178,28,157,8,196,225,155,6,130,235,214,177,84,161,44,71,23,114,114,112,62,107,202,
+187,240,221,11,25,45,235,90,133,63,112,112,42,33,196,165,252,122,34,41,143,238,233,87,250,229,95,49,105,239,83,21,89,234,157,65,241,238,249,211,108,134,179,77,44,76,59,195,19,227,62,158,39,155,241,219,202,48,232,3,35,17,217,26,246,74,192,115,169,211,
+27,131,235,144,73,76,161,221,92,16,187,210,168,131,163,214,100,249,250,76,90,51,62,16,82,15,232,72,55,244,249,101,15,138,13,53,134,182,217,92,81,14,39,114,93,209,142,26,10,197,112,18,171,102,140,96,144,217,55,182,245,57,166,138,5,39,232,237,67,225,186,
+66,31,56,150,200,57,182,34,68,218,3,15,247,183,199,98,45,135,251,33,118,227,155,187,226,242,202,212,18,55,189,38,1,55,107,117,205,130,11,162,186,193,229,203,155,184,157,175,108,9,203,181,13,178,231,181,200,160,205,33,217,221,231,151,223,79,165,186,94,
+236,194,65,105,119,204,175,219,33,7,81,155,135,39,66,136,91,193,94,7,93,84,247,109,211,151,3,139,53,211,140,168,30,20,39,17,75,213,200,145,138,119,15,38,228,111,15,123,229,55,44,254,17,151,66,3,139,53,105,214,137,191,150,170,152,236,164,243,102,142,38,
+202,142,128,98,3,226,123,234,189,7,17,189,135,179,25,58,7,158,155,78,109,168,14,89,119,152,29,42,185,70,7,147,225,135,191,205,96,136,181,149,192,239,0,1,175,145,72,12,32,164,63,188,51,238,136,223,183,93,80,221,104,7,167,45,44,122,68,226,90,62,187,37,
+172,21,38,136,185,224,32,133,23,54,69,98,226,118,176,217,109,36,18,215,130,117,238,203,219,251,180,226,88,183,249,41,38,164,47,53,127,247,44,47,139,230,218,224,161,138,16,226,118,32,252,66,44,110,54,204,215,204,53,19,251,224,102,34,113,45,56,131,161,
+152,73,8,33,86,0,69,46,189,34,113,21,136,197,87,135,141,119,101,90,141,147,109,206,44,155,228,204,51,45,209,1,247,69,171,247,32,52,87,232,144,27,169,31,213,21,138,63,29,51,62,152,12,220,56,96,76,100,182,10,16,126,81,173,214,3,174,19,62,235,118,177,248,
+124,155,110,178,118,23,22,43,129,123,65,69,36,150,202,125,116,247,22,125,247,28,33,86,35,81,48,254,252,115,80,142,245,24,169,184,133,245,2,135,215,151,12,14,74,106,23,116,3,60,121,122,81,78,39,243,154,248,81,253,202,20,87,162,49,254,219,137,5,22,126,
+8,33,164,2,196,226,159,124,60,175,9,198,40,180,97,173,196,154,137,127,126,103,54,35,255,229,232,156,105,107,38,246,193,42,231,79,20,51,157,36,178,56,133,118,238,159,153,12,133,34,98,79,110,219,164,62,192,81,218,248,62,43,130,238,194,84,27,14,215,15,93,
+62,187,73,53,209,1,239,203,3,99,177,13,51,235,212,141,158,216,221,70,182,144,84,28,70,248,129,237,152,225,11,85,94,175,72,92,11,28,161,39,210,5,215,198,80,32,54,225,230,161,144,38,24,168,130,205,169,147,50,122,141,22,74,80,25,130,64,195,40,19,98,55,14,
+205,102,116,79,98,174,197,236,65,57,164,62,119,24,152,86,142,141,205,136,73,81,76,184,135,142,78,58,116,26,42,33,132,108,0,16,140,205,136,150,104,4,246,191,216,7,171,178,47,238,151,15,232,66,179,28,70,134,39,194,205,142,88,41,66,236,134,209,245,75,42,
+231,127,187,234,102,245,64,134,188,17,45,205,105,122,144,42,170,38,157,42,16,139,97,214,217,136,40,166,186,170,158,170,27,178,30,24,254,102,71,144,73,108,4,252,145,140,28,174,157,196,161,153,180,161,223,230,181,11,206,217,20,96,161,111,231,249,185,38,
+218,94,145,134,16,51,64,100,199,156,1,103,240,159,121,32,176,36,59,13,174,67,151,211,217,69,8,33,196,0,70,247,191,91,249,222,177,36,70,134,199,190,235,160,243,32,113,23,131,109,14,97,180,171,110,86,15,152,7,39,146,106,197,59,24,135,254,121,50,217,173,
+31,209,146,180,163,35,106,102,29,3,102,205,86,116,254,127,209,198,64,228,107,150,73,220,10,213,225,127,78,227,237,84,94,27,240,167,2,134,184,57,201,9,208,238,66,31,48,33,231,147,144,78,240,244,217,148,148,20,170,225,16,150,25,9,96,77,140,70,79,197,189,
+220,82,16,66,8,81,199,232,254,215,72,39,35,217,120,208,233,243,130,66,167,15,28,200,116,19,19,187,50,202,57,67,171,120,106,42,165,91,44,70,84,197,147,19,139,142,113,84,27,165,221,162,231,70,152,117,156,83,190,232,0,157,168,230,32,43,203,205,45,80,176,
+189,223,149,45,53,156,212,88,5,149,163,151,167,150,52,113,153,184,19,60,43,59,67,43,207,28,134,25,34,167,218,205,45,39,118,7,174,226,95,156,76,200,195,187,226,45,133,70,180,23,33,91,150,16,66,8,33,132,56,15,45,218,100,50,37,159,31,141,136,167,73,33,0,
+243,4,56,112,214,222,192,205,120,203,64,80,134,2,151,180,148,124,121,89,142,167,242,154,195,212,233,44,48,54,114,21,16,125,31,159,76,106,115,155,26,69,147,66,11,130,193,240,165,217,140,235,69,98,233,64,209,115,35,204,58,117,149,81,40,251,237,254,176,
+115,109,12,55,50,139,170,104,69,218,3,46,193,35,169,188,246,194,216,22,246,173,138,98,152,207,150,228,195,68,78,222,76,228,28,185,40,216,241,190,239,54,8,106,223,55,24,92,39,38,222,90,89,123,16,97,194,2,130,61,129,88,140,33,57,7,70,34,50,22,245,73,104,
+205,75,11,142,17,180,35,50,151,216,218,96,243,102,196,85,156,40,114,163,76,8,33,68,29,163,239,15,156,43,136,117,169,102,97,63,56,20,146,203,162,62,137,86,90,244,115,165,178,156,75,23,181,25,23,211,220,59,216,22,116,99,223,51,20,210,6,75,214,3,157,218,
+16,10,159,61,155,116,180,25,168,221,243,127,166,228,204,103,0,69,2,124,193,28,6,215,117,181,115,100,38,87,146,143,210,5,10,196,21,118,89,212,145,94,87,25,29,79,230,27,62,240,122,192,75,155,3,185,220,13,254,254,207,156,55,150,89,108,103,240,123,183,83,
+104,113,242,180,79,108,38,190,61,22,107,154,225,140,235,118,255,246,168,140,205,101,93,121,255,56,5,58,67,236,205,116,186,104,40,134,233,4,7,10,17,66,8,49,192,225,100,222,208,0,164,73,190,119,108,129,22,43,193,104,9,71,161,231,92,39,149,179,221,55,119,
+197,229,249,179,41,199,26,129,32,130,27,61,255,227,251,156,222,81,139,110,123,14,29,109,140,85,255,254,117,239,230,55,218,204,141,252,171,77,115,39,199,233,114,35,29,0,45,84,70,112,250,139,226,27,219,250,116,15,250,67,161,234,174,1,227,197,42,66,136,
+113,222,50,240,14,71,156,8,11,196,132,16,66,140,0,103,217,251,115,106,239,30,116,191,180,123,102,37,132,24,3,78,98,149,1,238,119,143,70,54,100,224,150,85,48,122,254,127,87,113,221,35,206,4,239,179,118,200,109,128,59,187,238,211,138,195,158,234,203,186,
+10,220,196,118,205,162,233,68,108,192,105,3,147,255,137,179,56,56,159,213,68,95,85,94,52,48,33,216,46,32,163,104,36,162,22,237,114,235,112,216,209,27,10,66,172,10,170,254,42,123,0,108,110,158,155,214,63,180,134,16,66,8,89,11,178,42,85,162,36,94,61,159,
+102,129,146,16,19,64,171,188,106,247,57,34,205,238,24,10,57,246,207,245,252,5,181,245,75,42,186,25,7,123,19,48,222,166,219,254,200,6,184,245,27,42,55,104,251,94,155,47,219,10,28,22,159,154,76,118,252,135,236,22,216,108,192,21,165,42,104,85,57,230,208,
+220,93,162,6,238,1,100,49,29,24,139,233,206,249,124,101,106,201,209,45,25,55,26,116,7,35,231,154,17,20,205,193,102,237,134,120,96,213,0,9,180,98,254,101,49,199,3,148,141,216,27,242,202,246,154,129,170,102,111,28,241,220,97,253,186,50,30,104,250,57,188,
+247,49,173,152,247,26,33,132,144,118,192,254,249,151,19,139,186,218,217,177,111,54,219,152,116,83,159,95,174,138,249,37,208,187,98,106,152,201,20,228,79,11,57,102,238,218,0,196,38,252,109,60,32,87,197,3,171,238,53,24,125,16,193,9,167,58,247,53,141,185,
+161,197,222,176,17,216,83,70,102,210,142,213,75,244,174,95,82,17,137,241,121,66,192,193,217,76,203,51,87,35,160,65,110,196,122,229,217,244,185,71,126,216,232,63,226,101,55,234,235,149,77,193,214,194,41,110,246,255,126,198,254,135,197,249,92,81,174,51,
+40,106,253,203,100,74,82,20,138,9,166,159,150,150,229,220,82,65,46,11,173,31,232,85,11,68,150,131,51,105,71,79,132,133,43,248,182,45,97,67,223,235,235,233,209,214,33,178,30,108,114,255,231,237,49,185,117,75,88,182,132,188,18,245,247,94,252,218,26,241,
+201,254,193,160,108,234,237,145,51,153,162,20,184,44,89,22,68,172,28,184,172,79,123,239,96,208,75,245,11,174,139,189,33,159,156,75,23,76,123,175,28,73,21,164,84,40,203,230,160,183,110,209,11,27,147,39,206,36,229,60,15,197,132,16,66,58,0,246,43,216,247,
+225,221,211,239,243,172,218,67,99,207,124,34,153,215,206,91,31,166,205,235,224,132,64,252,63,237,136,201,222,120,64,250,3,158,139,123,175,145,240,202,222,11,239,110,20,235,137,53,129,193,226,63,236,136,201,229,49,255,186,51,26,246,58,216,83,239,131,96,
+83,90,150,51,14,207,142,53,202,191,27,12,105,247,188,17,206,45,21,229,19,135,138,240,88,191,142,44,230,197,95,22,25,10,122,197,211,187,126,239,140,117,236,240,133,172,252,223,83,41,158,207,200,69,112,214,195,185,29,235,143,10,184,159,254,245,220,198,
+104,144,61,87,252,232,213,150,255,171,152,84,120,211,64,176,238,112,27,8,196,200,36,118,146,208,133,54,121,213,129,10,86,168,108,19,107,130,251,105,79,212,47,35,225,75,98,11,156,235,112,125,34,166,194,233,46,116,172,31,15,141,245,25,254,254,255,252,209,
+92,71,127,30,39,160,119,128,132,212,84,172,217,237,96,61,190,187,51,38,131,58,10,177,47,76,166,180,169,225,102,130,131,85,200,115,233,80,128,152,37,222,83,132,16,66,220,196,129,145,136,236,237,111,237,250,42,149,151,229,23,39,19,116,23,91,12,152,87,30,
+222,25,215,221,241,233,228,1,108,237,240,253,43,6,116,95,195,181,60,61,145,116,197,96,51,156,213,62,21,246,201,112,224,210,89,109,38,87,146,143,210,5,238,159,73,67,190,54,26,209,237,44,174,118,117,110,212,140,43,93,146,117,237,164,66,136,62,85,156,122,
+80,172,10,190,122,197,98,138,196,164,25,184,55,120,127,144,78,162,50,24,16,159,195,192,9,70,120,88,139,71,47,211,39,18,131,251,182,69,229,204,241,5,83,15,156,43,155,16,58,107,8,81,97,196,219,43,183,15,133,36,238,243,200,96,208,35,115,217,146,36,10,37,
+57,52,155,161,128,68,136,205,128,147,88,143,72,12,224,36,252,250,88,159,252,244,100,130,127,102,11,241,192,72,84,73,224,196,0,182,143,78,80,216,91,203,82,161,44,126,143,254,120,82,55,130,123,70,43,50,112,132,7,81,224,55,83,75,114,127,190,44,251,55,55,
+207,243,134,17,236,247,83,169,13,19,137,69,175,80,92,139,27,42,64,82,17,247,206,101,139,114,251,80,184,174,147,26,76,36,11,242,226,249,37,102,24,17,210,132,76,201,248,243,97,100,40,160,211,49,50,24,16,3,39,152,183,102,29,144,71,172,250,55,228,129,147,
+144,213,192,25,54,232,91,57,168,98,24,177,213,214,55,20,131,214,62,231,248,255,143,136,87,19,155,208,89,244,216,25,107,229,19,90,253,154,18,98,38,119,142,168,117,155,246,249,61,90,188,20,135,85,89,3,152,221,84,247,94,218,0,182,129,160,54,168,140,92,34,
+89,40,43,205,177,170,165,157,115,33,33,110,0,235,13,226,139,174,137,250,101,119,212,175,25,13,176,22,65,28,254,36,87,148,227,201,66,87,58,29,140,77,109,115,9,80,232,79,77,38,181,214,129,29,65,175,236,172,100,134,140,103,138,108,187,37,68,39,120,142,208,
+26,97,164,69,233,156,75,10,83,42,32,198,196,8,28,12,104,29,238,30,86,207,236,198,129,19,238,68,186,16,137,219,65,177,236,230,161,144,68,125,171,243,17,81,88,252,211,108,198,18,29,60,223,219,29,215,158,217,102,64,176,192,231,172,80,0,178,195,53,37,196,
+76,80,224,53,178,143,221,55,16,160,80,108,17,246,70,235,27,191,90,177,187,207,47,66,161,120,21,199,83,249,134,70,186,102,224,157,178,145,14,72,66,156,2,10,245,211,243,89,83,223,31,198,82,200,93,6,4,97,56,169,161,238,227,235,3,102,203,16,162,196,123,115,
+198,22,185,247,18,204,5,91,11,178,174,141,48,20,96,93,208,42,196,91,8,72,141,184,89,103,203,43,33,78,4,69,123,184,116,17,11,182,86,208,4,248,119,248,111,15,111,235,211,62,107,22,248,25,91,137,196,85,240,57,124,222,44,236,114,77,9,49,155,235,13,78,163,
+15,55,25,104,77,186,139,209,125,176,81,231,172,147,57,156,204,107,38,32,85,80,120,36,132,216,3,42,7,14,7,45,79,219,194,94,9,244,246,74,174,92,150,201,116,145,149,109,210,117,48,180,111,223,96,80,201,141,129,104,23,183,68,221,168,96,116,120,4,177,14,245,
+166,32,235,97,56,4,247,6,55,217,196,157,32,155,93,79,219,48,92,78,95,149,168,60,62,153,236,250,117,50,18,43,163,197,81,152,212,45,240,213,209,168,229,175,41,33,86,32,238,51,38,22,26,125,223,19,98,101,96,152,123,25,89,170,219,163,186,127,74,196,45,177,
+59,133,116,27,12,32,221,213,231,95,117,126,70,145,99,42,93,144,151,102,210,236,212,108,2,133,98,135,242,173,109,81,25,139,250,165,103,205,254,100,71,159,95,110,29,14,91,50,27,143,56,23,108,40,48,149,243,192,88,76,151,208,137,12,158,167,166,152,254,79,
+8,33,221,6,5,230,42,71,146,121,75,108,162,85,179,217,33,108,226,123,186,125,40,253,155,193,160,142,79,173,231,158,225,176,252,106,178,187,239,60,92,31,149,214,97,124,118,127,212,223,149,92,188,86,64,144,223,94,51,12,212,42,247,41,113,46,48,219,16,123,
+147,55,216,13,108,196,57,235,6,240,46,8,78,45,233,26,254,15,221,225,159,89,104,36,93,4,123,217,91,182,132,215,105,97,82,49,93,65,19,123,180,207,47,71,23,114,242,228,244,18,255,52,117,160,80,236,48,224,74,121,120,87,188,165,24,135,3,215,15,174,28,144,
+95,156,76,112,115,77,186,2,50,169,32,22,223,189,37,210,244,192,127,44,145,147,223,205,164,25,239,210,0,108,182,84,29,107,96,177,200,76,48,171,80,42,47,27,114,25,205,100,232,176,39,27,3,246,14,24,152,184,54,50,1,133,229,76,177,44,7,103,210,242,86,210,
+60,129,240,198,1,117,1,22,223,211,109,161,120,75,200,216,182,218,232,247,181,131,145,107,122,203,80,200,84,161,24,7,191,207,12,133,214,237,113,113,159,38,243,37,249,195,212,146,28,205,20,77,251,249,136,115,65,71,38,132,5,85,50,60,99,89,134,179,233,130,
+161,92,221,233,52,215,148,70,180,26,254,207,156,123,98,6,112,17,239,213,25,215,135,207,29,16,161,88,92,7,10,197,14,227,145,221,113,221,2,4,62,135,207,83,44,38,221,2,98,49,156,236,152,60,140,161,18,181,121,97,147,233,130,54,225,147,83,214,155,115,50,149,
+55,36,20,51,239,217,58,124,146,41,25,250,27,254,105,129,27,109,210,121,110,234,243,203,125,219,26,183,143,134,188,189,218,127,223,101,146,235,2,217,184,70,50,34,205,200,149,244,212,179,174,108,224,247,181,131,93,174,105,149,86,7,63,20,57,14,236,136,201,
+11,147,41,83,139,26,196,153,32,182,175,145,59,173,25,19,41,22,120,173,194,155,137,92,221,66,83,43,222,98,100,99,83,214,14,255,175,146,41,113,112,29,233,62,232,56,210,43,18,87,193,231,239,202,149,24,207,186,6,38,236,59,8,12,36,81,117,169,225,243,15,140,
+234,207,23,34,164,19,32,123,248,153,243,105,77,52,174,126,97,80,36,69,226,214,96,163,155,82,188,78,112,33,51,239,217,58,60,103,32,86,101,46,91,100,65,143,116,28,108,168,155,137,196,181,96,35,253,224,80,168,235,127,132,218,131,167,42,40,74,218,129,210,
+114,119,59,104,218,185,46,187,2,221,23,139,85,220,65,184,159,247,154,224,208,38,206,231,152,162,43,18,143,53,93,106,214,1,157,138,170,195,181,185,127,214,79,117,248,127,245,139,34,49,49,131,47,232,136,66,169,7,10,129,100,53,220,73,57,4,180,141,26,113,
+168,137,201,131,84,54,26,252,94,55,247,7,42,67,160,86,90,183,143,46,21,216,154,72,108,11,54,98,207,158,77,234,206,123,70,182,218,115,211,204,123,182,18,88,107,145,137,165,87,248,64,84,197,211,103,249,55,36,157,71,117,67,125,253,80,72,115,182,219,101,
+191,0,71,83,55,153,203,26,235,22,56,223,229,61,73,59,215,37,211,229,88,40,236,227,84,221,65,184,175,143,158,76,108,216,207,68,220,9,68,223,239,133,189,235,34,122,26,241,226,57,190,183,173,6,76,41,125,254,94,185,50,222,122,77,193,188,20,230,234,18,59,
+131,247,39,102,32,32,222,170,182,115,9,123,149,67,179,105,199,233,33,40,18,235,93,159,215,130,203,3,51,196,111,103,57,52,188,138,103,211,231,30,249,161,53,126,20,210,14,119,14,6,101,164,13,135,72,180,183,71,142,56,168,61,10,11,227,119,118,198,228,150,
+205,97,237,186,68,253,189,218,23,254,249,154,254,128,220,50,16,148,124,161,44,231,242,172,118,18,251,177,80,90,150,115,75,5,217,29,245,55,21,139,177,201,125,118,50,41,103,243,116,162,90,13,172,183,88,167,134,90,184,37,33,18,51,30,136,108,4,216,80,127,
+122,147,186,67,184,219,251,133,79,10,101,185,195,160,147,249,95,103,210,29,255,121,154,177,84,40,105,123,12,85,94,154,94,146,11,93,124,198,241,14,49,122,77,159,63,223,221,107,122,255,150,112,203,117,114,45,1,79,175,204,44,21,186,122,77,137,59,120,115,
+62,39,123,67,43,231,138,70,224,189,253,210,185,37,70,160,88,20,188,191,124,165,101,25,134,120,214,160,19,247,253,185,172,60,61,181,196,121,41,196,182,160,19,231,158,173,81,233,15,120,196,215,219,163,221,235,213,47,172,95,216,171,236,139,250,228,45,7,
+197,218,221,214,31,104,75,15,147,229,30,45,6,147,172,64,71,177,67,168,58,102,141,18,247,153,151,59,215,105,90,229,45,74,101,218,165,153,153,139,132,180,11,90,186,254,233,84,66,254,54,30,208,4,227,90,23,155,214,42,183,152,227,240,8,139,131,181,103,111,
+34,167,185,223,214,86,192,113,208,60,190,152,231,250,68,54,140,189,17,99,251,134,173,225,238,111,29,141,12,241,156,72,118,191,248,13,119,14,134,170,169,56,90,16,43,99,134,171,7,215,71,117,176,147,25,215,212,232,253,134,251,155,221,99,100,35,64,92,26,
+10,109,119,15,135,37,90,115,126,66,132,12,50,137,249,222,182,62,200,34,69,148,219,13,125,126,137,123,123,101,91,216,39,179,185,162,44,22,202,114,36,149,103,20,30,177,53,223,219,29,215,181,15,25,12,122,229,251,87,12,200,79,62,158,119,196,31,188,109,61,
+44,192,84,222,90,40,20,19,71,161,71,36,174,133,225,229,196,206,192,233,128,123,151,247,175,125,129,144,81,219,34,141,195,39,197,13,103,129,1,47,40,232,108,15,251,196,95,113,47,89,97,120,167,209,13,53,220,154,221,230,181,11,25,121,40,210,167,244,127,213,
+172,1,68,191,158,72,234,30,44,108,102,172,12,174,143,170,80,108,198,53,53,122,191,173,220,223,230,181,144,34,7,122,95,220,47,49,239,165,195,58,132,168,55,230,179,20,161,28,128,246,238,30,95,180,244,47,130,123,112,192,215,43,217,210,178,22,25,195,172,
+221,213,96,15,125,209,80,113,129,237,230,196,25,32,62,65,165,88,13,243,220,119,119,198,228,231,22,95,207,186,129,25,131,133,173,12,133,98,226,40,238,28,81,15,48,71,120,249,145,100,158,173,221,132,56,20,28,150,110,26,8,174,19,69,224,142,131,240,97,165,
+195,19,69,98,103,113,255,166,144,236,27,12,174,139,136,129,59,118,255,230,144,214,222,250,210,108,134,237,173,45,192,51,186,47,145,211,149,43,41,149,182,97,179,158,107,236,37,16,23,243,205,157,49,9,121,27,139,156,153,98,89,158,24,95,52,109,239,129,235,
+179,119,46,43,215,14,6,117,125,222,204,107,106,132,92,217,156,235,138,194,208,55,182,245,213,117,192,227,223,225,122,227,90,62,211,229,8,15,226,14,112,255,221,49,16,172,251,222,121,160,180,50,204,237,121,138,162,132,56,150,235,12,68,138,193,89,236,4,
+163,74,162,80,146,145,54,228,77,100,55,147,75,48,163,216,33,236,9,123,149,51,220,106,185,144,43,202,59,54,207,210,130,155,120,175,206,67,100,45,40,30,57,45,163,153,16,178,194,87,182,132,229,127,24,137,72,188,206,164,126,252,187,171,227,1,25,245,245,242,
+249,39,29,231,107,163,17,237,176,222,204,89,138,1,35,159,138,248,229,200,98,94,10,93,214,138,7,60,61,114,89,84,221,85,156,200,151,76,201,180,195,51,186,169,183,71,187,102,205,176,130,8,151,42,47,203,235,115,89,201,228,74,50,232,239,213,92,42,165,101,
+209,190,112,253,14,206,164,229,169,233,37,237,115,102,242,209,146,190,107,250,246,39,25,121,206,164,1,47,87,71,252,77,243,96,27,241,193,66,78,78,101,187,123,232,133,72,247,237,177,152,108,110,17,151,129,235,205,247,14,233,52,213,251,111,119,220,95,247,
+189,131,127,183,53,226,147,235,162,230,188,115,8,33,27,11,220,196,35,6,99,197,70,131,30,219,231,21,23,75,203,134,230,68,84,57,177,152,147,163,105,26,118,164,50,239,203,22,142,226,234,196,198,81,180,109,86,170,163,104,215,203,151,153,5,85,229,157,132,
+254,9,250,245,248,227,156,253,91,215,111,232,215,231,138,169,199,152,129,195,50,33,196,218,64,36,214,227,150,131,75,241,107,34,242,155,41,190,75,72,103,216,31,245,235,118,191,14,4,61,114,207,80,168,235,226,38,34,107,110,29,14,43,127,223,71,9,243,138,
+202,184,70,71,83,5,219,116,8,96,152,149,213,7,90,225,154,30,78,228,228,230,193,160,236,172,25,144,154,47,45,203,120,42,47,7,103,51,166,70,37,28,94,200,202,125,17,253,145,98,96,121,89,76,137,100,250,210,112,88,123,158,245,128,245,225,182,116,145,179,4,
+72,199,128,72,172,231,254,195,103,224,122,71,214,50,33,78,5,6,178,88,77,87,143,27,98,250,140,20,255,171,68,29,48,175,10,142,104,236,93,154,13,122,111,198,111,77,42,136,91,9,60,55,119,12,135,181,142,56,203,11,197,223,218,22,149,29,125,254,117,255,30,85,
+209,80,111,143,38,142,254,125,60,32,47,158,75,185,122,186,172,145,1,42,85,240,125,78,104,119,30,212,185,57,175,71,208,132,204,197,110,82,59,116,163,246,16,152,42,148,228,229,153,52,219,221,137,227,64,220,132,222,150,106,169,28,218,247,39,11,242,118,138,
+83,202,73,251,220,174,40,192,226,94,53,35,187,84,117,72,28,222,27,102,31,182,32,4,51,107,179,179,96,56,234,41,173,80,102,189,98,25,246,246,119,42,30,252,142,153,32,190,142,248,122,117,23,135,170,220,60,20,162,80,76,58,194,109,241,128,238,34,133,84,98,
+80,240,61,188,255,136,211,56,48,18,209,214,226,181,113,179,40,140,67,243,192,28,1,167,198,77,182,35,246,26,21,87,173,198,159,103,51,134,76,16,167,93,172,35,86,193,179,83,107,60,181,180,80,172,119,98,35,22,2,12,48,219,181,144,115,181,187,24,11,223,163,
+123,250,149,191,239,15,116,209,173,123,153,56,137,71,47,139,213,21,2,240,66,24,244,120,229,192,142,152,38,22,208,89,160,15,44,162,152,194,94,29,176,147,43,149,229,92,186,200,206,6,139,129,33,66,170,220,50,20,162,80,76,218,102,87,192,35,81,159,122,241,
+241,154,168,95,166,187,44,194,98,221,199,196,107,189,7,132,103,207,38,55,252,103,34,100,45,143,159,74,232,30,16,8,33,192,140,247,49,158,95,85,176,78,160,168,201,194,7,105,151,27,7,212,187,42,247,68,253,20,138,45,196,93,3,65,185,113,83,112,93,182,61,242,
+236,143,45,228,232,118,108,1,58,208,31,222,21,111,186,159,129,174,4,173,228,133,73,119,27,12,157,12,204,12,155,2,30,165,78,123,236,27,126,53,105,206,96,97,171,176,86,36,6,150,181,81,194,73,172,234,142,197,47,119,83,29,247,177,91,64,117,236,5,197,155,
+28,159,119,138,155,180,180,108,60,108,171,228,208,65,66,40,182,232,113,139,225,51,248,44,105,12,114,159,254,126,239,160,182,206,96,109,194,70,4,95,248,103,173,179,97,239,160,182,201,35,214,96,167,129,67,59,220,56,17,29,66,4,33,205,216,106,112,94,192,
+80,27,93,49,237,0,17,14,155,228,102,224,29,233,164,253,2,177,23,213,1,129,112,180,55,99,46,91,148,159,158,76,152,242,187,5,12,190,59,6,12,20,149,8,89,119,31,25,120,127,172,141,239,33,230,241,221,157,49,205,5,89,111,0,42,254,221,245,67,33,249,79,123,250,
+53,49,148,212,167,149,72,92,11,12,134,123,91,100,243,219,145,118,134,177,181,122,191,218,9,20,139,143,234,204,91,54,115,223,96,21,180,57,95,117,132,117,75,174,54,88,4,235,197,77,232,225,206,145,72,183,127,92,75,129,234,216,147,167,23,91,62,236,248,239,
+248,156,147,170,105,231,219,56,192,166,29,216,130,162,90,108,193,103,33,134,146,245,160,202,134,77,90,51,231,57,254,27,54,121,7,92,190,6,89,5,163,45,84,59,218,24,10,74,8,136,27,60,200,197,188,230,8,197,16,225,176,73,126,125,38,173,72,48,255,25,0,0,32,
+0,73,68,65,84,9,198,181,133,83,56,153,176,217,254,241,177,121,186,111,136,169,224,62,253,201,199,243,23,239,83,236,99,171,95,56,232,97,79,251,243,113,251,117,70,5,89,156,36,109,2,87,58,177,47,16,137,7,117,236,61,67,21,199,44,89,15,206,188,170,251,254,
+47,111,239,115,220,149,156,201,24,239,78,65,28,165,147,128,88,140,125,65,35,35,4,254,61,246,19,118,220,55,116,154,59,26,68,117,88,242,68,124,143,129,92,145,42,88,36,160,138,187,61,175,24,155,105,92,7,12,120,139,7,86,38,110,75,165,210,132,193,32,78,188,
+62,24,200,103,180,192,112,114,209,121,215,195,200,181,184,110,83,136,173,77,107,104,84,101,107,4,62,187,55,145,163,243,142,16,151,50,147,51,182,217,158,52,185,253,28,237,122,110,24,246,66,236,141,211,238,211,41,131,235,5,33,85,230,28,38,240,184,9,116,
+34,234,17,137,171,64,231,64,164,32,227,2,87,51,102,160,139,208,137,154,17,206,240,56,203,27,137,212,196,204,34,167,129,179,248,209,138,91,24,70,212,107,250,252,114,54,91,228,25,189,6,92,151,122,157,12,98,85,161,120,180,205,202,40,196,81,58,95,236,49,
+109,187,147,24,29,232,7,55,138,211,196,81,163,206,96,188,88,176,105,161,88,112,137,70,85,182,102,124,97,52,114,241,197,68,204,193,232,212,219,211,89,110,30,236,68,181,32,90,29,102,138,98,232,201,84,222,212,53,236,163,116,65,238,55,240,125,70,5,102,66,
+136,249,124,152,202,203,254,205,234,123,47,51,223,57,56,32,222,62,20,146,177,168,239,162,161,4,49,110,19,169,2,231,46,216,8,12,65,53,178,231,73,117,121,120,42,89,15,50,137,85,81,25,64,235,6,176,15,52,58,107,200,137,154,209,187,23,50,90,23,172,10,152,
+85,228,116,241,20,93,73,221,158,3,98,7,174,105,98,44,180,100,244,68,187,83,23,225,160,37,238,4,3,253,84,243,134,157,56,156,103,56,100,188,216,178,219,64,85,214,169,52,171,178,53,3,197,10,230,136,153,203,184,129,161,116,243,217,146,44,57,52,175,220,105,
+32,91,14,67,216,144,51,135,67,83,53,51,28,255,140,8,152,31,92,57,96,218,204,2,220,67,199,20,7,4,225,192,206,65,138,132,216,151,83,185,146,246,14,81,1,235,132,89,239,28,152,2,190,115,121,191,214,5,133,125,78,117,13,197,63,87,231,46,184,121,238,139,221,
+48,178,231,25,167,169,202,116,140,156,49,164,242,252,146,21,98,109,156,183,6,77,154,13,177,145,192,252,166,55,159,87,42,17,12,116,168,187,151,102,186,143,35,149,12,143,209,178,18,177,61,122,7,158,8,135,243,16,29,52,171,178,181,162,157,239,37,237,243,
+94,66,253,0,244,6,99,87,108,1,196,139,3,59,98,77,139,202,158,222,30,77,68,54,75,232,56,56,155,81,26,12,114,200,129,45,127,132,184,141,223,79,165,116,63,247,40,14,253,206,164,231,30,34,19,10,106,173,230,46,152,185,134,18,53,84,223,57,248,236,75,220,243,
+152,74,59,98,239,166,128,243,4,78,163,240,90,172,7,29,33,239,204,102,164,213,156,127,56,137,221,62,200,205,237,228,202,141,59,75,28,41,20,231,74,108,165,113,51,213,129,39,168,166,213,115,23,99,209,196,194,8,65,153,17,37,132,56,147,15,210,5,121,127,78,
+127,139,17,156,93,116,116,218,131,207,143,234,31,24,121,239,214,168,41,238,126,180,2,63,57,209,122,176,44,120,101,106,137,247,30,33,14,0,174,98,61,207,61,156,199,232,102,51,195,77,140,245,240,86,133,72,45,179,214,80,162,6,222,57,175,158,215,95,120,120,
+121,106,137,29,84,54,38,238,163,56,90,229,66,27,177,93,78,27,224,86,11,156,197,255,229,232,156,166,135,212,14,128,197,144,226,211,201,188,60,118,124,129,78,98,34,147,233,198,134,73,75,134,220,24,205,150,172,50,199,156,63,82,169,166,73,37,99,173,90,181,
+61,146,204,107,66,178,211,73,20,74,50,98,240,241,110,103,98,42,33,86,226,153,202,161,233,218,193,230,174,13,136,196,191,153,98,30,163,29,56,48,18,209,220,194,122,129,43,14,3,114,127,53,153,234,250,111,7,209,232,103,39,22,228,75,195,97,185,50,190,126,
+32,38,10,150,47,159,95,210,62,71,8,113,6,120,158,31,31,79,200,29,67,33,217,25,245,175,58,207,192,69,140,67,251,193,249,172,105,34,157,234,192,112,51,215,80,162,198,107,137,156,100,75,203,114,247,104,164,225,57,26,103,236,231,38,83,90,49,157,152,11,206,
+164,42,69,155,90,78,178,184,124,145,118,174,227,39,138,113,65,118,132,121,243,164,25,205,158,31,75,10,197,83,233,130,236,104,163,213,233,143,10,46,50,226,14,220,54,156,237,208,108,70,203,152,51,194,159,20,114,141,156,206,217,54,134,204,28,161,91,221,
+18,64,44,62,154,42,200,77,3,65,25,235,91,157,221,61,145,44,200,251,116,18,219,10,12,93,82,101,123,164,189,1,185,237,0,49,72,43,66,76,45,201,213,53,131,122,49,192,138,110,46,66,156,9,220,157,43,197,199,37,25,241,245,202,160,207,99,153,103,222,200,192,
+240,118,135,140,147,238,129,253,204,71,39,10,242,183,241,128,108,15,251,196,95,41,172,230,203,203,114,60,149,151,195,201,60,223,61,22,1,198,37,116,185,26,73,204,228,25,227,18,184,142,70,134,217,75,229,188,76,136,155,105,246,252,88,82,40,126,105,38,45,
+143,26,20,138,241,139,50,115,150,184,29,60,244,115,217,162,12,6,213,30,113,56,220,220,224,184,214,11,214,18,35,29,14,248,30,94,71,235,0,231,76,213,61,131,67,123,168,183,135,46,78,155,226,87,112,19,87,81,113,32,111,36,116,112,17,226,62,32,26,227,203,42,
+24,233,216,108,119,200,56,233,46,16,130,53,131,12,39,252,91,158,137,84,94,217,28,7,173,131,103,140,213,252,97,106,73,155,93,161,194,105,151,116,25,19,210,138,70,207,143,37,67,167,240,208,190,99,176,194,243,235,137,100,199,127,30,66,236,200,211,103,83,
+117,51,154,27,129,207,50,171,104,61,127,54,176,22,25,249,30,210,29,112,96,167,72,108,95,172,34,250,18,66,8,33,132,180,3,34,93,84,206,106,82,17,117,200,106,96,236,57,170,208,17,11,177,157,113,58,132,172,208,232,249,177,236,116,2,4,112,171,60,240,224,133,
+201,20,43,67,132,84,192,179,128,129,125,122,54,32,112,192,254,130,83,79,235,2,87,198,105,133,22,47,172,91,110,139,58,33,164,91,168,76,117,39,132,16,178,26,85,81,74,184,238,18,178,161,232,61,171,73,69,235,96,231,116,125,144,197,139,235,179,220,226,82,
+226,76,247,83,158,121,9,89,5,158,159,181,70,221,158,43,126,244,170,165,223,254,24,66,118,203,150,112,211,252,30,76,111,124,98,124,145,34,49,33,13,192,0,168,61,49,255,58,55,30,54,38,199,23,243,12,186,215,1,174,97,171,220,103,136,196,110,190,150,152,140,
+142,161,55,91,66,94,241,84,22,109,76,20,254,40,145,167,120,78,58,194,119,119,198,148,35,117,176,71,248,135,227,11,252,3,16,66,92,143,145,53,20,177,100,236,56,35,237,130,61,226,3,163,81,25,14,123,87,157,235,241,142,158,72,21,92,191,127,126,104,123,180,
+225,179,137,98,205,179,103,147,20,137,117,242,224,80,72,118,199,252,18,240,172,120,34,75,203,203,114,62,83,212,226,77,169,23,17,210,152,85,235,180,213,133,226,42,120,224,47,139,250,36,234,91,9,90,198,3,159,200,149,229,208,108,154,139,38,33,58,193,195,
+127,77,37,11,235,8,179,153,148,169,10,161,24,236,130,200,190,222,158,30,41,148,151,181,1,156,110,223,124,180,18,210,185,201,37,157,96,111,200,171,156,67,247,250,76,154,133,10,66,8,49,184,134,62,121,122,145,239,110,210,22,56,199,95,63,20,106,250,63,129,
+125,226,227,167,18,174,222,75,227,156,113,115,127,64,134,67,43,3,36,19,133,146,188,147,200,241,249,35,132,116,29,219,8,197,118,167,58,245,88,56,237,156,16,226,48,244,184,173,171,240,192,73,218,229,209,203,98,50,18,209,231,136,67,14,29,91,12,9,33,228,
+18,223,218,22,213,61,64,203,42,157,82,181,231,168,185,66,201,82,3,2,73,115,208,29,124,235,112,88,215,85,130,88,252,147,143,231,121,69,9,33,182,103,127,212,47,99,97,175,12,5,46,157,89,38,211,5,249,203,98,206,22,239,48,10,197,27,72,164,183,71,238,25,10,
+201,149,241,192,186,137,193,243,217,146,252,117,62,43,175,37,212,114,152,9,33,196,74,168,28,0,164,18,119,242,227,99,60,4,88,29,28,202,239,24,10,201,206,168,127,213,251,107,34,89,144,183,230,179,242,65,186,96,234,111,240,189,221,113,233,243,123,154,126,
+134,34,49,33,132,212,71,143,88,108,5,145,248,182,120,64,110,30,10,73,212,183,122,172,14,206,81,111,204,102,228,237,148,254,25,18,196,28,254,126,239,96,211,8,201,181,48,234,132,16,98,103,174,14,251,228,222,209,200,186,247,86,45,199,18,57,249,221,76,218,
+210,230,81,207,166,207,61,242,67,11,252,28,142,3,21,132,175,143,197,100,52,226,171,59,165,61,228,237,149,93,125,126,185,46,234,151,35,139,121,41,80,174,39,132,216,144,3,151,245,213,93,227,26,129,184,142,126,28,64,211,116,21,91,21,28,204,31,220,214,183,
+146,53,189,230,111,27,15,120,228,234,120,64,70,125,189,114,36,101,158,88,252,230,124,78,124,165,101,25,174,243,51,162,24,241,113,34,47,255,231,153,164,105,63,31,33,132,88,153,119,146,121,153,89,42,104,110,167,106,142,39,192,32,40,204,22,248,215,179,41,
+57,164,56,84,188,147,192,108,243,239,71,34,242,153,161,208,58,179,141,84,206,81,87,196,252,166,191,139,72,115,208,113,54,20,82,203,196,142,248,122,229,208,133,140,142,79,18,66,136,181,192,25,234,139,219,163,117,223,91,181,108,10,122,229,83,17,107,235,
+128,116,20,111,0,16,137,239,223,30,213,253,63,140,170,248,47,39,22,25,71,65,8,177,21,200,82,123,116,79,191,242,143,76,167,167,117,81,121,127,189,63,151,149,103,206,167,77,255,93,152,189,78,8,33,206,226,107,163,17,173,35,83,15,111,127,146,145,231,41,44,
+90,18,61,221,63,245,120,97,50,37,111,37,233,22,39,132,216,135,93,1,143,124,115,87,92,233,231,133,14,248,179,113,107,158,137,213,74,124,164,37,168,128,223,61,26,81,186,80,3,65,143,124,117,52,42,143,79,58,207,253,4,235,253,206,154,74,114,162,88,150,195,
+201,60,69,113,66,28,192,53,58,51,14,215,82,235,94,34,214,65,245,253,117,237,96,80,142,166,10,166,199,80,64,24,158,230,176,58,66,8,113,4,56,59,232,21,137,193,254,205,33,219,100,62,186,13,163,251,189,152,151,251,68,66,156,0,28,182,123,162,126,25,9,123,
+53,151,45,114,200,167,211,69,57,158,202,59,46,130,245,139,163,250,141,162,85,160,3,226,26,89,241,90,80,40,238,48,119,12,4,91,90,205,235,49,214,231,211,170,16,167,114,37,123,253,194,13,128,43,237,246,225,112,221,108,150,59,71,35,182,200,101,33,132,16,
+55,113,67,159,95,249,253,181,47,238,55,93,40,38,132,16,226,28,240,94,81,229,154,168,159,5,67,66,8,177,8,208,181,190,188,189,111,157,22,132,115,6,116,47,124,33,127,254,217,179,73,71,232,95,248,125,33,250,26,1,215,193,138,66,49,203,117,29,70,239,228,255,
+122,220,160,80,61,183,50,104,23,67,235,114,179,0,111,56,5,254,151,93,113,237,161,34,132,216,147,69,182,248,59,138,237,97,245,218,49,134,221,17,66,8,33,157,98,115,64,253,93,180,155,239,34,75,146,43,25,219,39,114,127,105,29,224,240,175,126,17,162,7,232,
+59,7,198,98,77,181,32,128,255,142,207,57,65,15,186,170,141,119,16,174,195,72,139,107,101,6,116,20,119,16,252,129,91,61,16,205,24,50,176,49,178,26,247,111,10,233,110,23,195,181,66,165,233,159,78,37,232,44,38,13,193,198,4,238,146,152,215,35,81,127,175,
+164,242,101,201,151,151,29,217,178,98,55,144,31,119,159,129,159,25,131,114,136,245,192,51,166,138,145,14,26,66,8,33,164,17,70,93,89,196,122,156,75,23,101,175,98,70,49,6,42,50,159,216,92,160,105,220,49,180,254,76,255,144,136,214,21,124,112,54,195,168,
+23,82,23,196,216,65,252,213,123,62,192,231,240,249,159,157,88,176,181,30,180,173,205,66,202,160,207,99,185,103,138,142,226,14,130,63,176,155,193,75,5,57,97,42,64,44,190,103,72,237,123,136,59,192,139,6,238,244,135,198,250,180,141,202,72,196,187,82,113,
+139,120,181,118,21,68,152,252,221,78,186,210,205,102,122,169,168,252,19,188,60,99,254,0,52,66,8,33,132,88,143,20,5,40,199,240,228,244,146,38,252,170,112,140,38,16,83,65,94,234,195,59,227,13,141,95,87,86,254,251,109,14,233,132,38,157,197,72,12,43,62,143,
+239,35,214,130,142,98,210,49,238,48,40,248,98,32,210,75,179,25,199,186,138,145,215,60,92,35,102,230,202,203,114,36,149,103,37,182,9,16,137,191,61,22,107,233,42,193,127,71,21,242,201,137,69,199,228,123,219,141,231,166,82,242,157,203,251,165,71,231,158,
+0,194,242,209,140,186,184,76,54,158,217,92,81,43,196,168,128,105,189,132,16,66,72,167,152,203,150,148,59,52,241,254,34,214,228,197,115,41,185,111,155,190,33,79,24,116,5,113,153,152,3,186,56,239,212,49,212,24,194,30,62,55,95,40,115,78,69,3,112,150,133,
+248,185,187,207,191,234,60,139,115,208,7,139,57,199,118,197,238,27,52,38,248,226,251,158,191,144,233,248,207,211,45,140,156,161,172,14,133,226,14,130,133,242,161,54,254,231,242,54,23,74,183,182,97,185,255,84,216,39,111,167,156,213,102,212,108,160,223,
+173,195,97,153,72,22,228,169,169,20,99,55,234,0,151,185,222,214,67,108,86,48,101,244,103,227,137,46,255,148,4,76,23,203,218,33,224,222,173,209,150,98,113,50,95,146,199,206,44,242,186,89,148,195,137,156,86,184,83,225,36,219,67,9,33,132,116,16,68,139,161,
+115,76,133,195,116,161,90,22,45,70,98,178,181,88,140,61,226,175,39,146,174,190,86,102,115,175,14,145,184,22,124,254,131,19,11,14,190,34,198,128,6,112,247,104,164,174,179,22,98,34,190,110,28,8,202,83,147,73,71,25,199,208,93,110,52,146,14,223,135,239,183,
+235,245,56,223,166,97,205,138,5,23,70,79,116,24,35,109,216,85,142,219,92,40,109,39,159,121,216,97,241,1,104,199,105,53,208,15,155,224,191,187,188,159,209,9,107,192,75,66,85,172,130,168,204,22,40,243,192,33,224,191,157,88,144,185,108,253,245,15,109,135,
+239,204,102,228,167,39,41,230,91,25,184,242,85,222,97,112,254,28,228,148,121,66,8,33,29,4,78,59,149,119,209,251,115,89,118,149,89,28,236,19,31,59,190,160,253,93,75,107,12,50,153,98,89,94,159,73,107,123,196,105,14,177,51,13,156,163,84,207,242,248,252,
+126,14,146,92,5,174,7,52,128,86,130,41,206,174,136,240,176,226,16,51,163,180,27,195,106,231,24,215,195,201,188,118,46,50,130,85,227,118,232,40,238,48,104,37,48,98,59,199,141,117,152,206,44,71,128,23,132,158,182,29,169,84,207,56,208,111,53,215,24,220,
+112,236,137,250,57,220,206,68,176,185,255,249,248,138,91,248,174,154,156,41,76,174,230,80,18,251,240,207,147,73,93,177,47,90,123,232,196,34,215,45,66,8,33,29,71,239,187,8,194,35,226,235,136,245,193,62,145,93,101,214,101,123,216,152,44,52,22,246,58,174,
+43,216,40,136,155,184,91,193,149,13,29,224,129,145,40,159,11,7,128,243,208,123,115,89,229,121,93,154,233,198,162,239,176,182,74,24,112,66,210,13,185,26,213,42,120,149,87,207,167,93,125,224,78,56,168,130,140,184,9,21,80,141,101,128,251,37,2,189,6,91,86,
+12,126,31,233,60,255,54,159,189,248,69,145,216,94,224,61,244,203,137,69,45,26,167,17,200,37,102,46,56,33,250,25,241,246,106,5,52,252,191,132,144,214,84,223,69,112,11,215,3,135,235,183,63,201,104,2,11,11,150,132,180,79,204,107,76,211,25,10,208,119,88,
+5,209,137,170,209,11,48,24,94,221,70,124,167,149,56,221,160,179,84,47,237,126,191,217,32,99,89,85,7,132,6,104,213,184,13,229,39,27,109,9,200,84,89,91,225,197,193,241,175,243,89,58,250,20,170,224,85,96,55,119,194,117,131,176,160,154,41,86,229,156,205,
+23,134,42,70,218,118,196,1,1,238,86,32,96,48,19,137,16,178,26,28,186,31,159,76,106,237,112,159,142,5,164,207,223,171,29,32,38,211,5,153,201,149,232,28,33,68,7,16,133,31,24,141,202,112,216,123,49,191,29,243,9,16,197,51,147,46,106,131,64,217,102,77,72,
+99,240,46,122,230,124,90,115,12,99,150,73,53,166,110,60,83,180,92,158,35,158,247,107,250,86,58,226,206,102,57,180,151,16,55,178,179,207,88,87,236,190,184,223,17,67,1,177,102,67,40,53,210,93,143,239,115,66,209,15,58,224,87,71,163,45,53,49,20,59,33,18,
+91,89,3,212,253,87,132,115,24,3,163,26,137,159,248,247,104,183,191,121,40,36,207,158,77,186,218,105,84,173,130,163,170,212,44,107,21,55,200,203,83,75,142,57,116,27,25,62,33,149,133,193,41,247,203,22,131,14,123,84,31,241,140,209,161,103,156,156,193,92,
+32,66,204,96,111,200,43,95,24,141,72,159,255,210,154,1,1,41,85,40,201,31,166,150,44,113,200,68,133,155,5,44,98,85,224,192,217,27,245,93,116,51,45,22,75,114,54,93,180,196,166,251,166,62,191,124,126,52,34,158,58,157,46,16,141,113,136,250,206,229,253,218,
+32,80,43,116,93,160,200,141,182,227,170,163,12,211,187,39,210,69,22,133,136,37,192,185,74,187,23,83,214,251,123,160,83,224,51,117,92,132,120,159,195,8,244,228,244,146,105,63,27,33,42,224,29,58,98,32,149,20,239,11,178,130,209,121,77,70,221,220,86,228,
+47,243,89,185,63,210,124,112,101,61,254,226,144,153,39,85,179,13,246,168,183,109,10,173,19,205,161,255,141,167,242,90,220,132,213,7,247,233,90,13,32,96,29,24,139,233,178,210,227,1,193,103,221,222,150,90,173,130,191,49,159,213,28,89,219,106,90,10,242,
+229,101,77,84,69,38,177,147,218,165,112,56,187,58,22,80,174,34,189,230,32,33,162,157,246,155,144,7,47,23,10,197,70,99,72,176,193,33,196,14,28,24,137,200,222,254,245,195,23,33,32,65,56,62,176,35,38,71,23,120,192,36,164,30,200,0,252,198,182,190,117,123,
+13,28,112,175,140,7,52,195,194,139,83,75,166,185,115,224,44,188,119,107,244,162,139,184,17,248,239,247,109,139,202,25,12,120,50,201,89,140,253,61,230,36,172,61,220,226,218,94,59,40,242,233,165,162,60,55,157,114,212,84,118,66,58,197,163,151,197,26,158,
+121,240,124,227,61,255,189,176,151,131,124,137,45,56,158,44,104,239,80,85,80,84,36,164,10,138,122,123,18,57,165,123,9,69,53,167,21,166,177,7,173,238,67,171,209,34,153,82,217,86,250,168,103,211,231,30,249,97,171,15,125,123,103,92,66,10,185,106,112,80,
+236,142,250,229,189,68,78,10,46,55,249,165,202,203,242,113,166,40,127,89,204,93,252,122,39,153,151,51,185,146,35,175,205,185,76,65,246,197,3,117,93,52,245,120,101,106,73,254,226,160,133,97,63,162,39,252,198,170,137,31,38,242,242,9,15,99,218,179,113,203,
+64,80,247,61,84,229,255,61,159,113,221,245,131,96,114,69,200,39,155,125,30,237,43,93,90,118,253,154,107,117,26,137,196,107,25,10,122,165,95,68,142,114,3,78,200,69,176,230,33,218,107,115,147,161,59,48,53,92,29,15,200,108,186,104,202,59,225,127,220,214,
+167,197,181,232,229,202,168,79,222,156,239,190,11,186,106,2,105,182,191,199,126,6,123,186,19,201,188,182,159,37,132,172,128,119,249,206,88,235,54,243,128,7,17,78,126,83,158,113,162,15,188,87,110,142,5,100,95,212,47,159,238,15,200,142,128,87,182,248,61,
+50,87,40,187,106,79,61,149,47,105,231,88,149,140,221,84,161,44,255,50,67,83,67,149,59,134,212,6,153,85,193,117,132,70,228,20,198,211,69,217,230,247,74,92,71,167,53,162,75,159,157,94,114,244,179,134,189,40,190,22,108,214,253,220,82,40,70,75,205,229,58,
+94,132,107,193,34,227,47,139,38,146,18,247,128,131,196,225,133,156,236,10,250,154,10,166,218,132,199,25,107,231,178,24,1,153,158,91,35,198,114,154,95,155,205,240,32,86,165,180,44,187,20,114,158,240,146,121,121,206,61,45,242,184,207,190,56,28,150,47,109,
+139,106,130,72,245,235,150,77,33,217,21,240,202,98,190,100,187,151,145,27,128,211,240,158,173,250,219,177,70,194,62,57,182,144,227,186,64,72,133,111,108,93,239,36,110,196,158,168,95,219,143,116,251,240,241,197,173,250,39,158,75,69,72,50,227,57,215,107,
+2,65,209,118,91,192,235,168,67,44,33,237,160,250,46,199,51,238,43,45,203,41,135,204,99,113,18,251,163,126,249,250,88,76,246,196,252,218,249,109,83,208,171,253,191,56,131,236,239,15,74,188,167,199,85,90,198,76,186,32,215,41,12,88,71,7,57,207,27,151,80,
+21,218,171,32,138,224,163,37,251,103,20,87,193,190,11,198,72,172,123,195,33,111,93,243,23,180,160,63,126,146,209,58,240,105,114,178,38,45,133,226,47,111,139,26,186,225,65,204,239,145,55,29,146,55,66,244,131,135,29,7,138,165,108,73,2,61,61,218,226,80,
+189,135,144,71,252,238,124,86,254,101,106,73,78,56,112,195,84,44,47,43,189,96,171,160,146,248,242,44,179,64,171,192,85,60,234,235,213,54,108,173,192,32,77,4,199,187,229,37,3,23,216,127,216,17,151,45,161,250,215,6,213,219,79,197,2,154,216,126,134,153,
+215,150,226,223,143,70,164,95,49,199,124,200,215,171,109,182,8,233,38,15,14,133,228,11,35,17,185,99,40,44,159,221,20,146,27,98,126,137,245,244,152,42,116,96,237,251,119,195,97,221,159,199,222,99,185,216,93,113,6,230,138,203,162,234,197,226,92,161,220,
+213,159,19,153,196,123,21,218,66,81,248,55,203,161,93,5,215,246,254,145,176,220,185,121,229,158,188,101,48,40,219,253,30,185,144,45,177,152,70,186,202,253,91,194,90,215,143,10,253,254,94,186,138,45,198,87,182,132,229,182,225,112,195,14,70,252,123,136,
+198,56,143,28,73,57,71,196,107,6,68,95,156,223,119,68,124,77,59,59,33,242,189,120,110,73,62,160,33,112,21,131,149,123,70,149,151,166,151,28,41,184,99,95,243,218,92,86,219,63,100,242,101,153,74,23,181,175,55,46,100,229,217,153,37,22,207,44,78,211,183,
+28,90,49,140,134,114,75,37,175,24,206,55,102,155,185,19,100,205,184,109,16,10,114,103,140,76,251,252,19,69,226,117,252,102,106,73,110,75,23,229,179,91,194,13,139,85,239,207,101,181,74,164,91,208,155,23,143,255,142,225,162,231,178,206,25,20,233,4,70,195,
+234,155,199,70,5,1,66,54,130,70,67,216,6,61,94,185,53,232,213,134,54,61,126,42,97,74,166,238,85,81,245,238,54,196,160,253,27,13,11,235,216,99,224,90,238,12,121,77,201,125,134,123,243,225,93,241,58,239,189,30,45,198,7,57,136,111,156,79,243,239,76,186,
+198,230,6,131,221,155,17,86,136,112,36,27,15,156,196,205,6,206,215,130,53,230,174,108,201,53,107,12,206,238,147,227,69,45,70,97,103,212,191,106,237,181,211,32,46,51,56,56,159,213,222,75,42,250,25,186,98,157,126,86,171,205,235,37,246,161,233,9,116,135,
+98,181,180,30,131,62,15,23,18,226,42,94,62,191,164,123,248,163,84,92,214,78,139,224,232,20,184,46,248,194,134,110,184,198,137,153,43,47,203,145,84,222,117,107,203,221,91,34,74,29,30,95,28,141,202,207,198,57,68,197,206,120,90,77,196,34,164,67,64,36,198,
+112,181,102,96,253,121,116,79,191,60,102,194,0,182,128,129,238,54,213,162,173,91,240,43,206,0,0,218,80,230,46,15,31,134,72,252,200,238,120,83,103,27,150,200,91,43,78,115,138,197,164,27,68,125,234,66,177,234,220,13,178,177,220,174,208,157,2,80,36,117,
+211,250,130,243,21,12,59,34,75,154,73,5,3,215,237,54,136,203,12,150,202,203,242,236,217,164,110,29,0,93,177,79,77,165,156,120,41,136,3,96,121,147,144,14,131,151,40,50,155,242,58,90,72,32,18,35,54,129,52,7,213,237,231,47,100,46,126,97,179,230,54,145,24,
+221,25,170,162,199,64,208,163,109,240,8,33,164,21,247,42,100,110,194,225,217,109,140,198,160,117,147,35,6,99,98,206,178,253,178,46,95,31,235,211,45,176,65,44,30,161,107,147,116,129,84,65,93,44,43,49,30,197,50,96,95,172,218,49,141,247,207,126,3,157,24,
+78,0,231,90,184,65,41,18,235,163,170,3,164,90,156,83,225,36,254,229,196,162,38,46,19,98,69,154,174,146,115,6,94,132,107,65,245,137,16,183,129,151,196,227,227,9,57,214,192,41,140,151,199,235,51,105,121,236,12,95,16,68,31,151,27,136,45,16,131,237,218,100,
+99,200,25,120,31,26,57,144,18,162,10,38,248,171,152,215,113,104,190,73,97,224,104,39,72,230,213,159,31,20,99,187,9,92,214,122,138,196,181,224,243,71,187,156,243,152,55,176,239,152,236,114,219,232,222,144,87,250,252,106,133,206,123,20,93,130,132,24,225,
+147,172,250,123,57,109,66,92,15,169,207,86,131,29,211,195,52,94,16,157,64,7,248,199,19,11,242,202,212,146,38,8,207,87,214,12,236,73,160,13,60,61,145,148,199,39,147,212,0,136,165,105,186,82,194,177,135,13,172,81,23,7,190,151,213,39,226,86,170,109,59,145,
+153,244,170,24,23,182,238,16,35,196,233,148,178,61,239,205,231,46,182,72,235,229,163,4,7,217,145,141,103,107,88,253,224,124,67,127,80,222,234,226,160,197,15,83,121,217,191,57,164,244,61,221,22,55,193,43,211,75,45,35,60,106,249,179,9,51,10,142,167,242,
+50,214,167,86,124,28,239,178,152,125,189,194,176,189,42,70,114,224,9,81,229,208,108,70,203,33,85,225,61,14,178,179,12,220,79,147,110,81,141,80,36,196,142,180,92,41,27,57,34,245,48,238,178,65,102,132,212,3,213,194,106,136,59,91,119,136,81,114,172,58,219,
+30,68,166,168,184,13,241,89,102,110,146,110,16,240,168,31,156,35,190,238,70,65,84,135,197,234,5,207,207,65,19,158,31,136,231,71,23,244,237,157,241,57,51,158,113,28,92,91,181,197,214,130,235,222,237,65,52,113,3,57,176,86,225,234,176,79,251,138,48,151,
+214,145,160,115,224,180,66,145,44,83,44,243,93,110,33,102,120,14,35,132,144,150,180,180,144,188,52,155,209,166,125,170,186,138,181,13,186,9,46,9,66,8,113,34,83,6,55,182,220,16,91,139,199,79,37,90,14,103,146,74,158,33,62,75,156,5,178,198,49,73,252,202,
+53,110,73,180,38,190,53,159,229,84,232,22,32,211,255,239,46,239,215,181,39,125,121,106,201,180,182,206,39,167,151,228,174,92,73,110,217,18,174,27,233,177,188,44,242,238,133,140,252,214,196,125,178,222,129,59,216,207,63,55,205,97,59,173,128,48,124,211,
+64,112,157,83,27,45,199,175,156,79,243,217,118,24,191,154,76,201,247,118,199,91,198,163,224,249,121,98,124,209,237,151,203,82,76,230,140,117,71,124,72,3,28,33,196,69,120,54,125,238,145,31,54,251,117,11,203,34,217,124,89,174,136,169,101,209,29,156,73,
+203,135,105,14,231,32,132,144,78,240,73,161,44,251,21,139,118,56,160,60,127,62,173,173,227,196,26,164,202,203,242,113,34,47,87,70,125,13,93,156,201,124,73,254,175,241,69,205,181,68,156,195,109,241,128,124,117,44,38,155,234,228,35,198,3,30,185,58,30,144,
+82,161,44,103,76,40,238,220,212,31,80,118,21,207,103,203,242,151,197,238,182,84,98,45,59,145,204,203,238,176,79,66,13,218,135,177,238,189,120,110,73,27,130,106,38,167,178,69,57,116,33,35,153,92,73,162,158,94,205,193,139,175,119,231,179,242,248,217,164,
+28,53,121,143,188,80,90,150,115,75,5,217,29,245,55,124,175,192,73,252,228,217,164,41,195,99,247,132,189,50,164,152,37,138,236,229,215,231,186,239,220,196,179,253,197,237,81,237,57,94,11,238,83,60,219,163,190,94,57,146,162,88,236,36,222,156,207,73,191,
+136,108,14,122,165,119,77,69,8,197,160,153,116,81,254,235,169,132,246,222,39,214,1,127,143,93,1,111,221,231,181,17,40,248,188,116,129,6,56,66,136,123,232,185,226,71,175,234,122,123,97,19,244,217,45,97,93,206,131,87,207,167,153,199,66,8,33,29,6,19,151,
+239,223,174,63,251,18,3,19,217,238,104,93,48,172,233,111,6,131,18,232,93,17,188,114,229,178,252,113,46,219,245,193,86,100,227,81,121,118,49,252,164,219,123,168,7,135,66,114,253,144,90,254,239,11,147,169,174,102,20,175,5,215,116,79,159,79,98,222,149,195,
+62,68,194,179,233,130,188,153,200,113,64,140,34,216,227,111,15,123,47,94,203,197,98,73,142,39,11,166,138,237,35,222,94,121,116,79,191,210,247,32,202,3,110,238,110,162,242,108,191,253,73,70,158,167,216,228,72,240,62,223,94,41,108,44,22,203,166,174,141,
+164,53,232,238,121,120,103,92,183,249,226,137,83,9,70,7,18,66,92,133,238,82,61,14,45,39,210,133,186,45,147,85,144,103,140,184,9,51,156,7,132,16,226,116,112,104,223,147,200,53,92,131,107,193,122,76,145,216,218,64,16,62,58,201,150,110,55,112,187,194,16,
+67,20,229,15,39,243,93,21,59,17,129,112,237,96,176,101,36,74,149,140,5,132,16,172,135,102,187,134,157,130,86,152,176,152,193,3,29,21,112,52,143,68,244,29,85,16,215,211,109,145,88,20,159,237,125,131,65,45,55,155,133,12,231,161,189,207,89,228,181,13,208,
+42,158,156,88,212,21,191,131,226,45,69,98,66,136,157,184,169,207,47,177,74,231,221,145,100,222,80,151,170,110,71,241,90,174,94,51,89,216,14,217,91,85,247,214,96,192,163,181,88,230,74,101,153,203,149,232,224,34,164,9,85,151,196,217,44,55,193,86,225,174,
+129,160,124,102,40,84,119,115,139,174,142,247,230,178,116,45,17,98,17,84,59,1,196,36,87,49,54,149,247,109,107,253,115,66,144,251,197,201,4,163,81,72,87,248,193,149,3,186,10,24,102,56,220,141,60,219,236,244,33,196,58,52,154,27,32,149,217,1,135,102,211,
+20,137,45,0,206,61,136,73,170,146,40,148,228,16,204,137,220,135,16,114,17,104,54,95,24,141,212,205,206,199,222,253,248,98,94,169,160,110,88,40,182,19,184,104,15,108,139,54,204,179,3,115,217,162,60,125,54,197,5,135,144,74,203,231,215,199,250,214,45,52,
+213,204,181,231,166,248,172,152,13,166,169,223,208,231,151,45,1,143,12,5,188,90,171,240,108,182,196,182,235,53,236,10,120,228,170,218,205,101,177,220,117,183,38,113,55,247,111,10,201,254,205,106,177,14,232,8,248,205,84,247,221,145,16,139,239,28,137,52,
+116,88,161,16,133,33,139,92,255,73,55,249,238,206,152,12,54,200,43,198,61,137,193,124,102,20,178,141,60,219,16,159,30,159,76,110,216,207,68,72,45,216,3,221,16,15,104,251,196,42,147,233,130,150,47,207,14,224,75,96,79,189,163,102,141,57,157,45,114,159,
+104,1,32,16,55,26,10,43,149,28,253,199,206,112,88,36,33,7,70,34,178,183,191,117,199,177,202,62,222,241,66,177,94,135,140,184,192,37,131,197,214,168,245,156,184,7,220,39,183,234,104,165,52,59,159,146,144,102,224,112,116,247,150,72,221,182,101,186,174,
+73,55,49,34,38,153,125,248,169,186,119,6,131,43,197,194,185,108,73,14,47,100,185,230,19,211,88,155,233,14,204,190,39,237,248,108,19,119,0,225,243,75,195,225,166,81,101,204,204,38,86,70,175,240,197,46,39,210,12,204,224,24,14,93,74,66,112,162,27,93,117,
+206,8,158,153,31,31,155,111,249,57,181,113,194,54,3,174,72,189,34,49,64,107,219,35,187,227,186,46,156,29,192,239,255,192,104,84,134,195,222,139,149,184,170,0,136,169,250,127,152,90,98,148,0,89,5,10,43,122,68,98,160,61,91,20,139,137,5,129,72,220,44,119,
+14,255,30,135,251,62,127,175,41,174,77,66,90,129,14,1,51,65,107,60,219,227,137,149,112,74,166,187,217,207,54,113,7,223,216,214,215,50,223,27,251,160,128,167,71,158,57,159,230,93,65,44,5,138,213,122,68,98,169,232,55,15,109,143,202,207,199,89,128,35,151,
+120,244,178,88,221,53,112,68,188,218,189,133,162,173,19,58,164,161,247,169,14,163,198,51,131,235,211,170,104,221,56,139,193,1,160,117,94,149,234,133,179,59,16,252,48,45,26,15,72,189,118,13,68,10,28,216,17,115,196,239,74,58,199,189,91,213,178,246,208,
+162,76,136,149,128,139,70,207,112,18,0,167,13,54,163,132,108,36,51,6,242,13,207,166,89,196,37,196,234,124,104,96,152,34,159,109,178,209,192,233,174,119,8,36,134,152,174,157,59,68,136,217,124,70,81,248,66,52,17,180,15,66,192,247,118,199,91,174,129,248,
+239,48,136,142,52,137,166,181,3,15,41,206,73,168,253,253,91,253,238,142,117,20,163,69,173,94,144,179,30,224,192,181,51,42,113,27,184,73,144,253,198,42,28,65,219,66,163,12,168,70,64,140,195,253,70,87,49,177,10,127,27,15,232,18,137,171,96,51,74,231,164,
+115,192,122,116,219,230,144,68,125,158,139,235,89,166,88,150,137,84,65,105,128,67,39,121,59,149,151,219,11,101,137,250,244,109,70,17,141,114,152,107,42,33,150,7,67,174,230,179,37,25,8,234,59,111,152,253,108,163,149,123,79,204,191,106,56,160,145,1,55,
+196,218,236,27,84,43,128,223,52,16,180,197,80,122,226,14,176,143,83,217,199,87,185,121,83,144,231,81,162,137,196,122,53,64,188,11,31,222,21,151,159,124,108,223,52,129,129,128,113,221,242,246,161,80,211,119,191,99,133,226,235,155,100,50,181,2,135,75,187,
+138,95,168,12,168,186,66,81,133,131,171,206,137,98,9,254,142,55,244,175,222,48,49,103,177,62,151,69,141,57,10,112,125,121,61,137,85,184,74,113,237,199,102,20,110,26,30,146,236,79,163,129,87,24,100,139,54,179,239,247,249,77,27,196,118,104,38,45,247,235,
+172,250,191,122,62,205,33,58,132,216,132,223,79,165,116,119,177,188,60,181,100,202,179,141,179,1,14,195,245,126,70,28,148,205,94,31,73,231,64,244,150,170,200,54,214,71,71,49,177,14,87,197,140,57,131,97,16,32,171,129,113,242,238,225,176,38,38,214,154,
+193,204,54,80,108,20,208,179,84,141,162,88,47,81,68,181,227,181,192,187,93,213,228,87,203,230,22,69,110,199,70,79,196,219,92,44,98,54,180,207,133,113,0,0,32,0,73,68,65,84,181,161,223,51,220,120,50,104,51,84,91,60,172,14,4,226,31,92,57,160,57,171,53,107,
+125,205,23,254,221,247,175,24,96,139,202,26,140,190,96,35,190,54,86,40,66,58,140,94,103,87,45,59,67,142,142,235,119,5,141,68,226,90,176,25,68,155,153,25,192,85,252,138,142,60,108,12,23,122,45,145,115,251,159,147,16,219,0,87,241,115,147,41,205,45,220,
+12,60,255,111,27,136,170,232,4,141,68,226,90,240,223,241,57,98,111,66,30,71,167,74,18,23,80,59,176,148,24,7,226,39,98,70,177,55,94,171,13,93,52,80,92,49,96,251,232,133,90,246,13,24,51,138,238,49,88,156,48,155,107,218,212,178,90,105,63,124,18,29,198,168,
+193,156,41,108,16,247,58,68,44,193,194,8,49,184,182,181,110,45,248,125,241,25,138,197,132,16,98,111,240,238,106,37,18,87,49,115,14,1,4,224,39,78,37,100,34,185,222,189,142,127,247,244,68,146,19,232,9,177,33,232,72,249,217,137,5,121,127,46,43,169,194,37,
+71,46,254,249,88,34,39,143,157,88,48,173,0,132,61,177,94,135,105,213,89,69,8,33,102,145,43,179,171,161,93,176,142,235,25,6,88,53,80,56,69,44,54,26,59,139,179,129,29,175,193,98,155,29,64,165,229,230,5,110,218,168,28,134,145,76,159,42,219,131,94,109,170,
+180,157,129,240,171,119,74,42,128,88,188,120,122,209,246,191,119,39,72,21,74,50,232,81,95,18,150,10,238,104,145,174,182,239,212,86,223,230,178,37,57,52,155,230,253,99,33,82,10,89,176,85,18,108,181,181,53,95,24,85,19,54,204,156,67,0,247,225,169,201,164,
+246,207,35,190,94,9,245,246,104,255,142,16,98,111,16,41,241,204,249,180,8,190,44,132,170,83,106,23,12,20,204,43,182,45,115,5,245,247,73,43,55,60,233,46,245,178,196,65,50,95,146,95,79,36,29,31,15,51,153,46,202,14,3,70,174,92,137,123,121,169,156,87,85,
+180,16,220,103,95,31,235,147,159,158,76,108,232,207,101,117,224,206,157,182,89,12,43,162,63,239,107,227,251,19,185,230,207,140,99,29,197,39,219,108,239,58,194,204,85,91,114,167,1,39,132,170,200,224,84,206,164,140,101,180,34,243,217,233,160,173,189,218,
+190,131,98,76,245,11,81,38,248,247,102,57,20,201,122,206,25,200,26,62,193,124,98,91,19,86,116,1,160,5,207,10,29,52,211,133,50,69,98,66,200,134,210,172,187,174,30,237,24,78,136,249,224,189,82,235,106,215,195,184,73,145,40,100,53,112,52,34,10,0,34,95,189,
+231,22,110,201,71,247,244,107,57,172,78,6,51,147,90,24,29,235,242,222,60,99,187,196,160,174,129,123,203,41,157,229,110,35,211,70,225,168,149,134,227,88,161,216,232,34,35,149,11,206,97,14,246,3,11,156,145,13,46,22,71,39,229,243,24,229,183,179,25,229,103,
+6,46,4,167,15,178,67,214,117,171,182,118,8,198,223,51,41,251,148,172,230,224,172,90,235,62,218,130,167,21,15,85,196,90,168,10,33,82,233,160,33,132,16,66,156,6,134,167,234,5,251,120,213,125,19,217,24,16,1,160,231,28,123,235,112,216,241,209,137,239,42,
+198,112,225,62,118,226,80,126,35,24,141,95,248,155,65,103,23,32,90,113,54,107,207,238,224,191,94,48,118,223,235,209,112,28,173,142,29,51,152,7,102,244,130,91,129,82,27,211,148,237,250,128,84,185,62,110,44,192,92,58,16,6,238,20,94,60,151,82,250,77,94,
+113,120,123,34,156,194,122,69,40,188,152,153,237,103,62,16,125,245,12,13,3,243,217,146,252,78,225,64,69,172,137,145,162,112,187,185,94,132,16,66,136,21,193,208,68,228,101,235,225,213,243,105,22,203,45,0,206,15,42,69,239,207,59,188,27,22,230,37,68,109,
+232,1,218,199,227,167,220,29,155,80,165,29,227,91,159,98,108,159,21,49,234,174,197,57,194,174,49,146,40,144,232,125,86,106,121,246,108,178,229,103,28,45,20,63,57,189,164,124,225,78,39,243,182,174,72,157,93,50,214,66,141,69,214,238,57,171,241,22,147,27,
+73,107,80,89,122,71,167,179,224,133,201,148,163,221,196,120,217,194,41,172,194,149,109,20,43,72,231,192,208,160,86,98,241,244,82,81,126,57,177,168,229,74,18,123,147,53,144,75,231,244,78,8,66,8,17,3,249,179,237,180,177,18,235,128,188,236,215,103,210,13,
+255,254,136,167,192,0,85,179,134,44,146,213,168,158,31,32,42,59,221,85,140,204,220,211,45,246,106,184,191,127,113,50,193,78,240,10,237,24,223,162,14,208,81,142,45,24,91,207,102,210,246,214,192,240,172,168,104,158,208,112,244,232,126,158,77,159,123,228,
+135,109,254,108,150,230,205,249,156,236,139,250,36,164,163,194,130,197,232,87,147,106,142,74,171,49,147,41,202,126,3,173,3,239,93,200,202,81,155,63,36,251,227,1,137,250,141,213,62,206,44,21,228,148,205,29,213,157,2,247,193,204,82,65,198,194,94,9,120,
+214,95,79,8,108,255,125,98,81,142,57,252,122,221,57,24,148,145,176,79,233,123,144,125,154,201,149,228,156,129,202,30,233,44,103,114,37,173,171,4,91,111,12,80,78,85,114,251,230,114,37,121,123,46,43,207,158,79,139,75,230,48,58,158,208,178,200,101,81,253,
+207,42,54,83,111,50,203,142,16,226,2,182,249,61,50,164,16,181,115,114,49,47,71,12,206,172,32,214,2,231,154,195,11,57,201,228,203,218,240,229,169,116,81,251,58,60,159,147,127,153,89,146,79,232,36,182,4,48,166,236,223,164,126,118,143,122,122,229,47,139,
+206,222,203,188,147,204,107,226,223,144,175,87,2,158,30,205,249,137,218,71,34,95,146,131,51,105,121,114,106,73,82,52,124,92,4,207,252,29,67,33,67,223,251,73,166,100,251,251,9,26,198,45,3,65,37,119,62,204,146,191,57,147,180,253,125,132,115,205,206,128,
+71,250,3,141,5,127,20,86,158,62,147,148,119,117,26,75,93,17,210,247,243,241,69,45,248,253,198,77,193,186,130,49,14,141,127,152,90,178,189,163,22,160,162,134,10,50,242,139,244,130,223,255,183,14,200,167,194,0,67,85,7,104,21,182,33,175,6,207,194,209,202,
+244,83,100,63,35,207,19,209,36,78,120,70,244,50,28,82,19,137,171,196,152,119,109,25,208,78,249,140,197,38,208,147,206,131,46,160,70,239,247,122,96,106,56,33,132,184,1,116,87,126,191,207,175,43,251,20,110,226,39,29,30,41,230,54,208,53,69,215,176,181,97,
+252,97,115,160,109,216,221,200,215,77,32,166,247,24,152,73,154,40,56,195,228,132,24,18,228,125,235,21,139,255,159,169,37,199,56,210,171,207,201,131,67,161,85,58,70,174,92,150,63,206,101,149,117,28,215,76,115,193,65,178,26,41,81,157,22,10,113,208,137,
+237,167,248,61,35,158,30,185,94,71,69,105,46,91,212,132,116,39,112,36,153,87,18,200,171,96,65,101,27,114,99,52,209,216,69,2,49,33,164,53,35,190,94,25,172,180,169,157,206,22,77,143,240,120,98,124,81,30,222,213,122,16,12,218,173,216,162,72,8,113,19,56,
+56,183,90,31,33,18,63,97,129,243,192,174,128,71,123,183,244,251,122,101,42,87,178,196,251,133,16,66,236,2,98,20,140,24,231,14,57,100,168,37,246,248,136,35,121,104,123,180,233,48,122,184,107,241,110,116,226,153,96,197,0,218,254,223,211,149,99,191,221,
+48,21,19,55,200,209,165,130,124,97,52,82,119,250,37,54,132,24,218,231,164,107,129,7,29,177,8,170,139,163,209,161,135,196,217,160,178,58,226,206,37,146,144,134,236,143,250,229,150,161,144,12,4,87,191,87,176,246,190,118,33,35,31,164,205,105,89,198,250,
+255,147,143,231,181,129,48,200,250,91,235,166,64,231,12,156,196,20,137,9,33,110,163,118,125,28,91,19,199,135,243,0,90,187,205,238,44,188,58,236,147,59,183,132,215,189,91,112,152,199,62,253,165,217,12,5,99,226,72,112,22,55,98,116,114,138,3,148,116,150,
+231,166,82,242,157,203,251,149,92,197,136,95,117,210,254,24,191,11,140,144,232,138,254,155,193,160,108,9,121,197,83,185,32,136,225,57,188,144,165,73,80,7,61,87,252,232,85,190,117,93,0,2,239,171,45,241,78,22,202,145,243,164,210,110,128,13,40,54,207,132,
+172,5,47,151,3,59,98,202,215,229,63,127,52,199,107,73,28,201,215,70,35,45,7,174,96,136,160,21,218,92,241,46,64,59,167,219,34,115,8,33,196,110,220,22,15,200,157,163,145,166,63,245,124,182,196,1,180,196,177,124,111,119,188,174,177,171,25,143,29,95,96,241,
+155,212,5,186,207,125,219,162,186,46,14,140,20,63,173,196,77,18,82,11,195,52,93,2,170,38,181,241,27,78,165,218,110,80,210,177,145,132,139,2,45,7,132,212,3,226,146,202,4,81,169,184,42,9,113,34,136,108,210,51,149,27,135,253,171,21,135,64,110,4,120,23,224,
+125,71,145,152,16,66,172,11,162,38,90,137,196,0,78,227,175,142,234,19,62,8,177,27,152,149,164,2,162,35,41,18,147,70,64,247,121,242,244,162,102,136,107,6,156,196,20,137,73,35,232,40,38,142,5,45,118,123,98,254,117,238,98,136,200,199,23,243,28,216,65,90,
+2,87,226,163,123,250,117,93,40,220,87,40,82,184,113,227,134,235,116,207,112,88,70,107,4,66,180,246,28,154,77,83,168,115,0,145,222,30,249,187,203,251,117,13,67,2,169,66,89,254,241,196,130,219,47,27,33,132,144,22,60,188,173,79,198,250,244,23,23,159,56,
+149,144,83,57,182,220,219,29,12,91,186,178,63,176,42,6,197,237,231,51,156,91,247,246,183,46,200,227,58,253,248,24,187,97,137,62,224,46,190,161,63,40,131,149,88,159,92,169,44,231,210,69,45,147,152,197,6,210,12,10,197,196,241,84,91,144,165,50,240,142,139,
+34,81,1,47,216,207,143,70,154,198,153,184,89,36,110,181,177,117,210,192,76,183,162,167,45,120,45,60,204,19,66,8,105,197,255,254,169,65,165,107,244,246,39,25,121,254,130,51,134,46,185,17,156,201,190,62,214,215,52,102,193,205,123,106,8,232,215,109,10,53,
+204,151,229,158,154,16,210,45,60,155,62,247,200,15,121,181,137,147,73,149,151,229,84,182,168,125,165,152,109,70,20,57,151,47,201,255,119,33,43,59,3,30,233,243,245,74,111,205,238,13,45,61,112,63,252,31,167,23,93,121,111,61,122,89,76,118,198,252,77,63,
+3,183,200,167,99,126,121,115,158,67,35,237,202,190,168,95,182,70,212,226,36,102,179,37,57,67,161,152,16,66,72,3,16,83,116,181,142,72,163,90,122,165,71,254,178,200,253,132,93,249,143,187,227,18,241,53,207,226,197,62,251,134,254,128,124,156,200,187,110,
+111,125,20,78,207,11,25,209,122,25,151,123,180,78,174,52,134,181,167,139,242,210,244,146,252,193,228,161,147,132,16,247,192,145,254,132,16,162,131,95,77,166,120,153,106,64,102,237,72,68,223,43,4,206,17,184,36,204,158,170,78,186,71,220,203,17,8,132,16,
+66,8,89,1,251,192,144,206,189,1,186,248,30,24,141,202,99,103,220,233,158,93,217,47,115,207,76,8,49,15,158,228,8,33,132,40,115,227,166,160,210,183,92,59,168,246,121,98,111,198,153,77,77,8,33,164,9,167,179,234,239,137,217,28,223,45,118,229,74,29,249,187,
+181,232,53,35,16,66,8,233,60,20,138,9,33,132,40,163,215,21,82,5,238,144,189,33,110,250,237,200,135,169,188,242,79,109,68,0,32,132,16,226,30,150,202,203,50,159,85,139,40,154,72,243,221,98,87,84,247,141,82,153,19,66,136,149,64,100,78,164,201,220,26,66,
+156,2,79,237,132,88,144,17,95,175,92,19,245,203,246,176,79,252,189,61,146,47,47,203,217,116,65,142,164,242,50,93,224,48,62,98,79,182,7,189,114,148,78,83,219,129,161,116,211,75,69,221,238,158,247,231,178,154,0,64,8,33,132,52,227,149,243,105,121,104,172,
+79,215,53,194,123,232,109,3,133,75,98,95,98,140,177,34,22,224,254,77,33,109,112,119,212,119,233,126,196,156,154,241,84,94,14,206,102,120,54,39,142,132,66,49,33,22,3,47,163,253,155,67,235,126,168,177,62,159,220,58,28,214,68,152,151,102,51,20,98,8,33,93,
+227,185,233,148,60,188,51,174,13,86,105,6,220,97,47,49,139,154,16,66,136,14,62,72,23,100,239,92,182,101,60,21,68,25,188,135,136,187,88,44,82,128,35,230,177,43,224,145,47,142,70,101,32,184,126,0,35,246,195,87,198,3,178,51,234,151,151,167,150,88,196,34,
+142,131,101,58,66,44,196,215,70,35,117,69,226,90,176,153,254,246,88,140,127,54,98,59,142,36,185,137,178,43,112,75,60,57,177,216,180,77,24,110,175,95,78,44,178,136,69,8,33,68,55,207,156,79,203,235,51,105,77,12,174,7,222,45,63,59,177,64,215,158,205,41,
+25,216,27,188,197,125,35,49,9,196,75,124,121,123,95,93,145,184,22,8,198,247,111,143,106,162,50,33,78,130,142,98,66,44,194,93,3,65,173,50,169,7,188,180,190,178,37,172,109,174,9,49,131,100,190,36,125,126,253,155,34,28,0,167,233,12,177,53,136,160,248,217,
+120,66,246,71,253,178,167,207,39,49,239,202,223,31,195,133,142,166,10,154,51,140,16,178,26,76,250,191,44,234,147,168,207,35,185,82,89,230,114,37,121,105,38,205,245,144,144,26,254,109,62,43,111,38,114,242,169,176,79,134,43,130,75,174,188,44,39,211,5,237,
+221,67,236,207,241,197,188,214,190,175,23,236,51,9,49,139,47,13,135,87,69,77,180,2,162,242,63,158,88,224,223,139,56,6,10,197,132,88,0,84,45,63,51,212,220,73,188,22,56,139,223,152,207,210,97,65,76,225,15,83,75,114,96,135,126,103,251,159,25,71,224,24,208,
+94,199,22,59,98,21,224,226,57,95,40,91,206,201,142,33,76,247,110,141,74,79,77,90,139,223,227,209,10,108,143,246,249,229,116,50,47,191,154,100,43,61,33,85,240,12,107,239,22,11,63,22,48,117,72,165,67,138,197,30,53,158,156,94,146,31,196,252,218,112,99,61,
+252,122,34,105,155,223,141,56,11,156,203,245,154,183,170,64,84,134,145,130,251,99,226,20,76,21,138,111,139,7,100,123,216,123,209,149,36,21,103,210,225,68,142,213,99,226,42,224,160,104,149,253,89,15,12,188,155,158,207,242,102,33,93,7,67,233,222,153,205,
+200,245,58,10,28,71,23,114,154,91,136,232,99,196,219,43,15,109,143,202,64,192,123,81,100,90,94,22,153,207,21,229,233,179,41,30,78,137,235,193,97,236,150,161,208,170,150,208,84,161,172,173,53,7,231,205,31,166,8,49,9,51,5,154,177,163,207,47,143,94,22,147,
+199,206,44,154,250,179,74,101,63,126,227,64,176,238,245,124,254,2,139,124,196,221,236,13,121,229,11,163,145,85,93,84,120,190,17,165,128,185,33,191,101,33,92,55,191,56,153,144,71,118,199,91,138,197,47,76,114,175,67,204,3,231,114,35,140,133,189,20,138,
+137,99,232,185,226,71,175,118,125,55,125,117,216,39,247,142,70,154,218,249,39,146,5,121,106,42,229,184,172,67,56,95,66,158,149,223,59,83,42,83,16,39,26,141,6,216,181,226,88,34,39,191,153,90,114,252,69,188,186,230,133,205,246,118,107,81,207,53,87,5,226,
+230,187,23,50,60,68,41,128,54,245,86,226,59,14,80,204,237,35,110,5,89,254,205,156,62,16,56,159,61,155,52,109,127,133,66,207,119,46,239,175,187,38,214,3,217,172,102,21,210,224,154,66,123,109,179,235,137,92,114,102,143,19,183,130,61,206,125,219,162,77,
+127,123,68,36,252,244,100,130,247,136,78,176,70,62,48,26,149,145,200,122,191,26,174,37,156,196,20,137,173,3,10,137,113,111,175,108,11,251,100,50,93,144,68,177,44,135,147,121,71,191,19,140,158,203,145,167,110,133,226,47,49,23,232,22,123,163,62,25,10,172,
+172,113,249,242,178,156,77,23,228,72,42,111,171,78,240,174,11,197,88,108,238,28,141,232,250,172,83,54,167,216,136,223,49,16,148,125,131,193,117,174,81,58,54,136,240,133,84,151,234,1,22,211,100,215,62,55,16,200,15,206,102,24,187,97,33,112,152,186,161,
+255,210,212,242,153,76,129,2,177,34,122,14,164,85,40,22,19,55,162,247,93,137,189,213,63,157,74,152,178,127,60,48,18,81,202,225,204,20,203,242,15,199,205,201,53,108,37,186,87,225,225,151,184,17,56,137,245,70,108,241,25,49,6,246,61,49,239,138,129,138,157,
+103,214,2,157,59,119,143,70,234,118,188,98,238,8,34,229,156,250,55,227,185,156,24,1,134,208,187,183,68,234,22,193,170,160,11,197,46,51,166,186,26,61,129,139,167,87,36,150,202,192,174,111,143,197,180,225,57,118,5,191,243,23,71,163,13,39,102,106,121,54,
+155,67,178,187,207,79,199,6,81,6,81,45,78,4,207,205,129,177,88,195,56,14,28,108,33,32,191,122,62,45,175,37,114,188,113,44,0,68,75,10,151,237,113,231,136,254,247,35,62,203,235,77,220,196,72,101,191,164,7,236,173,80,160,55,163,8,63,22,85,107,89,13,121,
+245,15,203,233,36,120,207,234,205,96,196,161,7,70,15,190,111,137,155,248,130,194,153,21,207,8,156,178,116,194,170,193,125,140,53,105,101,236,195,249,12,241,43,67,65,143,35,59,91,103,12,118,36,77,178,235,117,29,216,187,33,42,51,80,137,155,25,207,20,29,
+217,29,220,74,187,168,130,25,83,112,231,219,65,223,236,170,80,12,133,93,21,8,172,118,221,156,194,17,169,231,134,145,26,81,220,105,98,49,254,118,87,199,2,171,42,43,168,182,125,176,152,227,129,163,6,44,154,251,13,124,223,121,7,70,151,232,125,110,240,223,
+63,187,37,44,231,178,69,70,184,16,219,3,87,141,74,78,57,62,11,183,19,178,162,9,233,36,200,215,253,84,220,47,81,223,74,129,59,85,40,201,71,137,188,233,206,33,28,52,84,128,171,215,12,161,216,163,55,115,194,100,110,80,28,212,179,39,234,55,125,223,134,53,
+239,246,161,176,12,86,204,23,165,229,101,153,72,21,228,16,58,140,40,208,145,14,83,155,73,172,135,219,135,66,218,192,54,66,236,12,218,230,245,26,251,80,108,220,159,44,56,46,151,247,163,116,65,238,46,45,43,207,15,26,231,158,252,34,141,220,181,208,59,30,
+40,45,203,123,115,89,199,116,212,171,104,126,82,209,253,190,178,37,108,121,103,113,215,108,12,168,38,52,179,97,55,227,198,129,160,161,239,51,27,180,205,171,44,48,184,105,190,212,98,248,137,93,192,226,240,191,94,222,175,189,104,214,254,221,241,255,199,
+191,255,187,157,113,237,115,100,37,119,55,165,24,163,128,182,159,195,14,172,196,223,51,20,210,253,220,224,115,70,10,80,132,88,141,93,17,245,193,25,215,43,10,61,132,52,3,110,184,239,95,49,160,185,132,6,131,94,109,125,197,23,254,25,255,238,63,237,233,215,
+62,99,22,67,13,58,179,26,209,108,14,6,145,139,217,121,122,25,9,155,58,255,90,27,252,135,24,0,236,33,171,247,38,220,216,40,8,32,19,26,197,54,66,58,133,145,251,41,238,227,153,134,216,159,155,20,117,151,219,29,162,93,212,2,211,222,49,197,194,168,102,132,
+163,163,88,3,70,193,111,238,138,55,212,254,240,254,70,135,24,180,160,72,139,193,150,118,0,29,108,170,69,5,56,139,71,44,190,79,237,218,79,167,234,4,169,5,2,170,221,110,34,252,225,245,182,244,213,130,239,177,250,77,211,138,170,245,190,213,33,13,127,87,
+124,206,238,191,111,167,120,81,177,117,7,217,80,78,140,42,81,125,110,180,118,63,222,67,196,230,24,57,96,242,80,74,58,5,4,96,76,162,111,182,209,13,85,62,99,150,88,28,243,218,227,126,135,3,91,133,101,155,188,198,85,15,65,157,228,187,59,99,77,205,38,48,
+113,35,223,157,98,49,233,20,49,19,139,98,132,152,201,88,159,154,113,1,231,125,39,26,191,94,154,205,104,243,178,244,0,243,214,203,231,217,77,32,138,81,179,208,130,190,58,170,111,54,139,149,193,28,50,35,220,98,113,51,108,215,222,130,129,54,133,222,29,65,
+115,157,12,170,180,35,140,95,30,86,119,150,89,9,100,50,171,56,66,31,24,177,255,2,209,9,80,133,124,69,167,88,140,42,167,19,7,8,224,229,98,228,48,106,247,103,134,16,12,255,83,197,200,247,16,82,143,135,182,71,197,163,99,159,134,207,60,96,210,166,222,46,
+217,127,136,233,80,97,38,109,78,171,106,94,177,208,172,247,192,220,105,16,133,50,168,243,12,112,239,86,238,39,73,103,56,194,236,92,226,66,174,54,120,158,218,106,51,157,70,15,48,99,33,18,20,78,225,102,160,35,248,201,137,69,198,32,86,248,162,226,30,17,
+133,9,163,247,157,21,48,170,93,136,129,206,174,110,195,114,233,6,17,107,195,225,24,183,113,21,27,173,6,141,6,247,53,2,46,17,59,47,16,157,4,249,127,79,79,36,27,198,80,224,223,63,127,54,229,200,193,1,32,228,49,118,239,219,249,153,33,4,28,93,82,23,193,140,
+124,15,33,245,208,43,196,73,229,157,109,6,170,195,101,38,146,230,60,31,40,226,102,116,230,229,194,77,252,220,84,106,195,127,166,122,28,87,204,148,52,75,168,223,55,160,191,203,8,206,226,7,135,212,39,213,19,178,22,100,94,151,20,139,41,135,23,156,103,224,
+32,68,15,78,61,135,65,44,126,236,204,162,102,228,90,187,167,64,241,244,245,153,180,252,211,169,4,69,226,10,16,77,85,117,32,49,16,119,98,37,140,106,23,162,237,189,173,237,196,239,218,110,63,215,102,139,252,233,172,189,194,193,173,94,33,216,40,246,24,116,
+82,239,139,251,153,235,83,1,215,225,131,19,11,218,98,187,59,236,115,252,148,208,78,144,224,16,27,98,115,48,148,46,153,47,233,30,158,131,207,114,144,29,233,4,119,25,216,160,227,123,186,221,213,130,97,57,183,100,75,186,15,33,111,153,216,117,243,196,248,
+162,60,188,171,121,148,7,120,241,92,202,180,33,108,152,113,112,243,80,72,87,150,51,218,106,223,48,233,122,170,14,20,27,14,193,120,224,140,1,57,196,92,222,159,203,202,245,58,11,15,120,70,222,162,11,153,216,156,57,197,232,164,42,78,31,226,6,35,23,135,240,
+183,230,42,131,58,144,106,220,137,83,80,237,236,234,54,93,83,51,79,166,11,114,171,193,239,133,139,210,110,89,172,112,94,152,229,186,49,19,191,193,136,17,187,100,15,118,19,84,39,221,86,161,132,16,254,144,129,239,59,103,179,66,82,59,32,175,253,134,62,191,
+108,15,123,181,231,102,177,88,146,217,108,73,222,76,228,28,153,89,237,38,126,61,145,148,71,247,244,235,250,141,241,89,66,220,198,239,167,82,186,38,75,67,224,49,179,176,10,241,247,39,31,207,107,3,216,134,195,94,205,233,90,11,10,61,120,134,205,18,137,165,
+226,148,122,246,108,82,215,245,124,245,124,90,166,21,7,238,18,98,119,126,59,155,145,221,49,127,203,98,5,156,199,143,159,74,240,239,109,115,208,221,10,227,210,206,168,95,91,19,33,254,79,167,139,90,247,133,91,68,66,172,243,208,93,84,135,193,218,205,208,
+71,72,167,48,90,92,1,169,188,181,247,85,93,83,50,33,120,33,227,197,136,120,122,116,193,126,139,115,59,14,71,213,246,74,66,156,4,242,151,85,6,218,97,67,227,22,65,125,127,212,47,119,143,70,86,29,234,71,196,43,87,198,69,62,51,20,146,247,230,178,242,252,
+5,58,169,236,10,68,163,39,79,47,202,67,151,245,53,204,139,197,129,244,233,51,230,10,76,196,56,24,188,137,76,117,180,105,162,211,10,69,116,182,44,234,7,215,10,89,128,200,192,171,231,44,198,193,30,131,94,173,146,225,143,150,85,176,55,228,149,237,65,175,
+44,22,203,150,114,29,86,175,231,151,183,247,213,21,6,180,1,61,83,75,154,155,155,232,7,207,57,102,149,176,35,204,254,252,244,100,66,190,181,45,42,59,26,12,74,196,51,2,145,152,239,100,123,243,149,45,97,185,118,205,64,42,236,181,225,116,212,50,84,99,1,249,
+231,201,164,43,12,25,127,154,205,232,30,70,38,149,115,27,141,42,196,173,24,45,174,128,147,22,223,91,117,213,242,250,218,133,140,60,20,233,83,250,30,228,191,28,180,225,208,46,180,244,125,118,75,88,57,220,26,55,26,55,228,196,205,28,156,205,92,172,230,235,
+225,69,135,230,53,175,5,249,223,205,54,110,184,94,251,55,135,164,207,223,235,216,12,107,55,128,56,137,31,31,155,151,3,35,17,217,26,246,74,160,146,125,149,43,149,229,92,186,40,79,78,243,111,107,71,208,9,240,165,225,240,186,34,216,173,149,125,14,156,178,
+102,9,198,24,218,116,235,112,88,249,123,204,2,215,233,103,227,9,173,112,54,28,240,200,102,8,176,133,146,44,22,202,150,237,172,192,115,109,213,168,24,92,207,127,60,177,112,241,122,86,129,225,193,10,46,58,228,61,135,20,242,47,205,28,242,137,231,28,19,220,
+215,182,209,238,199,160,189,66,89,219,175,80,48,182,31,191,154,76,201,136,183,87,110,31,10,73,220,119,233,25,65,38,49,227,38,236,79,61,145,120,45,48,186,125,123,44,166,189,123,156,14,214,125,8,227,122,204,125,216,191,252,110,38,237,246,91,136,84,48,26,
+53,219,104,54,147,93,80,45,174,72,165,200,248,166,197,59,21,186,42,20,99,115,52,48,181,164,251,66,226,2,226,240,100,199,42,21,126,102,184,90,84,15,95,135,108,190,216,206,230,140,185,198,237,50,205,156,108,60,211,149,233,177,122,218,97,95,113,201,161,
+11,238,36,20,158,244,0,33,234,234,68,158,135,81,155,67,65,216,57,64,60,194,1,179,81,182,46,254,253,55,119,197,181,65,165,102,20,138,225,132,83,205,199,182,130,123,78,187,86,230,204,129,115,36,86,189,158,127,189,144,213,189,151,198,112,64,196,5,152,65,
+171,231,28,110,163,135,198,250,180,115,16,179,46,237,135,214,241,195,247,178,227,64,220,68,43,145,184,10,158,109,152,54,220,240,252,194,61,93,175,232,85,11,68,226,95,78,44,210,77,76,46,114,36,165,110,60,0,231,108,126,102,85,41,174,84,65,183,150,213,159,
+157,174,143,168,196,133,196,97,8,34,112,51,16,83,241,248,184,189,167,72,162,245,241,152,194,203,4,159,181,187,155,248,176,193,151,231,95,22,185,105,38,151,168,182,195,98,29,168,7,54,39,79,79,36,93,115,216,186,101,32,168,212,157,112,219,38,78,125,39,196,
+42,124,99,91,159,174,1,108,136,149,137,24,204,249,111,23,149,204,107,230,99,147,110,130,189,52,138,19,122,120,227,188,121,102,11,189,207,57,138,190,102,61,231,132,144,213,32,147,88,133,155,117,14,55,180,59,16,176,30,159,76,106,154,205,68,178,176,74,183,
+193,217,12,70,29,184,171,41,18,147,90,96,246,82,209,190,170,28,52,169,192,219,73,80,92,105,164,91,172,229,21,155,68,122,121,54,125,238,145,31,118,251,255,232,84,190,36,135,23,114,178,92,92,22,95,79,143,38,128,32,143,17,226,207,153,165,130,252,113,54,
+43,191,155,77,75,202,1,139,207,145,84,65,162,203,34,91,35,205,167,57,190,253,73,70,158,53,113,131,219,41,22,74,203,178,169,183,71,182,132,244,87,84,48,116,230,207,108,221,34,107,192,189,132,2,2,94,56,51,233,162,44,230,74,242,209,98,94,94,155,205,200,
+75,23,50,242,137,139,6,235,220,189,57,172,212,122,27,245,247,202,219,115,89,41,112,255,70,136,169,236,10,120,228,86,157,221,0,216,7,249,203,34,31,155,16,81,128,253,86,38,87,146,203,251,252,235,6,175,85,65,62,246,75,231,150,228,24,135,214,144,46,243,230,
+124,78,246,69,125,77,223,131,239,204,102,228,133,57,115,162,234,236,242,156,19,66,86,115,207,112,68,201,136,129,207,186,105,127,13,205,230,157,100,94,94,155,203,202,161,217,140,246,133,179,217,25,206,86,32,13,24,79,23,101,95,44,160,251,185,122,125,38,
+45,239,45,217,191,11,22,107,2,158,13,232,126,49,191,167,238,239,15,33,249,217,201,164,188,107,147,223,183,171,209,19,181,160,2,5,151,128,85,6,142,108,36,24,46,133,27,7,174,192,161,128,247,162,45,29,55,11,162,26,222,152,207,58,106,154,244,75,179,25,217,
+22,246,233,114,86,224,26,60,227,0,129,156,108,28,120,54,166,11,238,110,49,214,243,44,173,101,71,208,203,248,9,157,160,245,112,160,50,132,96,190,80,230,117,35,29,227,170,168,154,91,9,239,78,49,105,32,37,178,54,223,58,58,167,229,99,239,234,243,139,175,
+183,71,19,141,225,36,58,149,204,179,237,154,152,202,207,199,23,229,174,129,160,236,27,8,92,204,110,7,83,233,130,188,52,147,54,53,14,101,119,184,185,25,100,45,102,62,231,196,89,192,157,126,67,159,95,27,144,90,229,195,84,158,67,82,117,98,100,0,21,247,215,
+132,52,6,26,223,179,103,147,13,135,14,215,2,145,216,105,90,32,116,63,124,85,207,150,88,155,103,114,37,153,204,21,109,167,247,153,38,20,187,13,220,24,110,17,68,177,64,160,29,165,213,112,0,184,168,159,231,70,153,16,98,18,24,222,116,251,112,120,221,65,225,
+129,210,74,198,188,27,10,153,196,90,12,26,40,10,117,26,77,16,166,40,76,44,136,85,13,38,1,197,40,9,43,60,231,196,254,220,191,41,36,251,6,215,71,147,97,176,49,140,56,104,133,102,52,64,115,80,8,85,29,60,127,154,93,53,132,52,165,58,116,24,197,221,235,6,131,
+235,206,89,232,22,254,211,92,214,209,5,45,39,20,147,40,20,147,13,3,194,56,220,210,215,68,253,50,20,244,72,204,235,145,197,98,73,102,179,37,203,78,38,39,196,138,32,150,71,213,85,76,183,67,115,190,54,26,209,6,255,213,3,135,6,12,99,192,186,245,155,41,10,
+102,164,123,44,185,40,82,135,16,183,194,231,156,180,75,179,61,12,64,247,42,134,43,114,216,88,115,166,211,197,166,3,219,214,146,42,148,121,61,9,209,73,109,113,23,14,219,76,169,204,110,7,27,65,161,152,108,40,90,108,0,93,121,132,180,197,135,137,156,220,
+26,212,63,69,22,131,39,72,99,224,36,110,118,192,170,130,207,220,149,45,209,89,76,12,147,80,108,135,79,82,64,34,196,118,204,40,30,124,63,201,209,145,72,140,163,119,15,3,131,193,87,71,163,218,80,50,82,159,247,19,57,37,161,248,232,2,135,175,19,98,4,26,152,
+236,135,122,48,15,33,132,144,174,2,7,126,74,65,64,58,52,203,220,239,102,32,110,66,47,159,113,201,132,107,178,49,28,78,230,87,77,11,111,197,91,44,74,16,98,59,48,189,92,229,29,253,94,130,3,156,137,113,62,61,208,56,214,111,45,16,65,71,12,228,240,186,5,60,
+187,122,205,21,232,238,59,200,119,52,33,196,37,240,205,65,8,33,22,167,58,24,64,143,224,244,202,212,18,219,122,154,128,3,147,202,240,18,196,80,92,173,56,168,136,152,7,242,208,48,140,237,193,161,144,220,212,167,54,72,110,35,192,179,251,170,206,249,4,56,
+172,210,113,65,136,61,57,52,163,239,57,71,54,163,21,158,115,172,143,223,218,22,149,71,47,139,105,107,230,222,16,155,76,237,66,117,40,186,94,174,81,28,170,234,54,158,154,74,105,153,206,205,128,72,252,251,169,20,99,39,8,33,174,129,187,2,66,26,128,77,244,
+85,49,191,4,122,47,137,74,135,23,178,218,100,120,66,186,13,196,223,199,199,19,242,192,72,180,238,33,1,110,166,23,167,150,40,52,181,96,208,167,62,68,104,128,110,28,203,3,193,99,44,234,151,158,154,153,52,215,139,200,189,203,34,239,94,200,200,111,103,205,
+27,156,250,90,98,165,85,245,206,209,72,195,207,224,144,138,195,42,33,196,158,192,153,24,156,90,146,207,110,9,55,28,142,5,145,216,236,220,123,236,109,239,28,137,172,250,25,71,196,43,123,251,3,146,41,150,229,137,241,69,153,86,140,204,33,221,99,87,64,125,
+15,163,58,108,209,109,64,252,125,236,204,162,220,22,15,200,141,3,193,85,51,65,176,183,70,220,4,156,196,20,137,137,25,140,120,123,229,161,237,81,25,8,120,87,237,113,177,94,255,245,130,53,7,188,18,103,208,115,197,143,94,229,170,71,72,13,88,144,31,222,21,
+111,184,209,135,171,19,238,206,163,25,102,204,17,115,128,43,22,14,145,234,230,255,195,84,158,46,98,157,192,29,252,208,88,159,210,247,192,165,93,21,251,136,245,248,222,238,184,244,249,155,31,158,113,208,123,114,218,92,129,6,7,252,155,7,131,178,51,234,
+191,248,126,129,64,252,193,98,142,247,23,33,14,1,239,231,91,6,130,50,20,240,106,69,93,8,77,115,217,146,22,43,99,118,33,23,34,241,125,219,162,77,63,83,42,47,203,47,78,38,40,22,91,148,72,111,143,252,111,87,14,40,253,112,111,127,146,145,231,47,152,87,44,
+181,35,216,43,158,206,22,41,14,19,83,65,119,220,245,45,34,240,146,249,146,252,244,100,130,127,40,210,113,232,40,38,164,6,61,155,104,28,240,15,236,136,201,11,147,41,186,139,137,41,112,72,164,113,230,10,234,130,250,185,44,139,66,86,5,155,232,86,34,49,128,
+91,238,166,165,130,169,107,54,138,57,167,52,55,161,185,130,53,33,100,227,192,251,249,25,157,113,51,221,230,222,173,205,247,183,192,211,219,163,153,37,126,242,241,60,239,18,11,2,225,18,197,7,149,8,173,113,26,91,148,97,119,30,49,27,61,34,49,192,30,24,134,
+9,138,197,164,211,176,159,150,144,26,62,223,164,53,120,45,216,112,195,125,76,8,177,15,56,196,35,107,78,47,56,144,209,173,109,93,174,219,164,127,216,224,29,10,67,12,9,33,196,73,32,135,184,71,103,2,1,12,17,86,200,120,39,245,65,135,140,94,176,135,161,232,
+73,136,189,128,190,160,71,36,174,2,177,248,65,14,223,38,29,134,42,23,33,21,176,137,246,40,228,120,97,195,125,15,133,7,66,108,199,43,10,110,47,189,3,138,72,247,193,240,37,189,194,7,8,177,176,71,8,113,41,91,195,106,77,164,55,244,7,121,171,88,20,228,229,
+66,0,214,3,247,48,196,41,64,60,197,192,98,124,57,125,248,230,237,6,68,223,107,7,185,102,147,206,194,232,9,66,42,236,50,224,158,216,30,241,57,246,242,65,56,31,139,250,196,83,163,196,76,165,11,242,210,76,154,217,117,196,214,192,93,51,48,181,212,116,184,
+24,120,127,46,171,13,40,34,214,100,123,144,91,24,66,8,209,67,192,195,66,153,83,64,252,4,102,165,124,113,52,186,106,240,218,90,48,95,129,123,24,98,119,32,12,127,102,40,180,110,118,208,242,242,202,128,80,179,231,79,108,4,56,127,171,2,179,27,196,116,158,
+209,73,167,224,41,139,144,10,141,134,215,53,67,197,129,108,23,208,110,136,8,142,122,191,219,142,62,191,60,218,231,151,119,102,51,242,219,89,14,198,32,246,5,195,195,230,11,101,185,109,83,72,27,56,84,11,156,58,112,225,240,128,69,8,33,196,9,148,160,170,
+136,243,246,172,110,5,145,88,191,156,88,148,59,6,130,178,187,207,127,81,48,198,192,237,241,84,94,14,206,102,180,168,45,162,87,245,207,0,0,32,0,73,68,65,84,66,236,12,76,75,152,49,81,15,248,152,240,223,190,23,246,58,46,159,215,163,210,46,87,195,53,125,
+126,206,176,33,29,131,66,49,33,228,34,122,134,249,129,106,110,18,197,98,98,103,224,44,198,23,166,212,15,250,86,14,89,24,118,199,195,149,61,248,183,249,172,220,170,16,255,179,204,225,229,132,16,151,114,62,83,212,138,253,122,153,201,48,215,214,234,192,
+89,252,252,133,140,200,5,238,197,137,243,104,38,18,215,130,124,222,239,238,140,201,207,199,23,121,23,16,210,65,216,135,68,8,185,200,157,35,250,135,249,65,44,230,48,63,226,4,166,43,195,94,240,69,145,216,94,36,243,250,7,13,206,164,57,249,157,16,226,78,
+254,56,167,223,101,134,162,26,141,0,132,16,179,192,249,82,143,72,92,101,48,232,117,212,0,206,146,65,103,195,145,36,59,33,73,231,160,202,67,72,133,140,129,76,159,82,217,57,22,53,100,64,169,198,111,112,152,31,33,196,76,254,48,165,47,155,14,107,245,115,
+83,41,254,173,8,33,174,228,104,166,40,71,23,114,186,126,245,119,233,80,37,132,152,136,145,97,110,183,109,86,255,30,171,50,145,82,239,232,192,62,151,249,196,164,147,212,141,158,120,112,40,36,195,161,75,33,218,137,66,73,14,33,235,136,55,31,113,48,88,148,
+85,170,151,224,248,162,115,42,119,187,163,234,149,216,209,176,115,135,249,17,66,172,15,196,143,23,38,83,114,239,214,168,52,138,116,195,230,249,23,39,19,220,195,16,66,92,13,134,62,125,203,211,211,52,130,2,98,50,221,196,132,16,51,137,251,26,15,105,108,
+132,147,6,118,98,173,254,251,120,160,225,190,182,30,239,43,116,141,16,231,1,71,253,85,49,191,4,122,87,158,131,147,169,188,22,209,215,14,171,132,226,111,109,139,214,221,60,140,136,87,19,208,230,178,69,121,250,108,202,17,135,45,228,222,236,234,243,175,
+114,80,194,229,63,159,43,202,203,51,105,237,240,73,220,5,22,229,239,175,185,39,154,1,241,193,73,147,86,7,155,76,78,38,43,142,107,136,233,185,114,89,38,211,197,182,23,95,66,72,103,120,43,153,151,51,39,22,180,14,7,20,175,170,107,56,134,250,156,74,230,29,
+57,17,155,16,66,140,240,171,201,148,236,13,121,229,238,225,176,68,107,196,152,169,116,65,94,154,73,179,160,70,136,69,192,115,122,251,80,248,226,249,44,87,42,203,185,116,209,21,123,154,120,128,77,239,47,158,75,233,154,27,36,149,24,54,22,248,86,131,248,
+146,107,106,116,205,197,98,89,59,47,56,13,24,124,175,219,20,90,87,84,192,160,118,204,113,57,157,204,107,239,125,35,244,92,241,163,87,181,222,249,239,237,142,107,97,224,173,176,187,51,7,139,238,67,151,245,137,167,183,185,24,136,138,186,147,22,98,136,92,
+251,6,2,171,170,109,169,66,73,62,74,180,95,109,112,18,88,84,30,217,29,111,121,127,56,209,161,246,253,43,6,148,163,39,32,196,252,228,227,249,13,251,153,172,192,163,151,197,180,197,182,30,237,44,190,132,216,141,72,111,143,220,208,231,151,120,37,155,60,
+81,44,203,225,100,94,27,168,67,8,33,132,116,138,219,226,129,139,239,26,48,147,43,201,219,41,230,111,18,119,128,225,108,200,221,173,7,140,109,16,17,157,40,122,85,105,118,246,106,132,19,207,164,208,111,90,13,109,134,145,147,131,252,46,1,45,231,235,99,125,
+117,117,77,60,59,199,18,206,209,248,244,234,183,40,36,252,244,100,66,249,127,95,19,138,155,45,70,245,128,72,246,227,99,246,123,16,33,18,31,216,17,211,253,121,39,136,197,120,88,30,222,21,111,42,0,34,155,247,137,241,69,186,8,42,224,154,61,180,61,218,240,
+153,192,195,246,235,137,164,227,174,151,145,151,50,238,157,127,56,190,176,97,63,147,217,232,89,128,141,46,190,110,5,173,49,187,34,62,9,122,122,52,103,54,6,47,112,237,177,62,247,111,10,201,190,193,245,57,230,216,152,255,121,54,195,130,35,33,132,144,182,
+185,58,236,147,123,71,35,18,245,173,119,20,206,103,75,242,251,169,148,156,202,233,31,98,74,186,15,206,219,127,51,24,148,193,192,202,254,121,169,176,44,135,23,178,142,22,54,59,137,94,241,7,177,91,78,189,166,232,252,86,141,131,116,234,121,12,186,196,3,
+163,81,217,28,242,92,52,178,65,240,132,225,239,189,249,28,247,223,53,224,140,169,199,133,237,132,123,165,81,18,68,35,140,252,206,61,255,241,191,254,121,185,85,165,162,30,211,75,69,121,236,140,189,170,23,70,28,147,118,94,132,245,186,99,133,25,142,117,
+193,245,187,185,63,112,49,175,123,38,83,144,63,45,228,28,123,141,244,46,174,181,56,205,121,95,139,138,112,78,103,113,107,80,21,191,101,75,184,110,222,150,29,223,39,110,226,107,163,17,185,50,222,124,195,142,108,180,103,206,167,221,126,169,8,33,132,24,
+4,34,241,67,99,125,77,191,25,197,201,199,199,19,50,93,224,121,197,138,52,51,159,209,152,212,26,21,129,20,98,225,127,59,177,224,200,235,137,51,248,163,123,250,149,190,231,245,153,52,69,83,23,163,106,8,181,179,19,91,245,119,173,162,250,140,244,34,142,192,
+8,195,97,53,231,161,217,64,164,80,21,137,197,230,19,52,225,36,214,35,18,3,124,238,235,45,54,103,110,3,47,94,228,253,64,192,194,215,111,29,62,208,17,5,145,140,194,239,135,13,138,83,69,98,108,80,84,220,213,168,232,141,120,153,167,213,8,108,124,81,144,108,
+52,148,1,215,250,7,87,14,88,224,39,37,107,217,31,245,183,20,137,193,181,131,65,237,144,79,8,33,132,168,130,104,35,56,137,91,129,179,220,3,35,106,166,6,210,29,224,132,109,214,161,28,170,24,152,72,99,244,236,183,170,96,79,125,251,144,125,117,138,102,224,
+188,13,51,146,94,32,250,81,36,118,55,95,208,241,254,168,5,107,21,244,65,59,130,142,13,35,168,234,190,189,122,90,27,234,129,197,233,38,5,187,179,217,124,42,110,236,103,53,122,125,204,198,136,48,142,223,21,21,10,226,94,80,233,47,233,204,27,69,62,150,83,
+49,178,241,186,89,177,69,202,45,96,77,209,227,142,64,177,10,78,148,255,159,189,187,143,141,171,188,247,69,255,243,188,207,120,94,108,199,137,109,18,156,23,2,105,129,0,37,13,45,100,223,160,2,27,40,45,220,246,82,165,189,21,119,163,162,195,190,127,236,222,
+171,30,233,72,71,218,218,91,106,181,175,42,109,105,75,27,233,182,255,108,142,218,67,111,213,187,201,1,181,167,244,208,150,82,36,114,161,148,210,20,104,128,54,148,188,57,118,108,39,142,237,241,140,231,125,236,171,239,178,39,25,123,102,214,122,214,120,
+60,179,214,51,223,143,100,181,196,3,241,140,103,214,122,158,223,243,123,33,103,185,211,198,103,225,160,75,23,92,68,68,212,89,232,127,95,175,221,68,61,56,92,222,29,228,0,102,39,65,66,128,202,158,25,107,61,84,236,81,45,172,151,27,37,84,52,50,26,213,247,
+128,30,201,72,231,20,170,186,81,82,207,30,189,221,13,159,157,102,98,118,205,38,204,118,218,72,147,137,57,118,95,163,13,165,192,197,93,148,65,87,61,217,215,46,55,158,54,52,27,24,199,116,85,234,94,56,193,69,11,18,148,246,53,130,64,178,206,125,177,32,209,
+196,245,162,210,162,132,214,178,115,194,139,211,93,102,102,59,75,127,72,253,179,48,26,227,103,128,136,136,236,219,102,51,240,187,135,21,44,142,98,39,19,214,238,60,148,110,177,195,198,188,168,10,175,221,200,178,203,160,173,31,202,229,235,237,75,81,217,
+138,172,99,206,137,161,125,189,237,9,156,58,69,51,93,18,154,193,43,181,166,154,13,140,15,216,8,10,144,158,16,44,198,212,88,84,12,220,214,23,186,242,158,64,211,252,243,233,162,209,130,131,72,149,221,155,48,178,185,117,109,105,66,68,68,68,181,6,131,246,
+182,164,65,197,214,122,180,249,154,201,132,69,18,22,91,5,144,10,188,79,240,133,68,146,155,86,171,217,199,115,37,57,153,45,241,245,35,3,147,181,54,7,3,197,10,22,216,116,159,186,16,50,134,187,117,66,113,126,201,254,103,30,195,14,105,227,154,201,230,38,
+34,34,34,247,154,201,151,108,101,154,38,185,55,115,140,102,50,97,169,22,130,161,152,231,97,7,146,120,186,5,18,153,166,120,184,64,100,100,216,183,35,171,216,99,103,120,213,122,110,58,9,220,200,133,180,155,130,101,229,101,181,254,180,68,58,123,115,214,
+254,181,237,119,54,134,46,16,185,197,92,78,253,222,57,181,200,236,14,34,34,178,111,44,99,239,254,113,42,195,195,121,167,96,66,85,235,160,223,174,29,191,187,204,192,41,81,179,201,90,110,13,123,77,54,121,255,179,123,125,241,140,165,219,243,23,117,90,179,
+23,82,183,61,207,138,102,3,227,23,89,198,65,100,148,51,217,249,236,99,218,238,20,23,202,117,217,189,9,51,51,219,89,222,182,113,32,252,7,102,122,16,213,133,146,89,148,90,115,96,48,81,125,199,211,5,73,23,213,214,81,99,169,162,76,41,62,150,54,95,51,9,85,
+239,119,105,197,162,149,159,79,170,183,94,195,222,163,91,43,63,137,170,53,155,172,229,214,140,252,102,18,218,224,196,156,189,215,201,131,94,144,102,131,171,26,177,115,33,115,2,92,72,155,201,158,118,219,243,172,120,121,58,211,212,191,215,236,27,143,72,
+55,255,62,150,50,6,247,89,193,99,158,31,79,243,247,223,192,180,205,44,33,246,192,118,150,215,147,121,165,76,225,15,147,121,99,163,79,68,87,61,50,24,150,191,191,161,95,158,220,219,103,148,20,31,217,25,151,127,252,216,128,49,245,159,131,59,137,214,250,
+201,120,202,114,79,138,42,151,231,38,185,230,114,26,59,21,69,72,196,96,114,69,125,72,84,193,192,112,43,136,105,112,239,65,180,2,215,19,28,156,216,229,214,56,31,174,19,231,108,30,18,225,245,177,219,13,194,187,229,51,79,124,243,212,66,65,110,235,11,138,
+71,177,19,61,166,79,186,241,4,235,180,205,231,137,73,154,199,92,90,78,126,185,180,36,251,163,126,9,219,216,136,224,38,255,210,101,6,105,136,32,189,180,44,127,73,22,228,134,168,95,130,222,250,159,35,92,116,127,116,46,197,5,175,137,11,153,162,220,222,31,
+82,26,116,242,238,76,86,78,218,12,44,211,230,59,153,46,72,172,167,71,182,53,200,134,124,111,54,39,207,53,121,56,73,212,172,3,209,128,124,34,22,144,235,35,126,217,22,240,202,108,113,73,138,14,42,35,252,187,93,113,217,29,175,191,230,140,6,60,198,122,20,
+247,152,180,194,129,100,187,236,14,122,229,174,190,208,149,215,180,184,180,236,168,159,143,244,54,95,94,150,11,139,69,185,54,92,127,255,130,125,202,255,51,158,146,69,190,39,29,7,107,61,213,61,246,15,206,44,240,186,98,226,66,161,44,211,139,69,25,141,248,
+106,246,31,168,210,195,193,252,211,99,41,190,134,68,85,48,112,191,91,226,124,240,110,170,160,28,235,195,225,220,255,125,102,193,246,223,209,115,253,183,94,51,174,50,200,108,120,108,87,220,244,47,195,197,233,151,23,210,174,46,115,192,243,124,124,119,194,
+178,1,52,2,22,110,207,108,195,115,125,98,79,66,188,10,147,129,241,6,122,234,116,178,45,63,23,145,219,160,92,248,83,3,33,9,122,86,174,143,24,118,135,236,123,78,220,85,115,48,22,144,7,183,71,77,31,139,13,224,211,231,237,223,196,168,125,134,253,30,185,61,
+30,148,173,33,159,228,150,150,100,38,87,150,247,211,5,150,0,83,91,33,64,124,120,40,34,81,127,237,122,245,248,165,172,188,232,128,3,111,100,18,223,58,24,182,124,28,178,39,255,249,47,115,109,249,153,204,32,64,252,185,145,168,244,135,106,135,137,226,32,
+232,165,153,44,131,115,212,86,120,79,126,60,26,48,254,202,252,210,50,239,53,46,96,181,239,68,5,222,175,38,23,217,46,193,38,180,45,130,241,92,137,251,14,34,19,170,177,47,4,137,209,85,65,7,184,62,220,185,45,82,55,33,171,114,176,212,236,115,189,18,40,174,
+192,95,246,177,68,64,162,85,147,231,243,229,37,185,144,41,105,243,130,202,234,34,254,134,190,224,154,192,56,22,236,104,14,253,210,116,70,171,12,65,100,181,12,152,76,164,101,128,134,136,54,27,110,222,15,143,68,107,166,154,163,124,238,237,203,57,87,13,
+71,37,162,206,56,148,8,202,61,35,189,166,127,55,22,197,207,118,184,156,240,31,246,13,40,85,81,136,3,18,19,16,144,59,50,26,55,77,160,64,185,255,119,206,50,153,128,136,172,29,25,238,149,209,168,95,188,171,23,65,12,74,199,76,36,157,226,8,68,228,92,184,6,
+237,141,7,106,2,198,72,140,68,187,9,29,15,92,144,148,181,187,215,47,9,191,215,72,104,155,200,216,111,53,177,94,77,160,152,244,84,201,136,28,8,122,141,50,22,4,255,103,243,101,237,130,226,68,228,124,8,26,95,27,246,49,171,132,136,148,33,163,253,241,93,214,
+21,97,240,202,228,162,209,95,187,19,84,42,40,170,117,186,162,235,63,94,215,87,55,59,123,61,167,100,107,19,17,17,17,169,192,154,108,161,180,196,108,252,38,112,252,114,151,192,135,227,164,66,115,124,34,162,205,134,195,169,41,6,137,137,200,134,59,251,67,
+74,65,98,248,68,127,168,99,129,226,184,205,33,117,141,122,224,183,3,50,180,85,130,196,176,127,32,196,64,49,17,17,17,185,6,147,146,154,199,64,49,17,17,145,3,32,211,250,254,161,136,140,68,252,87,2,98,149,150,72,63,224,65,31,181,1,170,143,14,15,70,174,252,
+69,201,98,89,142,205,100,29,81,121,52,24,84,95,178,214,235,181,75,181,182,5,213,95,39,92,147,110,140,248,229,131,76,177,227,175,36,50,132,110,235,11,93,249,231,233,108,209,245,115,69,200,29,208,186,240,230,129,208,154,146,102,182,208,34,34,93,161,154,
+107,160,170,37,237,185,92,137,51,11,186,4,3,197,228,104,189,158,30,249,116,34,40,123,86,7,90,64,97,105,89,62,74,23,228,157,84,129,23,42,34,210,2,2,31,127,61,210,91,211,79,11,193,153,157,177,128,252,253,13,253,242,189,211,73,182,10,162,77,129,67,138,71,
+119,68,107,230,25,12,139,79,246,245,5,93,57,248,163,83,65,77,12,28,178,35,93,44,183,253,103,172,176,19,124,119,130,70,3,169,209,251,254,150,45,97,215,15,220,38,103,251,198,158,132,196,2,181,135,43,152,119,115,215,80,196,152,241,243,221,179,156,249,66,
+68,238,135,53,212,161,45,225,154,217,50,178,58,11,226,103,211,25,198,97,52,215,185,122,55,34,11,40,137,252,250,117,125,198,226,11,23,169,202,215,104,204,111,12,179,249,219,221,9,99,8,11,17,145,155,33,248,241,192,53,81,211,41,189,248,30,38,249,14,219,
+44,107,39,82,129,224,155,217,208,91,4,139,49,28,196,77,58,149,249,138,86,95,168,4,80,245,187,203,157,203,66,92,40,217,11,82,103,203,157,59,168,170,76,51,111,212,126,4,115,179,208,27,26,135,110,68,173,246,228,181,241,186,65,226,106,184,134,186,237,58,
+73,68,180,30,98,48,143,142,198,234,6,137,225,134,213,24,13,227,48,122,227,142,147,28,169,50,217,220,172,31,33,250,234,61,198,96,49,17,185,220,195,35,81,233,81,104,189,138,96,49,90,83,16,181,18,2,27,42,189,127,17,44,70,107,138,78,153,201,171,103,234,206,
+229,58,151,165,11,175,40,102,95,207,230,74,29,205,128,29,207,168,191,166,8,126,159,201,119,238,117,253,202,104,204,244,48,173,2,135,110,68,173,132,235,94,163,128,201,122,184,78,18,17,185,213,129,104,192,136,193,88,193,186,241,200,104,220,168,254,38,61,
+177,245,4,57,14,122,225,252,213,54,245,96,200,23,118,196,228,223,206,36,181,43,127,192,235,112,83,52,32,193,170,11,240,159,210,133,142,110,212,136,168,245,182,134,213,15,187,118,244,250,249,27,160,150,218,27,87,207,192,252,212,64,168,99,131,113,223,152,
+203,25,89,44,42,65,237,183,59,220,43,20,193,223,145,153,172,220,58,24,110,248,152,84,161,220,241,50,117,12,252,187,99,48,172,52,208,238,196,108,103,95,83,171,108,206,10,28,186,161,143,44,123,22,83,171,224,186,103,199,189,253,33,246,43,38,210,4,2,161,
+119,247,135,100,79,44,112,101,254,1,14,78,207,166,11,242,187,217,156,118,251,242,195,54,18,82,176,30,251,252,80,68,158,157,116,87,107,50,82,195,64,49,57,206,221,131,97,229,201,230,178,154,89,140,62,198,186,44,202,112,67,194,69,23,27,226,245,14,108,13,
+203,212,98,73,126,52,145,98,95,32,34,77,168,100,201,85,216,121,44,81,171,223,83,24,180,216,41,83,197,37,121,237,98,198,50,211,5,189,243,16,0,237,52,4,42,127,55,159,55,42,6,6,66,94,99,93,179,188,44,146,43,59,107,240,213,79,198,83,70,86,144,217,186,11,
+25,218,47,94,238,92,224,21,129,55,59,134,194,120,159,50,80,76,173,17,244,216,43,192,197,92,21,6,138,137,220,15,85,203,245,238,143,248,103,236,211,241,117,252,82,182,163,247,199,86,66,54,177,202,193,113,181,93,198,28,41,6,138,117,196,64,49,57,206,53,77,
+108,68,117,89,148,33,72,252,181,209,184,233,196,118,148,191,161,47,208,119,78,205,51,88,76,202,176,216,97,54,58,17,185,25,2,192,185,242,178,145,241,178,126,51,131,12,31,100,189,58,105,195,134,225,147,79,159,119,246,112,43,220,23,142,142,45,200,125,219,
+122,235,150,215,191,55,155,147,151,152,157,75,164,44,191,196,161,179,78,130,189,213,206,144,79,118,133,125,50,157,47,203,68,190,100,28,60,18,153,105,20,36,94,15,73,92,249,165,101,45,226,16,67,77,180,243,196,235,211,169,225,193,180,185,24,40,38,199,177,
+123,146,5,209,128,30,237,182,145,73,108,22,36,174,192,69,249,171,219,99,142,223,128,82,103,225,100,248,206,193,240,154,247,84,186,184,36,39,231,243,218,156,126,235,0,89,134,42,61,138,161,204,195,33,234,160,124,7,135,153,85,28,79,23,140,47,108,76,118,
+173,246,76,78,150,150,228,157,84,129,135,167,77,66,176,24,235,9,108,140,247,68,252,70,203,43,39,189,166,11,37,123,239,59,6,234,168,149,146,197,178,12,219,216,50,79,216,232,253,77,155,7,1,226,251,7,195,114,115,157,214,33,168,206,124,249,226,34,19,40,168,
+33,28,158,170,86,56,99,240,254,251,233,2,15,32,72,43,12,20,19,57,4,122,18,215,107,55,209,8,50,127,120,130,71,141,124,121,164,183,238,251,9,7,49,56,253,70,175,173,239,143,45,48,176,226,0,211,153,146,242,160,156,75,89,110,106,220,8,27,214,219,98,1,73,248,
+86,14,53,157,20,132,203,150,150,36,236,83,59,108,189,224,160,0,8,238,125,188,255,181,22,130,38,78,12,156,160,231,243,3,54,14,212,222,236,112,63,229,138,234,195,12,225,156,9,215,58,54,147,85,30,82,135,131,95,182,157,232,60,171,10,77,172,185,144,45,138,
+106,10,126,38,173,97,143,58,224,247,202,72,208,43,147,249,178,156,203,149,180,222,63,224,208,84,117,93,94,113,103,127,72,126,124,49,179,153,63,22,81,91,49,80,76,142,131,242,81,59,61,138,33,93,112,255,9,222,77,81,245,129,66,21,251,162,250,6,138,113,147,
+190,99,32,100,244,62,170,188,31,208,39,241,116,170,32,175,206,229,24,224,52,241,208,150,176,229,161,3,22,207,204,74,119,134,23,38,211,242,228,222,62,165,159,5,143,37,119,65,127,213,79,214,233,189,143,161,173,232,185,219,233,126,186,175,78,103,228,193,
+237,81,203,199,33,155,253,232,20,251,208,81,103,252,241,178,249,112,192,138,217,92,73,78,102,59,123,160,129,160,202,195,195,209,154,64,67,101,206,196,11,83,105,102,158,185,8,90,200,156,75,21,100,103,204,122,157,254,71,86,107,57,194,253,235,170,233,234,
+193,61,89,215,129,232,173,130,107,25,102,7,213,219,83,96,30,192,207,166,51,90,190,118,123,154,104,131,57,24,116,127,88,45,105,179,122,167,130,135,246,122,210,163,94,159,180,130,41,162,118,157,110,226,223,113,154,120,19,45,55,116,184,41,213,115,40,17,
+148,199,118,39,106,38,220,99,209,135,141,214,223,238,78,24,129,100,170,133,44,138,253,138,19,186,177,137,61,100,35,139,157,54,7,54,161,191,152,176,14,0,227,49,83,77,46,226,168,51,190,184,45,98,148,36,214,59,252,196,159,97,48,155,221,65,93,173,134,108,
+77,180,163,177,242,43,78,181,166,14,194,112,192,84,193,60,243,15,135,25,207,143,119,246,48,13,247,224,199,119,37,26,102,163,225,207,241,253,94,14,38,117,149,31,224,254,187,104,126,0,129,235,232,79,217,207,187,227,16,220,172,215,110,162,158,202,64,116,
+170,133,125,22,174,85,141,18,79,240,231,152,153,163,227,126,44,216,165,215,103,84,186,33,97,207,142,15,29,48,60,152,54,7,3,197,228,56,39,146,246,130,190,184,160,253,86,131,139,148,221,44,106,93,33,112,105,53,213,30,11,59,100,1,112,163,85,11,229,237,118,
+222,75,123,155,200,100,167,214,67,176,238,233,143,230,141,108,184,229,170,53,26,254,63,254,12,223,195,99,200,61,176,121,82,217,172,34,144,60,220,196,65,97,43,33,83,248,55,211,153,186,27,4,4,231,248,254,35,39,120,234,116,82,222,157,201,214,244,106,199,
+117,18,65,188,111,127,56,215,241,195,180,207,55,56,24,170,134,239,227,113,228,46,168,192,194,117,18,215,196,202,123,16,255,139,127,62,122,110,129,21,23,14,113,157,205,108,208,61,92,7,215,192,254,10,251,44,149,107,25,30,71,122,64,118,248,9,27,173,155,
+176,102,124,149,135,99,218,98,235,9,114,28,148,47,236,155,205,41,159,6,163,116,87,135,178,151,84,19,237,51,22,74,122,245,213,194,194,4,229,216,42,16,44,198,70,235,89,102,185,173,145,80,236,53,90,17,96,176,221,49,16,224,248,238,89,182,2,209,197,29,138,
+247,48,113,72,111,59,244,213,196,215,176,207,35,55,173,150,88,179,215,38,57,13,50,54,241,85,121,159,142,59,160,213,68,5,214,48,170,179,38,240,184,94,77,203,182,117,86,185,78,146,115,217,93,7,83,45,100,89,171,14,151,199,227,144,228,211,233,54,90,173,116,
+54,91,146,3,54,255,123,186,236,201,49,236,60,22,80,155,155,132,24,12,219,40,233,139,87,82,114,36,108,152,223,83,56,209,122,101,114,81,155,27,211,159,154,104,159,49,174,217,100,101,187,217,176,187,152,5,64,68,14,21,247,169,151,99,58,169,141,16,14,44,24,
+12,33,167,171,188,79,157,18,36,134,157,33,123,159,99,187,143,39,34,106,7,187,89,214,55,198,245,106,223,129,164,181,180,205,0,168,221,138,104,39,67,18,86,163,42,51,89,157,25,244,195,51,73,173,14,7,168,22,87,40,228,88,8,22,159,76,23,101,127,34,176,102,
+160,25,46,220,23,50,69,163,212,65,167,83,44,76,221,69,233,164,234,148,85,188,14,186,93,160,183,217,236,115,133,247,4,202,187,57,177,248,170,188,205,236,164,2,179,153,136,136,136,136,72,3,211,54,247,4,186,85,103,182,194,128,197,32,192,245,236,62,222,13,
+142,77,103,228,161,29,214,131,126,97,44,85,212,110,160,27,14,98,209,218,243,99,17,191,12,85,237,207,145,216,198,125,119,119,112,100,160,248,198,117,189,133,116,158,164,88,121,174,156,22,89,31,94,151,149,215,166,59,218,11,96,18,54,6,7,88,101,213,226,132,
+239,39,227,169,182,253,92,237,210,76,86,93,216,139,194,8,222,176,42,222,79,23,140,158,167,170,62,210,96,16,36,145,219,241,192,134,200,253,178,101,123,201,11,118,31,79,68,214,142,167,11,114,184,184,164,220,58,65,167,76,208,86,225,220,156,149,247,81,104,
+114,209,114,110,14,178,107,159,155,236,236,16,213,205,130,214,72,120,29,68,207,167,215,82,152,53,114,83,52,32,131,33,175,81,81,56,145,41,26,135,86,199,93,188,207,118,76,160,24,125,189,238,238,15,25,211,250,215,95,156,30,46,175,52,214,70,207,20,29,28,
+136,6,228,206,193,176,244,87,157,190,61,186,122,161,121,99,38,235,234,55,20,109,12,50,164,143,142,45,200,231,70,162,107,222,31,213,144,73,140,32,177,142,167,121,184,168,170,102,84,87,204,22,25,36,174,134,247,208,123,138,61,190,113,205,97,217,16,209,230,
+56,157,46,40,95,207,120,96,67,228,126,88,151,165,21,3,84,120,28,179,178,136,54,135,106,54,232,135,201,60,147,181,234,176,83,225,10,179,57,61,175,101,216,35,205,21,151,228,158,109,145,154,125,121,65,179,248,20,53,7,49,76,204,76,90,223,211,185,242,249,
+193,161,21,174,71,110,140,239,57,34,80,140,210,113,179,192,24,2,199,7,182,134,101,79,44,32,223,31,91,112,245,224,135,47,143,244,54,108,14,142,231,143,155,218,222,100,158,3,186,186,24,54,14,223,57,155,52,14,20,246,198,252,87,250,92,34,227,12,193,4,157,
+3,123,118,203,197,176,209,98,19,253,90,104,219,130,235,166,217,32,2,188,118,207,77,232,151,149,78,228,20,40,217,187,101,32,100,25,52,210,177,141,16,81,183,82,13,80,225,113,68,180,57,84,178,65,17,36,254,25,63,135,117,217,57,232,150,213,199,235,202,168,
+110,62,155,52,50,70,7,252,87,99,85,60,96,32,4,137,191,54,26,111,24,195,148,213,97,143,88,19,132,92,56,87,171,231,250,111,189,214,209,168,43,94,224,191,221,157,80,46,15,65,6,28,130,104,110,100,22,36,94,239,67,6,139,169,75,253,199,235,250,148,175,7,199,
+47,101,121,146,107,226,222,254,80,77,160,10,39,224,103,211,5,99,113,220,205,211,214,177,224,187,61,30,148,237,171,237,127,208,163,238,163,84,145,21,29,212,82,56,8,63,50,26,111,88,198,137,207,35,170,72,152,89,72,164,143,47,110,139,152,86,245,112,237,66,
+173,134,86,134,152,233,82,61,68,21,193,59,28,88,118,251,90,239,238,193,176,92,19,241,27,107,97,220,115,167,50,37,121,47,153,231,122,207,132,157,248,12,14,187,255,237,76,178,171,223,103,212,157,158,188,54,110,235,64,229,249,177,148,171,14,24,58,30,40,
+182,90,76,213,227,198,5,22,178,67,85,27,162,87,188,56,158,230,77,140,186,14,2,43,143,237,78,88,62,109,55,31,26,181,27,94,211,149,94,206,60,1,23,139,251,14,202,237,126,52,145,226,130,215,101,112,40,82,49,158,43,201,201,108,201,49,79,160,82,150,86,61,148,
+149,7,54,68,122,67,224,238,96,127,72,70,99,87,231,174,96,224,209,91,115,57,71,221,135,135,125,30,185,41,22,144,61,209,128,76,103,139,114,114,177,232,168,235,39,89,51,91,211,240,48,146,154,101,117,208,45,124,127,81,23,195,61,254,209,209,152,173,23,0,123,
+204,167,207,47,184,230,69,235,104,160,24,155,167,175,95,215,103,187,97,58,78,174,254,245,212,252,166,253,92,155,193,238,137,131,48,16,70,93,12,23,223,135,183,71,27,94,27,176,217,194,224,0,6,88,200,46,149,195,73,92,123,221,222,230,168,91,60,50,24,150,
+91,182,132,165,103,221,165,2,155,151,87,166,22,229,173,20,15,91,137,136,234,105,180,55,201,150,150,228,135,103,23,100,170,196,214,94,78,247,208,150,176,209,158,209,12,238,135,207,156,77,178,85,27,217,134,96,241,125,219,122,235,94,39,16,244,194,16,118,
+190,175,168,27,217,233,20,80,237,233,83,243,174,249,204,116,180,71,241,206,144,175,169,169,154,40,131,192,133,203,77,167,87,118,131,196,178,218,179,152,168,27,33,219,230,220,169,121,249,116,34,104,100,185,84,160,61,0,166,19,51,43,150,154,129,18,68,149,
+10,22,92,123,49,92,149,165,193,206,118,100,184,87,246,245,213,95,164,97,109,241,224,246,168,200,68,154,193,98,34,162,117,190,177,39,33,177,64,253,125,70,216,231,145,39,246,36,228,123,167,147,12,22,59,24,214,52,86,65,98,89,189,31,162,253,2,91,26,146,93,
+136,181,32,3,18,239,181,235,34,126,73,248,60,146,44,45,201,169,76,145,1,98,234,106,213,109,126,236,216,30,244,201,84,209,29,251,146,142,6,138,71,130,205,7,66,87,202,168,221,17,40,190,49,226,87,120,84,227,127,151,65,49,234,70,200,230,252,245,92,206,248,
+34,106,133,59,251,213,219,28,33,0,201,64,177,115,237,11,251,26,6,137,171,61,112,77,84,222,58,57,219,237,47,23,17,209,21,56,100,107,20,36,174,240,122,122,228,43,163,49,121,234,52,43,27,157,234,166,170,68,10,43,70,230,27,3,197,212,36,4,133,167,56,116,151,
+104,195,134,16,255,76,187,227,117,84,155,24,181,73,130,30,251,217,196,68,68,68,205,24,12,170,159,141,170,14,84,164,206,248,172,201,36,243,106,104,73,129,246,20,68,68,180,98,111,92,45,192,136,96,50,14,229,200,153,236,238,163,55,146,184,68,68,68,27,119,
+214,69,51,0,58,186,19,222,200,11,149,45,187,167,220,97,35,25,193,204,38,38,34,34,90,43,226,83,95,190,12,133,185,57,38,34,170,240,218,8,48,238,8,49,80,76,68,68,84,13,237,48,155,49,91,116,79,235,220,142,6,138,207,229,74,70,131,125,187,48,204,206,109,211,
+53,209,240,189,29,255,14,17,17,213,87,224,112,58,109,216,9,116,16,17,81,115,122,155,152,37,67,237,145,183,185,166,97,242,17,17,81,107,96,102,146,93,136,237,185,169,183,119,71,3,197,232,65,250,97,19,253,110,78,206,187,175,71,206,235,77,244,186,252,3,123,
+179,18,17,181,204,71,105,245,155,122,51,247,38,106,159,102,14,153,137,136,200,158,69,94,107,29,235,125,27,107,154,177,20,131,196,68,68,173,130,131,55,187,215,213,151,47,186,171,79,124,199,155,48,190,52,147,53,50,132,85,205,229,202,174,28,48,132,55,147,
+157,192,3,30,123,220,198,2,128,136,136,204,189,158,204,27,247,16,43,8,66,190,58,195,65,118,78,150,182,81,186,117,154,247,82,34,162,43,178,37,245,125,23,7,10,59,23,50,211,222,155,181,254,253,96,77,115,108,38,211,189,47,20,17,209,38,120,110,50,173,180,
+175,132,87,38,23,93,215,17,161,227,129,98,100,21,255,100,60,165,20,44,198,47,226,251,99,11,109,249,185,54,195,179,147,139,74,193,98,60,230,89,78,166,37,34,106,57,220,67,172,110,234,175,93,204,184,170,52,168,27,61,63,174,54,50,24,27,100,6,58,136,136,174,
+122,117,90,45,104,200,22,120,206,247,227,139,25,211,189,37,238,129,47,187,48,64,65,68,228,116,136,99,98,95,105,118,96,135,24,231,243,99,41,35,89,201,109,122,174,255,214,107,142,168,41,234,245,244,200,221,253,33,217,63,16,146,192,186,126,88,184,201,157,
+152,205,185,50,147,184,30,76,157,61,180,37,44,195,189,107,7,68,96,65,134,22,21,236,33,69,68,180,121,26,221,111,80,66,132,172,27,110,168,220,225,96,44,32,15,110,143,54,252,89,203,75,203,242,189,211,73,153,178,145,61,71,68,212,13,142,12,247,202,190,190,
+96,195,103,154,42,148,229,169,211,73,190,23,92,226,64,52,32,55,39,130,50,28,241,25,235,26,4,39,206,166,10,242,198,92,142,7,223,68,68,155,108,216,239,145,235,34,126,73,84,13,219,158,206,151,93,221,33,192,49,129,226,106,8,164,86,100,203,238,27,92,103,199,
+238,160,87,194,94,15,131,195,68,26,25,246,121,228,240,96,88,174,137,248,36,232,245,72,190,188,36,23,50,37,57,58,197,74,1,162,86,218,23,246,201,103,71,122,37,22,240,174,249,175,226,224,245,133,201,52,131,196,68,68,13,224,176,237,238,161,136,132,171,54,
+182,56,96,67,118,212,79,217,126,137,168,101,176,47,120,120,36,42,91,195,222,43,195,120,145,8,119,38,85,224,222,128,136,28,201,145,129,98,114,174,74,0,44,225,191,186,41,159,206,22,185,160,36,90,245,200,96,88,110,29,12,215,125,57,150,151,69,126,121,33,
+45,111,165,216,51,149,168,213,16,244,88,40,45,201,201,44,203,165,137,136,136,168,243,88,253,68,164,230,222,254,144,124,98,75,104,205,225,165,172,86,184,188,126,41,203,253,115,155,49,80,76,202,158,188,54,94,211,46,163,2,1,176,63,94,206,50,96,76,93,205,
+44,72,92,237,23,19,12,22,19,17,17,17,17,233,10,85,79,71,118,198,45,159,29,130,197,223,254,112,142,239,3,234,90,127,183,43,46,3,161,250,113,166,138,147,243,121,102,224,183,145,249,111,131,104,213,55,246,36,106,74,123,171,245,244,136,17,32,11,249,60,218,
+125,128,17,252,27,10,95,109,135,146,44,150,229,216,76,150,39,191,180,6,178,237,85,130,196,240,192,53,81,121,235,228,44,95,64,34,34,34,34,11,104,75,168,123,59,66,210,15,90,99,169,64,59,10,244,13,103,16,140,170,213,203,176,197,161,194,165,108,89,171,246,
+106,42,65,98,64,95,253,35,34,252,156,180,9,3,197,100,9,153,196,102,65,226,106,248,0,31,92,44,106,145,45,137,139,243,157,219,34,70,16,188,218,176,248,140,231,201,83,45,170,118,88,49,72,44,171,7,43,56,128,96,6,62,57,29,250,232,31,30,140,200,104,236,234,
+97,25,134,228,252,110,38,235,202,9,190,68,68,228,14,245,238,63,149,1,231,175,206,229,140,137,243,68,78,166,186,127,134,221,177,0,6,44,240,247,73,134,70,73,122,56,84,64,133,247,127,184,174,79,139,118,134,200,186,87,9,18,95,121,124,95,80,134,153,176,215,
+22,30,7,252,12,228,96,200,146,108,212,110,162,17,12,198,112,59,156,234,222,53,84,27,36,174,134,11,21,130,232,68,176,53,164,190,24,132,234,44,117,34,39,58,148,8,202,99,187,19,107,54,233,16,245,123,228,158,145,94,249,178,98,166,12,17,17,145,29,7,162,1,
+57,50,26,175,185,255,4,188,61,114,96,107,88,190,54,26,151,94,143,201,34,157,168,195,144,112,100,7,222,219,68,178,154,97,107,117,200,128,24,5,122,95,15,251,220,29,206,83,205,186,175,118,191,6,177,38,55,96,70,49,153,186,163,47,104,251,5,90,223,128,220,
+109,112,178,181,79,241,121,35,136,142,133,192,175,231,114,218,189,145,240,58,124,106,32,36,219,194,62,241,246,244,200,108,174,44,167,211,5,45,159,107,43,68,253,246,2,197,68,78,54,188,26,12,54,115,67,34,40,15,21,150,228,197,203,204,140,39,34,162,214,64,
+0,248,190,145,94,211,192,89,127,200,43,95,26,137,202,51,19,41,190,234,68,26,67,32,244,225,145,168,108,13,123,141,108,90,89,157,141,148,46,150,229,231,147,139,218,13,48,70,92,193,78,134,237,87,70,99,242,212,233,228,166,254,76,155,41,210,68,220,8,177,9,
+218,124,204,40,38,83,205,102,61,218,61,69,117,18,187,39,91,159,180,209,114,192,45,112,146,137,225,11,59,99,1,35,240,143,197,58,130,226,200,178,254,207,215,247,27,65,100,90,11,11,22,34,93,220,173,120,93,219,63,16,98,86,23,17,17,181,204,167,19,65,165,236,
+74,100,27,227,80,147,200,137,222,183,217,18,160,204,86,42,53,14,198,2,70,139,5,112,228,49,133,0,0,32,0,73,68,65,84,236,65,189,85,107,77,100,211,34,227,22,123,85,84,1,235,100,127,191,189,36,61,59,237,77,156,200,219,196,30,194,107,86,242,77,45,195,187,
+43,209,58,118,51,67,141,32,170,203,179,168,171,161,39,146,217,73,38,158,47,110,204,58,61,231,86,184,148,179,23,40,126,103,158,153,217,228,92,187,162,1,165,159,13,215,131,157,54,50,31,136,136,136,204,236,81,188,255,192,77,54,30,75,212,78,232,161,106,39,
+248,155,44,48,225,164,26,246,153,104,173,96,21,19,68,21,176,155,19,212,214,107,38,195,86,167,231,79,206,193,221,29,109,138,241,156,123,203,64,154,57,164,186,41,22,144,41,13,90,50,224,84,86,245,100,242,241,221,9,249,231,191,204,109,250,207,228,22,24,108,
+248,15,137,160,210,251,7,11,71,29,6,62,170,66,6,58,50,245,113,8,83,121,125,178,165,37,121,251,114,142,173,76,28,138,189,242,136,90,3,27,56,4,190,6,66,94,201,151,151,100,54,95,150,151,166,51,28,196,66,212,2,65,86,180,56,18,50,65,49,179,166,186,29,33,218,
+5,76,103,74,242,194,100,186,107,174,127,111,94,202,26,213,152,42,158,31,79,119,250,199,117,20,180,84,80,133,225,243,186,236,39,154,201,176,117,51,12,40,181,187,231,96,21,111,123,48,37,144,76,53,147,245,136,133,128,110,253,130,186,197,222,184,122,102,
+6,46,234,88,8,210,85,152,62,171,226,87,147,221,51,213,24,135,15,200,64,199,1,68,117,16,29,155,7,44,158,145,193,78,206,131,133,27,17,53,15,217,80,255,105,111,159,113,157,67,217,44,238,153,184,14,162,165,211,147,123,251,180,43,151,37,234,132,60,203,245,
+29,7,215,54,100,130,174,159,89,131,53,32,174,133,79,236,73,116,77,85,34,130,151,39,231,243,150,143,251,197,68,247,4,207,85,217,105,169,128,247,150,46,123,210,229,46,187,164,157,105,34,113,234,207,201,238,73,182,234,36,6,138,201,20,178,30,237,6,12,112,
+90,236,102,205,92,160,117,56,197,196,162,205,238,41,230,199,109,4,150,187,1,62,47,88,236,53,122,15,225,179,132,239,119,75,54,49,22,109,86,131,33,177,16,124,242,218,120,219,126,38,82,51,101,227,58,126,206,197,21,36,228,94,232,141,253,208,150,176,113,253,
+248,199,143,13,200,215,119,37,228,203,35,189,142,233,89,138,170,27,179,225,190,184,54,62,226,144,25,7,55,70,252,242,248,246,152,241,90,226,11,175,35,254,140,168,19,48,56,89,213,251,54,30,75,155,79,101,32,56,246,26,184,62,118,11,84,28,254,102,58,83,183,
+13,5,170,235,142,158,91,232,170,42,67,21,205,4,125,117,217,147,54,147,45,107,183,31,182,147,224,243,97,39,246,130,189,52,171,81,219,131,173,39,200,210,43,83,139,198,201,176,10,220,4,159,62,191,224,234,23,21,23,104,59,167,152,186,100,222,221,212,196,77,
+57,232,225,89,211,122,88,236,189,117,114,214,8,0,84,15,131,68,118,126,183,45,4,239,81,204,152,67,134,9,14,42,152,77,225,28,111,205,229,140,65,65,86,222,155,205,201,34,51,186,168,205,118,7,189,114,100,52,190,166,92,177,63,228,53,190,110,72,4,229,149,201,
+69,121,61,105,157,197,181,89,144,81,167,82,74,121,203,150,176,252,116,38,219,209,183,15,130,194,120,205,170,13,139,207,248,179,253,201,188,60,219,69,21,48,228,12,191,77,230,141,65,209,86,159,161,177,84,81,166,138,92,55,56,137,234,64,112,252,110,209,150,
+167,91,2,62,120,158,248,66,32,125,199,234,92,7,4,247,184,238,173,47,222,68,198,185,46,123,210,19,115,121,229,118,37,144,42,148,93,255,62,66,69,174,74,172,9,113,166,103,206,36,219,242,51,17,51,138,73,65,37,75,210,10,62,188,223,59,237,254,15,239,207,109,
+110,138,126,223,225,77,94,171,44,112,177,210,82,216,252,227,208,164,242,213,109,65,98,4,126,237,244,156,58,236,144,204,58,90,241,65,166,104,4,219,204,204,229,202,242,146,38,215,63,114,15,100,18,175,15,18,175,119,79,135,51,98,71,163,106,127,55,202,101,
+59,57,132,230,139,219,34,53,65,226,106,248,30,178,182,137,218,9,135,143,71,199,22,76,19,49,112,255,121,110,146,61,93,157,198,78,162,141,157,161,133,186,64,107,198,74,208,152,65,226,198,154,153,117,148,212,164,111,45,222,27,41,27,131,13,237,198,45,156,
+8,123,100,100,214,155,93,243,145,125,143,56,19,63,55,237,195,64,49,41,169,124,128,235,93,184,80,46,112,46,85,144,111,127,56,167,197,135,23,55,113,149,126,82,48,181,88,210,230,52,188,153,64,230,116,182,184,41,63,11,185,159,221,12,245,132,95,125,115,65,
+237,129,140,204,23,199,211,146,94,151,177,133,133,220,241,75,89,249,254,216,2,179,137,169,237,238,87,200,52,132,67,29,12,112,122,109,76,197,221,30,233,76,113,31,90,116,220,60,96,29,164,62,176,53,236,152,118,30,212,61,206,228,203,242,204,217,164,145,53,
+92,141,247,31,125,96,192,39,81,61,216,139,219,109,5,249,110,7,171,136,90,237,223,199,82,70,96,212,10,18,249,116,153,11,133,231,129,33,249,70,191,238,197,210,149,175,115,171,49,168,127,249,104,158,65,226,54,99,235,9,82,102,4,80,87,51,134,43,165,51,186,
+150,205,160,95,206,35,165,37,163,44,180,209,126,15,193,100,60,78,39,56,8,80,205,6,192,13,188,211,37,179,68,180,185,142,167,11,198,23,2,69,3,171,193,124,100,27,19,117,202,46,197,67,40,180,180,161,198,110,178,145,205,119,93,196,47,83,26,109,194,201,29,
+208,86,226,153,137,148,241,179,162,221,204,197,226,18,131,195,26,201,151,25,244,161,198,62,76,230,45,251,93,87,96,255,170,211,32,125,196,86,16,24,69,27,43,12,154,95,63,67,104,54,87,146,231,199,245,28,128,104,180,112,100,207,110,71,224,42,154,154,98,4,
+141,53,186,32,215,131,32,40,190,214,247,154,69,105,203,177,153,172,150,23,103,156,96,98,26,187,138,63,94,102,144,152,26,67,166,189,157,30,91,204,78,119,54,108,216,217,11,178,187,96,131,178,187,42,40,139,254,253,47,79,103,58,126,239,143,218,200,110,69,
+251,137,78,28,108,148,141,84,40,181,172,226,63,45,116,102,67,20,180,49,188,54,209,68,191,200,86,67,139,142,253,253,65,9,122,87,126,22,167,188,31,169,61,144,97,76,206,135,54,132,170,131,177,47,184,124,248,57,109,46,36,99,125,35,226,179,76,96,194,123,14,
+251,87,29,25,9,105,171,73,105,184,7,178,175,53,181,19,3,197,68,22,86,178,102,187,35,40,138,155,15,74,62,30,184,38,218,48,147,90,86,179,169,153,77,76,86,236,100,168,243,253,68,228,12,232,47,254,196,158,68,205,102,127,192,235,147,35,59,227,29,175,166,65,
+233,185,106,255,243,115,77,244,57,108,133,183,47,171,29,148,33,158,204,204,25,107,223,216,147,168,185,151,56,229,253,72,68,87,125,180,80,80,206,2,61,198,117,31,89,120,234,116,82,254,110,87,92,6,66,245,67,86,88,15,96,184,89,55,4,79,187,101,240,35,57,135,
+119,203,103,158,248,38,127,31,68,84,113,161,80,54,202,125,182,7,125,210,235,247,172,9,24,35,240,247,223,199,211,114,76,177,135,51,117,183,179,169,162,28,80,232,129,249,238,76,86,78,50,179,132,200,17,254,207,189,125,166,25,97,131,33,159,100,243,101,227,
+94,209,9,123,195,126,73,4,173,15,160,208,91,251,216,108,103,54,86,103,114,37,185,61,30,184,146,253,218,200,27,23,51,198,99,59,33,238,245,200,245,113,181,246,19,175,92,204,200,188,201,144,153,205,132,32,65,95,176,113,94,11,222,143,168,131,226,61,132,168,
+243,222,79,23,149,174,125,88,247,29,79,179,146,140,172,189,53,159,151,233,197,162,68,189,61,130,51,98,116,159,185,156,45,203,107,151,50,114,116,114,81,210,108,71,67,93,8,25,230,247,109,141,200,129,68,80,118,4,60,34,248,92,180,248,192,164,231,250,111,
+189,166,252,233,66,95,218,125,189,126,163,12,63,191,180,36,19,25,125,6,121,33,131,230,225,145,168,108,13,123,175,108,144,144,233,129,210,54,76,147,100,105,27,17,145,125,7,99,1,249,235,145,222,134,129,39,102,131,17,57,7,218,77,168,100,131,101,87,251,231,
+117,2,218,73,60,58,26,179,252,155,95,153,92,52,6,50,118,146,89,38,212,187,171,237,173,58,233,235,187,18,210,111,49,80,10,195,100,158,62,191,208,145,159,18,251,14,100,13,91,193,122,253,255,58,57,219,145,159,145,136,106,57,253,218,71,68,228,70,79,94,27,
+111,56,131,3,9,125,104,195,210,170,12,123,165,64,49,22,106,15,111,143,74,184,78,143,50,44,206,144,125,232,230,141,62,34,242,86,37,130,157,92,40,19,17,185,29,2,80,215,68,124,70,150,9,250,119,94,204,150,228,165,233,12,123,109,17,57,200,127,218,219,87,119,
+173,87,207,63,253,185,115,129,185,67,137,160,220,51,210,219,240,251,88,151,62,59,233,140,117,41,214,208,135,7,175,174,49,157,52,231,0,3,194,142,140,198,27,182,242,64,86,246,191,157,73,118,108,128,216,223,108,143,202,78,197,225,133,104,155,197,54,30,68,
+206,129,107,223,167,6,66,18,244,172,220,83,48,139,130,1,98,34,34,251,144,212,250,248,238,132,82,235,181,86,173,135,44,123,20,35,27,236,193,237,209,134,223,71,89,58,178,79,208,108,28,125,100,220,70,37,72,44,171,211,179,113,58,250,221,179,12,22,19,17,217,
+197,172,225,198,42,21,45,3,33,175,177,0,192,96,142,76,105,73,94,191,148,101,224,131,218,202,107,214,156,222,65,144,41,156,43,47,203,225,161,200,154,225,118,8,108,254,113,54,231,168,106,55,99,248,175,67,19,13,48,32,236,59,167,230,229,243,67,17,185,33,
+177,54,147,28,193,246,159,77,103,58,22,36,22,99,224,158,250,16,189,184,3,6,238,81,247,168,87,137,138,74,139,15,57,195,227,10,227,218,55,145,118,200,79,67,68,228,94,143,238,136,42,207,231,64,37,239,249,108,105,195,9,9,166,129,98,156,4,154,5,137,171,97,
+200,132,219,2,169,184,201,223,185,77,125,42,63,74,104,16,88,102,51,113,34,34,106,5,28,198,174,31,30,137,77,39,238,169,184,255,238,102,107,14,106,35,100,251,139,184,35,88,124,60,93,48,190,134,253,30,25,240,123,37,91,94,50,2,159,100,15,2,193,70,246,245,
+228,162,209,214,3,62,200,56,163,119,40,218,220,17,57,77,163,129,159,168,198,184,117,48,44,123,226,1,87,38,79,17,17,145,243,96,175,216,168,149,79,61,184,55,221,63,20,145,31,108,240,160,206,244,248,253,11,59,172,123,192,85,195,19,64,112,217,45,14,15,134,
+197,110,242,204,39,182,88,15,102,34,34,34,178,130,205,230,250,32,241,122,168,216,121,100,48,204,215,146,218,226,162,226,60,134,178,131,134,199,76,21,151,140,192,38,131,196,27,135,215,209,41,65,98,248,211,130,122,69,5,147,56,168,93,234,5,137,171,225,160,
+23,125,36,137,136,136,54,234,142,38,226,143,59,122,253,27,254,123,27,6,138,17,240,85,77,111,174,118,159,66,27,7,167,24,141,218,127,1,85,123,247,17,17,17,153,65,217,170,202,97,229,45,91,24,40,214,209,129,104,64,30,218,18,54,190,80,173,52,236,239,252,250,
+2,125,195,151,21,98,192,239,205,50,40,71,155,15,173,119,178,10,165,147,152,35,226,4,232,249,236,180,207,52,181,22,230,45,152,5,137,43,208,178,112,152,123,70,34,34,218,160,168,223,124,232,112,61,42,247,41,43,13,211,127,111,77,88,79,189,174,167,153,39,
+210,41,205,246,226,67,250,55,251,70,18,57,31,54,109,23,139,75,29,237,177,72,212,8,122,18,171,192,173,138,247,29,125,224,186,244,185,145,168,244,175,251,253,99,94,194,241,75,89,121,241,114,231,250,91,162,159,217,47,47,164,77,219,142,157,75,21,216,131,
+147,218,230,135,103,23,76,51,56,49,229,187,211,195,166,123,61,61,242,213,237,177,154,73,228,248,76,227,80,229,199,23,51,29,251,217,168,181,48,148,87,213,29,125,65,94,43,201,81,112,120,117,93,196,47,9,159,71,146,165,37,57,149,41,26,85,57,68,68,235,53,
+188,219,37,154,12,248,54,147,133,76,68,212,42,232,177,120,176,63,36,163,177,171,21,3,133,242,178,156,152,205,201,171,115,57,6,141,201,49,236,220,47,57,168,73,15,8,40,29,25,141,55,252,221,31,216,186,146,61,222,201,96,49,14,36,22,206,45,200,103,71,122,
+141,18,234,10,100,118,190,125,217,89,131,226,72,127,56,188,248,246,135,115,70,41,127,245,224,48,220,215,207,164,10,29,239,225,142,207,244,215,70,227,53,7,63,21,55,15,172,148,140,50,88,172,135,160,87,253,94,60,20,198,58,148,129,98,234,60,92,167,234,13,
+45,189,103,181,34,227,133,169,52,3,198,68,180,70,203,27,10,171,148,44,186,29,179,186,136,156,233,80,34,40,247,140,244,214,252,108,8,202,32,0,179,39,22,144,231,38,82,92,12,145,35,224,126,217,100,97,11,185,20,54,106,86,7,4,184,86,253,97,33,223,209,235,
+148,49,173,158,195,152,200,65,58,157,53,220,200,221,253,161,134,65,226,10,4,139,223,152,203,113,237,161,1,59,3,63,147,69,246,77,167,206,179,58,204,66,37,196,227,187,18,114,116,108,129,189,254,137,28,40,93,44,203,128,215,94,216,182,21,179,68,26,30,139,
+158,78,55,23,12,45,186,40,91,111,178,137,129,29,42,189,210,136,168,253,144,73,92,47,72,92,13,139,164,47,109,183,55,164,147,104,179,164,109,108,34,223,231,1,165,22,118,69,3,74,79,227,38,197,199,17,81,103,225,0,90,197,237,241,230,90,250,145,179,168,14,
+252,132,119,147,121,254,246,168,227,112,64,109,117,152,133,3,236,251,182,153,239,161,136,168,51,94,158,182,95,145,52,190,184,241,193,196,13,3,197,205,150,22,158,113,209,102,246,165,38,94,116,148,93,18,145,243,220,179,77,109,144,38,22,75,135,154,236,193,
+78,212,74,39,230,212,54,145,179,185,146,81,126,77,238,167,218,110,36,216,130,33,20,68,180,249,172,2,48,164,23,213,189,35,18,139,78,218,8,42,19,109,6,244,36,94,223,110,162,17,100,22,35,233,134,136,156,5,247,18,236,5,85,33,155,248,7,19,233,13,255,189,166,
+141,150,236,78,17,70,53,206,49,23,53,237,199,198,251,93,27,63,47,6,102,176,55,31,145,243,96,33,100,103,179,182,151,217,122,228,0,184,159,156,179,56,92,197,205,254,249,241,141,223,236,137,136,168,245,208,43,153,186,7,246,142,191,176,216,128,227,190,141,
+33,140,68,157,118,157,205,192,239,174,112,203,187,146,18,81,11,124,247,236,130,17,139,180,130,120,236,175,38,91,51,187,193,52,80,140,126,96,118,90,45,96,82,182,219,178,158,48,141,246,228,188,117,86,23,162,248,79,177,95,31,145,35,13,216,28,190,25,96,182,
+30,57,4,78,124,113,96,89,175,191,63,238,59,223,59,157,100,54,177,70,198,82,106,165,96,211,236,19,72,228,10,83,25,181,164,26,126,166,245,129,89,53,8,22,215,59,36,224,125,155,156,36,193,65,200,68,218,64,44,210,44,145,23,129,228,255,114,106,190,101,243,
+212,44,143,141,112,34,250,149,209,216,154,201,215,235,97,131,139,32,177,91,135,188,97,98,242,190,100,94,238,67,15,159,160,111,205,112,33,188,224,40,15,102,38,49,17,185,9,134,87,124,58,17,148,61,85,217,211,51,249,18,7,234,56,16,14,44,241,117,48,22,144,
+248,234,162,30,61,137,185,209,212,207,123,201,188,140,198,204,51,124,230,114,101,57,222,228,156,8,34,106,175,183,230,114,252,76,119,33,236,121,241,53,236,243,200,77,171,125,170,185,87,116,38,172,135,49,116,18,253,196,43,213,135,56,180,253,40,93,144,215,
+53,239,35,157,119,209,236,40,162,78,64,85,114,37,225,236,92,174,36,139,14,255,204,84,6,251,222,219,31,146,237,17,159,4,61,30,153,206,22,229,119,243,249,150,239,27,45,3,197,248,11,17,189,198,15,179,191,63,40,81,191,247,74,32,21,39,169,24,8,135,126,77,
+110,223,208,26,19,190,93,90,38,180,59,232,149,219,18,65,25,12,94,253,117,98,24,225,111,147,121,199,191,217,137,90,225,156,141,190,61,176,80,210,59,179,7,215,132,47,236,136,73,212,191,54,147,0,253,199,208,171,236,181,139,25,237,23,199,110,228,214,195,
+86,82,135,96,209,208,165,172,28,216,26,174,251,239,96,93,245,63,38,217,106,132,200,45,62,200,20,165,127,114,177,225,48,93,126,166,245,134,253,239,20,3,196,142,213,104,61,140,195,29,124,161,21,221,115,147,105,109,247,203,167,51,69,185,203,198,227,89,249,
+64,178,26,60,69,219,18,100,164,39,75,75,114,33,87,146,51,154,189,55,48,175,232,142,193,112,205,181,1,25,187,175,95,206,26,247,118,39,51,14,38,231,54,247,7,236,185,254,91,175,49,146,232,82,56,33,189,127,48,44,55,15,132,234,62,1,44,78,127,63,147,213,230,
+132,27,23,173,187,7,195,114,77,196,127,229,67,141,15,243,7,11,121,6,189,72,30,223,30,179,204,234,169,120,126,44,229,248,27,64,179,240,57,121,124,87,194,114,104,214,139,227,105,102,56,17,117,200,129,104,64,110,78,4,175,92,179,112,191,62,155,46,200,207,
+166,51,60,224,37,114,33,12,129,58,216,31,146,225,136,207,184,255,166,139,75,114,54,85,144,151,102,178,252,76,19,117,0,246,201,127,187,59,81,19,8,90,239,189,217,156,252,248,162,253,1,247,110,241,228,181,113,35,81,196,10,174,89,255,122,106,158,111,213,
+46,134,61,228,195,195,209,186,239,23,196,92,94,190,184,168,69,192,248,203,35,189,150,67,30,117,191,46,168,96,160,216,197,84,47,252,199,47,101,229,197,203,238,25,50,88,207,67,91,194,13,51,176,100,181,172,15,25,27,186,157,118,201,234,105,56,74,34,66,222,
+30,153,43,46,105,27,224,220,40,188,78,71,70,227,150,1,82,148,155,61,51,145,114,195,83,106,138,202,205,79,184,32,164,46,130,150,30,204,214,38,34,34,234,30,168,134,190,107,40,162,244,124,127,120,38,169,229,30,82,108,236,143,116,126,13,54,2,135,128,251,
+162,254,43,149,219,168,74,253,40,85,212,46,217,70,229,125,130,164,134,23,38,210,174,142,69,124,113,91,164,97,146,229,122,175,76,46,118,117,50,34,71,91,186,20,2,167,42,65,98,64,128,245,108,182,228,218,15,53,110,244,102,65,98,64,207,41,148,22,253,219,153,
+164,54,153,27,184,96,223,183,173,183,230,247,252,112,121,89,78,204,230,92,31,252,111,53,44,110,142,142,45,152,222,228,112,26,250,156,230,37,160,187,170,122,18,155,65,134,5,22,63,60,120,32,29,33,56,124,247,80,68,194,171,61,159,31,92,157,68,143,12,1,244,
+131,38,34,234,22,232,163,251,240,72,109,150,24,214,68,149,126,135,68,186,217,163,184,30,134,143,71,3,114,38,175,231,218,160,178,63,250,220,72,244,74,143,230,106,72,28,249,201,120,138,65,226,117,144,145,254,165,145,104,77,181,234,176,172,180,241,187,51,
+87,150,231,38,82,90,204,125,193,115,85,57,76,192,247,31,222,30,149,217,179,73,87,62,111,100,76,171,6,137,225,175,182,69,228,157,84,161,107,171,130,188,91,62,243,196,55,29,240,115,144,77,255,203,142,152,120,61,230,31,230,106,81,143,71,222,117,97,70,21,
+62,208,95,184,54,166,244,88,92,188,98,61,61,242,231,69,247,7,190,208,55,231,127,190,54,38,209,64,109,185,20,126,239,215,244,250,229,150,104,64,222,95,40,72,145,53,1,87,204,151,151,229,157,249,188,241,62,240,247,244,24,65,34,156,126,78,44,150,228,248,
+108,78,126,114,49,163,245,235,133,207,203,29,91,204,15,85,170,101,11,75,242,151,172,189,254,206,68,78,135,32,241,131,219,163,226,95,119,143,244,244,244,200,112,196,111,4,77,222,79,243,128,132,136,244,135,235,221,19,123,18,18,15,214,6,136,176,198,252,
+171,129,144,252,127,151,217,99,151,244,243,215,67,17,229,189,242,100,166,164,245,122,24,251,35,12,187,90,204,149,101,33,95,54,158,47,190,254,188,80,144,163,147,139,198,247,105,173,255,125,103,194,52,41,15,123,204,125,177,128,156,72,230,93,191,183,60,
+220,23,146,93,49,181,131,21,124,166,98,222,30,87,174,163,15,247,135,140,24,138,42,60,87,236,149,207,119,233,33,10,51,138,93,8,89,128,86,39,62,235,169,246,110,117,154,155,108,156,6,131,81,114,239,242,126,50,8,246,225,4,203,10,78,133,209,163,186,219,251,
+231,172,135,83,63,190,38,106,56,13,153,116,244,192,53,81,211,103,181,175,47,40,251,146,121,99,136,45,17,145,206,144,73,108,22,44,195,247,208,202,142,153,197,164,155,194,210,178,237,253,178,238,140,118,9,156,173,105,9,149,219,245,178,175,215,67,117,230,
+231,135,34,242,236,228,162,147,126,124,219,236,100,223,3,230,69,185,209,246,38,126,238,132,207,188,199,185,206,186,247,153,147,43,216,189,112,97,65,112,163,75,47,94,21,24,216,167,186,176,65,249,196,176,197,144,6,234,30,40,3,42,216,200,10,152,100,153,
+25,105,230,200,112,175,244,40,92,62,63,59,210,203,95,61,17,105,79,165,77,157,106,43,59,34,55,153,205,169,175,113,147,37,247,183,15,160,214,65,66,129,42,36,169,245,218,168,242,118,34,187,247,0,171,1,145,164,7,254,150,137,28,198,238,41,221,117,46,15,140,
+83,107,157,85,28,174,144,230,96,68,210,80,194,111,157,1,2,65,47,151,63,68,164,183,131,138,165,196,68,58,122,107,78,173,165,10,18,44,222,225,192,91,90,133,4,44,187,129,208,157,33,30,182,145,126,248,174,238,18,118,178,12,169,179,236,222,156,186,185,36,
+130,106,253,108,58,35,95,143,6,44,179,210,143,77,119,103,123,14,12,137,188,45,17,92,51,189,248,68,178,192,160,57,17,17,17,185,26,50,27,209,150,174,178,198,129,137,76,81,94,157,203,117,221,64,38,172,235,246,39,243,43,109,9,77,188,118,49,211,181,195,170,
+168,214,128,98,194,129,78,230,114,101,165,86,27,21,110,141,43,157,78,23,108,103,79,79,119,113,245,45,35,76,46,132,27,95,218,230,164,73,213,44,67,167,153,201,219,239,33,121,46,199,190,147,212,189,176,216,197,116,227,70,215,8,220,220,95,153,92,92,233,83,
+214,101,190,184,45,34,143,237,78,172,180,108,233,245,25,95,216,64,60,58,26,147,47,179,21,129,22,146,69,181,5,93,190,204,50,83,34,210,219,91,204,146,236,42,56,8,255,250,117,125,107,214,56,248,58,176,53,108,252,249,238,58,3,13,117,135,222,177,239,205,214,
+207,44,198,122,248,197,241,180,188,158,204,119,251,91,135,170,204,42,174,35,117,50,97,51,89,198,173,113,165,247,109,254,220,216,75,119,227,126,185,130,25,197,46,245,199,217,156,220,53,100,61,240,172,226,213,153,172,43,159,232,27,115,57,99,193,163,234,
+195,100,222,245,167,194,184,40,217,201,42,102,95,45,90,239,76,190,44,255,122,106,94,14,37,130,178,23,217,197,171,189,179,112,146,138,155,228,148,205,131,38,29,220,219,31,50,189,150,32,96,252,229,213,77,5,185,215,177,153,172,82,111,185,19,115,220,24,18,
+145,254,102,115,37,25,176,40,139,158,90,100,130,133,219,161,92,254,200,104,188,97,53,25,254,28,223,127,230,108,178,235,214,128,24,112,141,253,36,6,164,7,87,215,195,216,59,161,221,4,51,137,105,61,124,62,236,238,197,221,158,164,134,207,7,246,65,170,51,
+146,220,26,87,194,239,246,55,211,25,229,24,90,183,86,223,86,120,183,124,230,137,111,58,227,71,33,59,206,228,74,50,226,247,200,22,133,158,56,200,30,252,83,198,157,23,176,244,210,178,108,241,244,200,182,176,245,243,196,201,240,127,191,144,54,254,29,55,
+27,240,244,200,53,189,106,125,135,241,156,127,58,181,40,69,174,115,168,142,243,249,178,188,155,42,200,31,22,242,198,23,174,27,110,255,124,52,3,165,152,95,216,17,51,157,252,14,184,158,158,79,21,100,158,173,122,92,11,239,239,62,108,154,77,122,183,35,112,
+242,236,20,15,4,136,72,127,231,211,69,185,173,47,40,158,6,83,62,203,75,203,242,236,249,84,87,174,13,116,242,185,161,136,229,94,9,107,160,152,183,71,222,79,119,95,171,45,188,191,177,6,254,75,118,229,11,235,99,238,157,168,17,59,123,113,36,169,189,237,242,
+234,13,227,250,95,94,150,221,10,125,237,221,28,87,146,213,24,154,74,108,9,207,243,205,46,175,202,97,160,216,197,112,163,55,123,163,35,136,248,203,11,238,127,147,255,121,177,104,25,20,199,115,69,185,253,120,193,253,167,228,23,242,101,217,31,87,59,213,
+123,243,82,86,78,102,153,9,66,100,230,250,176,95,246,247,171,77,48,46,150,150,141,77,4,185,215,201,76,73,252,229,101,185,38,226,91,19,28,89,94,22,25,75,23,228,191,156,79,241,183,75,68,93,1,1,128,191,36,11,178,59,226,147,240,186,153,22,56,52,251,209,185,
+148,76,177,50,205,245,62,63,18,181,60,12,151,213,65,174,191,85,28,242,70,212,173,176,15,184,37,26,168,185,102,174,135,204,227,255,119,60,173,197,161,3,14,79,102,50,37,25,141,248,235,198,32,116,137,43,201,106,108,9,207,53,234,241,72,98,93,75,30,4,254,
+127,62,185,40,127,92,228,236,154,158,235,191,245,26,207,211,92,14,229,70,40,167,217,129,15,182,167,199,24,206,52,158,41,105,87,82,115,99,196,47,7,251,67,50,26,187,122,194,135,11,244,201,249,188,118,67,26,208,71,204,172,132,76,86,47,100,44,147,39,178,
+246,208,150,176,209,163,79,197,241,75,89,121,241,178,59,75,170,168,214,190,176,79,118,132,124,178,80,90,98,191,78,34,234,122,7,87,51,198,120,61,212,203,63,126,108,64,249,249,252,211,159,103,187,253,229,34,178,132,106,196,47,141,68,215,196,29,170,161,
+101,207,143,38,82,90,182,47,57,16,13,200,80,85,0,21,173,90,116,238,229,141,184,75,118,105,185,43,91,51,154,97,143,98,13,224,77,61,133,211,97,205,79,136,49,196,239,3,155,205,214,221,10,61,102,191,115,106,94,62,63,20,145,93,232,49,91,21,48,198,100,210,
+55,102,178,93,221,92,157,200,14,246,241,238,94,168,184,96,213,5,17,209,10,6,136,187,91,129,173,181,136,148,32,0,252,204,68,202,72,84,219,23,245,203,96,112,37,108,134,132,188,143,82,69,173,247,225,198,115,75,59,224,7,105,19,196,93,168,22,3,197,68,14,133,
+27,212,74,198,240,162,113,210,21,246,122,140,102,249,28,188,64,100,207,5,27,67,38,24,84,38,34,34,34,55,25,75,21,27,102,62,86,155,114,113,111,81,162,78,232,166,68,53,162,106,234,227,28,137,168,99,112,210,133,155,20,131,196,68,246,225,243,163,50,213,29,
+173,108,116,46,173,34,34,34,34,253,188,165,88,85,170,250,56,34,34,234,110,204,40,38,34,34,237,161,143,216,215,175,235,107,216,247,27,229,152,63,25,231,144,51,187,208,195,237,182,88,64,18,171,3,63,144,145,173,91,127,124,34,34,218,60,152,181,114,123,252,
+234,192,217,179,217,18,51,248,108,194,235,181,235,82,214,116,30,3,166,248,243,117,37,34,34,21,28,102,71,68,68,93,1,65,77,244,253,190,33,17,92,243,116,145,109,252,242,197,69,246,168,178,9,125,219,30,222,30,173,9,190,35,232,254,194,68,154,27,82,34,34,50,
+245,197,109,17,185,121,32,84,243,16,157,7,69,109,38,12,161,186,115,48,44,253,161,171,131,168,56,219,132,136,136,236,98,160,152,136,136,186,10,2,198,59,67,43,5,53,179,197,50,167,220,54,1,125,211,143,140,198,77,51,180,143,142,45,48,248,78,68,68,117,61,
+180,37,108,154,1,139,96,241,211,231,23,248,226,53,9,135,185,60,176,37,34,162,102,184,166,245,68,101,99,191,43,188,242,35,179,44,137,200,217,14,198,2,114,91,223,213,44,145,100,177,44,199,102,178,50,197,97,97,212,97,200,80,226,253,99,99,14,15,70,26,6,137,
+1,223,195,99,206,76,176,157,7,17,17,173,133,125,221,254,58,153,196,213,134,123,125,70,134,44,51,97,155,195,117,14,57,197,190,176,79,238,27,138,72,34,224,21,175,167,71,150,151,49,23,164,44,39,230,242,242,107,246,205,38,114,156,67,137,160,59,2,197,56,113,
+198,98,162,122,83,122,64,68,30,46,47,203,137,217,156,188,120,57,219,209,159,143,136,174,26,246,121,228,177,93,113,9,251,214,206,202,28,22,159,236,235,11,202,201,249,188,28,157,90,228,43,70,228,98,42,211,213,85,30,67,212,13,112,95,188,41,22,48,158,41,
+55,197,68,98,36,255,152,29,54,86,140,70,124,12,20,19,185,216,145,225,94,99,255,87,173,167,71,36,22,240,202,93,67,17,249,88,34,32,223,61,203,202,1,34,39,192,204,128,47,109,143,25,237,139,28,29,40,198,105,243,215,70,227,107,250,44,85,195,2,3,37,75,123,
+98,1,249,254,216,2,251,88,17,117,24,54,195,79,236,73,24,167,197,141,96,177,112,68,132,193,98,34,34,210,26,178,168,62,59,210,107,108,136,43,176,49,70,73,253,11,147,105,86,216,80,215,170,84,136,90,25,12,114,238,58,145,91,221,219,31,170,9,18,175,55,16,242,
+201,147,215,198,217,102,134,168,195,16,123,125,124,87,226,202,33,174,199,201,191,144,47,141,68,27,6,137,171,225,49,120,44,17,117,214,195,35,81,211,32,113,5,22,13,251,20,55,9,68,68,68,245,32,243,1,125,56,241,133,255,239,36,184,199,29,217,25,95,19,36,174,
+64,73,61,14,85,157,166,250,245,36,218,76,104,33,168,98,130,237,19,136,92,235,206,109,17,165,31,29,247,196,97,159,163,195,82,68,218,195,192,247,234,74,31,199,70,106,176,72,181,83,182,138,199,178,105,63,81,103,225,70,175,234,83,3,33,57,57,145,214,246,55,
+86,93,106,188,80,90,146,183,82,44,157,36,125,124,152,204,203,13,9,243,44,17,60,134,104,51,32,235,1,11,218,245,239,65,35,83,119,42,237,136,1,149,95,216,17,51,253,62,14,85,157,146,69,133,225,148,247,109,235,93,115,15,103,123,55,218,76,231,114,37,99,232,
+169,85,251,9,213,128,50,145,27,96,126,203,199,227,1,9,122,60,50,157,45,202,239,230,243,218,86,150,224,185,246,88,231,14,93,113,120,48,204,106,83,162,14,65,162,192,250,53,181,99,3,197,251,19,1,219,255,206,190,40,3,197,68,157,114,48,102,239,51,59,162,105,
+198,18,2,196,95,25,141,213,100,145,61,176,44,242,199,203,89,249,233,12,55,221,228,126,175,206,100,101,87,52,208,112,147,143,0,192,171,124,175,211,38,48,107,75,134,64,39,202,230,158,57,155,236,104,176,24,247,67,149,254,171,118,14,87,55,11,130,196,71,70,
+227,53,63,111,165,189,91,44,224,145,103,39,185,121,167,214,66,187,192,215,46,102,228,158,145,222,134,255,93,28,54,114,95,71,58,192,61,225,158,225,222,53,215,89,92,255,111,29,12,27,7,156,58,182,93,136,219,204,16,78,248,173,171,200,137,104,115,108,175,
+211,230,201,177,57,254,113,159,253,139,5,251,88,17,117,142,221,5,129,142,42,61,154,235,149,26,227,84,29,11,66,12,117,32,114,59,4,225,142,142,45,72,186,78,48,46,189,250,61,39,100,117,146,126,144,73,108,214,150,12,27,241,187,7,195,29,125,222,118,238,135,
+157,46,183,69,230,179,89,80,27,25,38,135,44,170,7,136,154,241,122,50,47,175,76,46,26,7,139,235,189,55,155,227,1,5,105,1,65,226,7,183,71,27,94,103,17,48,254,134,3,91,17,17,81,247,24,10,214,174,171,25,89,37,162,150,24,207,217,43,15,44,47,235,55,124,242,
+177,93,113,203,30,205,232,207,124,111,190,204,201,247,228,122,103,242,101,249,215,83,243,114,32,26,184,178,192,152,206,151,57,161,158,54,149,85,203,19,89,125,76,239,116,134,67,142,45,160,101,91,84,161,183,243,141,241,160,17,212,35,106,53,188,175,222,
+73,21,228,99,17,191,113,31,201,47,45,203,251,233,2,15,26,73,27,247,40,36,136,32,193,4,131,223,116,218,27,44,216,108,169,145,95,226,103,158,200,73,24,40,38,162,150,56,153,45,9,98,191,170,253,168,198,210,122,149,19,98,112,81,88,49,51,236,19,91,244,90,12,
+82,119,51,2,195,250,182,27,39,7,217,93,39,227,161,145,157,33,95,199,202,214,237,108,144,59,217,159,114,151,226,80,217,1,133,193,210,68,205,194,129,14,239,35,164,35,213,54,68,162,225,222,0,179,89,30,176,177,47,124,115,150,251,34,162,78,193,60,128,3,235,
+254,110,199,6,138,103,242,37,219,189,219,56,25,151,168,179,208,131,247,86,133,146,95,4,148,117,27,88,112,171,141,210,92,213,128,50,17,81,39,160,69,206,53,17,159,4,189,30,201,151,151,228,66,166,228,136,107,118,214,37,25,194,216,32,255,245,210,178,101,
+133,201,172,205,74,156,86,203,187,48,227,186,250,189,57,155,43,203,59,243,57,14,139,37,34,71,194,224,58,85,58,238,13,222,184,152,145,187,134,34,150,143,67,159,230,147,28,92,73,212,49,72,172,120,120,221,128,89,199,94,145,222,104,226,68,237,15,11,44,139,
+35,234,36,12,106,75,21,202,150,63,193,47,47,232,151,54,194,33,12,68,228,118,232,151,251,247,55,244,27,45,114,80,10,139,5,35,254,23,255,140,63,239,116,63,93,148,163,215,235,103,90,79,167,135,96,253,202,162,191,106,121,105,89,158,31,239,236,189,240,180,
+226,107,52,149,233,252,6,30,153,121,255,176,111,96,205,123,19,9,37,232,253,249,119,187,226,29,255,249,136,136,214,11,122,186,59,49,4,25,210,39,231,205,227,51,216,55,234,56,204,143,200,109,126,191,110,8,185,99,51,138,177,25,56,126,41,107,76,92,86,129,
+199,178,159,21,81,231,61,117,58,41,127,179,61,42,163,209,64,77,185,17,54,248,63,25,79,105,121,106,156,44,150,101,88,241,146,170,97,123,230,134,30,25,12,203,13,125,193,43,153,18,120,15,156,73,21,180,203,40,39,210,193,227,187,19,13,179,96,241,231,248,254,
+63,255,101,174,163,207,244,196,108,206,114,109,248,158,3,74,88,141,44,215,137,116,205,164,123,89,221,24,255,251,88,170,163,109,39,100,181,207,56,50,185,172,42,248,222,234,112,57,52,14,40,16,16,110,100,32,228,147,39,175,141,51,216,64,228,48,56,224,185,
+123,40,178,38,91,54,91,90,146,87,167,51,93,81,9,48,157,45,42,87,72,151,53,237,169,143,245,254,190,100,94,62,59,210,187,102,216,55,222,7,111,95,206,177,21,31,145,67,224,179,56,24,242,94,153,5,226,232,30,197,47,94,206,74,44,224,177,28,92,242,97,50,111,
+60,150,136,156,225,7,19,43,89,82,24,204,80,129,97,119,58,151,21,189,155,204,27,153,78,42,210,69,235,172,107,29,96,138,115,245,162,16,16,48,49,178,19,227,1,249,222,233,100,199,3,37,68,180,2,215,107,171,94,138,81,165,33,105,0,0,32,0,73,68,65,84,248,62,
+14,127,126,58,211,185,53,23,214,123,123,98,1,233,111,208,55,119,46,87,150,151,58,248,243,85,67,32,4,95,232,97,191,35,180,178,228,126,63,85,112,212,117,239,229,139,139,114,100,52,222,240,119,143,160,123,167,179,179,239,87,40,93,70,48,6,1,101,222,83,136,
+156,1,109,98,234,173,139,195,171,7,63,187,231,243,218,39,13,252,110,62,175,212,146,15,46,101,245,221,27,96,255,119,242,116,210,1,63,9,17,153,121,118,114,81,238,205,149,229,147,131,97,231,15,179,195,15,123,32,85,148,59,7,195,53,155,2,100,65,188,126,57,
+219,241,5,172,25,44,90,15,15,134,175,148,165,35,235,16,1,37,157,2,102,216,52,14,133,253,210,235,239,145,197,226,178,241,28,143,205,100,181,92,172,87,111,246,48,172,134,125,241,204,117,211,41,49,62,211,232,55,57,16,178,190,172,254,220,162,36,89,7,200,
+238,90,31,36,174,134,236,196,199,118,197,229,95,62,154,215,254,181,32,114,131,61,81,181,94,138,184,223,139,116,54,16,251,157,179,73,121,104,75,216,8,66,68,253,87,171,21,144,109,252,234,92,206,24,142,229,36,198,38,217,161,235,62,100,21,127,231,212,188,
+124,126,40,34,187,162,87,7,47,33,224,254,198,76,118,101,200,88,135,141,68,252,74,63,192,77,177,128,76,49,59,141,168,227,176,95,178,74,158,192,247,247,105,182,39,94,15,123,97,149,170,13,120,97,146,211,28,105,5,62,63,159,26,8,201,182,176,79,188,61,61,70,
+130,209,249,116,177,163,135,244,155,1,9,10,24,226,88,93,113,128,204,250,241,197,226,149,164,51,55,67,28,240,225,145,168,108,13,123,215,84,235,57,61,155,30,63,215,111,147,121,233,185,254,91,175,185,166,206,161,215,211,99,76,177,134,115,185,146,227,54,
+2,235,33,80,210,232,198,128,128,18,122,211,185,57,152,138,114,162,191,30,233,109,88,166,122,82,163,147,98,60,215,122,229,163,104,33,128,1,110,186,93,184,169,57,184,33,160,52,219,44,43,79,167,207,69,35,120,29,158,220,219,167,244,216,95,76,164,121,224,
+66,228,0,102,107,150,106,88,224,242,128,135,218,233,63,95,223,111,153,237,14,191,153,206,176,140,153,200,1,234,85,148,213,131,54,60,79,117,65,166,169,213,235,193,181,48,85,152,173,197,140,217,6,231,245,104,225,136,217,2,102,201,85,120,174,110,174,60,
+69,236,232,129,107,162,53,109,56,171,33,30,248,221,179,206,109,153,229,248,140,226,106,8,12,59,57,123,184,154,213,162,22,31,140,39,246,36,92,251,1,192,155,223,172,95,156,172,158,20,31,89,237,77,228,102,141,74,167,0,31,126,148,20,237,137,7,186,98,161,
+67,230,240,89,70,255,78,220,228,135,34,190,53,55,135,110,234,201,134,172,46,85,183,245,133,184,56,86,128,224,251,87,70,99,53,253,221,186,229,61,69,206,145,204,179,180,159,136,244,134,181,255,222,120,224,74,50,12,18,67,208,234,144,243,21,212,68,21,7,60,
+171,62,206,237,176,71,92,159,61,137,64,24,218,77,32,147,152,45,115,72,20,130,167,184,30,29,217,25,151,167,63,154,119,245,123,6,251,100,171,10,92,60,87,196,202,190,253,97,103,231,98,52,195,106,174,66,133,211,231,43,184,42,80,236,22,248,133,171,100,62,
+224,3,128,141,191,27,3,140,56,33,81,129,0,235,193,197,162,107,3,25,42,165,83,128,224,77,167,251,54,146,115,112,160,14,181,18,174,67,88,24,174,87,233,243,55,50,195,170,6,218,184,119,230,115,242,96,175,245,189,29,143,35,106,39,12,64,85,89,139,49,155,152,
+90,161,94,246,39,14,254,241,30,252,70,196,199,196,16,5,102,89,116,213,84,31,167,3,92,159,120,141,162,70,112,144,160,210,190,16,220,26,63,146,213,61,141,234,128,71,35,48,62,220,235,186,3,58,252,126,84,225,181,192,107,226,196,44,113,143,194,99,200,6,156,
+32,168,190,249,101,53,192,136,55,135,155,224,3,107,231,198,126,200,98,58,185,147,97,66,171,170,91,182,184,247,121,18,145,115,125,97,135,249,130,3,85,13,195,62,222,206,105,99,112,160,139,50,56,51,40,19,102,6,59,181,27,54,137,101,139,118,115,104,235,68,
+180,81,8,214,152,181,8,192,247,176,15,34,115,86,159,215,10,213,199,17,233,110,127,191,218,64,116,113,105,252,168,2,189,151,237,64,101,135,219,168,180,221,217,200,107,210,46,220,89,182,216,97,197,201,166,213,14,15,90,79,115,118,146,107,34,246,46,76,118,
+63,44,78,98,231,103,71,240,252,160,141,146,123,34,93,189,111,35,144,196,236,68,115,88,8,170,84,168,52,115,239,161,206,24,246,123,140,96,4,134,177,225,107,119,208,57,247,72,244,74,107,20,44,198,159,51,147,142,58,5,173,218,48,176,176,30,167,245,254,199,
+103,186,242,249,62,160,56,36,146,156,1,173,1,44,127,191,92,235,91,74,22,202,45,125,28,145,238,236,182,97,217,215,171,54,228,213,105,182,217,12,112,55,154,133,229,84,88,223,219,165,58,176,183,221,216,122,162,197,18,77,244,90,234,245,187,235,3,16,244,242,
+124,161,145,56,179,250,136,148,167,60,163,199,46,179,19,205,237,80,44,67,107,230,222,67,237,103,4,142,214,85,217,224,159,199,82,69,121,110,50,237,136,33,189,8,22,87,38,110,7,61,30,201,47,45,201,155,179,57,173,39,211,147,243,85,102,0,224,64,30,189,237,
+33,89,44,203,177,153,172,99,122,53,98,232,246,87,183,199,106,238,125,135,139,75,242,203,201,69,215,204,89,233,102,94,133,146,73,149,195,219,110,135,129,237,42,67,141,241,56,34,178,223,134,101,40,140,224,162,251,218,206,169,92,99,201,25,24,40,38,34,162,
+150,67,159,102,179,41,207,40,55,252,161,131,39,189,18,181,26,178,12,214,7,137,43,70,99,126,249,146,68,229,153,137,148,35,94,119,4,133,79,78,112,3,79,206,131,195,69,39,30,48,34,72,252,181,209,184,244,135,106,239,121,81,191,71,30,29,141,73,246,76,82,206,
+228,153,65,73,250,195,225,205,47,38,210,166,3,157,240,125,14,113,35,90,129,129,153,118,98,168,211,89,119,30,60,166,139,101,25,240,50,4,233,6,76,127,108,49,100,55,216,181,88,116,87,127,166,217,156,189,231,232,230,254,83,203,54,127,244,113,139,254,142,
+68,221,4,101,234,239,206,100,141,204,225,10,148,14,163,76,24,83,108,185,65,176,166,218,198,195,173,11,198,110,129,32,210,39,45,218,131,32,88,124,163,67,203,207,136,200,220,167,19,193,186,65,226,106,247,109,99,111,91,167,203,151,173,215,37,89,174,93,148,
+224,64,231,233,143,230,229,92,170,96,172,253,42,95,231,86,255,156,21,101,68,87,165,109,198,144,78,46,186,115,221,127,62,109,239,231,78,185,172,61,77,51,3,43,39,29,90,109,196,112,126,139,161,4,78,101,50,115,53,183,245,232,60,54,147,145,35,189,181,19,248,
+27,185,148,117,111,246,196,92,190,164,60,129,212,8,128,177,52,151,104,141,159,206,100,69,102,220,87,26,229,20,8,166,163,55,172,217,117,8,135,113,63,229,107,236,104,31,139,248,149,202,149,247,69,253,44,79,39,114,161,61,10,189,136,209,146,2,135,70,78,104,
+49,67,245,253,124,114,81,142,236,52,223,227,188,58,157,225,171,167,8,107,152,31,176,58,133,200,210,137,185,188,220,53,164,54,183,10,193,83,183,198,28,176,95,185,121,32,164,220,123,248,245,75,238,219,223,224,247,99,103,206,21,218,187,57,17,51,138,91,172,
+178,169,87,133,224,162,219,78,84,113,97,82,125,142,8,96,188,48,233,222,5,130,157,222,89,191,103,160,134,136,54,1,174,67,141,134,56,161,234,225,87,147,206,25,226,68,245,13,41,14,172,27,12,242,252,158,72,103,59,21,147,15,168,51,140,182,59,243,249,134,127,
+55,190,199,76,88,34,106,53,100,162,98,190,139,138,127,31,115,70,155,178,102,169,238,91,220,122,189,197,239,71,181,42,29,21,22,78,13,250,123,183,124,230,137,111,58,224,231,208,10,82,234,111,235,11,138,199,162,209,12,130,168,255,245,76,82,210,46,204,44,
+120,107,62,47,183,199,3,166,131,237,240,1,121,105,114,81,62,116,113,59,6,252,110,178,249,178,236,141,155,103,138,224,66,246,51,6,138,137,104,19,224,58,244,250,108,78,134,125,30,233,245,121,140,107,43,226,198,227,139,69,249,111,231,83,174,190,198,118,
+139,184,215,35,215,91,220,71,224,108,186,32,127,118,105,57,33,81,55,59,144,8,74,52,96,157,127,243,250,76,214,149,235,254,110,242,126,186,40,211,139,69,25,9,121,141,193,75,184,223,38,11,101,121,97,34,45,199,76,130,200,68,68,27,241,135,133,188,236,10,122,
+165,175,65,114,1,146,70,158,63,159,146,115,46,107,199,176,222,133,66,217,136,175,236,142,250,27,198,203,16,91,57,58,229,206,68,24,35,126,84,48,127,126,128,131,129,239,143,59,55,232,223,115,253,183,94,227,106,101,19,96,67,255,232,142,104,195,114,97,244,
+183,194,32,39,183,247,232,60,50,220,107,4,81,215,151,15,224,141,143,76,98,93,122,144,226,247,249,149,209,88,77,25,1,74,11,80,18,193,236,2,34,34,106,4,229,230,95,191,174,207,178,253,196,139,227,105,57,158,230,253,132,200,109,30,218,18,110,56,172,178,34,
+93,92,146,127,61,53,207,223,45,17,17,53,132,184,195,253,67,17,25,8,122,141,164,60,204,135,58,157,46,52,213,255,214,233,30,25,12,203,80,248,234,124,14,204,251,66,43,87,29,98,72,149,223,227,142,94,255,154,88,25,226,71,104,53,226,244,223,39,3,197,155,108,
+95,216,39,159,26,8,73,208,115,53,203,0,61,137,117,12,44,98,162,59,134,185,177,79,47,17,17,209,90,86,129,36,28,176,62,125,126,129,175,26,145,11,225,48,232,111,119,39,36,234,111,156,85,252,252,88,138,61,200,137,136,136,200,241,24,40,38,34,34,34,106,131,
+47,110,139,24,67,60,214,67,144,248,71,19,41,14,185,34,114,177,221,65,175,124,110,36,42,253,161,181,213,103,40,23,126,237,98,70,94,79,178,109,1,17,17,17,57,31,3,197,68,68,68,68,109,50,236,247,200,77,209,128,4,87,203,208,254,148,46,200,153,188,187,251,
+205,17,209,85,7,162,129,43,3,44,243,75,203,242,219,100,158,135,64,68,68,68,228,26,28,189,75,212,37,144,233,18,246,122,36,91,94,98,80,130,136,168,67,166,138,75,50,165,97,159,57,34,90,97,244,25,79,243,197,32,34,234,164,245,7,243,201,210,146,188,147,42,
+240,224,142,72,1,3,197,68,154,67,239,232,91,6,66,107,250,230,97,160,10,166,137,190,120,57,203,95,63,17,17,17,17,17,17,105,161,209,92,136,191,218,22,97,43,32,34,5,12,20,19,105,236,203,35,189,114,67,34,88,243,4,17,52,198,205,51,22,240,200,179,147,139,124,
+11,16,145,54,112,56,182,191,63,104,76,138,134,201,76,81,94,154,206,104,49,65,153,136,104,35,42,83,216,71,34,43,83,230,49,77,255,216,76,134,131,168,137,72,27,141,246,191,16,240,246,200,61,35,189,198,255,103,176,152,168,49,246,40,38,210,148,213,132,253,
+138,227,151,178,90,102,22,163,220,232,246,248,213,69,194,116,190,188,82,14,74,68,218,250,198,158,132,196,2,222,186,79,239,23,19,105,121,43,197,107,0,17,117,167,131,177,128,60,184,61,90,247,185,163,202,236,232,20,19,7,136,116,117,99,196,47,251,19,1,137,
+251,86,214,72,51,249,146,188,49,151,51,218,97,233,4,61,226,31,218,81,255,58,183,222,211,167,230,181,123,254,68,173,194,140,98,34,13,245,122,122,100,127,157,201,250,245,32,152,252,234,92,78,155,126,77,120,238,159,31,138,212,61,73,62,92,92,146,159,140,
+167,216,163,153,72,67,79,94,27,111,24,36,134,7,174,137,202,121,108,10,152,89,76,68,93,102,95,216,215,48,72,12,251,250,130,114,111,190,44,191,102,255,116,34,173,96,95,244,165,145,168,140,198,252,107,158,214,112,175,79,110,30,8,201,43,147,139,90,101,214,
+222,220,32,147,184,30,36,20,177,13,35,81,125,30,190,46,68,250,217,25,242,25,165,53,170,62,22,241,107,243,26,124,117,123,172,97,185,17,90,110,28,25,141,27,131,253,136,72,47,216,244,152,233,233,17,57,60,104,93,101,65,68,164,155,251,134,34,150,207,232,19,
+91,212,18,12,136,200,61,234,5,137,171,161,13,195,33,27,193,85,167,51,123,174,235,109,215,104,255,75,212,106,204,40,38,210,208,136,205,64,232,16,30,175,193,132,110,44,116,172,130,69,8,160,223,183,173,87,158,62,191,208,182,159,139,220,169,210,190,100,107,
+200,39,11,197,178,92,204,151,217,207,204,161,208,151,88,197,104,148,155,2,34,234,62,81,191,245,186,48,236,99,254,144,83,33,43,244,211,137,160,4,61,43,73,32,201,210,146,188,147,42,104,83,13,72,155,3,237,38,84,2,167,24,240,198,247,19,17,85,107,89,160,24,
+195,17,144,169,179,53,228,53,22,35,249,242,146,204,230,203,28,32,67,212,1,243,54,251,45,37,53,249,140,222,24,87,59,17,71,48,25,65,64,157,251,82,97,83,129,76,241,161,213,67,131,179,217,146,124,144,41,118,252,231,114,11,28,58,84,134,93,172,88,89,104,127,
+162,63,36,223,31,91,224,98,218,165,188,61,234,149,22,68,68,68,157,134,42,56,84,195,173,175,20,188,99,48,204,118,106,54,96,221,127,83,52,112,37,216,222,13,179,75,208,147,88,5,222,91,216,51,232,240,122,164,139,75,70,5,169,138,2,215,242,68,13,181,36,80,
+252,200,96,88,110,93,87,206,25,240,122,141,94,129,79,198,2,114,46,85,144,31,76,104,144,174,72,228,18,19,121,123,211,171,47,228,244,152,118,109,149,77,92,109,192,239,213,54,80,140,65,14,247,141,244,174,217,84,28,64,143,86,246,104,86,130,215,111,109,144,
+248,170,254,144,215,104,111,194,140,116,103,25,87,188,134,97,194,63,17,81,183,41,47,35,32,98,126,80,182,204,152,137,227,12,175,182,76,171,215,78,174,210,78,237,59,167,230,121,120,109,161,209,128,239,59,115,101,249,31,147,105,109,215,197,149,193,117,42,
+116,169,46,189,144,41,54,108,65,184,222,71,28,114,78,212,208,134,107,140,142,12,247,214,4,137,215,219,25,11,24,147,200,137,168,61,16,0,157,90,84,11,156,224,113,12,28,234,3,153,176,152,246,107,182,169,96,143,102,115,119,90,220,211,112,32,113,35,251,154,
+57,202,201,108,73,10,101,235,141,242,177,153,76,87,189,46,68,68,48,150,182,174,40,154,206,232,145,52,160,147,59,251,67,166,51,71,240,189,79,107,212,95,118,51,124,113,91,164,110,144,88,86,15,255,177,46,238,245,176,218,72,23,175,206,100,149,214,131,200,
+60,102,59,57,162,198,54,20,40,198,4,93,76,201,85,129,236,226,71,56,68,134,168,109,94,152,74,91,222,40,241,125,60,78,23,170,193,113,200,150,245,203,38,198,66,23,125,198,204,84,122,52,83,99,216,56,88,217,21,102,139,127,167,65,182,188,153,147,243,121,35,
+160,76,68,212,109,142,78,45,74,170,208,56,41,160,188,180,44,47,76,178,250,211,105,6,131,214,107,141,61,81,181,246,2,221,8,25,217,55,15,152,207,48,192,186,248,243,10,195,30,221,104,198,70,133,233,89,77,214,71,72,150,122,237,162,121,82,0,246,191,86,107,
+70,162,110,183,161,64,241,103,27,148,230,54,98,117,161,38,162,214,193,141,242,232,216,130,204,53,40,181,198,159,227,251,58,181,95,248,96,65,237,100,88,215,44,106,244,23,51,203,60,169,64,70,44,179,39,72,55,8,2,31,61,183,80,19,12,65,57,245,187,51,89,35,
+80,66,68,212,173,158,58,157,172,123,160,62,155,43,201,247,240,61,206,148,33,205,220,174,56,187,100,151,166,193,246,55,230,114,74,143,67,118,173,78,115,76,144,41,252,195,51,245,175,119,31,38,243,242,204,217,36,171,105,137,44,108,40,37,10,89,194,118,120,
+61,61,198,208,59,46,68,136,218,3,55,193,239,156,77,26,101,242,213,25,144,186,14,112,192,194,0,195,198,172,50,66,95,190,168,103,192,104,200,70,75,137,157,33,31,135,219,53,160,50,8,67,151,1,144,186,65,176,248,228,233,164,241,172,238,237,15,25,189,139,153,
+69,76,68,180,162,210,95,255,96,44,32,113,159,71,126,173,24,72,162,206,88,40,149,101,216,98,187,110,39,107,148,234,83,73,178,112,35,36,3,29,191,148,109,216,122,67,52,206,174,197,30,24,215,59,36,198,96,207,3,220,247,16,169,107,123,237,236,77,177,128,76,
+113,81,66,212,86,184,49,118,203,205,241,251,99,11,198,176,177,122,131,237,176,24,122,121,114,145,167,200,100,10,45,10,172,22,213,239,164,56,0,195,233,24,0,33,34,170,239,45,222,195,92,225,68,178,96,57,152,75,53,107,148,186,211,139,151,179,146,95,90,150,
+79,14,134,107,2,226,233,46,24,114,141,65,143,12,16,19,217,199,38,139,68,164,21,44,8,112,130,140,44,234,125,81,191,209,223,173,176,180,44,227,153,162,252,54,153,215,122,50,244,180,141,133,222,185,28,51,80,26,193,162,122,79,44,80,55,51,221,232,235,61,145,
+230,132,113,34,34,34,218,84,8,112,237,50,201,8,125,101,114,81,171,22,114,173,166,90,253,149,214,252,53,196,193,57,246,64,183,197,2,146,240,173,84,204,161,39,49,3,168,68,212,72,219,3,197,239,243,4,155,136,218,160,155,178,168,43,208,78,228,176,66,219,132,
+15,53,15,152,183,2,90,182,60,180,37,124,37,96,140,0,241,217,116,193,152,166,204,77,25,17,17,17,181,3,14,175,17,212,59,216,31,146,225,200,202,214,125,42,83,146,183,230,114,12,244,89,64,75,186,59,6,195,150,235,226,223,205,100,29,240,211,110,46,172,251,
+241,122,16,17,169,216,80,160,24,3,99,236,244,41,198,70,155,253,137,137,136,54,15,74,200,142,140,198,27,246,91,195,16,195,159,77,155,79,3,166,21,216,156,201,101,253,55,15,68,68,68,228,92,221,152,252,208,42,86,235,98,36,79,48,128,74,68,180,150,119,203,
+103,158,248,102,179,175,9,2,14,55,245,169,77,19,133,55,47,101,229,12,203,157,169,197,118,7,189,114,77,208,39,91,253,94,193,177,69,154,153,146,212,197,230,203,203,114,97,177,40,219,2,62,137,6,214,102,80,96,49,124,244,2,219,38,16,17,17,17,145,254,176,46,
+62,149,42,24,251,196,68,213,208,103,180,155,248,253,76,86,94,184,196,132,0,234,94,24,246,119,184,47,36,135,183,132,229,142,190,144,236,143,5,36,234,233,145,217,226,146,20,53,218,46,14,251,61,50,26,90,137,23,101,202,203,90,61,183,205,210,115,253,183,94,
+219,208,203,116,100,184,87,246,41,4,139,103,115,37,249,238,217,133,14,63,221,238,130,15,196,237,241,160,108,143,248,141,231,173,91,159,214,3,209,128,28,30,138,212,148,19,77,45,150,228,229,139,28,88,70,132,107,192,128,127,101,81,140,158,196,12,16,83,43,
+225,26,60,180,186,233,66,31,64,12,248,227,123,140,104,173,97,159,71,238,31,138,200,200,234,90,108,50,83,148,55,103,115,114,50,203,196,9,162,106,8,88,84,247,80,253,83,186,192,181,60,181,28,18,140,46,22,151,184,94,161,174,135,117,252,125,35,189,117,179,
+237,43,51,89,220,94,201,128,153,69,135,182,132,107,134,220,235,18,47,194,94,255,166,104,64,130,158,149,223,97,43,247,99,27,14,20,195,189,253,33,185,115,91,68,122,234,87,116,24,19,228,143,78,45,110,244,175,217,20,120,243,160,231,211,104,108,53,152,138,
+246,24,26,244,125,194,239,228,174,161,72,221,239,233,240,193,71,239,208,70,131,29,42,48,224,129,165,68,68,68,173,133,77,214,23,118,196,106,14,233,112,111,57,58,182,192,141,61,209,170,71,6,195,114,235,96,253,181,138,147,215,198,68,237,214,40,96,49,150,
+42,202,115,147,172,132,34,34,106,37,196,192,30,29,141,89,254,23,127,120,38,233,218,117,253,161,68,80,238,25,233,53,125,140,91,227,69,56,88,253,252,80,68,110,72,212,38,236,98,63,134,106,9,12,177,220,136,13,181,158,168,64,59,137,99,151,179,210,135,127,
+94,238,49,74,57,240,53,145,41,202,143,199,211,242,230,130,51,7,216,125,121,164,87,254,167,161,200,154,50,20,175,167,199,248,231,27,19,65,25,241,123,228,253,180,251,130,169,8,162,126,106,91,253,32,177,172,62,71,60,191,153,76,73,46,185,112,40,19,46,108,
+247,94,99,254,161,7,100,82,163,212,136,173,40,136,136,90,3,11,147,175,237,78,72,216,87,59,24,6,247,150,143,197,131,188,238,82,91,32,139,226,83,137,160,124,188,215,47,113,175,71,22,74,206,42,147,220,23,246,201,189,215,68,27,126,127,48,228,147,233,197,
+162,92,118,216,236,14,172,177,80,154,201,242,76,106,23,28,62,62,186,51,110,220,67,214,195,158,108,119,200,47,127,88,96,226,7,17,81,171,60,102,210,183,187,218,158,104,64,126,187,193,128,99,39,96,45,243,185,29,141,215,96,21,187,99,1,57,159,42,24,45,106,
+220,194,216,139,141,198,101,71,212,95,247,39,198,189,244,218,168,127,195,177,204,13,13,179,91,239,167,198,196,80,119,244,249,65,144,184,94,4,190,26,190,255,101,17,121,118,210,61,25,31,216,56,89,101,218,86,60,48,210,43,31,156,154,111,199,143,213,82,40,
+31,80,129,139,223,157,253,33,249,241,69,14,238,34,34,106,133,187,251,67,166,11,75,124,239,238,193,176,171,238,155,228,62,95,220,22,145,155,7,66,107,126,238,251,202,203,242,242,228,162,28,79,59,35,57,225,179,22,89,44,149,199,156,60,157,108,203,207,99,
+165,94,165,0,178,82,78,204,230,86,6,123,18,109,146,251,182,153,127,86,80,50,140,77,63,135,185,17,17,109,28,174,167,235,171,2,27,193,227,176,62,112,91,86,177,106,188,8,14,15,70,228,204,68,106,83,127,158,86,66,38,113,127,200,107,249,95,68,44,243,64,170,
+216,244,186,88,237,29,162,25,124,56,172,130,196,213,47,240,141,145,250,209,122,39,66,96,84,21,62,248,40,245,114,155,245,61,102,204,108,119,209,239,142,136,200,233,84,174,169,187,92,120,95,33,247,168,23,36,150,213,67,138,135,118,68,29,179,102,11,122,173,
+151,216,42,143,105,7,36,25,28,25,141,215,108,28,241,154,34,249,224,33,27,27,46,34,187,84,214,245,187,194,45,205,109,34,34,234,90,118,175,167,31,119,217,186,30,25,183,118,226,69,149,22,180,110,128,245,154,106,28,19,238,108,208,254,76,69,87,6,138,247,39,
+236,189,217,237,62,190,147,6,131,246,62,248,67,65,235,211,8,39,217,109,243,231,85,57,109,33,34,162,214,81,41,101,35,106,6,22,200,245,130,196,213,236,100,145,208,138,7,182,213,31,102,83,129,96,241,176,98,246,17,209,102,216,26,98,160,152,136,136,172,237,
+108,226,126,225,150,53,206,117,54,147,33,16,11,235,173,211,214,73,69,87,174,250,182,218,12,166,218,125,60,109,158,139,54,123,42,167,93,216,131,153,136,200,169,10,10,189,135,231,114,28,102,71,155,67,101,129,108,39,139,100,51,149,151,173,63,43,42,143,105,
+7,149,108,26,187,155,19,162,86,186,148,43,241,245,36,34,106,129,164,205,217,8,118,31,79,155,39,81,103,70,140,149,102,2,231,210,173,129,98,187,89,166,204,74,117,14,76,61,182,19,252,157,101,192,130,136,168,101,62,82,232,115,117,58,229,204,1,182,228,126,
+205,44,144,59,229,237,203,214,195,95,84,30,227,20,110,122,237,201,93,62,84,152,56,255,39,135,244,30,39,34,114,187,83,54,251,189,219,125,124,167,217,237,103,143,121,12,83,26,39,23,102,203,205,61,183,174,92,245,77,45,218,59,149,182,251,248,78,154,201,219,
+251,89,167,93,214,152,28,78,206,171,79,62,126,203,133,83,58,137,136,156,234,245,100,222,116,83,143,108,226,87,121,221,165,77,114,54,107,189,198,41,56,100,114,245,175,231,114,146,42,52,94,99,225,123,191,118,200,103,69,229,53,83,121,237,137,154,241,234,
+76,214,244,61,248,222,108,206,117,131,148,136,136,156,10,65,81,92,87,85,224,113,110,12,162,170,28,64,86,156,117,209,65,100,51,177,187,102,239,159,93,217,83,1,193,84,59,165,137,118,131,175,157,244,198,92,206,104,112,173,210,35,18,27,122,167,76,7,183,3,
+65,136,61,177,128,101,166,55,46,16,156,144,76,68,212,90,207,78,46,202,67,133,37,217,63,16,90,115,175,193,53,247,103,211,25,163,242,131,220,233,222,254,144,124,98,75,72,194,171,217,163,8,222,252,105,46,39,63,157,201,58,226,249,224,158,254,64,113,201,116,
+90,183,147,22,252,79,157,78,202,35,131,97,163,175,178,119,181,71,92,121,105,89,62,90,40,200,209,169,197,142,255,124,21,39,102,115,70,31,226,70,240,62,112,210,122,234,96,44,32,135,182,134,175,12,3,204,151,151,228,231,147,139,114,146,193,108,87,66,16,226,
+153,179,73,121,120,56,186,102,127,134,247,221,239,103,178,142,57,80,33,34,210,197,75,51,89,99,64,181,89,60,5,177,162,31,95,204,184,242,25,227,0,18,195,181,173,98,98,184,207,188,234,144,53,174,10,196,238,238,43,47,43,207,131,177,19,48,95,175,231,250,111,
+189,214,117,59,58,52,171,126,242,186,62,229,199,63,125,106,222,85,39,41,135,18,65,185,103,164,215,244,49,248,80,28,29,91,112,237,9,61,154,114,127,117,123,172,97,192,31,167,95,110,189,176,17,17,185,197,141,171,125,75,121,40,231,126,71,134,123,101,95,95,
+253,73,202,231,82,5,249,193,68,218,17,207,17,239,185,71,71,99,117,191,135,77,205,247,199,22,120,88,97,19,214,84,95,27,141,55,220,48,190,56,158,118,76,98,129,217,251,244,221,153,172,99,14,53,168,57,216,163,13,248,87,222,135,188,175,16,17,109,174,135,182,
+132,107,18,63,16,39,194,1,242,139,151,221,125,63,221,29,244,202,145,209,120,195,160,170,91,227,97,42,177,62,89,125,126,56,132,109,54,142,217,149,129,98,89,205,154,185,107,40,98,249,184,223,76,103,92,121,146,141,55,208,95,109,139,212,253,96,160,199,239,
+79,198,83,90,148,113,97,195,184,47,234,151,193,213,129,131,19,153,162,252,97,33,175,117,159,25,34,221,13,251,60,114,120,48,44,9,191,87,146,197,178,188,155,204,51,83,140,104,19,225,51,247,228,94,243,3,116,39,173,135,176,248,63,60,24,185,50,132,13,139,
+97,100,77,32,67,134,65,226,230,32,88,124,255,96,120,77,85,26,90,175,189,124,113,209,49,235,197,125,97,159,28,217,25,55,125,204,211,31,205,203,20,7,239,16,109,26,100,244,127,60,30,144,160,199,35,211,217,34,15,103,136,52,128,117,85,216,235,49,250,217,234,
+212,234,7,135,143,119,15,134,215,100,23,99,205,136,234,51,55,87,65,126,113,91,196,168,86,107,164,21,65,240,174,13,20,139,66,176,216,173,65,226,10,44,250,111,139,5,100,71,196,39,113,159,215,104,161,49,150,41,185,178,221,4,17,117,135,70,217,98,78,202,104,
+36,210,205,223,108,143,202,206,88,192,244,89,205,230,74,242,221,179,11,252,221,83,199,168,188,79,121,175,32,218,28,56,80,124,108,87,252,74,107,162,138,229,101,145,95,94,72,203,91,28,100,75,68,212,54,72,152,60,180,37,92,211,178,9,65,112,180,211,216,104,
+226,100,87,246,40,174,64,16,248,253,116,65,110,143,7,141,30,45,21,186,100,165,226,132,4,131,135,100,3,189,73,136,136,218,5,189,60,27,149,20,35,56,128,32,178,147,250,122,18,233,2,153,97,86,162,126,243,185,0,68,155,77,229,125,170,242,24,34,178,175,94,144,
+24,122,122,68,30,220,30,149,243,204,230,39,50,18,17,97,161,180,196,195,19,218,84,104,207,84,105,209,132,160,113,171,179,193,187,58,80,44,171,3,20,140,254,43,46,239,193,66,238,130,128,215,238,216,213,18,8,12,183,185,148,45,203,11,147,105,46,178,168,107,
+221,178,165,241,48,37,64,73,180,48,80,76,212,17,24,24,70,68,68,221,7,237,38,234,5,137,171,61,186,35,202,170,19,234,74,200,182,199,251,127,32,180,54,180,246,192,178,200,31,47,179,119,62,109,190,205,232,233,223,245,129,98,162,118,194,141,228,241,221,137,
+154,222,209,152,134,142,178,129,255,112,93,159,118,229,91,56,89,221,223,31,92,51,157,252,196,92,158,83,172,105,13,124,54,122,44,6,184,226,251,216,172,240,132,158,168,181,222,153,207,201,131,189,81,211,255,230,133,12,251,132,83,103,161,31,106,163,33,198,
+21,120,47,19,81,107,161,39,177,21,86,157,208,122,232,43,255,217,145,94,137,5,174,190,55,82,133,178,252,124,114,81,155,217,35,216,191,60,177,39,97,236,229,215,195,190,229,214,193,176,244,5,189,108,137,68,174,195,250,44,162,54,250,202,104,172,225,228,77,
+89,189,161,60,112,77,212,184,233,232,224,239,118,197,141,62,224,88,32,224,121,227,11,255,31,127,246,141,61,9,190,245,232,138,107,195,106,231,150,113,77,62,27,68,78,130,195,23,108,222,26,49,134,98,48,155,159,58,12,89,89,120,47,54,146,101,169,47,209,166,
+96,75,23,178,11,213,179,24,62,90,29,36,6,252,51,254,28,223,215,1,246,246,245,130,196,213,208,62,175,210,146,130,200,45,120,213,39,106,19,100,66,174,191,89,214,131,96,241,253,38,67,22,221,226,201,107,227,53,37,56,213,240,90,32,144,172,43,156,162,99,240,
+14,94,7,124,29,180,24,192,211,237,84,55,247,239,51,8,64,180,41,158,58,157,148,169,197,218,12,31,4,144,159,57,147,228,139,78,142,128,247,98,189,67,13,12,91,252,33,203,222,137,54,5,178,249,173,176,61,145,57,36,1,97,95,128,68,25,236,127,240,255,117,73,12,
+90,15,123,158,70,51,71,42,240,125,183,239,141,176,215,83,217,219,195,39,182,48,80,76,238,194,214,19,68,109,114,91,159,250,13,98,164,106,184,162,27,97,225,99,85,30,10,8,36,227,38,171,75,249,81,5,22,128,235,131,228,40,235,190,167,188,108,108,114,217,135,
+186,62,108,244,205,14,23,16,28,224,107,71,180,121,158,62,191,96,92,191,111,90,221,188,225,96,134,159,57,114,18,188,31,113,168,129,181,195,142,213,251,197,120,174,164,221,58,130,200,73,144,205,143,57,18,102,45,194,208,86,142,234,67,246,236,250,192,233,
+64,72,228,201,88,64,78,206,231,181,171,216,57,180,213,124,230,72,197,221,67,17,87,87,129,220,154,48,15,134,87,179,234,241,77,228,52,124,199,18,181,73,34,168,254,113,51,107,79,225,6,135,7,213,22,8,98,60,214,253,217,211,213,234,5,137,43,240,123,69,31,43,
+93,51,8,54,234,249,241,180,49,216,177,30,252,249,191,143,165,92,252,236,136,68,118,7,189,198,100,98,124,245,90,148,42,118,10,2,113,232,33,143,47,6,137,201,169,16,24,174,188,79,157,28,36,30,246,123,28,253,121,39,82,133,25,42,141,160,26,133,179,71,234,
+123,100,48,108,154,93,139,239,61,98,99,223,228,6,170,89,182,110,15,158,38,216,151,155,52,198,140,98,162,54,41,53,8,128,233,168,91,111,156,40,161,50,203,136,149,213,193,133,104,45,194,161,6,181,16,148,250,246,135,115,70,57,30,178,234,17,88,71,63,202,217,
+92,89,94,152,76,119,109,208,10,153,40,123,227,129,43,61,208,16,52,127,111,54,199,41,202,46,130,0,241,231,70,162,210,31,186,122,109,196,123,251,181,139,25,121,61,201,44,44,34,221,224,51,127,223,182,222,53,213,85,8,166,189,48,149,150,169,34,15,96,220,2,
+247,223,221,177,192,149,4,14,244,193,126,251,114,174,43,131,162,200,252,92,56,183,32,247,13,69,174,12,174,43,47,47,119,237,235,161,10,153,216,86,240,24,174,233,220,39,89,44,203,48,195,105,164,41,190,179,137,218,100,54,95,86,62,97,205,50,139,203,149,84,
+219,139,184,189,181,200,102,99,16,253,42,244,178,91,127,221,64,192,24,83,148,175,141,250,229,187,236,201,233,120,200,36,60,50,26,175,169,20,193,63,223,51,210,43,185,242,178,28,79,179,247,54,145,46,16,36,174,247,153,71,208,248,127,29,141,203,191,157,73,
+202,98,23,37,15,184,85,189,251,47,50,32,49,144,121,75,208,219,149,3,62,145,189,127,146,235,14,101,72,32,49,107,215,81,129,199,224,177,28,198,233,46,239,38,243,150,189,152,43,184,183,39,183,97,253,51,81,155,188,52,157,81,254,139,112,58,239,102,167,109,
+4,61,112,26,171,139,129,144,218,65,128,219,91,139,80,123,96,66,178,217,225,18,178,215,57,69,217,249,238,31,12,155,126,230,15,107,48,188,148,136,174,66,75,173,70,159,249,168,223,35,119,243,186,237,120,104,5,96,118,255,69,112,8,125,178,137,204,196,109,
+180,86,176,243,88,167,83,13,138,186,61,120,138,131,147,122,195,85,235,113,251,222,158,186,15,3,197,68,109,130,178,121,12,44,176,130,27,142,219,75,184,240,243,55,234,53,91,109,121,89,228,152,70,165,86,170,19,159,151,153,72,68,10,84,38,36,239,239,87,31,
+164,65,157,49,24,52,15,38,32,112,68,68,250,24,141,153,87,13,109,103,85,145,227,125,92,33,152,175,219,140,13,162,86,81,13,138,234,16,60,197,252,20,171,61,47,246,255,108,207,66,110,195,221,9,81,27,161,76,205,44,88,60,155,43,25,211,188,117,240,171,73,235,
+146,60,12,198,208,169,239,236,133,140,218,64,157,180,70,89,212,180,121,188,10,245,138,65,47,111,227,58,224,160,43,34,34,231,80,169,252,178,51,164,154,186,147,157,224,160,78,129,68,99,200,168,69,114,148,46,193,83,236,99,191,119,58,105,244,160,95,15,1,
+228,223,76,103,186,178,77,13,185,31,107,102,136,218,12,55,139,225,153,172,28,30,12,95,25,250,150,95,90,146,55,103,157,61,185,219,46,163,207,214,68,90,238,25,238,173,89,112,99,136,211,43,83,139,218,245,226,66,118,244,13,137,160,101,63,178,215,47,113,96,
+5,81,183,88,40,153,15,59,193,245,144,253,74,137,244,145,46,46,153,86,10,20,248,121,119,60,84,126,89,173,229,186,105,72,53,53,15,1,196,234,161,150,245,212,11,50,186,29,246,187,247,230,203,242,201,117,237,183,176,230,249,253,76,86,171,192,56,130,197,79,
+159,95,233,221,141,94,211,104,35,50,158,43,105,181,175,167,238,227,123,242,218,184,177,137,249,40,85,228,48,21,162,54,193,13,165,27,78,23,17,8,198,23,250,184,237,8,173,44,146,22,74,75,218,14,107,192,239,21,89,210,15,110,143,54,124,12,78,208,57,172,130,
+84,32,243,124,192,107,190,185,152,204,20,249,90,58,220,137,100,193,56,64,106,228,196,44,203,17,137,116,130,251,252,129,173,225,134,207,232,45,150,32,59,30,238,191,86,3,168,85,171,200,168,187,33,128,88,111,48,98,5,90,14,86,130,140,186,65,48,184,219,90,
+46,112,143,71,186,240,254,111,95,253,63,190,185,37,228,147,235,227,1,185,37,26,144,177,197,162,164,121,66,74,68,45,116,185,180,36,103,114,37,227,235,110,251,171,149,0,0,32,0,73,68,65,84,130,98,211,127,183,194,243,155,94,44,202,104,196,183,166,45,0,6,
+54,188,117,41,43,63,211,168,39,51,109,174,133,124,89,110,178,152,166,252,223,206,167,120,207,118,184,75,197,37,41,23,151,100,119,44,80,243,131,126,152,204,203,79,46,170,15,58,37,34,231,251,75,182,36,35,126,143,108,9,213,30,244,29,191,148,149,223,44,88,
+207,171,160,206,42,151,150,101,111,188,246,154,93,129,140,227,31,79,164,121,255,37,37,191,157,203,75,31,218,149,4,188,226,95,109,53,133,125,193,7,179,57,121,102,34,205,23,145,136,28,167,231,7,207,126,176,230,14,135,114,128,239,156,154,103,25,36,17,17,
+81,135,161,132,173,94,134,58,54,169,200,94,103,230,130,123,12,251,61,114,123,252,106,224,255,108,182,36,31,48,35,156,72,91,135,18,65,217,17,241,73,220,231,149,153,124,73,78,166,139,252,204,187,200,145,225,94,217,87,231,176,150,247,95,34,34,210,93,77,
+160,88,86,51,92,158,85,24,68,69,68,68,68,155,107,216,231,89,211,211,60,89,44,115,48,6,17,17,209,38,195,253,247,254,161,136,12,4,189,82,92,90,150,75,57,222,127,137,136,72,127,117,3,197,240,244,169,121,153,42,46,241,45,64,68,68,68,68,68,68,68,68,68,164,
+185,134,35,121,175,139,248,249,187,39,34,34,34,34,34,34,34,34,34,234,2,13,3,197,9,95,195,111,17,17,17,17,17,17,17,17,17,17,145,70,106,199,241,18,17,17,17,17,17,17,17,17,17,109,208,190,176,79,118,132,124,178,80,90,226,48,80,23,104,24,40,198,52,110,162,
+141,192,180,224,209,168,95,188,61,61,198,127,37,93,44,203,203,211,25,57,201,247,22,17,17,181,216,189,253,33,249,88,34,32,81,191,215,184,223,252,57,89,144,95,207,229,248,50,19,17,213,81,61,40,53,191,180,36,111,206,230,184,70,39,34,162,150,194,250,252,
+83,91,195,226,245,244,92,249,207,62,40,34,83,139,37,121,97,50,45,83,37,206,69,115,162,186,195,236,210,197,37,249,215,83,243,221,254,218,180,69,189,105,246,199,102,178,174,254,192,28,140,5,228,129,107,162,210,211,83,255,251,39,231,243,156,24,76,68,68,
+45,243,141,61,9,137,5,188,53,255,57,222,111,136,136,106,97,173,254,224,246,104,205,159,243,154,73,68,68,173,130,196,193,125,125,193,134,255,181,242,210,178,124,239,116,210,181,177,47,60,191,189,241,192,154,32,120,182,180,36,111,95,206,185,62,89,165,110,
+160,248,197,241,180,28,79,59,51,29,28,11,155,248,106,255,228,247,83,5,87,7,84,159,188,54,46,195,189,245,147,186,113,194,242,244,249,133,182,255,76,27,133,146,130,35,59,227,150,255,21,46,68,137,136,168,21,172,22,161,191,153,206,48,179,152,136,104,149,
+213,90,253,221,153,172,252,116,38,203,151,139,136,136,154,134,76,226,187,134,34,150,255,58,2,171,255,242,145,187,146,84,145,236,249,216,174,184,132,77,230,186,185,53,222,133,53,194,125,67,145,218,214,19,175,76,46,58,50,72,140,141,224,13,137,224,154,44,
+85,188,241,240,198,122,97,34,237,186,82,169,70,217,79,21,8,32,227,49,79,157,78,182,251,71,219,144,207,142,244,42,253,235,216,212,15,187,60,115,154,72,87,135,18,65,217,27,13,72,192,211,35,51,249,146,188,49,151,147,169,34,63,171,228,76,187,99,1,211,159,
+235,19,91,66,12,20,19,17,173,186,207,98,227,126,3,14,222,24,40,38,135,186,49,226,151,125,81,191,12,6,125,198,26,245,100,186,40,31,100,138,252,117,17,57,12,214,223,42,16,108,69,50,168,155,250,22,63,186,35,106,26,36,150,213,120,215,35,165,37,87,29,188,
+86,39,223,92,9,20,143,165,138,114,108,38,35,103,242,229,78,254,108,117,153,5,85,241,11,194,169,248,47,38,210,174,121,115,225,116,197,44,72,92,129,199,224,177,110,218,224,170,60,175,138,59,250,130,204,88,32,114,144,94,79,143,124,109,52,46,253,161,171,
+159,99,28,90,221,60,16,50,14,17,95,79,230,249,235,34,199,9,120,27,244,57,90,229,109,212,7,137,136,168,11,69,253,230,107,117,171,205,47,81,167,124,121,100,37,113,172,162,178,70,221,159,204,203,179,147,172,84,37,114,18,59,247,146,219,250,66,174,137,229,
+33,227,118,32,212,112,212,219,26,183,108,9,187,38,222,245,200,96,120,77,133,166,231,249,177,148,252,211,159,103,229,153,137,148,35,131,196,104,207,160,18,124,68,159,173,97,151,44,108,84,79,87,236,62,182,211,16,212,182,99,40,236,119,205,115,35,234,6,95,
+221,30,91,19,36,174,118,207,72,175,12,251,185,121,36,231,65,127,51,34,34,82,83,94,54,191,102,90,124,155,168,35,176,207,172,14,18,87,195,159,31,106,240,61,34,162,86,58,60,104,221,78,163,2,185,42,7,45,42,31,157,226,214,193,240,154,159,196,227,228,82,13,
+4,126,27,245,240,173,231,225,145,218,161,12,78,100,231,116,133,167,250,68,212,14,187,131,94,203,235,237,157,54,15,131,136,218,225,82,214,252,144,123,146,37,169,68,68,87,140,165,205,175,137,233,162,243,18,135,136,110,25,48,95,131,222,177,46,200,65,68,
+180,25,122,253,246,42,21,227,46,136,231,61,82,231,250,233,232,159,250,14,147,225,52,245,108,13,171,183,61,160,214,179,219,34,35,201,133,40,145,99,132,189,214,183,3,244,131,35,114,154,23,38,211,13,179,138,241,231,63,152,72,243,119,70,68,180,10,195,117,
+204,42,49,126,206,18,126,114,160,168,69,85,155,213,247,137,168,189,236,84,252,189,51,207,89,34,157,84,175,210,223,209,87,84,187,173,9,188,30,246,33,236,180,172,141,225,116,199,216,159,152,136,28,12,89,214,24,154,130,175,94,222,95,28,11,67,81,191,119,
+58,41,169,194,218,195,199,169,197,146,241,231,68,68,180,86,189,107,102,161,188,108,204,124,113,219,128,240,110,195,117,9,17,185,193,71,11,106,61,135,17,80,118,211,32,187,89,155,237,122,23,108,196,199,156,132,233,97,29,128,96,170,106,75,9,59,129,87,39,
+120,117,58,99,244,139,182,130,13,252,148,75,63,52,68,58,58,151,179,222,24,158,78,187,231,38,190,17,8,16,127,97,71,108,77,118,10,54,208,39,102,115,242,226,101,30,112,57,17,238,39,79,49,40,76,68,164,164,250,154,233,182,105,243,221,234,161,45,97,217,63,
+16,90,51,192,245,195,100,94,126,54,157,145,197,46,232,213,143,193,251,163,177,198,73,100,248,62,17,57,7,170,87,190,17,241,89,206,27,251,149,203,170,88,222,156,205,201,78,197,190,195,110,11,130,87,115,116,70,241,116,214,222,5,223,45,3,109,222,190,172,
+158,90,111,231,177,78,128,15,194,111,166,51,255,63,123,247,2,29,213,121,222,11,255,209,220,103,52,51,186,162,27,32,9,25,36,176,145,47,200,196,6,123,129,1,219,184,4,56,161,246,71,220,184,174,91,39,110,87,78,210,198,167,57,235,228,242,197,223,106,142,187,
+154,230,172,38,117,86,146,246,180,206,137,235,164,78,29,78,92,231,0,199,177,73,98,27,138,141,19,91,142,47,96,144,176,145,16,160,11,232,54,154,209,220,71,250,214,179,165,17,35,105,110,146,102,102,191,239,222,255,223,90,90,134,25,153,217,123,207,204,222,
+251,125,222,231,125,158,180,91,50,28,140,210,147,23,198,164,218,47,0,173,227,65,198,201,225,212,231,27,95,100,130,222,240,132,52,127,28,184,97,223,254,122,247,188,37,140,60,48,107,91,102,87,6,106,0,0,0,90,129,32,177,248,246,85,57,148,123,144,196,32,49,
+77,55,113,251,147,122,183,46,178,139,223,204,80,226,240,216,96,250,241,39,0,20,30,79,72,114,130,96,50,241,85,44,178,93,131,120,213,77,170,125,154,235,55,87,228,72,48,74,86,250,195,88,177,237,225,191,82,101,107,178,208,225,143,210,214,5,20,166,191,224,
+139,208,187,18,124,208,186,130,81,106,117,154,51,102,21,243,146,176,127,147,176,78,24,239,223,192,120,132,106,109,70,178,24,138,200,80,84,164,116,80,14,198,38,232,205,43,1,250,105,63,106,159,1,136,232,204,120,132,42,12,69,84,101,159,189,216,100,36,24,
+163,67,189,62,186,172,131,85,0,31,175,118,204,219,255,68,117,197,102,37,131,199,167,131,236,29,0,200,29,238,216,223,100,55,41,43,197,112,254,0,128,108,241,4,246,239,165,89,173,201,227,201,201,232,164,50,254,210,178,43,145,9,26,15,198,168,161,216,60,171,
+220,36,7,155,94,234,29,167,15,80,50,5,64,72,111,143,133,168,115,52,68,161,200,4,153,139,138,232,146,63,66,111,13,5,233,64,223,56,245,134,229,236,89,197,251,148,41,158,215,49,26,162,195,146,148,90,229,247,129,155,214,39,158,91,139,214,124,253,184,208,
+119,171,127,180,220,153,85,106,55,7,34,127,240,209,168,84,229,12,210,237,27,207,82,32,235,22,0,212,192,131,146,229,86,19,149,154,13,116,206,31,161,174,5,214,98,146,217,99,107,203,51,110,253,203,125,227,244,154,14,178,171,1,96,233,246,215,20,83,203,156,
+230,204,188,178,234,185,139,62,148,224,2,128,140,120,37,19,103,19,167,163,183,113,35,215,104,142,251,192,143,146,19,160,47,92,34,47,222,132,28,159,127,117,113,18,64,107,153,149,156,102,35,21,21,77,85,56,240,132,99,244,171,1,191,116,245,254,107,76,6,122,
+100,117,233,204,223,133,175,81,204,221,202,31,109,42,201,88,219,228,165,94,249,110,184,121,223,248,13,217,82,105,167,18,243,212,254,121,34,49,165,201,27,6,15,234,224,165,91,91,57,235,199,101,161,50,155,81,89,110,63,28,140,41,203,157,180,114,34,230,32,
+32,103,234,215,57,204,202,242,122,222,199,94,127,132,142,242,231,46,162,205,207,29,110,40,23,134,63,7,253,17,44,69,77,165,36,203,26,243,0,160,111,169,18,2,202,109,38,250,195,70,55,253,221,135,163,122,63,68,0,0,11,134,123,249,133,225,192,98,157,205,68,
+54,67,145,166,19,64,120,82,133,39,102,227,229,227,56,219,188,219,23,214,76,29,239,54,167,133,182,84,59,102,149,199,219,19,155,84,86,58,30,25,12,232,162,86,185,104,126,61,18,84,126,180,128,227,143,79,126,56,74,15,173,42,81,202,28,9,159,81,28,183,183,210,
+78,235,203,103,167,67,211,116,121,134,103,123,188,8,172,194,146,37,107,96,149,136,235,183,62,127,89,238,250,87,183,149,88,233,246,42,199,188,26,103,52,125,49,61,208,51,166,169,155,135,100,251,203,251,249,214,96,64,51,39,117,200,173,47,173,41,75,250,253,
+72,244,194,69,31,181,235,164,177,31,128,200,120,114,119,119,181,99,102,226,147,179,234,62,24,11,9,145,241,63,55,51,35,25,238,233,32,194,181,40,62,129,236,54,77,37,45,140,69,99,154,158,60,6,144,9,50,138,97,177,248,26,249,169,229,46,170,41,158,157,27,200,
+73,66,63,191,232,213,204,152,143,247,147,107,117,115,146,87,50,92,66,239,169,158,49,169,3,169,60,166,221,94,91,156,242,121,45,236,35,136,163,197,110,18,187,70,113,34,174,87,252,31,67,65,37,219,214,28,155,164,83,158,16,253,91,175,143,222,24,65,173,72,
+88,58,190,192,60,208,48,191,129,85,34,174,91,202,159,61,89,107,128,241,64,112,239,114,87,202,32,24,79,194,172,117,91,233,35,111,88,19,223,41,190,177,190,173,218,49,111,114,137,255,190,210,105,86,106,241,114,77,94,128,68,37,69,69,74,29,226,84,120,162,
+225,133,203,126,138,224,178,3,160,42,190,110,127,254,154,82,229,218,28,191,174,57,45,6,90,229,178,80,173,217,64,167,124,234,158,223,111,41,177,42,215,154,116,184,86,31,215,185,83,19,79,146,63,208,80,162,28,71,62,126,252,83,97,51,81,107,137,149,122,199,
+35,52,26,195,201,14,64,77,222,232,4,181,149,219,210,110,193,123,35,65,205,215,40,134,133,225,107,228,159,174,42,161,242,36,193,83,190,102,242,152,79,43,231,248,221,203,28,105,75,149,114,29,217,85,54,179,234,215,219,197,226,49,252,125,245,238,180,255,
+55,239,163,171,8,99,91,200,141,161,232,4,73,185,126,150,179,47,208,161,23,114,233,214,18,107,218,32,113,220,205,11,104,174,40,26,206,22,202,148,41,201,207,115,33,115,217,241,5,53,83,246,5,175,80,224,1,50,64,162,163,35,65,101,86,62,149,95,245,141,99,182,
+30,64,0,156,73,156,234,154,214,92,98,157,85,114,8,82,227,149,84,201,142,35,63,198,207,1,128,186,56,179,191,61,77,231,124,190,103,193,42,57,152,107,247,156,18,5,115,241,57,254,206,170,212,25,170,178,224,128,248,250,12,19,41,140,179,170,101,29,247,109,
+205,50,254,192,247,62,0,185,130,66,139,0,68,212,228,204,220,48,145,166,47,170,178,14,62,235,178,220,238,229,26,24,92,111,112,103,119,161,188,17,23,84,152,131,131,192,188,116,139,235,125,133,19,178,44,120,89,231,115,61,94,148,156,0,16,68,166,1,81,75,134,
+108,222,124,27,203,162,36,90,104,66,221,210,14,215,78,151,236,72,133,159,195,132,42,128,250,94,24,10,40,165,106,124,115,202,193,112,89,60,190,103,1,152,171,49,139,177,173,204,193,211,184,6,91,246,45,183,154,36,29,227,198,203,66,101,34,115,156,2,196,35,
+124,51,59,0,200,141,108,50,166,89,170,250,78,50,201,54,216,93,105,197,41,16,230,227,96,241,79,251,198,249,79,56,58,0,146,82,251,252,206,43,223,182,199,38,211,174,228,57,50,32,126,223,131,169,206,234,218,108,124,4,32,147,120,211,36,14,236,241,247,18,13,
+221,32,157,76,171,72,227,244,116,142,183,26,178,59,38,0,128,64,49,128,110,112,22,66,54,193,226,116,203,238,101,17,70,105,0,128,188,216,81,102,83,74,240,196,7,32,124,94,121,169,111,28,3,86,40,184,112,134,32,236,37,1,62,147,79,119,121,232,225,166,146,121,
+181,242,217,139,151,124,82,52,98,14,196,208,208,14,10,43,177,73,165,197,80,68,253,254,40,189,57,18,196,117,102,218,84,3,50,76,222,0,208,2,175,81,30,9,174,185,75,133,107,54,228,10,74,79,0,76,119,248,206,214,121,73,155,69,244,102,121,131,45,194,224,122,
+169,46,234,104,95,1,10,133,27,68,110,158,83,23,150,39,159,238,173,119,97,169,155,134,113,231,99,158,32,224,159,26,147,56,183,141,92,30,38,29,17,154,214,112,32,248,135,231,60,212,49,26,162,64,116,66,9,110,115,25,155,3,231,199,132,232,181,193,129,183,185,
+75,217,19,241,115,34,117,197,143,127,22,69,250,28,66,110,197,155,84,54,79,247,14,225,235,77,189,203,172,92,103,110,67,185,48,128,172,165,59,183,39,146,117,92,27,199,215,168,108,246,149,175,191,239,72,218,227,234,92,150,101,239,68,187,102,131,220,144,
+81,12,192,13,172,6,3,89,21,128,231,129,169,172,141,172,120,31,185,94,85,186,12,44,190,136,30,25,76,221,48,67,22,111,120,66,179,178,30,83,237,171,172,221,111,1,10,141,7,239,233,26,68,110,175,114,208,7,221,30,188,47,26,243,185,70,55,149,39,212,255,227,
+137,2,14,116,62,121,65,253,154,152,124,173,226,50,67,201,202,37,189,220,55,174,52,128,18,1,7,139,15,244,139,91,198,230,231,23,189,180,191,222,61,239,122,201,215,72,126,78,4,27,93,22,218,94,83,60,179,141,252,57,244,134,99,244,108,143,87,138,172,108,200,
+94,186,38,149,183,87,57,148,64,15,26,202,2,100,246,219,193,0,109,175,77,223,172,142,107,92,107,225,251,116,108,192,79,187,86,56,211,254,206,91,131,1,105,247,149,199,181,235,74,172,25,203,67,30,147,160,156,21,200,195,88,177,237,225,191,194,251,5,122,231,
+155,152,164,88,100,130,86,185,82,23,254,231,146,12,7,122,125,20,145,244,122,202,251,216,59,30,161,181,110,107,210,101,176,60,40,60,208,51,70,151,53,48,232,82,222,163,216,100,218,247,243,232,128,159,78,251,229,158,69,7,40,148,53,118,51,93,155,102,50,205,
+110,50,208,49,13,76,50,193,85,115,131,196,113,78,139,129,26,173,70,122,87,229,204,28,62,207,255,118,52,68,230,216,36,153,139,138,148,76,154,222,64,132,94,189,28,160,183,209,116,50,107,163,177,73,250,200,27,38,151,177,136,34,177,169,140,164,110,95,152,
+14,247,143,211,197,176,250,247,3,156,69,252,159,86,186,230,221,183,88,141,6,106,45,177,210,107,195,65,213,182,13,114,111,119,173,51,233,61,42,227,199,123,199,163,116,69,144,73,32,0,145,93,8,197,168,214,108,160,138,20,205,222,120,92,251,92,223,184,180,
+227,218,68,125,225,152,50,142,231,201,227,100,231,143,246,43,1,58,34,241,181,130,223,163,43,129,40,173,180,155,149,251,237,100,120,130,252,55,146,102,76,131,152,144,81,12,48,237,53,79,136,130,177,73,218,82,237,152,87,203,151,51,137,15,15,248,165,159,
+117,229,229,40,79,119,123,104,83,153,109,38,19,139,111,20,184,4,195,17,137,103,90,147,225,247,115,36,50,65,183,85,216,149,174,190,113,156,13,247,218,80,0,181,238,0,0,82,224,224,92,178,32,113,92,67,154,73,184,66,139,55,120,130,197,227,236,235,169,6,158,
+226,249,189,52,25,113,156,121,186,183,210,78,7,49,73,165,25,153,26,112,149,101,217,152,25,0,72,57,175,183,121,35,180,169,210,62,147,141,202,227,190,115,222,48,189,48,164,173,243,38,143,251,120,197,193,173,37,86,90,49,93,14,237,74,48,170,172,30,21,101,
+133,209,82,240,24,254,169,158,49,101,255,154,156,87,239,193,184,124,38,175,26,214,194,62,130,88,16,40,6,72,208,238,11,43,63,241,142,194,52,93,187,73,75,1,84,190,144,60,127,89,31,75,83,56,24,28,15,8,215,152,13,184,136,2,44,210,112,36,125,205,179,108,107,
+225,129,28,86,164,9,18,199,113,48,185,35,128,85,25,144,95,86,99,250,192,96,181,157,3,2,8,20,107,69,166,198,203,189,146,215,83,5,40,180,248,216,86,15,120,188,174,76,28,107,116,242,56,190,127,152,28,135,66,192,180,44,64,18,60,107,23,15,50,162,22,154,54,
+32,72,12,176,120,252,253,57,153,102,217,30,234,162,233,143,7,231,84,0,200,177,223,166,201,14,231,21,97,104,212,4,0,0,144,127,8,20,3,0,0,64,70,188,18,97,110,176,152,107,155,115,93,52,189,100,171,232,197,169,12,117,238,38,39,9,77,196,160,32,66,177,244,
+159,179,129,0,202,72,105,9,47,31,79,54,41,201,203,229,127,114,73,140,230,138,0,0,0,90,135,210,19,0,0,0,144,21,14,22,159,24,9,82,185,121,170,214,157,214,74,243,192,20,14,2,159,247,134,83,214,34,126,79,99,181,13,65,92,191,232,27,167,253,13,238,164,219,
+23,155,152,68,125,98,13,138,95,103,174,115,90,200,106,40,162,129,80,12,147,145,0,0,0,5,84,180,230,235,199,49,194,3,0,0,0,128,89,246,215,20,83,115,137,149,138,166,251,75,113,38,49,7,137,17,156,131,66,218,232,178,208,93,181,197,179,186,217,123,195,49,122,
+182,199,139,204,118,0,0,0,128,28,67,160,24,0,0,0,0,0,132,198,13,20,185,209,34,151,70,65,128,24,0,0,0,32,63,80,122,2,0,0,0,0,0,132,214,17,136,42,63,0,0,0,0,144,63,8,20,3,0,8,106,111,165,157,170,237,102,101,227,222,25,13,210,155,25,26,76,1,128,124,106,
+204,134,153,90,156,161,137,73,122,195,19,66,221,103,0,201,240,247,24,181,219,1,180,45,126,95,30,154,152,160,223,12,7,49,113,5,0,154,133,210,19,0,0,130,169,49,25,232,225,166,146,89,245,24,89,56,54,73,79,119,121,176,228,22,64,35,110,43,177,210,237,85,14,
+178,24,175,126,215,249,123,126,160,103,140,186,66,49,188,205,0,18,216,87,229,160,245,229,182,153,13,229,239,240,241,203,126,122,205,19,194,219,7,160,1,92,39,125,103,157,115,166,94,127,220,112,48,74,223,239,30,195,91,12,0,154,99,192,91,10,0,32,150,135,
+86,205,15,18,51,14,38,241,115,0,32,63,206,64,220,94,91,60,43,72,28,255,158,239,175,119,83,113,146,115,0,0,136,101,110,144,56,254,29,230,239,246,181,14,51,222,45,0,201,113,242,198,61,203,231,7,137,89,185,205,68,143,172,116,227,45,6,0,205,65,233,9,0,0,
+129,112,214,194,220,192,81,34,126,142,127,71,203,101,40,118,148,217,104,109,137,133,156,102,35,133,98,19,244,254,72,136,126,61,18,20,96,203,0,114,103,131,219,154,242,223,226,239,249,173,37,86,124,238,1,4,198,147,57,115,131,196,137,54,150,217,232,3,127,
+4,111,33,104,10,223,131,222,88,58,245,185,215,67,9,134,187,171,29,105,159,175,41,70,56,5,0,180,7,103,54,0,0,129,196,111,190,211,89,231,214,110,160,248,209,166,18,114,89,140,51,127,183,24,141,180,185,218,65,173,101,86,122,226,156,71,213,109,3,200,165,
+229,25,178,13,173,200,40,6,16,90,131,45,253,48,170,222,133,140,98,208,150,185,247,104,172,193,101,161,142,209,16,29,232,31,215,228,187,93,101,207,28,46,105,177,155,80,175,24,64,69,60,113,27,191,38,99,130,54,55,16,40,214,49,254,66,113,198,210,10,135,153,
+44,211,3,210,115,190,48,26,233,0,168,136,179,51,50,9,198,180,249,253,228,229,123,115,7,32,113,252,56,63,255,228,5,212,130,3,109,24,12,69,211,102,34,133,112,29,6,16,90,32,150,254,122,237,139,160,159,0,104,199,231,26,83,223,163,181,148,90,105,71,40,166,
+219,85,48,30,124,215,1,84,177,202,106,164,59,171,138,103,221,79,223,75,68,157,158,16,29,30,240,35,166,181,4,8,20,235,20,127,169,62,177,194,69,78,243,236,50,213,252,37,187,185,210,142,70,58,0,42,57,61,22,86,178,51,210,121,87,163,13,114,50,45,223,195,242,
+62,208,146,14,95,36,229,178,117,110,134,117,202,167,221,242,50,0,90,192,247,201,28,12,158,123,47,29,199,89,150,0,90,192,117,122,203,51,100,208,223,84,97,211,100,160,184,199,23,81,2,225,169,76,78,18,154,76,3,168,128,251,0,236,89,238,76,90,178,177,185,
+196,74,159,119,90,232,233,110,15,245,75,56,145,195,177,186,117,78,11,45,179,153,232,74,48,74,158,232,4,189,227,13,23,52,240,141,81,119,150,248,131,200,181,198,18,151,145,141,4,99,244,187,145,160,116,93,141,185,129,14,55,202,73,85,7,53,222,72,7,193,98,
+128,194,227,146,18,91,163,19,100,55,37,31,120,114,135,101,45,46,111,171,73,177,191,115,105,189,62,51,232,7,47,141,43,235,27,87,154,94,205,117,252,178,95,202,27,91,0,189,249,249,69,111,210,123,106,30,35,28,69,141,113,208,136,235,50,36,48,176,84,247,173,
+178,227,146,26,95,117,91,146,54,153,102,239,13,5,240,49,7,40,48,94,25,159,42,72,28,199,207,237,169,113,74,181,26,149,247,235,190,90,231,172,152,99,252,207,183,87,57,232,87,125,227,212,94,160,68,18,99,197,182,135,255,42,95,255,56,239,232,245,197,22,186,
+201,101,161,53,14,51,153,139,138,232,138,132,3,159,219,74,172,244,241,21,78,42,177,206,94,110,195,23,196,85,46,11,213,154,13,116,202,39,79,45,148,143,87,59,50,214,91,226,139,97,149,197,68,111,143,33,27,2,160,208,206,141,133,169,217,105,38,171,113,246,
+77,55,7,137,191,223,173,205,210,11,78,67,17,181,165,105,10,20,247,161,55,76,189,97,76,96,129,54,92,8,197,104,208,31,165,137,216,36,113,213,153,14,79,136,254,111,255,56,157,246,163,214,33,128,12,70,99,147,244,145,55,76,46,99,17,69,98,83,229,38,248,123,
+252,243,129,113,44,121,5,205,104,178,155,104,165,51,115,205,237,99,131,218,12,154,158,245,132,169,181,196,58,47,88,204,171,6,254,253,178,95,181,237,2,208,171,45,165,54,106,204,98,2,203,105,49,208,5,111,88,185,86,203,224,207,26,74,82,174,160,229,243,207,
+26,183,133,198,131,49,234,43,192,88,56,111,25,197,187,42,236,212,90,110,155,21,229,111,35,162,157,145,9,58,54,224,47,88,36,124,169,56,147,56,89,182,79,34,78,109,223,21,158,160,23,36,153,81,228,237,205,6,127,72,57,216,143,27,93,128,194,226,37,108,220,
+184,141,155,99,172,152,94,234,119,81,163,153,196,113,188,207,188,124,175,40,67,255,46,100,19,131,214,112,102,49,26,111,0,200,139,179,255,127,218,167,205,70,94,0,52,125,15,154,73,88,163,253,51,104,250,30,245,155,103,71,148,85,109,238,233,204,105,189,214,
+99,6,16,65,147,51,115,144,56,142,75,56,116,133,196,143,211,237,40,179,81,153,45,121,29,248,68,119,214,22,211,153,143,34,121,143,209,229,37,80,252,201,218,226,148,193,72,174,227,181,107,133,147,108,125,227,82,148,108,216,94,229,200,234,247,218,150,217,
+149,37,102,162,7,85,107,82,212,81,75,133,187,71,98,0,11,160,14,14,12,235,169,139,114,143,47,125,125,230,254,113,125,101,89,114,57,142,61,181,78,42,183,25,201,108,40,162,96,108,130,126,55,20,196,224,4,0,0,160,128,248,122,124,119,181,131,172,134,169,113,
+20,55,255,214,211,181,152,239,69,189,225,88,202,102,118,236,180,14,142,7,146,21,0,32,95,214,101,153,204,201,137,184,55,186,44,121,143,165,230,188,152,16,151,105,200,38,99,149,179,116,23,26,180,44,52,222,190,108,162,250,113,55,102,145,254,14,0,0,201,253,
+232,146,79,41,175,145,12,63,46,83,141,169,165,226,65,233,195,77,83,203,143,248,134,128,51,173,185,220,209,230,106,7,237,175,73,191,202,5,0,0,0,114,131,179,72,31,89,93,170,76,100,243,53,153,127,248,90,252,104,83,137,174,142,240,179,61,222,148,89,195,231,
+189,97,58,168,209,178,19,0,32,158,240,2,146,51,67,146,172,142,95,72,220,177,164,0,53,225,115,254,10,55,149,101,174,49,25,183,181,210,158,235,151,207,169,114,115,246,111,22,21,232,13,91,42,94,30,183,144,165,65,200,38,6,128,66,226,26,204,47,94,242,41,217,
+195,241,31,254,187,86,107,51,167,194,153,75,169,26,167,112,247,237,108,155,255,1,0,0,192,226,221,149,162,4,33,103,215,234,105,226,54,94,126,129,235,242,114,118,49,143,39,121,18,159,239,209,120,162,31,0,160,80,62,92,64,25,219,83,146,148,188,21,77,78,75,
+79,112,61,219,133,68,194,235,28,153,139,226,67,238,189,63,28,84,74,101,100,210,41,65,105,16,0,208,30,94,218,167,247,229,125,181,25,174,143,220,129,188,31,37,40,0,0,0,242,134,179,137,83,77,218,50,110,106,78,253,250,170,79,125,64,103,251,11,0,226,225,178,
+11,55,101,81,211,247,228,112,80,73,148,148,1,79,190,37,246,119,75,167,16,89,210,57,77,73,106,176,45,44,238,236,20,188,244,196,66,179,105,187,37,169,37,202,181,148,71,130,233,59,37,242,7,245,240,0,186,184,2,0,0,0,0,128,254,184,177,122,7,0,64,72,255,183,
+207,71,190,52,65,96,142,119,29,145,168,36,78,183,96,89,210,57,205,40,30,142,164,15,62,206,149,238,141,21,5,103,213,102,83,115,153,247,69,150,50,13,220,112,239,169,158,49,250,212,114,151,82,103,107,46,94,234,125,168,223,39,124,99,62,45,219,49,93,194,229,
+148,55,172,44,245,210,18,222,183,214,50,43,89,141,83,55,223,125,254,8,29,25,240,107,110,63,1,150,34,20,155,32,139,49,245,44,249,24,190,47,11,198,231,158,120,151,228,208,196,4,206,59,0,160,121,92,166,232,186,233,30,42,90,188,167,204,183,76,215,218,216,
+36,198,74,0,137,248,94,235,166,10,27,25,139,166,50,35,249,126,246,23,125,227,154,106,206,205,231,213,143,149,90,169,218,110,86,26,91,226,220,170,142,174,80,140,254,185,203,67,91,203,108,74,89,190,120,18,42,7,136,127,55,18,204,123,179,183,92,59,58,24,
+160,70,167,37,99,86,113,161,178,164,139,214,124,253,120,78,175,112,255,229,154,210,172,51,133,57,8,251,211,62,177,151,175,112,57,141,63,93,85,146,113,159,254,181,203,163,124,88,101,179,202,106,164,117,206,171,77,248,56,43,90,134,128,119,252,198,119,185,
+195,68,151,252,81,77,156,160,121,159,238,93,225,164,242,57,153,249,92,7,76,43,23,88,110,252,145,170,99,50,215,56,211,123,185,1,128,184,22,187,137,246,55,184,147,30,143,64,116,130,254,238,195,81,28,171,5,120,100,165,59,233,196,40,206,59,0,160,85,201,206,
+123,156,12,162,167,198,176,185,240,165,53,101,41,7,238,239,14,6,208,196,13,96,90,186,113,30,215,182,214,66,217,146,84,247,147,90,56,183,242,216,227,206,106,7,57,167,251,116,249,34,49,58,227,9,211,175,81,234,174,96,56,54,183,191,222,157,242,154,83,200,
+248,169,177,98,219,195,127,149,203,127,176,220,80,68,117,197,217,213,30,126,245,114,128,174,8,158,85,28,153,156,74,3,95,110,53,145,211,50,63,88,204,37,26,126,126,209,71,103,83,116,234,23,221,104,108,146,206,6,162,51,63,162,191,31,236,115,141,110,186,
+189,202,65,43,157,102,42,181,26,149,255,182,149,219,168,197,110,166,183,199,228,172,171,204,65,226,135,155,74,168,56,73,3,69,206,188,189,174,212,74,3,227,17,26,146,56,24,206,239,91,169,53,245,34,134,213,110,11,117,142,134,200,135,76,118,0,229,187,110,
+142,77,210,138,98,51,21,37,220,43,112,144,248,95,187,199,240,61,89,0,206,110,89,87,150,124,101,208,53,46,11,29,27,194,32,31,0,180,101,111,165,157,86,151,206,63,239,241,88,166,148,131,54,126,237,100,247,229,219,71,99,97,186,177,212,74,134,162,217,3,247,
+243,222,48,29,64,153,62,0,5,55,118,76,23,3,170,180,153,148,251,218,46,73,99,38,52,29,8,175,176,39,31,203,242,185,181,213,105,166,55,71,229,140,69,112,0,252,150,101,118,178,155,12,74,93,118,254,225,63,115,156,69,230,253,146,13,199,230,62,242,134,201,101,
+44,82,98,64,241,128,49,79,68,252,118,40,64,191,40,224,196,100,206,51,138,217,231,27,75,178,42,44,253,252,101,185,46,174,109,78,11,85,91,141,180,220,97,166,193,80,148,46,135,98,244,142,55,140,18,13,5,148,110,86,159,166,179,111,159,56,231,145,110,191,82,
+205,78,38,226,73,9,238,54,44,35,14,132,63,178,186,52,227,150,35,211,5,96,190,120,41,154,139,193,168,166,150,238,21,10,79,82,205,93,169,145,8,89,197,0,160,53,95,109,46,75,217,132,45,54,49,73,127,211,41,231,253,164,154,56,248,206,75,205,185,116,209,111,
+134,131,184,30,3,36,248,90,75,57,21,101,232,195,37,243,138,56,190,23,223,92,237,200,248,123,7,206,143,73,119,110,248,163,229,78,106,112,89,210,254,14,198,232,250,147,211,26,197,113,92,255,118,119,181,35,101,109,223,246,43,1,122,65,194,12,158,118,46,26,
+237,227,84,47,100,31,169,129,103,42,51,213,108,225,229,46,124,34,151,109,137,68,166,32,49,227,125,231,37,33,50,222,152,94,151,225,226,19,87,158,97,130,9,64,143,176,228,107,105,156,73,86,106,36,66,179,34,0,208,154,84,65,98,202,240,28,164,54,85,98,2,99,
+64,128,100,50,5,137,153,93,226,251,173,214,20,43,211,230,218,82,233,160,14,201,2,170,153,130,196,52,29,171,224,196,47,212,98,214,143,188,4,138,57,195,150,107,103,212,12,6,104,131,251,234,151,42,52,49,169,116,232,43,68,241,101,208,30,46,77,144,13,46,160,
+47,83,96,165,37,197,18,150,100,86,216,228,12,20,3,0,168,101,56,24,75,59,25,119,81,226,101,144,0,0,201,112,143,181,84,129,27,244,95,3,128,92,90,200,88,86,86,241,38,236,153,200,150,244,20,95,181,152,13,110,224,135,154,236,250,145,215,111,53,7,132,101,204,
+28,6,49,101,155,1,97,204,102,74,19,10,42,83,215,232,56,116,143,6,128,92,59,54,232,167,253,197,169,27,3,98,242,13,0,180,102,192,31,77,57,65,54,128,250,196,0,144,67,217,222,71,113,25,69,173,11,197,180,155,16,201,165,119,176,170,66,63,176,222,18,64,101,
+11,9,82,100,27,112,21,13,215,255,204,38,6,220,227,139,224,227,8,0,57,197,231,88,174,67,60,247,28,20,111,12,8,0,160,53,92,75,146,251,118,204,197,143,161,206,36,0,228,90,178,243,205,92,93,18,247,131,232,243,103,55,70,29,14,101,62,14,178,242,68,180,187,
+111,48,159,246,215,9,128,102,112,243,141,108,178,138,101,204,74,29,14,70,211,54,91,162,233,89,88,153,27,46,157,184,236,79,219,4,128,131,54,7,250,199,11,186,77,0,160,15,124,238,124,179,99,24,141,1,1,64,55,184,185,51,159,243,154,156,83,165,219,206,249,
+194,168,121,15,0,121,241,108,143,151,30,110,42,73,57,86,231,113,172,204,227,188,35,3,126,122,36,139,90,190,252,123,50,57,229,13,103,213,164,143,189,235,9,73,181,111,176,52,8,20,131,52,46,142,71,178,42,182,222,57,42,223,73,236,185,139,190,180,23,87,246,
+178,228,65,212,248,224,100,83,149,99,94,221,60,14,148,243,49,0,0,40,196,121,8,0,64,15,248,156,135,243,30,0,228,27,55,57,251,225,57,15,221,95,239,82,154,203,39,210,194,56,143,247,239,221,193,0,221,80,105,79,249,59,188,122,77,182,102,111,188,189,217,36,
+172,113,198,56,18,44,244,165,104,205,215,143,163,40,40,72,227,171,205,101,105,131,169,124,18,227,12,10,25,113,39,209,100,23,87,158,129,253,249,69,175,166,78,206,137,133,243,145,217,7,0,0,0,0,0,32,63,30,211,94,55,157,220,165,181,137,170,141,46,11,109,
+173,118,144,221,116,181,130,43,199,31,126,209,55,46,237,120,150,223,175,135,86,149,144,197,152,60,198,194,171,186,121,18,64,182,32,56,44,13,2,197,32,21,62,145,253,97,163,123,214,201,57,142,103,195,190,175,129,122,147,137,23,87,4,81,1,0,0,228,197,221,
+224,239,172,118,144,211,108,84,74,99,113,45,126,148,89,2,0,0,0,145,236,175,41,166,213,110,203,76,82,30,87,243,228,230,167,168,107,175,79,8,20,131,148,120,224,117,75,185,141,172,6,131,82,88,157,107,230,32,160,10,0,0,0,162,216,91,105,79,186,76,85,230,213,
+79,0,0,0,0,160,109,168,81,12,82,226,160,112,199,37,212,180,5,0,0,0,49,165,170,101,200,37,166,56,115,7,153,197,0,0,0,0,32,26,4,138,1,0,0,0,64,42,171,172,70,218,82,233,160,122,151,89,217,236,254,241,40,189,54,20,160,15,252,17,33,118,35,177,22,127,50,171,
+184,196,148,32,129,226,98,67,17,109,45,179,81,107,185,77,169,81,232,139,76,80,199,104,136,94,24,10,8,176,117,0,0,0,0,80,72,8,20,3,0,0,0,128,52,106,204,6,218,95,239,158,213,120,165,166,216,68,247,22,187,136,122,188,194,4,139,101,241,169,229,46,229,248,
+197,57,205,6,106,91,102,39,171,177,136,158,191,236,215,251,225,1,0,0,0,208,21,4,138,182,240,133,124,0,0,32,0,73,68,65,84,1,0,178,112,173,195,76,219,171,28,84,102,51,42,191,60,18,140,209,203,151,253,154,14,72,112,48,166,220,108,164,64,108,130,186,66,49,
+1,182,8,0,128,104,107,165,61,101,119,238,219,42,236,66,156,151,199,50,116,7,15,197,196,232,30,222,230,180,204,10,18,39,90,95,110,163,19,35,65,234,143,160,211,57,0,136,129,87,64,184,140,69,154,63,47,237,170,176,83,75,169,85,153,184,99,157,158,16,29,29,
+12,224,124,12,0,5,129,64,49,0,64,6,60,144,222,181,194,57,235,151,56,96,124,111,189,139,202,250,198,233,53,79,72,83,135,144,3,196,123,106,156,179,130,7,188,20,249,216,128,159,218,125,97,85,183,13,0,160,206,97,78,121,12,82,5,61,11,237,77,111,152,182,199,
+38,83,6,180,223,31,17,227,186,81,109,53,166,125,158,39,11,17,152,0,0,181,241,189,248,150,106,199,76,224,52,28,155,164,247,135,131,154,44,145,243,201,218,98,106,46,177,206,122,140,255,222,232,180,208,211,221,30,156,147,1,32,239,12,56,196,0,0,233,221,89,
+91,156,242,249,219,171,28,154,58,122,156,169,241,80,99,201,188,96,11,223,152,115,176,156,111,212,1,0,32,179,167,187,60,74,48,99,46,174,255,251,235,145,32,142,32,0,64,22,110,43,177,42,247,160,241,32,49,227,73,56,46,145,243,200,74,183,166,14,33,215,223,
+159,27,36,142,227,125,222,154,162,73,42,0,64,46,33,163,24,0,32,13,46,57,145,42,35,140,166,111,218,248,119,180,82,130,226,238,52,75,186,25,103,115,32,171,24,50,225,9,7,254,44,85,90,167,110,51,46,249,35,116,116,36,72,227,19,243,131,102,0,11,213,235,143,
+164,28,72,247,120,197,57,23,247,71,39,232,155,103,71,104,163,203,66,235,220,22,26,13,197,232,183,163,33,229,113,81,156,246,133,149,96,75,50,28,228,62,31,140,10,179,173,32,63,190,54,220,232,178,80,137,201,64,3,161,24,238,39,32,35,254,204,164,75,202,224,
+196,6,14,36,107,101,117,223,186,12,9,25,141,202,243,98,52,66,5,0,237,66,160,24,0,0,102,44,79,179,164,155,166,51,139,57,219,65,15,53,139,87,77,47,201,70,125,230,133,225,210,37,156,149,62,183,209,88,147,203,66,79,245,140,33,88,12,75,118,120,192,79,159,
+119,90,230,77,106,113,96,243,216,160,120,205,215,184,12,5,255,136,136,207,111,92,251,50,89,224,253,248,101,63,190,175,144,51,124,77,157,219,132,114,83,48,134,235,2,164,213,96,51,165,77,96,96,171,157,22,205,149,129,75,37,211,177,0,0,200,5,4,138,1,0,210,
+24,142,100,14,18,102,243,59,178,136,55,235,75,199,110,228,165,127,218,13,158,206,173,131,135,250,204,11,147,170,209,24,127,182,110,45,177,98,201,189,68,118,148,217,148,141,21,237,61,227,160,210,247,62,26,165,221,213,14,90,102,53,145,217,88,164,100,25,
+163,209,207,226,252,180,111,156,110,243,71,233,90,247,84,176,56,60,49,73,39,61,33,33,207,121,156,157,237,54,25,232,98,48,74,29,1,100,59,203,130,179,66,231,6,137,105,250,186,240,169,229,46,122,242,194,152,222,15,81,86,248,56,242,121,207,109,154,186,87,
+27,139,198,112,222,227,224,169,65,59,193,83,79,134,21,39,220,76,27,0,32,223,16,40,6,0,72,131,111,190,251,199,163,41,27,36,241,115,90,186,65,79,183,175,113,90,10,140,207,197,101,68,230,54,46,140,215,103,14,244,120,53,83,98,36,159,26,211,44,155,108,114,
+90,16,40,150,192,254,154,98,165,219,122,220,230,106,135,82,87,247,64,191,56,203,93,57,88,204,1,78,200,13,206,198,19,57,35,175,198,100,160,135,86,205,94,169,192,25,228,92,7,90,164,82,30,144,28,151,155,72,149,9,201,247,28,188,18,69,239,193,206,76,56,72,
+252,249,107,74,103,175,214,33,19,26,156,77,7,204,181,226,29,111,88,41,181,145,234,251,242,59,220,67,1,64,1,160,153,29,0,64,6,63,185,228,77,58,131,207,143,241,115,90,242,193,88,250,64,129,214,2,227,115,109,156,206,160,76,102,187,198,26,23,2,36,195,89,
+196,137,65,226,56,126,108,71,154,239,7,64,62,205,13,18,211,244,18,108,126,28,196,199,53,137,211,41,55,103,94,205,164,119,156,73,156,44,120,200,143,237,172,74,221,116,89,118,60,65,239,203,112,223,249,190,71,59,43,190,120,18,244,64,207,88,210,70,168,39,
+135,131,186,41,177,1,0,234,66,70,49,0,64,6,202,50,231,110,143,210,44,35,62,216,225,165,97,90,188,89,227,125,90,225,48,37,173,87,201,55,234,135,250,125,170,108,87,161,212,187,82,215,104,206,166,44,7,16,117,251,194,41,27,141,157,67,249,14,225,221,84,145,
+58,24,204,207,33,35,28,10,109,99,154,108,84,126,188,197,110,66,25,10,193,13,100,168,245,143,213,58,153,45,179,166,30,182,167,187,119,209,130,151,250,198,105,207,114,103,210,243,0,215,88,215,218,231,135,107,199,115,121,165,120,227,71,246,246,88,8,89,247,
+0,80,48,8,20,3,0,100,73,47,179,248,137,245,42,173,198,34,10,197,38,233,18,215,255,28,9,106,190,225,12,7,195,227,181,137,231,74,150,221,1,243,113,189,196,198,36,141,198,56,3,255,13,100,194,8,207,88,148,186,214,99,186,231,0,242,197,157,33,27,117,133,13,
+129,98,209,113,189,107,110,92,151,108,194,149,179,36,33,51,179,142,155,152,113,32,56,208,51,70,91,42,29,51,65,113,190,167,224,50,12,90,189,55,231,251,109,100,15,3,128,90,16,40,6,0,128,121,68,175,87,153,47,220,16,43,85,54,108,55,178,97,179,194,25,47,92,
+47,145,155,218,197,27,238,12,134,162,116,100,48,128,206,246,18,136,77,242,123,132,128,48,136,99,44,67,13,226,76,207,131,24,158,234,25,83,26,215,37,246,65,224,32,241,243,151,253,120,135,178,144,238,254,164,199,171,253,140,108,206,178,237,210,88,185,55,
+0,0,81,33,80,44,17,110,228,241,177,82,43,85,219,205,228,137,196,232,93,79,8,25,20,0,0,57,116,120,192,79,127,98,53,205,203,122,226,204,21,126,14,178,195,193,98,52,26,147,83,231,104,136,110,168,180,39,221,246,211,40,59,1,42,120,211,27,166,187,38,38,201,
+104,152,63,129,193,43,61,248,121,16,31,79,20,62,121,97,76,105,202,214,96,51,209,249,96,20,147,135,11,144,106,181,14,127,7,142,13,226,254,4,0,32,87,254,104,185,147,106,29,230,153,243,109,32,58,65,191,27,10,234,170,252,90,209,154,175,31,199,21,90,2,143,
+172,116,207,154,129,143,243,134,99,244,108,143,23,29,159,1,0,114,132,7,177,183,150,88,169,201,105,81,254,65,174,171,203,37,19,48,160,5,189,72,118,207,49,28,140,210,247,187,199,240,25,0,85,112,178,196,195,77,37,179,130,197,28,32,123,186,203,131,123,96,
+208,141,26,179,65,105,92,23,47,191,192,153,196,28,36,238,202,80,3,26,0,0,50,75,118,175,145,136,99,111,79,156,243,232,226,72,106,62,80,204,13,48,214,185,45,100,53,24,104,32,16,161,223,142,134,164,187,161,124,180,169,132,92,150,212,77,148,98,19,147,244,
+195,115,184,81,6,0,0,128,220,224,6,97,55,76,47,115,198,10,38,16,5,223,215,115,205,98,46,55,129,76,98,0,0,0,200,149,47,173,41,75,217,60,55,238,188,55,76,63,186,36,79,115,119,78,254,168,118,152,40,177,205,72,54,201,166,154,13,20,243,0,231,19,43,92,73,223,
+232,254,241,168,178,244,73,6,59,202,108,180,185,218,145,113,75,101,218,39,0,0,0,0,0,0,0,0,0,181,101,27,119,99,143,159,25,22,254,253,202,148,29,205,94,188,228,75,57,233,158,180,70,49,7,89,185,171,104,185,205,168,52,53,241,132,38,148,101,45,178,100,147,
+240,246,239,111,112,167,124,158,151,83,114,150,174,12,105,227,55,85,216,178,250,61,158,37,0,0,0,0,0,0,0,0,0,128,236,196,75,14,102,131,131,202,162,215,43,254,195,70,119,218,32,49,219,89,231,164,55,59,146,7,189,13,115,31,248,92,163,91,9,178,114,48,149,
+179,113,237,38,131,242,103,126,140,159,147,1,103,18,103,194,165,28,246,215,20,11,191,55,54,227,188,183,40,169,34,52,40,7,0,0,0,0,0,0,0,0,208,37,78,156,229,56,110,38,28,67,76,21,19,157,245,127,115,150,109,185,45,117,102,42,63,39,122,176,152,15,74,166,
+186,34,113,171,92,217,207,26,0,0,0,0,0,0,0,0,0,0,136,232,150,242,236,170,18,176,122,167,57,233,227,51,81,97,78,159,78,215,48,45,142,131,197,34,167,90,175,72,19,232,158,43,219,128,178,154,130,177,137,172,102,3,0,114,133,59,42,151,155,141,116,62,24,165,
+241,9,77,247,186,4,0,80,13,159,107,55,184,167,154,197,13,132,98,212,238,67,99,46,0,153,37,126,167,61,209,9,122,199,27,198,125,20,0,64,158,92,235,152,10,112,13,71,98,212,31,65,83,127,88,154,129,64,68,169,164,144,13,209,203,78,88,13,217,199,15,141,41,74,
+19,204,28,137,108,107,225,178,214,50,171,240,7,71,43,122,124,17,106,41,181,102,220,27,238,92,8,176,20,109,78,11,109,169,118,144,211,124,245,196,194,77,18,127,117,121,156,186,66,248,124,1,0,228,202,109,37,86,218,94,59,123,169,215,134,241,40,253,228,146,
+23,129,37,0,9,37,251,78,223,84,102,163,167,122,198,240,157,6,0,200,161,93,21,118,106,45,183,205,74,250,227,49,235,161,126,31,2,198,176,104,7,7,3,180,174,204,150,49,153,148,63,107,122,96,172,216,246,240,95,241,126,238,168,202,174,195,31,43,162,34,122,
+109,88,204,64,113,147,221,68,43,83,164,79,207,53,57,73,116,108,40,80,200,205,91,176,83,190,8,109,42,179,165,45,68,205,251,241,163,238,49,242,225,70,180,32,86,89,141,180,179,202,65,155,203,236,212,86,98,165,53,197,38,154,156,32,186,34,241,133,137,7,56,
+119,47,119,206,59,49,58,45,6,90,235,182,82,239,120,132,70,99,248,124,1,0,44,21,103,29,222,87,63,191,140,23,159,111,45,19,68,103,37,105,28,12,0,83,138,13,69,116,223,74,215,188,123,117,94,17,88,97,50,40,247,242,0,0,176,116,251,170,28,116,99,165,125,222,
+249,150,239,161,90,75,172,244,145,55,44,109,76,132,239,15,63,94,237,160,221,181,78,218,94,229,160,173,149,118,170,53,27,104,40,20,67,156,167,64,62,26,11,211,141,165,86,50,164,200,178,229,228,204,127,56,63,38,252,126,24,39,39,105,181,59,187,50,187,23,
+199,35,244,174,119,254,170,198,236,235,52,72,130,51,157,55,87,103,23,244,30,9,201,49,24,123,186,203,163,116,45,76,86,130,34,28,155,164,159,95,244,82,127,84,220,32,37,159,244,174,113,152,169,196,100,80,150,215,158,241,71,164,205,174,72,150,49,82,67,38,
+106,46,177,82,203,112,144,158,191,236,87,109,219,22,139,7,56,183,167,153,40,226,224,241,199,107,157,244,189,110,143,232,187,2,0,32,188,248,210,244,100,150,243,50,74,193,39,176,1,96,182,6,91,234,254,40,124,127,72,125,227,56,98,0,0,75,196,201,90,235,211,
+212,94,229,243,48,7,87,127,42,225,57,151,247,109,127,189,123,222,181,132,175,33,141,78,11,29,232,25,147,114,133,47,199,129,248,61,113,155,166,74,220,134,39,38,233,67,95,152,94,243,132,84,223,182,100,56,166,246,195,115,30,218,83,235,164,101,118,227,204,
+132,4,199,220,78,143,4,149,172,99,25,188,233,13,211,246,216,100,86,165,118,143,12,36,143,95,205,4,138,195,89,254,67,50,232,24,13,101,85,174,225,185,139,62,41,246,135,63,176,127,247,225,40,109,116,89,232,198,210,171,39,199,115,190,176,208,37,64,148,12,
+139,90,39,213,187,102,103,120,223,25,155,164,227,151,253,194,158,32,82,225,58,72,115,131,196,137,248,194,213,227,143,74,87,103,242,70,151,37,227,119,191,204,102,84,46,96,40,65,1,0,0,0,0,0,0,133,180,206,153,57,67,82,214,201,185,79,172,112,165,28,143,243,
+227,28,68,254,222,71,163,82,37,219,37,75,176,99,28,27,90,237,180,208,211,151,188,170,108,87,38,28,123,123,242,130,248,89,195,153,112,50,233,254,134,249,43,24,19,189,62,224,79,153,112,58,147,162,58,28,204,62,0,212,149,36,53,89,36,7,250,199,105,56,152,
+62,91,248,197,75,62,161,179,112,147,225,153,1,254,208,198,127,68,175,19,253,39,245,238,121,65,98,154,62,217,241,73,131,79,30,50,217,88,150,185,142,247,150,44,179,217,69,82,146,101,179,68,187,17,77,21,1,0,150,106,32,205,132,219,88,20,147,113,0,178,225,
+70,74,169,244,120,81,118,2,0,0,82,227,62,65,137,61,130,146,225,248,9,39,119,201,34,83,130,29,199,136,246,45,160,244,45,44,92,71,32,74,79,126,56,154,180,151,25,39,9,115,60,52,93,60,113,38,163,248,80,159,143,30,89,93,154,113,3,98,19,147,74,32,86,116,223,
+239,30,163,29,101,54,165,241,158,211,108,36,46,51,194,7,132,3,226,188,175,178,5,137,101,195,199,158,179,80,211,225,114,7,31,249,35,210,20,157,79,22,244,158,43,211,73,94,68,33,212,60,2,0,40,24,94,117,178,218,19,154,202,122,73,192,247,40,71,37,89,210,6,
+0,87,241,125,236,203,125,227,243,6,197,252,157,62,54,40,95,73,50,0,0,40,156,106,107,250,152,73,92,182,201,93,34,200,38,193,142,87,99,159,24,9,162,1,97,30,113,204,243,137,115,83,229,67,119,76,191,39,167,188,225,172,98,161,51,129,98,254,101,142,42,223,
+179,220,153,242,151,185,105,218,47,37,74,229,231,8,185,232,89,183,90,181,46,139,108,97,158,25,187,206,105,161,126,188,71,170,58,229,11,103,172,235,205,131,157,15,252,200,138,1,144,65,139,221,68,43,108,38,26,139,78,40,43,81,64,60,92,63,111,71,48,70,77,
+211,203,40,57,147,152,131,196,184,89,6,144,19,151,83,27,137,76,40,131,99,139,161,8,223,105,0,128,28,235,14,68,169,45,195,63,137,85,28,98,200,38,193,142,45,183,154,168,63,130,177,74,33,44,52,46,58,171,153,29,15,40,47,124,56,74,247,215,187,200,101,185,
+58,179,193,1,226,1,127,20,153,184,144,181,76,217,196,113,86,131,60,117,177,125,145,9,41,51,134,51,225,65,76,103,146,236,182,68,239,15,35,152,15,32,131,207,53,186,169,220,118,245,210,126,215,196,164,50,193,139,128,177,120,48,153,13,160,45,60,161,142,73,
+117,57,112,102,213,77,21,54,50,78,119,182,151,169,73,17,128,94,241,249,117,163,55,146,50,8,41,235,42,142,116,37,201,18,121,52,24,135,43,213,96,108,69,43,76,115,247,35,49,61,25,96,177,180,212,28,49,142,155,36,182,45,179,167,253,157,78,201,26,244,197,29,
+30,240,211,125,6,67,210,11,239,201,225,32,189,128,46,252,0,194,123,100,229,236,32,49,227,110,189,119,213,22,35,80,12,0,0,64,68,123,43,237,116,67,229,236,251,121,254,123,181,221,172,137,6,70,0,90,246,179,62,31,221,29,177,43,101,11,18,113,66,23,55,239,
+146,177,241,58,151,36,219,146,33,33,141,247,239,29,137,238,229,179,141,5,245,161,81,190,176,230,5,138,1,114,161,223,31,205,106,201,65,182,51,104,34,56,58,18,164,38,151,37,101,182,52,159,16,57,224,42,35,238,160,202,157,71,87,89,141,179,58,202,190,61,22,
+194,178,73,0,73,212,20,39,191,164,115,176,152,179,167,144,189,10,0,0,122,119,125,69,242,164,15,190,134,214,152,12,88,61,11,32,48,30,179,62,127,217,175,212,182,189,198,97,86,234,246,114,73,10,217,87,115,112,144,123,127,189,59,105,112,149,99,12,252,252,
+184,68,125,133,186,125,225,180,171,149,9,165,45,133,135,64,49,228,197,155,35,193,140,129,98,158,25,227,25,52,89,240,201,249,169,158,49,218,93,237,152,119,226,235,31,143,210,79,46,201,117,2,79,134,103,97,187,66,200,30,6,0,0,128,194,187,185,34,66,46,203,
+84,160,174,185,194,79,78,107,52,237,54,244,123,173,212,235,157,186,39,187,232,53,209,89,95,118,165,207,64,191,138,210,36,185,93,231,66,239,20,0,25,112,34,83,191,164,43,121,147,225,49,248,211,221,30,218,90,105,167,70,167,69,9,24,115,32,149,3,174,50,214,
+187,231,109,142,239,71,42,199,47,163,217,171,200,16,40,134,188,224,217,161,178,36,29,160,227,226,51,99,178,225,64,48,55,33,42,30,240,83,195,244,18,239,225,72,12,89,183,0,32,180,49,100,72,1,128,32,170,44,147,116,93,69,152,54,212,141,209,50,167,159,42,
+93,62,106,168,236,39,187,37,55,131,198,64,216,65,231,7,107,104,208,235,164,43,62,7,189,221,235,166,83,67,22,186,28,214,86,73,52,0,0,208,14,142,39,112,156,129,104,92,250,125,226,125,57,208,51,70,159,88,225,74,90,82,227,229,190,113,165,9,44,136,11,129,
+98,200,27,254,242,7,99,147,180,169,210,62,83,174,65,230,153,177,68,28,48,198,82,9,40,180,141,46,11,185,77,6,186,24,140,82,71,96,118,150,85,124,224,13,11,147,109,240,64,132,227,251,74,95,250,37,92,188,178,33,89,249,9,62,239,162,70,241,108,106,191,159,
+222,176,129,222,26,202,174,35,180,104,10,121,236,68,203,16,77,204,118,45,52,217,63,51,183,214,6,104,115,227,21,106,168,24,164,149,149,189,121,125,61,14,56,175,173,59,55,243,247,125,211,109,242,135,188,21,116,186,119,57,189,223,87,70,191,237,45,22,230,
+179,133,235,247,226,44,54,248,63,105,136,82,185,123,254,164,4,175,9,156,240,140,211,182,90,181,246,104,113,48,9,2,0,34,226,44,233,191,255,104,148,218,156,22,170,182,78,93,111,67,19,147,116,202,23,70,146,157,4,138,214,124,253,184,220,107,229,1,64,247,
+184,166,220,150,74,59,149,152,141,228,137,196,232,24,79,68,104,40,131,146,235,203,110,170,114,204,90,46,25,207,202,143,7,140,183,213,134,232,241,61,71,212,219,72,73,61,118,232,238,140,1,88,18,228,248,222,254,207,123,50,254,14,55,180,75,12,22,243,231,
+228,233,46,15,106,46,206,241,103,235,71,232,193,205,199,85,221,134,223,255,151,221,82,14,238,11,249,93,224,192,222,35,207,109,18,230,56,253,96,247,169,89,1,200,66,58,211,219,68,159,57,124,157,90,187,190,96,107,156,49,218,222,56,70,27,27,123,85,59,102,
+153,92,24,172,163,87,59,155,232,229,110,183,170,65,99,92,191,23,39,219,235,247,92,251,27,163,244,23,119,255,66,184,253,201,5,62,79,248,195,22,58,63,84,170,148,101,233,24,178,75,59,193,164,54,30,91,220,95,239,34,151,229,234,185,193,27,142,209,179,61,94,
+77,221,83,181,216,77,116,75,185,141,172,6,3,13,4,34,116,112,16,37,8,1,0,25,197,0,32,185,253,53,197,212,82,122,117,160,80,67,38,229,239,47,94,242,105,34,139,146,179,136,55,87,59,230,61,206,53,159,254,159,122,55,253,224,163,81,4,1,97,70,188,99,59,127,110,
+46,4,162,248,108,164,176,171,245,180,234,219,240,96,235,32,125,171,125,153,234,219,33,178,10,215,16,125,103,247,219,244,7,255,222,166,247,67,33,141,7,154,199,232,150,198,1,218,208,120,70,248,77,230,204,230,7,249,103,243,84,208,248,240,201,53,244,203,
+110,23,178,51,53,238,138,134,187,236,199,39,101,54,52,206,126,156,3,200,167,251,170,232,104,119,41,2,199,89,224,32,241,195,77,37,74,51,224,68,28,52,230,199,127,120,78,27,19,240,115,147,11,248,207,235,203,109,154,217,63,0,88,60,4,138,1,64,90,60,11,158,
+24,36,78,116,207,114,39,141,157,31,155,87,162,65,54,219,107,146,215,249,166,233,134,44,123,106,157,51,193,65,128,56,148,154,72,141,3,89,28,128,84,219,61,173,239,209,183,218,119,8,121,140,68,194,193,188,191,221,90,73,95,62,218,160,247,67,33,44,46,157,
+192,19,31,91,154,207,10,241,221,90,12,254,156,125,246,142,94,250,227,176,131,218,187,86,211,255,106,95,129,198,120,160,25,28,64,230,31,46,195,18,152,254,140,191,222,189,140,14,158,159,159,136,144,206,222,74,59,173,43,179,41,201,10,177,137,73,186,18,136,
+105,242,30,148,51,137,231,6,137,227,248,113,45,220,123,243,123,153,172,92,25,239,31,7,195,255,166,115,68,149,237,2,0,49,204,175,44,13,0,32,137,59,147,100,218,38,226,165,84,178,75,215,45,150,149,219,48,144,5,88,136,109,205,23,132,56,94,92,71,149,131,214,
+144,217,237,45,239,41,229,66,64,44,28,32,254,98,219,21,122,230,83,47,211,190,182,55,164,13,18,39,226,239,37,127,222,158,250,212,11,244,183,91,207,43,37,52,0,180,36,254,25,255,111,59,127,77,255,231,15,94,87,190,195,217,124,206,57,176,120,67,165,125,230,
+190,148,3,138,28,104,124,180,169,68,115,159,15,167,57,253,189,245,50,187,252,247,222,28,240,79,133,223,219,29,105,158,7,0,237,67,70,49,0,72,43,211,141,92,149,29,167,56,0,61,227,229,163,15,173,42,153,25,216,58,157,227,66,213,75,221,189,254,44,61,211,137,
+178,10,217,224,154,210,125,222,29,11,206,128,131,220,139,103,16,115,86,60,7,157,180,138,131,105,252,115,188,227,122,100,24,131,38,241,228,206,190,182,33,37,211,56,211,231,252,250,10,123,210,199,185,28,3,151,187,210,210,74,166,162,12,213,103,82,101,27,
+203,36,83,34,202,114,135,137,8,243,179,0,186,133,140,98,0,144,86,108,50,125,47,206,128,14,234,107,101,58,6,0,122,198,203,39,19,7,67,171,86,124,36,212,209,224,229,238,220,200,10,178,243,231,219,78,208,205,21,17,28,45,21,237,109,240,207,100,16,107,57,72,
+156,136,131,197,255,112,223,171,74,230,37,128,86,165,203,164,231,82,111,233,130,167,55,150,106,43,251,52,211,173,53,55,10,150,29,151,14,73,103,84,195,181,188,1,32,51,4,138,1,64,90,61,190,244,1,131,51,30,249,179,27,250,199,211,215,88,254,221,80,176,96,
+219,2,32,19,94,54,153,152,245,99,183,133,168,174,234,119,194,237,193,190,214,30,1,182,66,14,28,152,124,236,238,55,149,140,86,40,44,14,28,253,96,247,41,101,185,186,94,2,196,137,120,159,57,56,254,111,191,223,142,201,29,208,180,100,19,35,158,72,250,196,
+139,208,132,182,18,51,6,252,233,239,189,187,52,144,61,205,245,165,211,249,237,40,206,115,0,122,134,64,49,0,72,235,64,255,56,121,195,201,111,116,248,241,95,143,200,31,68,229,102,25,169,50,163,207,123,195,154,216,71,128,66,88,94,115,73,200,227,188,161,
+241,12,234,160,46,0,47,149,254,206,238,183,169,216,80,68,215,58,208,189,63,31,248,216,174,178,94,93,126,206,181,180,57,112,36,82,217,22,181,240,42,128,199,247,28,65,118,49,104,90,226,196,8,175,226,232,143,78,164,205,162,253,205,176,182,238,69,249,222,
+59,221,248,130,199,31,178,59,212,231,75,153,85,220,49,26,82,222,115,0,208,47,20,240,4,0,169,61,113,206,67,251,107,138,105,149,203,162,44,49,231,27,89,158,233,215,194,77,92,220,223,125,56,170,236,99,157,195,68,86,163,129,124,145,152,146,45,141,32,49,64,
+246,26,150,183,11,123,180,238,111,29,160,199,79,212,9,176,37,114,224,96,221,83,123,47,208,251,103,174,167,123,137,232,228,112,144,158,191,172,191,44,215,92,227,0,241,125,181,78,170,119,77,5,224,39,13,81,170,93,113,146,110,104,124,87,75,187,153,19,28,
+68,187,185,161,142,190,112,120,3,93,14,203,95,175,20,32,25,62,215,126,99,207,40,253,203,235,27,233,229,62,11,221,179,220,57,239,183,56,168,216,17,72,159,129,43,163,196,241,5,77,151,122,227,149,140,90,25,95,112,32,248,135,231,60,180,167,214,57,211,24,
+155,247,145,87,42,98,124,1,0,8,20,3,128,244,148,155,54,13,5,134,147,209,82,224,27,160,16,120,160,115,243,116,135,246,186,154,126,50,25,197,13,36,110,105,57,77,85,237,181,8,56,45,0,151,17,25,243,149,209,249,139,43,105,125,185,141,66,177,73,122,97,40,32,
+205,246,139,40,49,72,204,165,90,110,186,238,63,200,85,44,102,38,190,8,56,136,246,204,167,70,233,43,135,182,208,91,67,200,110,7,109,226,236,226,207,222,113,84,105,118,247,196,107,171,102,2,139,122,72,90,208,250,248,130,131,197,156,61,13,0,48,23,74,79,
+0,0,0,128,38,61,221,229,81,150,137,174,110,120,75,232,221,83,150,249,54,143,10,176,37,114,89,219,244,178,50,9,192,90,74,173,122,63,28,75,82,99,54,204,4,137,157,206,113,218,220,118,16,65,226,44,240,119,247,27,123,142,41,229,57,0,180,140,107,23,63,122,
+91,23,253,159,1,15,125,243,236,8,125,191,123,12,153,167,0,0,26,133,64,49,0,0,0,104,18,103,203,188,27,184,76,118,235,144,240,187,183,171,245,180,0,91,33,159,117,215,252,135,18,216,116,154,113,75,187,20,229,230,169,165,199,101,165,99,116,203,13,47,8,157,
+129,47,154,120,198,37,130,197,160,117,28,44,230,26,241,104,40,10,0,160,109,184,171,6,0,0,0,205,218,215,218,35,197,174,113,147,182,189,13,8,206,45,20,7,52,57,176,57,30,149,191,11,189,154,206,7,163,74,118,246,199,174,127,30,65,226,69,66,176,24,244,128,
+75,174,252,229,38,57,174,171,0,0,176,56,8,20,3,0,0,128,38,173,113,198,104,67,227,25,105,118,109,111,107,151,0,91,33,31,14,108,110,190,233,24,178,220,150,224,99,213,65,106,109,126,73,218,237,23,5,130,197,160,7,156,89,252,183,91,207,227,189,6,0,208,40,
+4,138,1,0,0,64,147,62,221,118,81,170,221,90,91,119,142,110,174,136,8,176,37,242,169,41,187,132,44,183,69,226,207,220,87,119,30,151,114,219,69,196,193,98,172,14,0,173,227,96,49,38,69,0,0,180,9,129,98,0,0,0,208,28,206,46,109,91,245,161,116,187,117,223,
+250,94,1,182,66,78,28,184,248,98,219,21,189,31,134,5,225,172,123,110,198,198,117,118,33,119,254,124,219,9,76,250,128,230,253,241,230,55,241,57,7,0,208,32,4,138,1,0,0,64,115,246,53,143,74,25,252,226,96,39,74,40,44,222,190,182,55,144,229,150,37,254,156,
+253,247,187,223,65,144,56,15,6,199,74,53,183,79,0,115,241,185,227,139,91,223,195,113,1,0,208,24,4,138,1,0,0,64,115,118,181,158,150,118,151,30,108,29,84,229,117,247,215,20,211,127,93,93,74,143,54,149,208,142,50,155,42,219,144,11,200,114,203,14,151,234,
+224,198,84,144,91,23,6,235,232,11,135,55,208,91,67,102,28,89,208,60,62,135,252,217,250,17,188,209,0,0,73,20,27,138,168,205,105,161,93,21,118,229,191,252,119,25,152,240,102,230,23,127,24,214,151,88,169,220,102,36,95,120,130,194,19,147,244,230,72,144,62,
+240,99,0,3,0,0,144,15,156,81,90,225,26,146,246,216,222,211,250,30,125,171,125,71,65,95,147,131,195,46,139,113,230,239,155,171,29,180,220,97,162,31,93,242,21,116,59,114,129,179,220,184,156,194,3,63,217,78,151,195,114,220,144,23,26,127,71,56,123,29,114,
+235,120,199,245,244,237,19,245,248,220,129,174,220,119,243,219,244,124,39,206,183,0,0,137,148,224,240,50,251,236,199,136,232,228,112,144,158,191,44,246,106,46,100,20,231,209,39,107,139,105,215,10,39,213,187,204,228,52,27,168,166,216,164,252,249,222,122,
+151,242,28,0,0,0,228,222,182,230,11,82,31,85,14,116,22,178,124,194,222,74,251,172,32,113,92,131,203,66,45,118,57,115,10,248,24,126,103,247,219,40,227,145,4,215,37,230,172,107,200,45,14,18,127,249,104,3,130,101,160,59,124,190,85,107,37,12,0,128,136,56,
+222,55,55,72,28,183,190,220,38,124,60,80,216,64,113,141,217,160,28,188,71,86,186,149,31,254,243,181,14,121,150,112,241,236,65,115,137,53,229,243,252,156,204,203,58,1,0,0,68,196,37,7,214,214,157,147,254,189,217,189,254,108,193,94,171,218,158,250,254,106,
+133,77,222,197,103,188,36,154,203,43,192,108,95,186,227,12,234,18,231,216,143,95,191,93,9,18,3,232,21,175,132,193,196,28,0,0,41,113,203,116,177,64,154,142,7,138,28,223,20,50,80,204,65,214,71,174,41,85,14,30,103,225,242,15,255,153,51,113,31,90,238,18,
+190,174,135,82,135,36,197,236,65,162,155,43,51,255,14,0,0,0,100,239,190,245,218,168,185,202,65,206,109,181,161,130,188,86,104,98,162,32,175,163,6,46,175,240,197,182,43,154,221,191,133,218,219,224,215,196,68,138,72,254,241,213,173,244,79,39,203,244,126,
+24,64,231,120,242,137,155,200,2,0,232,93,107,137,37,171,35,144,237,239,169,65,184,64,49,103,217,166,11,178,114,233,134,221,213,142,130,110,211,66,53,100,153,125,99,49,22,209,42,235,252,165,158,0,0,0,176,112,188,164,94,75,117,87,247,181,22,38,27,246,55,
+195,193,164,143,199,38,38,233,215,35,201,159,147,201,190,182,55,10,90,202,67,84,156,237,247,233,205,239,232,253,48,228,76,32,236,160,71,159,187,135,158,233,116,107,100,143,0,150,70,230,38,178,0,0,185,226,54,101,23,227,203,246,247,212,32,220,122,194,108,
+178,108,57,187,120,213,112,144,186,66,177,130,108,83,62,217,141,28,171,151,127,63,160,112,120,50,229,166,10,27,25,139,166,50,235,251,252,17,58,50,224,167,254,168,118,51,194,0,0,178,177,183,101,88,83,199,105,67,227,25,90,227,108,162,179,190,252,222,72,
+118,4,162,244,250,128,159,54,85,57,104,250,210,66,225,216,36,189,220,63,158,215,215,45,36,174,201,219,49,180,133,222,26,146,167,140,89,174,113,13,81,89,155,60,14,121,43,232,138,183,100,230,239,54,83,17,185,173,69,228,118,246,146,201,88,248,50,26,28,36,
+254,202,33,125,127,158,0,230,226,243,11,151,127,194,247,2,100,21,31,103,219,77,83,249,148,129,232,4,29,29,240,211,155,222,48,222,83,208,21,161,2,197,92,163,131,179,108,179,177,206,105,161,174,80,64,237,77,94,178,64,12,193,61,200,222,220,174,244,52,221,
+108,232,51,78,11,253,239,158,49,101,176,15,160,150,199,14,221,45,221,177,63,53,36,238,146,31,88,56,174,145,168,53,247,183,14,208,227,39,234,242,190,87,156,57,204,63,27,93,22,26,139,78,104,238,122,194,203,162,191,177,231,24,61,240,19,125,118,230,231,108,
+98,89,190,31,23,6,235,232,131,190,90,122,183,183,148,78,15,89,211,78,148,108,116,221,160,124,94,93,142,0,181,213,250,232,186,186,65,90,87,215,147,215,26,204,188,125,95,56,188,65,51,159,35,110,194,247,82,103,141,0,91,178,48,50,95,191,135,61,171,231,61,
+22,153,152,164,145,64,250,26,191,197,150,160,82,150,72,100,191,215,124,133,222,42,192,53,11,32,215,246,215,20,83,75,233,236,186,178,28,48,190,103,185,147,86,141,134,232,128,196,147,231,124,111,231,54,25,52,177,74,76,6,131,161,168,82,62,55,19,254,61,81,
+9,21,40,174,213,72,25,134,243,193,168,146,137,147,41,232,237,139,76,104,34,43,90,100,53,38,3,221,95,239,34,167,217,168,100,73,77,78,18,13,248,163,116,168,207,39,93,6,46,95,188,146,117,165,103,188,111,159,88,225,162,111,158,29,41,248,118,1,196,189,210,
+151,190,104,63,232,7,215,234,231,50,76,124,61,28,159,40,76,115,27,46,45,160,197,6,93,91,90,78,83,85,123,109,193,130,82,90,206,154,225,207,199,119,118,191,173,169,32,95,182,56,155,88,228,239,7,103,232,30,235,88,71,207,190,95,189,160,12,250,153,207,107,
+192,76,111,13,149,17,41,181,130,215,40,181,152,239,108,185,164,100,229,231,210,153,222,38,250,234,145,107,53,245,249,185,226,115,20,252,250,29,111,224,243,129,63,82,208,215,21,197,155,239,222,54,111,75,94,238,27,167,215,60,217,212,165,111,83,234,215,
+223,222,56,68,55,55,118,11,183,74,224,218,218,62,34,66,160,24,228,210,98,55,205,11,18,39,226,231,90,60,33,233,38,209,31,89,233,158,21,176,220,92,237,32,111,56,70,207,246,120,177,26,57,143,78,140,4,149,42,8,153,226,129,39,4,14,220,11,21,40,30,141,104,
+227,195,202,131,226,183,6,3,202,23,49,157,99,3,98,15,104,227,51,79,23,131,81,41,51,139,120,251,121,6,48,17,7,84,249,100,249,112,83,9,253,240,156,71,170,19,228,106,119,250,204,9,62,17,241,62,99,105,12,0,168,105,95,149,131,214,151,219,102,182,224,228,112,
+144,158,191,156,255,235,221,238,245,103,53,249,190,199,27,4,161,89,86,110,112,54,222,95,110,170,164,47,31,109,208,194,238,100,77,212,108,98,14,16,191,248,254,245,244,227,247,43,115,26,124,61,120,222,65,7,207,175,81,74,183,252,249,230,115,57,9,24,115,
+230,173,222,62,55,185,198,189,89,56,177,193,105,158,90,214,189,39,54,73,191,234,27,167,118,159,190,238,93,71,130,49,42,179,93,157,16,225,235,100,118,65,226,41,28,216,127,165,175,142,232,68,157,50,73,202,165,117,68,153,8,226,115,108,149,69,127,147,113,
+32,183,59,179,232,129,117,75,185,141,58,46,249,164,217,207,100,43,145,25,63,38,99,44,132,19,0,239,174,118,80,149,221,164,148,224,28,14,198,232,216,160,95,200,56,85,127,100,130,142,95,246,211,246,218,226,148,191,195,147,131,253,2,199,63,133,10,20,95,90,
+64,234,181,71,240,15,53,167,245,187,205,134,89,131,229,68,47,11,124,83,180,183,210,78,215,87,216,103,234,20,50,206,196,61,113,217,47,213,114,133,187,210,124,49,141,134,34,122,104,85,137,84,25,184,188,205,153,172,115,35,80,12,0,234,217,85,97,159,119,221,
+227,191,135,98,147,244,194,80,254,202,69,113,118,149,232,203,113,151,130,27,4,253,211,201,205,242,238,128,96,184,225,225,23,125,14,250,86,251,50,93,236,175,168,217,246,111,119,175,165,239,190,158,223,26,220,252,111,255,197,145,53,180,173,182,158,254,
+116,211,201,69,159,39,158,111,191,85,55,159,151,124,218,95,239,158,149,97,197,127,190,179,182,152,46,117,71,133,30,48,231,218,247,186,61,74,208,156,123,213,12,71,98,75,218,119,110,166,248,203,238,237,202,106,9,81,174,131,183,214,6,148,201,26,0,89,240,
+234,227,76,172,6,131,52,251,195,181,150,83,173,68,166,233,184,194,158,90,39,61,121,65,142,70,191,28,159,186,97,78,47,51,78,254,219,95,236,166,14,65,203,130,240,228,223,72,100,130,110,171,176,207,202,234,238,31,143,210,107,67,1,225,87,212,8,21,40,230,
+139,100,143,55,66,245,174,244,5,240,185,100,195,66,102,93,213,194,25,84,239,120,66,116,99,137,149,42,173,83,135,154,235,144,112,138,185,168,55,67,201,106,243,208,116,38,46,103,72,87,88,141,82,212,231,225,147,89,117,96,235,0,0,32,0,73,68,65,84,99,166,
+192,42,223,156,242,50,19,45,213,97,12,198,10,179,196,27,0,32,153,38,87,242,149,15,124,93,201,103,160,120,95,107,143,166,223,15,94,90,204,75,233,49,240,206,157,125,109,111,80,191,119,171,18,100,209,58,17,179,237,127,252,250,237,5,205,146,87,50,48,255,
+189,141,30,219,84,75,59,91,219,23,244,255,254,227,171,250,248,156,228,91,170,94,52,252,216,117,78,11,245,235,172,118,230,84,249,193,220,148,32,228,236,93,46,169,243,228,189,33,33,74,81,172,169,28,39,194,245,10,36,18,227,172,56,210,78,22,252,218,146,204,
+53,220,171,29,66,133,2,83,226,21,211,115,131,196,137,120,140,177,35,20,19,50,161,145,131,193,241,128,112,141,217,32,213,132,168,112,211,34,63,235,243,41,203,113,82,225,218,191,63,191,232,85,123,51,179,198,55,1,28,48,230,217,26,254,225,63,139,250,1,201,
+84,155,135,166,191,136,53,38,241,103,211,154,156,217,53,184,88,97,147,227,4,73,211,93,87,51,121,87,130,9,20,0,208,174,98,115,242,235,131,37,139,21,17,139,181,198,25,203,121,29,82,17,237,109,237,210,252,62,22,26,47,215,230,14,253,90,198,251,39,90,182,
+61,7,94,213,42,165,194,141,33,255,199,75,59,148,146,23,153,240,239,240,239,34,72,156,127,214,60,94,35,244,130,131,197,143,31,217,40,196,222,54,84,140,10,176,21,0,217,235,241,101,190,23,24,8,200,115,191,144,77,134,116,145,36,167,221,173,89,148,5,185,57,
+77,32,89,20,178,173,154,17,46,226,199,245,125,159,234,25,163,78,79,72,9,10,39,226,108,227,167,187,61,104,0,151,39,183,164,40,147,49,215,22,9,190,136,161,9,237,45,95,251,221,80,250,89,178,128,6,187,212,3,128,92,250,253,201,207,65,169,30,207,133,251,91,
+7,116,241,41,89,91,119,78,243,65,205,66,227,114,12,223,216,115,76,153,108,208,170,223,107,190,34,212,158,137,144,157,203,153,249,95,57,180,133,134,188,21,41,127,135,131,196,252,59,200,226,207,29,110,110,154,202,105,157,213,40,206,151,183,134,204,74,45,
+109,181,57,44,120,63,65,46,188,98,58,150,166,249,50,199,165,14,14,230,111,101,92,174,133,98,218,137,133,216,179,72,82,204,212,52,14,22,78,200,212,80,14,22,255,180,111,92,169,31,251,92,143,87,249,249,118,231,8,61,125,201,171,171,250,85,133,150,109,221,
+157,146,44,102,168,212,118,122,44,187,27,148,139,105,110,90,69,195,203,41,184,6,79,50,124,241,250,215,110,57,106,12,1,128,118,113,83,137,185,147,188,252,119,126,60,31,170,44,147,180,165,229,180,110,62,81,247,173,215,110,29,102,181,112,176,248,191,223,
+253,142,242,89,210,162,155,27,187,133,217,43,174,243,43,74,118,46,7,212,30,121,110,19,93,24,172,155,247,28,63,246,159,127,118,135,242,59,144,59,60,190,227,30,45,115,113,35,55,36,1,229,206,207,78,206,255,76,23,90,67,101,191,148,199,14,244,141,155,187,
+205,189,135,165,233,251,216,167,187,60,82,29,155,222,44,18,52,188,97,156,119,33,53,225,215,221,139,94,228,25,196,196,13,221,182,199,38,211,206,46,241,201,81,182,12,92,158,237,108,241,132,148,236,239,120,96,255,156,47,44,85,147,65,0,208,46,30,236,243,
+202,159,13,110,43,45,119,152,233,146,63,66,111,143,133,242,54,201,187,175,121,84,149,38,93,92,95,245,193,205,199,11,254,186,220,132,173,234,68,61,186,201,231,24,151,102,248,218,29,110,165,233,153,150,112,6,186,8,245,74,217,153,222,38,225,154,193,197,
+235,186,126,103,55,205,148,231,224,32,49,63,134,239,88,126,112,143,153,143,252,17,229,26,193,186,3,81,140,245,114,140,39,56,56,35,94,205,6,150,34,54,207,4,200,164,63,58,161,36,42,114,77,92,110,16,79,211,201,103,50,54,138,231,152,193,87,221,150,180,61,
+155,126,145,100,226,78,68,92,62,90,150,50,25,90,34,79,129,86,200,59,79,36,70,53,89,124,36,100,169,207,195,51,127,15,55,149,36,61,65,242,210,146,103,123,228,169,117,157,136,131,219,29,151,124,226,108,144,206,21,27,138,232,214,18,171,82,23,123,44,26,163,
+139,254,168,20,205,54,1,242,133,131,194,74,227,186,60,54,175,139,219,213,90,248,108,98,94,174,206,245,85,239,104,174,83,165,246,235,131,173,131,194,5,220,180,128,235,92,63,182,169,88,169,97,171,21,109,181,98,220,43,112,208,234,155,175,174,21,96,75,230,
+75,108,2,118,186,119,57,125,59,135,19,49,109,78,11,109,169,118,144,115,186,118,59,103,206,114,175,18,189,155,185,70,64,222,156,31,172,81,202,21,129,28,248,92,81,109,157,90,177,139,201,19,245,113,96,88,198,224,240,92,156,33,253,208,170,146,164,137,115,
+47,94,242,73,147,48,55,224,143,82,77,113,250,24,21,178,163,115,15,129,98,152,193,51,79,95,43,177,166,157,177,225,0,171,44,245,121,120,86,144,79,144,119,87,59,168,214,113,117,249,96,151,55,172,236,43,192,82,173,178,26,105,127,189,123,230,2,204,19,45,205,
+37,86,186,169,204,166,212,90,31,79,83,235,10,0,150,102,111,131,95,149,108,201,99,157,83,89,167,135,79,174,161,207,222,81,248,64,241,61,173,239,209,183,218,119,20,252,117,245,96,103,107,59,157,27,114,106,166,121,217,117,117,131,2,108,5,209,139,239,95,
+79,103,125,226,150,45,227,192,240,127,61,116,75,78,183,145,187,155,239,90,225,156,245,216,250,114,27,133,98,147,8,146,66,222,157,31,42,163,181,26,152,243,226,100,140,187,43,237,202,189,53,223,107,251,34,19,116,108,192,79,237,26,169,105,205,251,247,169,
+229,174,89,65,176,54,34,186,109,60,74,63,185,228,197,56,2,150,36,49,67,250,198,210,169,94,84,156,240,247,219,209,144,242,156,44,14,245,249,232,51,215,148,166,141,81,201,146,29,45,19,4,138,97,150,151,122,125,116,207,114,103,210,131,194,105,255,191,148,
+236,75,200,39,193,31,33,251,86,8,187,42,236,212,82,106,85,50,107,184,214,211,251,195,65,58,58,18,148,250,38,232,19,43,92,73,103,105,203,108,70,218,93,237,80,106,173,3,64,126,236,109,237,82,229,200,30,236,40,87,254,251,203,110,23,125,86,133,215,231,37,
+189,15,52,143,105,38,152,41,154,207,222,113,148,58,134,238,209,68,125,218,117,117,61,170,111,3,103,19,255,248,253,74,213,183,35,147,92,7,178,227,165,21,230,106,114,89,10,178,218,98,33,246,181,189,65,251,218,132,218,164,89,184,108,201,103,14,95,39,208,
+22,137,207,31,214,70,125,237,251,106,157,84,239,186,186,47,206,248,4,204,69,159,38,130,197,188,127,201,50,37,249,49,217,199,17,60,89,182,179,170,120,230,253,211,90,144,95,38,178,103,72,115,60,231,127,247,140,37,29,119,115,76,225,229,254,113,52,244,207,
+3,33,155,217,129,122,248,36,242,228,135,163,52,28,140,206,116,254,228,255,246,143,71,233,7,31,141,106,98,25,6,20,222,39,107,139,169,109,153,125,102,249,37,159,228,249,239,60,139,46,43,94,38,22,223,159,100,56,251,1,0,242,131,107,175,170,177,172,246,237,
+238,181,51,1,37,206,66,84,171,187,252,238,245,103,85,121,93,189,248,198,158,99,180,198,41,247,50,70,254,142,136,80,39,148,179,137,81,239,247,42,51,58,179,3,100,133,87,237,37,6,137,19,109,170,180,75,127,16,57,144,154,106,255,104,122,28,81,156,166,190,
+172,200,120,223,30,106,44,73,26,228,191,13,227,35,88,4,14,4,115,118,180,82,50,99,52,164,252,240,159,249,49,196,167,242,3,25,197,48,15,207,218,124,191,123,12,7,6,114,226,90,135,57,101,208,148,103,204,57,224,42,227,236,114,188,150,24,0,20,222,125,235,11,
+95,242,129,253,166,187,122,214,223,95,234,172,81,26,204,21,26,215,70,222,86,187,158,94,233,195,128,43,31,56,192,250,223,239,126,71,234,166,102,117,78,49,106,92,198,51,240,245,198,147,98,89,111,47,106,143,66,1,52,84,140,74,127,152,237,198,212,201,24,188,
+114,79,118,229,230,204,251,208,96,51,73,89,175,120,107,165,61,101,67,249,219,171,28,232,229,2,139,166,149,250,209,50,64,70,49,0,228,85,163,61,253,124,148,172,1,215,84,131,64,0,200,175,42,203,164,42,193,89,94,66,63,183,220,3,7,106,185,185,157,26,118,54,
+247,171,242,186,122,193,193,248,175,221,241,161,180,123,187,166,82,253,37,203,23,6,235,132,174,77,156,79,28,8,233,156,19,12,25,9,198,232,240,0,154,217,65,254,45,115,106,59,225,135,203,24,232,65,32,38,231,126,186,77,169,207,251,28,64,190,214,161,141,210,
+40,0,90,134,64,49,0,192,34,188,227,13,43,117,145,82,225,114,45,0,144,123,15,182,170,211,160,235,88,199,186,228,143,79,55,183,43,52,14,150,203,94,30,65,116,27,26,207,208,99,155,212,201,94,95,42,17,50,10,95,237,108,82,125,27,212,196,245,69,255,181,203,
+67,175,15,248,233,133,139,62,250,94,183,7,205,169,32,239,120,50,149,39,186,100,199,153,180,169,2,194,188,236,92,203,251,71,211,193,240,174,16,174,241,0,160,14,148,158,0,128,188,26,200,112,147,35,107,102,46,15,246,142,95,246,211,246,218,226,121,207,113,
+0,249,80,191,254,154,40,254,96,247,41,1,182,34,57,238,0,254,248,9,13,180,0,7,186,167,181,240,217,196,236,23,157,203,146,62,206,75,235,213,106,4,117,127,235,0,62,215,121,182,179,181,157,206,13,57,165,107,30,232,176,168,191,52,179,189,47,121,115,100,61,
+225,64,15,130,61,80,72,251,154,213,159,36,226,213,4,185,240,243,139,94,250,120,173,115,86,169,137,147,195,65,122,65,176,134,144,139,197,205,221,148,230,124,73,188,36,113,35,187,177,104,140,106,82,132,153,120,140,36,99,57,13,0,189,65,160,24,0,242,138,
+235,15,111,24,143,38,237,234,203,203,48,101,174,83,197,219,62,18,153,160,141,101,54,42,183,25,41,18,155,164,43,161,168,178,180,84,143,89,67,106,52,23,203,30,103,182,33,160,38,187,7,154,199,84,105,208,197,131,222,183,134,146,47,149,228,165,245,220,228,
+142,179,79,11,109,75,203,105,170,106,175,69,179,176,60,251,236,29,71,169,99,232,30,169,182,185,161,82,253,210,36,169,190,51,0,144,31,156,77,124,223,205,111,171,126,116,199,195,182,156,252,59,60,201,194,153,248,220,216,142,107,22,15,71,98,212,175,161,
+178,19,60,70,10,244,120,149,113,68,188,241,91,143,55,66,199,6,253,82,79,48,241,56,232,243,78,75,210,58,197,156,100,3,0,226,67,160,24,0,242,238,39,151,188,116,119,165,157,214,151,95,189,113,228,218,125,90,168,213,199,179,226,152,25,7,40,140,221,235,207,
+170,114,164,15,159,76,95,94,130,155,220,169,17,40,230,160,249,93,141,94,233,178,93,101,244,141,61,199,200,31,146,167,211,190,26,19,42,137,206,244,234,187,236,4,128,26,254,114,83,143,234,223,125,118,186,175,42,167,255,222,84,208,84,155,153,249,90,28,71,
+112,178,204,211,221,30,218,89,85,60,19,0,231,228,160,19,131,1,41,27,152,3,232,17,2,197,0,144,119,124,195,240,252,101,191,242,3,0,176,24,219,106,67,170,213,93,252,101,183,43,237,243,28,168,253,227,205,14,85,6,232,251,219,78,210,51,157,155,11,254,186,122,
+195,239,173,8,1,24,0,128,100,120,197,141,26,141,94,147,233,247,90,241,30,233,28,103,126,63,125,201,171,247,195,0,32,45,4,138,1,0,0,64,120,251,90,123,84,217,196,227,29,215,103,85,218,129,155,221,113,61,219,66,171,112,13,209,222,6,63,29,60,239,40,248,107,
+131,152,68,104,114,152,235,140,194,197,226,99,177,194,85,184,230,178,222,176,1,37,55,160,160,184,220,4,103,18,139,18,36,102,29,67,242,172,190,0,0,128,249,16,40,6,0,0,0,161,113,176,71,141,210,14,236,165,206,154,172,126,143,155,221,237,108,205,251,230,
+36,181,183,181,139,14,158,191,78,157,23,7,225,20,50,48,42,186,189,45,195,180,175,237,141,130,109,37,151,220,248,204,97,124,23,33,255,248,186,200,159,111,110,240,42,210,106,135,64,216,129,201,18,0,0,201,33,80,12,0,0,0,66,187,191,117,64,149,205,27,242,
+86,208,43,125,217,45,161,229,129,49,55,189,83,163,60,6,55,146,92,227,92,171,52,214,3,0,0,177,113,41,165,133,114,89,98,180,166,114,156,150,57,253,212,80,49,168,90,41,166,76,218,187,86,227,211,7,0,32,57,4,138,1,0,0,64,88,188,172,118,75,203,105,85,54,239,
+88,103,250,38,118,115,113,211,187,207,222,161,206,224,253,211,109,23,233,203,71,27,84,121,109,0,0,200,222,227,123,142,104,246,104,189,222,189,76,128,173,0,0,128,165,48,224,232,1,0,128,214,217,76,153,107,204,130,152,246,53,143,170,182,172,246,96,71,249,
+130,126,63,83,211,187,124,226,250,148,28,84,7,0,0,80,3,151,157,64,189,124,0,0,249,33,80,12,0,0,154,231,182,22,209,215,90,202,105,163,203,130,55,91,50,187,90,213,201,38,126,187,123,225,165,28,184,233,29,55,191,83,203,131,173,131,170,189,54,0,0,232,27,
+202,78,0,0,104,3,2,197,0,0,160,11,69,69,68,247,44,119,82,141,9,151,62,89,236,109,240,83,133,107,72,149,173,253,77,119,245,162,254,191,108,155,223,229,195,150,230,179,170,189,54,136,227,212,144,250,19,98,14,75,68,156,3,2,0,5,241,191,218,87,224,64,3,0,
+104,0,70,203,0,0,160,43,91,42,237,154,223,93,173,100,78,239,109,237,82,229,117,121,249,236,51,157,238,69,253,191,220,252,142,155,224,169,129,131,234,15,52,143,169,242,218,32,14,206,108,87,91,67,197,8,62,17,0,58,114,166,183,9,13,85,1,0,52,2,129,98,0,0,
+208,149,18,179,118,7,50,251,107,138,233,177,181,229,74,230,52,255,247,209,166,18,105,51,168,111,174,136,208,218,186,115,170,188,246,177,142,117,75,251,255,23,216,4,47,151,118,175,215,118,86,241,133,193,58,1,182,2,50,89,230,242,224,24,129,144,154,221,
+102,188,49,121,240,63,79,52,107,110,159,0,0,244,10,129,98,0,0,208,149,119,70,131,154,220,221,22,187,137,90,74,173,179,30,115,89,140,116,239,10,167,106,219,180,20,247,173,239,85,237,181,127,209,185,180,174,237,11,109,130,151,75,43,43,123,105,91,109,72,
+181,215,207,183,127,62,177,94,169,31,13,233,169,149,213,30,199,217,237,104,174,8,162,225,137,211,150,50,244,42,200,53,174,205,255,214,16,2,240,0,0,90,129,64,49,0,0,232,134,55,28,163,55,189,97,77,238,238,150,202,228,157,198,203,109,166,130,111,203,82,
+113,128,233,246,150,247,84,121,109,206,88,93,234,128,151,151,223,170,25,204,220,217,220,175,218,107,23,194,95,191,186,154,46,14,33,179,56,157,43,222,18,213,183,225,214,218,128,234,219,0,144,232,58,52,180,205,57,46,213,244,237,19,245,26,219,43,0,0,125,
+147,111,244,8,0,0,176,64,19,147,147,212,49,26,162,3,253,227,56,116,18,120,176,117,80,181,141,116,88,67,244,131,221,167,150,252,239,168,185,244,158,131,236,107,218,87,104,182,94,36,215,224,125,236,165,27,233,31,238,27,37,187,197,47,192,22,137,103,208,
+171,254,74,130,27,234,70,233,224,249,228,19,88,0,160,13,223,125,101,147,16,117,209,1,0,32,119,16,40,6,0,0,205,27,244,79,106,62,72,124,206,23,166,154,226,249,151,245,64,116,66,149,237,89,138,123,90,213,201,38,166,233,37,243,252,35,187,251,91,7,232,241,
+19,218,205,186,229,32,248,87,14,109,161,39,238,125,81,128,173,17,207,21,159,250,1,218,155,27,187,137,52,252,25,4,249,156,242,134,233,227,88,80,155,51,47,189,223,134,201,32,0,0,13,66,160,56,11,220,61,222,61,221,12,232,215,35,218,172,109,9,0,0,114,227,
+235,83,107,153,85,169,75,28,55,57,73,116,232,146,79,170,253,122,160,121,12,89,162,57,176,165,229,52,85,181,215,106,58,211,139,75,132,252,227,171,91,233,179,119,28,21,96,107,196,114,118,176,88,245,237,225,9,23,174,151,253,74,159,53,139,223,6,200,191,254,
+232,4,117,121,98,244,49,28,235,37,59,211,219,164,233,201,72,0,0,17,236,173,180,83,115,169,149,140,69,83,247,243,161,216,4,253,162,111,156,58,2,209,188,110,29,2,197,105,236,40,179,209,166,42,7,21,37,140,177,54,87,59,232,188,55,76,63,146,108,224,13,0,0,
+218,247,196,57,143,50,185,185,206,109,161,209,80,140,14,14,202,87,35,116,247,250,179,2,108,133,252,56,216,126,87,163,151,158,233,116,107,122,63,121,255,154,42,218,104,103,107,187,0,91,35,142,211,67,98,4,103,185,94,246,43,125,13,2,108,9,164,50,236,89,
+77,3,195,181,116,102,56,34,228,49,234,247,230,246,179,124,114,52,76,159,204,233,191,168,63,92,203,255,171,71,174,213,251,97,0,0,200,171,71,155,74,102,37,0,49,139,209,72,251,27,220,121,47,169,152,247,64,49,119,151,141,55,14,224,229,62,253,146,44,129,229,
+200,253,13,149,246,164,207,53,184,44,244,185,70,55,125,191,123,172,224,219,5,0,0,144,14,55,235,147,181,97,31,103,31,174,172,236,21,96,75,180,97,127,219,73,122,166,115,243,162,247,101,127,77,49,173,154,190,135,27,14,198,232,201,11,98,222,247,112,86,91,
+177,37,162,90,3,68,17,113,105,142,33,111,133,234,101,84,114,85,47,155,199,19,247,215,187,200,106,52,80,108,114,146,142,14,248,53,219,152,180,208,134,60,181,244,216,43,229,210,140,209,64,93,28,36,254,194,225,13,168,75,12,0,144,71,143,172,116,207,11,18,
+39,106,41,181,210,142,80,44,111,21,15,242,86,164,137,111,232,56,2,254,200,234,82,37,11,151,127,248,207,95,90,83,70,45,118,177,19,153,121,219,83,5,137,227,184,139,60,103,28,3,0,0,64,110,112,246,33,228,14,7,9,247,54,44,174,140,199,31,45,119,42,55,161,22,
+99,145,242,195,245,175,121,146,92,84,220,117,159,3,24,112,213,249,161,101,66,28,141,63,223,124,110,201,255,198,195,211,89,53,252,89,180,155,12,116,207,114,167,178,122,2,150,238,228,149,8,130,196,144,21,4,137,1,0,10,35,89,223,153,185,110,170,200,95,60,
+50,47,129,98,14,180,62,156,36,77,154,148,84,233,34,37,85,90,228,155,187,143,149,102,183,196,137,107,65,2,100,114,173,195,76,15,45,119,41,179,66,252,179,171,194,78,197,6,220,96,1,0,36,90,227,140,33,35,52,15,246,182,118,45,234,31,93,81,108,158,247,24,79,
+146,139,138,3,23,28,192,8,132,209,88,41,238,55,221,213,66,108,199,134,198,51,202,106,129,197,226,196,12,99,146,251,166,219,150,165,79,234,0,128,220,121,187,123,45,130,196,0,11,212,230,180,40,227,255,199,214,150,43,63,28,19,88,101,93,218,10,27,208,190,
+108,19,82,237,166,252,53,103,205,203,191,204,75,195,146,221,208,37,186,171,86,253,38,27,169,84,219,231,15,142,146,225,229,111,0,233,112,80,248,222,122,23,213,187,204,202,172,16,255,180,45,179,211,159,212,187,17,44,6,0,72,112,127,235,0,14,71,30,172,173,
+59,167,4,225,23,42,211,125,156,136,56,128,241,149,67,91,16,44,158,246,219,94,113,238,181,191,186,243,56,85,89,38,115,250,111,154,112,31,5,80,16,207,183,223,74,127,113,100,13,130,196,0,11,112,91,137,149,118,173,112,206,202,12,229,152,192,31,174,42,81,
+2,200,0,34,203,75,164,51,93,45,141,56,30,128,96,201,24,164,195,39,215,120,38,238,39,107,139,149,204,92,153,240,246,182,165,200,118,41,179,25,233,83,203,93,120,255,1,0,136,148,0,210,150,150,211,56,20,121,242,233,182,139,11,254,135,189,225,249,193,229,
+201,220,198,249,242,226,173,33,51,253,203,235,27,197,223,208,2,224,186,192,162,148,227,224,230,138,127,115,247,7,139,250,127,79,165,168,69,220,227,19,179,249,26,128,86,112,157,243,199,14,221,77,223,106,23,163,140,13,128,44,106,204,6,218,158,38,49,242,
+78,129,147,38,147,225,44,104,142,203,196,51,163,255,203,53,165,74,66,28,228,199,197,96,52,171,127,55,54,145,191,27,243,156,175,33,92,72,221,94,238,202,46,98,35,138,115,190,112,86,53,65,124,145,133,103,232,64,102,156,105,203,25,183,28,76,141,171,33,19,
+53,151,88,169,213,19,162,159,246,229,175,187,99,46,181,150,164,159,8,81,50,140,205,6,234,143,160,46,28,104,195,153,222,38,97,247,227,252,80,153,0,91,1,169,220,213,232,85,2,73,144,31,92,210,163,234,68,253,130,178,193,158,237,241,210,67,171,74,148,146,
+97,52,29,36,126,169,215,71,78,167,248,111,210,51,157,110,170,113,221,74,251,218,222,16,96,107,212,245,106,103,19,61,40,72,131,72,206,110,255,219,173,78,250,242,209,134,5,253,127,92,63,151,187,123,183,36,148,134,227,137,140,124,118,251,6,208,59,206,34,
+254,241,251,149,200,34,6,88,132,13,238,244,37,74,249,222,138,147,202,62,240,139,63,225,201,217,207,156,25,157,200,105,54,40,9,113,203,108,38,122,250,146,87,237,77,204,26,199,153,26,108,38,106,180,155,104,32,20,163,51,254,8,141,231,49,216,186,88,29,129,
+40,133,99,147,51,247,224,169,92,9,228,47,30,169,106,177,57,171,65,204,210,13,220,57,240,150,101,246,140,203,46,127,53,32,230,160,150,79,58,27,203,108,84,227,152,122,123,251,253,81,122,115,36,40,197,137,136,221,87,235,156,21,36,78,196,193,226,29,193,252,
+117,119,204,37,183,41,115,102,125,185,217,136,64,49,104,198,103,14,95,135,55,19,22,101,127,219,73,28,184,60,123,176,117,112,65,89,97,28,156,251,230,217,17,101,245,151,219,100,152,185,238,110,147,32,80,204,120,95,151,57,175,215,125,221,235,151,187,221,
+244,224,102,1,54,100,26,191,31,127,75,180,224,96,49,7,133,107,6,3,116,157,203,162,100,218,240,32,10,0,114,143,107,17,127,247,245,38,101,69,2,0,228,15,7,43,69,143,207,112,96,53,93,246,51,151,210,224,85,224,175,121,22,223,135,160,80,120,59,111,175,114,
+204,10,190,222,25,155,164,183,6,3,66,198,150,94,238,31,87,26,247,166,194,217,196,79,94,24,203,219,235,231,60,82,155,106,121,88,50,156,185,43,170,95,102,200,90,229,204,6,17,111,82,19,107,226,198,59,149,243,159,249,49,254,114,136,142,51,108,121,123,211,
+185,190,60,127,221,29,11,45,16,67,144,24,0,244,109,111,131,159,42,92,67,122,63,12,121,183,165,249,236,162,94,130,87,126,201,48,57,155,204,183,79,212,11,83,122,65,45,28,236,225,192,143,72,56,88,252,111,191,223,190,224,154,197,60,121,193,159,69,4,137,1,
+242,199,97,9,35,72,12,80,0,221,18,92,203,214,58,204,25,179,90,175,205,144,61,45,2,206,138,230,82,32,115,247,133,255,190,185,218,33,100,25,13,190,255,126,241,146,79,201,44,158,139,87,85,253,240,156,39,175,175,159,243,64,49,223,196,5,162,153,131,95,188,
+132,81,228,129,7,191,49,79,126,56,170,188,9,137,53,249,120,223,248,13,19,113,185,91,186,154,184,108,187,4,117,126,57,195,54,19,94,234,32,131,76,19,33,190,200,4,117,133,80,190,4,0,244,109,111,107,151,222,15,65,65,112,48,254,129,230,252,101,30,136,136,
+151,76,115,151,126,189,55,183,251,85,199,114,1,182,98,182,149,149,189,244,204,167,94,86,38,138,0,64,28,92,34,230,207,214,143,224,29,1,88,130,183,199,210,103,216,114,240,239,124,150,117,104,213,84,109,205,28,155,201,166,100,171,218,50,213,132,110,45,183,
+41,217,211,162,225,152,36,175,238,227,248,227,235,3,126,229,231,192,249,49,122,226,156,71,137,187,230,83,94,222,213,67,151,124,180,191,193,157,246,119,78,92,22,255,198,144,15,254,19,121,142,212,231,210,198,44,234,67,243,239,200,82,130,66,118,60,17,178,
+174,196,154,178,140,198,49,65,75,151,128,92,184,217,99,185,205,72,21,101,250,10,0,129,54,172,113,198,148,65,41,20,198,238,245,103,233,153,206,54,93,29,109,14,22,127,229,208,22,250,198,158,99,186,173,131,125,240,188,131,62,237,173,16,46,115,159,223,143,
+255,182,243,215,180,183,183,137,158,105,95,77,175,244,137,159,149,4,160,7,15,110,62,78,237,125,247,40,205,65,245,98,111,165,157,170,237,102,10,77,76,208,111,134,177,114,1,150,134,75,75,182,95,9,164,76,226,251,85,223,184,144,181,113,231,242,100,17,140,
+28,9,138,157,248,118,109,22,89,209,252,60,103,79,183,11,90,241,64,141,190,110,121,9,20,243,137,149,163,222,219,107,230,167,119,115,118,46,7,137,101,93,198,40,178,120,77,226,116,44,2,206,148,36,26,206,162,65,160,79,162,154,190,79,245,140,209,238,106,135,
+82,91,57,142,183,159,131,196,162,158,136,180,168,198,100,160,251,235,93,228,178,76,5,237,249,60,212,227,11,211,143,46,249,164,222,219,71,155,74,102,246,201,36,248,119,27,32,153,79,183,93,196,113,41,32,206,226,220,86,187,94,119,1,57,14,118,252,203,235,
+27,233,179,119,28,21,96,107,212,113,160,125,189,176,251,207,147,69,143,215,157,83,26,162,190,210,185,146,126,217,237,90,82,3,45,158,128,218,222,56,70,27,27,123,49,17,5,176,72,95,220,250,30,253,193,191,235,99,98,241,75,107,202,102,197,44,26,92,22,165,
+204,164,236,13,51,247,215,20,211,42,151,69,217,55,206,96,237,242,134,209,4,180,128,94,24,10,40,13,211,54,85,218,103,18,199,122,188,17,169,122,71,125,228,143,208,246,12,191,115,73,35,73,136,74,246,180,220,161,129,156,202,91,158,56,71,189,249,135,155,160,
+172,115,91,148,198,117,188,20,31,1,98,72,135,103,223,78,14,7,105,125,154,58,196,50,101,226,242,76,225,79,251,198,169,120,192,175,116,216,228,154,196,40,55,81,88,28,36,254,204,53,165,84,148,48,230,228,63,243,77,224,231,26,221,244,253,110,57,51,113,249,
+220,26,15,18,131,62,28,255,211,67,210,236,231,237,255,188,39,227,239,112,125,82,189,55,26,83,195,206,230,126,122,165,111,97,141,196,180,224,153,78,55,213,184,110,165,125,109,111,232,110,223,105,122,255,247,183,137,151,85,156,136,131,186,252,243,89,34,
+37,104,124,186,175,138,222,238,117,147,55,108,72,153,217,200,65,225,21,174,40,53,87,248,105,85,197,24,173,171,187,132,154,231,11,180,204,233,167,109,181,226,55,34,74,5,153,232,249,193,19,139,95,108,171,95,80,19,84,25,253,209,114,103,210,108,195,150,82,
+171,210,64,51,223,203,187,243,37,49,153,132,166,51,38,121,159,30,117,152,164,90,49,45,59,78,12,147,57,57,44,83,102,52,79,64,28,25,12,20,124,187,242,97,0,49,154,89,242,94,80,36,30,48,134,252,235,247,71,51,54,130,11,75,176,196,129,79,54,149,86,83,210,122,
+55,28,68,150,241,100,203,1,99,217,74,126,240,141,83,237,116,77,235,216,228,36,253,110,40,40,229,68,207,158,90,231,172,32,113,162,114,155,137,90,236,38,41,151,151,185,77,114,212,234,6,72,229,193,214,65,28,27,21,112,112,126,77,251,10,93,54,43,226,128,199,
+50,231,245,186,157,160,16,57,171,120,174,120,208,120,159,190,42,165,168,130,191,15,50,127,39,178,153,152,20,205,99,135,238,78,187,69,60,241,193,229,31,212,198,19,107,71,187,181,93,130,162,54,77,255,158,235,92,22,234,151,112,236,147,46,153,132,31,223,
+81,102,147,114,76,199,229,246,150,217,141,100,52,76,101,72,159,30,9,210,65,141,4,41,69,198,153,209,52,93,199,55,113,82,165,127,60,74,135,250,125,194,151,208,224,24,204,206,200,68,218,62,87,252,121,58,131,242,172,179,136,95,121,26,178,198,203,24,50,5,
+138,223,148,224,162,192,39,155,39,47,140,41,221,41,235,29,38,37,104,204,75,26,78,251,194,200,198,45,144,185,179,208,68,83,29,65,43,172,70,233,150,44,149,167,168,17,29,215,82,108,70,29,50,0,21,108,105,62,139,195,174,146,251,91,7,232,241,19,117,186,220,
+247,111,159,168,167,134,138,65,37,91,78,111,56,171,120,247,250,58,93,238,59,128,72,50,101,65,243,243,215,213,173,165,13,141,103,84,223,106,46,65,193,77,65,151,82,14,6,10,235,198,210,244,125,139,154,156,22,233,2,197,201,50,164,111,168,180,147,205,100,
+64,57,141,2,224,96,241,209,145,160,178,66,154,201,182,74,154,87,164,239,90,225,76,249,252,241,203,126,41,106,70,23,18,82,210,52,132,103,75,120,105,64,42,47,247,141,75,149,213,202,153,195,207,95,246,43,65,99,62,57,33,72,92,24,60,203,156,106,22,154,151,
+44,129,24,248,6,111,18,215,51,144,212,3,205,99,88,30,174,162,45,45,167,149,210,31,122,196,193,14,14,122,4,194,14,93,238,255,63,159,88,47,192,86,0,64,38,127,253,234,106,33,206,83,60,177,244,103,109,125,170,111,71,190,244,165,25,27,159,194,170,104,33,100,
+26,155,214,96,149,101,65,196,87,72,243,143,108,113,25,142,43,189,112,209,55,175,215,21,103,18,115,140,236,53,143,188,229,151,242,5,223,42,141,225,128,234,115,61,94,165,80,58,127,17,248,135,255,204,143,225,11,0,217,224,89,230,116,248,98,45,19,95,134,6,
+137,29,227,242,46,51,121,169,215,135,96,49,72,105,247,122,100,19,171,201,110,241,211,93,141,94,221,238,63,7,139,191,114,104,139,46,131,197,156,169,248,210,251,168,231,0,32,58,62,79,125,247,149,77,66,108,229,206,214,118,169,235,88,167,195,141,173,57,88,
+52,23,55,179,147,181,62,177,39,195,216,39,211,243,162,201,52,54,229,18,33,0,153,112,176,248,239,63,26,85,226,98,241,159,111,158,29,65,140,44,5,4,138,53,136,103,121,158,190,228,85,190,8,252,195,127,150,173,62,46,64,174,252,42,77,243,195,225,96,84,234,
+178,19,92,255,253,175,59,134,233,197,75,62,234,24,65,214,3,200,129,7,155,88,250,174,190,253,109,39,117,189,255,92,115,243,95,94,223,40,192,150,20,222,63,181,215,210,144,183,66,111,187,93,16,232,49,11,185,116,240,188,131,142,119,92,47,196,49,125,244,142,
+118,205,174,68,225,96,145,18,24,30,143,42,63,7,206,143,73,93,206,128,183,61,150,98,25,61,63,142,82,13,160,103,241,172,104,196,199,210,67,160,24,0,102,201,52,203,44,219,50,44,14,4,191,152,36,91,128,111,4,191,223,61,166,218,118,229,18,7,140,59,199,112,
+177,3,57,236,108,238,199,59,37,0,46,253,177,183,33,245,68,154,30,112,205,222,231,219,111,213,221,126,115,166,226,19,175,34,171,56,31,74,109,6,165,199,6,64,174,112,93,117,17,38,118,248,154,161,229,18,20,28,60,229,114,135,252,163,133,222,37,63,60,231,153,
+55,246,225,191,243,227,178,57,151,161,145,61,74,132,0,228,30,2,197,0,48,75,186,89,104,101,166,93,194,101,88,28,72,229,108,129,39,63,28,85,130,198,143,159,25,86,110,4,1,160,176,214,56,99,82,119,215,215,154,189,173,93,122,63,4,244,173,246,101,194,100,236,
+21,18,151,160,208,99,144,188,16,54,72,86,162,11,196,38,210,196,142,150,75,80,104,13,143,215,120,236,195,217,209,175,15,248,149,255,242,223,101,28,199,113,95,22,111,56,121,34,147,204,37,66,0,68,102,194,187,3,0,115,241,108,243,189,43,156,84,62,221,217,
+148,235,224,118,122,66,210,47,85,226,27,137,126,204,58,3,168,230,254,214,1,85,15,254,153,222,38,58,221,87,37,204,7,160,161,98,84,213,174,246,107,235,206,209,26,231,90,58,235,211,247,122,121,206,216,107,168,24,212,93,73,20,14,146,175,171,109,82,62,7,0,
+32,174,120,109,113,14,212,170,237,171,59,143,211,169,159,108,87,2,216,32,62,206,142,214,66,134,244,19,231,60,244,200,74,55,45,179,27,201,104,40,82,178,163,79,143,4,233,224,96,234,70,254,0,176,120,8,20,3,192,60,28,80,213,74,89,6,0,16,3,215,54,220,210,
+114,90,213,109,249,159,39,154,149,218,180,162,88,227,44,167,167,84,12,20,179,79,183,93,164,47,31,109,16,230,152,168,129,3,30,95,56,188,129,158,188,55,164,44,175,214,147,175,30,185,150,190,179,59,136,186,225,57,52,22,149,171,81,20,200,129,107,139,223,
+220,88,161,250,57,138,155,161,126,237,142,15,233,47,142,172,193,39,7,10,10,171,65,1,10,7,165,39,0,0,64,21,171,172,70,186,214,33,78,208,14,242,235,174,70,175,50,192,84,203,133,193,58,161,130,196,140,51,121,223,191,176,78,213,109,224,82,32,90,109,80,180,
+16,28,44,126,252,200,70,10,132,29,242,108,116,14,240,126,255,127,71,110,212,221,126,231,75,100,98,146,14,167,105,162,11,176,88,34,149,160,224,149,48,122,175,113,15,0,160,101,8,20,3,0,64,65,21,27,138,148,229,99,127,184,170,132,238,173,119,209,151,214,
+148,209,109,37,86,188,9,26,146,236,253,220,223,118,82,213,29,124,181,179,73,213,215,79,229,248,71,234,151,194,120,176,117,80,245,109,16,1,79,36,124,247,149,77,186,219,111,158,176,248,202,161,45,8,22,231,192,72,96,146,198,83,244,121,0,136,91,108,195,195,
+120,9,10,17,252,249,182,19,73,39,25,249,250,255,208,114,23,125,178,182,24,201,0,0,0,146,66,160,24,0,0,10,234,190,90,39,213,20,95,173,124,100,49,22,209,246,218,98,37,195,24,180,225,246,170,217,1,39,206,60,82,123,185,236,243,157,165,170,190,126,42,207,
+116,186,85,15,208,109,105,62,171,234,235,139,228,224,121,7,253,248,245,219,117,183,223,28,36,71,176,24,160,48,118,173,112,42,193,212,197,224,18,20,67,222,10,213,223,169,120,9,138,68,28,28,230,251,185,122,151,153,154,75,172,74,50,0,18,1,0,0,228,131,64,
+49,0,0,20,20,15,32,146,89,183,200,12,27,16,15,7,255,57,115,60,110,111,107,151,170,219,120,188,227,122,161,27,239,180,119,173,86,245,245,57,136,255,64,51,106,255,197,253,211,201,50,229,51,163,55,8,22,3,20,14,223,11,45,38,136,42,90,9,138,248,181,131,39,
+251,155,147,236,207,220,137,99,0,0,16,31,2,197,0,0,0,144,83,220,141,58,190,252,122,141,51,70,107,235,206,169,122,128,95,239,94,166,234,235,103,242,179,147,117,170,111,195,238,245,200,42,78,196,13,254,184,174,181,222,112,176,248,63,255,236,14,93,238,59,
+64,161,149,152,22,55,20,23,169,4,197,31,111,126,83,185,206,167,154,236,231,137,99,148,160,0,0,144,11,2,197,0,0,80,80,253,227,209,164,47,215,29,72,254,56,200,231,248,229,171,77,110,62,221,118,81,213,237,231,37,186,92,78,64,100,28,156,83,59,48,183,178,
+178,151,182,213,134,132,62,78,133,246,133,195,27,132,88,226,93,104,92,179,152,247,253,76,175,152,117,189,69,174,65,6,110,0,0,32,0,73,68,65,84,197,153,216,7,223,95,165,247,195,0,11,16,90,66,61,107,145,74,80,124,233,142,51,52,16,138,165,252,157,243,65,
+220,223,1,0,200,4,129,98,0,0,40,168,95,93,30,87,50,78,19,117,122,66,244,129,63,130,55,66,35,94,243,76,5,28,185,209,205,237,45,239,169,186,83,199,58,215,72,113,80,69,104,182,183,179,185,95,245,109,16,9,47,241,126,252,200,70,93,150,98,224,125,255,204,225,
+235,232,249,246,91,5,216,26,241,113,169,146,7,126,178,93,248,73,41,16,199,72,48,70,111,120,22,63,57,23,63,63,137,128,87,13,221,220,56,160,236,211,92,39,135,131,104,240,8,0,32,25,4,138,1,0,160,160,186,66,49,250,222,71,163,244,194,69,31,189,62,224,167,
+127,237,242,208,79,251,198,241,38,104,208,131,173,131,170,239,212,193,142,114,41,14,172,8,205,246,56,168,207,75,136,225,42,206,246,254,238,43,155,116,123,68,190,213,190,140,30,59,116,183,46,51,171,179,193,89,215,124,124,184,84,137,200,117,208,65,44,28,
+60,125,170,103,108,201,1,84,62,63,137,50,153,115,223,205,111,211,171,195,35,202,196,63,39,3,248,34,19,212,126,37,64,207,39,172,48,2,0,0,57,32,80,12,0,0,5,199,131,163,118,95,152,126,61,18,84,2,199,160,77,91,154,213,173,123,203,65,28,94,70,47,3,14,50,137,
+208,64,237,254,214,1,25,14,87,65,113,150,232,143,95,191,93,71,123,60,27,215,67,125,228,185,77,186,108,240,151,10,7,206,255,241,213,173,74,214,53,31,31,128,133,224,224,105,174,178,108,121,50,71,132,154,226,92,130,226,255,189,243,119,202,196,255,55,207,
+142,208,223,115,66,192,80,64,245,237,2,0,128,133,67,160,24,0,0,0,114,142,59,161,87,184,134,84,61,176,175,116,174,148,234,141,21,161,233,222,150,150,211,74,201,16,152,237,159,78,150,233,58,80,202,19,25,156,53,171,247,236,226,120,128,248,63,253,219,102,
+122,166,211,45,192,22,1,16,125,235,168,24,231,38,174,117,255,197,182,43,2,108,9,0,0,44,5,2,197,0,0,0,144,115,187,215,171,155,77,204,117,101,101,11,228,112,230,170,218,65,56,206,10,187,171,209,171,234,54,136,138,3,165,34,100,238,169,137,179,103,57,72,
+202,193,82,61,213,110,230,213,9,8,16,131,168,68,42,65,177,175,237,13,186,185,2,61,39,0,0,100,134,64,49,0,0,0,228,212,182,218,144,146,89,164,166,246,174,213,82,190,169,34,52,223,219,223,118,82,245,109,72,167,216,80,68,59,202,108,180,171,194,78,171,172,
+133,45,45,242,133,195,27,52,159,81,91,99,54,40,199,182,205,105,73,249,59,28,44,229,230,109,28,156,210,106,192,152,247,139,179,200,31,125,238,30,165,196,4,2,196,32,50,81,74,80,176,47,110,85,183,137,45,0,0,44,13,2,197,240,255,183,119,231,193,109,222,119,
+158,231,191,4,64,92,4,1,145,162,68,82,212,69,217,186,237,200,137,34,57,62,34,111,228,179,29,199,19,119,50,74,42,157,105,119,188,241,246,108,39,155,74,79,77,85,166,82,157,218,241,118,106,102,186,106,171,147,234,117,254,232,118,143,19,103,178,153,196,157,
+171,157,110,111,124,196,61,118,203,78,100,143,29,185,109,217,146,109,137,178,36,138,164,68,81,36,8,226,32,14,110,125,31,18,20,8,2,224,133,227,247,0,239,87,21,203,22,41,17,15,30,0,207,241,249,125,127,223,31,0,0,101,117,231,182,193,154,239,208,159,188,
+105,207,202,79,19,22,223,211,150,33,26,246,155,200,237,16,249,194,198,160,220,216,233,151,189,107,124,242,249,222,144,220,20,170,94,143,88,109,193,240,231,79,239,171,219,112,84,247,229,131,87,173,178,246,237,221,235,3,242,229,205,161,162,127,87,247,133,
+134,83,183,127,239,86,171,218,182,94,2,244,215,78,239,176,158,143,6,225,90,69,174,213,154,128,29,208,130,2,0,80,14,4,197,0,0,160,172,110,222,94,219,106,34,173,170,178,107,184,163,139,239,233,52,247,90,251,131,189,239,213,124,27,10,217,28,104,150,54,239,
+220,42,226,155,215,86,55,180,213,247,214,255,243,79,55,84,245,49,171,101,127,135,111,206,35,233,190,94,76,16,175,213,182,218,150,65,123,24,107,21,174,221,130,244,108,56,252,251,223,187,71,190,242,244,86,235,249,104,16,14,216,9,45,40,0,0,229,224,98,47,
+2,0,128,122,242,63,222,169,125,208,186,18,186,8,223,142,117,167,106,186,13,250,248,91,3,59,172,224,218,36,174,166,249,225,157,219,89,253,64,79,251,73,119,191,116,179,252,155,27,15,27,181,127,86,42,208,60,191,134,36,228,90,124,93,137,246,48,254,167,129,
+77,34,207,111,146,123,55,69,229,198,205,23,101,111,239,123,86,239,107,147,232,96,210,91,3,221,242,250,249,85,214,107,9,212,11,173,242,255,240,166,117,53,111,255,164,190,113,199,43,242,224,79,111,96,208,5,0,108,166,105,235,67,135,89,218,26,0,0,0,198,219,
+229,111,150,79,109,108,157,179,153,131,19,41,121,228,108,152,23,175,12,30,220,16,148,174,150,185,117,36,63,232,27,147,190,68,122,69,191,92,43,11,111,217,60,42,59,187,47,200,166,142,193,170,6,199,90,221,252,254,112,151,188,61,176,86,94,59,31,148,99,151,
+220,4,87,0,0,0,69,16,20,3,0,0,192,54,180,21,130,182,155,208,74,98,13,137,127,216,63,46,19,25,46,103,203,65,23,7,188,109,109,139,21,22,79,166,167,228,240,133,168,188,56,86,254,126,213,91,3,105,217,185,58,33,91,59,38,100,211,234,81,241,187,39,87,28,32,
+103,91,182,104,32,28,73,184,228,157,75,126,66,97,0,0,128,37,34,40,6,0,0,13,165,203,229,144,59,58,253,226,113,56,36,145,201,200,247,251,35,188,1,0,131,44,118,49,69,130,224,185,114,143,109,99,201,180,60,62,56,97,210,230,1,0,128,42,209,193,127,159,115,186,
+125,216,72,50,45,131,201,204,162,31,184,97,130,98,157,170,120,109,200,45,65,215,116,175,189,83,145,73,249,237,88,130,10,20,0,0,26,204,215,183,181,137,211,113,37,92,26,159,76,203,183,79,141,241,54,0,96,107,249,199,182,145,120,74,190,115,154,182,44,0,0,
+52,10,13,136,63,222,29,152,183,248,243,155,35,113,121,122,56,182,168,12,180,33,22,179,251,76,119,139,108,203,91,177,89,167,212,125,160,221,43,191,56,55,190,226,190,107,0,0,192,30,110,109,243,206,9,82,84,171,219,41,219,125,46,57,17,75,241,42,2,176,165,
+66,199,182,118,47,235,150,3,0,208,40,52,36,62,180,49,88,112,161,231,107,218,189,18,108,118,202,99,253,227,11,238,141,69,95,61,116,53,59,228,150,14,159,172,241,184,172,100,90,123,194,217,161,42,87,47,154,242,67,226,44,93,217,249,147,235,91,229,111,250,
+198,168,44,70,81,247,118,248,164,211,215,108,77,225,123,125,44,65,144,0,0,0,0,0,0,42,238,80,87,139,132,154,167,171,67,105,43,132,82,14,116,248,11,134,196,89,27,91,155,173,110,11,111,69,147,37,127,207,162,130,226,189,1,183,220,214,221,50,231,1,181,34,
+87,191,118,134,60,242,221,51,97,99,131,214,15,119,248,74,254,92,195,226,143,132,60,242,235,203,241,170,109,19,236,97,95,171,91,238,92,23,144,166,153,183,125,151,184,100,251,42,143,156,24,77,112,112,6,0,155,58,54,62,41,55,118,250,231,108,124,58,51,197,
+32,32,0,91,43,116,108,211,5,9,1,0,246,164,125,231,31,216,18,154,51,91,68,51,137,175,7,221,242,232,169,49,25,76,45,190,231,44,26,131,6,193,11,209,150,188,11,5,197,142,133,126,137,86,18,231,135,196,185,180,186,248,115,61,173,70,238,116,45,187,46,149,166,
+103,173,247,47,188,51,177,60,26,182,234,8,152,126,233,180,94,187,208,131,242,93,61,87,66,226,92,26,22,223,187,192,0,4,0,192,76,122,81,253,171,254,136,196,82,25,43,68,209,254,196,143,210,159,24,128,205,21,58,182,61,214,199,177,13,0,236,234,254,222,208,
+188,150,66,74,191,167,63,179,11,205,129,190,180,57,40,95,219,218,38,95,221,18,178,178,33,212,78,118,221,182,82,22,76,238,110,104,243,46,24,182,106,101,177,134,178,166,245,250,205,174,240,183,16,119,129,15,31,86,70,131,86,61,120,229,190,119,52,96,213,
+139,214,31,157,25,55,126,244,235,142,188,138,140,124,218,223,229,137,225,88,45,54,13,0,176,66,175,140,79,90,95,0,80,79,56,182,1,64,125,208,112,181,84,14,167,63,179,195,250,26,86,193,224,170,43,173,96,221,78,167,108,119,59,229,107,173,110,107,48,211,78,
+85,209,218,214,86,103,239,216,189,146,59,156,90,56,183,93,48,40,238,240,44,174,10,116,103,192,45,125,9,179,130,179,247,227,139,251,208,12,39,204,252,112,105,216,170,129,165,199,49,29,120,107,63,154,23,134,99,182,120,99,230,79,145,200,210,5,131,62,191,
+57,40,255,247,123,163,181,218,180,69,89,187,64,245,115,161,231,6,0,128,221,101,251,224,189,48,28,165,29,7,140,166,215,201,187,91,221,18,78,101,8,71,1,0,117,101,253,34,22,35,213,191,99,242,181,154,6,171,185,33,113,46,13,186,63,181,62,32,223,57,29,174,
+213,230,45,138,94,107,124,118,99,171,149,99,41,109,241,164,45,235,142,92,140,25,217,190,86,215,146,211,66,222,82,206,69,23,126,207,212,245,82,184,218,55,249,204,120,114,193,62,29,191,49,240,5,214,150,13,218,250,32,151,246,163,209,133,249,158,58,31,49,
+250,130,88,219,50,148,10,82,125,46,135,245,252,184,168,71,163,104,113,52,201,61,157,254,217,133,53,245,0,254,236,133,9,227,102,97,0,104,108,95,223,214,54,123,254,62,212,18,148,151,134,162,172,225,0,35,229,95,39,223,52,153,150,111,211,66,6,128,65,244,
+250,95,215,66,210,54,151,225,100,90,78,68,146,11,246,5,5,234,201,181,109,133,67,226,172,246,69,132,225,181,164,33,241,131,87,175,154,183,5,122,173,156,93,19,192,180,235,100,205,24,62,95,162,45,201,229,120,90,94,28,75,44,248,123,22,236,205,48,185,200,
+69,234,198,12,173,114,125,234,194,68,201,133,28,94,189,24,147,193,164,89,219,174,83,8,242,67,226,44,237,153,171,11,172,233,155,214,84,157,190,133,123,62,95,183,202,107,236,246,171,51,145,210,39,241,24,141,227,171,226,166,144,71,238,94,237,179,190,118,
+217,184,151,184,246,113,207,134,196,50,211,174,231,208,198,160,117,1,9,0,38,208,170,143,252,65,222,133,22,4,6,106,229,150,188,22,97,90,233,163,225,49,0,152,226,11,27,131,86,152,164,69,107,218,182,240,83,27,91,173,123,27,187,210,86,163,122,173,160,95,
+186,142,21,42,107,49,1,164,233,131,249,158,69,180,130,213,247,147,169,180,146,184,148,27,214,150,110,87,90,11,90,136,246,228,185,72,193,12,84,139,213,190,123,102,113,21,220,11,70,248,239,69,38,23,172,200,213,141,56,106,104,117,168,134,192,143,157,30,
+147,91,58,124,115,130,154,72,50,35,47,12,69,229,213,136,121,219,125,219,2,253,113,53,44,62,208,225,147,199,7,39,170,182,77,141,70,247,173,174,38,90,172,50,250,249,161,104,163,239,162,138,210,0,85,47,174,116,177,204,172,189,58,42,57,150,144,31,15,216,
+235,125,175,23,85,133,166,127,232,116,27,173,50,160,90,15,0,128,165,113,22,88,109,56,104,112,17,5,128,198,162,225,87,238,125,76,214,205,107,253,139,170,230,51,205,103,186,91,230,100,41,26,128,63,55,48,97,203,231,98,39,175,15,199,100,79,145,65,251,215,
+235,100,189,164,115,139,108,23,91,11,217,118,19,197,232,165,136,126,214,77,187,159,215,140,243,248,201,164,236,240,55,75,167,103,250,57,188,29,153,92,210,108,230,5,131,98,253,240,95,29,112,151,12,139,15,95,136,90,109,30,76,165,97,177,21,46,13,76,88,85,
+137,35,201,180,113,85,196,185,2,205,11,175,66,184,206,111,110,153,190,246,82,238,90,224,173,53,20,51,127,218,141,174,130,159,219,143,70,77,77,137,241,173,63,178,178,21,184,118,156,226,164,109,26,10,93,92,233,5,202,77,209,148,173,46,74,74,45,170,233,161,
+162,24,128,33,116,113,142,27,243,6,170,71,226,180,199,129,153,244,189,153,63,8,107,242,205,38,128,198,82,236,26,95,11,69,244,30,205,78,247,103,58,179,115,91,129,74,232,131,221,45,114,57,153,177,221,189,166,86,67,183,207,228,45,166,111,187,46,158,63,145,
+158,146,15,174,246,90,237,59,101,102,102,243,239,46,197,109,81,108,84,232,92,157,75,179,21,214,195,168,12,205,103,173,162,216,200,242,126,253,162,210,198,159,12,68,228,142,164,207,154,50,145,75,43,137,53,36,182,83,104,67,95,160,202,211,5,247,138,53,45,
+87,218,252,251,9,27,140,128,233,162,129,218,239,206,110,139,165,236,13,184,229,182,238,150,217,85,82,63,97,195,207,233,230,64,241,233,163,187,130,30,91,61,23,29,152,42,198,212,150,61,0,26,143,158,243,126,213,31,145,155,214,248,172,169,130,3,209,164,124,
+191,127,153,87,151,64,133,61,114,54,44,15,110,8,74,251,204,160,242,115,131,19,220,108,2,176,133,197,46,184,111,138,82,247,245,251,218,188,182,201,87,116,198,234,167,187,3,115,10,32,239,76,102,228,23,231,198,141,94,55,70,3,97,187,206,64,253,229,64,68,
+190,120,213,42,41,48,9,200,242,47,151,234,163,42,186,30,45,42,40,214,52,250,231,23,162,214,162,111,61,30,151,85,190,124,58,150,178,14,114,38,87,18,219,85,34,157,17,183,179,116,85,241,136,193,7,179,236,205,102,161,62,203,58,106,244,140,205,90,7,232,243,
+25,180,201,193,89,71,168,239,94,63,119,191,107,96,108,183,17,223,108,200,93,15,116,246,194,155,35,241,121,3,109,218,72,222,212,150,61,0,26,147,14,134,178,208,44,236,66,195,98,0,48,209,107,225,132,236,93,51,191,101,128,246,8,181,91,126,18,40,209,143,216,
+109,163,217,145,119,116,248,230,205,146,215,231,246,201,245,173,242,55,125,99,228,90,21,160,57,202,223,157,9,91,251,56,247,254,94,51,33,13,137,77,47,30,28,159,76,151,108,63,161,207,163,94,219,72,58,87,127,236,129,255,184,216,191,28,201,76,201,192,100,
+90,222,141,165,228,98,50,35,73,62,75,21,145,78,77,201,213,193,210,11,114,252,221,217,113,235,245,48,213,249,201,180,188,51,154,144,142,102,135,120,156,77,18,79,101,228,244,120,82,126,222,31,145,119,152,26,88,49,7,59,124,178,186,200,234,161,1,135,67,94,
+183,73,0,176,55,228,41,26,22,159,143,37,229,216,2,139,13,154,230,248,68,82,210,201,140,248,28,14,171,63,186,62,135,199,207,71,184,32,65,217,29,234,106,145,27,219,124,210,230,108,146,62,142,181,0,0,20,117,111,135,79,14,172,246,139,115,106,202,186,119,
+1,202,69,239,211,39,226,105,233,246,185,102,239,105,52,36,254,97,255,184,237,50,148,122,185,47,251,215,27,10,47,76,166,207,45,54,153,145,179,6,23,226,217,217,165,84,70,94,28,137,203,208,68,82,198,18,105,57,59,145,148,199,206,141,203,137,168,249,247,41,
+90,216,181,187,68,69,189,134,221,118,120,30,203,97,110,163,219,6,166,213,60,189,163,137,162,211,60,180,113,249,160,13,166,172,235,54,50,109,181,186,130,174,226,35,94,118,26,241,253,151,145,248,188,94,153,89,47,143,216,115,212,78,219,101,176,224,3,42,
+233,235,219,218,102,23,224,212,126,96,59,66,110,249,206,105,42,238,0,0,200,247,213,45,161,217,74,177,187,90,2,178,63,158,226,156,137,178,210,254,160,250,165,61,113,199,211,83,182,45,16,41,117,95,246,198,88,125,204,66,10,177,24,106,197,105,123,40,187,
+181,136,210,237,213,153,242,7,187,90,108,89,17,189,18,4,197,134,122,124,112,66,246,77,36,103,123,5,170,72,50,45,207,14,69,233,193,134,162,38,235,164,66,85,167,112,232,34,16,215,182,123,103,15,202,90,137,251,194,80,212,232,30,82,64,173,104,85,148,51,111,
+48,168,221,235,146,237,62,23,231,12,0,0,114,232,42,245,249,211,137,57,103,162,82,76,94,68,127,49,244,190,44,216,236,152,211,70,47,187,86,85,189,172,255,52,196,253,37,138,200,182,101,211,243,195,122,175,203,54,235,86,173,20,65,177,193,232,21,136,165,122,
+229,114,124,94,239,165,172,215,108,214,63,231,201,75,49,121,254,114,92,54,205,180,210,96,33,74,148,211,190,86,183,4,93,14,107,149,252,122,184,41,236,244,21,254,220,235,5,13,55,189,0,0,92,177,165,200,162,201,245,112,206,212,69,184,15,116,248,196,235,108,
+146,35,35,113,174,1,80,22,217,245,170,218,155,167,7,88,236,184,86,85,161,53,99,100,166,24,73,43,191,129,82,236,88,17,189,18,4,197,64,29,209,48,181,109,96,194,90,188,46,151,158,24,237,120,2,212,11,16,2,226,218,250,195,158,128,116,251,155,37,61,53,101,
+245,29,175,135,41,54,185,211,77,101,166,103,156,221,23,69,58,58,26,183,166,206,230,171,215,5,22,0,0,88,174,98,231,204,99,54,47,208,209,138,183,67,155,130,179,127,222,212,234,150,19,163,9,107,166,106,61,208,231,167,131,252,20,82,213,134,86,70,219,185,
+58,90,195,110,149,27,22,107,15,218,127,28,160,85,38,144,143,160,24,168,51,218,7,247,100,52,57,59,226,59,146,76,219,126,202,19,106,99,110,160,218,36,123,58,124,86,229,170,157,67,85,93,236,45,127,186,169,246,243,213,10,99,59,223,120,20,234,109,255,210,
+80,180,166,219,4,0,128,137,244,156,185,115,124,210,10,82,179,52,80,181,195,26,48,165,252,94,94,161,136,178,174,11,108,30,20,107,149,244,253,189,161,217,118,116,119,78,137,60,117,62,66,96,140,37,203,173,140,142,165,51,180,52,4,138,32,40,6,234,144,221,
+71,124,81,123,90,181,145,31,168,202,76,168,106,103,161,230,194,11,62,94,183,202,107,251,27,14,171,98,72,251,219,219,60,244,6,0,160,210,116,193,109,13,32,119,183,186,235,102,246,77,118,93,155,124,218,147,217,206,207,241,179,27,91,231,44,36,213,212,36,
+114,87,79,64,206,190,55,106,251,112,31,213,199,125,50,176,48,150,119,4,0,204,179,222,91,159,227,136,137,76,225,11,195,177,100,253,84,20,16,18,3,0,176,48,13,25,235,169,69,147,182,9,43,196,238,207,177,80,225,130,218,221,90,184,215,52,0,96,101,8,138,1,0,
+243,232,34,111,245,232,233,2,237,24,210,153,169,186,233,223,7,0,0,26,211,243,5,174,113,222,103,240,24,0,176,68,180,158,0,0,204,163,171,186,142,196,83,210,158,87,89,172,61,252,236,76,171,135,30,127,63,44,183,117,250,37,208,236,148,72,50,45,63,61,199,34,
+22,0,0,192,222,116,70,81,248,253,176,92,223,238,21,143,195,33,167,34,147,117,81,49,61,62,153,46,88,85,108,247,197,7,1,192,84,77,91,31,58,92,120,142,10,0,160,225,221,59,179,128,157,170,151,27,14,0,0,0,216,67,254,98,118,83,44,102,7,0,21,69,80,12,0,0,0,
+0,0,140,165,11,45,7,93,14,2,98,0,168,48,90,79,0,0,0,0,0,0,99,105,91,52,0,64,229,17,20,3,0,128,170,107,113,52,201,166,153,30,216,111,69,147,188,0,0,80,7,118,249,167,219,85,113,92,7,0,192,158,8,138,1,0,64,85,245,122,156,114,104,99,112,182,223,224,193,120,
+90,190,123,38,44,19,153,198,232,134,165,207,127,103,192,45,111,71,38,165,47,145,54,96,139,0,148,83,118,32,236,253,120,170,97,142,107,250,156,255,183,222,144,4,154,29,214,159,27,237,184,14,0,64,189,32,40,6,0,0,85,181,191,221,59,27,18,171,54,175,83,174,
+107,117,203,139,99,137,186,127,33,110,10,121,228,96,119,139,245,255,123,215,248,228,185,129,137,134,120,222,64,163,216,27,112,203,109,221,45,214,49,110,50,61,37,143,159,9,55,196,128,208,29,29,190,217,144,88,26,236,184,14,0,64,61,113,240,106,2,0,128,106,
+10,186,156,243,30,45,228,106,140,75,146,253,29,190,57,127,190,121,173,191,102,219,2,160,252,14,116,250,103,7,194,244,191,31,239,14,52,196,94,14,54,55,238,113,29,0,128,122,66,69,49,0,0,168,170,183,194,9,233,106,153,123,9,242,90,184,49,170,206,220,142,
+166,69,252,45,123,219,223,145,148,253,61,97,185,170,99,76,252,158,249,175,235,27,253,107,229,124,216,43,63,235,107,89,246,243,172,198,99,148,203,189,29,62,217,217,230,181,126,219,219,151,227,242,196,112,172,230,219,132,202,201,173,170,109,36,239,69,38,
+101,99,107,243,156,103,124,154,197,199,0,0,176,29,130,98,0,0,80,85,58,21,217,235,104,146,45,1,183,245,176,47,94,138,201,96,50,211,16,47,194,27,35,113,171,229,68,238,159,235,197,151,247,92,146,91,119,190,43,107,130,23,75,62,163,221,235,223,179,254,251,
+111,19,45,242,196,209,61,242,227,227,237,114,49,177,184,0,189,26,143,81,78,219,125,46,217,147,83,69,174,255,63,145,158,146,95,95,174,159,215,29,115,189,57,18,151,107,218,189,179,223,59,53,62,217,16,123,72,143,235,90,65,220,51,179,152,221,107,151,227,
+44,104,7,0,128,13,53,109,125,232,48,43,12,0,0,0,84,201,46,127,179,108,246,185,172,106,187,122,8,82,180,186,247,43,31,61,38,155,215,156,93,214,191,63,118,238,106,249,227,39,119,214,252,49,42,225,193,13,193,121,213,243,131,19,41,121,228,108,184,234,219,
+130,234,185,181,205,43,30,71,147,140,165,50,244,232,5,0,0,182,66,69,49,0,0,64,21,105,56,92,47,149,118,26,224,126,243,227,255,44,126,207,196,178,127,135,182,137,168,245,99,84,202,88,50,45,93,121,151,219,137,76,99,84,207,55,50,42,198,1,0,128,93,177,194,
+0,0,0,0,150,108,71,48,189,226,0,87,61,219,183,170,232,207,170,241,24,149,244,248,224,132,140,79,166,103,31,33,157,153,146,167,135,162,53,217,22,0,0,0,96,33,84,20,3,0,0,96,201,254,244,230,119,22,21,224,94,12,175,145,11,225,144,172,13,142,205,235,45,252,
+202,201,221,114,60,236,44,250,111,23,251,24,177,248,26,25,30,95,37,94,207,232,146,31,163,210,190,125,106,76,246,181,78,247,227,126,197,208,126,181,55,133,60,178,43,232,177,254,95,123,203,190,26,105,140,190,186,0,0,0,152,139,160,24,0,0,0,75,114,251,186,
+248,236,130,113,133,68,19,45,242,195,35,123,229,31,251,130,115,22,145,91,227,153,146,143,247,134,229,134,45,231,173,127,255,207,167,58,139,254,142,197,60,198,123,239,223,40,195,195,157,146,76,77,7,193,207,13,76,200,59,241,248,162,31,163,90,76,13,136,
+85,175,199,41,7,187,91,102,255,124,119,75,64,250,79,142,54,204,2,147,0,0,0,184,130,160,24,0,0,0,75,114,96,203,112,209,191,126,250,226,6,249,211,39,247,204,9,136,179,244,123,223,59,30,178,190,254,104,199,58,249,89,95,75,177,95,179,224,99,60,252,79,123,
+229,246,174,208,156,239,135,92,142,37,61,6,68,118,6,220,243,246,66,123,179,115,217,65,177,6,252,219,215,20,174,2,63,113,177,69,158,57,239,101,175,3,0,0,24,138,160,24,0,0,0,75,114,253,85,239,20,253,235,143,29,217,81,48,36,206,167,65,110,41,11,61,198,111,
+71,211,114,195,234,140,4,154,175,44,185,113,58,150,154,243,247,22,122,12,136,188,29,153,148,189,107,124,179,123,98,50,61,37,239,199,83,203,222,51,26,18,127,246,250,151,10,254,236,71,71,110,36,40,6,0,0,48,24,65,49,0,0,0,22,109,127,71,178,104,223,96,173,
+244,45,71,16,184,216,199,248,197,185,113,217,223,238,149,160,203,105,245,214,125,43,154,228,133,92,162,190,68,90,158,60,23,145,15,181,77,239,83,221,143,19,153,41,27,61,3,0,0,0,148,11,65,49,0,0,0,22,45,228,78,23,253,171,191,61,181,161,44,59,114,177,143,
+161,33,103,223,192,194,139,221,161,52,93,188,142,5,236,0,0,0,96,235,160,120,187,207,37,123,66,30,9,53,59,101,40,150,148,39,134,99,6,108,21,0,0,64,253,42,214,127,86,69,18,229,185,180,172,198,99,0,0,0,0,141,236,214,54,175,92,191,198,39,78,199,149,182,113,
+182,189,210,254,210,230,160,180,123,175,108,126,87,139,75,246,116,248,228,245,225,24,129,49,0,0,64,13,244,135,61,21,127,208,106,60,6,0,0,0,80,207,14,117,181,200,246,85,243,175,171,93,250,131,141,129,102,241,185,28,50,53,37,18,73,166,229,197,139,49,121,
+101,220,220,233,103,249,33,113,46,13,139,39,210,83,242,235,203,241,90,109,30,12,116,83,200,35,187,130,30,107,64,97,112,34,37,253,209,164,60,121,137,1,5,0,0,0,0,0,80,63,122,61,78,249,120,119,64,218,188,78,235,57,69,146,25,121,97,40,74,155,41,204,234,114,
+57,10,134,196,202,161,63,208,144,88,53,53,137,180,186,157,114,87,79,192,74,150,77,164,237,38,138,133,196,89,31,238,240,25,185,237,168,141,207,116,183,200,193,238,22,43,36,150,153,234,115,93,221,91,191,15,0,0,0,0,0,80,15,52,36,254,124,111,104,54,36,86,
+129,102,135,220,189,62,96,21,208,217,65,139,163,73,246,6,220,114,247,106,159,236,242,55,243,190,172,128,3,37,114,211,162,137,171,6,200,219,199,18,114,34,150,50,234,201,236,89,196,27,219,237,108,90,240,239,96,105,244,96,115,219,218,43,97,171,142,72,157,
+24,77,24,95,149,171,7,149,109,69,222,51,250,253,155,162,41,121,113,44,81,245,237,130,189,104,223,158,115,241,148,113,199,67,0,141,231,246,117,113,105,245,164,101,93,112,254,204,169,19,23,91,228,108,164,89,142,135,157,101,217,47,250,88,133,116,182,22,
+63,247,151,234,45,156,79,183,117,67,32,89,241,199,40,199,254,168,230,126,47,135,53,158,41,185,110,117,66,122,130,9,9,120,230,159,187,202,177,205,203,121,127,232,207,138,253,187,124,166,237,83,0,0,236,224,64,135,191,232,86,222,188,214,111,124,254,161,
+97,182,110,103,54,215,219,43,34,119,38,51,242,139,115,227,214,34,198,40,15,93,235,173,152,146,165,185,191,215,221,34,39,78,141,25,245,50,148,122,50,118,208,213,236,144,221,1,183,120,28,77,50,150,202,200,209,241,73,153,200,76,25,189,229,26,18,31,218,24,
+156,19,192,235,136,148,86,229,182,186,29,242,99,131,87,27,223,236,43,93,125,126,117,192,77,80,140,162,238,237,240,89,237,108,178,38,211,83,242,88,223,152,12,166,50,236,52,0,85,177,35,152,150,219,122,71,229,218,158,11,178,123,253,123,139,122,200,139,225,
+53,242,230,185,245,242,194,169,14,121,230,188,119,217,155,249,127,222,243,204,146,255,205,103,175,127,105,209,127,247,71,71,110,92,210,223,95,238,99,28,127,125,245,146,31,163,150,251,125,185,52,128,221,187,126,76,174,223,210,39,107,130,23,23,245,91,162,
+137,22,57,114,114,155,252,174,191,77,126,214,183,180,153,86,203,121,127,124,108,215,239,228,99,187,22,247,119,151,251,218,1,64,189,121,112,131,182,222,156,206,65,70,226,105,249,229,64,132,251,17,20,181,177,181,120,5,174,102,58,90,76,247,86,180,240,64,
+125,173,233,182,29,44,48,243,91,243,39,205,164,30,62,57,106,116,126,150,95,96,169,249,193,27,35,113,35,11,44,19,153,226,199,144,146,41,154,199,233,168,196,246,172,200,80,44,57,187,211,237,230,190,181,126,185,166,125,238,141,131,142,148,28,190,16,53,58,
+172,212,55,122,177,42,109,173,202,221,53,54,105,236,129,102,33,110,7,213,231,149,164,45,108,178,131,59,47,12,71,109,85,145,171,109,110,246,228,77,199,208,207,193,253,189,33,249,139,119,47,215,108,187,0,52,6,13,42,255,224,3,3,86,176,182,84,26,18,126,108,
+215,69,43,144,251,147,240,26,249,111,71,174,93,114,8,216,168,236,184,223,255,104,199,152,252,171,235,222,94,116,56,156,203,239,153,152,13,111,255,77,120,141,252,253,209,157,242,189,227,161,74,110,46,0,96,9,10,45,226,111,199,251,17,189,183,186,126,38,
+11,57,50,18,103,166,38,10,218,215,86,124,160,93,239,197,63,18,242,24,187,30,153,134,220,159,218,216,58,231,123,186,205,166,22,88,234,231,112,83,171,187,224,207,108,151,184,190,60,154,152,23,222,228,27,159,52,175,28,93,123,171,228,135,196,50,243,198,209,
+17,147,243,241,148,177,101,244,11,5,243,90,181,107,106,80,156,88,96,180,169,223,166,1,183,233,180,49,250,3,91,66,226,204,9,226,15,181,4,173,118,37,143,15,154,91,129,158,235,250,2,159,87,161,181,13,150,73,123,108,173,106,118,200,177,200,164,12,38,169,
+0,65,105,95,222,115,105,89,149,182,133,104,120,248,239,110,127,78,238,60,119,181,124,235,240,54,166,242,151,96,183,253,174,21,196,127,114,224,232,178,2,226,66,244,247,124,241,192,69,249,87,215,173,145,255,252,236,94,121,121,152,158,128,64,57,104,133,
+153,207,233,144,88,58,195,180,105,44,137,222,83,21,90,159,73,239,71,246,181,186,229,149,113,123,44,76,150,31,118,107,56,101,167,251,66,187,209,197,251,139,101,56,90,225,106,114,145,95,151,191,116,246,180,37,224,54,54,40,190,179,196,26,88,38,182,61,213,
+193,154,145,120,170,224,49,166,100,201,112,34,109,222,205,172,78,177,120,125,184,120,217,118,58,51,37,63,58,51,94,213,109,90,140,107,139,132,78,89,165,250,200,96,249,126,59,150,176,14,134,133,232,247,95,11,155,221,118,66,47,0,180,63,238,173,37,70,214,
+76,244,137,238,192,156,144,56,203,234,125,190,64,59,16,83,120,28,230,205,168,128,61,125,121,115,200,90,60,226,198,78,191,60,120,213,42,43,52,6,10,209,106,214,31,220,119,180,108,97,101,46,109,159,240,87,247,61,47,191,223,203,77,89,62,59,238,247,255,176,
+127,200,106,253,80,174,144,56,151,254,206,191,252,253,95,89,149,202,38,208,128,225,27,59,218,229,107,91,219,172,235,34,192,78,180,215,166,46,42,165,85,102,250,95,45,30,2,22,107,119,137,99,94,208,101,143,123,21,109,229,87,40,136,210,251,66,59,221,227,
+234,249,71,91,128,252,97,79,192,248,251,217,23,75,180,57,248,159,37,178,52,19,76,46,80,232,183,208,207,107,69,7,4,181,61,70,41,87,27,120,15,248,157,211,97,43,44,206,87,242,153,188,113,217,204,16,237,137,225,152,188,52,20,157,23,0,106,37,241,163,167,204,
+235,31,170,111,154,133,170,16,23,26,57,169,165,98,65,107,214,66,85,187,181,164,253,107,30,63,19,182,22,223,203,165,207,73,191,111,114,101,223,87,183,132,228,174,158,233,112,73,191,254,108,123,187,109,110,144,58,75,188,159,237,50,40,114,116,180,240,72,
+229,148,217,45,197,97,24,13,133,115,87,28,86,7,58,25,24,196,124,251,59,146,86,160,184,121,205,217,138,237,29,109,51,160,85,174,166,4,128,38,176,219,126,215,69,234,52,212,190,231,186,151,203,178,109,165,124,241,192,11,53,127,175,104,11,171,108,192,96,
+205,194,235,162,133,10,236,37,191,215,166,78,65,110,161,245,29,22,233,88,137,138,225,176,77,122,20,111,91,85,120,97,121,181,35,100,143,123,91,29,176,212,251,114,173,210,213,106,232,67,155,166,3,99,83,105,197,240,79,207,140,207,201,64,52,255,208,12,205,
+212,106,220,172,243,11,84,59,159,51,180,26,218,183,136,182,189,166,182,61,213,176,248,241,247,195,86,65,238,251,227,147,214,251,164,104,154,163,169,178,201,111,34,221,54,211,223,228,245,66,155,111,235,69,77,33,122,192,249,173,225,139,193,233,20,175,111,
+157,28,181,122,198,104,155,140,211,177,148,241,61,149,117,180,178,213,61,55,92,106,106,18,235,4,117,246,189,81,227,23,47,104,170,131,235,95,157,202,213,59,154,176,70,187,115,61,117,62,82,235,77,131,141,116,122,230,79,55,95,104,180,25,141,71,195,202,111,
+126,252,159,173,64,113,33,167,47,110,144,55,251,187,37,146,112,201,137,139,211,1,68,79,48,33,1,79,74,174,234,24,147,221,235,79,47,248,123,52,0,20,57,176,96,47,90,93,76,76,237,89,235,150,220,241,238,214,214,126,233,94,253,110,193,127,115,236,220,213,242,
+70,255,218,69,189,134,186,253,217,199,200,87,106,17,185,165,62,70,49,166,238,247,98,52,36,254,214,221,175,47,58,212,214,133,234,250,46,118,75,223,112,187,181,221,74,183,183,183,99,68,122,215,12,44,234,121,235,54,135,19,7,11,246,90,174,198,107,183,57,
+111,17,107,218,63,193,78,122,11,92,3,168,77,94,115,219,246,193,44,122,207,87,168,141,128,22,200,217,165,237,132,179,196,141,161,207,6,85,209,90,245,92,168,34,122,211,204,204,95,83,51,41,61,198,188,117,114,212,26,152,106,117,54,217,166,245,221,243,195,
+49,217,28,112,23,60,223,95,142,167,141,205,158,98,139,232,198,16,78,153,219,122,72,219,80,228,246,13,119,233,129,71,171,255,178,159,95,109,221,240,230,72,220,170,218,69,121,104,80,169,129,106,169,139,219,193,168,185,205,220,117,133,198,53,94,215,188,
+213,51,179,85,185,38,175,58,153,203,58,88,218,228,162,172,84,69,238,254,85,30,227,63,159,177,84,166,232,137,95,23,164,180,11,237,155,181,125,44,33,123,66,30,137,167,50,86,143,116,86,24,174,174,174,102,135,180,207,4,5,118,188,169,210,246,54,249,3,109,
+239,24,62,184,134,234,210,240,239,43,31,61,86,50,180,211,192,239,137,163,123,228,217,190,85,133,123,221,158,207,78,221,92,173,221,219,22,181,184,217,231,174,127,85,222,26,254,104,201,62,180,15,191,190,218,250,175,78,27,205,93,31,34,25,72,201,61,69,130,
+98,13,1,179,255,110,49,158,57,95,120,218,233,151,103,218,54,148,227,49,10,49,121,191,23,243,205,91,143,47,42,36,254,167,183,62,40,191,235,111,43,177,144,94,167,136,236,180,218,97,124,176,231,242,130,11,247,253,219,3,71,228,173,75,183,204,219,7,197,94,
+131,114,190,118,219,125,81,107,141,131,172,66,211,35,1,83,233,61,160,86,244,229,14,16,155,222,31,180,152,108,193,141,206,36,213,160,198,46,247,127,245,224,145,179,97,235,60,156,173,204,61,19,73,218,170,183,111,36,153,150,118,103,225,123,219,11,54,88,
+208,238,218,182,210,21,209,166,23,47,234,103,213,78,159,87,13,180,53,99,186,109,109,203,156,1,18,205,45,127,216,63,110,236,115,209,227,189,6,217,249,51,73,115,189,49,102,143,193,29,229,210,3,15,42,175,84,85,174,122,197,240,3,204,99,253,227,179,23,8,50,
+211,110,130,139,132,202,41,85,145,219,233,211,155,75,179,131,226,231,135,162,86,245,115,62,189,56,182,219,32,84,254,232,26,170,71,219,54,220,214,221,50,59,200,118,48,158,150,239,218,104,112,74,102,46,118,158,60,23,177,218,77,232,123,183,222,137,0,0,32,
+0,73,68,65,84,141,162,134,196,255,48,20,53,96,203,96,138,175,223,220,87,50,252,211,74,214,111,254,250,218,37,45,134,166,21,171,223,59,254,145,146,139,179,105,64,170,65,233,231,127,126,221,130,191,79,143,219,39,38,146,178,222,235,178,166,193,126,122,183,
+253,7,204,236,176,223,115,233,239,44,22,190,102,29,91,226,194,121,26,36,235,215,254,227,157,214,54,21,219,31,186,205,183,245,142,202,241,21,134,243,203,161,231,95,157,14,169,109,171,198,146,105,22,62,130,237,252,226,220,184,124,188,59,96,133,7,26,34,
+252,227,128,253,102,166,105,159,229,220,22,26,31,238,240,201,99,167,199,88,156,183,138,172,251,39,155,22,242,61,59,20,181,90,53,228,211,118,126,79,219,224,154,216,83,162,165,64,51,109,100,42,66,67,87,205,41,179,5,67,35,201,180,45,142,55,122,124,63,180,
+49,88,176,64,84,239,1,237,52,72,104,143,85,165,234,128,86,229,122,156,77,114,77,222,162,118,26,156,29,190,16,181,197,155,198,78,21,185,118,167,149,253,133,22,131,147,18,189,115,77,98,77,133,234,143,200,45,157,126,171,178,88,159,207,197,88,90,126,105,
+195,139,99,59,186,111,173,127,246,88,163,149,44,122,147,98,199,85,182,53,92,205,61,209,234,77,214,71,66,30,219,181,29,122,53,50,105,125,1,249,110,95,23,151,125,87,29,43,186,95,180,50,244,27,135,215,47,123,191,105,229,102,36,113,96,166,229,193,124,26,
+12,126,121,207,134,69,85,120,214,211,160,153,157,246,187,204,180,200,88,104,161,61,109,3,177,220,42,107,173,110,214,224,250,207,111,238,152,87,93,156,173,170,94,105,5,247,74,88,239,61,10,91,96,83,122,253,245,240,105,123,247,133,223,223,49,183,216,73,
+175,205,110,104,243,202,207,47,216,115,224,91,11,17,180,53,24,133,79,213,145,29,240,251,68,79,96,118,198,169,182,206,248,209,153,113,91,204,212,28,136,38,173,54,19,133,140,216,240,254,202,78,52,28,182,211,128,148,30,239,117,16,237,150,14,223,108,251,
+12,29,32,252,221,229,184,188,104,179,25,165,4,197,85,164,39,211,163,99,9,217,57,179,218,161,158,156,142,69,38,25,141,197,60,218,254,101,79,199,252,10,116,29,88,176,75,63,42,221,78,187,108,107,61,209,94,89,185,3,82,90,197,170,35,155,15,159,28,181,221,
+133,112,161,94,190,91,2,230,79,241,130,185,186,92,14,107,5,113,173,138,53,225,230,228,79,14,28,45,250,179,87,78,238,94,81,88,153,53,221,15,183,120,104,121,239,117,175,203,143,143,127,76,46,38,26,167,42,198,110,251,253,127,221,95,186,146,248,111,95,88,
+126,223,227,92,250,188,255,92,100,54,44,214,125,241,215,175,108,90,82,85,53,128,250,83,232,122,172,195,99,207,24,225,51,221,45,178,45,116,165,149,0,213,209,213,97,13,248,189,55,106,203,109,215,170,231,7,90,154,231,21,113,105,33,148,29,42,162,81,93,122,
+44,249,241,128,206,126,178,247,12,40,130,226,42,211,81,134,190,4,253,159,81,90,182,61,131,6,126,217,147,82,118,228,21,40,101,75,96,254,136,183,142,102,218,113,225,148,252,190,126,234,20,149,185,88,166,125,173,238,217,150,56,55,118,250,173,149,125,107,
+217,10,71,251,217,22,235,101,171,85,156,255,233,112,111,217,30,75,67,196,174,224,126,185,231,186,151,231,253,76,219,10,124,102,199,72,77,43,70,171,201,110,251,93,171,159,75,181,156,208,234,231,114,132,196,89,127,245,74,143,172,13,142,203,83,111,111,44,
+209,227,24,118,160,199,188,59,215,5,172,118,102,90,104,240,88,223,24,235,44,96,89,10,45,166,102,199,235,49,93,92,48,55,36,150,153,107,100,173,254,155,14,118,128,249,244,184,249,232,169,49,249,236,198,214,217,54,20,137,116,198,54,21,209,192,114,16,20,
+3,134,122,162,198,33,6,80,107,47,12,69,229,238,245,87,122,93,155,188,210,45,204,119,83,222,58,1,59,219,188,53,61,198,238,233,185,84,244,103,63,60,178,183,236,21,190,255,245,245,181,114,112,103,75,193,197,219,62,178,229,108,195,4,197,118,219,239,119,239,
+60,95,244,103,23,195,107,172,96,183,156,244,249,255,241,147,59,203,250,59,81,27,183,119,183,204,174,121,161,97,216,29,157,126,249,126,63,45,192,176,116,207,94,152,144,79,174,111,157,29,188,215,94,155,118,156,221,229,43,210,107,54,232,98,214,4,74,211,
+64,248,219,167,236,221,66,6,88,10,130,98,0,168,35,111,133,19,243,170,62,180,50,215,142,253,197,181,175,111,255,201,81,107,17,3,153,233,147,142,202,210,10,180,235,86,77,183,46,209,158,226,245,84,41,225,50,104,193,145,53,158,169,162,61,114,53,252,43,103,
+133,232,236,239,77,52,89,189,102,11,245,186,213,158,185,59,130,75,91,184,205,142,236,182,223,75,109,175,250,251,163,59,27,170,101,8,150,38,127,154,180,199,81,124,65,38,59,218,238,115,89,139,28,38,50,25,107,250,55,149,125,149,163,51,98,191,117,114,212,
+170,200,141,101,166,108,219,166,33,150,46,188,221,225,20,125,102,1,32,87,125,93,49,0,64,131,211,70,249,175,94,140,89,211,76,101,102,186,160,46,102,103,87,131,51,33,55,33,113,229,233,77,183,182,102,208,129,6,253,122,240,234,85,86,79,223,122,241,124,94,
+31,185,183,107,88,13,245,241,222,226,11,115,29,57,85,190,214,7,249,158,237,91,85,244,103,183,245,218,179,119,224,82,216,109,191,127,116,93,241,222,135,218,38,163,18,193,54,234,199,72,124,238,226,147,245,212,186,73,207,87,135,54,5,173,115,149,46,50,245,
+192,22,62,11,213,160,129,177,157,123,249,234,246,191,147,55,51,77,175,151,159,103,6,39,0,204,65,69,49,0,212,153,39,47,197,172,47,96,41,180,50,43,159,46,252,54,88,39,139,7,234,226,154,225,247,195,178,222,235,146,115,241,148,181,176,74,173,116,5,139,239,
+211,87,207,85,46,240,208,202,85,173,156,45,212,163,183,179,181,254,143,25,118,219,239,219,214,20,111,19,112,228,228,182,178,109,31,234,211,119,78,135,229,80,87,139,132,154,157,86,72,92,79,11,193,230,159,175,180,122,90,23,243,101,177,91,44,68,123,17,239,
+29,79,74,167,199,105,45,44,175,45,205,236,182,216,51,0,84,26,65,49,0,0,176,166,239,214,59,107,213,237,26,6,196,89,189,29,35,69,127,246,204,121,111,69,31,251,244,197,181,5,3,75,93,192,172,222,217,109,191,151,218,222,147,195,173,101,219,54,212,175,199,
+7,89,160,11,200,167,173,205,132,118,221,0,80,20,65,49,0,0,176,122,60,62,208,210,60,219,215,50,157,153,162,58,171,66,214,6,139,47,136,242,215,119,191,93,147,199,238,93,51,160,75,252,85,244,177,107,205,110,251,189,197,83,124,241,206,183,134,231,207,0,0,
+26,133,246,208,215,246,72,89,156,175,0,0,40,31,130,98,0,0,96,45,4,244,232,169,49,171,221,132,226,166,187,114,10,85,150,102,237,94,255,94,77,182,201,239,169,255,202,67,187,237,119,93,236,174,152,151,135,155,171,183,145,128,97,244,124,245,200,123,163,156,
+175,0,0,168,0,130,98,0,0,96,209,155,239,122,233,73,12,0,168,95,156,175,0,0,168,140,250,89,206,28,0,0,0,0,0,0,0,176,44,4,197,0,0,0,0,0,0,0,208,224,104,61,1,0,0,80,69,167,47,110,40,218,127,246,161,127,184,157,151,162,66,236,182,223,143,157,187,186,104,
+239,228,219,215,197,229,153,243,222,170,111,19,0,0,0,234,27,65,49,0,0,64,21,77,36,60,69,31,236,108,164,89,142,135,157,188,28,21,80,79,251,189,39,152,16,33,40,6,0,0,64,153,209,122,2,0,0,160,138,222,232,95,91,244,193,62,178,46,194,75,81,33,118,219,239,
+165,182,247,170,142,241,170,110,11,0,0,0,26,3,65,49,0,0,64,21,157,15,23,175,4,189,97,203,121,94,138,10,177,219,126,63,113,177,165,232,207,174,191,234,29,89,227,153,170,234,246,0,0,0,160,254,17,20,3,0,0,84,209,207,250,90,36,154,40,28,2,106,79,90,237,63,
+171,238,91,235,151,111,236,104,151,7,55,4,165,197,209,196,75,180,66,139,221,239,229,214,229,114,200,31,246,4,172,215,113,187,111,241,93,223,180,7,113,177,237,245,123,38,228,51,59,70,170,185,251,32,34,183,182,121,173,215,241,166,80,241,54,38,0,0,0,118,
+70,80,12,0,0,80,101,71,78,110,43,250,128,247,95,127,220,10,162,174,105,159,174,128,237,106,113,201,61,157,126,94,162,50,88,104,191,87,194,253,189,33,217,212,234,182,94,199,67,155,130,86,112,188,88,165,182,247,222,235,94,167,170,184,138,244,51,121,99,
+167,223,122,29,15,118,183,200,222,128,187,97,158,59,0,0,104,28,4,197,0,0,0,85,246,203,227,157,69,31,112,243,154,179,242,201,61,231,42,178,65,141,30,44,46,180,223,255,195,254,161,178,63,166,219,217,36,205,174,244,236,159,119,183,46,62,96,252,127,255,165,
+187,232,207,180,170,248,235,55,247,173,120,251,114,233,251,227,7,247,29,149,47,239,185,84,214,223,91,15,66,121,1,127,167,135,69,39,1,0,64,253,33,40,6,0,0,168,178,151,135,155,229,216,185,171,139,62,232,13,59,126,43,237,29,253,214,255,79,166,167,228,229,
+145,149,183,69,208,16,240,91,119,191,46,127,180,99,172,97,95,238,133,246,251,61,215,189,92,246,253,51,229,72,201,135,63,240,130,172,95,55,221,7,249,216,248,228,162,255,237,241,176,83,254,233,173,15,22,253,249,190,171,142,201,159,223,92,190,65,133,111,
+222,122,220,10,204,63,123,253,75,86,96,188,191,35,185,228,223,81,170,183,242,181,61,23,86,184,133,181,115,58,150,154,243,216,111,71,22,255,58,2,0,0,216,5,65,49,0,0,64,13,124,235,112,241,182,2,106,223,174,103,197,213,118,92,30,62,57,42,125,137,244,138,
+54,80,3,191,191,185,239,136,21,2,126,241,192,11,21,235,199,107,7,11,237,119,221,63,229,170,44,214,253,190,111,207,211,18,12,156,145,221,87,63,35,231,210,23,100,48,149,89,210,239,208,170,226,98,189,138,213,199,118,253,110,197,97,177,14,34,252,245,221,
+111,91,189,154,179,244,189,242,151,191,255,43,107,95,44,165,18,125,108,178,120,165,173,254,254,29,193,149,189,151,107,229,173,104,82,126,208,55,38,175,94,140,201,35,101,248,76,2,0,0,152,200,185,250,99,15,252,71,94,25,0,0,128,234,26,78,56,196,159,234,
+144,107,214,159,45,250,184,91,58,251,229,163,27,162,50,30,94,37,167,198,23,191,16,90,150,6,124,95,217,123,65,254,143,143,61,47,45,158,232,236,247,247,111,26,146,19,253,235,165,63,186,244,233,243,251,187,98,69,183,249,205,254,13,242,242,208,202,251,41,
+87,242,49,22,179,223,183,117,245,203,193,141,177,178,236,119,127,206,126,223,177,110,96,201,251,93,183,215,153,104,151,15,109,122,191,232,223,233,93,51,184,236,237,213,65,131,255,235,174,87,101,243,154,194,97,179,238,11,73,116,44,122,159,235,115,251,
+236,53,253,210,236,42,92,141,220,237,115,203,83,125,109,11,254,30,221,135,209,180,89,139,56,142,166,167,228,221,88,74,34,25,122,67,3,0,128,250,68,80,12,0,0,80,35,26,190,245,250,90,172,160,175,152,85,45,97,249,95,182,157,178,130,192,117,158,102,9,199,
+60,86,120,88,202,239,247,78,200,231,174,185,32,95,57,240,170,236,94,127,122,222,223,212,16,239,67,61,99,242,220,187,61,75,14,227,236,30,20,139,13,247,251,209,97,239,162,183,247,250,206,140,116,56,221,210,63,238,41,250,24,26,194,30,218,26,150,255,125,
+127,159,252,235,15,255,207,57,131,8,249,46,134,215,200,127,57,188,117,73,219,251,161,142,41,233,105,191,88,240,103,250,125,125,46,111,14,181,22,253,157,186,31,255,236,182,215,228,245,51,221,11,238,115,0,0,0,148,207,210,75,36,0,0,0,80,54,127,245,74,143,
+244,174,25,182,166,250,151,162,63,159,238,31,43,86,43,130,190,139,211,11,157,245,13,183,75,103,235,132,248,61,9,105,241,36,22,252,61,89,107,130,23,229,163,235,162,242,179,190,226,109,13,76,213,213,236,16,159,163,105,69,211,255,237,182,223,191,113,120,
+189,252,249,76,171,137,82,180,189,131,126,125,241,128,200,233,139,27,100,34,225,145,11,225,86,235,95,172,13,142,47,105,91,245,249,254,231,103,247,202,197,196,210,6,19,158,124,123,157,213,63,185,24,125,14,215,95,245,142,28,57,185,77,134,198,125,179,127,
+171,179,85,7,8,206,89,251,72,253,193,7,6,172,231,13,0,0,128,234,32,40,6,0,0,168,33,13,225,254,244,201,61,242,149,125,29,11,134,128,89,126,207,196,108,63,217,221,203,204,209,254,246,133,3,182,12,137,253,174,38,185,127,115,72,220,206,38,171,95,236,147,
+151,98,203,250,61,118,220,239,139,13,139,179,178,129,240,238,101,61,154,200,223,191,246,97,107,1,192,165,122,230,188,87,62,125,238,234,57,61,143,243,233,190,92,232,121,104,152,188,230,149,158,37,7,213,0,0,0,88,30,230,114,1,0,0,212,152,6,97,26,2,254,232,
+200,141,21,223,16,173,18,253,203,103,14,202,247,142,135,108,249,178,111,109,111,182,66,98,213,227,95,122,136,153,203,142,251,189,26,219,155,76,183,200,75,191,251,180,4,226,155,172,234,237,229,208,69,3,75,45,194,183,24,26,38,127,102,199,72,69,159,43,0,
+0,0,174,32,40,6,0,0,48,196,195,175,175,150,127,247,179,187,228,216,185,171,43,178,65,175,156,220,45,127,240,163,143,217,178,146,56,43,157,179,144,88,56,181,252,214,19,185,236,182,223,43,185,189,71,79,239,150,95,255,230,147,50,62,222,34,167,35,147,50,
+152,204,44,235,247,28,15,59,229,207,254,241,163,43,14,139,111,221,249,238,138,254,61,0,0,0,22,143,214,19,0,0,0,6,209,169,254,47,63,185,83,110,95,215,43,159,190,174,175,228,244,253,197,210,160,82,251,198,106,75,0,187,123,247,114,74,222,190,24,147,68,102,
+74,126,59,150,40,219,179,177,219,126,47,247,246,106,232,252,147,163,189,214,182,246,122,38,228,186,144,71,126,126,161,248,34,119,139,221,70,13,200,191,121,235,241,101,109,159,246,88,254,171,127,94,110,227,12,0,0,0,44,149,177,65,177,78,115,219,29,112,
+139,199,209,36,99,169,140,28,29,159,148,137,156,10,18,0,0,128,122,166,129,221,51,231,119,202,142,224,54,185,173,119,84,174,237,185,176,232,176,77,171,56,143,157,219,44,39,135,67,242,108,223,42,171,186,179,94,36,210,83,203,238,75,188,24,118,219,239,43,
+217,94,13,98,223,236,239,150,231,78,181,207,233,69,172,139,4,246,173,48,36,206,210,246,30,127,60,19,104,31,216,50,108,245,29,214,150,18,165,104,192,254,122,255,106,219,182,71,1,0,0,176,171,166,173,15,29,54,46,125,189,123,181,79,246,174,241,205,249,222,
+100,122,74,14,95,136,202,139,101,172,28,129,253,221,218,230,149,45,1,183,156,138,76,202,175,47,199,121,69,1,0,117,111,71,48,45,27,2,73,105,245,164,101,93,240,202,185,239,124,216,43,227,9,167,156,141,52,215,85,48,108,10,187,237,247,253,29,73,9,185,211,
+210,19,76,72,192,147,154,253,254,137,139,211,173,32,106,89,93,158,221,182,237,107,174,4,198,186,93,99,147,206,101,45,158,7,0,0,150,47,155,171,168,177,100,90,94,24,142,201,96,106,121,173,167,96,127,198,5,197,250,6,189,177,211,95,244,231,63,61,51,46,111,
+69,147,85,221,38,152,103,95,171,91,238,92,23,144,166,156,69,176,167,166,68,158,58,31,145,87,198,39,121,197,0,0,0,0,0,0,74,248,234,150,144,180,186,231,14,116,235,122,16,143,158,26,179,69,88,172,25,162,88,235,86,100,200,130,202,196,184,214,19,31,238,240,
+149,252,249,77,171,125,4,197,101,212,229,114,200,103,55,182,74,160,217,105,133,174,122,64,120,47,60,41,143,15,150,158,18,88,107,249,33,177,210,63,223,213,19,144,179,239,141,50,250,133,57,122,61,78,217,223,238,149,160,203,41,195,137,148,60,61,28,163,149,
+13,0,0,0,128,186,166,247,65,62,167,67,98,233,140,213,86,8,200,117,168,171,101,94,72,172,156,142,38,43,39,250,246,169,49,99,247,87,161,226,193,131,233,41,121,172,207,252,128,91,115,184,221,173,211,21,220,38,6,220,70,5,197,122,16,115,59,155,74,254,157,
+174,22,115,215,223,211,15,217,198,64,179,56,155,154,36,145,206,200,27,151,19,70,183,67,208,55,231,3,91,66,214,65,32,75,255,127,251,42,143,124,201,235,148,239,156,14,215,122,19,11,186,183,195,55,47,36,206,117,160,195,103,124,208,109,87,217,11,141,247,
+227,41,219,4,173,186,205,135,54,6,103,143,45,122,12,233,241,55,203,119,207,132,9,139,49,79,238,5,71,44,149,145,31,156,14,51,240,4,0,0,140,161,215,42,183,116,250,197,231,114,112,173,130,146,30,220,16,156,147,159,188,51,150,144,31,15,216,235,62,121,151,
+191,153,66,193,10,210,252,170,152,66,1,178,41,182,251,92,86,145,96,62,189,231,215,140,235,63,189,115,217,216,109,215,220,80,51,183,92,166,5,220,14,3,182,97,150,6,80,118,245,181,173,109,214,139,173,39,108,125,115,234,135,74,91,104,232,155,192,84,159,232,
+14,204,9,137,115,181,123,93,214,135,207,68,157,190,210,189,235,66,205,244,101,44,55,13,91,255,244,170,85,242,249,222,144,124,106,99,171,124,249,170,85,114,83,200,83,221,141,88,38,173,36,206,31,128,106,243,58,229,35,54,217,126,84,143,14,158,233,5,71,118,
+32,202,55,51,227,2,0,0,192,20,58,160,173,215,40,217,107,149,207,111,14,242,218,96,30,157,142,159,95,100,183,45,228,177,205,61,156,174,91,245,141,29,237,214,189,167,254,247,190,181,197,219,147,98,249,156,165,42,240,12,246,123,221,197,115,54,205,184,238,
+93,160,83,65,173,232,118,229,135,196,146,19,112,155,194,168,100,86,71,138,116,209,186,82,46,199,205,155,46,161,35,117,197,42,161,245,77,144,237,153,98,154,118,111,233,64,245,250,118,51,183,123,40,86,122,68,81,155,175,155,108,111,192,61,189,96,227,76,
+179,120,59,248,228,122,109,79,114,229,112,161,239,247,131,221,45,214,8,175,233,180,221,68,33,158,34,131,36,104,92,217,233,63,185,60,54,30,192,4,0,0,245,39,63,215,201,134,198,64,174,245,69,238,211,66,54,120,191,104,126,178,119,205,220,160,239,154,118,
+175,109,194,98,45,178,210,251,125,253,50,61,152,215,153,240,118,180,208,61,218,66,197,133,181,114,77,137,140,77,3,110,83,10,77,141,43,25,125,99,36,62,239,160,144,235,55,195,177,90,108,86,73,157,254,210,187,241,218,54,143,209,45,40,138,241,56,204,60,137,
+188,60,154,144,61,37,70,136,94,48,240,61,162,90,28,77,242,133,141,65,171,154,53,235,64,50,35,255,253,76,88,6,147,230,30,160,53,12,206,13,137,115,237,107,243,26,63,21,40,156,74,75,87,129,67,221,24,83,244,144,231,216,248,228,188,197,84,211,83,180,39,169,
+164,236,148,200,72,50,35,191,56,55,78,239,60,0,176,41,189,206,253,116,119,64,220,142,38,121,237,114,92,94,141,176,160,80,181,164,109,212,74,45,91,64,101,199,123,99,187,137,103,236,123,175,179,179,72,184,170,33,219,207,47,68,171,190,61,75,161,193,240,
+193,188,106,215,93,65,143,60,114,214,204,182,158,255,223,192,132,28,218,84,120,86,194,224,68,170,234,219,83,46,9,67,223,255,197,102,244,103,153,50,59,222,184,36,240,201,75,49,171,119,78,33,111,142,152,121,209,177,80,181,190,169,21,105,11,5,32,11,85,238,
+214,138,246,109,249,85,127,164,224,163,235,247,77,237,209,117,79,167,127,78,72,172,52,128,253,68,215,252,222,58,118,225,182,65,85,238,243,195,177,121,51,21,116,102,194,139,69,142,51,40,15,237,159,247,103,219,219,173,169,98,250,101,114,27,158,44,61,118,
+156,24,189,242,190,208,27,175,95,22,57,214,96,229,244,66,58,59,37,82,143,133,7,58,152,82,8,0,118,165,33,241,198,214,102,235,184,126,247,250,128,85,81,135,202,120,61,167,40,70,111,231,158,177,65,207,89,109,239,245,245,109,109,214,128,188,126,233,255,119,
+81,9,93,81,47,143,204,15,227,245,158,232,181,176,249,247,64,249,247,204,118,161,3,102,249,33,177,204,172,145,99,234,44,243,19,177,148,188,52,20,149,252,104,72,67,98,83,195,109,53,176,64,177,218,145,2,239,127,44,158,145,77,104,181,193,250,174,177,73,217,
+30,104,150,14,143,75,134,19,41,57,17,73,218,182,137,185,169,229,252,191,187,20,159,87,61,151,165,1,201,19,134,86,230,42,93,21,242,236,123,163,114,71,167,223,170,124,214,17,163,167,135,162,70,47,228,176,173,200,200,168,201,11,52,170,145,18,173,60,244,
+179,105,58,173,214,126,248,228,168,213,147,88,219,77,104,37,177,29,66,98,189,120,214,62,226,218,34,38,146,76,203,79,207,153,59,8,82,72,254,10,180,218,134,103,251,88,194,186,24,49,153,181,16,38,139,97,86,133,55,111,160,201,14,3,79,0,128,194,90,243,102,
+159,77,175,61,195,44,145,74,208,123,52,147,239,211,10,209,123,182,252,5,212,117,29,136,111,159,26,51,105,51,23,69,139,33,244,94,212,116,58,75,235,167,103,198,173,25,160,122,141,53,153,153,146,23,134,163,70,207,100,205,210,144,178,208,61,114,196,240,109,
+223,228,45,126,95,191,37,224,54,182,146,94,183,75,191,178,97,182,206,178,52,253,190,243,251,253,17,107,192,169,80,133,238,72,60,101,236,61,167,230,108,165,170,138,77,105,163,106,108,66,165,161,176,93,130,225,241,201,116,201,21,33,79,133,205,60,145,232,
+193,96,181,199,57,175,153,246,228,204,138,139,166,211,131,215,247,169,246,171,56,189,152,208,42,255,252,160,91,223,39,79,219,228,34,117,34,51,101,187,41,110,218,204,62,123,18,105,119,186,228,139,87,173,146,191,61,57,106,155,176,184,208,76,139,245,94,
+151,241,65,49,170,231,183,99,9,107,106,97,182,106,228,53,166,161,2,128,109,245,71,147,179,199,115,189,70,124,63,206,249,30,87,116,23,232,151,107,183,117,32,178,237,178,212,93,51,149,221,166,7,246,118,202,84,114,189,120,41,38,159,106,153,191,160,244,203,
+54,27,32,201,53,105,131,22,49,118,187,95,126,244,212,152,85,88,165,173,96,245,222,83,67,216,247,194,147,211,133,63,134,210,46,9,197,218,168,234,246,155,178,237,102,151,50,218,196,143,206,140,207,9,117,114,105,136,108,242,9,68,223,136,93,195,177,217,69,
+156,194,169,140,45,70,72,237,200,174,35,163,50,83,229,127,83,52,101,245,87,146,153,190,191,255,48,20,181,2,88,148,159,142,230,230,31,79,244,228,167,213,24,118,30,28,9,211,23,186,108,116,49,204,3,157,126,171,66,68,7,114,76,239,215,86,136,30,63,30,62,61,
+102,245,65,215,153,11,118,168,112,1,0,20,166,231,161,11,137,180,53,91,228,88,100,210,182,215,136,186,88,150,206,104,213,80,231,39,3,17,174,117,203,68,167,137,111,202,91,52,56,98,248,2,228,185,244,218,60,255,62,78,195,30,93,59,199,78,51,254,236,194,10,
+183,115,170,161,101,166,160,192,244,222,231,58,64,166,3,101,186,240,123,190,247,232,219,94,118,250,217,51,185,61,70,33,154,13,122,93,14,227,139,53,9,138,203,64,223,160,58,154,161,211,103,178,149,197,58,26,112,49,150,182,197,27,87,183,127,144,74,174,138,
+123,246,194,132,28,218,24,156,115,226,208,3,130,46,224,100,7,218,174,129,190,190,181,101,234,2,147,133,104,175,223,220,19,160,14,154,49,8,85,62,183,117,183,204,30,75,116,97,143,51,209,148,109,23,14,178,107,91,41,0,192,92,118,191,78,212,48,48,119,69,250,
+79,75,64,30,235,183,199,117,186,233,180,69,224,253,254,230,217,107,23,189,7,210,182,106,118,161,109,3,10,209,98,43,238,163,43,195,142,213,208,58,176,116,248,66,116,94,159,226,119,184,143,70,142,108,171,195,108,171,15,19,139,53,9,138,203,68,195,86,59,
+246,88,66,245,104,159,168,199,78,143,201,135,130,30,233,241,55,91,253,125,127,115,57,78,21,29,230,57,87,100,186,230,209,81,251,92,136,234,9,112,223,68,82,118,6,221,210,31,77,177,186,117,25,233,2,65,249,149,10,157,186,104,16,157,120,0,0,88,182,252,48,
+80,23,231,67,121,232,189,242,95,188,123,89,182,251,166,227,7,187,181,34,211,245,112,10,97,182,28,242,105,32,124,50,154,148,221,1,183,181,62,206,233,88,138,162,8,20,100,242,253,49,65,49,80,69,26,10,63,121,41,38,114,201,190,253,149,80,121,122,241,156,95,
+145,171,127,182,91,69,174,110,47,85,196,229,167,131,78,218,178,38,144,179,112,144,29,86,176,6,0,192,100,111,133,19,115,218,11,188,67,5,96,217,217,117,173,10,173,136,126,48,175,117,134,86,69,115,157,139,66,244,158,159,74,115,216,89,211,214,135,14,211,
+120,9,0,12,101,151,149,149,81,93,93,205,14,185,161,205,43,193,102,167,188,114,57,78,165,2,0,0,101,160,83,129,181,178,88,103,254,233,162,205,244,40,70,150,86,67,223,214,233,151,64,179,211,234,185,172,225,49,253,137,1,212,35,130,98,0,0,0,204,113,168,107,
+186,191,158,201,43,71,163,113,117,185,28,18,106,118,216,182,58,17,0,0,192,84,246,89,25,9,0,0,160,134,254,176,39,96,5,84,245,78,67,98,109,125,163,95,217,192,24,48,133,126,6,31,216,18,146,67,155,130,214,172,155,70,144,237,235,10,0,0,80,105,4,197,0,0,0,
+11,248,234,150,144,108,106,117,91,1,85,35,132,197,89,161,102,167,25,27,2,204,184,163,211,47,78,199,244,130,158,183,116,250,235,126,183,232,96,141,134,226,12,218,0,0,128,106,32,40,6,0,0,40,65,171,22,91,221,211,129,169,6,84,251,115,22,154,172,71,218,110,
+66,23,208,28,137,167,228,145,179,97,222,26,48,202,247,251,35,50,62,153,150,116,102,74,126,112,186,190,223,159,218,47,55,187,176,173,254,183,81,42,168,1,0,64,237,48,143,9,0,0,160,4,93,80,178,119,52,97,5,53,26,160,62,49,28,171,251,221,69,111,98,152,236,
+219,167,198,172,202,254,122,95,72,234,215,151,227,114,109,155,199,26,168,210,112,156,197,109,1,0,64,165,177,152,29,0,0,192,34,104,159,80,22,207,2,80,109,218,118,130,193,27,0,0,80,13,180,158,0,0,0,88,4,66,98,0,181,64,72,12,0,0,170,133,160,24,0,0,0,0,0,
+0,0,26,28,65,49,0,0,0,0,0,0,0,52,56,130,98,0,0,0,0,0,0,0,104,112,4,197,0,0,0,0,0,0,0,208,224,8,138,1,0,0,0,0,0,0,160,193,17,20,3,0,0,0,0,0,0,64,131,35,40,6,0,0,0,42,104,187,207,37,93,46,46,187,1,0,0,96,54,23,175,15,0,0,0,80,25,251,90,221,114,87,79,64,
+210,153,41,121,244,212,152,12,166,50,236,105,0,0,0,24,137,210,6,0,0,0,160,66,110,233,244,91,191,216,233,104,146,59,102,254,31,0,0,0,48,17,65,49,0,0,0,80,33,63,56,29,182,170,137,199,39,211,242,253,254,8,187,25,0,0,0,198,162,245,4,0,0,0,80,33,218,106,130,
+150,19,0,0,0,176,3,42,138,1,0,0,128,10,34,36,6,0,0,128,29,16,20,3,0,0,0,0,0,0,64,131,35,40,6,0,0,0,0,0,0,128,6,71,80,12,0,0,0,219,107,113,52,241,34,46,19,251,14,0,0,0,66,80,12,0,0,0,187,235,245,56,229,203,87,173,146,155,66,30,94,203,37,250,76,119,139,
+124,97,99,144,176,24,0,0,0,4,197,0,0,0,176,183,3,29,126,113,59,155,228,230,181,126,2,207,37,216,229,111,150,109,33,143,180,121,157,114,75,155,215,54,219,13,0,0,128,202,112,177,95,1,0,0,96,103,63,25,136,200,231,28,173,242,236,133,9,153,200,76,241,90,46,
+210,91,209,164,180,13,76,200,122,191,75,158,188,20,179,197,54,3,0,0,160,114,154,182,62,116,152,171,105,0,0,0,0,0,0,0,104,96,180,158,0,0,0,0,0,0,0,128,6,87,211,214,19,247,118,248,228,3,171,125,210,52,211,74,110,106,74,228,76,100,82,190,223,31,105,244,
+215,5,51,180,207,224,38,175,75,222,143,167,152,74,10,0,0,0,0,0,80,69,93,205,14,217,29,112,91,15,120,44,50,41,131,201,12,187,191,142,213,172,245,196,161,174,22,217,190,170,240,202,212,35,241,148,124,231,116,184,234,219,84,239,116,193,18,101,151,208,245,
+190,181,126,185,166,253,202,194,42,131,19,41,249,97,255,56,129,49,0,0,0,0,0,64,133,221,20,242,200,193,238,150,57,15,242,230,72,92,126,126,33,106,244,174,215,112,251,67,65,143,244,248,155,165,63,154,148,215,194,9,2,238,69,170,73,69,113,151,203,81,52,36,
+86,237,94,151,108,247,185,228,68,44,85,213,237,90,172,189,1,183,116,122,156,214,223,126,59,50,41,125,137,180,145,219,153,165,1,241,157,221,45,18,104,190,210,105,196,244,15,118,126,72,172,186,90,92,242,133,141,65,121,248,244,88,205,182,11,230,208,227,
+200,103,55,182,74,171,123,250,179,56,62,153,150,31,157,25,151,193,20,7,255,70,167,23,51,251,59,124,214,94,56,49,154,96,129,38,0,0,128,25,122,159,213,225,113,201,100,102,74,94,24,142,26,127,47,139,234,208,66,190,222,86,183,36,210,25,121,227,114,66,126,
+125,57,206,158,135,149,37,229,135,196,74,179,154,11,137,180,188,56,150,48,114,39,229,135,219,154,37,237,93,227,147,231,6,38,140,221,102,117,247,106,159,92,219,238,21,183,115,186,237,130,22,75,234,66,205,213,62,78,215,36,40,222,221,234,94,240,239,92,223,
+238,149,19,134,181,160,208,54,8,26,84,182,121,157,179,223,211,55,219,59,99,9,249,241,192,68,77,183,173,24,29,69,249,68,79,96,246,141,150,149,13,97,77,13,139,243,67,226,44,221,247,122,176,210,85,186,81,30,249,129,107,44,149,145,231,135,162,242,202,248,
+164,209,123,56,119,155,149,254,191,126,239,219,167,24,72,104,100,122,204,203,189,40,208,99,244,233,88,138,99,70,25,60,184,33,104,93,100,169,215,135,99,242,196,48,1,60,0,160,114,246,181,186,229,96,87,139,164,167,166,108,113,109,106,7,183,182,121,231,220,
+103,125,210,219,42,223,58,57,218,232,187,165,225,125,105,115,208,42,214,83,110,167,83,110,236,244,91,255,111,122,88,172,199,136,91,58,253,226,115,57,36,157,153,178,138,225,184,62,45,175,237,129,230,162,191,111,87,208,99,100,232,170,247,131,55,175,245,
+23,252,153,126,255,232,248,164,145,179,212,139,21,75,30,218,24,148,199,207,132,171,26,22,27,187,152,157,199,97,222,166,125,174,167,117,78,72,156,181,45,228,177,146,127,19,221,210,225,155,23,18,103,21,11,99,107,45,219,34,163,152,205,190,154,182,214,46,
+73,79,86,255,254,234,85,242,181,173,109,214,127,247,45,98,80,164,214,238,239,13,205,9,92,245,68,123,87,79,192,10,144,77,150,187,205,89,133,190,135,198,210,222,60,255,61,96,242,49,195,78,178,33,177,218,217,102,230,249,3,0,80,63,238,92,55,93,236,162,215,
+166,183,23,168,104,195,210,109,9,204,189,55,201,157,113,106,170,133,238,13,177,50,122,207,151,13,137,115,125,112,181,217,215,122,58,3,93,239,89,125,51,247,172,78,71,147,236,233,240,89,235,96,153,78,139,47,254,108,123,187,124,99,71,187,241,153,129,206,
+62,176,27,237,165,92,44,3,211,239,95,103,224,254,214,112,187,88,62,167,219,124,160,163,112,240,93,41,53,57,51,132,23,49,53,124,40,102,86,245,151,190,112,185,55,201,249,174,53,52,116,13,186,74,7,103,38,158,120,23,170,252,59,109,104,75,18,29,161,207,158,
+172,178,23,181,250,231,91,13,14,84,244,4,91,236,32,122,192,6,39,89,84,143,78,223,249,211,171,166,7,65,116,180,83,103,88,152,104,36,57,127,164,213,212,99,6,80,138,126,198,76,29,132,6,26,93,151,13,194,181,122,208,148,115,169,225,104,50,243,186,195,110,
+78,69,230,86,101,71,12,238,215,169,237,30,245,186,243,83,27,91,173,255,238,13,152,95,128,99,71,197,102,123,59,13,255,204,221,214,89,56,56,251,128,225,215,78,90,189,173,185,82,118,247,102,51,131,237,134,22,182,228,31,51,114,133,83,102,182,173,241,44,112,
+159,26,50,176,32,238,170,5,114,185,46,127,117,223,31,53,217,67,58,109,40,93,162,212,123,106,74,140,155,50,80,168,74,45,87,177,176,205,116,133,66,21,19,188,83,100,10,131,94,204,152,58,133,188,216,168,235,245,107,204,61,89,173,47,48,122,156,21,90,224,61,
+95,107,218,147,56,95,161,239,153,70,67,86,189,216,213,47,187,132,64,217,118,14,90,117,162,199,58,29,237,188,197,208,1,16,93,160,224,201,115,17,171,159,147,126,105,31,42,83,143,25,90,61,160,3,73,166,87,239,103,105,191,103,61,63,235,249,251,185,65,51,219,
+45,213,139,108,171,43,109,157,242,25,170,232,0,163,244,122,156,114,255,230,16,159,205,42,208,243,120,86,177,123,3,211,232,57,93,207,237,166,134,62,218,74,64,167,231,235,190,61,51,158,148,95,156,27,55,96,171,10,187,173,187,101,246,30,91,255,123,155,141,
+62,115,122,237,172,239,3,45,180,48,181,184,34,171,88,123,9,237,85,108,178,64,145,123,85,147,243,237,98,213,219,98,21,105,85,183,98,116,177,126,59,150,144,201,116,225,236,238,229,17,51,91,147,12,45,208,162,129,34,162,133,213,236,12,246,204,192,132,53,
+157,168,208,7,249,169,243,102,245,38,182,179,183,194,137,162,149,208,86,144,98,232,40,242,63,12,69,229,115,46,231,156,109,215,144,216,228,139,25,95,145,176,199,105,240,197,193,177,241,201,217,30,84,249,76,171,234,207,167,11,215,21,90,204,206,100,26,12,
+231,78,41,209,16,40,145,153,50,190,255,215,238,2,21,28,186,122,172,24,186,72,220,171,145,73,235,203,100,185,189,224,116,48,233,209,83,99,198,47,196,248,184,134,195,4,196,85,119,46,202,197,44,96,18,189,153,215,208,106,115,192,45,93,205,49,86,80,175,160,
+71,206,134,103,7,83,237,176,88,177,134,195,135,54,5,103,255,252,210,80,212,200,107,60,147,23,52,207,149,95,136,101,151,194,44,29,76,210,158,162,217,237,213,5,150,255,251,153,176,209,199,10,93,123,98,79,206,108,82,45,10,48,253,190,42,146,76,75,187,115,
+126,206,81,170,32,177,214,22,179,86,151,105,180,151,175,246,199,189,109,109,203,108,54,115,57,158,150,231,46,152,187,16,166,222,7,222,16,79,23,108,27,171,219,110,98,17,209,201,104,82,14,150,248,249,96,149,239,7,106,22,20,107,85,241,217,147,163,114,71,
+167,95,186,103,202,172,7,162,73,121,151,207,228,133,0,0,17,96,73,68,65,84,122,40,106,228,133,128,190,153,238,76,102,138,246,113,210,17,89,19,105,115,241,245,126,151,213,71,57,151,142,10,233,234,137,166,210,3,146,94,28,234,137,214,231,116,204,190,6,38,
+211,147,82,161,80,216,228,147,149,126,214,116,192,32,127,48,65,223,31,166,47,4,160,219,110,183,133,235,122,10,76,41,209,94,113,166,7,197,163,5,46,108,77,157,106,100,23,185,213,4,122,220,208,11,199,65,86,151,198,12,61,7,126,247,76,88,118,248,155,141,31,
+244,0,26,205,79,6,34,242,105,9,200,11,195,81,66,226,42,176,67,64,156,149,95,17,168,179,13,77,191,198,51,89,36,239,222,219,228,54,25,185,178,131,73,89,250,28,110,104,243,26,29,208,235,125,223,203,163,137,217,32,211,14,239,219,159,158,139,200,131,87,175,
+154,247,253,35,23,205,189,135,45,85,164,149,200,152,251,254,214,64,88,179,25,59,209,235,104,93,99,44,55,231,208,220,227,135,253,102,14,128,232,245,132,206,156,201,207,237,178,244,154,163,154,106,58,39,70,79,252,223,239,183,79,245,240,83,3,19,242,137,
+158,192,188,209,76,13,213,158,50,56,116,253,241,192,132,220,20,77,201,213,218,212,219,209,100,245,153,209,41,4,38,174,244,152,111,122,148,202,30,129,212,185,137,164,108,42,48,74,168,223,55,153,30,244,181,233,255,182,85,30,171,23,149,14,216,216,233,115,
+105,119,147,54,248,28,106,80,117,117,206,137,75,47,212,159,103,69,225,21,209,22,14,180,91,172,28,157,238,105,151,243,92,49,186,237,132,196,128,121,244,179,249,152,161,55,154,75,165,83,226,237,124,156,52,93,138,125,187,34,58,147,52,91,197,168,1,143,201,
+69,78,185,220,5,10,135,236,176,32,152,85,64,100,163,129,13,221,222,71,222,27,149,79,173,15,88,109,40,180,85,198,139,23,99,86,65,162,169,116,155,71,226,169,130,237,39,180,96,18,229,147,95,120,168,45,87,77,31,220,213,220,238,190,244,212,156,25,200,122,
+223,173,57,100,181,171,183,155,182,62,116,152,51,216,18,232,27,109,127,187,119,118,145,184,225,68,74,158,30,142,113,145,5,139,174,96,154,63,106,101,183,209,55,84,142,46,194,113,247,250,192,156,223,255,211,51,227,198,87,203,103,105,191,53,237,215,110,
+151,237,53,153,246,39,206,182,95,210,11,198,239,156,230,56,81,46,218,55,84,7,53,116,106,153,86,19,112,126,6,128,249,180,119,234,205,107,253,214,148,98,83,167,15,219,141,182,201,184,191,55,100,21,21,233,128,240,223,157,9,203,9,122,97,54,156,236,117,72,
+46,83,219,144,160,54,52,51,88,227,115,90,179,10,99,169,140,252,178,63,194,177,2,115,236,242,55,75,44,157,169,217,249,153,160,24,0,170,72,15,250,155,103,22,56,121,59,50,201,205,25,80,70,217,69,224,180,39,153,206,246,121,236,244,24,83,195,1,32,143,94,139,
+124,106,99,171,245,77,173,86,250,214,201,81,118,17,80,38,122,45,146,59,229,93,91,84,214,203,44,4,0,141,129,160,24,0,0,212,141,236,13,154,78,81,101,32,6,0,10,211,170,71,93,144,143,138,98,160,50,90,102,90,80,48,179,9,128,221,16,20,3,0,0,0,64,131,209,150,
+82,204,186,0,0,0,185,28,236,13,0,0,0,0,104,44,132,196,0,0,32,31,65,49,0,0,0,0,0,0,0,52,56,130,98,0,0,0,0,0,0,0,104,112,4,197,0,0,0,88,145,67,93,45,236,64,44,91,151,203,33,247,118,248,216,129,0,0,0,53,70,80,12,0,0,128,101,251,234,150,144,108,95,229,145,
+47,109,14,178,19,177,44,15,108,9,201,158,14,31,3,14,0,0,0,53,70,80,12,0,0,128,101,59,31,77,89,255,244,229,75,113,118,34,150,229,189,240,164,245,207,250,38,146,236,64,0,0,128,26,106,218,250,208,225,41,94,0,0,0,0,0,181,162,237,39,6,83,25,246,63,0,0,64,
+13,81,81,12,0,0,0,160,166,8,137,1,0,0,106,143,160,24,0,0,0,0,0,0,0,26,28,65,49,0,0,0,0,0,0,0,52,56,130,98,0,0,0,0,0,0,0,104,112,4,197,0,0,0,0,0,0,0,208,224,8,138,1,0,0,0,0,0,0,160,193,17,20,3,0,0,0,0,0,0,64,131,115,53,250,14,0,0,0,0,42,233,171,91,66,
+226,119,57,228,209,83,99,50,152,202,176,175,1,0,0,96,36,42,138,1,0,0,128,10,217,238,115,73,171,219,41,78,71,147,236,95,229,97,55,3,0,0,192,88,84,20,3,0,0,0,21,114,34,150,146,95,245,71,164,219,227,148,39,134,99,236,102,0,0,0,24,139,160,24,0,0,0,168,160,
+87,198,39,69,198,217,195,0,0,0,48,27,173,39,0,0,0,0,0,0,0,160,193,17,20,3,0,0,0,0,0,0,64,131,35,40,6,0,0,0,0,0,0,128,6,71,80,12,0,0,0,0,0,0,0,13,142,160,24,0,0,0,0,0,0,0,26,28,65,49,0,0,0,0,0,0,0,52,56,130,98,0,0,0,0,0,0,0,104,112,4,197,0,0,0,0,0,0,0,
+208,224,8,138,1,0,0,0,0,0,0,160,193,17,20,3,0,0,0,0,0,0,64,131,115,85,251,233,119,53,59,228,42,127,179,132,92,14,57,29,75,201,91,209,100,163,191,6,0,0,0,0,0,0,0,80,83,85,13,138,111,10,121,228,96,119,203,236,159,247,138,200,193,120,90,190,123,38,44,19,
+153,41,222,9,101,182,175,213,109,253,194,87,198,39,109,177,189,183,182,121,101,75,192,45,137,76,70,142,140,196,229,68,44,101,192,86,1,0,0,0,0,0,64,117,185,28,242,137,238,128,180,123,157,146,158,154,146,51,145,164,60,62,56,97,252,190,57,212,213,34,161,
+102,167,245,255,71,71,227,198,103,101,186,159,239,232,244,139,199,49,221,12,226,133,225,104,85,114,178,166,173,15,29,174,74,66,187,55,224,150,187,215,7,10,254,236,114,60,45,15,159,30,171,198,102,44,217,118,159,75,62,209,19,16,159,107,250,133,137,165,
+50,242,252,80,212,232,55,212,189,29,62,249,192,106,159,52,53,77,255,121,106,74,228,55,23,162,242,235,203,241,90,111,90,81,95,221,18,146,86,183,115,206,143,79,140,38,108,113,176,65,229,237,242,55,203,102,159,75,18,153,41,249,237,88,130,129,37,0,0,0,0,
+168,130,94,207,244,125,122,95,34,205,238,134,21,94,62,176,37,36,78,71,211,156,157,49,18,79,201,119,78,135,141,220,65,197,182,217,228,204,73,11,63,239,234,153,159,161,86,99,155,171,86,81,124,67,135,175,232,207,218,188,78,43,72,126,53,98,86,248,170,33,
+241,161,77,193,57,223,211,192,216,122,177,250,35,70,134,197,90,149,187,39,111,95,107,96,124,99,167,95,206,197,83,70,86,233,234,168,78,126,72,172,182,175,242,200,246,177,132,177,149,197,45,142,38,249,72,200,35,158,153,131,205,107,225,132,12,38,51,53,223,
+174,82,244,115,118,160,211,47,129,230,233,129,143,55,71,226,242,243,11,81,83,55,215,114,247,106,159,236,93,115,229,61,189,51,228,97,22,66,3,251,247,87,175,154,29,184,99,48,105,101,244,162,127,157,215,37,47,142,37,236,252,52,140,97,183,89,60,0,80,175,
+244,122,247,120,52,201,181,226,10,124,105,115,80,218,189,211,81,1,215,91,141,75,239,119,63,215,211,42,93,45,211,239,133,203,54,152,13,174,219,124,79,167,95,182,133,60,214,159,207,140,39,229,39,3,17,227,143,7,58,251,126,87,112,122,155,79,69,38,141,46,
+242,211,10,215,252,192,85,233,49,67,175,135,77,188,22,254,236,198,214,130,219,108,114,230,116,231,186,194,133,182,186,205,183,38,210,21,125,143,84,109,49,59,13,131,75,233,244,148,254,121,45,124,162,64,122,159,117,176,171,165,198,91,87,216,7,87,123,139,
+254,236,247,186,205,220,230,141,129,230,162,63,59,208,225,175,234,182,44,197,23,54,6,173,0,94,67,76,253,186,127,115,200,170,124,53,149,246,7,191,173,187,101,54,36,86,215,180,123,173,32,214,100,185,33,177,204,28,75,62,50,115,226,55,153,14,52,233,192,77,
+54,60,178,3,157,141,240,224,134,160,252,97,79,192,26,117,53,141,14,42,249,114,182,75,79,146,88,30,13,137,15,109,12,90,237,160,110,178,193,231,201,116,217,17,127,253,210,207,62,42,79,111,4,53,12,66,101,180,20,184,153,66,229,232,204,58,253,194,202,233,
+57,77,103,177,234,117,58,239,227,229,209,115,90,54,36,150,153,235,45,19,175,11,245,186,245,107,91,219,172,175,67,134,222,155,219,157,6,174,217,144,88,102,238,195,62,221,93,60,35,49,65,110,72,172,54,182,54,91,97,183,201,238,91,235,183,174,201,117,95,235,
+151,102,12,159,49,52,187,81,221,37,50,143,157,65,51,175,205,10,21,38,102,153,152,57,105,142,208,84,226,20,182,165,194,215,192,85,59,226,79,166,237,55,162,235,43,113,66,116,59,205,188,240,112,150,120,55,121,156,230,157,224,101,129,109,54,149,126,112,243,
+7,63,244,61,113,112,173,185,193,246,238,128,187,224,251,182,199,224,112,187,88,240,238,49,252,194,95,47,86,117,54,130,158,228,53,56,210,240,213,116,186,205,58,27,65,47,78,54,181,186,229,254,94,243,110,88,189,134,30,119,243,233,241,65,95,115,253,175,169,
+180,146,56,123,60,88,239,39,216,92,169,179,177,148,164,51,83,214,215,152,225,51,75,234,133,222,8,106,24,212,213,108,230,181,141,157,105,184,166,33,155,201,55,169,245,68,207,21,122,3,171,95,38,159,55,236,226,230,153,107,113,189,78,223,97,232,53,174,126,
+198,244,181,214,207,152,137,69,38,193,2,247,192,33,195,142,181,26,102,235,117,171,94,203,232,151,85,97,103,131,207,143,110,183,206,142,211,112,219,14,247,7,65,215,252,112,77,131,87,147,109,43,80,0,161,247,55,189,6,22,38,202,76,49,151,22,111,229,211,231,
+97,234,54,107,79,226,98,70,105,79,82,21,237,11,20,226,174,84,213,142,248,167,23,104,43,161,211,246,81,89,165,62,208,181,52,16,77,22,125,116,109,48,110,162,98,65,229,66,149,243,181,100,122,184,90,200,91,209,100,193,65,166,177,148,217,65,76,126,165,171,
+94,156,152,94,101,216,155,87,249,108,93,116,27,182,205,79,15,205,109,147,162,125,176,76,163,149,76,55,206,84,95,232,127,77,173,214,213,118,19,207,13,76,200,59,99,9,249,241,128,185,211,73,245,134,202,14,85,249,131,169,140,60,122,106,204,250,26,52,252,
+248,84,47,254,97,40,42,79,158,139,24,223,242,201,142,116,122,238,197,68,74,206,69,89,84,184,26,116,234,168,78,237,215,47,147,167,26,219,197,227,103,194,214,181,163,158,227,76,107,107,152,117,71,135,207,186,70,208,32,232,83,27,91,141,27,240,210,247,97,
+58,103,154,190,238,79,211,166,101,23,170,90,172,116,133,221,74,233,117,245,93,51,107,31,233,117,182,94,43,106,139,15,147,77,22,104,215,160,237,39,80,62,237,205,197,243,3,159,161,133,126,186,112,93,49,47,143,154,153,235,165,75,180,30,25,75,154,247,158,
+14,47,112,63,49,82,225,207,97,213,222,121,207,15,199,138,86,21,107,159,84,19,47,244,99,37,94,156,82,111,180,90,234,43,209,15,230,119,151,204,188,248,212,240,167,208,254,28,159,76,219,174,215,163,201,149,243,197,6,99,250,75,4,245,38,120,118,96,98,206,
+126,213,96,203,142,61,85,215,123,205,14,138,11,13,36,153,118,83,160,1,220,35,239,141,90,55,211,175,15,199,140,92,44,33,148,87,133,147,255,103,147,188,104,131,144,56,219,206,193,46,97,49,33,113,245,104,152,105,106,8,84,15,244,216,64,255,242,234,209,254,
+175,118,232,1,171,237,7,190,190,173,205,232,54,25,186,216,214,195,39,71,141,126,255,118,120,230,94,19,150,10,138,106,69,7,62,245,90,75,191,254,226,221,203,198,109,223,219,225,249,199,255,161,152,217,247,52,123,10,20,15,180,121,204,190,63,120,97,56,58,
+239,254,246,55,195,177,154,109,207,98,12,78,204,191,127,137,36,51,198,46,196,55,82,34,164,140,165,205,188,174,212,243,85,161,130,157,151,134,162,198,94,11,31,185,88,248,125,171,57,148,137,231,95,205,193,74,101,75,250,217,172,36,231,234,143,61,240,31,
+171,241,68,35,153,41,57,57,62,41,107,154,157,18,154,41,161,215,15,236,27,35,113,249,165,161,7,155,100,50,35,87,23,233,177,242,198,165,184,156,48,176,210,226,88,36,41,215,6,154,231,181,205,208,3,230,79,134,204,188,0,213,247,198,63,95,138,203,102,143,83,
+60,206,38,73,101,166,228,84,120,82,254,235,217,113,3,182,174,176,241,84,70,174,13,121,230,53,68,63,122,41,46,239,26,186,248,158,238,231,116,50,99,181,154,200,110,183,213,220,223,208,247,69,214,192,100,90,142,142,38,228,252,68,74,94,27,137,203,97,67,71,
+41,115,29,88,237,155,215,83,232,123,231,204,125,63,75,129,227,157,30,51,76,156,233,161,239,99,61,206,153,120,252,85,122,252,218,17,156,62,54,232,201,253,249,139,81,25,181,97,235,37,19,220,220,238,149,142,153,1,150,137,201,180,177,175,57,0,52,138,47,110,
+14,138,215,229,176,218,217,105,104,124,172,68,85,89,45,37,13,63,237,182,57,155,100,195,204,26,45,122,173,240,204,197,168,113,219,172,215,91,122,222,53,245,220,123,126,50,45,219,125,205,18,112,79,223,243,106,104,245,131,243,102,223,211,92,229,117,73,87,
+94,171,145,100,102,74,94,28,49,119,38,129,94,195,106,134,35,233,41,25,136,166,228,31,7,39,228,93,3,103,244,229,186,156,72,201,6,223,149,60,68,51,167,95,156,27,55,246,122,92,63,107,171,29,77,178,54,111,38,167,222,167,255,15,131,103,153,188,50,154,144,
+161,137,164,232,86,247,71,146,242,203,243,19,242,134,193,5,104,125,241,148,52,167,167,100,157,223,37,142,153,27,117,45,76,252,111,167,195,214,107,96,162,147,225,73,185,110,149,103,118,123,179,116,0,239,165,2,131,101,229,212,180,245,161,195,220,193,150,
+160,85,76,183,119,183,204,6,107,90,116,247,47,151,98,242,132,225,35,105,58,181,229,250,153,94,55,71,70,226,70,174,226,104,119,218,51,232,227,221,1,171,221,132,94,228,233,160,199,147,151,204,126,95,200,76,95,180,77,94,151,53,122,201,148,221,202,208,227,
+134,46,120,169,211,202,244,152,241,212,249,136,45,170,227,245,166,111,119,171,219,154,234,98,183,106,126,147,232,20,82,173,14,226,51,182,114,217,197,105,88,109,189,60,180,21,202,7,219,188,198,175,88,14,148,139,94,171,125,114,125,171,21,18,152,90,77,102,
+39,122,157,240,192,150,144,68,83,25,249,246,169,177,70,223,29,43,162,239,77,157,86,254,126,60,197,241,184,129,104,69,126,110,161,145,6,62,166,231,10,118,149,253,140,189,101,248,236,217,44,237,177,157,109,159,162,51,126,237,144,43,160,58,178,239,13,157,
+53,161,173,61,170,81,181,77,80,12,0,0,208,0,116,225,164,205,1,183,213,195,147,208,12,141,96,111,192,109,45,122,168,109,238,126,126,161,178,211,52,1,96,33,58,216,114,71,167,95,60,14,135,156,138,76,210,151,28,128,145,8,138,1,0,0,26,132,86,188,83,233,142,
+70,162,85,101,12,140,0,0,0,44,142,185,171,236,0,0,0,160,172,8,137,209,104,8,137,1,0,0,22,143,160,24,0,0,0,0,0,0,0,26,28,65,49,0,0,0,0,0,0,0,52,56,130,98,0,0,0,0,0,0,0,104,112,4,197,0,0,0,0,0,0,0,208,224,8,138,1,0,0,0,0,0,0,160,193,17,20,3,0,0,0,0,0,0,
+64,131,35,40,6,0,0,0,0,0,0,128,6,71,80,12,0,0,0,0,0,0,0,13,142,160,24,0,0,0,0,0,0,0,26,28,65,49,0,0,0,0,0,0,0,52,56,130,98,0,0,0,0,0,0,0,104,112,4,197,0,0,0,0,0,0,0,208,224,8,138,1,0,0,0,0,0,0,160,193,17,20,3,0,0,0,0,0,0,64,131,35,40,6,0,0,0,0,0,0,128,
+6,71,80,12,0,0,0,84,208,131,27,130,114,107,155,151,93,12,0,0,0,163,185,120,121,0,0,0,128,202,121,228,108,152,189,11,0,0,0,227,81,81,12,0,0,0,0,0,0,0,13,142,160,24,0,0,0,0,0,0,0,26,28,65,49,0,0,0,0,0,0,0,52,56,130,98,0,0,0,0,0,0,0,104,112,4,197,0,0,0,
+0,0,0,0,208,224,8,138,1,0,0,0,0,0,0,160,193,17,20,3,0,0,0,0,0,0,64,131,35,40,6,0,0,0,0,0,0,128,6,71,80,12,0,0,0,0,0,0,0,13,142,160,24,0,0,0,0,0,0,0,26,28,65,49,0,0,0,0,0,0,0,52,56,130,98,0,0,0,0,0,0,0,104,112,4,197,0,0,0,0,0,0,0,208,224,92,213,124,250,
+247,118,248,164,211,215,108,253,255,80,44,41,79,12,199,140,223,251,45,142,38,217,228,117,73,44,157,145,190,68,218,128,45,2,0,0,0,0,0,0,176,84,187,252,211,185,228,72,50,45,131,201,140,209,251,79,51,201,123,58,253,18,116,57,173,63,15,39,82,242,244,112,
+76,38,50,83,21,123,204,170,4,197,93,46,135,220,223,27,18,183,179,233,202,247,90,92,178,179,205,43,143,245,141,201,96,202,204,23,230,238,213,62,217,187,198,55,251,231,72,50,35,191,56,55,110,116,96,188,55,224,150,15,181,121,173,253,59,56,145,146,215,46,
+199,229,213,200,164,1,91,86,92,87,179,67,118,7,220,226,113,52,201,88,42,35,47,142,37,76,221,212,57,246,181,186,173,63,190,50,110,246,254,5,0,0,0,0,0,102,211,140,33,232,154,158,248,255,235,203,113,227,183,87,3,215,125,109,94,113,59,154,100,50,51,37,47,
+12,71,141,206,203,122,61,78,249,228,250,86,9,52,95,105,174,240,230,72,92,126,126,33,90,211,237,42,70,67,226,47,108,12,74,155,215,57,251,55,52,235,235,241,55,203,119,207,132,43,22,22,55,109,125,232,112,229,98,232,25,95,218,28,148,118,111,225,76,122,36,
+158,146,239,156,14,87,122,19,150,44,63,36,206,154,76,79,201,195,39,71,43,154,222,47,151,134,196,119,175,15,204,251,215,47,13,69,141,61,200,232,7,245,208,198,224,156,65,132,203,241,116,69,223,244,43,165,3,31,15,108,9,137,211,49,189,205,83,83,34,79,157,
+143,24,29,24,235,54,127,106,125,64,2,205,211,7,152,129,104,82,190,223,31,169,249,118,45,228,80,87,139,132,154,157,146,200,100,228,233,161,168,177,131,74,185,116,224,163,189,217,41,239,199,83,198,190,135,1,0,0,0,96,41,178,33,166,29,2,76,245,224,6,205,
+161,166,239,127,223,190,28,55,126,70,123,126,110,150,206,76,201,163,167,204,45,172,44,148,63,105,94,246,248,153,176,145,97,177,134,174,95,190,106,213,156,236,41,235,185,129,9,35,11,22,239,91,235,151,107,218,189,5,127,246,234,197,152,60,121,169,2,239,
+105,17,249,255,1,55,21,207,181,55,41,195,249,0,0,0,0,73,69,78,68,174,66,96,130,0,0 };
+
+const char* background_png = (const char*) temp_binary_data_0;
+
+
+const char* getNamedResource (const char* resourceNameUTF8, int& numBytes);
+const char* getNamedResource (const char* resourceNameUTF8, int& numBytes)
+{
+    unsigned int hash = 0;
+
+    if (resourceNameUTF8 != nullptr)
+        while (*resourceNameUTF8 != 0)
+            hash = 31 * hash + (unsigned int) *resourceNameUTF8++;
+
+    switch (hash)
+    {
+        case 0x551aef98:  numBytes = 176810; return background_png;
+        default: break;
+    }
+
+    numBytes = 0;
+    return nullptr;
+}
+
+const char* namedResourceList[] =
+{
+    "background_png"
+};
+
+const char* originalFilenames[] =
+{
+    "background.png"
+};
+
+const char* getNamedResourceOriginalFilename (const char* resourceNameUTF8);
+const char* getNamedResourceOriginalFilename (const char* resourceNameUTF8)
+{
+    for (unsigned int i = 0; i < (sizeof (namedResourceList) / sizeof (namedResourceList[0])); ++i)
+    {
+        if (namedResourceList[i] == resourceNameUTF8)
+            return originalFilenames[i];
+    }
+
+    return nullptr;
+}
+
+}
@@ -0,0 +1,132 @@
+/*
+  ==============================================================================
+
+    BenchmarkUtils.h
+    Created: 19 Oct 2026
+    Author:  GELVS
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+
+#if JUCE_INTEL
+ #if JUCE_MSVC
+  #include <intrin.h>
+ #else
+  #include <x86intrin.h>
+ #endif
+#endif
+
+namespace Benchmark
+{
+    //==============================================================================
+    /* Summary of a set of timings (any unit, as long as it is the same for all of them) */
+    struct Statistics
+    {
+        double mean = 0, min = 0, p50 = 0, p99 = 0, max = 0;
+        int count = 0;
+
+        static Statistics from (std::vector<double> values)
+        {
+            Statistics s;
+
+            if (values.empty())
+                return s;
+
+            std::sort (values.begin(), values.end());
+
+            auto percentile = [&values] (double p)
+            {
+                const auto index = (size_t) juce::jlimit (0.0, (double) values.size() - 1, std::ceil (p * (double) values.size()) - 1);
+                return values[index];
+            };
+
+            s.count = (int) values.size();
+            s.mean = std::accumulate (values.begin(), values.end(), 0.0) / (double) values.size();
+            s.min = values.front();
+            s.p50 = percentile (0.5);
+            s.p99 = percentile (0.99);
+            s.max = values.back();
+            return s;
+        }
+
+        juce::var toVar() const
+        {
+            auto* object = new juce::DynamicObject();
+            object->setProperty ("count", count);
+            object->setProperty ("mean", mean);
+            object->setProperty ("min", min);
+            object->setProperty ("p50", p50);
+            object->setProperty ("p99", p99);
+            object->setProperty ("max", max);
+            return juce::var (object);
+        }
+    };
+
+    //==============================================================================
+    inline double nowMs() noexcept  { return juce::Time::getMillisecondCounterHiRes(); }
+
+    /* Time stamp counter on x86, high resolution ticks elsewhere */
+    inline juce::uint64 readCycleCounter() noexcept
+    {
+       #if JUCE_INTEL
+        return (juce::uint64) __rdtsc();
+       #else
+        return (juce::uint64) juce::Time::getHighResolutionTicks();
+       #endif
+    }
+
+    inline const char* getCycleCounterName() noexcept
+    {
+       #if JUCE_INTEL
+        return "rdtsc";
+       #else
+        return "highResolutionTicks";
+       #endif
+    }
+
+    /* Integer option with a default, e.g. "--iterations=100" */
+    inline int getIntOption (const juce::ArgumentList& args, const juce::String& option, int defaultValue)
+    {
+        return args.containsOption (option) ? args.getValueForOption (option).getIntValue() : defaultValue;
+    }
+
+    /* Writes 'result' as JSON to the file given with --json, or to stdout */
+    inline void writeResult (const juce::ArgumentList& args, const juce::var& result)
+    {
+        const auto json = juce::JSON::toString (result);
+
+        if (args.containsOption ("--json"))
+        {
+            const juce::File file (juce::File::getCurrentWorkingDirectory().getChildFile (args.getValueForOption ("--json")));
+
+            if (! file.replaceWithText (json))
+                juce::ConsoleApplication::fail ("Could not write " + file.getFullPathName());
+
+            std::cout << "Results written to " << file.getFullPathName() << std::endl;
+        }
+        else
+        {
+            std::cout << json << std::endl;
+        }
+    }
+
+    /* Tags every result with what produced it, so stored baselines stay comparable */
+    inline juce::DynamicObject::Ptr createResultObject (const juce::String& benchmarkName)
+    {
+        juce::DynamicObject::Ptr result (new juce::DynamicObject());
+        result->setProperty ("benchmark", benchmarkName);
+        result->setProperty ("cpu", juce::SystemStats::getCpuModel());
+        result->setProperty ("os", juce::SystemStats::getOperatingSystemName());
+        result->setProperty ("date", juce::Time::getCurrentTime().toISO8601 (true));
+       #if JUCE_DEBUG
+        result->setProperty ("build", "Debug");
+       #else
+        result->setProperty ("build", "Release");
+       #endif
+        return result;
+    }
+}
@@ -0,0 +1,151 @@
+/*
+  ==============================================================================
+
+    CascadeBenchmark.cpp
+    Created: 19 Oct 2026
+    Author:  GELVS
+
+  ==============================================================================
+*/
+
+#include "CascadeBenchmark.h"
+#include "BenchmarkUtils.h"
+#include "ProcessorHarness.h"
+#include "../../FlanGELVS/Source/PluginProcessor.h"
+
+namespace
+{
+    constexpr double sampleRate = 48000.0;
+    constexpr int numChannels = 2;
+
+    /* Either 'numStages' instances with one stage each, or one instance with 'numStages' stages */
+    struct Chain
+    {
+        Chain (int numStages, bool fused, int delayRange, int blockSize)
+        {
+            for (int i = 0; i < (fused ? 1 : numStages); ++i)
+            {
+                auto processor = std::make_unique<FlanGELVSAudioProcessor>();
+
+                /*Set before preparing, so that every stage has its buffer from the start*/
+                for (auto value : { std::make_pair ("stages", fused ? numStages : 1), std::make_pair ("delayrange", delayRange) })
+                    if (auto* parameter = Benchmark::findParameter (*processor, value.first))
+                        parameter->setValueNotifyingHost (parameter->convertTo0to1 ((float) value.second));
+
+                if (! Benchmark::configure (*processor, numChannels, sampleRate, blockSize))
+                    juce::ConsoleApplication::fail ("Could not prepare a stereo processor");
+
+                processors.push_back (std::move (processor));
+            }
+        }
+
+        void process (juce::AudioBuffer<float>& buffer)
+        {
+            for (auto& processor : processors)
+                processor->processBlock (buffer, midi);
+        }
+
+        std::vector<std::unique_ptr<FlanGELVSAudioProcessor>> processors;
+        juce::MidiBuffer midi;
+    };
+
+    double measureNsPerSample (Chain& chain, int blockSize, double seconds)
+    {
+        juce::AudioBuffer<float> input (numChannels, blockSize), buffer (numChannels, blockSize);
+        juce::Random random (1);
+
+        /*Warm up the caches, the delay lines and the trajectory caches with half a second of audio*/
+        for (int done = 0; done < (int) (sampleRate * 0.5); done += blockSize)
+        {
+            Benchmark::fillWithNoise (buffer, random);
+            chain.process (buffer);
+        }
+
+        Benchmark::fillWithNoise (input, random);
+
+        const int numBlocks = juce::jmax (16, (int) (sampleRate * seconds) / blockSize);
+        double totalNs = 0;
+
+        for (int block = 0; block < numBlocks; ++block)
+        {
+            for (int channel = 0; channel < numChannels; ++channel)
+                buffer.copyFrom (channel, 0, input, channel, 0, blockSize);
+
+            const auto startTicks = juce::Time::getHighResolutionTicks();
+            chain.process (buffer);
+            totalNs += 1.0e9 * juce::Time::highResolutionTicksToSeconds (juce::Time::getHighResolutionTicks() - startTicks);
+        }
+
+        return totalNs / ((double) numBlocks * blockSize);
+    }
+
+    /* Peak difference between the two chains over the same second of noise. Not zero: the
+       separate instances play their steady trajectories from their caches, while the stages
+       after the first compute theirs */
+    double measureDifferenceDb (int numStages, int delayRange, int blockSize)
+    {
+        Chain separate (numStages, false, delayRange, blockSize), fused (numStages, true, delayRange, blockSize);
+        juce::AudioBuffer<float> a (numChannels, blockSize), b (numChannels, blockSize);
+        juce::Random random (5);
+        float peak = 0;
+
+        for (int done = 0; done < (int) sampleRate; done += blockSize)
+        {
+            Benchmark::fillWithNoise (a, random);
+            b.makeCopyOf (a, true);
+
+            separate.process (a);
+            fused.process (b);
+
+            for (int channel = 0; channel < numChannels; ++channel)
+                for (int i = 0; i < blockSize; ++i)
+                    peak = juce::jmax (peak, std::abs (a.getSample (channel, i) - b.getSample (channel, i)));
+        }
+
+        return juce::Decibels::gainToDecibels ((double) peak, -200.0);
+    }
+}
+
+//==============================================================================
+void runCascadeBenchmark (const juce::ArgumentList& args)
+{
+    juce::ScopedJuceInitialiser_GUI juceInitialiser;
+
+    const double seconds = args.containsOption ("--seconds") ? args.getValueForOption ("--seconds").getDoubleValue() : 1.0;
+
+    auto result = Benchmark::createResultObject ("cascade");
+    result->setProperty ("sampleRate", sampleRate);
+    result->setProperty ("channels", numChannels);
+    result->setProperty ("secondsPerConfig", seconds);
+
+    juce::Array<juce::var> results;
+
+    for (int delayRange = 0; delayRange < FlanGELVSAudioProcessor::numDelayRanges; ++delayRange)
+    {
+        for (int blockSize : { 128, 4096 })
+        {
+            for (int numStages = 2; numStages <= FlanGELVSAudioProcessor::maxStages; ++numStages)
+            {
+                Chain separate (numStages, false, delayRange, blockSize), fused (numStages, true, delayRange, blockSize);
+                const double separateNs = measureNsPerSample (separate, blockSize, seconds);
+                const double fusedNs = measureNsPerSample (fused, blockSize, seconds);
+
+                auto* entry = new juce::DynamicObject();
+                entry->setProperty ("delayRange", FlanGELVSAudioProcessor::getDelayRange (delayRange).name);
+                entry->setProperty ("blockSize", blockSize);
+                entry->setProperty ("stages", numStages);
+                entry->setProperty ("separateNsPerSample", separateNs);
+                entry->setProperty ("fusedNsPerSample", fusedNs);
+                entry->setProperty ("speedup", fusedNs > 0 ? separateNs / fusedNs : 0.0);
+                entry->setProperty ("differenceDb", measureDifferenceDb (numStages, delayRange, blockSize));
+                results.add (juce::var (entry));
+
+                std::cerr << FlanGELVSAudioProcessor::getDelayRange (delayRange).name << "/" << blockSize << "/" << numStages
+                          << " stages: " << separateNs << " ns/sample separate, " << fusedNs << " fused" << std::endl;
+            }
+        }
+    }
+
+    result->setProperty ("results", results);
+    Benchmark::writeResult (args, juce::var (result.get()));
+}
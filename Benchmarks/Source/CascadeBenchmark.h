@@ -0,0 +1,17 @@
+/*
+  ==============================================================================
+
+    CascadeBenchmark.h
+    Created: 19 Oct 2026
+    Author:  GELVS
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+
+/* 2 to 4 flangers in series: separate instances each processing the whole block,
+   against one instance running its stages together over every quantum */
+void runCascadeBenchmark (const juce::ArgumentList& args);
@@ -0,0 +1,167 @@
+/*
+  ==============================================================================
+
+    DelayLayoutBenchmark.cpp
+    Created: 19 Oct 2026
+    Author:  GELVS
+
+  ==============================================================================
+*/
+
+#include "DelayLayoutBenchmark.h"
+#include "BenchmarkUtils.h"
+
+namespace
+{
+    constexpr double sampleRate = 48000.0;
+    constexpr int blockSize = 128;
+
+    /* One multichannel delay line, in the same access pattern as the plugin: every frame
+       writes all channels at the write head, then reads them all at one modulated,
+       linearly interpolated delay and feeds half of that back */
+    template <int numChannels, bool interleaved>
+    struct DelayLine
+    {
+        explicit DelayLine (int numSamples)
+            : length (numSamples),
+              samples ((size_t) (numSamples * numChannels), 0.0)
+        {
+        }
+
+        /* Where sample n of channel c lives */
+        static constexpr int frameStride = interleaved ? numChannels : 1;
+        int channelStride() const noexcept      { return interleaved ? 1 : length; }
+
+        void process (const float* const* input, float* const* output, const float* delays, int numSamples) noexcept
+        {
+            double* const data = samples.data();
+            const int stride = channelStride();
+
+            for (int i = 0; i < numSamples; ++i)
+            {
+                for (int c = 0; c < numChannels; ++c)
+                    data[c * stride + writeHead * frameStride] = input[c][i] + feedback[c];
+
+                const float wholeSamples = std::ceil (delays[i]);
+                const float weight = wholeSamples - delays[i];
+                int x = writeHead - (int) wholeSamples;
+                x += x < 0 ? length : 0;
+                const int x1 = x + 1 < length ? x + 1 : 0;
+
+                for (int c = 0; c < numChannels; ++c)
+                {
+                    const double* channel = data + c * stride;
+                    const float delayed = (float) (channel[x * frameStride] + weight * (channel[x1 * frameStride] - channel[x * frameStride]));
+                    feedback[c] = 0.5f * delayed;
+                    output[c][i] = delayed;
+                }
+
+                writeHead = writeHead + 1 < length ? writeHead + 1 : 0;
+            }
+        }
+
+        const int length;
+        std::vector<double> samples;
+        std::array<float, numChannels> feedback {};
+        int writeHead = 0;
+    };
+
+    /* ns per channel-sample of 'numLines' delay lines of 'delayLength' samples, processed
+       one block each in turn like instances in a host */
+    template <int numChannels, bool interleaved>
+    double measure (int numLines, int delayLength, double seconds)
+    {
+        std::vector<std::unique_ptr<DelayLine<numChannels, interleaved>>> lines;
+
+        for (int i = 0; i < numLines; ++i)
+            lines.push_back (std::make_unique<DelayLine<numChannels, interleaved>> (delayLength));
+
+        juce::AudioBuffer<float> input (numChannels, blockSize), output (numChannels, blockSize);
+        juce::Random random (1);
+
+        for (int c = 0; c < numChannels; ++c)
+            for (int i = 0; i < blockSize; ++i)
+                input.setSample (c, i, random.nextFloat() * 2.0f - 1.0f);
+
+        /*Sweep over most of the line, as the LFO does, so that reads land all over it*/
+        std::vector<float> delays (blockSize);
+        double phase = 0;
+
+        auto runCycle = [&]
+        {
+            for (int i = 0; i < blockSize; ++i)
+            {
+                delays[(size_t) i] = 1.0f + (float) (delayLength - 3) * (0.5f + 0.5f * (float) std::sin (juce::MathConstants<double>::twoPi * phase));
+                phase += 0.7 / sampleRate;
+            }
+
+            for (auto& line : lines)
+                line->process (input.getArrayOfReadPointers(), output.getArrayOfWritePointers(), delays.data(), blockSize);
+        };
+
+        /*Warm up: fill every line once*/
+        for (int done = 0; done < delayLength; done += blockSize)
+            runCycle();
+
+        const int numCycles = juce::jmax (8, (int) (seconds * sampleRate / blockSize / numLines));
+        const auto start = Benchmark::nowMs();
+
+        for (int cycle = 0; cycle < numCycles; ++cycle)
+            runCycle();
+
+        const double elapsedNs = 1.0e6 * (Benchmark::nowMs() - start);
+        return elapsedNs / ((double) numCycles * blockSize * numLines * numChannels);
+    }
+
+    template <int numChannels>
+    juce::var compare (int numLines, int delayLength, double seconds)
+    {
+        const double planar = measure<numChannels, false> (numLines, delayLength, seconds);
+        const double interleaved = measure<numChannels, true> (numLines, delayLength, seconds);
+
+        auto* entry = new juce::DynamicObject();
+        entry->setProperty ("channels", numChannels);
+        entry->setProperty ("lines", numLines);
+        entry->setProperty ("delayLength", delayLength);
+        entry->setProperty ("bytesPerLine", (juce::int64) delayLength * numChannels * (juce::int64) sizeof (double));
+        entry->setProperty ("planarNsPerChannelSample", planar);
+        entry->setProperty ("interleavedNsPerChannelSample", interleaved);
+        entry->setProperty ("interleavedSpeedup", interleaved > 0 ? planar / interleaved : 0.0);
+
+        std::cerr << numChannels << " ch, " << numLines << " x " << delayLength << " samples: planar "
+                  << juce::String (planar, 3) << ", interleaved " << juce::String (interleaved, 3)
+                  << " ns per channel-sample" << std::endl;
+
+        return juce::var (entry);
+    }
+}
+
+//==============================================================================
+void runDelayLayoutBenchmark (const juce::ArgumentList& args)
+{
+    juce::ScopedJuceInitialiser_GUI juceInitialiser;
+
+    const double seconds = args.containsOption ("--seconds") ? args.getValueForOption ("--seconds").getDoubleValue() : 0.5;
+
+    auto result = Benchmark::createResultObject ("layout");
+    result->setProperty ("sampleRate", sampleRate);
+    result->setProperty ("blockSize", blockSize);
+    result->setProperty ("secondsPerConfig", seconds);
+
+    juce::Array<juce::var> results;
+
+    /*The flanger and slapback ranges at 48 kHz, for one line (cache resident) and for
+      many (like a session full of instances, well beyond the caches)*/
+    for (int delayLength : { 434, 7682 })
+    {
+        for (int numLines : { 1, 256 })
+        {
+            results.add (compare<1> (numLines, delayLength, seconds));
+            results.add (compare<2> (numLines, delayLength, seconds));
+            results.add (compare<8> (numLines, delayLength, seconds));
+        }
+    }
+
+    result->setProperty ("results", results);
+    Benchmark::writeResult (args, juce::var (result.get()));
+}
@@ -0,0 +1,18 @@
+/*
+  ==============================================================================
+
+    DelayLayoutBenchmark.h
+    Created: 19 Oct 2026
+    Author:  GELVS
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+
+/* Planar against interleaved delay-line storage for 1, 2 and 8 channels: the
+   flanger's write, interpolated read and feedback per sample, on a few or many
+   delay lines at once */
+void runDelayLayoutBenchmark (const juce::ArgumentList& args);
@@ -0,0 +1,167 @@
+/*
+  ==============================================================================
+
+    DspBenchmark.cpp
+    Created: 19 Oct 2026
+    Author:  GELVS
+
+  ==============================================================================
+*/
+
+#include "DspBenchmark.h"
+#include "BenchmarkUtils.h"
+#include "ProcessorHarness.h"
+#include "../../FlanGELVS/Source/PluginProcessor.h"
+
+namespace
+{
+    struct DspResult
+    {
+        double nsPerSample = 0, cyclesPerSample = 0, worstBlockNs = 0, worstBlockDeadlineFraction = 0;
+    };
+
+    DspResult measure (FlanGELVSAudioProcessor& processor, int numChannels, double sampleRate, int blockSize, double seconds)
+    {
+        juce::AudioBuffer<float> input (numChannels, blockSize), buffer (numChannels, blockSize);
+        juce::MidiBuffer midi;
+        juce::Random random (1);
+
+        /*Warm up the caches and the delay lines with a quarter of a second of audio*/
+        for (int done = 0; done < (int) (sampleRate * 0.25); done += blockSize)
+        {
+            Benchmark::fillWithNoise (buffer, random);
+            processor.processBlock (buffer, midi);
+        }
+
+        const int numBlocks = juce::jmax (16, (int) (sampleRate * seconds) / blockSize);
+        const double blockDurationNs = 1.0e9 * blockSize / sampleRate;
+
+        Benchmark::fillWithNoise (input, random);
+
+        double totalNs = 0, worstNs = 0;
+        juce::uint64 totalCycles = 0;
+
+        for (int block = 0; block < numBlocks; ++block)
+        {
+            for (int channel = 0; channel < numChannels; ++channel)
+                buffer.copyFrom (channel, 0, input, channel, 0, blockSize);
+
+            const auto startTicks = juce::Time::getHighResolutionTicks();
+            const auto startCycles = Benchmark::readCycleCounter();
+
+            processor.processBlock (buffer, midi);
+
+            const auto cycles = Benchmark::readCycleCounter() - startCycles;
+            const double ns = 1.0e9 * juce::Time::highResolutionTicksToSeconds (juce::Time::getHighResolutionTicks() - startTicks);
+
+            totalNs += ns;
+            totalCycles += cycles;
+            worstNs = juce::jmax (worstNs, ns);
+        }
+
+        const double numSamples = (double) numBlocks * blockSize;
+        return { totalNs / numSamples, (double) totalCycles / numSamples, worstNs, worstNs / blockDurationNs };
+    }
+
+    juce::String getConfigKey (const juce::String& preset, int numChannels, double sampleRate, int blockSize)
+    {
+        return preset + "/" + juce::String (numChannels) + "ch/" + juce::String ((int) sampleRate) + "/" + juce::String (blockSize);
+    }
+
+    /* ns/sample of every configuration of a previous run, keyed like getConfigKey() */
+    std::map<juce::String, double> loadBaseline (const juce::ArgumentList& args)
+    {
+        std::map<juce::String, double> baseline;
+
+        if (! args.containsOption ("--baseline"))
+            return baseline;
+
+        const auto json = juce::JSON::parse (args.getFileForOption ("--baseline"));
+
+        if (auto* results = json["results"].getArray())
+            for (auto& entry : *results)
+                baseline[entry["config"].toString()] = (double) entry["nsPerSample"];
+
+        return baseline;
+    }
+}
+
+//==============================================================================
+void runDspBenchmark (const juce::ArgumentList& args)
+{
+    juce::ScopedJuceInitialiser_GUI juceInitialiser;
+
+    const double seconds = args.containsOption ("--seconds") ? args.getValueForOption ("--seconds").getDoubleValue() : 1.0;
+    const auto baseline = loadBaseline (args);
+
+    /*Compare instruction sets on one machine by forcing the kernels of each run*/
+    if (args.containsOption ("--variant"))
+    {
+        const auto variant = DspKernels::getVariantFromName (args.getValueForOption ("--variant"));
+
+        if (! DspKernels::isSupported (variant))
+            juce::ConsoleApplication::fail ("Kernel variant not available here; supported: "
+                                            + DspKernels::getSupportedVariantNames().joinIntoString (", "));
+
+        DspKernels::setForcedVariant (variant);
+    }
+
+    const int blockSizes[] = { 1, 16, 32, 64, 128, 256, 512, 1024, 2048, 4096 };
+    const double sampleRates[] = { 44100.0, 48000.0, 96000.0, 192000.0, 384000.0 };
+    const int channelCounts[] = { 1, 2 };
+
+    auto result = Benchmark::createResultObject ("dsp");
+    result->setProperty ("cycleCounter", Benchmark::getCycleCounterName());
+    result->setProperty ("secondsPerConfig", seconds);
+    result->setProperty ("kernelVariant", DspKernels::getName (DspKernels::chooseVariant()));
+    result->setProperty ("supportedKernelVariants", DspKernels::getSupportedVariantNames().joinIntoString (","));
+
+    juce::Array<juce::var> results;
+
+    for (auto& preset : Benchmark::getParameterPresets())
+    {
+        for (int numChannels : channelCounts)
+        {
+            for (double sampleRate : sampleRates)
+            {
+                for (int blockSize : blockSizes)
+                {
+                    FlanGELVSAudioProcessor processor;
+
+                    if (! Benchmark::configure (processor, numChannels, sampleRate, blockSize))
+                        continue;
+
+                    Benchmark::applyPreset (processor, preset);
+                    const auto measured = measure (processor, numChannels, sampleRate, blockSize, seconds);
+                    processor.releaseResources();
+
+                    const auto key = getConfigKey (preset.name, numChannels, sampleRate, blockSize);
+
+                    auto* entry = new juce::DynamicObject();
+                    entry->setProperty ("config", key);
+                    entry->setProperty ("preset", preset.name);
+                    entry->setProperty ("channels", numChannels);
+                    entry->setProperty ("sampleRate", sampleRate);
+                    entry->setProperty ("blockSize", blockSize);
+                    entry->setProperty ("kernelVariant", DspKernels::getName (processor.getKernelVariant()));
+                    entry->setProperty ("nsPerSample", measured.nsPerSample);
+                    entry->setProperty ("cyclesPerSample", measured.cyclesPerSample);
+                    entry->setProperty ("worstBlockNs", measured.worstBlockNs);
+                    entry->setProperty ("worstBlockDeadlineFraction", measured.worstBlockDeadlineFraction);
+
+                    auto previous = baseline.find (key);
+
+                    if (previous != baseline.end() && measured.nsPerSample > 0)
+                        entry->setProperty ("speedupVsBaseline", previous->second / measured.nsPerSample);
+
+                    results.add (juce::var (entry));
+
+                    std::cerr << key << ": " << measured.nsPerSample << " ns/sample" << std::endl;
+                }
+            }
+        }
+    }
+
+    result->setProperty ("results", results);
+    Benchmark::writeResult (args, juce::var (result.get()));
+}
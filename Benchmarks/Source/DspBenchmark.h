@@ -0,0 +1,17 @@
+/*
+  ==============================================================================
+
+    DspBenchmark.h
+    Created: 19 Oct 2026
+    Author:  GELVS
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+
+/* Runs processBlock over a matrix of block sizes, sample rates, channel layouts
+   and parameter presets, reporting ns/sample, cycles/sample and worst block time */
+void runDspBenchmark (const juce::ArgumentList& args);
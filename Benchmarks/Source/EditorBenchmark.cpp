@@ -0,0 +1,125 @@
+/*
+  ==============================================================================
+
+    EditorBenchmark.cpp
+    Created: 19 Oct 2026
+    Author:  GELVS
+
+  ==============================================================================
+*/
+
+#include "EditorBenchmark.h"
+#include "BenchmarkUtils.h"
+#include "../../FlanGELVS/Source/PluginProcessor.h"
+#include "../../FlanGELVS/Source/PluginEditor.h"
+
+namespace
+{
+    /* Lets the editor's async callbacks (background decode, resampling) run for a while */
+    void pumpMessages (int milliseconds)
+    {
+        juce::MessageManager::getInstance()->runDispatchLoopUntil (milliseconds);
+    }
+
+    /* Everything is rendered by the software renderer into a plain image, no window involved */
+    double timePaint (juce::Component& editor, float scale, juce::Rectangle<int> clip)
+    {
+        juce::Image image (juce::Image::ARGB,
+                           juce::roundToInt ((float) editor.getWidth() * scale),
+                           juce::roundToInt ((float) editor.getHeight() * scale), true,
+                           juce::SoftwareImageType());
+
+        juce::Graphics g (image);
+        g.addTransform (juce::AffineTransform::scale (scale));
+        g.reduceClipRegion (clip);
+
+        const double start = Benchmark::nowMs();
+        editor.paintEntireComponent (g, true);
+        return Benchmark::nowMs() - start;
+    }
+
+    juce::Component* findFirstKnob (juce::Component& editor)
+    {
+        for (auto* child : editor.getChildren())
+            if (auto* slider = dynamic_cast<juce::Slider*> (child))
+                if (slider->isVisible())
+                    return slider;
+
+        return nullptr;
+    }
+}
+
+//==============================================================================
+void runEditorBenchmark (const juce::ArgumentList& args)
+{
+    juce::ScopedJuceInitialiser_GUI juceInitialiser;
+
+    const int iterations = Benchmark::getIntOption (args, "--iterations", 100);
+    const int opens = Benchmark::getIntOption (args, "--opens", 20);
+
+    FlanGELVSAudioProcessor processor;
+    processor.prepareToPlay (48000.0, 512);
+
+    auto result = Benchmark::createResultObject ("editor");
+    result->setProperty ("iterations", iterations);
+
+    //==============================================================================
+    /* Open latency: construction and time to the first (offscreen) paint */
+    {
+        std::vector<double> construction, firstPaint, backgroundReady;
+
+        for (int i = 0; i < opens; ++i)
+        {
+            std::unique_ptr<FlanGELVSAudioProcessorEditor> editor (dynamic_cast<FlanGELVSAudioProcessorEditor*> (processor.createEditor()));
+            timePaint (*editor, 1.0f, editor->getLocalBounds());
+
+            for (int wait = 0; wait < 100 && editor->getStartupTimings().backgroundReadyMs < 0; ++wait)
+                pumpMessages (10);
+
+            construction.push_back (editor->getStartupTimings().constructionMs);
+            firstPaint.push_back (editor->getStartupTimings().firstPaintMs);
+            backgroundReady.push_back (editor->getStartupTimings().backgroundReadyMs);
+        }
+
+        auto* open = new juce::DynamicObject();
+        open->setProperty ("constructionMs", Benchmark::Statistics::from (construction).toVar());
+        open->setProperty ("timeToFirstPaintMs", Benchmark::Statistics::from (firstPaint).toVar());
+        open->setProperty ("backgroundReadyMs", Benchmark::Statistics::from (backgroundReady).toVar());
+        result->setProperty ("open", juce::var (open));
+    }
+
+    //==============================================================================
+    /* Paint time per scale factor, once the background for that scale is cached */
+    std::unique_ptr<FlanGELVSAudioProcessorEditor> editor (dynamic_cast<FlanGELVSAudioProcessorEditor*> (processor.createEditor()));
+    auto* knob = findFirstKnob (*editor);
+    jassert (knob != nullptr);
+
+    juce::Array<juce::var> scales;
+
+    for (float scale : { 1.0f, 1.5f, 2.0f, 3.0f })
+    {
+        timePaint (*editor, scale, editor->getLocalBounds());
+        pumpMessages (500);
+
+        std::vector<double> full, singleKnob;
+
+        for (int i = 0; i < iterations; ++i)
+            full.push_back (timePaint (*editor, scale, editor->getLocalBounds()));
+
+        for (int i = 0; i < iterations; ++i)
+            singleKnob.push_back (timePaint (*editor, scale, knob->getBounds()));
+
+        auto* entry = new juce::DynamicObject();
+        entry->setProperty ("scale", scale);
+        entry->setProperty ("fullRepaintMs", Benchmark::Statistics::from (full).toVar());
+        entry->setProperty ("singleKnobRepaintMs", Benchmark::Statistics::from (singleKnob).toVar());
+        scales.add (juce::var (entry));
+    }
+
+    result->setProperty ("paint", scales);
+
+    editor.reset();
+    processor.releaseResources();
+
+    Benchmark::writeResult (args, juce::var (result.get()));
+}
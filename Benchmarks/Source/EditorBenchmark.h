@@ -0,0 +1,17 @@
+/*
+  ==============================================================================
+
+    EditorBenchmark.h
+    Created: 19 Oct 2026
+    Author:  GELVS
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+
+/* Opens the editor offscreen and measures its open latency and its paint time
+   (full repaint and single-knob repaint) at several scale factors */
+void runEditorBenchmark (const juce::ArgumentList& args);
@@ -0,0 +1,166 @@
+/*
+  ==============================================================================
+
+    FastMathBenchmark.cpp
+    Created: 19 Oct 2026
+    Author:  GELVS
+
+  ==============================================================================
+*/
+
+#include "FastMathBenchmark.h"
+#include "BenchmarkUtils.h"
+#include "../../FlanGELVS/Source/FastMath.h"
+
+namespace
+{
+    using FastMath::Tier;
+
+    constexpr int numTestValues = 1 << 16;
+
+    /* The arguments a function is checked over, and what its error is measured against */
+    struct Domain
+    {
+        std::vector<float> values;
+        std::function<double (double)> reference;
+        bool relativeError;
+    };
+
+    Domain makeLinearDomain (float start, float end, std::function<double (double)> reference, bool relative)
+    {
+        Domain domain { {}, std::move (reference), relative };
+
+        for (int i = 0; i < numTestValues; ++i)
+            domain.values.push_back (start + (end - start) * (float) i / (float) (numTestValues - 1));
+
+        return domain;
+    }
+
+    /* Both signs, magnitudes spread logarithmically from 1e-3 to 1e3 */
+    Domain makeReciprocalDomain()
+    {
+        Domain domain { {}, [] (double x) { return 1.0 / x; }, true };
+
+        for (int i = 0; i < numTestValues; ++i)
+            domain.values.push_back ((i % 2 == 0 ? 1.0f : -1.0f) * std::pow (10.0f, -3.0f + 6.0f * (float) i / (float) (numTestValues - 1)));
+
+        return domain;
+    }
+
+    template <typename Function>
+    juce::var measure (const juce::String& variant, const Domain& domain, Function function, int repetitions)
+    {
+        std::vector<float> output (domain.values.size());
+        double maxError = 0;
+
+        for (size_t i = 0; i < domain.values.size(); ++i)
+        {
+            const double x = domain.values[i];
+            const double expected = domain.reference (x);
+            const double error = std::abs ((double) function (domain.values[i]) - expected);
+
+            maxError = juce::jmax (maxError, domain.relativeError ? error / std::abs (expected) : error);
+        }
+
+        /*Timed over a whole array, the way the processing loops call them*/
+        const auto start = juce::Time::getHighResolutionTicks();
+
+        for (int repetition = 0; repetition < repetitions; ++repetition)
+        {
+            const float* in = domain.values.data();
+            float* out = output.data();
+
+            for (size_t i = 0; i < domain.values.size(); ++i)
+                out[i] = function (in[i]);
+        }
+
+        const double seconds = juce::Time::highResolutionTicksToSeconds (juce::Time::getHighResolutionTicks() - start);
+
+        /*Keep the results observable so the loops are not optimised away*/
+        static volatile float sink;
+        sink = output[(size_t) repetitions % output.size()];
+
+        auto* entry = new juce::DynamicObject();
+        entry->setProperty ("variant", variant);
+        entry->setProperty (domain.relativeError ? "maxRelativeError" : "maxAbsoluteError", maxError);
+        entry->setProperty ("nsPerCall", 1.0e9 * seconds / ((double) repetitions * (double) domain.values.size()));
+        return juce::var (entry);
+    }
+
+    template <typename Fast, typename Balanced, typename Accurate, typename Libm>
+    juce::var measureFunction (const juce::String& name, const Domain& domain, int repetitions,
+                               Fast fast, Balanced balanced, Accurate accurate, Libm libm)
+    {
+        juce::Array<juce::var> variants;
+        variants.add (measure ("fast", domain, fast, repetitions));
+        variants.add (measure ("balanced", domain, balanced, repetitions));
+        variants.add (measure ("accurate", domain, accurate, repetitions));
+        variants.add (measure ("libm", domain, libm, repetitions));
+
+        for (auto& variant : variants)
+            std::cerr << name << " " << variant["variant"].toString() << ": error "
+                      << (domain.relativeError ? variant["maxRelativeError"] : variant["maxAbsoluteError"]).toString()
+                      << ", " << variant["nsPerCall"].toString() << " ns/call" << std::endl;
+
+        auto* entry = new juce::DynamicObject();
+        entry->setProperty ("function", name);
+        entry->setProperty ("domainStart", domain.values.front());
+        entry->setProperty ("domainEnd", domain.values.back());
+        entry->setProperty ("variants", variants);
+        return juce::var (entry);
+    }
+}
+
+//==============================================================================
+void runFastMathBenchmark (const juce::ArgumentList& args)
+{
+    juce::ScopedJuceInitialiser_GUI juceInitialiser;
+
+    const int repetitions = Benchmark::getIntOption (args, "--repetitions", 200);
+
+    auto result = Benchmark::createResultObject ("fastmath");
+    result->setProperty ("defaultTier", FLANGELVS_FASTMATH_TIER);
+    result->setProperty ("valuesPerFunction", numTestValues);
+
+    /*sin and cos over the range the LFO uses: 2 pi * phase + phase offset*/
+    const auto sinDomain = makeLinearDomain (-1.0f, 12.0f, [] (double x) { return std::sin (x); }, false);
+    const auto cosDomain = makeLinearDomain (-1.0f, 12.0f, [] (double x) { return std::cos (x); }, false);
+    const auto exp2Domain = makeLinearDomain (-20.0f, 20.0f, [] (double x) { return std::exp2 (x); }, true);
+    const auto tanhDomain = makeLinearDomain (-10.0f, 10.0f, [] (double x) { return std::tanh (x); }, false);
+    const auto reciprocalDomain = makeReciprocalDomain();
+
+    juce::Array<juce::var> functions;
+
+    functions.add (measureFunction ("sin", sinDomain, repetitions,
+                                    [] (float x) { return FastMath::sin<Tier::fast> (x); },
+                                    [] (float x) { return FastMath::sin<Tier::balanced> (x); },
+                                    [] (float x) { return FastMath::sin<Tier::accurate> (x); },
+                                    [] (float x) { return std::sin (x); }));
+
+    functions.add (measureFunction ("cos", cosDomain, repetitions,
+                                    [] (float x) { return FastMath::cos<Tier::fast> (x); },
+                                    [] (float x) { return FastMath::cos<Tier::balanced> (x); },
+                                    [] (float x) { return FastMath::cos<Tier::accurate> (x); },
+                                    [] (float x) { return std::cos (x); }));
+
+    functions.add (measureFunction ("exp2", exp2Domain, repetitions,
+                                    [] (float x) { return FastMath::exp2<Tier::fast> (x); },
+                                    [] (float x) { return FastMath::exp2<Tier::balanced> (x); },
+                                    [] (float x) { return FastMath::exp2<Tier::accurate> (x); },
+                                    [] (float x) { return std::exp2 (x); }));
+
+    functions.add (measureFunction ("tanh", tanhDomain, repetitions,
+                                    [] (float x) { return FastMath::tanh<Tier::fast> (x); },
+                                    [] (float x) { return FastMath::tanh<Tier::balanced> (x); },
+                                    [] (float x) { return FastMath::tanh<Tier::accurate> (x); },
+                                    [] (float x) { return std::tanh (x); }));
+
+    functions.add (measureFunction ("reciprocal", reciprocalDomain, repetitions,
+                                    [] (float x) { return FastMath::reciprocal<Tier::fast> (x); },
+                                    [] (float x) { return FastMath::reciprocal<Tier::balanced> (x); },
+                                    [] (float x) { return FastMath::reciprocal<Tier::accurate> (x); },
+                                    [] (float x) { return 1.0f / x; }));
+
+    result->setProperty ("functions", functions);
+    Benchmark::writeResult (args, juce::var (result.get()));
+}
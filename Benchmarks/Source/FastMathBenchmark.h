@@ -0,0 +1,17 @@
+/*
+  ==============================================================================
+
+    FastMathBenchmark.h
+    Created: 19 Oct 2026
+    Author:  GELVS
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+
+/* Verification table of the FastMath approximations: worst error against libm
+   (in double precision) and cost per call of every tier, next to float libm */
+void runFastMathBenchmark (const juce::ArgumentList& args);
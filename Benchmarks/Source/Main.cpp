@@ -0,0 +1,100 @@
+/*
+  ==============================================================================
+
+    This file contains the basic startup code for a JUCE application.
+
+    Headless benchmarks for FlanGELVS. Every command prints its results as
+    JSON (or writes them to the file given with --json) so that runs can be
+    stored and compared against a baseline.
+
+  ==============================================================================
+*/
+
+#include <JuceHeader.h>
+#include "EditorBenchmark.h"
+#include "DspBenchmark.h"
+#include "StressBenchmark.h"
+#include "ScalingBenchmark.h"
+#include "FastMathBenchmark.h"
+#include "RealtimeSafetyCheck.h"
+#include "DelayLayoutBenchmark.h"
+#include "CascadeBenchmark.h"
+
+//==============================================================================
+int main (int argc, char* argv[])
+{
+    juce::ConsoleApplication app;
+
+    app.addHelpCommand ("--help|-h", "Usage: FlanGELVSBenchmarks --<command> [--json=results.json]", true);
+
+    app.addCommand ({ "--editor",
+                      "--editor [--iterations=N] [--opens=N]",
+                      "Offscreen editor open latency and paint time at several scale factors",
+                      "Creates FlanGELVSAudioProcessorEditor without a window and renders it with the software "
+                      "renderer: full repaints and single-knob repaints at scale 1, 1.5, 2 and 3.",
+                      runEditorBenchmark });
+
+    app.addCommand ({ "--dsp",
+                      "--dsp [--seconds=S] [--baseline=previous.json] [--variant=generic|avx|avx2|avx512]",
+                      "processBlock cost across block sizes, sample rates, layouts and presets",
+                      "Runs processBlock with block sizes from 1 to 4096, sample rates from 44.1k to 384k, mono and "
+                      "stereo layouts and three parameter presets. Reports ns/sample, cycles/sample and the worst "
+                      "block time; with --baseline, also the speedup against a stored run. Reports which kernel "
+                      "variant ran; --variant forces one, to compare instruction sets on the same machine.",
+                      runDspBenchmark });
+
+    app.addCommand ({ "--stress",
+                      "--stress [--seconds=S]",
+                      "Per-call latency under irregular and adversarial block sizes",
+                      "Prepares for 512-sample blocks, then calls processBlock with fixed, random, automation-split, "
+                      "odd, oversized (up to 8x the prepared size) and alternating block sizes, with and without "
+                      "parameter jumps. Reports p50/p99/max per call and per sample, relative to the fixed sequence.",
+                      runStressBenchmark });
+
+    app.addCommand ({ "--scaling",
+                      "--scaling [--seconds=S] [--max-instances=N] [--max-threads=K]",
+                      "Throughput, cache misses and memory for 1 to 1000 instances",
+                      "Creates 1, 10, 100 and 1000 stereo instances at 48 kHz and processes them round-robin in "
+                      "128-sample host cycles on 1, 2, 4... threads. Reports ns per instance-sample, how many "
+                      "instances would run in real time, LLC misses per instance block (Linux perf events, when "
+                      "permitted) and resident memory per instance (/proc/self/statm).",
+                      runScalingBenchmark });
+
+    app.addCommand ({ "--fastmath",
+                      "--fastmath [--repetitions=N]",
+                      "Accuracy and cost of the FastMath approximations against libm",
+                      "Evaluates sin, cos, exp2, tanh and reciprocal in the fast, balanced and accurate tiers over "
+                      "their test domains. Reports the worst absolute or relative error against double precision "
+                      "libm and ns per call, with float libm for comparison.",
+                      runFastMathBenchmark });
+
+    app.addCommand ({ "--rtcheck",
+                      "--rtcheck [--seconds=S] [--abort]",
+                      "Fails if the audio thread allocates, frees, locks or blocks",
+                      "Runs processBlock, processBlockBypassed and host-style parameter changes with irregular block "
+                      "sizes in every layout, sample rate, offline/realtime, analyser and preset combination, plus runs "
+                      "that change the delay range, the stage count and the quality level on purpose. operator "
+                      "new/delete are replaced and, on Linux, malloc/free, pthread mutexes and condition variables, "
+                      "read/write and sleeps are interposed. --abort stops at the first violation for a backtrace.",
+                      runRealtimeSafetyCheck });
+
+    app.addCommand ({ "--layout",
+                      "--layout [--seconds=S]",
+                      "Planar against interleaved delay-line storage for 1, 2 and 8 channels",
+                      "Runs the flanger's per-sample write, interpolated read and feedback on delay lines stored "
+                      "one run per channel or as interleaved frames, for 1, 2 and 8 channels, flanger and slapback "
+                      "lengths, and 1 or 256 lines processed in turn. Reports ns per channel-sample and the speedup "
+                      "of the interleaved layout.",
+                      runDelayLayoutBenchmark });
+
+    app.addCommand ({ "--cascade",
+                      "--cascade [--seconds=S]",
+                      "Separate instances in series against the fused multi-stage mode",
+                      "Chains 2 to 4 flangers, as separate instances that each process the whole block or as one "
+                      "instance whose stages run together over every quantum, for every delay range and for 128 "
+                      "and 4096 sample blocks. Reports ns/sample of both, the speedup of the fused mode and the "
+                      "peak difference between their outputs.",
+                      runCascadeBenchmark });
+
+    return app.findAndRunCommand (argc, argv);
+}
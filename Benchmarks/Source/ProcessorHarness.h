@@ -0,0 +1,85 @@
+/*
+  ==============================================================================
+
+    ProcessorHarness.h
+    Created: 19 Oct 2026
+    Author:  GELVS
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+
+namespace Benchmark
+{
+    //==============================================================================
+    /* A named set of parameter values, in real (not normalised) units */
+    struct ParameterPreset
+    {
+        juce::String name;
+        std::map<juce::String, float> values;
+    };
+
+    inline const std::vector<ParameterPreset>& getParameterPresets()
+    {
+        static const std::vector<ParameterPreset> presets
+        {
+            { "default", {} },
+            { "subtle",  { { "drywet", 0.2f }, { "depth", 0.1f }, { "rate", 0.2f }, { "feedback", 0.05f } } },
+            { "extreme", { { "drywet", 1.0f }, { "depth", 1.0f }, { "rate", 20.0f }, { "feedback", 0.99f }, { "amplitude", 3.0f } } },
+        };
+
+        return presets;
+    }
+
+    inline juce::RangedAudioParameter* findParameter (juce::AudioProcessor& processor, const juce::String& parameterID)
+    {
+        for (auto* parameter : processor.getParameters())
+            if (auto* ranged = dynamic_cast<juce::RangedAudioParameter*> (parameter))
+                if (ranged->paramID == parameterID)
+                    return ranged;
+
+        return nullptr;
+    }
+
+    /* Resets every parameter to its default, then applies the preset's values */
+    inline void applyPreset (juce::AudioProcessor& processor, const ParameterPreset& preset)
+    {
+        for (auto* parameter : processor.getParameters())
+            parameter->setValueNotifyingHost (parameter->getDefaultValue());
+
+        for (auto& value : preset.values)
+            if (auto* parameter = findParameter (processor, value.first))
+                parameter->setValueNotifyingHost (parameter->convertTo0to1 (value.second));
+    }
+
+    /* Puts the processor in a mono or stereo layout and prepares it */
+    inline bool configure (juce::AudioProcessor& processor, int numChannels, double sampleRate, int maxBlockSize)
+    {
+        const auto set = numChannels == 1 ? juce::AudioChannelSet::mono() : juce::AudioChannelSet::stereo();
+
+        juce::AudioProcessor::BusesLayout layout;
+        layout.inputBuses.add (set);
+        layout.outputBuses.add (set);
+
+        if (! processor.setBusesLayout (layout))
+            return false;
+
+        processor.setRateAndBufferSizeDetails (sampleRate, maxBlockSize);
+        processor.prepareToPlay (sampleRate, maxBlockSize);
+        return true;
+    }
+
+    inline void fillWithNoise (juce::AudioBuffer<float>& buffer, juce::Random& random)
+    {
+        for (int channel = 0; channel < buffer.getNumChannels(); ++channel)
+        {
+            auto* data = buffer.getWritePointer (channel);
+
+            for (int i = 0; i < buffer.getNumSamples(); ++i)
+                data[i] = random.nextFloat() * 0.5f - 0.25f;
+        }
+    }
+}
@@ -0,0 +1,522 @@
+/*
+  ==============================================================================
+
+    RealtimeSafetyCheck.cpp
+    Created: 19 Oct 2026
+    Author:  GELVS
+
+    The hooks below replace the global operator new/delete of the benchmark
+    executable and, on Linux, interpose the C allocator, pthread mutexes and
+    condition variables and the blocking system call wrappers. Outside a
+    ScopedAudioThread they only cost a thread-local flag test.
+
+  ==============================================================================
+*/
+
+#include "RealtimeSafetyCheck.h"
+#include "BenchmarkUtils.h"
+#include "ProcessorHarness.h"
+#include "../../FlanGELVS/Source/PluginProcessor.h"
+
+#if JUCE_LINUX && defined (__GLIBC__)
+ #define FLANGELVS_INTERPOSE_LIBC 1
+ #include <cerrno>
+ #include <dlfcn.h>
+ #include <pthread.h>
+ #include <unistd.h>
+ #include <time.h>
+#else
+ #define FLANGELVS_INTERPOSE_LIBC 0
+#endif
+
+namespace RealtimeSafety
+{
+    namespace
+    {
+        /*Plain thread-local flags: reading them must never allocate*/
+        thread_local bool isAudioThread = false;
+        thread_local bool isReporting = false;
+
+        std::atomic<int> counts[4] {};
+        std::atomic<const char*> firstViolation { nullptr };
+        std::atomic<bool> abortOnViolation { false };
+
+        void record (Violation type, const char* function) noexcept
+        {
+            if (! isAudioThread || isReporting)
+                return;
+
+            isReporting = true;
+
+            counts[(int) type].fetch_add (1, std::memory_order_relaxed);
+
+            const char* expected = nullptr;
+            firstViolation.compare_exchange_strong (expected, function);
+
+            if (abortOnViolation.load (std::memory_order_relaxed))
+            {
+                std::fprintf (stderr, "Realtime violation on the audio thread: %s\n", function);
+                std::abort();
+            }
+
+            isReporting = false;
+        }
+    }
+
+    ScopedAudioThread::ScopedAudioThread() noexcept   { isAudioThread = true; }
+    ScopedAudioThread::~ScopedAudioThread() noexcept  { isAudioThread = false; }
+
+    void reset() noexcept
+    {
+        for (auto& count : counts)
+            count = 0;
+
+        firstViolation = nullptr;
+    }
+
+    int getCount (Violation type) noexcept   { return counts[(int) type].load(); }
+    const char* getFirstViolation() noexcept { return firstViolation.load(); }
+    void setAbortOnViolation (bool shouldAbort) noexcept { abortOnViolation = shouldAbort; }
+
+    int getTotalCount() noexcept
+    {
+        int total = 0;
+
+        for (auto& count : counts)
+            total += count.load();
+
+        return total;
+    }
+}
+
+//==============================================================================
+#if FLANGELVS_INTERPOSE_LIBC
+extern "C"
+{
+    void* __libc_malloc (size_t);
+    void* __libc_calloc (size_t, size_t);
+    void* __libc_realloc (void*, size_t);
+    void* __libc_memalign (size_t, size_t);
+    void  __libc_free (void*);
+}
+
+namespace
+{
+    void* rawAllocate (size_t size) noexcept   { return __libc_malloc (size); }
+    void rawFree (void* pointer) noexcept      { __libc_free (pointer); }
+
+    template <typename FunctionType>
+    FunctionType getNext (const char* name) noexcept
+    {
+        return reinterpret_cast<FunctionType> (dlsym (RTLD_NEXT, name));
+    }
+}
+
+extern "C"
+{
+    void* malloc (size_t size) noexcept
+    {
+        RealtimeSafety::record (RealtimeSafety::Violation::allocation, "malloc");
+        return __libc_malloc (size);
+    }
+
+    void* calloc (size_t count, size_t size) noexcept
+    {
+        RealtimeSafety::record (RealtimeSafety::Violation::allocation, "calloc");
+        return __libc_calloc (count, size);
+    }
+
+    void* realloc (void* pointer, size_t size) noexcept
+    {
+        RealtimeSafety::record (RealtimeSafety::Violation::allocation, "realloc");
+        return __libc_realloc (pointer, size);
+    }
+
+    int posix_memalign (void** result, size_t alignment, size_t size) noexcept
+    {
+        RealtimeSafety::record (RealtimeSafety::Violation::allocation, "posix_memalign");
+
+        if (alignment % sizeof (void*) != 0 || (alignment & (alignment - 1)) != 0)
+            return EINVAL;
+
+        *result = __libc_memalign (alignment, size);
+        return *result != nullptr ? 0 : ENOMEM;
+    }
+
+    void* aligned_alloc (size_t alignment, size_t size) noexcept
+    {
+        RealtimeSafety::record (RealtimeSafety::Violation::allocation, "aligned_alloc");
+        return __libc_memalign (alignment, size);
+    }
+
+    void free (void* pointer) noexcept
+    {
+        if (pointer != nullptr)
+            RealtimeSafety::record (RealtimeSafety::Violation::deallocation, "free");
+
+        __libc_free (pointer);
+    }
+
+    int pthread_mutex_lock (pthread_mutex_t* mutex) noexcept
+    {
+        static auto next = getNext<int (*) (pthread_mutex_t*)> ("pthread_mutex_lock");
+        RealtimeSafety::record (RealtimeSafety::Violation::lock, "pthread_mutex_lock");
+        return next (mutex);
+    }
+
+    int pthread_cond_wait (pthread_cond_t* condition, pthread_mutex_t* mutex)
+    {
+        static auto next = getNext<int (*) (pthread_cond_t*, pthread_mutex_t*)> ("pthread_cond_wait");
+        RealtimeSafety::record (RealtimeSafety::Violation::lock, "pthread_cond_wait");
+        return next (condition, mutex);
+    }
+
+    int pthread_cond_timedwait (pthread_cond_t* condition, pthread_mutex_t* mutex, const struct timespec* time)
+    {
+        static auto next = getNext<int (*) (pthread_cond_t*, pthread_mutex_t*, const struct timespec*)> ("pthread_cond_timedwait");
+        RealtimeSafety::record (RealtimeSafety::Violation::lock, "pthread_cond_timedwait");
+        return next (condition, mutex, time);
+    }
+
+    int pthread_cond_signal (pthread_cond_t* condition) noexcept
+    {
+        static auto next = getNext<int (*) (pthread_cond_t*)> ("pthread_cond_signal");
+        RealtimeSafety::record (RealtimeSafety::Violation::systemCall, "pthread_cond_signal");
+        return next (condition);
+    }
+
+    int pthread_cond_broadcast (pthread_cond_t* condition) noexcept
+    {
+        static auto next = getNext<int (*) (pthread_cond_t*)> ("pthread_cond_broadcast");
+        RealtimeSafety::record (RealtimeSafety::Violation::systemCall, "pthread_cond_broadcast");
+        return next (condition);
+    }
+
+    ssize_t read (int fd, void* data, size_t size)
+    {
+        static auto next = getNext<ssize_t (*) (int, void*, size_t)> ("read");
+        RealtimeSafety::record (RealtimeSafety::Violation::systemCall, "read");
+        return next (fd, data, size);
+    }
+
+    ssize_t write (int fd, const void* data, size_t size)
+    {
+        static auto next = getNext<ssize_t (*) (int, const void*, size_t)> ("write");
+        RealtimeSafety::record (RealtimeSafety::Violation::systemCall, "write");
+        return next (fd, data, size);
+    }
+
+    int nanosleep (const struct timespec* duration, struct timespec* remaining)
+    {
+        static auto next = getNext<int (*) (const struct timespec*, struct timespec*)> ("nanosleep");
+        RealtimeSafety::record (RealtimeSafety::Violation::systemCall, "nanosleep");
+        return next (duration, remaining);
+    }
+
+    int usleep (useconds_t microseconds)
+    {
+        static auto next = getNext<int (*) (useconds_t)> ("usleep");
+        RealtimeSafety::record (RealtimeSafety::Violation::systemCall, "usleep");
+        return next (microseconds);
+    }
+
+    int sched_yield() noexcept
+    {
+        static auto next = getNext<int (*)()> ("sched_yield");
+        RealtimeSafety::record (RealtimeSafety::Violation::systemCall, "sched_yield");
+        return next();
+    }
+}
+#else
+namespace
+{
+    void* rawAllocate (size_t size) noexcept   { return std::malloc (size); }
+    void rawFree (void* pointer) noexcept      { std::free (pointer); }
+}
+#endif
+
+//==============================================================================
+/*operator new/delete are replaced on every platform; the aligned overloads keep
+  their default implementations, which the processor does not use*/
+void* operator new (size_t size)
+{
+    RealtimeSafety::record (RealtimeSafety::Violation::allocation, "operator new");
+
+    if (auto* pointer = rawAllocate (size == 0 ? 1 : size))
+        return pointer;
+
+    throw std::bad_alloc();
+}
+
+void* operator new[] (size_t size)
+{
+    RealtimeSafety::record (RealtimeSafety::Violation::allocation, "operator new[]");
+
+    if (auto* pointer = rawAllocate (size == 0 ? 1 : size))
+        return pointer;
+
+    throw std::bad_alloc();
+}
+
+void* operator new (size_t size, const std::nothrow_t&) noexcept
+{
+    RealtimeSafety::record (RealtimeSafety::Violation::allocation, "operator new");
+    return rawAllocate (size == 0 ? 1 : size);
+}
+
+void* operator new[] (size_t size, const std::nothrow_t&) noexcept
+{
+    RealtimeSafety::record (RealtimeSafety::Violation::allocation, "operator new[]");
+    return rawAllocate (size == 0 ? 1 : size);
+}
+
+void operator delete (void* pointer) noexcept
+{
+    if (pointer != nullptr)
+        RealtimeSafety::record (RealtimeSafety::Violation::deallocation, "operator delete");
+
+    rawFree (pointer);
+}
+
+void operator delete[] (void* pointer) noexcept
+{
+    if (pointer != nullptr)
+        RealtimeSafety::record (RealtimeSafety::Violation::deallocation, "operator delete[]");
+
+    rawFree (pointer);
+}
+
+void operator delete (void* pointer, size_t) noexcept    { operator delete (pointer); }
+void operator delete[] (void* pointer, size_t) noexcept  { operator delete[] (pointer); }
+
+//==============================================================================
+namespace
+{
+    /* Structural changes made on purpose every block, on top of the random automation,
+       so that the paths they start are certain to run */
+    enum class Scenario
+    {
+        randomAutomation,
+        delayRangeChanges,    // delay lines grown in the background, range crossfades
+        stageChanges,         // stages fading in and out of the cascade
+        qualityChanges        // the governor stepping up to cubic, then down to the lowest level
+    };
+
+    /* One processor configuration to run with the hooks armed. New processing modes
+       should add an entry here so that they are covered from the start */
+    struct Mode
+    {
+        juce::String name;
+        int numChannels;
+        double sampleRate;
+        bool nonRealtime;
+        bool analyserActive;
+        Scenario scenario;
+    };
+
+    std::vector<Mode> getModes()
+    {
+        std::vector<Mode> modes;
+
+        for (int numChannels : { 1, 2 })
+            for (double sampleRate : { 44100.0, 96000.0 })
+                for (bool nonRealtime : { false, true })
+                    for (bool analyserActive : { false, true })
+                        modes.push_back ({ juce::String (numChannels) + "ch/" + juce::String ((int) sampleRate)
+                                               + (nonRealtime ? "/offline" : "/realtime")
+                                               + (analyserActive ? "/analyser" : ""),
+                                           numChannels, sampleRate, nonRealtime, analyserActive, Scenario::randomAutomation });
+
+        for (bool nonRealtime : { false, true })
+        {
+            const juce::String prefix = nonRealtime ? "2ch/44100/offline" : "2ch/44100/realtime";
+            modes.push_back ({ prefix + "/range-changes", 2, 44100.0, nonRealtime, false, Scenario::delayRangeChanges });
+            modes.push_back ({ prefix + "/stage-changes", 2, 44100.0, nonRealtime, false, Scenario::stageChanges });
+        }
+
+        /*Offline renders always run at the top level, so the governor only moves in realtime*/
+        modes.push_back ({ "2ch/44100/realtime/quality-changes", 2, 44100.0, false, false, Scenario::qualityChanges });
+
+        return modes;
+    }
+
+    /* Sets the structural parameters of the scenario for 'block', which starts at 'time' seconds */
+    void applyScenario (FlanGELVSAudioProcessor& processor, Scenario scenario, int block, double time)
+    {
+        auto set = [&processor] (const char* parameterID, float value)
+        {
+            if (auto* parameter = Benchmark::findParameter (processor, parameterID))
+                parameter->setValue (parameter->convertTo0to1 (value));
+        };
+
+        switch (scenario)
+        {
+            case Scenario::delayRangeChanges:
+                /*Flanger, chorus, slap and back, each held for a few crossfades*/
+                set ("delayrange", (float) ((block / 40) % 3));
+                break;
+
+            case Scenario::stageChanges:
+            {
+                /*Jumps of several stages as well as single ones*/
+                const int stageCounts[] = { 1, 4, 2, 3 };
+                set ("stages", (float) stageCounts[(block / 30) % 4]);
+                break;
+            }
+
+            case Scenario::qualityChanges:
+            {
+                /*No load is ever enough to step down during the first 2.5 seconds (which steps up
+                  to cubic after two), and any load is afterwards (which steps down to the lowest level)*/
+                set ("adaptivequality", 1.0f);
+                const bool stepDown = time >= 2.5;
+                processor.setQualityThresholds (stepDown ? 0.0f : 1.0e9f, stepDown ? -1.0f : 1.0e8f);
+                break;
+            }
+
+            case Scenario::randomAutomation:
+            default:
+                break;
+        }
+    }
+
+    /* Blocks of irregular length (never above the prepared size), as hosts deliver them */
+    const int blockSizes[] = { 512, 1, 17, 256, 511, 64, 3, 128 };
+    constexpr int maxBlockSize = 512;
+
+    juce::var runMode (const Mode& mode, const Benchmark::ParameterPreset& preset, double seconds)
+    {
+        FlanGELVSAudioProcessor processor;
+        processor.setNonRealtime (mode.nonRealtime);
+        Benchmark::configure (processor, mode.numChannels, mode.sampleRate, maxBlockSize);
+        Benchmark::applyPreset (processor, preset);
+
+        if (mode.analyserActive)
+            processor.getAnalyser().addClient();
+
+        juce::AudioBuffer<float> buffer (mode.numChannels, maxBlockSize);
+        juce::MidiBuffer midi;
+        juce::Random random (7);
+        auto parameters = processor.getParameters();
+
+        RealtimeSafety::reset();
+
+        /*The governor needs two seconds without load to step up*/
+        const double duration = mode.scenario == Scenario::qualityChanges ? juce::jmax (seconds, 3.0) : seconds;
+        const int totalSamples = (int) (mode.sampleRate * duration);
+
+        for (int done = 0, block = 0; done < totalSamples; ++block)
+        {
+            const int numSamples = blockSizes[block % juce::numElementsInArray (blockSizes)];
+            Benchmark::fillWithNoise (buffer, random);
+
+            /*Random values are drawn before arming the hooks; juce::Random does not allocate
+              but the audio thread should not depend on that*/
+            auto* parameter = parameters[block % parameters.size()];
+            const float newValue = random.nextFloat();
+
+            /*Looking parameters up by ID makes Strings, so this is done before arming as well*/
+            applyScenario (processor, mode.scenario, block, done / mode.sampleRate);
+
+            {
+                RealtimeSafety::ScopedAudioThread audioThread;
+
+                /*Host automation arrives through setValue on the audio thread*/
+                parameter->setValue (newValue);
+
+                juce::AudioBuffer<float> chunk (buffer.getArrayOfWritePointers(), mode.numChannels, 0, numSamples);
+
+                if (block % 64 == 63)
+                    processor.processBlockBypassed (chunk, midi);
+                else
+                    processor.processBlock (chunk, midi);
+
+                juce::ignoreUnused (processor.getCurrentDelayInSamples(), processor.getFeedbackAmount(),
+                                    processor.getDryWetAmount());
+            }
+
+            done += numSamples;
+        }
+
+        if (mode.analyserActive)
+            processor.getAnalyser().removeClient();
+
+        processor.releaseResources();
+
+        auto* result = new juce::DynamicObject();
+        result->setProperty ("mode", mode.name);
+        result->setProperty ("preset", preset.name);
+        result->setProperty ("allocations", RealtimeSafety::getCount (RealtimeSafety::Violation::allocation));
+        result->setProperty ("deallocations", RealtimeSafety::getCount (RealtimeSafety::Violation::deallocation));
+        result->setProperty ("locks", RealtimeSafety::getCount (RealtimeSafety::Violation::lock));
+        result->setProperty ("systemCalls", RealtimeSafety::getCount (RealtimeSafety::Violation::systemCall));
+
+        if (auto* first = RealtimeSafety::getFirstViolation())
+            result->setProperty ("firstViolation", juce::String (first));
+
+        return juce::var (result);
+    }
+
+    /* A checker that sees nothing proves nothing: make sure the hooks fire */
+    bool hooksAreWorking()
+    {
+        RealtimeSafety::reset();
+
+        {
+            RealtimeSafety::ScopedAudioThread audioThread;
+
+            /*Through a volatile pointer, so that the compiler cannot drop the pair*/
+            int* volatile probe = new int (1);
+            delete probe;
+        }
+
+        const bool detected = RealtimeSafety::getCount (RealtimeSafety::Violation::allocation) > 0
+                           && RealtimeSafety::getCount (RealtimeSafety::Violation::deallocation) > 0;
+        RealtimeSafety::reset();
+        return detected;
+    }
+}
+
+void runRealtimeSafetyCheck (const juce::ArgumentList& args)
+{
+    juce::ScopedJuceInitialiser_GUI juceInitialiser;
+
+    const double seconds = args.containsOption ("--seconds") ? args.getValueForOption ("--seconds").getDoubleValue() : 1.0;
+
+    if (! hooksAreWorking())
+        juce::ConsoleApplication::fail ("The allocation hooks are not active in this build");
+
+    RealtimeSafety::setAbortOnViolation (args.containsOption ("--abort"));
+
+    auto result = Benchmark::createResultObject ("rtcheck");
+    result->setProperty ("interposedLibc", FLANGELVS_INTERPOSE_LIBC != 0);
+
+    juce::Array<juce::var> runs;
+    int numFailed = 0;
+
+    for (auto& mode : getModes())
+    {
+        for (auto& preset : Benchmark::getParameterPresets())
+        {
+            auto run = runMode (mode, preset, seconds);
+            const bool passed = RealtimeSafety::getTotalCount() == 0;
+
+            run.getDynamicObject()->setProperty ("passed", passed);
+            runs.add (run);
+
+            if (! passed)
+            {
+                ++numFailed;
+                std::cerr << "FAIL " << mode.name << " [" << preset.name << "]: first violation "
+                          << RealtimeSafety::getFirstViolation() << std::endl;
+            }
+        }
+    }
+
+    result->setProperty ("failed", numFailed);
+    result->setProperty ("runs", runs);
+    Benchmark::writeResult (args, juce::var (result.get()));
+
+    if (numFailed > 0)
+        juce::ConsoleApplication::fail (juce::String (numFailed) + " mode(s) are not realtime safe", 3);
+}
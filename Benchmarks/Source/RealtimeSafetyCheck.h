@@ -0,0 +1,48 @@
+/*
+  ==============================================================================
+
+    RealtimeSafetyCheck.h
+    Created: 19 Oct 2026
+    Author:  GELVS
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+
+namespace RealtimeSafety
+{
+    enum class Violation
+    {
+        allocation,
+        deallocation,
+        lock,
+        systemCall
+    };
+
+    /* Marks the calling thread as an audio thread for the lifetime of the object: any
+       allocation, free, mutex or blocking system call made on it is recorded */
+    struct ScopedAudioThread
+    {
+        ScopedAudioThread() noexcept;
+        ~ScopedAudioThread() noexcept;
+    };
+
+    /* Clears the counters and the name of the first offending call */
+    void reset() noexcept;
+
+    int getCount (Violation) noexcept;
+    int getTotalCount() noexcept;
+
+    /* Name of the first call that was recorded since reset(), or nullptr */
+    const char* getFirstViolation() noexcept;
+
+    /* Aborts at the offending call instead of counting it, so a debugger shows the stack */
+    void setAbortOnViolation (bool shouldAbort) noexcept;
+}
+
+/* Runs processBlock and the audio-thread parameter setters in every processor mode
+   with the interposed allocation/lock/system call hooks armed */
+void runRealtimeSafetyCheck (const juce::ArgumentList& args);
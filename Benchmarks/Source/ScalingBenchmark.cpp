@@ -0,0 +1,289 @@
+/*
+  ==============================================================================
+
+    ScalingBenchmark.cpp
+    Created: 19 Oct 2026
+    Author:  GELVS
+
+  ==============================================================================
+*/
+
+#include "ScalingBenchmark.h"
+#include "BenchmarkUtils.h"
+#include "ProcessorHarness.h"
+#include "../../FlanGELVS/Source/PluginProcessor.h"
+#include "../../FlanGELVS/Source/DelayMemoryArena.h"
+
+#if JUCE_LINUX
+ #include <linux/perf_event.h>
+ #include <sys/ioctl.h>
+ #include <sys/syscall.h>
+ #include <unistd.h>
+#endif
+
+namespace
+{
+    constexpr double sampleRate = 48000.0;
+    constexpr int blockSize = 128;
+    constexpr int numChannels = 2;
+
+    //==============================================================================
+    /* Last-level cache misses of the calling thread, where perf events are available */
+    class CacheMissCounter
+    {
+    public:
+        CacheMissCounter()
+        {
+           #if JUCE_LINUX
+            perf_event_attr attributes {};
+            attributes.type = PERF_TYPE_HARDWARE;
+            attributes.size = sizeof (attributes);
+            attributes.config = PERF_COUNT_HW_CACHE_MISSES;
+            attributes.disabled = 1;
+            attributes.exclude_kernel = 1;
+            attributes.exclude_hv = 1;
+
+            fd = (int) syscall (__NR_perf_event_open, &attributes, 0, -1, -1, 0);
+
+            if (fd >= 0)
+            {
+                ioctl (fd, PERF_EVENT_IOC_RESET, 0);
+                ioctl (fd, PERF_EVENT_IOC_ENABLE, 0);
+            }
+           #endif
+        }
+
+        ~CacheMissCounter()
+        {
+           #if JUCE_LINUX
+            if (fd >= 0)
+                close (fd);
+           #endif
+        }
+
+        bool isAvailable() const noexcept   { return fd >= 0; }
+
+        juce::int64 read() const noexcept
+        {
+           #if JUCE_LINUX
+            juce::int64 count = 0;
+
+            if (fd >= 0 && ::read (fd, &count, sizeof (count)) == (ssize_t) sizeof (count))
+                return count;
+           #endif
+
+            return -1;
+        }
+
+    private:
+        int fd = -1;
+
+        JUCE_DECLARE_NON_COPYABLE (CacheMissCounter)
+    };
+
+    /* Resident set size of the process in bytes, or -1 where /proc is missing */
+    juce::int64 getResidentBytes()
+    {
+       #if JUCE_LINUX
+        const auto fields = juce::StringArray::fromTokens (juce::File ("/proc/self/statm").loadFileAsString(), false);
+
+        if (fields.size() > 1)
+            return fields[1].getLargeIntValue() * (juce::int64) sysconf (_SC_PAGESIZE);
+       #endif
+
+        return -1;
+    }
+
+    //==============================================================================
+    /* Every worker finishes a host cycle before any starts the next one, like a host graph */
+    class CycleBarrier
+    {
+    public:
+        explicit CycleBarrier (int numThreads) : numParticipants (numThreads) {}
+
+        void arriveAndWait()
+        {
+            std::unique_lock<std::mutex> lock (mutex);
+            const auto generation = currentGeneration;
+
+            if (++numArrived == numParticipants)
+            {
+                numArrived = 0;
+                ++currentGeneration;
+                condition.notify_all();
+                return;
+            }
+
+            condition.wait (lock, [this, generation] { return currentGeneration != generation; });
+        }
+
+    private:
+        const int numParticipants;
+        int numArrived = 0;
+        juce::int64 currentGeneration = 0;
+        std::mutex mutex;
+        std::condition_variable condition;
+    };
+
+    /* Processes the instances [begin, end) one block each per host cycle */
+    class Worker  : public juce::Thread
+    {
+    public:
+        Worker (std::vector<std::unique_ptr<FlanGELVSAudioProcessor>>& p, size_t first, size_t last,
+                CycleBarrier& b, int cycles, int warmUp)
+            : juce::Thread ("Scaling worker"), processors (p), begin (first), end (last),
+              barrier (b), numCycles (cycles), numWarmUpCycles (warmUp),
+              buffer (numChannels, blockSize)
+        {
+            juce::Random random ((juce::int64) first);
+            Benchmark::fillWithNoise (buffer, random);
+        }
+
+        void run() override
+        {
+            runCycles (numWarmUpCycles);
+
+            CacheMissCounter counter;
+            runCycles (numCycles);
+
+            cacheMisses = counter.read();
+            countersAvailable = counter.isAvailable();
+        }
+
+        juce::int64 cacheMisses = -1;
+        bool countersAvailable = false;
+
+    private:
+        void runCycles (int count)
+        {
+            juce::MidiBuffer midi;
+
+            for (int cycle = 0; cycle < count; ++cycle)
+            {
+                for (size_t i = begin; i < end; ++i)
+                    processors[i]->processBlock (buffer, midi);
+
+                barrier.arriveAndWait();
+            }
+        }
+
+        std::vector<std::unique_ptr<FlanGELVSAudioProcessor>>& processors;
+        const size_t begin, end;
+        CycleBarrier& barrier;
+        const int numCycles, numWarmUpCycles;
+        juce::AudioBuffer<float> buffer;
+    };
+
+    //==============================================================================
+    std::vector<int> getThreadCounts (int maxThreads)
+    {
+        std::vector<int> counts;
+
+        for (int n = 1; n < maxThreads; n *= 2)
+            counts.push_back (n);
+
+        counts.push_back (maxThreads);
+        return counts;
+    }
+}
+
+//==============================================================================
+void runScalingBenchmark (const juce::ArgumentList& args)
+{
+    juce::ScopedJuceInitialiser_GUI juceInitialiser;
+
+    const double seconds = args.containsOption ("--seconds") ? args.getValueForOption ("--seconds").getDoubleValue() : 0.5;
+    const int maxInstances = Benchmark::getIntOption (args, "--max-instances", 1000);
+    const int maxThreads = juce::jmax (1, Benchmark::getIntOption (args, "--max-threads", juce::SystemStats::getNumCpus()));
+    const int numCycles = juce::jmax (1, (int) (seconds * sampleRate / blockSize));
+    const int numWarmUpCycles = juce::jmax (1, numCycles / 10);
+
+    auto result = Benchmark::createResultObject ("scaling");
+    result->setProperty ("sampleRate", sampleRate);
+    result->setProperty ("blockSize", blockSize);
+    result->setProperty ("channels", numChannels);
+    result->setProperty ("secondsPerInstance", seconds);
+
+    juce::Array<juce::var> results;
+
+    for (int numInstances : { 1, 10, 100, 1000 })
+    {
+        if (numInstances > maxInstances)
+            break;
+
+        /*Memory is measured around creating and preparing the instances: prepareToPlay
+          clears the delay lines, so their pages are resident afterwards*/
+        const auto residentBefore = getResidentBytes();
+
+        std::vector<std::unique_ptr<FlanGELVSAudioProcessor>> processors;
+
+        for (int i = 0; i < numInstances; ++i)
+        {
+            processors.push_back (std::make_unique<FlanGELVSAudioProcessor>());
+            Benchmark::configure (*processors.back(), numChannels, sampleRate, blockSize);
+        }
+
+        const auto residentAfter = getResidentBytes();
+        const auto delayMemory = juce::SharedResourcePointer<DelayMemoryArena>()->getStatistics();
+
+        for (int numThreads : getThreadCounts (juce::jmin (maxThreads, numInstances)))
+        {
+            CycleBarrier barrier (numThreads);
+            juce::OwnedArray<Worker> workers;
+
+            for (int t = 0; t < numThreads; ++t)
+                workers.add (new Worker (processors, (size_t) (numInstances * t / numThreads),
+                                         (size_t) (numInstances * (t + 1) / numThreads),
+                                         barrier, numCycles, numWarmUpCycles));
+
+            const auto start = Benchmark::nowMs();
+
+            for (auto* worker : workers)
+                worker->startThread (juce::Thread::realtimeAudioPriority);
+
+            for (auto* worker : workers)
+                worker->waitForThreadToExit (-1);
+
+            /*Warm-up cycles are included in the wall time: scale it to the measured part*/
+            const double elapsedMs = (Benchmark::nowMs() - start) * numCycles / (numCycles + numWarmUpCycles);
+
+            juce::int64 cacheMisses = 0;
+            bool countersAvailable = true;
+
+            for (auto* worker : workers)
+            {
+                countersAvailable = countersAvailable && worker->countersAvailable;
+                cacheMisses += worker->cacheMisses;
+            }
+
+            const double instanceSamples = (double) numInstances * numCycles * blockSize;
+
+            auto* entry = new juce::DynamicObject();
+            entry->setProperty ("instances", numInstances);
+            entry->setProperty ("threads", numThreads);
+            entry->setProperty ("nsPerInstanceSample", 1.0e6 * elapsedMs / instanceSamples);
+
+            /*How many instances this configuration could run in real time*/
+            entry->setProperty ("realtimeInstances", instanceSamples / sampleRate / (elapsedMs * 0.001));
+
+            if (countersAvailable)
+                entry->setProperty ("llcMissesPerInstanceBlock", (double) cacheMisses / ((double) numInstances * numCycles));
+
+            if (residentBefore >= 0 && residentAfter >= 0)
+                entry->setProperty ("residentBytesPerInstance", (double) (residentAfter - residentBefore) / numInstances);
+
+            entry->setProperty ("delayMemory", delayMemory.toVar());
+
+            results.add (juce::var (entry));
+
+            std::cerr << numInstances << " instances on " << numThreads << " threads: "
+                      << juce::String (1.0e6 * elapsedMs / instanceSamples, 2) << " ns per instance-sample" << std::endl;
+        }
+
+        for (auto& processor : processors)
+            processor->releaseResources();
+    }
+
+    result->setProperty ("results", results);
+    Benchmark::writeResult (args, juce::var (result.get()));
+}
@@ -0,0 +1,18 @@
+/*
+  ==============================================================================
+
+    ScalingBenchmark.h
+    Created: 19 Oct 2026
+    Author:  GELVS
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+
+/* Processes 1 to 1000 processor instances round-robin on 1..k threads, reporting
+   throughput, last-level cache misses (Linux perf counters) and resident memory
+   per instance */
+void runScalingBenchmark (const juce::ArgumentList& args);
@@ -0,0 +1,176 @@
+/*
+  ==============================================================================
+
+    StressBenchmark.cpp
+    Created: 19 Oct 2026
+    Author:  GELVS
+
+  ==============================================================================
+*/
+
+#include "StressBenchmark.h"
+#include "BenchmarkUtils.h"
+#include "ProcessorHarness.h"
+#include "../../FlanGELVS/Source/PluginProcessor.h"
+
+namespace
+{
+    constexpr int preparedBlockSize = 512;
+    constexpr int largestBlockSize = preparedBlockSize * 8;
+
+    /* Produces the size of the next block, given its index and a random generator */
+    struct BlockSequence
+    {
+        const char* name;
+        std::function<int (int block, juce::Random&)> nextSize;
+    };
+
+    const std::vector<BlockSequence>& getSequences()
+    {
+        static const std::vector<BlockSequence> sequences
+        {
+            /*Reference: what the fixed-size benchmark measures*/
+            { "fixed", [] (int, juce::Random&) { return preparedBlockSize; } },
+
+            { "random", [] (int, juce::Random& r) { return 1 + r.nextInt (preparedBlockSize * 2); } },
+
+            /*A block split at automation points: runs of single samples, then the remainder*/
+            { "automation-split", [] (int block, juce::Random&)
+                {
+                    const int position = block % 17;
+                    return position < 16 ? 1 : preparedBlockSize - 16;
+                } },
+
+            /*Odd sizes after loop points*/
+            { "odd", [] (int block, juce::Random&)
+                {
+                    static const int primes[] = { 7, 509, 3, 127, 13, 311, 1, 251, 61, 499 };
+                    return primes[block % juce::numElementsInArray (primes)];
+                } },
+
+            /*Hosts that ignore the prepared size now and then*/
+            { "oversized", [] (int block, juce::Random&)
+                {
+                    return block % 8 == 7 ? largestBlockSize : preparedBlockSize;
+                } },
+
+            { "alternating", [] (int block, juce::Random&)
+                {
+                    return block % 2 == 0 ? 1 : largestBlockSize - 1;
+                } },
+        };
+
+        return sequences;
+    }
+
+    struct StressResult
+    {
+        Benchmark::Statistics callNs, nsPerSample;
+        double worstDeadlineFraction = 0;
+        int numCalls = 0;
+    };
+
+    StressResult measure (const BlockSequence& sequence, int numChannels, double sampleRate, double seconds, bool parameterJumps)
+    {
+        FlanGELVSAudioProcessor processor;
+        Benchmark::configure (processor, numChannels, sampleRate, preparedBlockSize);
+
+        juce::AudioBuffer<float> input (numChannels, largestBlockSize), buffer (numChannels, largestBlockSize);
+        juce::MidiBuffer midi;
+        juce::Random random (3), sizeRandom (11);
+        auto parameters = processor.getParameters();
+
+        Benchmark::fillWithNoise (input, random);
+
+        const int totalSamples = (int) (sampleRate * seconds);
+        std::vector<double> callNs, nsPerSample;
+        callNs.reserve ((size_t) totalSamples);
+        nsPerSample.reserve ((size_t) totalSamples);
+
+        StressResult result;
+
+        for (int done = 0, block = 0; done < totalSamples; ++block)
+        {
+            const int numSamples = juce::jlimit (1, largestBlockSize, sequence.nextSize (block, sizeRandom));
+
+            for (int channel = 0; channel < numChannels; ++channel)
+                buffer.copyFrom (channel, 0, input, channel, 0, numSamples);
+
+            /*Host automation: a parameter jumps to a random value on a quarter of the blocks*/
+            if (parameterJumps && random.nextInt (4) == 0)
+                parameters[random.nextInt (parameters.size())]->setValue (random.nextFloat());
+
+            juce::AudioBuffer<float> chunk (buffer.getArrayOfWritePointers(), numChannels, 0, numSamples);
+
+            const auto startTicks = juce::Time::getHighResolutionTicks();
+            processor.processBlock (chunk, midi);
+            const double ns = 1.0e9 * juce::Time::highResolutionTicksToSeconds (juce::Time::getHighResolutionTicks() - startTicks);
+
+            callNs.push_back (ns);
+            nsPerSample.push_back (ns / numSamples);
+            result.worstDeadlineFraction = juce::jmax (result.worstDeadlineFraction, ns * sampleRate * 1.0e-9 / numSamples);
+            done += numSamples;
+        }
+
+        processor.releaseResources();
+
+        result.numCalls = (int) callNs.size();
+        result.callNs = Benchmark::Statistics::from (std::move (callNs));
+        result.nsPerSample = Benchmark::Statistics::from (std::move (nsPerSample));
+        return result;
+    }
+}
+
+//==============================================================================
+void runStressBenchmark (const juce::ArgumentList& args)
+{
+    juce::ScopedJuceInitialiser_GUI juceInitialiser;
+
+    const double seconds = args.containsOption ("--seconds") ? args.getValueForOption ("--seconds").getDoubleValue() : 2.0;
+    const double sampleRate = 48000.0;
+
+    auto result = Benchmark::createResultObject ("stress");
+    result->setProperty ("preparedBlockSize", preparedBlockSize);
+    result->setProperty ("sampleRate", sampleRate);
+    result->setProperty ("seconds", seconds);
+
+    juce::Array<juce::var> results;
+
+    for (int numChannels : { 1, 2 })
+    {
+        for (bool parameterJumps : { false, true })
+        {
+            double fixedP50 = 0;
+
+            for (auto& sequence : getSequences())
+            {
+                const auto measured = measure (sequence, numChannels, sampleRate, seconds, parameterJumps);
+
+                /*The fixed sequence comes first: every other one is compared with it*/
+                if (std::strcmp (sequence.name, "fixed") == 0)
+                    fixedP50 = measured.nsPerSample.p50;
+
+                auto* entry = new juce::DynamicObject();
+                entry->setProperty ("sequence", juce::String (sequence.name));
+                entry->setProperty ("channels", numChannels);
+                entry->setProperty ("parameterJumps", parameterJumps);
+                entry->setProperty ("calls", measured.numCalls);
+                entry->setProperty ("callNs", measured.callNs.toVar());
+                entry->setProperty ("nsPerSample", measured.nsPerSample.toVar());
+                entry->setProperty ("worstDeadlineFraction", measured.worstDeadlineFraction);
+
+                if (fixedP50 > 0)
+                    entry->setProperty ("p99NsPerSampleVsFixed", measured.nsPerSample.p99 / fixedP50);
+
+                results.add (juce::var (entry));
+
+                std::cerr << sequence.name << " " << numChannels << "ch" << (parameterJumps ? " +jumps" : "")
+                          << ": p50 " << measured.callNs.p50 << " ns, p99 " << measured.callNs.p99
+                          << " ns, max " << measured.callNs.max << " ns per call" << std::endl;
+            }
+        }
+    }
+
+    result->setProperty ("results", results);
+    Benchmark::writeResult (args, juce::var (result.get()));
+}
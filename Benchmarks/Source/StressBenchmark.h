@@ -0,0 +1,18 @@
+/*
+  ==============================================================================
+
+    StressBenchmark.h
+    Created: 19 Oct 2026
+    Author:  GELVS
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+
+/* Drives processBlock with randomised and adversarial block-size sequences (including
+   blocks larger than the prepared size) and parameter jumps, reporting the latency
+   distribution of every call */
+void runStressBenchmark (const juce::ArgumentList& args);
@@ -0,0 +1,159 @@
+/*
+  ==============================================================================
+
+    BackgroundImageCache.cpp
+    Created: 19 Oct 2026
+    Author:  GELVS
+
+  ==============================================================================
+*/
+
+#include "BackgroundImageCache.h"
+
+//==============================================================================
+BackgroundImageCache::BackgroundImageCache (const void* data, int dataSize, std::function<void()> callback)
+    : juce::Thread ("FlanGELVS background"),
+      imageData (data), imageDataSize (dataSize), onImageReady (std::move (callback))
+{
+    startThread (3);
+}
+
+BackgroundImageCache::~BackgroundImageCache()
+{
+    /*Stop the worker first: until it has exited it can still trigger another update*/
+    signalThreadShouldExit();
+    notify();
+    stopThread (2000);
+    cancelPendingUpdate();
+}
+
+//==============================================================================
+void BackgroundImageCache::requestSize (int width, int height, float displayScale)
+{
+    if (width <= 0 || height <= 0)
+        return;
+
+    {
+        const juce::ScopedLock sl (lock);
+
+        /*Nothing to do if this exact rendering is already cached*/
+        auto it = renderedByScale.find (getScaleKey (displayScale));
+
+        if (it != renderedByScale.end()
+             && it->second.getWidth()  == juce::roundToInt (width  * displayScale)
+             && it->second.getHeight() == juce::roundToInt (height * displayScale))
+            return;
+
+        pendingRequest = { width, height, displayScale };
+        hasPendingRequest = true;
+    }
+
+    notify();
+}
+
+juce::Image BackgroundImageCache::getImage (int width, int height, float displayScale) const
+{
+    const juce::ScopedLock sl (lock);
+
+    auto it = renderedByScale.find (getScaleKey (displayScale));
+
+    if (it != renderedByScale.end())
+        return it->second;
+
+    /*No rendering yet for this display: fall back to the closest mip level*/
+    return getMipLevelFor (juce::roundToInt (width * displayScale), juce::roundToInt (height * displayScale));
+}
+
+//==============================================================================
+void BackgroundImageCache::buildMipChain()
+{
+    /*The ImageCache keeps the decoded image for a while, so reopening the editor skips the decode*/
+    auto source = juce::ImageCache::getFromMemory (imageData, imageDataSize);
+
+    if (! source.isValid())
+        return;
+
+    juce::Array<juce::Image> levels;
+    levels.add (source);
+
+    /*Halve the image until it is smaller than the smallest editor size we allow*/
+    while (levels.getLast().getWidth() > 256 && levels.getLast().getHeight() > 256)
+    {
+        auto previous = levels.getLast();
+        levels.add (previous.rescaled (previous.getWidth() / 2, previous.getHeight() / 2,
+                                       juce::Graphics::highResamplingQuality));
+    }
+
+    const juce::ScopedLock sl (lock);
+    mipLevels.swapWith (levels);
+}
+
+juce::Image BackgroundImageCache::getMipLevelFor (int physicalWidth, int physicalHeight) const
+{
+    /*Pick the smallest level that still has at least as many pixels as the target*/
+    for (int i = mipLevels.size(); --i >= 0;)
+        if (mipLevels.getReference (i).getWidth() >= physicalWidth
+             && mipLevels.getReference (i).getHeight() >= physicalHeight)
+            return mipLevels.getReference (i);
+
+    return mipLevels.isEmpty() ? juce::Image() : mipLevels.getFirst();
+}
+
+//==============================================================================
+void BackgroundImageCache::run()
+{
+    buildMipChain();
+
+    /*Let the editor replace its placeholder with the nearest mip level straight away*/
+    triggerAsyncUpdate();
+
+    while (! threadShouldExit())
+    {
+        Request request;
+
+        {
+            const juce::ScopedLock sl (lock);
+            request = pendingRequest;
+
+            if (! hasPendingRequest)
+                request.width = 0;
+
+            hasPendingRequest = false;
+        }
+
+        if (request.width == 0)
+        {
+            wait (-1);
+            continue;
+        }
+
+        const int physicalWidth  = juce::roundToInt (request.width  * request.displayScale);
+        const int physicalHeight = juce::roundToInt (request.height * request.displayScale);
+
+        juce::Image level;
+
+        {
+            const juce::ScopedLock sl (lock);
+            level = getMipLevelFor (physicalWidth, physicalHeight);
+        }
+
+        if (! level.isValid())
+            continue;
+
+        /*The resampling is the expensive part, so it happens without holding the lock*/
+        auto rendered = level.rescaled (physicalWidth, physicalHeight, juce::Graphics::highResamplingQuality);
+
+        {
+            const juce::ScopedLock sl (lock);
+            renderedByScale[getScaleKey (request.displayScale)] = rendered;
+        }
+
+        triggerAsyncUpdate();
+    }
+}
+
+void BackgroundImageCache::handleAsyncUpdate()
+{
+    if (onImageReady != nullptr)
+        onImageReady();
+}
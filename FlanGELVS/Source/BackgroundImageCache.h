@@ -0,0 +1,70 @@
+/*
+  ==============================================================================
+
+    BackgroundImageCache.h
+    Created: 19 Oct 2026
+    Author:  GELVS
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+
+//==============================================================================
+/**
+    Keeps the editor background rendered at the exact physical pixel size of
+    every display scale it has been shown on.
+
+    The worker thread first decodes the image data and reduces it into a mip
+    chain (each level half the size of the previous one), so constructing the
+    cache costs nothing on the message thread. After that, a resize only asks
+    the worker to resample the smallest level that is still larger than the
+    target, so the message thread never rescales anything during a drag.
+*/
+class BackgroundImageCache  : private juce::Thread,
+                              private juce::AsyncUpdater
+{
+public:
+    /* 'imageData' (PNG, JPEG...) must stay valid for the lifetime of the cache, e.g. BinaryData.
+       'onImageReady' is called on the message thread when a new rendering is available */
+    BackgroundImageCache (const void* imageData, int imageDataSize, std::function<void()> onImageReady);
+    ~BackgroundImageCache() override;
+
+    /* Ask for a rendering of 'width' x 'height' logical pixels at 'displayScale'.
+       Only the latest request is kept, so a drag coalesces into a single job */
+    void requestSize (int width, int height, float displayScale);
+
+    /* Returns the best rendering available for this scale: the exact size if it is
+       ready, otherwise the last one rendered for this scale (or the nearest mip level).
+       Returns an invalid image while the source is still being decoded */
+    juce::Image getImage (int width, int height, float displayScale) const;
+
+private:
+    struct Request
+    {
+        int width = 0, height = 0;
+        float displayScale = 1.0f;
+    };
+
+    static int getScaleKey (float displayScale)  { return juce::roundToInt (displayScale * 100.0f); }
+
+    void buildMipChain();
+    juce::Image getMipLevelFor (int physicalWidth, int physicalHeight) const;
+
+    void run() override;
+    void handleAsyncUpdate() override;
+
+    const void* imageData;
+    const int imageDataSize;
+    std::function<void()> onImageReady;
+
+    juce::Array<juce::Image> mipLevels;
+    std::map<int, juce::Image> renderedByScale;
+    Request pendingRequest;
+    bool hasPendingRequest = false;
+    juce::CriticalSection lock;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (BackgroundImageCache)
+};
@@ -0,0 +1,177 @@
+/*
+  ==============================================================================
+
+    CpuLoadMeter.cpp
+    Created: 19 Oct 2026
+    Author:  GELVS
+
+  ==============================================================================
+*/
+
+#include "CpuLoadMeter.h"
+
+#if JUCE_INTEL
+ #if JUCE_MSVC
+  #include <intrin.h>
+ #else
+  #include <x86intrin.h>
+ #endif
+#endif
+
+namespace
+{
+    /* Measured once per process against the high resolution clock */
+    double measureNanosecondsPerCycle()
+    {
+       #if JUCE_INTEL
+        const auto startTicks = juce::Time::getHighResolutionTicks();
+        const auto startCycles = (juce::uint64) __rdtsc();
+
+        while (juce::Time::highResolutionTicksToSeconds (juce::Time::getHighResolutionTicks() - startTicks) < 0.005)
+        {
+        }
+
+        const auto cycles = (juce::uint64) __rdtsc() - startCycles;
+        const double seconds = juce::Time::highResolutionTicksToSeconds (juce::Time::getHighResolutionTicks() - startTicks);
+        return cycles > 0 ? 1.0e9 * seconds / (double) cycles : 1.0;
+       #else
+        return 1.0e9 / (double) juce::Time::getHighResolutionTicksPerSecond();
+       #endif
+    }
+}
+
+//==============================================================================
+CpuLoadMeter::CpuLoadMeter()
+{
+    for (auto& bin : bins)
+        bin = 0;
+}
+
+juce::uint64 CpuLoadMeter::readCycles() noexcept
+{
+   #if JUCE_INTEL
+    return (juce::uint64) __rdtsc();
+   #else
+    return (juce::uint64) juce::Time::getHighResolutionTicks();
+   #endif
+}
+
+void CpuLoadMeter::prepare (double newSampleRate) noexcept
+{
+    static const double calibration = measureNanosecondsPerCycle();
+
+    nanosecondsPerCycle = calibration;
+    sampleRate = newSampleRate;
+    lastLoad = 0.0f;
+    clear();
+}
+
+double CpuLoadMeter::getBinUpperEdgeNs (int bin) noexcept
+{
+    return std::pow (2.0, 0.5 * (bin + 1));
+}
+
+void CpuLoadMeter::addMeasurement (juce::uint64 cycles, int numSamples) noexcept
+{
+    if (numSamples <= 0)
+        return;
+
+    /*Single writer: plain load/store pairs are enough, no read-modify-write needed*/
+    if (clearRequested.load (std::memory_order_relaxed) && clearRequested.exchange (false))
+    {
+        for (auto& bin : bins)
+            bin.store (0, std::memory_order_relaxed);
+
+        numBlocks.store (0, std::memory_order_relaxed);
+        numOverruns.store (0, std::memory_order_relaxed);
+        averageLoad.store (0.0f, std::memory_order_relaxed);
+        peakLoad.store (0.0f, std::memory_order_relaxed);
+    }
+
+    const double nanoseconds = (double) cycles * nanosecondsPerCycle;
+    const double nsPerSample = nanoseconds / numSamples;
+    const float load = (float) (nanoseconds * sampleRate * 1.0e-9 / numSamples);
+    lastLoad = load;
+
+    const int binIndex = nsPerSample < 1.0 ? 0 : juce::jmin (numBins - 1, (int) (2.0 * std::log2 (nsPerSample)));
+    auto& bin = bins[(size_t) binIndex];
+    bin.store (bin.load (std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+
+    numBlocks.store (numBlocks.load (std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+
+    if (load > 1.0f)
+        numOverruns.store (numOverruns.load (std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+
+    /*Exponential smoothing with a time constant of about half a second*/
+    const float alpha = juce::jmin (1.0f, (float) (numSamples / (0.5 * sampleRate)));
+    const float average = averageLoad.load (std::memory_order_relaxed);
+    averageLoad.store (average + alpha * (load - average), std::memory_order_relaxed);
+
+    if (load > peakLoad.load (std::memory_order_relaxed))
+        peakLoad.store (load, std::memory_order_relaxed);
+}
+
+CpuLoadMeter::Snapshot CpuLoadMeter::getSnapshot() const noexcept
+{
+    Snapshot snapshot;
+    snapshot.numBlocks = numBlocks.load (std::memory_order_relaxed);
+    snapshot.numOverruns = numOverruns.load (std::memory_order_relaxed);
+    snapshot.averageLoad = averageLoad.load (std::memory_order_relaxed);
+    snapshot.peakLoad = peakLoad.load (std::memory_order_relaxed);
+
+    for (size_t i = 0; i < bins.size(); ++i)
+        snapshot.histogram[i] = bins[i].load (std::memory_order_relaxed);
+
+    return snapshot;
+}
+
+//==============================================================================
+double CpuLoadMeter::Snapshot::getNsPerSamplePercentile (double proportion) const noexcept
+{
+    juce::uint64 total = 0;
+
+    for (auto count : histogram)
+        total += count;
+
+    if (total == 0)
+        return 0.0;
+
+    const auto target = (juce::uint64) std::ceil (juce::jlimit (0.0, 1.0, proportion) * (double) total);
+    juce::uint64 cumulative = 0;
+
+    for (int bin = 0; bin < numBins; ++bin)
+    {
+        cumulative += histogram[(size_t) bin];
+
+        if (cumulative >= target)
+            return getBinUpperEdgeNs (bin);
+    }
+
+    return getBinUpperEdgeNs (numBins - 1);
+}
+
+juce::String CpuLoadMeter::Snapshot::toString() const
+{
+    return "CPU " + juce::String (averageLoad * 100.0f, 1) + "%  peak " + juce::String (peakLoad * 100.0f, 1)
+         + "%  p99 " + juce::String (getNsPerSamplePercentile (0.99), 0) + " ns/smp  overruns "
+         + juce::String ((juce::int64) numOverruns);
+}
+
+std::unique_ptr<juce::XmlElement> CpuLoadMeter::Snapshot::createXml() const
+{
+    auto xml = std::make_unique<juce::XmlElement> ("CpuLoad");
+    xml->setAttribute ("blocks", juce::String ((juce::int64) numBlocks));
+    xml->setAttribute ("overruns", juce::String ((juce::int64) numOverruns));
+    xml->setAttribute ("averageLoad", averageLoad);
+    xml->setAttribute ("peakLoad", peakLoad);
+    xml->setAttribute ("p50NsPerSample", getNsPerSamplePercentile (0.5));
+    xml->setAttribute ("p99NsPerSample", getNsPerSamplePercentile (0.99));
+
+    juce::StringArray counts;
+
+    for (auto count : histogram)
+        counts.add (juce::String ((juce::int64) count));
+
+    xml->setAttribute ("histogram", counts.joinIntoString (" "));
+    return xml;
+}
@@ -0,0 +1,97 @@
+/*
+  ==============================================================================
+
+    CpuLoadMeter.h
+    Created: 19 Oct 2026
+    Author:  GELVS
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+
+//==============================================================================
+/**
+    Per-instance processBlock timing.
+
+    Every block is timed with the cycle counter (rdtsc on x86, the high resolution
+    tick counter elsewhere) and added to a histogram of ns/sample, together with
+    the load relative to the block's duration and a count of blocks that took
+    longer than their duration. The audio thread is the only writer; any thread
+    may take a snapshot. Nothing locks or allocates.
+*/
+class CpuLoadMeter
+{
+public:
+    /* Bin k counts blocks of [2^(k/2), 2^((k+1)/2)) ns/sample: 1 ns to 64 us in 32 bins */
+    static constexpr int numBins = 32;
+
+    struct Snapshot
+    {
+        juce::uint64 numBlocks = 0;
+        juce::uint64 numOverruns = 0;
+        float averageLoad = 0.0f;   // fraction of the block duration, smoothed over ~0.5 s
+        float peakLoad = 0.0f;      // largest fraction since the last clear()
+        std::array<juce::uint32, numBins> histogram {};
+
+        /* Upper edge of the bin holding the given proportion (0..1) of the blocks */
+        double getNsPerSamplePercentile (double proportion) const noexcept;
+
+        /* One line summary, e.g. for the editor overlay */
+        juce::String toString() const;
+
+        /* Element for the state dump */
+        std::unique_ptr<juce::XmlElement> createXml() const;
+    };
+
+    CpuLoadMeter();
+
+    /* Message thread, from prepareToPlay */
+    void prepare (double sampleRate) noexcept;
+
+    /* Any thread: the counters are cleared by the audio thread at the start of its next block */
+    void clear() noexcept   { clearRequested = true; }
+
+    Snapshot getSnapshot() const noexcept;
+
+    /* Audio thread: load of the last block measured, for the QualityGovernor */
+    float getLastLoad() const noexcept   { return lastLoad; }
+
+    static double getBinUpperEdgeNs (int bin) noexcept;
+
+    /* Audio thread: times its own lifetime as the processing of 'numSamples' */
+    class ScopedMeasurement
+    {
+    public:
+        ScopedMeasurement (CpuLoadMeter& m, int numSamples) noexcept
+            : meter (m), blockSize (numSamples), start (readCycles())
+        {
+        }
+
+        ~ScopedMeasurement() noexcept   { meter.addMeasurement (readCycles() - start, blockSize); }
+
+    private:
+        CpuLoadMeter& meter;
+        const int blockSize;
+        const juce::uint64 start;
+
+        JUCE_DECLARE_NON_COPYABLE (ScopedMeasurement)
+    };
+
+private:
+    static juce::uint64 readCycles() noexcept;
+    void addMeasurement (juce::uint64 cycles, int numSamples) noexcept;
+
+    double nanosecondsPerCycle = 1.0;
+    double sampleRate = 44100.0;
+
+    std::atomic<juce::uint64> numBlocks { 0 }, numOverruns { 0 };
+    std::atomic<float> averageLoad { 0.0f }, peakLoad { 0.0f };
+    std::array<std::atomic<juce::uint32>, numBins> bins;
+    std::atomic<bool> clearRequested { false };
+    float lastLoad = 0.0f;
+
+    JUCE_DECLARE_NON_COPYABLE (CpuLoadMeter)
+};
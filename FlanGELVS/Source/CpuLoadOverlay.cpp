@@ -0,0 +1,53 @@
+/*
+  ==============================================================================
+
+    CpuLoadOverlay.cpp
+    Created: 19 Oct 2026
+    Author:  GELVS
+
+  ==============================================================================
+*/
+
+#include "CpuLoadOverlay.h"
+
+//==============================================================================
+CpuLoadOverlay::CpuLoadOverlay (FlanGELVSAudioProcessor& p)
+    : audioProcessor (p)
+{
+    setOpaque (false);
+    startTimerHz (4);
+}
+
+CpuLoadOverlay::~CpuLoadOverlay()
+{
+    stopTimer();
+}
+
+void CpuLoadOverlay::timerCallback()
+{
+    snapshot = audioProcessor.getCpuLoad().getSnapshot();
+    repaint();
+}
+
+void CpuLoadOverlay::mouseUp (const juce::MouseEvent&)
+{
+    audioProcessor.getCpuLoad().clear();
+}
+
+void CpuLoadOverlay::paint (juce::Graphics& g)
+{
+    auto area = getLocalBounds().toFloat();
+
+    g.setColour (juce::Colours::black.withAlpha (0.6f));
+    g.fillRoundedRectangle (area, 3.0f);
+
+    /*Turns red as soon as a block has missed its deadline*/
+    g.setColour (snapshot.numOverruns > 0 ? juce::Colours::red : juce::Colours::white);
+    g.setFont (area.getHeight() * 0.7f);
+    auto text = snapshot.toString();
+
+    if (audioProcessor.isAdaptiveQualityEnabled())
+        text << "  quality " << QualityGovernor::getLevelName (audioProcessor.getQualityLevel());
+
+    g.drawText (text, area.reduced (4.0f, 0.0f), juce::Justification::centredLeft, false);
+}
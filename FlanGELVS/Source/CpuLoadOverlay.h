@@ -0,0 +1,38 @@
+/*
+  ==============================================================================
+
+    CpuLoadOverlay.h
+    Created: 19 Oct 2026
+    Author:  GELVS
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+#include "PluginProcessor.h"
+
+//==============================================================================
+/**
+    One line readout of the processor's CpuLoadMeter, refreshed a few times per
+    second. Clicking it clears the peak, the histogram and the overrun count.
+*/
+class CpuLoadOverlay  : public juce::Component,
+                        private juce::Timer
+{
+public:
+    explicit CpuLoadOverlay (FlanGELVSAudioProcessor&);
+    ~CpuLoadOverlay() override;
+
+    void paint (juce::Graphics&) override;
+    void mouseUp (const juce::MouseEvent&) override;
+
+private:
+    void timerCallback() override;
+
+    FlanGELVSAudioProcessor& audioProcessor;
+    CpuLoadMeter::Snapshot snapshot;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (CpuLoadOverlay)
+};
@@ -0,0 +1,269 @@
+/*
+  ==============================================================================
+
+    DelayMemoryArena.cpp
+    Created: 19 Oct 2026
+    Author:  GELVS
+
+  ==============================================================================
+*/
+
+#include "DelayMemoryArena.h"
+
+#if JUCE_WINDOWS
+ #ifndef NOMINMAX
+  #define NOMINMAX
+ #endif
+ #ifndef WIN32_LEAN_AND_MEAN
+  #define WIN32_LEAN_AND_MEAN
+ #endif
+ #include <windows.h>
+#else
+ #include <sys/mman.h>
+#endif
+
+namespace
+{
+    size_t roundUp (size_t value, size_t multiple) noexcept
+    {
+        return (value + multiple - 1) / multiple * multiple;
+    }
+
+    /* Maps 'size' bytes, trying huge pages first if asked to; sets 'gotHugePages' */
+    char* mapMemory (size_t size, bool tryHugePages, bool& gotHugePages)
+    {
+        gotHugePages = false;
+
+       #if JUCE_WINDOWS
+        /*Large pages need the SeLockMemoryPrivilege, which plugin hosts do not have*/
+        juce::ignoreUnused (tryHugePages);
+        return static_cast<char*> (VirtualAlloc (nullptr, size, MEM_RESERVE | MEM_COMMIT, PAGE_READWRITE));
+       #else
+        void* memory = MAP_FAILED;
+
+       #if JUCE_LINUX
+        /*Reserved huge pages first, then transparent huge pages on an ordinary mapping*/
+        if (tryHugePages)
+        {
+            memory = mmap (nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANON | MAP_HUGETLB, -1, 0);
+            gotHugePages = memory != MAP_FAILED;
+        }
+       #endif
+
+        if (memory == MAP_FAILED)
+            memory = mmap (nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANON, -1, 0);
+
+        if (memory == MAP_FAILED)
+            return nullptr;
+
+       #if JUCE_LINUX
+        if (tryHugePages && ! gotHugePages)
+            gotHugePages = madvise (memory, size, MADV_HUGEPAGE) == 0;
+       #else
+        juce::ignoreUnused (tryHugePages);
+       #endif
+
+        return static_cast<char*> (memory);
+       #endif
+    }
+
+    void unmapMemory (char* memory, size_t size) noexcept
+    {
+       #if JUCE_WINDOWS
+        juce::ignoreUnused (size);
+        VirtualFree (memory, 0, MEM_RELEASE);
+       #else
+        munmap (memory, size);
+       #endif
+    }
+}
+
+//==============================================================================
+DelayMemoryArena::DelayMemoryArena()
+    : wantHugePages (juce::SystemStats::getEnvironmentVariable ("FLANGELVS_HUGE_PAGES", "0").getIntValue() != 0)
+{
+}
+
+DelayMemoryArena::~DelayMemoryArena()
+{
+    /*Every delay line must have given its memory back by now*/
+    for (auto& slab : slabs)
+    {
+        jassert (slab->usedBlocks.empty());
+        releaseSlab (*slab);
+    }
+}
+
+DelayMemoryArena::Slab* DelayMemoryArena::createSlab (size_t minimumSize)
+{
+    auto slab = std::make_unique<Slab>();
+    slab->size = roundUp (juce::jmax (minimumSize, slabSize), slabSize);
+    slab->memory = mapMemory (slab->size, wantHugePages, slab->hugePages);
+
+    if (slab->memory == nullptr)
+        return nullptr;
+
+    /*Fault every page in now, rather than on the audio thread when a delay line first reaches it*/
+    std::memset (slab->memory, 0, slab->size);
+
+    try
+    {
+        slab->freeBlocks[0] = slab->size;
+        slabs.push_back (std::move (slab));
+    }
+    catch (const std::bad_alloc&)
+    {
+        releaseSlab (*slab);
+        return nullptr;
+    }
+
+    return slabs.back().get();
+}
+
+void DelayMemoryArena::releaseSlab (Slab& slab) noexcept
+{
+    unmapMemory (slab.memory, slab.size);
+    slab.memory = nullptr;
+}
+
+//==============================================================================
+void* DelayMemoryArena::allocate (size_t numBytes) noexcept
+{
+    const size_t size = roundUp (juce::jmax ((size_t) 1, numBytes), alignment);
+    const juce::ScopedLock sl (lock);
+
+    auto carve = [size] (Slab& slab) -> void*
+    {
+        /*First fit: low offsets fill up first, which keeps blocks allocated together close together*/
+        for (auto it = slab.freeBlocks.begin(); it != slab.freeBlocks.end(); ++it)
+        {
+            if (it->second < size)
+                continue;
+
+            const size_t offset = it->first;
+            const size_t remaining = it->second - size;
+            slab.freeBlocks.erase (it);
+
+            if (remaining > 0)
+                slab.freeBlocks[offset + size] = remaining;
+
+            slab.usedBlocks[offset] = size;
+            return slab.memory + offset;
+        }
+
+        return nullptr;
+    };
+
+    /*The bookkeeping allocates too: running out there is a failure like any other*/
+    try
+    {
+        for (auto& slab : slabs)
+            if (auto* block = carve (*slab))
+                return block;
+
+        if (auto* slab = createSlab (size))
+            return carve (*slab);
+    }
+    catch (const std::bad_alloc&) {}
+
+    return nullptr;
+}
+
+void DelayMemoryArena::deallocate (void* block) noexcept
+{
+    if (block == nullptr)
+        return;
+
+    const juce::ScopedLock sl (lock);
+    auto* address = static_cast<char*> (block);
+
+    for (auto it = slabs.begin(); it != slabs.end(); ++it)
+    {
+        auto& slab = **it;
+
+        if (address < slab.memory || address >= slab.memory + slab.size)
+            continue;
+
+        const size_t offset = (size_t) (address - slab.memory);
+        auto used = slab.usedBlocks.find (offset);
+
+        if (used == slab.usedBlocks.end())
+        {
+            jassertfalse;   // not the start of a block from this arena
+            return;
+        }
+
+        size_t start = offset, size = used->second;
+        slab.usedBlocks.erase (used);
+
+        /*Merge with the free neighbours on both sides*/
+        auto next = slab.freeBlocks.lower_bound (offset);
+
+        if (next != slab.freeBlocks.end() && next->first == offset + size)
+        {
+            size += next->second;
+            next = slab.freeBlocks.erase (next);
+        }
+
+        if (next != slab.freeBlocks.begin())
+        {
+            auto previous = std::prev (next);
+
+            if (previous->first + previous->second == start)
+            {
+                start = previous->first;
+                size += previous->second;
+                slab.freeBlocks.erase (previous);
+            }
+        }
+
+        slab.freeBlocks[start] = size;
+
+        /*Give an empty slab back to the system, keeping one around for the next instance*/
+        if (slab.usedBlocks.empty() && slabs.size() > 1)
+        {
+            releaseSlab (slab);
+            slabs.erase (it);
+        }
+
+        return;
+    }
+
+    jassertfalse;   // not from this arena
+}
+
+//==============================================================================
+DelayMemoryArena::Statistics DelayMemoryArena::getStatistics() const
+{
+    const juce::ScopedLock sl (lock);
+    Statistics statistics;
+    statistics.numSlabs = (int) slabs.size();
+
+    for (auto& slab : slabs)
+    {
+        statistics.reservedBytes += slab->size;
+        statistics.hugePages = statistics.hugePages || slab->hugePages;
+        statistics.numBlocks += (int) slab->usedBlocks.size();
+
+        for (auto& used : slab->usedBlocks)
+            statistics.usedBytes += used.second;
+
+        for (auto& free : slab->freeBlocks)
+            statistics.largestFreeBlock = juce::jmax (statistics.largestFreeBlock, free.second);
+    }
+
+    return statistics;
+}
+
+juce::var DelayMemoryArena::Statistics::toVar() const
+{
+    auto* object = new juce::DynamicObject();
+    object->setProperty ("slabs", numSlabs);
+    object->setProperty ("blocks", numBlocks);
+    object->setProperty ("reservedBytes", (juce::int64) reservedBytes);
+    object->setProperty ("usedBytes", (juce::int64) usedBytes);
+    object->setProperty ("largestFreeBlock", (juce::int64) largestFreeBlock);
+    object->setProperty ("fragmentation", getFragmentation());
+    object->setProperty ("hugePages", hugePages);
+    return juce::var (object);
+}
@@ -0,0 +1,87 @@
+/*
+  ==============================================================================
+
+    DelayMemoryArena.h
+    Created: 19 Oct 2026
+    Author:  GELVS
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+
+//==============================================================================
+/**
+    Process-wide allocator for the delay lines of every FlanGELVS instance.
+
+    Blocks are carved out of large slabs that are mapped and touched once, so
+    loading a session with many instances costs a handful of system calls
+    instead of thousands of page faults spread over the first blocks of audio,
+    and neighbouring instances end up next to each other in memory. Blocks
+    are aligned to cache lines; a slab that becomes empty is returned to the
+    system (except the last one).
+
+    Share it with juce::SharedResourcePointer<DelayMemoryArena>: it lives as
+    long as one instance does. Set FLANGELVS_HUGE_PAGES=1 in the environment
+    to back the slabs with huge pages where the system allows it (Linux).
+
+    Allocating and freeing take a lock: call them from the message thread or
+    a background thread, never from the audio thread.
+*/
+class DelayMemoryArena
+{
+public:
+    DelayMemoryArena();
+    ~DelayMemoryArena();
+
+    static constexpr size_t alignment = 64;
+    static constexpr size_t slabSize = 2 * 1024 * 1024;
+
+    /* At least 'numBytes' bytes aligned to 'alignment', not cleared; nullptr on failure
+       (never throws, so that the background thread can simply try again later) */
+    void* allocate (size_t numBytes) noexcept;
+    void deallocate (void* block) noexcept;
+
+    struct Statistics
+    {
+        int numSlabs = 0;
+        int numBlocks = 0;
+        size_t reservedBytes = 0;
+        size_t usedBytes = 0;
+        size_t largestFreeBlock = 0;
+        bool hugePages = false;
+
+        size_t getFreeBytes() const noexcept   { return reservedBytes - usedBytes; }
+
+        /* 0 when all the free space is one block, towards 1 when it is scattered in small pieces */
+        double getFragmentation() const noexcept
+        {
+            return getFreeBytes() > 0 ? 1.0 - (double) largestFreeBlock / (double) getFreeBytes() : 0.0;
+        }
+
+        juce::var toVar() const;
+    };
+
+    Statistics getStatistics() const;
+
+private:
+    struct Slab
+    {
+        char* memory = nullptr;
+        size_t size = 0;
+        bool hugePages = false;
+        std::map<size_t, size_t> freeBlocks;   // offset -> size, never adjacent
+        std::map<size_t, size_t> usedBlocks;   // offset -> size
+    };
+
+    Slab* createSlab (size_t minimumSize);
+    void releaseSlab (Slab&) noexcept;
+
+    juce::CriticalSection lock;
+    std::vector<std::unique_ptr<Slab>> slabs;
+    const bool wantHugePages;
+
+    JUCE_DECLARE_NON_COPYABLE (DelayMemoryArena)
+};
@@ -0,0 +1,88 @@
+/*
+  ==============================================================================
+
+    DelayTrajectoryCache.cpp
+    Created: 19 Oct 2026
+    Author:  GELVS
+
+  ==============================================================================
+*/
+
+#include "DelayTrajectoryCache.h"
+
+void DelayTrajectoryCache::prepare (double newSampleRate, float rate)
+{
+    sampleRate = newSampleRate;
+
+    /*Faster rates fit in the same table; the slowest one would need 1 MB in every instance*/
+    const double cycle = std::ceil (sampleRate / juce::jmax (1.0e-3, (double) rate)) + 1.0;
+    entries.assign ((size_t) juce::jmin ((double) maximumCycleLength, cycle), Entry { 0, 0.0f });
+
+    invalidate();
+}
+
+void DelayTrajectoryCache::invalidate() noexcept
+{
+    mode = Mode::computing;
+    steadySamples = 0;
+}
+
+DelayTrajectoryCache::Mode DelayTrajectoryCache::beginRun (const Settings& newSettings, double phase,
+                                                           double phaseIncrement, int numSamples) noexcept
+{
+    if (! (newSettings == settings))
+    {
+        settings = newSettings;
+        invalidate();
+    }
+
+    switch (mode)
+    {
+        case Mode::computing:
+        {
+            if (steadySamples < settleSamples)
+            {
+                steadySamples += numSamples;
+                break;
+            }
+
+            /*Cycles longer than the table (slow rates) keep being computed*/
+            const int cycleLength = juce::roundToInt (1.0 / phaseIncrement);
+
+            if (cycleLength >= numSamples && cycleLength <= (int) entries.size())
+            {
+                mode = Mode::recording;
+                length = cycleLength;
+                position = 0;
+                startPhase = phase;
+            }
+
+            break;
+        }
+
+        case Mode::playing:
+        {
+            /*Entry n was recorded at startPhase + n * phaseIncrement: pick the nearest one*/
+            double cycles = phase - startPhase;
+            cycles -= std::floor (cycles);
+            position = (int) (cycles / phaseIncrement + 0.5);
+
+            if (position >= length)
+                position -= length;
+
+            break;
+        }
+
+        case Mode::recording:
+        default:
+            break;
+    }
+
+    return mode;
+}
+
+void DelayTrajectoryCache::endRun() noexcept
+{
+    if (mode == Mode::recording && position >= length)
+        mode = Mode::playing;
+}
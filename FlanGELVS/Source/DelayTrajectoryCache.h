@@ -0,0 +1,112 @@
+/*
+  ==============================================================================
+
+    DelayTrajectoryCache.h
+    Created: 19 Oct 2026
+    Author:  GELVS
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+
+//==============================================================================
+/**
+    One recorded LFO cycle of delay-line read positions.
+
+    While rate, amplitude, depth, phase offset and delay range hold still, the
+    smoothed delay time is periodic. Once the smoother has settled, the
+    processor records one cycle of read positions, already split into a whole
+    number of samples behind the write head and an interpolation weight, and
+    then plays them back instead of computing the LFO, the smoothing and the
+    read position every sample. Any change to those settings sends it back to
+    computing, from the next run of samples.
+
+    Playback is re-aligned with the LFO phase at the start of every run, so the
+    cycle being a whole number of samples does not make the LFO drift.
+
+    The table is allocated by prepare(), for one cycle at the rate in effect
+    then; the audio thread never allocates, so rates slowed down to a longer
+    cycle afterwards are computed until the next prepare().
+*/
+class DelayTrajectoryCache
+{
+public:
+    /* Interpolated read between (writeHead - readOffset) and the sample after it */
+    struct Entry
+    {
+        int readOffset;
+        float readWeight;
+    };
+
+    /* Everything the trajectory depends on */
+    struct Settings
+    {
+        float rate, amplitude, depth, phaseOffset;
+        int delayRange;
+        int controlRateShift;
+
+        bool operator== (const Settings& other) const noexcept
+        {
+            return rate == other.rate && amplitude == other.amplitude && depth == other.depth
+                && phaseOffset == other.phaseOffset && delayRange == other.delayRange
+                && controlRateShift == other.controlRateShift;
+        }
+    };
+
+    enum class Mode
+    {
+        computing,    // the processor computes every position
+        recording,    // ... and stores them with record()
+        playing       // the processor reads them with next()
+    };
+
+    /* Longest cycle recorded; 8 bytes per sample, so 1 MB at most per instance */
+    static constexpr int maximumCycleLength = 1 << 17;
+
+    /* The delay smoother (0.999 per sample) is within 1e-7 of its periodic path after this */
+    static constexpr int settleSamples = 16384;
+
+    /* Message thread: room for one cycle at 'rate' Hz, capped at maximumCycleLength */
+    void prepare (double sampleRate, float rate);
+
+    /* Audio thread: forget the table and settle again, e.g. when the LFO phase is moved */
+    void invalidate() noexcept;
+
+    /* Audio thread, before each run of samples starting at LFO 'phase' (in cycles) */
+    Mode beginRun (const Settings&, double phase, double phaseIncrement, int numSamples) noexcept;
+
+    /* Audio thread, per sample of a recording or playing run */
+    void record (Entry entry) noexcept
+    {
+        if (position < length)
+            entries[(size_t) position] = entry;
+
+        ++position;
+    }
+
+    Entry next() noexcept
+    {
+        const auto entry = entries[(size_t) position];
+        position = position + 1 < length ? position + 1 : 0;
+        return entry;
+    }
+
+    /* Audio thread, after each run: a completed recording starts playing */
+    void endRun() noexcept;
+
+    Mode getMode() const noexcept   { return mode; }
+
+private:
+    std::vector<Entry> entries;
+    double sampleRate = 44100.0;
+
+    Mode mode = Mode::computing;
+    Settings settings {};
+    int steadySamples = 0;
+    int length = 0;
+    int position = 0;
+    double startPhase = 0.0;
+};
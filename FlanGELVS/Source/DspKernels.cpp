@@ -0,0 +1,188 @@
+/*
+  ==============================================================================
+
+    DspKernels.cpp
+    Created: 19 Oct 2026
+    Author:  GELVS
+
+  ==============================================================================
+*/
+
+#include "DspKernels.h"
+#include "FastMath.h"
+
+/* Multiply-adds must stay separate in every variant, so that they all round alike: AVX2 and
+   AVX-512 come with FMA, which would otherwise be used for FastMath's polynomials as well.
+   The exporters compile this file alone with -ffp-contract=off (its "noFpContract" compiler
+   flag scheme); MSVC does not contract unless asked to */
+
+/* Per-function target attributes are a GCC/Clang feature. MSVC and ARM builds only have
+   the generic kernels, which their baseline (SSE2 on x64, NEON on 64-bit ARM) vectorises */
+#if JUCE_INTEL && (JUCE_GCC || JUCE_CLANG)
+ #define FLANGELVS_X86_KERNELS 1
+#else
+ #define FLANGELVS_X86_KERNELS 0
+#endif
+
+namespace DspKernels
+{
+    namespace
+    {
+        /*The bodies are written once and inlined into one function per instruction set,
+          where the compiler vectorises them for that target*/
+        forcedinline void computeModulationBody (const ModulationParameters& parameters, float* lfo, float* delay, int numSamples) noexcept
+        {
+            /*Copied, as the stores below could otherwise alias them*/
+            const double phase = parameters.phase;
+            const double phaseIncrement = parameters.phaseIncrement;
+            const float gain = parameters.gain;
+            const float phaseOffset = parameters.phaseOffset;
+            const float mapOffset = parameters.delayMapOffset;
+            const float mapScale = parameters.delayMapScale;
+
+            for (int i = 0; i < numSamples; ++i)
+            {
+                const float cycles = (float) (phase + (double) i * phaseIncrement);
+                const float value = gain * FastMath::sin (juce::MathConstants<float>::twoPi * cycles + phaseOffset);
+                lfo[i] = value;
+                delay[i] = mapOffset + mapScale * value;
+            }
+        }
+
+        forcedinline void mixDryWetBody (float* dry, const float* wet, float mix, int numSamples) noexcept
+        {
+            const float dryGain = 1.0f - mix;
+
+            for (int i = 0; i < numSamples; ++i)
+                dry[i] = dry[i] * dryGain + wet[i] * mix;
+        }
+
+       #define FLANGELVS_DEFINE_KERNELS(suffix, targetAttribute) \
+        targetAttribute void computeModulation_##suffix (const ModulationParameters& parameters, float* lfo, float* delay, int numSamples) \
+        { \
+            computeModulationBody (parameters, lfo, delay, numSamples); \
+        } \
+        \
+        targetAttribute void mixDryWet_##suffix (float* dry, const float* wet, float mix, int numSamples) \
+        { \
+            mixDryWetBody (dry, wet, mix, numSamples); \
+        } \
+        \
+        const Table table_##suffix { computeModulation_##suffix, mixDryWet_##suffix, Variant::suffix };
+
+        FLANGELVS_DEFINE_KERNELS (generic, )
+
+       #if FLANGELVS_X86_KERNELS
+        FLANGELVS_DEFINE_KERNELS (avx, __attribute__ ((target ("avx"))))
+        FLANGELVS_DEFINE_KERNELS (avx2, __attribute__ ((target ("avx2"))))
+        FLANGELVS_DEFINE_KERNELS (avx512, __attribute__ ((target ("avx512f,avx512vl,avx2"))))
+       #endif
+
+       #undef FLANGELVS_DEFINE_KERNELS
+
+        std::atomic<Variant> forcedVariant { Variant::automatic };
+        std::atomic<bool> environmentRead { false };
+
+        /*The environment is consulted once, unless setForcedVariant() was called first*/
+        Variant getForcedVariant()
+        {
+            if (! environmentRead.exchange (true))
+            {
+                const auto name = juce::SystemStats::getEnvironmentVariable ("FLANGELVS_DSP_KERNELS", {});
+                auto expected = Variant::automatic;
+
+                if (name.isNotEmpty())
+                    forcedVariant.compare_exchange_strong (expected, getVariantFromName (name));
+            }
+
+            return forcedVariant.load();
+        }
+    }
+
+    //==============================================================================
+    bool isSupported (Variant variant) noexcept
+    {
+        switch (variant)
+        {
+            case Variant::automatic:
+            case Variant::generic:  return true;
+           #if FLANGELVS_X86_KERNELS
+            case Variant::avx:      return juce::SystemStats::hasAVX();
+            case Variant::avx2:     return juce::SystemStats::hasAVX2();
+            case Variant::avx512:   return juce::SystemStats::hasAVX512F() && juce::SystemStats::hasAVX512VL() && juce::SystemStats::hasAVX2();
+           #endif
+            default:                return false;
+        }
+    }
+
+    Variant chooseVariant()
+    {
+        const auto forced = getForcedVariant();
+
+        if (forced != Variant::automatic && isSupported (forced))
+            return forced;
+
+        /*Nothing forced, or forced to something this build or CPU cannot run*/
+        for (auto variant : { Variant::avx512, Variant::avx2, Variant::avx })
+            if (isSupported (variant))
+                return variant;
+
+        return Variant::generic;
+    }
+
+    const Table& getTable (Variant variant)
+    {
+        if (variant == Variant::automatic || ! isSupported (variant))
+            variant = chooseVariant();
+
+        switch (variant)
+        {
+           #if FLANGELVS_X86_KERNELS
+            case Variant::avx:      return table_avx;
+            case Variant::avx2:     return table_avx2;
+            case Variant::avx512:   return table_avx512;
+           #endif
+            default:                return table_generic;
+        }
+    }
+
+    void setForcedVariant (Variant variant)
+    {
+        environmentRead = true;
+        forcedVariant = variant;
+    }
+
+    juce::StringArray getSupportedVariantNames()
+    {
+        juce::StringArray names;
+
+        for (auto variant : { Variant::generic, Variant::avx, Variant::avx2, Variant::avx512 })
+            if (isSupported (variant))
+                names.add (getName (variant));
+
+        return names;
+    }
+
+    //==============================================================================
+    const char* getName (Variant variant) noexcept
+    {
+        switch (variant)
+        {
+            case Variant::generic:  return "generic";
+            case Variant::avx:      return "avx";
+            case Variant::avx2:     return "avx2";
+            case Variant::avx512:   return "avx512";
+            case Variant::automatic:
+            default:                return "automatic";
+        }
+    }
+
+    Variant getVariantFromName (const juce::String& name) noexcept
+    {
+        for (auto variant : { Variant::generic, Variant::avx, Variant::avx2, Variant::avx512 })
+            if (name.trim().equalsIgnoreCase (getName (variant)))
+                return variant;
+
+        return Variant::automatic;
+    }
+}
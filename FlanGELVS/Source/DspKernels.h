@@ -0,0 +1,83 @@
+/*
+  ==============================================================================
+
+    DspKernels.h
+    Created: 19 Oct 2026
+    Author:  GELVS
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+
+//==============================================================================
+/**
+    The data-parallel parts of the flanger, compiled once per instruction set.
+
+    The feedback loop itself is a per-sample recurrence and stays scalar; what
+    is around it - the LFO and delay-time mapping, and the dry/wet mix - runs
+    through these kernels. GCC and Clang builds for x86 contain AVX, AVX2 and
+    AVX-512 variants on top of the generic kernels (which are SSE2, the x64
+    baseline), and the processor picks one per prepareToPlay from what the CPU
+    supports. Other builds (MSVC, ARM) only have the generic kernels,
+    vectorised for the compiler's baseline: SSE2 on x64, NEON on 64-bit ARM.
+
+    All variants give bit-identical results: they differ only in vector width
+    (FMA contraction is not enabled), so renders can be compared across machines.
+
+    For testing, a variant can be forced with setForcedVariant() or with the
+    FLANGELVS_DSP_KERNELS environment variable ("generic", "avx", "avx2" or
+    "avx512"); an unsupported choice falls back to the best one.
+*/
+namespace DspKernels
+{
+    enum class Variant
+    {
+        automatic,
+        generic,
+        avx,
+        avx2,
+        avx512
+    };
+
+    /* LFO and delay-time mapping for one run of samples */
+    struct ModulationParameters
+    {
+        double phase;             // LFO phase of the first sample, in cycles
+        double phaseIncrement;    // cycles per sample
+        float gain;               // amplitude * depth
+        float phaseOffset;        // radians
+        float delayMapOffset;     // seconds at LFO 0
+        float delayMapScale;      // seconds per unit of LFO
+    };
+
+    struct Table
+    {
+        /* lfo[i] = gain * sin (2 pi (phase + i * phaseIncrement) + phaseOffset),
+           delay[i] = delayMapOffset + delayMapScale * lfo[i] */
+        void (*computeModulation) (const ModulationParameters&, float* lfo, float* delay, int numSamples);
+
+        /* dry[i] = dry[i] * (1 - mix) + wet[i] * mix */
+        void (*mixDryWet) (float* dry, const float* wet, float mix, int numSamples);
+
+        Variant variant;
+    };
+
+    /* Kernels for 'variant', or the fastest supported ones for Variant::automatic */
+    const Table& getTable (Variant variant);
+
+    /* What Variant::automatic resolves to: a forced variant if there is one (and it
+       is supported), otherwise the fastest this CPU can run */
+    Variant chooseVariant();
+
+    bool isSupported (Variant) noexcept;
+    juce::StringArray getSupportedVariantNames();
+
+    /* Applies to the next getTable (Variant::automatic), i.e. the next prepareToPlay */
+    void setForcedVariant (Variant);
+
+    const char* getName (Variant) noexcept;
+    Variant getVariantFromName (const juce::String&) noexcept;
+}
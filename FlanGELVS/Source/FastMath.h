@@ -0,0 +1,181 @@
+/*
+  ==============================================================================
+
+    FastMath.h
+    Created: 19 Oct 2026
+    Author:  GELVS
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+
+/* Accuracy used when no tier is given: 0 = fast, 1 = balanced, 2 = accurate */
+#ifndef FLANGELVS_FASTMATH_TIER
+ #define FLANGELVS_FASTMATH_TIER 1
+#endif
+
+//==============================================================================
+/**
+    Branch-free float approximations for the per-sample paths.
+
+    Every function comes in three tiers; worst-case errors measured against libm
+    (run FlanGELVSBenchmarks --fastmath for the full table):
+
+                     fast          balanced      accurate
+        sin, cos     7e-5 abs      2e-6 abs      2e-7 abs      (|x| < 12)
+        exp2         8e-5 rel      3e-6 rel      1e-7 rel
+        tanh         4e-5 abs      2e-6 abs      2e-7 abs
+        reciprocal   7e-6 rel      2e-7 rel      exact division
+
+    There are no branches or table lookups, so loops calling these vectorise.
+    sin and cos lose precision for very large arguments (beyond a few thousand
+    cycles), exp2 clamps its argument to [-126, 127] and reciprocal expects a
+    finite, non-zero, normal argument.
+*/
+namespace FastMath
+{
+    enum class Tier
+    {
+        fast,
+        balanced,
+        accurate
+    };
+
+    constexpr Tier defaultTier = (Tier) FLANGELVS_FASTMATH_TIER;
+
+    namespace detail
+    {
+        inline float fromBits (juce::int32 bits) noexcept
+        {
+            float f;
+            std::memcpy (&f, &bits, sizeof (f));
+            return f;
+        }
+
+        inline juce::int32 toBits (float f) noexcept
+        {
+            juce::int32 bits;
+            std::memcpy (&bits, &f, sizeof (bits));
+            return bits;
+        }
+
+        /* radians / 2 pi + offset, reduced to [-0.5, 0.5]; the float product limits the fast
+           and balanced tiers to about 2e-6 for arguments of a few cycles, so the accurate
+           tier reduces in double precision.
+           The nearest integer comes from adding and subtracting 1.5 * 2^mantissaBits, which
+           GCC vectorises where std::floor is not (without -fno-trapping-math); it relies on
+           the compiler not reassociating floating point, i.e. no -ffast-math */
+        template <Tier tier>
+        inline float toCycles (float radians, double offsetInCycles) noexcept
+        {
+            if (tier == Tier::accurate)
+            {
+                const double t = radians * (1.0 / juce::MathConstants<double>::twoPi) + offsetInCycles;
+                return (float) (t - ((t + 6755399441055744.0) - 6755399441055744.0));
+            }
+
+            const float t = radians * (1.0f / juce::MathConstants<float>::twoPi) + (float) offsetInCycles;
+            return t - ((t + 12582912.0f) - 12582912.0f);
+        }
+
+        /* sin(2 pi t) for t in [-0.5, 0.5] cycles */
+        template <Tier tier>
+        inline float sinCycles (float t) noexcept
+        {
+            /*Fold onto [-0.25, 0.25], where the polynomial is fitted (a min rather than a
+              branch, so that loops still vectorise)*/
+            const float magnitude = std::abs (t);
+            t = std::copysign (juce::jmin (magnitude, 0.5f - magnitude), t);
+
+            const float t2 = t * t;
+
+            switch (tier)
+            {
+                case Tier::fast:
+                    return t * (6.2812801378f + t2 * (-41.095244251f + t2 * 73.585512886f));
+
+                case Tier::balanced:
+                    return t * (6.2831640456f + t2 * (-41.337142466f + t2 * (81.340770623f + t2 * -70.993439627f)));
+
+                case Tier::accurate:
+                default:
+                    return t * (6.2831851602f + t2 * (-41.341655054f + t2 * (81.601005325f
+                              + t2 * (-76.549808372f + t2 * 39.536887848f))));
+            }
+        }
+    }
+
+    //==============================================================================
+    template <Tier tier = defaultTier>
+    inline float sin (float radians) noexcept
+    {
+        return detail::sinCycles<tier> (detail::toCycles<tier> (radians, 0.0));
+    }
+
+    template <Tier tier = defaultTier>
+    inline float cos (float radians) noexcept
+    {
+        return detail::sinCycles<tier> (detail::toCycles<tier> (radians, 0.25));
+    }
+
+    template <Tier tier = defaultTier>
+    inline float exp2 (float x) noexcept
+    {
+        x = juce::jlimit (-126.0f, 127.0f, x);
+
+        const float integer = std::floor (x);
+        const float f = x - integer;
+        float mantissa;
+
+        switch (tier)
+        {
+            case Tier::fast:
+                mantissa = 0.99992523317f + f * (0.69583341633f + f * (0.22606737806f + f * 0.078024425067f));
+                break;
+
+            case Tier::balanced:
+                mantissa = 1.0000025928f + f * (0.69300384311f + f * (0.24144272762f + f * (0.052011494043f + f * 0.013534156537f)));
+                break;
+
+            case Tier::accurate:
+            default:
+                mantissa = 1.0000000019f + f * (0.69314698413f + f * (0.24022983259f + f * (0.055483358625f
+                         + f * (0.0096788074977f + f * (0.0012439995484f + f * 0.00021701203441f)))));
+                break;
+        }
+
+        return mantissa * detail::fromBits (((juce::int32) integer + 127) << 23);
+    }
+
+    template <Tier tier = defaultTier>
+    inline float reciprocal (float x) noexcept
+    {
+        if (tier == Tier::accurate)
+            return 1.0f / x;
+
+        /*Initial guess from the bits of the float, then Newton-Raphson steps, each of
+          which squares the relative error*/
+        const float magnitude = std::abs (x);
+        float y = detail::fromBits (0x7ef311c3 - detail::toBits (magnitude));
+
+        y = y * (2.0f - magnitude * y);
+        y = y * (2.0f - magnitude * y);
+
+        if (tier == Tier::balanced)
+            y = y * (2.0f - magnitude * y);
+
+        return std::copysign (y, x);
+    }
+
+    template <Tier tier = defaultTier>
+    inline float tanh (float x) noexcept
+    {
+        /*tanh (x) = (e^2x - 1) / (e^2x + 1) with e^2x = 2^(2 log2(e) x); beyond |x| = 9 it is 1 to float precision*/
+        x = juce::jlimit (-9.0f, 9.0f, x);
+        const float e = FastMath::exp2<tier> (x * 2.8853900818f);
+        return (e - 1.0f) * FastMath::reciprocal<tier> (e + 1.0f);
+    }
+}
@@ -0,0 +1,130 @@
+/*
+  ==============================================================================
+
+    FlanGELVSLookAndFeel.cpp
+    Created: 19 Oct 2026
+    Author:  GELVS
+
+  ==============================================================================
+*/
+
+#include "FlanGELVSLookAndFeel.h"
+
+//==============================================================================
+juce::Image KnobFilmstripCache::getFilmstrip (int physicalSize, const Colours& colours, float startAngle, float endAngle)
+{
+    jassert (physicalSize <= maxFrameSize);
+
+    /*Round sizes up to a multiple of 16 pixels so a resize drag only ever
+      renders a handful of strips; the blit scales the rest down*/
+    const int frameSize = juce::jlimit (16, maxFrameSize, (physicalSize + 15) & ~15);
+
+    for (auto it = entries.begin(); it != entries.end(); ++it)
+    {
+        if (it->frameSize == frameSize && it->colours == colours
+             && it->startAngle == startAngle && it->endAngle == endAngle)
+        {
+            std::rotate (entries.begin(), it, it + 1);
+            return entries.front().filmstrip;
+        }
+    }
+
+    entries.insert (entries.begin(), { frameSize, colours, startAngle, endAngle,
+                                       renderFilmstrip (frameSize, colours, startAngle, endAngle) });
+
+    if (entries.size() > maxEntries)
+        entries.pop_back();
+
+    return entries.front().filmstrip;
+}
+
+juce::Image KnobFilmstripCache::renderFilmstrip (int frameSize, const Colours& colours, float startAngle, float endAngle)
+{
+    juce::Image filmstrip (juce::Image::ARGB, frameSize, frameSize * numFrames, true);
+    juce::Graphics g (filmstrip);
+
+    for (int frame = 0; frame < numFrames; ++frame)
+    {
+        const auto bounds = juce::Rectangle<int> (0, frame * frameSize, frameSize, frameSize).toFloat();
+        drawKnob (g, bounds, (float) frame / (float) (numFrames - 1), colours, startAngle, endAngle);
+    }
+
+    return filmstrip;
+}
+
+void KnobFilmstripCache::drawKnob (juce::Graphics& g, juce::Rectangle<float> bounds, float proportion,
+                                   const Colours& colours, float startAngle, float endAngle)
+{
+    /*Same geometry as LookAndFeel_V4's rotary slider*/
+    bounds = bounds.reduced (bounds.getWidth() / 12.0f);
+
+    const float radius = juce::jmin (bounds.getWidth(), bounds.getHeight()) / 2.0f;
+    const float toAngle = startAngle + proportion * (endAngle - startAngle);
+    const float lineWidth = juce::jmin (8.0f, radius * 0.5f);
+    const float arcRadius = radius - lineWidth * 0.5f;
+
+    juce::Path backgroundArc;
+    backgroundArc.addCentredArc (bounds.getCentreX(), bounds.getCentreY(), arcRadius, arcRadius,
+                                 0.0f, startAngle, endAngle, true);
+
+    g.setColour (colours.outline);
+    g.strokePath (backgroundArc, juce::PathStrokeType (lineWidth, juce::PathStrokeType::curved, juce::PathStrokeType::rounded));
+
+    if (proportion > 0)
+    {
+        juce::Path valueArc;
+        valueArc.addCentredArc (bounds.getCentreX(), bounds.getCentreY(), arcRadius, arcRadius,
+                                0.0f, startAngle, toAngle, true);
+
+        g.setColour (colours.fill);
+        g.strokePath (valueArc, juce::PathStrokeType (lineWidth, juce::PathStrokeType::curved, juce::PathStrokeType::rounded));
+    }
+
+    const float thumbWidth = lineWidth * 2.0f;
+    const juce::Point<float> thumbPoint (bounds.getCentreX() + arcRadius * std::cos (toAngle - juce::MathConstants<float>::halfPi),
+                                         bounds.getCentreY() + arcRadius * std::sin (toAngle - juce::MathConstants<float>::halfPi));
+
+    g.setColour (colours.thumb);
+    g.fillEllipse (juce::Rectangle<float> (thumbWidth, thumbWidth).withCentre (thumbPoint));
+}
+
+//==============================================================================
+FlanGELVSLookAndFeel::FlanGELVSLookAndFeel()
+{
+    setColour (juce::Slider::thumbColourId, juce::Colours::darkblue);                               //Pointer colour
+    setColour (juce::Slider::rotarySliderFillColourId, juce::Colour::fromRGBA (233, 231, 119, 255));  //SliderFill colour
+    setColour (juce::Slider::rotarySliderOutlineColourId, juce::Colours::lightcyan);                //SliderOutline colour
+}
+
+void FlanGELVSLookAndFeel::drawRotarySlider (juce::Graphics& g, int x, int y, int width, int height, float sliderPos,
+                                             float rotaryStartAngle, float rotaryEndAngle, juce::Slider& slider)
+{
+    const int size = juce::jmin (width, height);
+
+    if (size <= 0)
+        return;
+
+    const KnobFilmstripCache::Colours colours { slider.findColour (juce::Slider::rotarySliderOutlineColourId),
+                                                slider.findColour (juce::Slider::rotarySliderFillColourId),
+                                                slider.findColour (juce::Slider::thumbColourId) };
+
+    const float scale = g.getInternalContext().getPhysicalPixelScaleFactor();
+    const int physicalSize = juce::roundToInt ((float) size * scale);
+    const auto dest = juce::Rectangle<int> (size, size).withCentre (juce::Rectangle<int> (x, y, width, height).getCentre());
+
+    /*Past the largest strip, upscaling would blur the knob: draw it at full resolution instead*/
+    if (physicalSize > KnobFilmstripCache::maxFrameSize)
+    {
+        KnobFilmstripCache::drawKnob (g, dest.toFloat(), sliderPos, colours, rotaryStartAngle, rotaryEndAngle);
+        return;
+    }
+
+    auto filmstrip = filmstripCache->getFilmstrip (physicalSize, colours, rotaryStartAngle, rotaryEndAngle);
+
+    const int frameSize = filmstrip.getWidth();
+    const int frame = juce::jlimit (0, KnobFilmstripCache::numFrames - 1,
+                                    juce::roundToInt (sliderPos * (float) (KnobFilmstripCache::numFrames - 1)));
+
+    g.drawImage (filmstrip, dest.getX(), dest.getY(), dest.getWidth(), dest.getHeight(),
+                 0, frame * frameSize, frameSize, frameSize);
+}
@@ -0,0 +1,82 @@
+/*
+  ==============================================================================
+
+    FlanGELVSLookAndFeel.h
+    Created: 19 Oct 2026
+    Author:  GELVS
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+
+//==============================================================================
+/**
+    Knob filmstrips shared by every FlanGELVS editor in the process.
+
+    Each strip holds 'numFrames' pre-rendered knob positions stacked vertically,
+    rendered once per (quantised) physical knob size, colour set and angle range.
+    Only the few most recently used strips are kept so resizing the editor cannot
+    grow the cache unbounded, and knobs larger than 'maxFrameSize' physical pixels
+    are drawn directly rather than upscaled from a smaller strip.
+*/
+class KnobFilmstripCache
+{
+public:
+    static constexpr int numFrames = 64;
+    static constexpr int maxFrameSize = 256;
+
+    struct Colours
+    {
+        juce::Colour outline, fill, thumb;
+
+        bool operator== (const Colours& other) const noexcept
+        {
+            return outline == other.outline && fill == other.fill && thumb == other.thumb;
+        }
+    };
+
+    /* Returns the strip whose frames are at least 'physicalSize' pixels square
+       ('physicalSize' must not be above maxFrameSize) */
+    juce::Image getFilmstrip (int physicalSize, const Colours& colours, float startAngle, float endAngle);
+
+    static void drawKnob (juce::Graphics& g, juce::Rectangle<float> bounds, float proportion,
+                          const Colours& colours, float startAngle, float endAngle);
+
+private:
+    struct Entry
+    {
+        int frameSize;
+        Colours colours;
+        float startAngle, endAngle;
+        juce::Image filmstrip;
+    };
+
+    static constexpr size_t maxEntries = 6;
+
+    static juce::Image renderFilmstrip (int frameSize, const Colours& colours, float startAngle, float endAngle);
+
+    std::vector<Entry> entries;   // most recently used first
+};
+
+//==============================================================================
+/**
+    LookAndFeel owned by the editor, so the colours set here never leak into the
+    default LookAndFeel shared with other plugin windows in the same host.
+    Rotary sliders are drawn with a single blit from the shared filmstrip.
+*/
+class FlanGELVSLookAndFeel  : public juce::LookAndFeel_V4
+{
+public:
+    FlanGELVSLookAndFeel();
+
+    void drawRotarySlider (juce::Graphics&, int x, int y, int width, int height, float sliderPosProportional,
+                           float rotaryStartAngle, float rotaryEndAngle, juce::Slider&) override;
+
+private:
+    juce::SharedResourcePointer<KnobFilmstripCache> filmstripCache;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (FlanGELVSLookAndFeel)
+};
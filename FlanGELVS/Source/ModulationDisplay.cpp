@@ -0,0 +1,92 @@
+/*
+  ==============================================================================
+
+    ModulationDisplay.cpp
+    Created: 19 Oct 2026
+    Author:  GELVS
+
+  ==============================================================================
+*/
+
+#include "ModulationDisplay.h"
+
+//==============================================================================
+ModulationDisplay::ModulationDisplay (FlanGELVSAudioProcessor& p)
+    : audioProcessor (p), history ((size_t) historySize), scratch ((size_t) historySize)
+{
+    setOpaque (false);
+    setInterceptsMouseClicks (false, false);
+
+    /*Frames queued while no editor was open are stale*/
+    audioProcessor.getTelemetry().discardAll();
+    startTimerHz (60);
+}
+
+ModulationDisplay::~ModulationDisplay()
+{
+    stopTimer();
+}
+
+//==============================================================================
+void ModulationDisplay::timerCallback()
+{
+    /*Drain everything the audio thread produced since the last frame*/
+    int numRead;
+
+    while ((numRead = audioProcessor.getTelemetry().pop (scratch.data(), historySize)) > 0)
+    {
+        for (int i = 0; i < numRead; ++i)
+        {
+            history[(size_t) historyWriteIndex] = scratch[(size_t) i];
+            historyWriteIndex = (historyWriteIndex + 1) % historySize;
+        }
+    }
+
+    repaint();
+}
+
+template <typename ValueFunction>
+void ModulationDisplay::buildTrace (juce::Path& path, juce::Rectangle<float> area, ValueFunction value) const
+{
+    /*Oldest frame on the left, newest on the right; 'value' returns 0..1*/
+    for (int i = 0; i < historySize; ++i)
+    {
+        const auto& frame = history[(size_t) ((historyWriteIndex + i) % historySize)];
+        const float x = area.getX() + area.getWidth() * (float) i / (float) (historySize - 1);
+        const float y = area.getBottom() - area.getHeight() * juce::jlimit (0.0f, 1.0f, value (frame));
+
+        if (i == 0)
+            path.startNewSubPath (x, y);
+        else
+            path.lineTo (x, y);
+    }
+}
+
+void ModulationDisplay::paint (juce::Graphics& g)
+{
+    auto area = getLocalBounds().toFloat();
+
+    g.setColour (juce::Colours::black.withAlpha (0.5f));
+    g.fillRoundedRectangle (area, 4.0f);
+
+    area = area.reduced (4.0f);
+
+    /*The delay trace is scaled to the largest delay the LFO mapping can reach*/
+    const float maxDelayInSamples = juce::jmax (1.0f, (float) audioProcessor.getSampleRate() * audioProcessor.getSelectedDelayRange().maximumSeconds);
+
+    juce::Path lfoTrace, delayTrace, feedbackTrace;
+    buildTrace (lfoTrace, area, [] (const TelemetryFrame& f) { return 0.5f + f.lfo / 6.0f; });
+    buildTrace (delayTrace, area, [maxDelayInSamples] (const TelemetryFrame& f) { return f.delayTimeInSamples / maxDelayInSamples; });
+    buildTrace (feedbackTrace, area, [] (const TelemetryFrame& f) { return f.feedbackLevel; });
+
+    g.setColour (juce::Colours::lightcyan);
+    g.strokePath (lfoTrace, juce::PathStrokeType (1.0f));
+    g.setColour (juce::Colour::fromRGBA (233, 231, 119, 255));
+    g.strokePath (delayTrace, juce::PathStrokeType (1.5f));
+    g.setColour (juce::Colours::orangered);
+    g.strokePath (feedbackTrace, juce::PathStrokeType (1.0f));
+
+    g.setFont (10.0f);
+    g.setColour (juce::Colours::white);
+    g.drawText ("LFO / Delay / Feedback", getLocalBounds().reduced (6, 2), juce::Justification::topLeft);
+}
@@ -0,0 +1,48 @@
+/*
+  ==============================================================================
+
+    ModulationDisplay.h
+    Created: 19 Oct 2026
+    Author:  GELVS
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+#include "PluginProcessor.h"
+
+//==============================================================================
+/**
+    Scrolling plot of the LFO, the delay time and the feedback level.
+
+    A timer drains the processor's TelemetryFifo at display rate into a history
+    ring that is allocated once, so neither side of the FIFO allocates while the
+    editor is open.
+*/
+class ModulationDisplay  : public juce::Component,
+                           private juce::Timer
+{
+public:
+    explicit ModulationDisplay (FlanGELVSAudioProcessor&);
+    ~ModulationDisplay() override;
+
+    void paint (juce::Graphics&) override;
+
+private:
+    void timerCallback() override;
+
+    /* Adds one trace to 'path', reading 'value' out of each frame of the history */
+    template <typename ValueFunction>
+    void buildTrace (juce::Path& path, juce::Rectangle<float> area, ValueFunction value) const;
+
+    FlanGELVSAudioProcessor& audioProcessor;
+
+    static constexpr int historySize = 512;
+    std::vector<TelemetryFrame> history;
+    std::vector<TelemetryFrame> scratch;
+    int historyWriteIndex = 0;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (ModulationDisplay)
+};
@@ -11,165 +11,189 @@
 
 //==============================================================================
 FlanGELVSAudioProcessorEditor::FlanGELVSAudioProcessorEditor (FlanGELVSAudioProcessor& p)
-    : AudioProcessorEditor (&p), audioProcessor (p)
+    : AudioProcessorEditor (&p), audioProcessor (p), modulationDisplay (p)
 {
     // BACKGROUND 
-    backgroundImage = juce::ImageCache::getFromMemory(BinaryData::background_png, BinaryData::background_pngSize);
-    backgroundImage = backgroundImage.rescaled(500, 400);
+    /* The PNG is decoded and resampled on the cache's own thread: until it is ready,
+       paint() shows a plain placeholder instead of blocking the editor from opening */
+    backgroundCache = std::make_unique<BackgroundImageCache>(BinaryData::background_png, BinaryData::background_pngSize,
+                                                             [this] { backgroundReady(); });
     //
 
     // Make sure that before the constructor has finished, you've set the
     // editor's size to whatever you need it to be.
 
-    setSize(500,400);
+    /* Resizable editor locked to the aspect ratio of the background */
+    setResizable(true, true);
+    setResizeLimits(baseWidth / 2, baseHeight / 2, baseWidth * 3, baseHeight * 3);
+    getConstrainer()->setFixedAspectRatio((double)baseWidth / baseHeight);
+    setSize(baseWidth, baseHeight);
 
     auto& params = processor.getParameters();
 
-    /* setting the colour of the all the sliders */
-    getLookAndFeel().setColour(juce::Slider::thumbColourId, juce::Colours::darkblue);                               //Pointer colour
-    getLookAndFeel().setColour(juce::Slider::rotarySliderFillColourId, juce::Colour::fromRGBA(233,231,119,255));    //SliderFill colour
-    getLookAndFeel().setColour(juce::Slider::rotarySliderOutlineColourId, juce::Colours::lightcyan);                //SliderOutline colour
+    /* the colours of all the sliders live in the editor's own look and feel */
+    setLookAndFeel(&lookAndFeel);
 
     /* setting the custom and parameters of the each slider */
+    /* (the phase offset knob is set up but kept hidden, as before) */
+    setupKnob(dryWetSlider, dryWetLabel, "Dry/Wet", (juce::AudioParameterFloat*)params.getUnchecked(0), true);
+    setupKnob(depthSlider, depthLabel, "Depth", (juce::AudioParameterFloat*)params.getUnchecked(1), true);
+    setupKnob(rateSlider, rateLabel, "Rate", (juce::AudioParameterFloat*)params.getUnchecked(2), true);
+    setupKnob(feedbackSlider, feedbackLabel, "Feedback", (juce::AudioParameterFloat*)params.getUnchecked(3), true);
+    setupKnob(phaseOffsetSlider, phaseOffsetLabel, "PhaseOffset", (juce::AudioParameterFloat*)params.getUnchecked(4), false);
+    setupKnob(ampSlider, ampLabel, "Amplitude", (juce::AudioParameterFloat*)params.getUnchecked(5), true);
+
+    /* delay range selector, kept in sync with its choice parameter like the knobs */
+    auto* delayRangeParameter = (juce::AudioParameterChoice*)params.getUnchecked(6);
+    delayRangeBox.addItemList(delayRangeParameter->choices, 1);
+    delayRangeBox.setSelectedItemIndex(delayRangeParameter->getIndex(), juce::dontSendNotification);
+    delayRangeBox.onChange = [this, delayRangeParameter] {
+        delayRangeParameter->beginChangeGesture();
+        *delayRangeParameter = delayRangeBox.getSelectedItemIndex();
+        delayRangeParameter->endChangeGesture();
+    };
+    delayRangeLabel.setText("Range", juce::dontSendNotification);
+    delayRangeLabel.attachToComponent(&delayRangeBox, true);
+    addAndMakeVisible(delayRangeBox);
+    addAndMakeVisible(delayRangeLabel);
+
+    /* number of cascaded stages, the same way */
+    auto* stagesParameter = (juce::AudioParameterInt*)params.getUnchecked(8);
+    for (int stages = stagesParameter->getRange().getStart(); stages <= stagesParameter->getRange().getEnd(); stages++)
+        stagesBox.addItem(juce::String(stages), stages);
+    stagesBox.setSelectedId(stagesParameter->get(), juce::dontSendNotification);
+    stagesBox.onChange = [this, stagesParameter] {
+        stagesParameter->beginChangeGesture();
+        *stagesParameter = stagesBox.getSelectedId();
+        stagesParameter->endChangeGesture();
+    };
+    stagesLabel.setText("Stages", juce::dontSendNotification);
+    stagesLabel.attachToComponent(&stagesBox, true);
+    addAndMakeVisible(stagesBox);
+    addAndMakeVisible(stagesLabel);
+
+    /* LFO offset between the stages, as a small knob beside their number */
+    setupKnob(stageSpreadSlider, stageSpreadLabel, "Spread", (juce::AudioParameterFloat*)params.getUnchecked(9), true);
+
+    /* adaptive quality switch, the same way */
+    auto* adaptiveQualityParameter = (juce::AudioParameterBool*)params.getUnchecked(7);
+    adaptiveQualityButton.setToggleState(adaptiveQualityParameter->get(), juce::dontSendNotification);
+    adaptiveQualityButton.onClick = [this, adaptiveQualityParameter] {
+        adaptiveQualityParameter->beginChangeGesture();
+        *adaptiveQualityParameter = adaptiveQualityButton.getToggleState();
+        adaptiveQualityParameter->endChangeGesture();
+    };
+    addAndMakeVisible(adaptiveQualityButton);
 
     /*=====================================================================================================*/
-    juce::AudioParameterFloat* dryWetParameter = (juce::AudioParameterFloat*)params.getUnchecked(0);
 
-    dryWetSlider.setBounds(0, 100, 120, 120);
-    dryWetSlider.setSliderStyle(juce::Slider::SliderStyle::RotaryHorizontalDrag);
-    dryWetSlider.setTextBoxStyle(juce::Slider::TextEntryBoxPosition::TextBoxBelow, false, 50, 25);
-    dryWetSlider.setColour(dryWetSlider.textBoxOutlineColourId, juce::Colour());
-    dryWetSlider.setRange(dryWetParameter->range.start, dryWetParameter->range.end, 0.01);
-    dryWetSlider.setValue(*dryWetParameter);
-    addAndMakeVisible(dryWetSlider);
+    /* Live view of the LFO, the delay time and the feedback, in the free slot between the bottom knobs */
+    addAndMakeVisible(modulationDisplay);
 
-    dryWetLabel.setText("Dry/Wet", juce::dontSendNotification);
-    dryWetLabel.attachToComponent(&dryWetSlider, false);
-    dryWetLabel.setJustificationType(juce::Justification::centredTop);
-    addAndMakeVisible(dryWetLabel);
+    /* Switches the slot between the modulation view and the spectrum analyser */
+    displayToggleButton.onClick = [this] { toggleDisplay(); };
+    addAndMakeVisible(displayToggleButton);
 
-    dryWetSlider.onValueChange = [this, dryWetParameter] { *dryWetParameter = dryWetSlider.getValue();};
-    dryWetSlider.onDragStart = [dryWetParameter] { dryWetParameter->beginChangeGesture(); };
-    dryWetSlider.onDragEnd = [dryWetParameter] { dryWetParameter->endChangeGesture(); };
+    /* Shows or hides the CPU load of this instance */
+    cpuLoadToggleButton.setClickingTogglesState(true);
+    cpuLoadToggleButton.onClick = [this] { toggleCpuLoadOverlay(); };
+    addAndMakeVisible(cpuLoadToggleButton);
 
+    startupTimings.constructionMs = juce::Time::getMillisecondCounterHiRes() - openStartMs;
+}
 
-    /*=====================================================================================================*/
-    juce::AudioParameterFloat* depthParameter = (juce::AudioParameterFloat*)params.getUnchecked(1);
-
-    depthSlider.setBounds(200, 100, 120, 120);
-    depthSlider.setSliderStyle(juce::Slider::SliderStyle::RotaryHorizontalDrag);
-    depthSlider.setTextBoxStyle(juce::Slider::TextEntryBoxPosition::TextBoxBelow, false, 50, 25);
-    depthSlider.setColour(depthSlider.textBoxOutlineColourId, juce::Colour());
-    depthSlider.setRange(depthParameter->range.start, depthParameter->range.end, 0.01);
-    depthSlider.setValue(*depthParameter);
-    addAndMakeVisible(depthSlider);
-
-    depthLabel.setText("Depth", juce::dontSendNotification);
-    depthLabel.attachToComponent(&depthSlider, false);
-    depthLabel.setJustificationType(juce::Justification::centredTop);
-    addAndMakeVisible(depthLabel);
-
-    depthSlider.onValueChange = [this, depthParameter] { *depthParameter = depthSlider.getValue();};
-    depthSlider.onDragStart = [depthParameter] { depthParameter->beginChangeGesture(); };
-    depthSlider.onDragEnd = [depthParameter] { depthParameter->endChangeGesture(); };
-
-    /*=====================================================================================================*/
-    juce::AudioParameterFloat* rateParameter = (juce::AudioParameterFloat*)params.getUnchecked(2);
-
-    rateSlider.setBounds(380, 100, 120, 120);
-    rateSlider.setSliderStyle(juce::Slider::SliderStyle::RotaryHorizontalDrag);
-    rateSlider.setTextBoxStyle(juce::Slider::TextEntryBoxPosition::TextBoxBelow, false, 50, 25);
-    rateSlider.setColour(rateSlider.textBoxOutlineColourId, juce::Colour());
-    rateSlider.setRange(rateParameter->range.start, rateParameter->range.end, 0.01);
-    rateSlider.setValue(*rateParameter);
-    addAndMakeVisible(rateSlider);
-
-    rateLabel.setText("Rate", juce::dontSendNotification);
-    rateLabel.attachToComponent(&rateSlider, false);
-    rateLabel.setJustificationType(juce::Justification::centredTop);
-    addAndMakeVisible(rateLabel);
-
-    rateSlider.onValueChange = [this, rateParameter] { *rateParameter = rateSlider.getValue();};
-    rateSlider.onDragStart = [rateParameter] { rateParameter->beginChangeGesture(); };
-    rateSlider.onDragEnd = [rateParameter] { rateParameter->endChangeGesture(); };
-
-    /*=====================================================================================================*/
-    juce::AudioParameterFloat* feedbackParameter = (juce::AudioParameterFloat*)params.getUnchecked(3);
-
-    feedbackSlider.setBounds(0, 250, 120, 120);
-    feedbackSlider.setSliderStyle(juce::Slider::SliderStyle::RotaryHorizontalDrag);
-    feedbackSlider.setTextBoxStyle(juce::Slider::TextEntryBoxPosition::TextBoxBelow, false, 50, 25);
-    feedbackSlider.setColour(feedbackSlider.textBoxOutlineColourId, juce::Colour());
-    feedbackSlider.setRange(feedbackParameter->range.start, feedbackParameter->range.end, 0.01);
-    feedbackSlider.setValue(*feedbackParameter);
-    addAndMakeVisible(feedbackSlider);
-
-    feedbackLabel.setText("Feedback", juce::dontSendNotification);
-    feedbackLabel.attachToComponent(&feedbackSlider, false);
-    feedbackLabel.setJustificationType(juce::Justification::centredTop);
-    addAndMakeVisible(feedbackLabel);
-
-    feedbackSlider.onValueChange = [this, feedbackParameter] { *feedbackParameter = feedbackSlider.getValue(); };
-    feedbackSlider.onDragStart = [feedbackParameter] { feedbackParameter->beginChangeGesture(); };
-    feedbackSlider.onDragEnd = [feedbackParameter] { feedbackParameter->endChangeGesture(); };
-
-    /*=====================================================================================================*/
-    juce::AudioParameterFloat* phaseParameter = (juce::AudioParameterFloat*)params.getUnchecked(4);
-
-    phaseOffsetSlider.setBounds(200, 250, 120, 120);
-    phaseOffsetSlider.setSliderStyle(juce::Slider::SliderStyle::RotaryHorizontalDrag);
-    phaseOffsetSlider.setTextBoxStyle(juce::Slider::TextEntryBoxPosition::TextBoxBelow, false, 50, 25);
-    phaseOffsetSlider.setColour(phaseOffsetSlider.textBoxOutlineColourId, juce::Colour());
-    phaseOffsetSlider.setRange(phaseParameter->range.start, phaseParameter->range.end, 0.01);
-    phaseOffsetSlider.setValue(*phaseParameter);
-    //addAndMakeVisible(phaseOffsetSlider);
-
-    phaseOffsetLabel.setText("PhaseOffset", juce::dontSendNotification);
-    phaseOffsetLabel.attachToComponent(&phaseOffsetSlider, false);
-    phaseOffsetLabel.setJustificationType(juce::Justification::centredTop);
-    //addAndMakeVisible(phaseOffsetLabel);
-
-    phaseOffsetSlider.onValueChange = [this, phaseParameter] { *phaseParameter = phaseOffsetSlider.getValue();};
-    phaseOffsetSlider.onDragStart = [phaseParameter] { phaseParameter->beginChangeGesture(); };
-    phaseOffsetSlider.onDragEnd = [phaseParameter] { phaseParameter->endChangeGesture(); };
-
-    /*=====================================================================================================*/
-    juce::AudioParameterFloat* delayParameter = (juce::AudioParameterFloat*)params.getUnchecked(5);
-
-    ampSlider.setBounds(380, 250, 120, 120);
-    ampSlider.setSliderStyle(juce::Slider::SliderStyle::RotaryHorizontalDrag);
-    ampSlider.setTextBoxStyle(juce::Slider::TextEntryBoxPosition::TextBoxBelow, false, 50, 25);
-    ampSlider.setColour(ampSlider.textBoxOutlineColourId, juce::Colour());
-    ampSlider.setRange(delayParameter->range.start, delayParameter->range.end, 0.01);
-    ampSlider.setValue(*delayParameter);
-    addAndMakeVisible(ampSlider);
+FlanGELVSAudioProcessorEditor::~FlanGELVSAudioProcessorEditor()
+{
+    setLookAndFeel(nullptr);
+}
 
-    ampLabel.setText("Amplitude", juce::dontSendNotification);
-    ampLabel.attachToComponent(&ampSlider, false);
-    ampLabel.setJustificationType(juce::Justification::centredTop);
-    addAndMakeVisible(ampLabel);
+void FlanGELVSAudioProcessorEditor::setupKnob(juce::Slider& slider, juce::Label& label, const juce::String& name,
+                                              juce::AudioParameterFloat* parameter, bool visible)
+{
+    slider.setSliderStyle(juce::Slider::SliderStyle::RotaryHorizontalDrag);
+    slider.setTextBoxStyle(juce::Slider::TextEntryBoxPosition::TextBoxBelow, false, 50, 25);
+    slider.setColour(juce::Slider::textBoxOutlineColourId, juce::Colour());
+    slider.setRange(parameter->range.start, parameter->range.end, 0.01);
+    slider.setValue(*parameter, juce::dontSendNotification);
+
+    label.setText(name, juce::dontSendNotification);
+    label.attachToComponent(&slider, false);
+    label.setJustificationType(juce::Justification::centredTop);
+
+    if (visible) {
+        addAndMakeVisible(slider);
+        addAndMakeVisible(label);
+    }
+
+    slider.onValueChange = [&slider, parameter] { *parameter = (float)slider.getValue(); };
+    slider.onDragStart = [parameter] { parameter->beginChangeGesture(); };
+    slider.onDragEnd = [parameter] { parameter->endChangeGesture(); };
+}
 
-    ampSlider.onValueChange = [this, delayParameter] { *delayParameter = ampSlider.getValue();};
-    ampSlider.onDragStart = [delayParameter] { delayParameter->beginChangeGesture(); };
-    ampSlider.onDragEnd = [delayParameter] { delayParameter->endChangeGesture(); };
+void FlanGELVSAudioProcessorEditor::backgroundReady()
+{
+    if (startupTimings.backgroundReadyMs < 0)
+        startupTimings.backgroundReadyMs = juce::Time::getMillisecondCounterHiRes() - openStartMs;
 
-    /*=====================================================================================================*/
+    repaint();
+}
 
+void FlanGELVSAudioProcessorEditor::toggleDisplay()
+{
+    if (spectrumDisplay == nullptr) {
+        spectrumDisplay = std::make_unique<SpectrumDisplay>(audioProcessor);
+        addAndMakeVisible(*spectrumDisplay);
+        modulationDisplay.setVisible(false);
+        displayToggleButton.setButtonText("Modulation");
+    }
+    else {
+        spectrumDisplay.reset();
+        modulationDisplay.setVisible(true);
+        displayToggleButton.setButtonText("Spectrum");
+    }
+
+    resized();
 }
 
-FlanGELVSAudioProcessorEditor::~FlanGELVSAudioProcessorEditor()
+void FlanGELVSAudioProcessorEditor::toggleCpuLoadOverlay()
 {
+    if (cpuLoadToggleButton.getToggleState()) {
+        cpuLoadOverlay = std::make_unique<CpuLoadOverlay>(audioProcessor);
+        addAndMakeVisible(*cpuLoadOverlay);
+    }
+    else {
+        cpuLoadOverlay.reset();
+    }
+
+    resized();
 }
 
 //==============================================================================
 void FlanGELVSAudioProcessorEditor::paint (juce::Graphics& g)
 {
     // (Our component is opaque, so we must completely fill the background with a solid colour) 
+    /* (the solid colour is also the placeholder shown until the background has been decoded) */
     g.fillAll(juce::Colours::darkorange);
 
+    /*Read through getStartupTimings(), e.g. by the editor benchmark*/
+    if (startupTimings.firstPaintMs < 0)
+        startupTimings.firstPaintMs = juce::Time::getMillisecondCounterHiRes() - openStartMs;
+
     g.setColour(juce::Colours::white);
     g.setFont(20.0f);
-    g.drawImageAt(backgroundImage, 0, 0);
+
+    /*Draw the rendering made for this display's pixel density, asking for a new one if needed*/
+    const float displayScale = g.getInternalContext().getPhysicalPixelScaleFactor();
+
+    if (displayScale != lastDisplayScale) {
+        lastDisplayScale = displayScale;
+        backgroundCache->requestSize(getWidth(), getHeight(), displayScale);
+    }
+
+    auto background = backgroundCache->getImage(getWidth(), getHeight(), displayScale);
+
+    if (background.isValid())
+        g.drawImage(background, getLocalBounds().toFloat());
 
     g.setFont(juce::Font("Arial", 40.0f, juce::Font::bold));
     //g.drawFittedText("FLANGELVS", getLocalBounds(), juce::Justification::centredTop, 1);
@@ -179,4 +203,49 @@ void FlanGELVSAudioProcessorEditor::resized()
 {
     // This is generally where you'll want to lay out the positions of any
     // subcomponents in your editor..
+
+    /*Every position is given on the 500x400 reference layout and scaled to the current size*/
+    const float scale = getWidth() / (float)baseWidth;
+
+    auto scaled = [scale](int x, int y, int w, int h) {
+        return juce::Rectangle<int>(x, y, w, h).toFloat().transformedBy(juce::AffineTransform::scale(scale)).getSmallestIntegerContainer();
+    };
+
+    const int textBoxWidth = juce::roundToInt(50 * scale);
+    const int textBoxHeight = juce::roundToInt(25 * scale);
+
+    for (auto* slider : { &dryWetSlider, &depthSlider, &rateSlider, &feedbackSlider, &phaseOffsetSlider, &ampSlider })
+        slider->setTextBoxStyle(juce::Slider::TextEntryBoxPosition::TextBoxBelow, false, textBoxWidth, textBoxHeight);
+
+    for (auto* label : { &dryWetLabel, &depthLabel, &rateLabel, &feedbackLabel, &phaseOffsetLabel, &ampLabel })
+        label->setFont(juce::Font(15.0f * scale));
+
+    dryWetSlider.setBounds(scaled(0, 100, 120, 120));
+    depthSlider.setBounds(scaled(200, 100, 120, 120));
+    rateSlider.setBounds(scaled(380, 100, 120, 120));
+    feedbackSlider.setBounds(scaled(0, 250, 120, 120));
+    phaseOffsetSlider.setBounds(scaled(200, 250, 120, 120));
+    ampSlider.setBounds(scaled(380, 250, 120, 120));
+    delayRangeBox.setBounds(scaled(60, 30, 100, 22));
+    delayRangeLabel.setFont(juce::Font(15.0f * scale));
+    stagesBox.setBounds(scaled(220, 30, 50, 22));
+    stagesLabel.setFont(juce::Font(15.0f * scale));
+    stageSpreadSlider.setTextBoxStyle(juce::Slider::TextEntryBoxPosition::TextBoxBelow, false,
+                                      juce::roundToInt(40 * scale), juce::roundToInt(16 * scale));
+    stageSpreadSlider.setBounds(scaled(280, 20, 70, 60));
+    stageSpreadLabel.setFont(juce::Font(13.0f * scale));
+    adaptiveQualityButton.setBounds(scaled(360, 30, 135, 22));
+    modulationDisplay.setBounds(scaled(135, 255, 230, 105));
+    displayToggleButton.setBounds(scaled(215, 364, 70, 18));
+
+    cpuLoadToggleButton.setBounds(scaled(455, 4, 40, 18));
+
+    if (spectrumDisplay != nullptr)
+        spectrumDisplay->setBounds(modulationDisplay.getBounds());
+
+    if (cpuLoadOverlay != nullptr)
+        cpuLoadOverlay->setBounds(scaled(5, 4, 445, 18));
+
+    /*Render the background for the new size in the background*/
+    backgroundCache->requestSize(getWidth(), getHeight(), lastDisplayScale);
 }
@@ -10,6 +10,11 @@
 
 #include <JuceHeader.h>
 #include "PluginProcessor.h"
+#include "BackgroundImageCache.h"
+#include "ModulationDisplay.h"
+#include "SpectrumDisplay.h"
+#include "CpuLoadOverlay.h"
+#include "FlanGELVSLookAndFeel.h"
 
 //==============================================================================
 /**
@@ -24,16 +29,67 @@ public:
     void paint (juce::Graphics&) override;
     void resized() override;
 
+    /* How long opening the editor took, in ms since the start of the constructor (-1 until it happens) */
+    struct StartupTimings
+    {
+        double constructionMs = -1;
+        double firstPaintMs = -1;
+        double backgroundReadyMs = -1;
+    };
+
+    const StartupTimings& getStartupTimings() const { return startupTimings; }
+
 private:
+    /* Taken before any other member is constructed */
+    const double openStartMs = juce::Time::getMillisecondCounterHiRes();
+    StartupTimings startupTimings;
+
     // This reference is provided as a quick way for your editor to
     // access the processor object that created it.
 
     FlanGELVSAudioProcessor& audioProcessor;
 
+    /*  Private look and feel: declared first so it outlives the components using it */
+    FlanGELVSLookAndFeel lookAndFeel;
+
     /*  Creation of sliders and labels*/
     juce::Slider    dryWetSlider, depthSlider, rateSlider, feedbackSlider, ampSlider, phaseOffsetSlider;
     juce::Label     dryWetLabel, depthLabel, rateLabel, feedbackLabel, ampLabel, phaseOffsetLabel;
-    juce::Image     backgroundImage;
+    ModulationDisplay modulationDisplay;
+
+    /*  Flanger / chorus / slap delay range */
+    juce::ComboBox  delayRangeBox;
+    juce::Label     delayRangeLabel;
+
+    /*  Number of flangers chained inside the plugin, and how far apart their LFOs run */
+    juce::ComboBox  stagesBox;
+    juce::Label     stagesLabel;
+    juce::Slider    stageSpreadSlider;
+    juce::Label     stageSpreadLabel;
+
+    /*  Lets the processor lower its quality when blocks get close to their deadline */
+    juce::ToggleButton adaptiveQualityButton { "Adaptive quality" };
+
+    /* The analyser only exists (and its worker only runs) while its view is shown */
+    std::unique_ptr<SpectrumDisplay> spectrumDisplay;
+    juce::TextButton displayToggleButton { "Spectrum" };
+    void toggleDisplay();
+
+    /* Optional readout of this instance's processBlock load */
+    std::unique_ptr<CpuLoadOverlay> cpuLoadOverlay;
+    juce::TextButton cpuLoadToggleButton { "CPU" };
+    void toggleCpuLoadOverlay();
+
+    /* Common setup of a rotary knob, its label and its parameter attachment */
+    void setupKnob(juce::Slider&, juce::Label&, const juce::String& name, juce::AudioParameterFloat*, bool visible);
+
+    std::unique_ptr<BackgroundImageCache> backgroundCache;
+    void backgroundReady();
+    float           lastDisplayScale = 1.0f;
+
+    /* Reference size of the layout: every bound is expressed relative to it */
+    static constexpr int baseWidth = 500;
+    static constexpr int baseHeight = 400;
 
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (FlanGELVSAudioProcessorEditor)
 };
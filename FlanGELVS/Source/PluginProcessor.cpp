@@ -8,6 +8,7 @@
 
 #include "PluginProcessor.h"
 #include "PluginEditor.h"
+#include <complex>
 
 //==============================================================================
 FlanGELVSAudioProcessor::FlanGELVSAudioProcessor()
@@ -54,18 +55,32 @@ FlanGELVSAudioProcessor::FlanGELVSAudioProcessor()
         0.01,
         3.0,
         1.0));
+    /*Flanger (1-5 ms), chorus (10-30 ms) or slapback (80-120 ms) delay times*/
+    addParameter(delayRangeValue = new juce::AudioParameterChoice("delayrange",
+        "Delay Range",
+        { "Flanger", "Chorus", "Slap" },
+        0));
+    /*Lowers the interpolation order and the modulation rate while blocks run close to their deadline*/
+    addParameter(adaptiveQualityValue = new juce::AudioParameterBool("adaptivequality",
+        "Adaptive Quality",
+        false));
+    /*Flangers in series inside this instance, their LFOs spread by a fraction of a cycle per stage*/
+    addParameter(stagesValue = new juce::AudioParameterInt("stages",
+        "Stages",
+        1,
+        maxStages,
+        1));
+    addParameter(stageSpreadValue = new juce::AudioParameterFloat("stagespread",
+        "Stage Spread",
+        0.0f,
+        1.0f,
+        0.0f));
 
     /*Initial setup of the flanger delay parameters*/
     phaseLFO = 0;
-    delayTime = 0;
-    feedbackLeft = 0;
-    feedbackRight = 0;
-    delayTimeInSamples = 0;
-    delayReadHead = 0;
-    circularBufferLength = 0;
-    circularBufferWriteHead = 0;
-    circularBufferLeft = nullptr;
-    circularBufferRight = nullptr;
+    telemetryDecimation = 1;
+    telemetryCounter = 0;
+    telemetryFeedbackPeak = 0;
 }
 
 FlanGELVSAudioProcessor::~FlanGELVSAudioProcessor()
@@ -144,20 +159,251 @@ void FlanGELVSAudioProcessor::prepareToPlay (double sampleRate, int samplesPerBl
 
     /*Initialize phase*/
     phaseLFO = 0;
-    /*Set the circular buffer length*/
-    circularBufferLength = sampleRate * MAX_DELAY_TIME;
-    /*Initialize left buffer*/
-    circularBufferLeft.reset(new double[circularBufferLength]);
-    /*Clear junk data in new buffer*/
-    juce::zeromem(circularBufferLeft.get(), circularBufferLength * sizeof(double));
-    /*Initialize right buffer*/
-    circularBufferRight.reset(new double[circularBufferLength]);
-    /*Clear junk data in new buffer*/
-    juce::zeromem(circularBufferRight.get(), circularBufferLength * sizeof(double));
-    /*Initialize the buffer write head to 0*/
-    circularBufferWriteHead = 0;
-    /*Initialize delayTime to 1*/
-    delayTime = 1;
+    /*Per-sample constants, so that the loop has no division and no double maths besides the phase*/
+    inverseSampleRate = 1.0 / sampleRate;
+    sampleRateFloat = (float)sampleRate;
+    /*Allocate and clear just enough history for the selected delay range*/
+    activeDelayRange = delayRangeValue->getIndex();
+    crossfadeSamplesRemaining = 0;
+    const auto range = getDelayRange(activeDelayRange);
+    const int numStages = stagesValue->get();
+
+    for (int k = 0; k < maxStages; k++) {
+        /*Stages out of the chain keep a token buffer until they are switched on*/
+        auto& stage = stages[(size_t)k];
+        const bool inChain = k < numStages;
+        stage.delayBuffer.prepare(inChain ? getDelayBufferLength(activeDelayRange) : 1);
+        /*Initialize the buffer write head to 0*/
+        stage.circularBufferWriteHead = 0;
+        stage.samplesWritten = 0;
+        /*Start the delay time in the middle of the range*/
+        stage.delayTime = 0.5f * (range.minimumSeconds + range.maximumSeconds);
+        stage.enabled = stage.running = inChain;
+        stage.level = inChain ? 1.0f : 0.0f;
+    }
+    /*Send about 2000 telemetry frames per second, whatever the sample rate*/
+    telemetryDecimation = juce::jmax(1, juce::roundToInt(sampleRate / 2000.0));
+    telemetryCounter = 0;
+    telemetryFeedbackPeak = 0;
+    /*Room for one LFO cycle at the current rate, and settle before recording one*/
+    trajectoryCache.prepare(sampleRate, rateValue->get());
+    /*Start the load statistics afresh for the new sample rate*/
+    cpuLoad.prepare(sampleRate);
+    /*Start from the default quality (the maximum one for an offline render), with no
+      interpolation fade pending*/
+    governor.prepare(sampleRate);
+    const int level = isNonRealtime() ? QualityGovernor::offlineLevel : QualityGovernor::defaultLevel;
+    const auto quality = QualityGovernor::getQuality(level);
+    qualityLevel = level;
+    controlRateShift = quality.controlRateShift;
+    cubicInterpolation = quality.cubicInterpolation;
+    doublePrecision = quality.doublePrecision;
+    interpolationFadeRemaining = 0;
+    reportLatency();
+    /*Pick the widest kernels this CPU runs (or the ones forced for testing)*/
+    kernels = &DspKernels::getTable(DspKernels::Variant::automatic);
+}
+
+void FlanGELVSAudioProcessor::seekModulation(juce::int64 samplePosition)
+{
+    const double phaseIncrement = *rateValue * inverseSampleRate;
+    const double phase = (double)samplePosition * phaseIncrement;
+    phaseLFO = phase - std::floor(phase);
+    trajectoryCache.invalidate();
+
+    /*The delay target as processSamples() maps it, with the single precision map and gain*/
+    const auto range = getDelayRange(activeDelayRange);
+    const double mapScale = ((double)range.maximumSeconds - (double)range.minimumSeconds) * 0.5;
+    const double mapOffset = (double)(float)((double)range.minimumSeconds + mapScale);
+    const double gain = (double)(ampValue->get() * depthValue->get()) * (double)(float)mapScale;
+    const double startDelay = 0.5f * (range.minimumSeconds + range.maximumSeconds);
+
+    /*The smoothing y[n] = y[n-1] + a (x[n] - y[n-1]) turns the sine target into the same sine
+      through H = a / (1 - (1 - a) e^-jw), and forgets the start value by (1 - a) per sample*/
+    const double smoothing = 0.001;
+    const std::complex<double> response = smoothing / (1.0 - (1.0 - smoothing) * std::polar(1.0, -juce::MathConstants<double>::twoPi * phaseIncrement));
+    const double startWeight = std::pow(1.0 - smoothing, (double)samplePosition);
+
+    for (int k = 0; k < maxStages; k++) {
+        /*Same phase offset as the stage gets in processBlock()*/
+        const float stageOffset = phaseOffsetValue->get() + juce::MathConstants<float>::twoPi * stageSpreadValue->get() * (float)k;
+        auto settledDelay = [&](double cycles) {
+            return mapOffset + gain * std::abs(response) * std::sin(juce::MathConstants<double>::twoPi * cycles + (double)stageOffset + std::arg(response));
+        };
+
+        /*The state is the smoothed delay of the sample before: settled, plus what is left of the start*/
+        stages[(size_t)k].delayTime = settledDelay(phaseLFO - phaseIncrement)
+                                    + startWeight * (startDelay - settledDelay(-phaseIncrement));
+    }
+}
+
+int FlanGELVSAudioProcessor::getPreRollSamples(double sampleRate, float toleranceDecibels) const
+{
+    const double tolerance = juce::Decibels::decibelsToGain((double)toleranceDecibels, -400.0);
+
+    /*(no time for the delay smoothing to settle: seekModulation() starts it where it would be)*/
+
+    /*Longest delay the LFO mapping can reach within the selected range (the delay line
+      limits it to what the range can ever need, at the rate asked about: the processor
+      may not be prepared yet)*/
+    const auto range = getDelayRange(delayRangeValue->getIndex());
+    const double lfoPeak = (double)ampValue->get() * depthValue->get();
+    const double rangeScale = 0.5 * ((double)range.maximumSeconds - range.minimumSeconds);
+    const double longestDelay = juce::jmin(range.minimumSeconds + rangeScale * (1.0 + lfoPeak),
+                                           (double)getDelayBufferLength(delayRangeValue->getIndex(), sampleRate) / sampleRate);
+
+    /*Each trip round the feedback loop scales what is left of the past by the feedback amount*/
+    const double feedback = juce::jlimit(1.0e-6, 0.999999, (double)feedbackValue->get());
+    const double echoes = std::ceil(std::log(tolerance) / std::log(feedback)) + 1;
+
+    /*Stages in series: each one starts settling once the one before it has*/
+    return (int)std::ceil(stagesValue->get() * echoes * longestDelay * sampleRate);
+}
+
+FlanGELVSAudioProcessor::DelayRange FlanGELVSAudioProcessor::getDelayRange(int index)
+{
+    static const DelayRange ranges[numDelayRanges] = {
+        { "Flanger", 0.001f, 0.005f },
+        { "Chorus", 0.010f, 0.030f },
+        { "Slap", 0.080f, 0.120f }
+    };
+
+    return ranges[juce::jlimit(0, numDelayRanges - 1, index)];
+}
+
+int FlanGELVSAudioProcessor::getDelayBufferLength(int rangeIndex, double sampleRate) const
+{
+    /*The LFO reaches amplitude * depth times the half-width of the range on either side
+      of its centre, plus two samples for the interpolation*/
+    const auto range = getDelayRange(rangeIndex);
+    const float halfWidth = (range.maximumSeconds - range.minimumSeconds) * 0.5f;
+    const float longestDelay = range.minimumSeconds + halfWidth * (1.0f + ampValue->range.end * depthValue->range.end);
+
+    return (int)std::ceil(longestDelay * (float)sampleRate) + 2;
+}
+
+void FlanGELVSAudioProcessor::updateDelayRange()
+{
+    const bool crossfading = crossfadeSamplesRemaining > 0;
+
+    /*Take over a buffer resized by the background thread, provided it holds every tap being read*/
+    const int lengthInUse = juce::jmax(getDelayBufferLength(activeDelayRange),
+                                       crossfading ? getDelayBufferLength(previousDelayRange) : 0);
+
+    /*(a stage out of the chain takes whatever it was given, even to shrink)*/
+    for (auto& stage : stages)
+        stage.delayBuffer.adoptPendingBuffer(stage.circularBufferWriteHead, stage.samplesWritten, stage.running ? lengthInUse : 1);
+
+    if (crossfading)
+        return;
+
+    const int targetRange = delayRangeValue->getIndex();
+
+    if (targetRange != activeDelayRange) {
+        const int lengthNeeded = juce::jmax(getDelayBufferLength(activeDelayRange), getDelayBufferLength(targetRange));
+        bool allFit = true;
+
+        for (auto& stage : stages) {
+            if (stage.running && stage.delayBuffer.getLength() < lengthNeeded) {
+                /*Grow first: the fade starts once every longer buffer has been swapped in*/
+                stage.delayBuffer.requestLength(lengthNeeded);
+                allFit = false;
+            }
+        }
+
+        if (allFit) {
+            /*Both ranges fit: fade from a tap in the old range to one starting in the middle of the new range*/
+            const auto range = getDelayRange(targetRange);
+            previousDelayRange = activeDelayRange;
+            activeDelayRange = targetRange;
+            crossfadeSamplesRemaining = delayRangeCrossfadeLength;
+
+            for (auto& stage : stages) {
+                stage.previousDelayTime = stage.delayTime;
+                stage.delayTime = 0.5f * (range.minimumSeconds + range.maximumSeconds);
+            }
+        }
+    }
+    else {
+        /*Settled: keep only the history the active range can reach*/
+        for (auto& stage : stages)
+            if (stage.running)
+                stage.delayBuffer.requestLength(getDelayBufferLength(activeDelayRange));
+    }
+}
+
+void FlanGELVSAudioProcessor::updateStages()
+{
+    const int numStages = stagesValue->get();
+    const bool crossfading = crossfadeSamplesRemaining > 0;
+    const int lengthInUse = juce::jmax(getDelayBufferLength(activeDelayRange),
+                                       crossfading ? getDelayBufferLength(previousDelayRange) : 0);
+
+    for (int k = 1; k < maxStages; k++) {
+        auto& stage = stages[(size_t)k];
+        stage.enabled = k < numStages;
+
+        if (stage.running)
+            continue;
+
+        if (!stage.enabled) {
+            /*Out of the chain and faded out: give its memory back*/
+            stage.delayBuffer.requestLength(1);
+        }
+        else if (stage.delayBuffer.getLength() >= lengthInUse) {
+            /*Join with silent history and the first stage's delay, then fade in*/
+            const auto& first = stages[0];
+            stage.delayBuffer.clear();
+            stage.circularBufferWriteHead = 0;
+            stage.delayTime = first.delayTime;
+            stage.previousDelayTime = first.previousDelayTime;
+            stage.delayTimeInSamples = first.delayTimeInSamples;
+            stage.feedbackLeft = 0;
+            stage.feedbackRight = 0;
+            stage.level = 0;
+            stage.running = true;
+        }
+        else {
+            /*Grow first, like a range change: it joins once the buffer has been swapped in*/
+            stage.delayBuffer.requestLength(lengthInUse);
+        }
+    }
+}
+
+void FlanGELVSAudioProcessor::setNonRealtime(bool isNonRealtime) noexcept
+{
+    AudioProcessor::setNonRealtime(isNonRealtime);
+    reportLatency();
+}
+
+void FlanGELVSAudioProcessor::reportLatency()
+{
+    /*Zero for every level so far, as the cubic taps only read samples already written: hosts
+      then have nothing to re-align when a bounce starts or ends*/
+    const int level = isNonRealtime() ? QualityGovernor::offlineLevel : QualityGovernor::defaultLevel;
+    setLatencySamples(QualityGovernor::getQuality(level).latencySamples);
+}
+
+void FlanGELVSAudioProcessor::updateQuality(int numSamples)
+{
+    /*No deadline offline: always the maximum quality, whatever the load*/
+    const int level = isNonRealtime() ? QualityGovernor::offlineLevel
+                    : adaptiveQualityValue->get() ? governor.update(cpuLoad.getLastLoad(), numSamples)
+                                                  : QualityGovernor::defaultLevel;
+    const auto quality = QualityGovernor::getQuality(level);
+    jassert(quality.latencySamples == getLatencySamples());
+
+    /*A new control rate only changes how often the (smoothed) delay target moves, so it
+      takes effect straight away; the interpolation order is faded*/
+    controlRateShift = quality.controlRateShift;
+    doublePrecision = quality.doublePrecision;
+
+    if (quality.cubicInterpolation != cubicInterpolation) {
+        cubicInterpolation = quality.cubicInterpolation;
+        interpolationFadeRemaining = interpolationCrossfadeLength;
+    }
+
+    qualityLevel = level;
 }
 
 void FlanGELVSAudioProcessor::releaseResources()
@@ -195,6 +441,7 @@ bool FlanGELVSAudioProcessor::isBusesLayoutSupported (const BusesLayout& layouts
 void FlanGELVSAudioProcessor::processBlock (juce::AudioBuffer<float>& buffer, juce::MidiBuffer& midiMessages)
 {
     juce::ScopedNoDenormals noDenormals;
+    CpuLoadMeter::ScopedMeasurement cpuMeasurement(cpuLoad, buffer.getNumSamples());
     auto totalNumInputChannels  = getTotalNumInputChannels();
     auto totalNumOutputChannels = getTotalNumOutputChannels();
 
@@ -214,82 +461,427 @@ void FlanGELVSAudioProcessor::processBlock (juce::AudioBuffer<float>& buffer, ju
     // Alternatively, you can process the samples with the channels
     // interleaved by keeping the same state.
 
-    /*Obtain left and right audio data pointers*/
+    /*Hand a copy of the dry input to the analyser (nothing happens if no editor is open)*/
+    analyser.pushInput(buffer, buffer.getNumSamples());
+
+    if (totalNumInputChannels == 0)
+        return;
+
+    /*Obtain left and right audio data pointers (a mono layout has no right channel)*/
     float* leftChannel = buffer.getWritePointer(0);
-    float* rightChannel = buffer.getWritePointer(1);
+    float* rightChannel = totalNumInputChannels > 1 ? buffer.getWritePointer(1) : nullptr;
+
+    /*Run in fixed quanta whose trip count is known at compile time; the rest of the block
+      is processed straight away with a runtime count, so nothing is buffered and there is
+      no added latency*/
+    updateDelayRange();
+    updateQuality(buffer.getNumSamples());
+    updateStages();
+
+    auto process = [this](float* left, float* right, auto length) {
+        /*Every stage starts the quantum from the same fade positions*/
+        const int crossfadeStart = crossfadeSamplesRemaining;
+        const int interpolationFadeStart = interpolationFadeRemaining;
+
+        /*The LFO of the quantum is computed once, by the first stage that needs it*/
+        singleModulation.computed = singleModulation.quadratureComputed = false;
+        doubleModulation.computed = doubleModulation.quadratureComputed = false;
+        singleModulation.numValues = doubleModulation.numValues = (((int)length - 1) >> controlRateShift) + 1;
+
+        auto processWith = [&](auto& modulation, int k, float* stageLeft, float* stageRight) {
+            using SampleType = typename std::decay<decltype(modulation)>::type::SampleType;
+            const SampleType* lfo;
+            const SampleType* delay;
+            getStageModulation(modulation, k, lfo, delay);
+
+            if (crossfadeStart > 0)
+                processSamples<DelayPath::crossfading, SampleType>(stages[(size_t)k], lfo, delay, stageLeft, stageRight, length);
+            else
+                processSamples<DelayPath::computed, SampleType>(stages[(size_t)k], lfo, delay, stageLeft, stageRight, length);
+        };
+
+        /*A stage with its read positions computed: double precision at the maximum quality
+          level (offline only), single otherwise*/
+        auto processComputed = [&](int k, float* stageLeft, float* stageRight) {
+            if (doublePrecision)
+                processWith(doubleModulation, k, stageLeft, stageRight);
+            else
+                processWith(singleModulation, k, stageLeft, stageRight);
+        };
+
+        /*First stage. Offline renders always compute the trajectory, so that they do not
+          depend on when a cycle happened to be recorded*/
+        if (crossfadeStart > 0 || isNonRealtime()) {
+            trajectoryCache.invalidate();
+            processComputed(0, left, right);
+        }
+        else {
+            const DelayTrajectoryCache::Settings settings { rateValue->get(), ampValue->get(), depthValue->get(),
+                                                            phaseOffsetValue->get(), activeDelayRange, controlRateShift };
+
+            switch (trajectoryCache.beginRun(settings, phaseLFO, settings.rate * inverseSampleRate, (int)length)) {
+                case DelayTrajectoryCache::Mode::playing:
+                    processSamples<DelayPath::cached, float>(stages[0], nullptr, nullptr, left, right, length);
+                    break;
+                case DelayTrajectoryCache::Mode::recording: {
+                    const float* lfo;
+                    const float* delay;
+                    getStageModulation(singleModulation, 0, lfo, delay);
+                    processSamples<DelayPath::recording, float>(stages[0], lfo, delay, left, right, length);
+                    break;
+                }
+                case DelayTrajectoryCache::Mode::computing:
+                default:
+                    processComputed(0, left, right);
+                    break;
+            }
+
+            trajectoryCache.endRun();
+        }
 
-    /*Iterate all samples through the buffer*/
-    for (int i = 0; i < buffer.getNumSamples(); i++) {
+        /*The rest of the cascade runs on the quantum while it is still in the cache, each stage
+          on the output of the one before, with the shared LFO turned by its share of the spread*/
+        for (int k = 1; k < maxStages; k++) {
+            auto& stage = stages[(size_t)k];
 
-        /*Generate LFO output*/
-        float lfoOut = *ampValue * sin(2 * juce::MathConstants<float>::pi * phaseLFO + *phaseOffsetValue);
+            if (!stage.running)
+                continue;
 
-        /*Moves LFO phase forwad*/
-        /*Set the LFO frequency according to the Rate parameter*/
-        phaseLFO += *rateValue / getSampleRate();
-        /*In case it's out of range*/
-        if (phaseLFO > 1) {
-            phaseLFO -= 1;
+            crossfadeSamplesRemaining = crossfadeStart;
+            interpolationFadeRemaining = interpolationFadeStart;
+
+            const float targetLevel = stage.enabled ? 1.0f : 0.0f;
+            const bool fading = stage.level != targetLevel;
+            float stageInputLeft[processingQuantum], stageInputRight[processingQuantum];
+
+            if (fading) {
+                std::copy(left, left + (int)length, stageInputLeft);
+                if (right != nullptr)
+                    std::copy(right, right + (int)length, stageInputRight);
+            }
+
+            processComputed(k, left, right);
+
+            if (fading) {
+                /*Joining or leaving the chain: blend between the stage's input and its output*/
+                const float step = targetLevel > stage.level ? 1.0f / stageFadeLength : -1.0f / stageFadeLength;
+                float level = stage.level;
+
+                for (int i = 0; i < (int)length; i++) {
+                    level = juce::jlimit(0.0f, 1.0f, level + step);
+                    left[i] = stageInputLeft[i] + level * (left[i] - stageInputLeft[i]);
+                    if (right != nullptr)
+                        right[i] = stageInputRight[i] + level * (right[i] - stageInputRight[i]);
+                }
+
+                stage.level = level;
+                stage.running = stage.enabled || level > 0.0f;
+            }
         }
 
-        /*Control parameter for LFO depth : apply the Depth parameter to the LFO waveform*/
-        lfoOut = lfoOut * *depthValue;
+        /*One LFO for the whole cascade: move its phase forward by the quantum, kept in [0, 1)*/
+        const double phase = phaseLFO + (double)length * (*rateValue * inverseSampleRate);
+        phaseLFO = phase - std::floor(phase);
+    };
 
-        /*Declare the mapped LFOs : map LFO output to desired delay times*/
-        float lfoOutMapped = 0;
+    const int numSamples = buffer.getNumSamples();
+    int start = 0;
 
-        /*Define the parameters of the flanger*/
-        /*Map LFO to oscillate between 1ms and 5ms*/
-        lfoOutMapped = juce::jmap(lfoOut, -1.0f, 1.0f, 0.001f, 0.005f);
-        
+    for (; start + processingQuantum <= numSamples; start += processingQuantum)
+        process(leftChannel + start, rightChannel != nullptr ? rightChannel + start : nullptr,
+                std::integral_constant<int, processingQuantum>());
 
+    if (start < numSamples)
+        process(leftChannel + start, rightChannel != nullptr ? rightChannel + start : nullptr, numSamples - start);
 
-        /*Calculate the delay time in samples accoring to the LFO*/
-        delayTime = delayTime - 0.001 * (delayTime - lfoOutMapped);
-        delayTimeInSamples = getSampleRate() * delayTime;
+    currentDelayInSamples = (float)stages[0].delayTimeInSamples;
+    analyser.pushOutput(buffer, buffer.getNumSamples());
+}
 
-        /*Write into circular buffer : populate the circular buffer with the current write sample plus feedback*/
-        circularBufferLeft.get()[circularBufferWriteHead] = leftChannel[i] + feedbackLeft;
-        circularBufferRight.get()[circularBufferWriteHead] = rightChannel[i] + feedbackRight;
+void FlanGELVSAudioProcessor::computeModulation(const DspKernels::ModulationParameters& modulation, float* lfo, float* delay, int numSamples)
+{
+    kernels->computeModulation(modulation, lfo, delay, numSamples);
+}
+
+void FlanGELVSAudioProcessor::computeModulation(const DspKernels::ModulationParameters& modulation, double* lfo, double* delay, int numSamples)
+{
+    /*Offline: std::sin on the double phase instead of the fast approximation*/
+    for (int i = 0; i < numSamples; i++) {
+        const double cycles = modulation.phase + (double)i * modulation.phaseIncrement;
+        const double value = (double)modulation.gain * std::sin(juce::MathConstants<double>::twoPi * cycles + (double)modulation.phaseOffset);
+        lfo[i] = value;
+        delay[i] = (double)modulation.delayMapOffset + (double)modulation.delayMapScale * value;
+    }
+}
+
+template <typename SampleType>
+DspKernels::ModulationParameters FlanGELVSAudioProcessor::getModulationParameters() const
+{
+    /*juce::jmap(lfoOut, -1.0f, 1.0f, minimum, maximum) of the delay range as one multiply-add*/
+    const auto range = getDelayRange(activeDelayRange);
+    const SampleType delayMapScale = ((SampleType)range.maximumSeconds - (SampleType)range.minimumSeconds) * (SampleType)0.5;
+    const SampleType delayMapOffset = (SampleType)range.minimumSeconds + delayMapScale;
+
+    /*At reduced quality only every 2^controlRateShift-th sample is computed and held*/
+    return { phaseLFO, *rateValue * inverseSampleRate * (double)(1 << controlRateShift),
+             ampValue->get() * depthValue->get(), phaseOffsetValue->get(),
+             (float)delayMapOffset, (float)delayMapScale };
+}
+
+template <typename SampleType>
+void FlanGELVSAudioProcessor::getStageModulation(CascadeModulation<SampleType>& modulation, int stageIndex,
+                                                 const SampleType*& lfo, const SampleType*& delay)
+{
+    const auto parameters = getModulationParameters<SampleType>();
+
+    if (!modulation.computed) {
+        computeModulation(parameters, modulation.lfo, modulation.delay, modulation.numValues);
+        modulation.computed = true;
+    }
+
+    lfo = modulation.lfo;
+    delay = modulation.delay;
+
+    /*Without a spread every stage follows the first one's LFO*/
+    const float stageOffset = juce::MathConstants<float>::twoPi * stageSpreadValue->get() * (float)stageIndex;
+    if (stageOffset == 0.0f)
+        return;
+
+    if (!modulation.quadratureComputed) {
+        /*(the delay targets a quarter cycle on are not needed: stageDelay is overwritten below)*/
+        auto quarterCycleOn = parameters;
+        quarterCycleOn.phaseOffset += juce::MathConstants<float>::halfPi;
+        computeModulation(quarterCycleOn, modulation.quadrature, modulation.stageDelay, modulation.numValues);
+        modulation.quadratureComputed = true;
+    }
+
+    /*sin(x + offset) = sin(x) cos(offset) + cos(x) sin(offset), for the LFO and its quadrature
+      already scaled by the gain*/
+    const SampleType cosOffset = std::cos((SampleType)stageOffset);
+    const SampleType sinOffset = std::sin((SampleType)stageOffset);
+    const SampleType mapOffset = (SampleType)parameters.delayMapOffset;
+    const SampleType mapScale = (SampleType)parameters.delayMapScale;
+
+    for (int i = 0; i < modulation.numValues; i++) {
+        modulation.stageLfo[i] = modulation.lfo[i] * cosOffset + modulation.quadrature[i] * sinOffset;
+        modulation.stageDelay[i] = mapOffset + mapScale * modulation.stageLfo[i];
+    }
 
-        /*Calulate read head position*/
+    lfo = modulation.stageLfo;
+    delay = modulation.stageDelay;
+}
+
+template <FlanGELVSAudioProcessor::DelayPath path, typename SampleType, typename LengthType>
+void FlanGELVSAudioProcessor::processSamples(DelayStage& stage, const SampleType* lfoValues, const SampleType* delayTargets,
+                                             float* left, float* right, LengthType numSamples)
+{
+    jassert((int)numSamples <= processingQuantum);
+    constexpr bool crossfading = path == DelayPath::crossfading;
+    static_assert(std::is_same<SampleType, float>::value || (path != DelayPath::cached && path != DelayPath::recording),
+                  "the trajectory cache stores single precision positions");
+
+    /*Parameters are read once per call: at most one quantum late for changes made during a block*/
+    const SampleType feedback = *feedbackValue;
+    const float dryWetMix = *dryWetValue;
+    const SampleType sampleRateReal = (SampleType)sampleRateFloat;
+
+    /*The LFO's delay map, for the telemetry of the cached path*/
+    const auto range = getDelayRange(activeDelayRange);
+    const SampleType delayMapScale = ((SampleType)range.maximumSeconds - (SampleType)range.minimumSeconds) * (SampleType)0.5;
+    const SampleType delayMapOffset = (SampleType)range.minimumSeconds + delayMapScale;
+    const auto previousRange = getDelayRange(previousDelayRange);
+    const SampleType previousMapScale = ((SampleType)previousRange.maximumSeconds - (SampleType)previousRange.minimumSeconds) * (SampleType)0.5;
+    const SampleType previousMapOffset = (SampleType)previousRange.minimumSeconds + previousMapScale;
+
+    /*LFO (scaled by Amplitude and Depth) and the delay time it maps to were computed for the
+      whole quantum at once by the caller; the feedback loop below has to go sample by sample.
+      At reduced quality each value is held for 2^controlShift samples*/
+    const int controlShift = controlRateShift;
+    jassert(path == DelayPath::cached || (lfoValues != nullptr && delayTargets != nullptr));
+
+    /*Wet signal of the quantum, mixed with the dry input by the kernels at the end*/
+    float wetLeft[processingQuantum], wetRight[processingQuantum];
+
+    /*The state lives in locals during the loop: the compiler cannot keep members in
+      registers while writing through the channel pointers, which might alias them*/
+    SampleType smoothedDelay = (SampleType)stage.delayTime;
+    SampleType previousSmoothedDelay = (SampleType)stage.previousDelayTime;
+    SampleType delayInSamples = (SampleType)stage.delayTimeInSamples;
+    SampleType feedbackL = (SampleType)stage.feedbackLeft;
+    SampleType feedbackR = (SampleType)stage.feedbackRight;
+    int writeHead = stage.circularBufferWriteHead;
+    int crossfadeRemaining = crossfadeSamplesRemaining;
+    int telemetryCount = telemetryCounter;
+    const bool cubic = cubicInterpolation;
+    int interpolationFade = interpolationFadeRemaining;
+    float telemetryPeak = telemetryFeedbackPeak;
+    /*Only the first stage feeds the editor's displays*/
+    const bool publishTelemetry = &stage == &stages[0];
+    double* const bufferLeft = stage.delayBuffer.getLeft();
+    double* const bufferRight = stage.delayBuffer.getRight();
+    constexpr int frameStride = ResizableDelayBuffer::frameStride;
+    const int circularBufferLength = stage.delayBuffer.getLength();
+    /*Longest delay the buffer can hold with the interpolation's extra sample*/
+    const SampleType maxDelayInSamples = (SampleType)(circularBufferLength - 2);
+
+    /*A delay as a whole number of samples behind the write head and the interpolation weight
+      of the sample after it (what the trajectory cache stores, in single precision)*/
+    struct Tap
+    {
+        int readOffset;
+        SampleType readWeight;
+    };
+
+    auto splitDelay = [](SampleType delaySamples) {
+        const SampleType wholeSamples = std::ceil(delaySamples);
+        return Tap { (int)wholeSamples, wholeSamples - delaySamples };
+    };
+
+    /*Interpolated read of 'tap' on both channels: cubic needs a written sample either side
+      of the pair, so a delay of less than two samples stays linear*/
+    auto readDelayTap = [&](Tap tap, SampleType& outLeft, SampleType& outRight, bool cubicRead) {
         /*Set up the delay read head*/
-        delayReadHead = circularBufferWriteHead - delayTimeInSamples;
+        int readHeadInt_x = writeHead - tap.readOffset;
         /*In case it's not within the buffer range*/
-        if (delayReadHead < 0) {
-            delayReadHead = circularBufferLength + delayReadHead;
+        if (readHeadInt_x < 0) {
+            readHeadInt_x += circularBufferLength;
         }
 
-        /*Calculate interpolation points*/
-        /*Set up variables for linear interpolation*/
-        int readHeadInt_x = (int)delayReadHead;
-        int readHeadInt_x1 = readHeadInt_x + 1;
-        float readHeadRemainderFloat = delayReadHead - readHeadInt_x;
         /*Wrapping around circular buffer if we are over the length*/
-        if (readHeadInt_x >= circularBufferLength) {
-            readHeadInt_x -= circularBufferLength;
+        int readHeadInt_x1 = readHeadInt_x + 1;
+        if (readHeadInt_x1 >= circularBufferLength) {
+            readHeadInt_x1 -= circularBufferLength;
+        }
+
+        if (cubicRead && tap.readOffset >= 2) {
+            int readHeadInt_x_m1 = readHeadInt_x - 1;
+            if (readHeadInt_x_m1 < 0) {
+                readHeadInt_x_m1 += circularBufferLength;
+            }
+
+            int readHeadInt_x2 = readHeadInt_x1 + 1;
+            if (readHeadInt_x2 >= circularBufferLength) {
+                readHeadInt_x2 -= circularBufferLength;
+            }
+
+            outLeft = cubic_interp<SampleType>(bufferLeft[readHeadInt_x_m1 * frameStride], bufferLeft[readHeadInt_x * frameStride],
+                                   bufferLeft[readHeadInt_x1 * frameStride], bufferLeft[readHeadInt_x2 * frameStride], tap.readWeight);
+            outRight = cubic_interp<SampleType>(bufferRight[readHeadInt_x_m1 * frameStride], bufferRight[readHeadInt_x * frameStride],
+                                    bufferRight[readHeadInt_x1 * frameStride], bufferRight[readHeadInt_x2 * frameStride], tap.readWeight);
+            return;
+        }
+
+        outLeft = linear_interp<SampleType>(bufferLeft[readHeadInt_x * frameStride], bufferLeft[readHeadInt_x1 * frameStride], tap.readWeight);
+        outRight = linear_interp<SampleType>(bufferRight[readHeadInt_x * frameStride], bufferRight[readHeadInt_x1 * frameStride], tap.readWeight);
+    };
+
+    /*Iterate all samples of the quantum*/
+    for (int i = 0; i < (int)numSamples; i++) {
+
+        SampleType lfoOut = 0;
+        Tap tap;
+
+        if (path == DelayPath::cached) {
+            /*Steady parameters: the read position comes straight from the recorded cycle*/
+            const auto entry = trajectoryCache.next();
+            tap = { entry.readOffset, entry.readWeight };
+            delayInSamples = (SampleType)tap.readOffset - tap.readWeight;
+        }
+        else {
+            /*LFO output with Depth applied, and the delay time it maps to within the delay range
+              (1ms to 5ms for the flanger)*/
+            lfoOut = lfoValues[i >> controlShift];
+            const SampleType lfoOutMapped = delayTargets[i >> controlShift];
+
+            /*Calculate the delay time in samples accoring to the LFO, within what the buffer holds*/
+            smoothedDelay = smoothedDelay - (SampleType)0.001 * (smoothedDelay - lfoOutMapped);
+            delayInSamples = juce::jlimit((SampleType)1, maxDelayInSamples, sampleRateReal * smoothedDelay);
+            tap = splitDelay(delayInSamples);
+
+            if (path == DelayPath::recording)
+                trajectoryCache.record({ tap.readOffset, (float)tap.readWeight });
+        }
+
+        /*Write into circular buffer : populate the circular buffer with the current write sample plus feedback*/
+        bufferLeft[writeHead * frameStride] = left[i] + feedbackL;
+        bufferRight[writeHead * frameStride] = (right != nullptr ? right[i] : 0.0f) + feedbackR;
+
+        /*Perform the interpolation for delay sample on both left and right output samples*/
+        SampleType delay_sample_left, delay_sample_right;
+        readDelayTap(tap, delay_sample_left, delay_sample_right, cubic);
+
+        if (interpolationFade > 0) {
+            /*Just switched interpolation order: fade out the read with the previous one*/
+            SampleType other_sample_left, other_sample_right;
+            readDelayTap(tap, other_sample_left, other_sample_right, !cubic);
+
+            const SampleType fade = (SampleType)interpolationFade * ((SampleType)1 / interpolationCrossfadeLength);
+            delay_sample_left = delay_sample_left + fade * (other_sample_left - delay_sample_left);
+            delay_sample_right = delay_sample_right + fade * (other_sample_right - delay_sample_right);
+            interpolationFade--;
         }
 
-        /*Perform linear interpolation for delay sample on both left and right output samples*/
-        float delay_sample_left = linear_interp(circularBufferLeft.get()[readHeadInt_x], circularBufferLeft.get()[readHeadInt_x1], readHeadRemainderFloat);
-        float delay_sample_right = linear_interp(circularBufferRight.get()[readHeadInt_x], circularBufferRight.get()[readHeadInt_x1], readHeadRemainderFloat);
+        if (crossfading) {
+            /*The tap of the previous range keeps its own mapping and smoothing while it fades out*/
+            previousSmoothedDelay = previousSmoothedDelay - (SampleType)0.001 * (previousSmoothedDelay - (previousMapOffset + previousMapScale * lfoOut));
+
+            SampleType previous_sample_left, previous_sample_right;
+            readDelayTap(splitDelay(juce::jlimit((SampleType)1, maxDelayInSamples, sampleRateReal * previousSmoothedDelay)),
+                         previous_sample_left, previous_sample_right, cubic);
+
+            const SampleType fade = (SampleType)1 - (SampleType)crossfadeRemaining * ((SampleType)1 / delayRangeCrossfadeLength);
+            delay_sample_left = previous_sample_left + fade * (delay_sample_left - previous_sample_left);
+            delay_sample_right = previous_sample_right + fade * (delay_sample_right - previous_sample_right);
+            crossfadeRemaining = juce::jmax(0, crossfadeRemaining - 1);
+        }
 
         /*Calculate the feedback according to the Feedback parameter*/
-        feedbackLeft = delay_sample_left * (*feedbackValue);
-        feedbackRight = delay_sample_right * (*feedbackValue);
+        feedbackL = delay_sample_left * feedback;
+        feedbackR = delay_sample_right * feedback;
+
+        /*Publish a decimated snapshot for the editor (dropped if nobody is reading)*/
+        telemetryPeak = juce::jmax(telemetryPeak, (float)std::abs(feedbackL), (float)std::abs(feedbackR));
+        if (publishTelemetry && ++telemetryCount >= telemetryDecimation) {
+            /*The cached path has no LFO value: show the one the (smoothed) delay corresponds to*/
+            if (path == DelayPath::cached)
+                lfoOut = (delayInSamples / sampleRateReal - delayMapOffset) / delayMapScale;
+
+            telemetry.push({ (float)lfoOut, (float)delayInSamples, telemetryPeak });
+            telemetryCount = 0;
+            telemetryPeak = 0;
+        }
 
         /*Update of the buffer */
         /*Increment the write head circular buffer iterator*/
-        circularBufferWriteHead++;
+        writeHead++;
         /*In case it's out of range*/
-        if (circularBufferWriteHead >= circularBufferLength) {
-            circularBufferWriteHead = 0;
+        if (writeHead >= circularBufferLength) {
+            writeHead = 0;
         }
 
-        /*Sum the dry/wet to the delayed signals according to the DryWet parameter*/
-        buffer.setSample(0, i, buffer.getSample(0, i) * (1 - (*dryWetValue)) + delay_sample_left * (*dryWetValue));
-        buffer.setSample(1, i, buffer.getSample(1, i) * (1 - (*dryWetValue)) + delay_sample_right * (*dryWetValue));
+        wetLeft[i] = (float)delay_sample_left;
+        wetRight[i] = (float)delay_sample_right;
+    }
 
+    /*Sum the dry/wet to the delayed signals according to the DryWet parameter*/
+    kernels->mixDryWet(left, wetLeft, dryWetMix, (int)numSamples);
+    if (right != nullptr)
+        kernels->mixDryWet(right, wetRight, dryWetMix, (int)numSamples);
+
+    /*(the LFO phase is moved on by the caller, once all the stages have run)*/
+    stage.delayTime = path == DelayPath::cached ? delayInSamples / sampleRateReal : smoothedDelay;
+    stage.previousDelayTime = previousSmoothedDelay;
+    stage.delayTimeInSamples = delayInSamples;
+    stage.feedbackLeft = feedbackL;
+    stage.feedbackRight = feedbackR;
+    stage.circularBufferWriteHead = writeHead;
+    stage.samplesWritten += (int)numSamples;
+    crossfadeSamplesRemaining = crossfadeRemaining;
+    interpolationFadeRemaining = interpolationFade;
+
+    if (publishTelemetry) {
+        telemetryCounter = telemetryCount;
+        telemetryFeedbackPeak = telemetryPeak;
     }
 }
 
@@ -310,12 +902,42 @@ void FlanGELVSAudioProcessor::getStateInformation (juce::MemoryBlock& destData)
     // You should use this method to store your parameters in the memory block.
     // You could do that either as raw data, or use the XML or ValueTree classes
     // as intermediaries to make it easy to save and load complex data.
+
+    /*Parameter values, plus the CPU load of this instance as a diagnostic (ignored when loading)*/
+    juce::XmlElement state("FLANGELVS");
+
+    for (auto* parameter : { dryWetValue, depthValue, rateValue, feedbackValue, phaseOffsetValue, ampValue, stageSpreadValue })
+        state.setAttribute(parameter->paramID, parameter->get());
+
+    state.setAttribute(delayRangeValue->paramID, delayRangeValue->getIndex());
+    state.setAttribute(stagesValue->paramID, stagesValue->get());
+    state.setAttribute(adaptiveQualityValue->paramID, adaptiveQualityValue->get());
+    state.addChildElement(cpuLoad.getSnapshot().createXml().release());
+    copyXmlToBinary(state, destData);
 }
 
 void FlanGELVSAudioProcessor::setStateInformation (const void* data, int sizeInBytes)
 {
     // You should use this method to restore your parameters from this memory block,
     // whose contents will have been created by the getStateInformation() call.
+
+    auto state = getXmlFromBinary(data, sizeInBytes);
+
+    if (state == nullptr || !state->hasTagName("FLANGELVS"))
+        return;
+
+    for (auto* parameter : { dryWetValue, depthValue, rateValue, feedbackValue, phaseOffsetValue, ampValue, stageSpreadValue })
+        if (state->hasAttribute(parameter->paramID))
+            *parameter = (float)state->getDoubleAttribute(parameter->paramID);
+
+    if (state->hasAttribute(delayRangeValue->paramID))
+        *delayRangeValue = state->getIntAttribute(delayRangeValue->paramID);
+
+    if (state->hasAttribute(stagesValue->paramID))
+        *stagesValue = state->getIntAttribute(stagesValue->paramID);
+
+    if (state->hasAttribute(adaptiveQualityValue->paramID))
+        *adaptiveQualityValue = state->getBoolAttribute(adaptiveQualityValue->paramID);
 }
 
 //==============================================================================
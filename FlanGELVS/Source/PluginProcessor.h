@@ -9,7 +9,13 @@
 #pragma once
 
 #include <JuceHeader.h>
-#define MAX_DELAY_TIME 2
+#include "TelemetryFifo.h"
+#include "SpectrumAnalyser.h"
+#include "CpuLoadMeter.h"
+#include "ResizableDelayBuffer.h"
+#include "DspKernels.h"
+#include "DelayTrajectoryCache.h"
+#include "QualityGovernor.h"
 
 //==============================================================================
 /**
@@ -31,6 +37,10 @@ public:
 
     void processBlock (juce::AudioBuffer<float>&, juce::MidiBuffer&) override;
 
+    /* Offline renders switch to the maximum quality level, live playback back to the
+       realtime ones; the latency of the new level is reported to the host */
+    void setNonRealtime (bool isNonRealtime) noexcept override;
+
     //==============================================================================
     juce::AudioProcessorEditor* createEditor() override;
     bool hasEditor() const override;
@@ -58,29 +68,226 @@ public:
     /* Function: Linear Interpolation  */
     /* Calculate the interpolated sample at position 'inPhase' between two samples 'x' and 'x1 */
 
-    float linear_interp(float sample_x, float sample_x1, float inPhase) {
+    template <typename SampleType>
+    SampleType linear_interp(SampleType sample_x, SampleType sample_x1, SampleType inPhase) {
         return (1 - inPhase) * sample_x + inPhase * sample_x1;
     }
     /*===============================================================================*/
+    /* Function: Cubic Interpolation  */
+    /* 4-point Hermite interpolation at position 'inPhase' between 'x' and 'x1', using the samples
+       either side of them ('x_m1' before 'x', 'x2' after 'x1') */
+
+    template <typename SampleType>
+    SampleType cubic_interp(SampleType sample_x_m1, SampleType sample_x, SampleType sample_x1, SampleType sample_x2, SampleType inPhase) {
+        const SampleType c1 = (SampleType)0.5 * (sample_x1 - sample_x_m1);
+        const SampleType c2 = sample_x_m1 - (SampleType)2.5 * sample_x + (SampleType)2 * sample_x1 - (SampleType)0.5 * sample_x2;
+        const SampleType c3 = (SampleType)0.5 * (sample_x2 - sample_x_m1) + (SampleType)1.5 * (sample_x - sample_x1);
+        return ((c3 * inPhase + c2) * inPhase + c1) * inPhase + sample_x;
+    }
+    /*===============================================================================*/
+
+    /* Offline rendering support: puts the LFO phase and every stage's smoothed delay time where
+       a serial render started at sample 0 would have them at 'samplePosition', for the current
+       parameter values (exactly at the offline quality level). Call it after prepareToPlay() */
+    void seekModulation(juce::int64 samplePosition);
+
+    /* How many samples of input must be run through a freshly prepared processor, placed with
+       seekModulation(), before its output matches a processor that has been running all along
+       to within 'toleranceDecibels', for the current parameter values */
+    int getPreRollSamples(double sampleRate, float toleranceDecibels) const;
+
+    /* Decimated LFO / delay / feedback snapshots, drained by the editor */
+    TelemetryFifo& getTelemetry() { return telemetry; }
+
+    /* Input/output spectra, computed off the audio thread while an editor is open */
+    SpectrumAnalyser& getAnalyser() { return analyser; }
+
+    /* Current comb-filter settings, for drawing its theoretical response */
+    float getCurrentDelayInSamples() const { return currentDelayInSamples.load(); }
+    float getFeedbackAmount() const { return feedbackValue->get(); }
+    float getDryWetAmount() const { return dryWetValue->get(); }
+
+    /* Delay times the LFO sweeps between for each choice of the "Delay Range" parameter */
+    struct DelayRange
+    {
+        const char* name;
+        float minimumSeconds;
+        float maximumSeconds;
+    };
+
+    static DelayRange getDelayRange(int index);
+    static constexpr int numDelayRanges = 3;
+
+    /* Range selected by the parameter, for the editor's displays */
+    DelayRange getSelectedDelayRange() const { return getDelayRange(delayRangeValue->getIndex()); }
+
+    /* Most flangers the "Stages" parameter chains inside one instance */
+    static constexpr int maxStages = 4;
+
+    /* Timing of every processBlock call of this instance (also written into the state) */
+    CpuLoadMeter& getCpuLoad() { return cpuLoad; }
+
+    /* Instruction set of the kernels chosen by the last prepareToPlay */
+    DspKernels::Variant getKernelVariant() const { return kernels->variant; }
+
+    /* QualityGovernor level the last block was processed at (the default one unless the
+       "Adaptive Quality" parameter is on) */
+    int getQualityLevel() const { return qualityLevel.load(); }
+    bool isAdaptiveQualityEnabled() const { return adaptiveQualityValue->get(); }
+
+    /* Between blocks, never while one is being processed: lets tests drive the governor
+       through its levels whatever the machine's load */
+    void setQualityThresholds(float stepDown, float stepUp) { governor.setThresholds(stepDown, stepUp); }
 
 private:
-    float phaseLFO;
-    float delayTime;
+    /* Samples per internal processing quantum; every full quantum runs a loop with a
+       compile-time trip count */
+    static constexpr int processingQuantum = 32;
+
+    /* Where the delay read positions come from */
+    enum class DelayPath
+    {
+        computed,       // LFO, smoothing and read position every sample
+        recording,      // the same, stored into the trajectory cache
+        cached,         // played back from the trajectory cache
+        crossfading     // computed, plus a second tap in the previous delay range fading out
+    };
+
+    /* One flanger of the cascade: its own delay line, smoothing and feedback. The LFO phase,
+       the parameters and the delay range are shared by every stage */
+    struct DelayStage
+    {
+        /*History sized to the delay range, resized off the audio thread*/
+        ResizableDelayBuffer delayBuffer;
+        double delayTime = 0;
+        double previousDelayTime = 0;
+        double delayTimeInSamples = 0;
+        double feedbackLeft = 0;
+        double feedbackRight = 0;
+        int circularBufferWriteHead = 0;
+        juce::int64 samplesWritten = 0;    // since prepareToPlay, for the buffer's history copy
+        bool enabled = false;      // wanted by the Stages parameter
+        bool running = false;      // processed: enabled, or still fading out
+        float level = 0;           // 0 = bypassed, 1 = fully in the chain
+    };
+
+    /* The LFO of one quantum, computed when the first stage that needs it asks and shared
+       by the whole cascade. A stage with a phase offset gets it turned by that angle from
+       the LFO and its quadrature, rather than running the sines again */
+    template <typename Type>
+    struct CascadeModulation
+    {
+        using SampleType = Type;
+        SampleType lfo[processingQuantum], delay[processingQuantum];
+        SampleType quadrature[processingQuantum];      // the LFO a quarter cycle on
+        SampleType stageLfo[processingQuantum], stageDelay[processingQuantum];
+        int numValues = 0;
+        bool computed = false;
+        bool quadratureComputed = false;
+    };
+
+    /* The flanger itself: one stage for 'numSamples' samples from the given channel pointers
+       ('right' is nullptr in mono), with the LFO values and delay targets of its control
+       points (unused, and nullptr, on the cached path). SampleType is the precision of the
+       modulation, the smoothing and the interpolation: double at the maximum quality level,
+       float otherwise. LengthType is int for the end of a block, or
+       std::integral_constant<int, processingQuantum> for full quanta */
+    template <DelayPath path, typename SampleType, typename LengthType>
+    void processSamples(DelayStage& stage, const SampleType* lfoValues, const SampleType* delayTargets,
+                        float* left, float* right, LengthType numSamples);
+
+    /* The first stage's modulation for the current quantum, with the delay map computed at
+       SampleType precision */
+    template <typename SampleType>
+    DspKernels::ModulationParameters getModulationParameters() const;
+
+    /* LFO and delay targets of stage 'stageIndex' for the current quantum, computing the
+       shared values on first use */
+    template <typename SampleType>
+    void getStageModulation(CascadeModulation<SampleType>&, int stageIndex, const SampleType*& lfo, const SampleType*& delay);
+
+    /* LFO and delay targets of a quantum: the vector kernels in single precision, std::sin
+       in double precision */
+    void computeModulation(const DspKernels::ModulationParameters&, float* lfo, float* delay, int numSamples);
+    void computeModulation(const DspKernels::ModulationParameters&, double* lfo, double* delay, int numSamples);
+
+    /* Audio thread, once per block: follows the Delay Range parameter. The buffer is grown
+       in the background before a fade to a longer range, and shrunk after a fade to a
+       shorter one */
+    void updateDelayRange();
+
+    /* Audio thread, once per block: follows the Stages parameter. A stage joins the chain
+       once its buffer has been grown in the background, and leaves it after fading out */
+    void updateStages();
+
+    /* Length of the fade of a stage into or out of the chain */
+    static constexpr int stageFadeLength = 2048;
+
+    /* Samples of history needed for the longest delay a range reaches (at full amplitude
+       and depth), at the given sample rate or at the prepared one */
+    int getDelayBufferLength(int rangeIndex, double sampleRate) const;
+    int getDelayBufferLength(int rangeIndex) const { return getDelayBufferLength(rangeIndex, sampleRateFloat); }
+
+    /* Audio thread, once per block: picks the quality level (the maximum one offline, else from
+       the governor when adaptive quality is on) and starts a crossfade when the interpolation
+       order changes */
+    void updateQuality(int numSamples);
+
+    /* Tells the host the latency of the quality level the next blocks will run at */
+    void reportLatency();
+
+    /* Length of the fade between linear and cubic interpolation */
+    static constexpr int interpolationCrossfadeLength = 64;
+
+    /* Length of the fade between two delay ranges */
+    static constexpr int delayRangeCrossfadeLength = 2048;
+
+    double phaseLFO;
+    double inverseSampleRate = 1.0 / 44100.0;
+    float sampleRateFloat = 44100.0f;
     juce::AudioParameterFloat* dryWetValue;
     juce::AudioParameterFloat* depthValue;
     juce::AudioParameterFloat* rateValue;
     juce::AudioParameterFloat* phaseOffsetValue;
     juce::AudioParameterFloat* feedbackValue;
     juce::AudioParameterFloat* ampValue;
+    juce::AudioParameterChoice* delayRangeValue;
+    juce::AudioParameterBool* adaptiveQualityValue;
+    juce::AudioParameterInt* stagesValue;
+    juce::AudioParameterFloat* stageSpreadValue;
     float dryWet;
-    float feedbackLeft;
-    float feedbackRight;
-    float delayTimeInSamples;
-    float delayReadHead;
-    int circularBufferLength;
-    int circularBufferWriteHead;
-    std::unique_ptr<double> circularBufferLeft;
-    std::unique_ptr<double> circularBufferRight;
+
+    /*Flangers in series, processed together one quantum at a time; the first is always on*/
+    std::array<DelayStage, maxStages> stages;
+    CascadeModulation<float> singleModulation;
+    CascadeModulation<double> doubleModulation;
+    int activeDelayRange = 0;
+    int previousDelayRange = 0;
+    int crossfadeSamplesRemaining = 0;
+
+    /*One recorded cycle of read positions, played back while the modulation holds still*/
+    DelayTrajectoryCache trajectoryCache;
+
+    /*Telemetry for the editor: one frame every 'telemetryDecimation' samples*/
+    TelemetryFifo telemetry;
+    int telemetryDecimation;
+    int telemetryCounter;
+    float telemetryFeedbackPeak;
+
+    SpectrumAnalyser analyser;
+    std::atomic<float> currentDelayInSamples { 0.0f };
+    CpuLoadMeter cpuLoad;
+
+    /*Quality stepped down and back up against the measured block load*/
+    QualityGovernor governor;
+    std::atomic<int> qualityLevel { QualityGovernor::defaultLevel };
+    int controlRateShift = 0;
+    bool cubicInterpolation = false;
+    bool doublePrecision = false;
+    int interpolationFadeRemaining = 0;
+
+    /*Vectorised parts of the loop, for the instruction set of this CPU*/
+    const DspKernels::Table* kernels = &DspKernels::getTable(DspKernels::Variant::generic);
     //==============================================================================
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (FlanGELVSAudioProcessor)
 };
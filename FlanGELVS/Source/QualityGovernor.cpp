@@ -0,0 +1,81 @@
+/*
+  ==============================================================================
+
+    QualityGovernor.cpp
+    Created: 19 Oct 2026
+    Author:  GELVS
+
+  ==============================================================================
+*/
+
+#include "QualityGovernor.h"
+
+namespace
+{
+    /* Time for a new level to show in the measurements before stepping down again */
+    constexpr double stepDownHoldSeconds = 0.05;
+
+    /* Headroom needed before stepping up again */
+    constexpr double stepUpHoldSeconds = 2.0;
+}
+
+QualityGovernor::Quality QualityGovernor::getQuality (int levelToUse) noexcept
+{
+    static const Quality qualities[numLevels] = {
+        { 4, false, false, 0 },
+        { 2, false, false, 0 },
+        { 0, false, false, 0 },
+        { 0, true,  false, 0 },
+        { 0, true,  true,  0 }
+    };
+
+    return qualities[juce::jlimit (0, numLevels - 1, levelToUse)];
+}
+
+const char* QualityGovernor::getLevelName (int levelToUse) noexcept
+{
+    static const char* const names[numLevels] = { "lowest", "low", "normal", "high", "offline" };
+    return names[juce::jlimit (0, numLevels - 1, levelToUse)];
+}
+
+void QualityGovernor::prepare (double newSampleRate) noexcept
+{
+    sampleRate = newSampleRate;
+    level = defaultLevel;
+    smoothedLoad = 0.0f;
+    samplesSinceChange = 0;
+    samplesWithHeadroom = 0;
+}
+
+void QualityGovernor::setThresholds (float stepDown, float stepUp) noexcept
+{
+    jassert (stepUp < stepDown);
+    stepDownLoad = stepDown;
+    stepUpLoad = stepUp;
+}
+
+int QualityGovernor::update (float previousBlockLoad, int numSamples) noexcept
+{
+    /*Smoothed over about 50 ms for stepping up, so that a single quiet block does not count*/
+    const float alpha = juce::jmin (1.0f, (float) (numSamples / (0.05 * sampleRate)));
+    smoothedLoad += alpha * (previousBlockLoad - smoothedLoad);
+
+    samplesSinceChange = juce::jmin (samplesSinceChange + numSamples, std::numeric_limits<int>::max() / 2);
+    samplesWithHeadroom = smoothedLoad < stepUpLoad ? juce::jmin (samplesWithHeadroom + numSamples, std::numeric_limits<int>::max() / 2)
+                                                    : 0;
+
+    if (previousBlockLoad > stepDownLoad && level > 0 && samplesSinceChange >= (int) (stepDownHoldSeconds * sampleRate))
+    {
+        --level;
+        samplesSinceChange = 0;
+        samplesWithHeadroom = 0;
+    }
+    else if (level < highestRealtimeLevel && samplesWithHeadroom >= (int) (stepUpHoldSeconds * sampleRate))
+    {
+        ++level;
+        samplesSinceChange = 0;
+        samplesWithHeadroom = 0;
+    }
+
+    return level;
+}
@@ -0,0 +1,79 @@
+/*
+  ==============================================================================
+
+    QualityGovernor.h
+    Created: 19 Oct 2026
+    Author:  GELVS
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+
+//==============================================================================
+/**
+    Trades quality for time when processBlock gets close to its deadline.
+
+    Once per block it is given the load of the previous block (processing time
+    over block duration, from the CpuLoadMeter). A block over the step-down
+    threshold drops one quality level straight away; the level only comes back
+    up, one step at a time, after a couple of seconds with the load below the
+    (much lower) step-up threshold. The processor crossfades the interpolation
+    changes, and control-rate changes go through the delay smoother, so the
+    steps are inaudible.
+
+    Levels, lowest first:
+        0   linear interpolation, modulation computed every 16th sample
+        1   linear interpolation, modulation computed every 4th sample
+        2   linear interpolation, modulation computed every sample (the processor
+            without the governor)
+        3   cubic interpolation, modulation computed every sample
+        4   as 3, with the modulation, smoothing and interpolation in double precision
+            and the LFO from std::sin; only used for offline renders, never chosen by
+            the governor
+
+    Audio thread only, except for prepare().
+*/
+class QualityGovernor
+{
+public:
+    struct Quality
+    {
+        int controlRateShift;      // modulation computed every 2^shift samples
+        bool cubicInterpolation;
+        bool doublePrecision;
+        int latencySamples;        // reported to the host while the level is in use
+    };
+
+    static constexpr int numLevels = 5;
+    static constexpr int defaultLevel = 2;
+    static constexpr int highestRealtimeLevel = 3;
+    static constexpr int offlineLevel = 4;
+
+    static Quality getQuality (int level) noexcept;
+    static const char* getLevelName (int level) noexcept;
+
+    /* Message thread: starts again from the default level */
+    void prepare (double sampleRate) noexcept;
+
+    /* Fractions of the block duration: a block above 'stepDown' drops a level, and a
+       smoothed load below 'stepUp' for long enough raises it */
+    void setThresholds (float stepDown, float stepUp) noexcept;
+
+    /* Audio thread, at the start of each block: the level to process it with */
+    int update (float previousBlockLoad, int numSamples) noexcept;
+
+    int getLevel() const noexcept   { return level; }
+
+private:
+    double sampleRate = 44100.0;
+    float stepDownLoad = 0.5f;
+    float stepUpLoad = 0.2f;
+
+    int level = defaultLevel;
+    float smoothedLoad = 0.0f;
+    int samplesSinceChange = 0;
+    int samplesWithHeadroom = 0;
+};
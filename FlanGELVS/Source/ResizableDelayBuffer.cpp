@@ -0,0 +1,443 @@
+/*
+  ==============================================================================
+
+    ResizableDelayBuffer.cpp
+    Created: 19 Oct 2026
+    Author:  GELVS
+
+  ==============================================================================
+*/
+
+#include "ResizableDelayBuffer.h"
+
+#if JUCE_WINDOWS
+ #ifndef NOMINMAX
+  #define NOMINMAX
+ #endif
+ #ifndef WIN32_LEAN_AND_MEAN
+  #define WIN32_LEAN_AND_MEAN
+ #endif
+ #include <windows.h>
+#elif JUCE_MAC || JUCE_IOS
+ #include <dispatch/dispatch.h>
+#else
+ #include <cerrno>
+ #include <semaphore.h>
+ #include <time.h>
+#endif
+
+namespace
+{
+    //==============================================================================
+    /* Counting semaphore that an audio thread can post to: unlike juce::WaitableEvent,
+       whose signal() locks a mutex, posting is an atomic increment (plus a kernel wake
+       when the thread is asleep) */
+    class WakeUpSemaphore
+    {
+    public:
+        WakeUpSemaphore()
+        {
+           #if JUCE_WINDOWS
+            handle = CreateSemaphore (nullptr, 0, 0x7fffffff, nullptr);
+           #elif JUCE_MAC || JUCE_IOS
+            semaphore = dispatch_semaphore_create (0);
+           #else
+            sem_init (&semaphore, 0, 0);
+           #endif
+        }
+
+        ~WakeUpSemaphore()
+        {
+           #if JUCE_WINDOWS
+            CloseHandle (handle);
+           #elif JUCE_MAC || JUCE_IOS
+            dispatch_release (semaphore);
+           #else
+            sem_destroy (&semaphore);
+           #endif
+        }
+
+        void post() noexcept
+        {
+           #if JUCE_WINDOWS
+            ReleaseSemaphore (handle, 1, nullptr);
+           #elif JUCE_MAC || JUCE_IOS
+            dispatch_semaphore_signal (semaphore);
+           #else
+            sem_post (&semaphore);
+           #endif
+        }
+
+        /* Returns after a post, or after 'milliseconds' (-1 to wait for a post however long it takes) */
+        void wait (int milliseconds) noexcept
+        {
+           #if JUCE_WINDOWS
+            WaitForSingleObject (handle, milliseconds < 0 ? INFINITE : (DWORD) milliseconds);
+           #elif JUCE_MAC || JUCE_IOS
+            dispatch_semaphore_wait (semaphore, milliseconds < 0 ? DISPATCH_TIME_FOREVER
+                                                                 : dispatch_time (DISPATCH_TIME_NOW, (int64_t) milliseconds * (int64_t) NSEC_PER_MSEC));
+           #else
+            if (milliseconds < 0)
+            {
+                while (sem_wait (&semaphore) != 0 && errno == EINTR) {}
+                return;
+            }
+
+            timespec deadline;
+            clock_gettime (CLOCK_REALTIME, &deadline);
+            deadline.tv_sec += milliseconds / 1000;
+            deadline.tv_nsec += (long) (milliseconds % 1000) * 1000000L;
+
+            if (deadline.tv_nsec >= 1000000000L)
+            {
+                ++deadline.tv_sec;
+                deadline.tv_nsec -= 1000000000L;
+            }
+
+            while (sem_timedwait (&semaphore, &deadline) != 0 && errno == EINTR) {}
+           #endif
+        }
+
+    private:
+       #if JUCE_WINDOWS
+        HANDLE handle;
+       #elif JUCE_MAC || JUCE_IOS
+        dispatch_semaphore_t semaphore;
+       #else
+        sem_t semaphore;
+       #endif
+
+        JUCE_DECLARE_NON_COPYABLE (WakeUpSemaphore)
+    };
+}
+
+//==============================================================================
+/**
+    One low priority thread per process, shared by all the delay buffers, that
+    performs their allocations, history copies and frees. It sleeps until an audio
+    thread asks for a length or hands a buffer back, through a semaphore rather
+    than Thread::notify() so that the audio thread never takes a lock.
+*/
+class DelayBufferService  : private juce::Thread
+{
+public:
+    DelayBufferService()
+        : juce::Thread ("FlanGELVS delay buffers")
+    {
+        startThread (2);
+    }
+
+    ~DelayBufferService() override
+    {
+        signalThreadShouldExit();
+        wakeUp.post();
+        stopThread (1000);
+    }
+
+    /* Any thread, including the audio thread: runs a pass over the buffers soon */
+    void wake() noexcept
+    {
+        wakeUp.post();
+    }
+
+    void add (ResizableDelayBuffer* buffer)
+    {
+        const juce::ScopedLock sl (lock);
+        clients.add (buffer);
+    }
+
+    /* Once this returns, the thread is not touching 'buffer' any more */
+    void remove (ResizableDelayBuffer* buffer)
+    {
+        const juce::ScopedLock sl (lock);
+        clients.removeFirstMatchingValue (buffer);
+    }
+
+private:
+    void run() override
+    {
+        while (! threadShouldExit())
+        {
+            bool retry = false;
+
+            {
+                const juce::ScopedLock sl (lock);
+
+                for (auto* client : clients)
+                    retry = ! client->service() || retry;
+            }
+
+            /*Nothing to do until woken, unless an allocation failed and has to be tried again*/
+            wakeUp.wait (retry ? 100 : -1);
+        }
+    }
+
+    juce::CriticalSection lock;
+    juce::Array<ResizableDelayBuffer*> clients;
+    WakeUpSemaphore wakeUp;
+
+    JUCE_DECLARE_NON_COPYABLE (DelayBufferService)
+};
+
+//==============================================================================
+namespace
+{
+    /* Samples per channel rounded up to whole cache lines: both channels take twice that */
+    size_t getChannelStride (int numSamples) noexcept
+    {
+        constexpr size_t samplesPerLine = DelayMemoryArena::alignment / sizeof (double);
+        return ((size_t) numSamples + samplesPerLine - 1) / samplesPerLine * samplesPerLine;
+    }
+}
+
+ResizableDelayBuffer::Buffer* ResizableDelayBuffer::Buffer::create (DelayMemoryArena& arena, int numSamples) noexcept
+{
+    const size_t stride = getChannelStride (numSamples);
+    auto* memory = static_cast<double*> (arena.allocate (2 * stride * sizeof (double)));
+
+    if (memory == nullptr)
+        return nullptr;
+
+    auto* buffer = new (std::nothrow) Buffer (arena, numSamples, memory, stride);
+
+    if (buffer == nullptr)
+        arena.deallocate (memory);
+
+    return buffer;
+}
+
+ResizableDelayBuffer::Buffer::Buffer (DelayMemoryArena& arenaToUse, int numSamples, double* memory, size_t channelStride) noexcept
+    : arena (arenaToUse),
+      length (numSamples),
+      left (memory),
+      right (frameStride == 2 ? memory + 1 : memory + channelStride)
+{
+    std::fill (left, left + 2 * channelStride, 0.0);
+}
+
+ResizableDelayBuffer::Buffer::~Buffer()
+{
+    arena.deallocate (left);
+}
+
+ResizableDelayBuffer::ResizableDelayBuffer()
+{
+    for (auto& slot : retired)
+        slot = nullptr;
+
+    backgroundService->add (this);
+}
+
+ResizableDelayBuffer::~ResizableDelayBuffer()
+{
+    backgroundService->remove (this);
+
+    delete pending.exchange (nullptr);
+
+    for (auto& slot : retired)
+        delete slot.exchange (nullptr);
+}
+
+void ResizableDelayBuffer::prepare (int length)
+{
+    /*Off the background thread's list meanwhile, so that it is neither reading the pending
+      buffer being freed nor installing one for the request being dropped*/
+    backgroundService->remove (this);
+
+    requestedLength = 0;
+    delete pending.exchange (nullptr);
+
+    for (auto& slot : retired)
+        delete slot.exchange (nullptr);
+
+    active.reset (Buffer::create (*arena, juce::jmax (1, length)));
+    ++historyGeneration;
+    publishWritePosition (0, 0);
+    backgroundService->add (this);
+
+    /*The audio thread needs a buffer: on the message thread, failing loudly is the only option*/
+    if (active == nullptr)
+        throw std::bad_alloc();
+}
+
+void ResizableDelayBuffer::clear() noexcept
+{
+    if (active != nullptr)
+        std::fill (active->left, active->left + 2 * getChannelStride (active->length), 0.0);
+
+    /*Whatever the background thread copied before this is out of date*/
+    ++historyGeneration;
+}
+
+void ResizableDelayBuffer::copyHistory (const Buffer& source, int sourceEnd, Buffer& dest, int destEnd, int numSamples) noexcept
+{
+    jassert (numSamples <= source.length && numSamples <= dest.length);
+
+    for (int i = 0; i < numSamples; ++i)
+    {
+        int from = sourceEnd - numSamples + i;
+        from += from < 0 ? source.length : 0;
+        int to = destEnd - numSamples + i;
+        to += to < 0 ? dest.length : 0;
+        to -= to >= dest.length ? dest.length : 0;
+
+        dest.left[(size_t) (to * frameStride)] = source.left[(size_t) (from * frameStride)];
+        dest.right[(size_t) (to * frameStride)] = source.right[(size_t) (from * frameStride)];
+    }
+}
+
+//==============================================================================
+void ResizableDelayBuffer::requestLength (int length) noexcept
+{
+    const int wanted = length == getLength() ? 0 : length;
+
+    /*Called every block: only a new request wakes the background thread*/
+    if (requestedLength.exchange (wanted, std::memory_order_relaxed) != wanted && wanted > 0)
+        backgroundService->wake();
+}
+
+bool ResizableDelayBuffer::adoptPendingBuffer (int& writeHead, juce::int64 writePosition, int minimumLength) noexcept
+{
+    const bool adopted = swapInPendingBuffer (writeHead, writePosition, minimumLength);
+    publishWritePosition (writeHead, writePosition);
+    return adopted;
+}
+
+void ResizableDelayBuffer::publishWritePosition (int writeHead, juce::int64 writePosition) noexcept
+{
+    const int sequence = publishSequence.load (std::memory_order_relaxed);
+    publishSequence.store (sequence + 1);
+    publishedWriteHead.store (writeHead);
+    publishedPosition.store (writePosition);
+    publishedGeneration.store (historyGeneration);
+    publishSequence.store (sequence + 2);
+}
+
+bool ResizableDelayBuffer::swapInPendingBuffer (int& writeHead, juce::int64 writePosition, int minimumLength) noexcept
+{
+    /*Only the pointer is looked at here: once published, a pending buffer belongs to this
+      thread, which must take it with the exchange below before touching it*/
+    if (pending.load (std::memory_order_relaxed) == nullptr || active == nullptr)
+        return false;
+
+    /*Any buffer given up is freed by the background thread, through one of the slots;
+      only this thread fills them, so a slot seen empty stays empty*/
+    std::atomic<Buffer*>* freeSlot = nullptr;
+
+    for (auto& slot : retired)
+        if (slot.load (std::memory_order_acquire) == nullptr)
+            freeSlot = &slot;
+
+    if (freeSlot == nullptr)
+        return false;
+
+    auto* fresh = pending.exchange (nullptr, std::memory_order_acquire);
+
+    if (fresh == nullptr)
+        return false;
+
+    /*Too short for what is being read now (allocated before a range change): give it back,
+      and drop its request unless a newer one has replaced it, so that it is not made again*/
+    if (fresh->length < minimumLength)
+    {
+        int staleLength = fresh->length;
+        requestedLength.compare_exchange_strong (staleLength, 0, std::memory_order_relaxed);
+        freeSlot->store (fresh, std::memory_order_release);
+        backgroundService->wake();
+        return false;
+    }
+
+    /*Most recent history, so that the new write head carries on after it. The background
+      thread copied all of it but what was written since (about a block), unless the history
+      was silenced in between*/
+    const int numToCopy = juce::jmin (active->length, fresh->length);
+
+    if (fresh->numCopied > 0 && fresh->copiedGeneration == historyGeneration && writePosition >= fresh->copiedUpTo)
+    {
+        const auto numWrittenSince = writePosition - fresh->copiedUpTo;
+        const int freshWriteHead = (int) (((juce::int64) fresh->numCopied + numWrittenSince) % fresh->length);
+        copyHistory (*active, writeHead, *fresh, freshWriteHead, (int) juce::jmin ((juce::int64) numToCopy, numWrittenSince));
+        writeHead = freshWriteHead;
+    }
+    else
+    {
+        copyHistory (*active, writeHead, *fresh, numToCopy, numToCopy);
+        writeHead = numToCopy % fresh->length;
+    }
+
+    /*The new buffer is in place before the old one is handed over, so the background
+      thread sees it when it next copies a history*/
+    auto* previous = active.release();
+    active.reset (fresh);
+    freeSlot->store (previous, std::memory_order_release);
+    backgroundService->wake();
+
+    int adoptedLength = fresh->length;
+    requestedLength.compare_exchange_strong (adoptedLength, 0, std::memory_order_relaxed);
+    return true;
+}
+
+void ResizableDelayBuffer::copyPublishedHistory (Buffer& fresh)
+{
+    int writeHead = 0, generation = 0;
+    juce::int64 position = 0;
+
+    for (;;)
+    {
+        const int sequence = publishSequence.load();
+
+        if ((sequence & 1) == 0)
+        {
+            writeHead = publishedWriteHead.load();
+            position = publishedPosition.load();
+            generation = publishedGeneration.load();
+
+            if (publishSequence.load() == sequence)
+                break;
+        }
+
+        juce::Thread::yield();
+    }
+
+    /*The audio thread goes on writing meanwhile. The frames it overwrites are older than
+      anything still needed when the buffer is adopted, and if it silences the history,
+      the generation no longer matches and the copy is redone there*/
+    const int numToCopy = juce::jmin (active->length, fresh.length);
+    copyHistory (*active, writeHead, fresh, numToCopy, numToCopy);
+
+    fresh.copiedUpTo = position;
+    fresh.numCopied = numToCopy;
+    fresh.copiedGeneration = generation;
+}
+
+bool ResizableDelayBuffer::service()
+{
+    for (auto& slot : retired)
+        delete slot.exchange (nullptr, std::memory_order_acquire);
+
+    const int length = requestedLength.load (std::memory_order_relaxed);
+
+    if (length <= 0)
+        return true;
+
+    /*A published buffer is the audio thread's: it adopts it, or hands it back through a
+      slot if it no longer fits (which wakes this thread), and the new request is served then*/
+    if (pending.load (std::memory_order_acquire) != nullptr)
+        return true;
+
+    auto* fresh = Buffer::create (*arena, length);
+
+    /*Out of memory: the request stays, and is tried again a little later*/
+    if (fresh == nullptr)
+        return false;
+
+    copyPublishedHistory (*fresh);
+
+    Buffer* expected = nullptr;
+
+    /*Only this thread stores a non-null pointer, so the slot is still empty*/
+    const bool published = pending.compare_exchange_strong (expected, fresh, std::memory_order_release);
+    jassert (published);
+    juce::ignoreUnused (published);
+    return true;
+}
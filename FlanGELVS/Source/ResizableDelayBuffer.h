@@ -0,0 +1,132 @@
+/*
+  ==============================================================================
+
+    ResizableDelayBuffer.h
+    Created: 19 Oct 2026
+    Author:  GELVS
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+#include "DelayMemoryArena.h"
+
+/* Sample layout of the delay lines: 1 = interleaved (L,R frames), 0 = planar (one run per channel) */
+#ifndef FLANGELVS_INTERLEAVED_DELAY
+ #define FLANGELVS_INTERLEAVED_DELAY 1
+#endif
+
+class DelayBufferService;
+
+//==============================================================================
+/**
+    Stereo ring buffer of doubles that can change length while audio is running.
+
+    By default the two channels are interleaved, so that the write and each
+    interpolated read of a stereo frame touch one cache line rather than one
+    per channel (FlanGELVSBenchmarks --layout compares the two layouts). Sample
+    n of a channel is at getLeft()[n * frameStride] and getRight()[n * frameStride].
+
+    The audio thread asks for a new length with requestLength(). A thread shared
+    by every instance allocates the new buffer from the shared DelayMemoryArena
+    and copies the history into it up to the last write position the audio
+    thread published, and the audio thread picks it up with adoptPendingBuffer().
+    Adopting only copies what was written since that copy (about a block), so
+    the delay line carries on seamlessly at any length, and hands the old buffer
+    back to the shared thread to be freed. Nothing on the audio thread
+    allocates, frees or locks.
+*/
+class ResizableDelayBuffer
+{
+public:
+    ResizableDelayBuffer();
+    ~ResizableDelayBuffer();
+
+    /* Message thread, while audio is stopped: allocates 'length' cleared samples per
+       channel straight away (std::bad_alloc if that fails) and drops any pending request */
+    void prepare (int length);
+
+    /* Distance between consecutive samples of one channel */
+    static constexpr int frameStride = FLANGELVS_INTERLEAVED_DELAY ? 2 : 1;
+
+    /* Audio thread */
+    int getLength() const noexcept      { return active != nullptr ? active->length : 0; }
+    double* getLeft() noexcept          { return active->left; }
+    double* getRight() noexcept         { return active->right; }
+
+    /* Audio thread: silences the whole history (the write head is the caller's to move) */
+    void clear() noexcept;
+
+    /* Audio thread: asks the background thread for a buffer of 'length' samples. Returns
+       straight away; asking for the current length cancels the request */
+    void requestLength (int length) noexcept;
+
+    /* Audio thread, once per block: swaps in the buffer allocated in the background, if
+       there is one of at least 'minimumLength'. 'writeHead' is moved to the matching position
+       in the new buffer. 'writePosition' counts the samples written since prepare(); it is
+       published with 'writeHead' for the background copy of the history. Returns true if
+       the buffer changed */
+    bool adoptPendingBuffer (int& writeHead, juce::int64 writePosition, int minimumLength) noexcept;
+
+private:
+    friend class DelayBufferService;
+
+    struct Buffer
+    {
+        /* 'numSamples' cleared samples per channel, or nullptr if the memory ran out */
+        static Buffer* create (DelayMemoryArena&, int numSamples) noexcept;
+
+        Buffer (DelayMemoryArena&, int numSamples, double* memory, size_t channelStride) noexcept;
+        ~Buffer();
+
+        DelayMemoryArena& arena;
+        const int length;
+        double* left;     // both channels in one block: interleaved, or
+        double* right;    // planar with each channel starting on a cache line
+
+        /*History copied in the background: the samples up to 'copiedUpTo' (a write position),
+          the newest at index 'numCopied' - 1, or none if 'numCopied' is 0*/
+        juce::int64 copiedUpTo = 0;
+        int numCopied = 0;
+        int copiedGeneration = 0;
+
+        JUCE_DECLARE_NON_COPYABLE (Buffer)
+    };
+
+    /* Audio thread: the swap itself, and the publication of where it is writing */
+    bool swapInPendingBuffer (int& writeHead, juce::int64 writePosition, int minimumLength) noexcept;
+    void publishWritePosition (int writeHead, juce::int64 writePosition) noexcept;
+
+    /* Background thread: frees retired buffers, and allocates the requested one with as
+       much history as was written so far. Returns false if the memory ran out */
+    bool service();
+
+    /* Background thread: copies the history up to the last published write position */
+    void copyPublishedHistory (Buffer& fresh);
+
+    /* Copies the 'numSamples' samples of 'source' before 'sourceEnd' (a write head) to
+       'dest', the last one at 'destEnd' - 1 (both wrapping round) */
+    static void copyHistory (const Buffer& source, int sourceEnd, Buffer& dest, int destEnd, int numSamples) noexcept;
+
+    /*First, so that it outlives every buffer below*/
+    juce::SharedResourcePointer<DelayMemoryArena> arena;
+
+    std::unique_ptr<Buffer> active;
+    std::atomic<Buffer*> pending { nullptr };
+    std::array<std::atomic<Buffer*>, 4> retired;
+    std::atomic<int> requestedLength { 0 };
+
+    /*Last write head and position of the audio thread, published like a seqlock: odd while
+      being written. The generation changes whenever the history is silenced*/
+    std::atomic<int> publishSequence { 0 };
+    std::atomic<int> publishedWriteHead { 0 };
+    std::atomic<juce::int64> publishedPosition { 0 };
+    std::atomic<int> publishedGeneration { 0 };
+    int historyGeneration = 0;
+
+    juce::SharedResourcePointer<DelayBufferService> backgroundService;
+
+    JUCE_DECLARE_NON_COPYABLE (ResizableDelayBuffer)
+};
@@ -0,0 +1,162 @@
+/*
+  ==============================================================================
+
+    SpectrumAnalyser.cpp
+    Created: 19 Oct 2026
+    Author:  GELVS
+
+  ==============================================================================
+*/
+
+#include "SpectrumAnalyser.h"
+
+//==============================================================================
+SpectrumAnalyser::Stream::Stream()
+    : fifo (SpectrumAnalyser::fftSize * 4),
+      samples ((size_t) SpectrumAnalyser::fftSize * 4),
+      analysisWindow ((size_t) SpectrumAnalyser::fftSize, 0.0f),
+      fftData ((size_t) SpectrumAnalyser::fftSize * 2, 0.0f),
+      smoothedDecibels ((size_t) SpectrumAnalyser::numBins, -100.0f)
+{
+}
+
+void SpectrumAnalyser::Stream::push (const juce::AudioBuffer<float>& buffer, int numSamples, const std::atomic<bool>& isActive) noexcept
+{
+    if (! isActive.load (std::memory_order_relaxed) || buffer.getNumChannels() == 0)
+        return;
+
+    /*Whatever does not fit is dropped: the worker only ever looks at the newest samples*/
+    int start1, size1, start2, size2;
+    fifo.prepareToWrite (numSamples, start1, size1, start2, size2);
+
+    const int numChannels = buffer.getNumChannels();
+    const float channelGain = 1.0f / (float) numChannels;
+
+    auto copyMonoSum = [&] (int destStart, int sourceStart, int num)
+    {
+        for (int i = 0; i < num; ++i)
+        {
+            float sum = 0;
+
+            for (int channel = 0; channel < numChannels; ++channel)
+                sum += buffer.getSample (channel, sourceStart + i);
+
+            samples[(size_t) (destStart + i)] = sum * channelGain;
+        }
+    };
+
+    copyMonoSum (start1, 0, size1);
+    copyMonoSum (start2, size1, size2);
+    fifo.finishedWrite (size1 + size2);
+}
+
+bool SpectrumAnalyser::Stream::analyse (juce::dsp::FFT& fft, juce::dsp::WindowingFunction<float>& window)
+{
+    const int numReady = juce::jmin (fifo.getNumReady(), SpectrumAnalyser::fftSize);
+
+    if (numReady == 0)
+        return false;
+
+    /*Drop anything older than one window, then slide the rest in*/
+    fifo.finishedRead (fifo.getNumReady() - numReady);
+
+    std::move (analysisWindow.begin() + numReady, analysisWindow.end(), analysisWindow.begin());
+
+    int start1, size1, start2, size2;
+    fifo.prepareToRead (numReady, start1, size1, start2, size2);
+
+    auto dest = analysisWindow.end() - numReady;
+    dest = std::copy_n (samples.begin() + start1, size1, dest);
+    std::copy_n (samples.begin() + start2, size2, dest);
+    fifo.finishedRead (size1 + size2);
+
+    std::copy (analysisWindow.begin(), analysisWindow.end(), fftData.begin());
+    window.multiplyWithWindowingTable (fftData.data(), (size_t) SpectrumAnalyser::fftSize);
+    fft.performFrequencyOnlyForwardTransform (fftData.data());
+
+    /*Normalise so that a full scale sine reads about 0 dB, then smooth over time*/
+    const float normalisation = 4.0f / (float) SpectrumAnalyser::fftSize;
+
+    for (int bin = 0; bin < SpectrumAnalyser::numBins; ++bin)
+    {
+        const float decibels = juce::Decibels::gainToDecibels (fftData[(size_t) bin] * normalisation, -100.0f);
+        auto& smoothed = smoothedDecibels[(size_t) bin];
+        smoothed = decibels > smoothed ? decibels : smoothed + 0.2f * (decibels - smoothed);
+    }
+
+    return true;
+}
+
+//==============================================================================
+SpectrumAnalyser::SpectrumAnalyser()
+    : juce::Thread ("FlanGELVS analyser"),
+      publishedInput ((size_t) numBins, -100.0f),
+      publishedOutput ((size_t) numBins, -100.0f)
+{
+}
+
+SpectrumAnalyser::~SpectrumAnalyser()
+{
+    active = false;
+    stopThread (1000);
+}
+
+void SpectrumAnalyser::addClient()
+{
+    if (++numClients == 1)
+    {
+        active = true;
+        startThread (2);
+    }
+}
+
+void SpectrumAnalyser::removeClient()
+{
+    jassert (numClients > 0);
+
+    if (--numClients == 0)
+    {
+        active = false;
+        stopThread (1000);
+    }
+}
+
+bool SpectrumAnalyser::getLatestSpectra (float* inputDecibels, float* outputDecibels, int& lastResultSeen)
+{
+    const juce::ScopedLock sl (resultLock);
+
+    if (resultCount == lastResultSeen)
+        return false;
+
+    std::copy (publishedInput.begin(), publishedInput.end(), inputDecibels);
+    std::copy (publishedOutput.begin(), publishedOutput.end(), outputDecibels);
+    lastResultSeen = resultCount;
+    return true;
+}
+
+void SpectrumAnalyser::run()
+{
+    /*Samples queued before the editor opened describe audio that is long gone*/
+    input.fifo.finishedRead (input.fifo.getNumReady());
+    output.fifo.finishedRead (output.fifo.getNumReady());
+
+    while (! threadShouldExit())
+    {
+        const auto frameStart = juce::Time::getMillisecondCounter();
+
+        const bool inputChanged = input.analyse (fft, window);
+        const bool outputChanged = output.analyse (fft, window);
+
+        if (inputChanged || outputChanged)
+        {
+            const juce::ScopedLock sl (resultLock);
+            publishedInput = input.smoothedDecibels;
+            publishedOutput = output.smoothedDecibels;
+            ++resultCount;
+        }
+
+        const int frameLength = 1000 / frameRate.load();
+        const int elapsed = (int) (juce::Time::getMillisecondCounter() - frameStart);
+        wait (juce::jmax (1, frameLength - elapsed));
+    }
+}
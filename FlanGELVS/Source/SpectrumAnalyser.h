@@ -0,0 +1,82 @@
+/*
+  ==============================================================================
+
+    SpectrumAnalyser.h
+    Created: 19 Oct 2026
+    Author:  GELVS
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+
+//==============================================================================
+/**
+    Input/output spectrum analyser that keeps the audio thread down to a copy.
+
+    processBlock() pushes the mono sum of each block into one lock-free FIFO per
+    stream. Windowing, the FFT and the smoothing all happen on a worker thread
+    that wakes up at the configured frame rate, and that thread only runs while
+    at least one display has the analyser switched on.
+*/
+class SpectrumAnalyser  : private juce::Thread
+{
+public:
+    static constexpr int fftOrder = 11;
+    static constexpr int fftSize = 1 << fftOrder;
+    static constexpr int numBins = fftSize / 2;
+
+    SpectrumAnalyser();
+    ~SpectrumAnalyser() override;
+
+    /* Audio thread: copy a block of the dry input or of the processed output */
+    void pushInput (const juce::AudioBuffer<float>& buffer, int numSamples) noexcept   { input.push (buffer, numSamples, active); }
+    void pushOutput (const juce::AudioBuffer<float>& buffer, int numSamples) noexcept  { output.push (buffer, numSamples, active); }
+
+    /* Message thread: every display showing the analyser calls addClient() when it opens and
+       removeClient() when it closes. The worker runs while at least one of them is open */
+    void addClient();
+    void removeClient();
+    bool isActive() const noexcept                  { return active.load(); }
+
+    void setFrameRate (int framesPerSecond) noexcept { frameRate = juce::jlimit (1, 120, framesPerSecond); }
+    int getFrameRate() const noexcept               { return frameRate.load(); }
+
+    /* Message thread: copies the latest smoothed spectra (numBins values in dB each).
+       Returns false if nothing new was computed since 'lastResultSeen', which each
+       display keeps for itself and which is updated here */
+    bool getLatestSpectra (float* inputDecibels, float* outputDecibels, int& lastResultSeen);
+
+private:
+    struct Stream
+    {
+        Stream();
+
+        void push (const juce::AudioBuffer<float>& buffer, int numSamples, const std::atomic<bool>& isActive) noexcept;
+
+        /* Worker thread: slides the newest samples into the analysis window and
+           updates 'smoothedDecibels'. Returns false if no new samples arrived */
+        bool analyse (juce::dsp::FFT&, juce::dsp::WindowingFunction<float>&);
+
+        juce::AbstractFifo fifo;
+        std::vector<float> samples, analysisWindow, fftData, smoothedDecibels;
+    };
+
+    void run() override;
+
+    Stream input, output;
+    juce::dsp::FFT fft { fftOrder };
+    juce::dsp::WindowingFunction<float> window { (size_t) fftSize, juce::dsp::WindowingFunction<float>::hann };
+
+    std::atomic<bool> active { false };
+    int numClients = 0;
+    std::atomic<int> frameRate { 30 };
+
+    juce::CriticalSection resultLock;
+    std::vector<float> publishedInput, publishedOutput;
+    int resultCount = 0;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (SpectrumAnalyser)
+};
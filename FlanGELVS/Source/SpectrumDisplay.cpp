@@ -0,0 +1,127 @@
+/*
+  ==============================================================================
+
+    SpectrumDisplay.cpp
+    Created: 19 Oct 2026
+    Author:  GELVS
+
+  ==============================================================================
+*/
+
+#include "SpectrumDisplay.h"
+
+//==============================================================================
+SpectrumDisplay::SpectrumDisplay (FlanGELVSAudioProcessor& p)
+    : audioProcessor (p),
+      inputDecibels ((size_t) SpectrumAnalyser::numBins, -100.0f),
+      outputDecibels ((size_t) SpectrumAnalyser::numBins, -100.0f)
+{
+    setOpaque (false);
+    setInterceptsMouseClicks (false, false);
+
+    audioProcessor.getAnalyser().addClient();
+    startTimerHz (audioProcessor.getAnalyser().getFrameRate());
+}
+
+SpectrumDisplay::~SpectrumDisplay()
+{
+    stopTimer();
+    audioProcessor.getAnalyser().removeClient();
+}
+
+//==============================================================================
+void SpectrumDisplay::timerCallback()
+{
+    if (audioProcessor.getAnalyser().getLatestSpectra (inputDecibels.data(), outputDecibels.data(), lastResultSeen))
+        repaint();
+}
+
+float SpectrumDisplay::frequencyToX (float frequency, juce::Rectangle<float> area) const
+{
+    const float nyquist = juce::jmax (minFrequency * 2.0f, (float) audioProcessor.getSampleRate() * 0.5f);
+    const float proportion = std::log (juce::jmax (minFrequency, frequency) / minFrequency) / std::log (nyquist / minFrequency);
+    return area.getX() + area.getWidth() * proportion;
+}
+
+float SpectrumDisplay::decibelsToY (float decibels, juce::Rectangle<float> area) const
+{
+    return juce::jmap (juce::jlimit (minDecibels, maxDecibels, decibels), minDecibels, maxDecibels, area.getBottom(), area.getY());
+}
+
+juce::Path SpectrumDisplay::makeSpectrumPath (const std::vector<float>& decibels, juce::Rectangle<float> area) const
+{
+    const float binWidth = (float) audioProcessor.getSampleRate() / (float) SpectrumAnalyser::fftSize;
+
+    juce::Path path;
+    path.startNewSubPath (area.getX(), decibelsToY (decibels[1], area));
+
+    for (int bin = 2; bin < SpectrumAnalyser::numBins; ++bin)
+        path.lineTo (frequencyToX ((float) bin * binWidth, area), decibelsToY (decibels[(size_t) bin], area));
+
+    return path;
+}
+
+void SpectrumDisplay::paint (juce::Graphics& g)
+{
+    auto area = getLocalBounds().toFloat();
+
+    g.setColour (juce::Colours::black.withAlpha (0.5f));
+    g.fillRoundedRectangle (area, 4.0f);
+
+    area = area.reduced (4.0f);
+
+    if (audioProcessor.getSampleRate() <= 0)
+        return;
+
+    /*Theoretical response of out = (1 - wet) * in + wet * z^-D / (1 - fb * z^-D)*/
+    const float delayInSamples = audioProcessor.getCurrentDelayInSamples();
+    const float feedback = audioProcessor.getFeedbackAmount();
+    const float wet = audioProcessor.getDryWetAmount();
+    const float sampleRate = (float) audioProcessor.getSampleRate();
+
+    if (delayInSamples > 0)
+    {
+        /*Notches sit where the delayed path is in antiphase: f = (2k + 1) * fs / (2D)*/
+        g.setColour (juce::Colours::orangered.withAlpha (0.35f));
+
+        for (int k = 0; k < 64; ++k)
+        {
+            const float notch = (2.0f * (float) k + 1.0f) * sampleRate / (2.0f * delayInSamples);
+
+            if (notch > sampleRate * 0.5f)
+                break;
+
+            const float x = frequencyToX (notch, area);
+            g.drawVerticalLine (juce::roundToInt (x), area.getY(), area.getBottom());
+        }
+
+        juce::Path comb;
+        const int numPoints = juce::jmax (2, (int) area.getWidth());
+
+        for (int i = 0; i < numPoints; ++i)
+        {
+            const float proportion = (float) i / (float) (numPoints - 1);
+            const float frequency = minFrequency * std::pow (sampleRate * 0.5f / minFrequency, proportion);
+            const auto z = std::polar (1.0f, -juce::MathConstants<float>::twoPi * frequency * delayInSamples / sampleRate);
+            const auto response = (1.0f - wet) + wet * z / (1.0f - feedback * z);
+            const float y = decibelsToY (juce::Decibels::gainToDecibels (std::abs (response), minDecibels), area);
+
+            if (i == 0)
+                comb.startNewSubPath (area.getX(), y);
+            else
+                comb.lineTo (area.getX() + proportion * area.getWidth(), y);
+        }
+
+        g.setColour (juce::Colours::lightcyan.withAlpha (0.8f));
+        g.strokePath (comb, juce::PathStrokeType (1.0f));
+    }
+
+    g.setColour (juce::Colours::grey);
+    g.strokePath (makeSpectrumPath (inputDecibels, area), juce::PathStrokeType (1.0f));
+    g.setColour (juce::Colour::fromRGBA (233, 231, 119, 255));
+    g.strokePath (makeSpectrumPath (outputDecibels, area), juce::PathStrokeType (1.5f));
+
+    g.setFont (10.0f);
+    g.setColour (juce::Colours::white);
+    g.drawText ("In / Out / Comb", getLocalBounds().reduced (6, 2), juce::Justification::topLeft);
+}
@@ -0,0 +1,51 @@
+/*
+  ==============================================================================
+
+    SpectrumDisplay.h
+    Created: 19 Oct 2026
+    Author:  GELVS
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+#include "PluginProcessor.h"
+
+//==============================================================================
+/**
+    Draws the analyser's input and output spectra together with the theoretical
+    comb-filter response (and its notch positions) for the current delay time,
+    feedback and dry/wet mix.
+
+    The analyser worker runs only while at least one of these components exists.
+*/
+class SpectrumDisplay  : public juce::Component,
+                         private juce::Timer
+{
+public:
+    explicit SpectrumDisplay (FlanGELVSAudioProcessor&);
+    ~SpectrumDisplay() override;
+
+    void paint (juce::Graphics&) override;
+
+private:
+    void timerCallback() override;
+
+    float frequencyToX (float frequency, juce::Rectangle<float> area) const;
+    float decibelsToY (float decibels, juce::Rectangle<float> area) const;
+
+    /* Path through 'decibels' (one value per FFT bin) */
+    juce::Path makeSpectrumPath (const std::vector<float>& decibels, juce::Rectangle<float> area) const;
+
+    FlanGELVSAudioProcessor& audioProcessor;
+    std::vector<float> inputDecibels, outputDecibels;
+    int lastResultSeen = 0;
+
+    static constexpr float minFrequency = 20.0f;
+    static constexpr float minDecibels = -90.0f;
+    static constexpr float maxDecibels = 6.0f;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (SpectrumDisplay)
+};
@@ -0,0 +1,79 @@
+/*
+  ==============================================================================
+
+    TelemetryFifo.h
+    Created: 19 Oct 2026
+    Author:  GELVS
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+
+//==============================================================================
+/* One decimated snapshot of the flanger's internal state */
+struct TelemetryFrame
+{
+    float lfo = 0.0f;                 // LFO output after amplitude and depth, in [-3, 3]
+    float delayTimeInSamples = 0.0f;  // smoothed delay time driving the read head
+    float feedbackLevel = 0.0f;       // peak magnitude of the feedback signal since the last frame
+};
+
+//==============================================================================
+/**
+    Single-producer/single-consumer ring of TelemetryFrames.
+
+    The audio thread is the only writer and the editor's timer the only reader.
+    Storage is allocated once in the constructor; push() and pop() never lock or
+    allocate, and a push into a full ring simply drops the frame (which is what
+    happens while no editor is open to drain it).
+*/
+class TelemetryFifo
+{
+public:
+    explicit TelemetryFifo (int capacity = 4096)
+        : fifo (capacity), frames ((size_t) capacity)
+    {
+    }
+
+    /* Audio thread only */
+    bool push (const TelemetryFrame& frame) noexcept
+    {
+        int start1, size1, start2, size2;
+        fifo.prepareToWrite (1, start1, size1, start2, size2);
+
+        if (size1 + size2 == 0)
+            return false;
+
+        frames[(size_t) (size1 > 0 ? start1 : start2)] = frame;
+        fifo.finishedWrite (1);
+        return true;
+    }
+
+    /* Reader thread only: copies up to 'maxFrames' frames into 'dest', returns how many */
+    int pop (TelemetryFrame* dest, int maxFrames) noexcept
+    {
+        int start1, size1, start2, size2;
+        fifo.prepareToRead (maxFrames, start1, size1, start2, size2);
+
+        std::copy_n (frames.begin() + start1, size1, dest);
+        std::copy_n (frames.begin() + start2, size2, dest + size1);
+
+        fifo.finishedRead (size1 + size2);
+        return size1 + size2;
+    }
+
+    /* Reader thread only: throws away everything queued so far */
+    void discardAll() noexcept
+    {
+        fifo.finishedRead (fifo.getNumReady());
+    }
+
+private:
+    juce::AbstractFifo fifo;
+    std::vector<TelemetryFrame> frames;
+
+    JUCE_DECLARE_NON_COPYABLE (TelemetryFifo)
+};
@@ -0,0 +1,140 @@
+/*
+  ==============================================================================
+
+    BatchRender.cpp
+    Created: 19 Oct 2026
+    Author:  GELVS
+
+  ==============================================================================
+*/
+
+#include "BatchRender.h"
+#include "RenderCommon.h"
+#include "StreamingRender.h"
+
+namespace
+{
+    //==============================================================================
+    /* Shared, bounded work list: workers claim the next file with an atomic index */
+    struct BatchJob
+    {
+        juce::Array<juce::File> inputs;
+        juce::File outputFolder;
+        juce::String outputExtension;   // empty to keep the input's
+        Render::Settings settings;
+
+        std::atomic<int> nextFile { 0 };
+        std::vector<Render::FileResult> results;
+
+        /* Progress lines come from every worker, one whole line at a time */
+        juce::CriticalSection outputLock;
+
+        juce::File getOutputFor (const juce::File& input) const
+        {
+            return outputFolder.getChildFile (outputExtension.isEmpty() ? input.getFileName()
+                                                                        : input.getFileNameWithoutExtension() + outputExtension);
+        }
+    };
+
+    //==============================================================================
+    /* One worker = one processor instance, reused (re-prepared) for every file it picks up.
+       Each file goes through a ChunkPipeline, so its reading and writing overlap the DSP
+       while the worker holds no more than a few chunks in memory */
+    class RenderWorker  : public juce::Thread
+    {
+    public:
+        RenderWorker (BatchJob& j, int index)
+            : juce::Thread ("FlanGELVS render " + juce::String (index)), job (j)
+        {
+        }
+
+        void run() override
+        {
+            FlanGELVSAudioProcessor processor;
+            juce::AudioFormatManager formatManager;
+            formatManager.registerBasicFormats();
+
+            for (int i = job.nextFile++; i < job.inputs.size() && ! threadShouldExit(); i = job.nextFile++)
+            {
+                const auto& input = job.inputs.getReference (i);
+                job.results[(size_t) i] = renderFileStreaming (processor, formatManager, input, job.getOutputFor (input), job.settings);
+
+                const auto& result = job.results[(size_t) i];
+                const juce::ScopedLock sl (job.outputLock);
+                std::cerr << input.getFileName() << ": "
+                          << (result.error.isEmpty() ? juce::String (result.getRealtimeMultiple(), 1) + "x realtime" : result.error)
+                          << std::endl;
+            }
+        }
+
+    private:
+        BatchJob& job;
+    };
+}
+
+//==============================================================================
+void runBatchRender (const juce::ArgumentList& args)
+{
+    juce::ScopedJuceInitialiser_GUI juceInitialiser;
+
+    BatchJob job;
+    job.settings = Render::parseSettings (args);
+
+    const auto inputFolder = args.getExistingFolderForOption ("--input");
+    job.outputFolder = args.getFileForOption ("--output");
+
+    if (args.containsOption ("--format"))
+        job.outputExtension = "." + args.getValueForOption ("--format").trimCharactersAtStart (".");
+
+    if (! job.outputFolder.createDirectory())
+        juce::ConsoleApplication::fail ("Cannot create " + job.outputFolder.getFullPathName());
+
+    job.inputs = inputFolder.findChildFiles (juce::File::findFiles, false, "*.wav;*.flac;*.aif;*.aiff");
+    job.inputs.sort();
+    job.results.resize ((size_t) job.inputs.size());
+
+    if (job.inputs.isEmpty())
+        juce::ConsoleApplication::fail ("No WAV, FLAC or AIFF files in " + inputFolder.getFullPathName());
+
+    const int numThreads = juce::jlimit (1, job.inputs.size(),
+                                         args.containsOption ("--threads") ? args.getValueForOption ("--threads").getIntValue()
+                                                                           : juce::SystemStats::getNumCpus());
+
+    const double start = juce::Time::getMillisecondCounterHiRes();
+
+    juce::OwnedArray<RenderWorker> workers;
+
+    for (int i = 0; i < numThreads; ++i)
+        workers.add (new RenderWorker (job, i))->startThread();
+
+    for (auto* worker : workers)
+        worker->waitForThreadToExit (-1);
+
+    const double wallSeconds = (juce::Time::getMillisecondCounterHiRes() - start) / 1000.0;
+
+    //==============================================================================
+    double audioSeconds = 0;
+    int numFailed = 0;
+    juce::Array<juce::var> files;
+
+    for (auto& result : job.results)
+    {
+        audioSeconds += result.audioSeconds;
+        numFailed += result.error.isNotEmpty() ? 1 : 0;
+        files.add (result.toVar());
+    }
+
+    auto* summary = new juce::DynamicObject();
+    summary->setProperty ("threads", numThreads);
+    summary->setProperty ("files", job.inputs.size());
+    summary->setProperty ("failed", numFailed);
+    summary->setProperty ("audioSeconds", audioSeconds);
+    summary->setProperty ("wallSeconds", wallSeconds);
+    summary->setProperty ("realtimeMultiple", wallSeconds > 0 ? audioSeconds / wallSeconds : 0.0);
+    summary->setProperty ("results", files);
+
+    std::cout << juce::JSON::toString (juce::var (summary)) << std::endl;
+
+    if (numFailed > 0)
+        juce::ConsoleApplication::fail (juce::String (numFailed) + " file(s) failed", 2);
+}
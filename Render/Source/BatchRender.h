@@ -0,0 +1,17 @@
+/*
+  ==============================================================================
+
+    BatchRender.h
+    Created: 19 Oct 2026
+    Author:  GELVS
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+
+/* Renders every WAV/FLAC/AIFF file of a folder through FlanGELVS, one file per
+   worker thread at a time, each worker owning its own processor instance */
+void runBatchRender (const juce::ArgumentList& args);
@@ -0,0 +1,85 @@
+/*
+  ==============================================================================
+
+    This file contains the basic startup code for a JUCE application.
+
+    Offline renderer: applies FlanGELVS to audio files without a DAW.
+
+  ==============================================================================
+*/
+
+#include <JuceHeader.h>
+#include "BatchRender.h"
+#include "StreamingRender.h"
+#include "ParallelRender.h"
+#include "ReferenceRender.h"
+#include "RenderCommon.h"
+
+//==============================================================================
+int main (int argc, char* argv[])
+{
+    juce::ConsoleApplication app;
+
+    app.addDefaultCommand ({ "--help|-h", "--help|-h", "Prints the list of commands and the parameter IDs", {},
+                             [&app] (const juce::ArgumentList& args)
+                             {
+                                 std::cout << "Usage: FlanGELVSRender --<command> [--preset=preset.json] [--set=id=value,...]" << std::endl;
+                                 app.printCommandList (args);
+
+                                 /*Listed from the processor itself so the help never lags behind its parameters;
+                                   it is only built here, once JUCE is initialised*/
+                                 juce::ScopedJuceInitialiser_GUI juceInitialiser;
+                                 std::cout << "Parameter IDs: " << Render::getParameterIDs (FlanGELVSAudioProcessor()) << std::endl;
+                             } });
+
+    app.addCommand ({ "--batch",
+                      "--batch --input=folder --output=folder [--threads=N] [--format=wav|flac|aiff] [--block-size=N]",
+                      "Renders every WAV/FLAC/AIFF file of a folder, in parallel",
+                      "Each worker thread owns one processor instance and renders whole files, picking the next one "
+                      "from a shared list until none is left. Every worker reads, processes and writes its file "
+                      "through the same bounded pipeline as --stream. Parameter IDs are listed by --help. "
+                      "Prints a JSON summary with the throughput in realtime multiples.",
+                      runBatchRender });
+
+    app.addCommand ({ "--stream",
+                      "--stream --input=file --output=file [--block-size=N]",
+                      "Renders one long file with constant memory",
+                      "WAV and AIFF inputs are read through a memory-mapped reader (over a sliding window of the file), "
+                      "processed in large chunks (65536 samples by default) and written by a background writer thread, "
+                      "with reading, processing and writing overlapping.",
+                      runStreamingRender });
+
+    app.addCommand ({ "--parallel",
+                      "--parallel --input=file --output=file [--segments=N] [--threads=N] [--tolerance-db=-96] [--verify]",
+                      "Renders one file as segments on separate cores",
+                      "Each segment starts with a pre-roll long enough for the feedback tail to decay below the "
+                      "tolerance, with the LFO phase and the delay smoothing seeded to where a serial render would be, "
+                      "so the stitched result matches a serial render within that tolerance. --verify also renders "
+                      "serially, reports the largest difference and exits with an error if it is above the tolerance.",
+                      runParallelRender });
+
+    app.addCommand ({ "--check-parallel",
+                      "--check-parallel [--tolerance-db=-96] [--set=id=value,...]",
+                      "Checks that --parallel matches a serial render within the tolerance",
+                      "Renders 20 s of a 10 kHz sine plus noise (48 kHz stereo, 32-bit float) with feedback 0.2 "
+                      "as 8 segments with --verify, and exits with an error if the stitched result differs from the "
+                      "serial render by more than --tolerance-db.",
+                      runCheckParallel });
+
+    app.addCommand ({ "--write-references",
+                      "--write-references [--dir=references]",
+                      "Stores golden reference renders of the current algorithm",
+                      "Renders impulse, sine sweep, noise and silence under static, ramped and jumping parameter "
+                      "automation (48 kHz stereo, 512-sample blocks) into 32-bit float WAV files.",
+                      runWriteReferences });
+
+    app.addCommand ({ "--check-references",
+                      "--check-references [--dir=references] [--max-ulp=N] [--max-db=dB] [--set=id=value,...]",
+                      "Null-tests the current build against the stored references",
+                      "Renders every reference case again and reports the largest ULP distance, the peak difference and "
+                      "the RMS of the null residual. A case passes if it is within --max-ulp (default 0) or --max-db. "
+                      "Exits with an error if any case fails.",
+                      runCheckReferences });
+
+    return app.findAndRunCommand (argc, argv);
+}
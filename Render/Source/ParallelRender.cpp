@@ -0,0 +1,314 @@
+/*
+  ==============================================================================
+
+    ParallelRender.cpp
+    Created: 19 Oct 2026
+    Author:  GELVS
+
+  ==============================================================================
+*/
+
+#include "ParallelRender.h"
+#include "RenderCommon.h"
+
+namespace
+{
+    //==============================================================================
+    struct Segment
+    {
+        juce::int64 preRollStart = 0, start = 0, end = 0;
+        std::unique_ptr<juce::TemporaryFile> file;
+        juce::String error;
+    };
+
+    struct ParallelJob
+    {
+        juce::File input;
+        Render::Settings settings;
+        double sampleRate = 0;
+        int numChannels = 0;
+
+        std::vector<Segment> segments;
+        std::atomic<int> nextSegment { 0 };
+    };
+
+    //==============================================================================
+    /* Renders segment after segment into 32-bit float temporary WAV files */
+    class SegmentWorker  : public juce::Thread
+    {
+    public:
+        SegmentWorker (ParallelJob& j, int index)
+            : juce::Thread ("FlanGELVS segment " + juce::String (index)), job (j)
+        {
+        }
+
+        void run() override
+        {
+            FlanGELVSAudioProcessor processor;
+            juce::AudioFormatManager formatManager;
+            formatManager.registerBasicFormats();
+
+            std::unique_ptr<juce::AudioFormatReader> reader (formatManager.createReaderFor (job.input));
+
+            for (int i = job.nextSegment++; i < (int) job.segments.size() && ! threadShouldExit(); i = job.nextSegment++)
+            {
+                auto& segment = job.segments[(size_t) i];
+
+                if (reader == nullptr)
+                    segment.error = "Cannot read " + job.input.getFullPathName();
+                else
+                    renderSegment (processor, *reader, segment);
+            }
+        }
+
+    private:
+        void renderSegment (FlanGELVSAudioProcessor& processor, juce::AudioFormatReader& reader, Segment& segment)
+        {
+            const int blockSize = job.settings.blockSize;
+
+            Render::applySettings (processor, job.settings);
+            Render::prepareProcessor (processor, job.numChannels, job.sampleRate, blockSize);
+
+            /*The LFO and the delay smoothing start where a serial render would be at the start of the pre-roll*/
+            processor.seekModulation (segment.preRollStart);
+
+            juce::WavAudioFormat wav;
+            auto stream = std::make_unique<juce::FileOutputStream> (segment.file->getFile());
+            std::unique_ptr<juce::AudioFormatWriter> writer (wav.createWriterFor (stream.get(), job.sampleRate,
+                                                                                  (unsigned int) job.numChannels, 32, {}, 0));
+            if (writer == nullptr)
+            {
+                segment.error = "Cannot write " + segment.file->getFile().getFullPathName();
+                return;
+            }
+
+            stream.release();
+
+            juce::AudioBuffer<float> buffer (job.numChannels, blockSize);
+            juce::MidiBuffer midi;
+
+            for (auto position = segment.preRollStart; position < segment.end;)
+            {
+                /*Blocks never straddle the end of the pre-roll, so whole blocks are either kept or dropped*/
+                const auto limit = position < segment.start ? segment.start : segment.end;
+                const int numSamples = (int) juce::jmin ((juce::int64) blockSize, limit - position);
+
+                reader.read (&buffer, 0, numSamples, position, true, true);
+
+                juce::AudioBuffer<float> chunk (buffer.getArrayOfWritePointers(), job.numChannels, numSamples);
+                processor.processBlock (chunk, midi);
+
+                if (position >= segment.start && ! writer->writeFromAudioSampleBuffer (chunk, 0, numSamples))
+                {
+                    segment.error = "Write error on " + segment.file->getFile().getFullPathName();
+                    return;
+                }
+
+                position += numSamples;
+            }
+
+            processor.releaseResources();
+        }
+
+        ParallelJob& job;
+    };
+
+    //==============================================================================
+    /* Appends every sample of 'source' to 'writer' */
+    bool appendFile (juce::AudioFormatManager& formatManager, const juce::File& source, juce::AudioFormatWriter& writer)
+    {
+        std::unique_ptr<juce::AudioFormatReader> reader (formatManager.createReaderFor (source));
+
+        return reader != nullptr
+            && writer.writeFromAudioReader (*reader, 0, reader->lengthInSamples);
+    }
+
+    /* Largest difference between two files, in dB relative to full scale */
+    double getMaxDifferenceDecibels (juce::AudioFormatManager& formatManager, const juce::File& a, const juce::File& b, int blockSize)
+    {
+        std::unique_ptr<juce::AudioFormatReader> readerA (formatManager.createReaderFor (a)), readerB (formatManager.createReaderFor (b));
+
+        if (readerA == nullptr || readerB == nullptr || readerA->lengthInSamples != readerB->lengthInSamples)
+            return 0.0;
+
+        const int numChannels = (int) readerA->numChannels;
+        juce::AudioBuffer<float> bufferA (numChannels, blockSize), bufferB (numChannels, blockSize);
+        float maxDifference = 0;
+
+        for (juce::int64 position = 0; position < readerA->lengthInSamples; position += blockSize)
+        {
+            const int numSamples = (int) juce::jmin ((juce::int64) blockSize, readerA->lengthInSamples - position);
+            readerA->read (&bufferA, 0, numSamples, position, true, true);
+            readerB->read (&bufferB, 0, numSamples, position, true, true);
+
+            for (int channel = 0; channel < numChannels; ++channel)
+                for (int i = 0; i < numSamples; ++i)
+                    maxDifference = juce::jmax (maxDifference, std::abs (bufferA.getSample (channel, i) - bufferB.getSample (channel, i)));
+        }
+
+        return juce::Decibels::gainToDecibels ((double) maxDifference, -400.0);
+    }
+}
+
+//==============================================================================
+void runParallelRender (const juce::ArgumentList& args)
+{
+    juce::ScopedJuceInitialiser_GUI juceInitialiser;
+
+    ParallelJob job;
+    job.settings = Render::parseSettings (args);
+    job.input = args.getExistingFileForOption ("--input");
+
+    const auto output = args.getFileForOption ("--output");
+    const float toleranceDecibels = args.containsOption ("--tolerance-db") ? args.getValueForOption ("--tolerance-db").getFloatValue() : -96.0f;
+    const int numThreads = juce::jmax (1, args.containsOption ("--threads") ? args.getValueForOption ("--threads").getIntValue()
+                                                                           : juce::SystemStats::getNumCpus());
+
+    juce::AudioFormatManager formatManager;
+    formatManager.registerBasicFormats();
+
+    std::unique_ptr<juce::AudioFormatReader> reader (formatManager.createReaderFor (job.input));
+
+    if (reader == nullptr)
+        juce::ConsoleApplication::fail ("Cannot read " + job.input.getFullPathName());
+
+    job.sampleRate = reader->sampleRate;
+    job.numChannels = (int) reader->numChannels;
+    const auto length = reader->lengthInSamples;
+
+    //==============================================================================
+    /*Pre-roll from the feedback decay and the longest reachable delay for these settings*/
+    int preRoll = 0;
+
+    {
+        FlanGELVSAudioProcessor probe;
+        Render::applySettings (probe, job.settings);
+        preRoll = probe.getPreRollSamples (job.sampleRate, toleranceDecibels);
+    }
+
+    /*Fewer segments when the pre-roll would cost more than the segment itself*/
+    int numSegments = args.containsOption ("--segments") ? args.getValueForOption ("--segments").getIntValue() : numThreads;
+    numSegments = juce::jmax (1, numSegments);
+
+    while (numSegments > 1 && (juce::int64) preRoll > length / numSegments)
+        --numSegments;
+
+    const auto segmentLength = (length + numSegments - 1) / numSegments;
+
+    for (int i = 0; i < numSegments; ++i)
+    {
+        Segment segment;
+        segment.start = (juce::int64) i * segmentLength;
+        segment.end = juce::jmin (length, segment.start + segmentLength);
+        segment.preRollStart = juce::jmax ((juce::int64) 0, segment.start - preRoll);
+        segment.file = std::make_unique<juce::TemporaryFile> (output, juce::TemporaryFile::useHiddenFile);
+        job.segments.push_back (std::move (segment));
+    }
+
+    //==============================================================================
+    const double start = juce::Time::getMillisecondCounterHiRes();
+
+    juce::OwnedArray<SegmentWorker> workers;
+
+    for (int i = 0; i < juce::jmin (numThreads, numSegments); ++i)
+        workers.add (new SegmentWorker (job, i))->startThread();
+
+    for (auto* worker : workers)
+        worker->waitForThreadToExit (-1);
+
+    for (auto& segment : job.segments)
+        if (segment.error.isNotEmpty())
+            juce::ConsoleApplication::fail (segment.error, 2);
+
+    /*Stitch: the segments are contiguous and already free of pre-roll, so they are simply concatenated*/
+    juce::String error;
+    auto writer = Render::createWriterFor (formatManager, output, *reader, error);
+
+    if (writer == nullptr)
+        juce::ConsoleApplication::fail (error, 2);
+
+    for (auto& segment : job.segments)
+        if (! appendFile (formatManager, segment.file->getFile(), *writer))
+            juce::ConsoleApplication::fail ("Could not stitch " + segment.file->getFile().getFullPathName(), 2);
+
+    writer.reset();
+
+    const double wallSeconds = (juce::Time::getMillisecondCounterHiRes() - start) / 1000.0;
+    const double audioSeconds = (double) length / job.sampleRate;
+
+    auto* summary = new juce::DynamicObject();
+    summary->setProperty ("segments", numSegments);
+    summary->setProperty ("threads", workers.size());
+    summary->setProperty ("preRollSamples", preRoll);
+    summary->setProperty ("toleranceDb", toleranceDecibels);
+    summary->setProperty ("audioSeconds", audioSeconds);
+    summary->setProperty ("wallSeconds", wallSeconds);
+    summary->setProperty ("realtimeMultiple", wallSeconds > 0 ? audioSeconds / wallSeconds : 0.0);
+
+    //==============================================================================
+    /*--verify: render the same file serially and null-test the two results*/
+    bool withinTolerance = true;
+
+    if (args.containsOption ("--verify"))
+    {
+        juce::TemporaryFile serial (output, juce::TemporaryFile::useHiddenFile);
+        FlanGELVSAudioProcessor processor;
+
+        const auto serialResult = Render::renderFile (processor, formatManager, job.input, serial.getFile(), job.settings);
+
+        if (serialResult.error.isNotEmpty())
+            juce::ConsoleApplication::fail (serialResult.error, 2);
+
+        const double difference = getMaxDifferenceDecibels (formatManager, output, serial.getFile(), job.settings.blockSize);
+
+        summary->setProperty ("serialWallSeconds", serialResult.wallSeconds);
+        summary->setProperty ("maxDifferenceDb", difference);
+        withinTolerance = difference <= toleranceDecibels;
+        summary->setProperty ("withinTolerance", withinTolerance);
+    }
+
+    std::cout << juce::JSON::toString (juce::var (summary)) << std::endl;
+
+    if (! withinTolerance)
+        juce::ConsoleApplication::fail ("The segments differ from a serial render by more than the tolerance", 3);
+}
+
+//==============================================================================
+void runCheckParallel (const juce::ArgumentList& args)
+{
+    juce::TemporaryFile input (".wav"), output (".wav");
+
+    {
+        /*Content up to 10 kHz, where a delay error shows the most, in 32-bit float so that
+          the serial and stitched renders are not quantised*/
+        constexpr double sampleRate = 48000.0;
+        juce::AudioBuffer<float> buffer (2, (int) sampleRate * 20);
+        juce::Random random (0x5eed);
+
+        for (int channel = 0; channel < buffer.getNumChannels(); ++channel)
+            for (int i = 0; i < buffer.getNumSamples(); ++i)
+                buffer.setSample (channel, i, (float) (0.5 * std::sin (juce::MathConstants<double>::twoPi * 10000.0 * i / sampleRate))
+                                                + 0.25f * (random.nextFloat() - 0.5f));
+
+        juce::WavAudioFormat wav;
+        auto stream = std::make_unique<juce::FileOutputStream> (input.getFile());
+        std::unique_ptr<juce::AudioFormatWriter> writer (wav.createWriterFor (stream.get(), sampleRate, 2, 32, {}, 0));
+
+        if (writer == nullptr)
+            juce::ConsoleApplication::fail ("Cannot write " + input.getFile().getFullPathName());
+
+        stream.release();
+        writer->writeFromAudioSampleBuffer (buffer, 0, buffer.getNumSamples());
+    }
+
+    /*Feedback 0.2 unless --set says otherwise (later values win)*/
+    juce::StringArray arguments { "--parallel", "--input=" + input.getFile().getFullPathName(),
+                                  "--output=" + output.getFile().getFullPathName(), "--segments=8", "--verify",
+                                  "--set=feedback=0.2" + (args.containsOption ("--set") ? "," + args.getValueForOption ("--set") : juce::String()) };
+
+    for (auto option : { "--tolerance-db", "--threads", "--block-size", "--preset" })
+        if (args.containsOption (option))
+            arguments.add (juce::String (option) + "=" + args.getValueForOption (option));
+
+    runParallelRender (juce::ArgumentList ("FlanGELVSRender", arguments));
+}
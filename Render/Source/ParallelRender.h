@@ -0,0 +1,22 @@
+/*
+  ==============================================================================
+
+    ParallelRender.h
+    Created: 19 Oct 2026
+    Author:  GELVS
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+
+/* Splits one file into segments rendered on separate cores. Each segment starts
+   'pre-roll' samples early, with the LFO phase and delay smoothing a serial render
+   would have there, so its feedback state has converged by the time its output starts */
+void runParallelRender (const juce::ArgumentList& args);
+
+/* Runs --parallel --verify on a generated high-frequency signal with feedback 0.2
+   (or the given settings), failing if the stitched render misses the tolerance */
+void runCheckParallel (const juce::ArgumentList& args);
@@ -0,0 +1,372 @@
+/*
+  ==============================================================================
+
+    ReferenceRender.cpp
+    Created: 19 Oct 2026
+    Author:  GELVS
+
+  ==============================================================================
+*/
+
+#include "ReferenceRender.h"
+#include "RenderCommon.h"
+
+namespace
+{
+    constexpr double referenceSampleRate = 48000.0;
+    constexpr int referenceBlockSize = 512;
+    constexpr int referenceLength = 96000;   // 2 seconds
+    constexpr int referenceChannels = 2;
+
+    //==============================================================================
+    struct TestSignal
+    {
+        const char* name;
+        std::function<void (juce::AudioBuffer<float>&)> generate;
+    };
+
+    const std::vector<TestSignal>& getTestSignals()
+    {
+        static const std::vector<TestSignal> signals
+        {
+            { "impulse", [] (juce::AudioBuffer<float>& b)
+                {
+                    b.clear();
+                    for (int channel = 0; channel < b.getNumChannels(); ++channel)
+                        b.setSample (channel, 0, 1.0f);
+                } },
+
+            { "sweep", [] (juce::AudioBuffer<float>& b)
+                {
+                    /*Logarithmic sine sweep from 20 Hz to 20 kHz*/
+                    const double f0 = 20.0, f1 = 20000.0, duration = b.getNumSamples() / referenceSampleRate;
+                    const double k = std::log (f1 / f0);
+
+                    for (int i = 0; i < b.getNumSamples(); ++i)
+                    {
+                        const double t = i / referenceSampleRate;
+                        const double phase = juce::MathConstants<double>::twoPi * f0 * duration / k * (std::exp (t / duration * k) - 1.0);
+
+                        for (int channel = 0; channel < b.getNumChannels(); ++channel)
+                            b.setSample (channel, i, (float) (0.5 * std::sin (phase)));
+                    }
+                } },
+
+            { "noise", [] (juce::AudioBuffer<float>& b)
+                {
+                    juce::Random random (0x5eed);
+
+                    for (int channel = 0; channel < b.getNumChannels(); ++channel)
+                        for (int i = 0; i < b.getNumSamples(); ++i)
+                            b.setSample (channel, i, random.nextFloat() - 0.5f);
+                } },
+
+            { "silence", [] (juce::AudioBuffer<float>& b) { b.clear(); } },
+        };
+
+        return signals;
+    }
+
+    //==============================================================================
+    /* Parameter automation: called before every block with its index and the block count.
+       'setup' (optional) runs before prepareToPlay(), for the parameters that resize the delay
+       buffers: changed while playing, they wait for the background thread, which would make
+       the renders depend on its timing */
+    struct Automation
+    {
+        const char* name;
+        std::function<void (juce::AudioProcessor&, int block, int numBlocks)> apply;
+        std::function<void (juce::AudioProcessor&)> setup;
+    };
+
+    void setParameter (juce::AudioProcessor& processor, const juce::String& parameterID, float value)
+    {
+        for (auto* parameter : processor.getParameters())
+            if (auto* ranged = dynamic_cast<juce::RangedAudioParameter*> (parameter))
+                if (ranged->paramID == parameterID)
+                    ranged->setValueNotifyingHost (ranged->convertTo0to1 (value));
+    }
+
+    const std::vector<Automation>& getAutomations()
+    {
+        static const std::vector<Automation> automations
+        {
+            { "static-default", [] (juce::AudioProcessor&, int, int) {} },
+
+            { "static-extreme", [] (juce::AudioProcessor& p, int block, int)
+                {
+                    if (block == 0)
+                    {
+                        setParameter (p, "drywet", 1.0f);
+                        setParameter (p, "depth", 1.0f);
+                        setParameter (p, "rate", 20.0f);
+                        setParameter (p, "feedback", 0.99f);
+                        setParameter (p, "amplitude", 3.0f);
+                    }
+                } },
+
+            { "ramp-rate-depth", [] (juce::AudioProcessor& p, int block, int numBlocks)
+                {
+                    const float proportion = (float) block / (float) juce::jmax (1, numBlocks - 1);
+                    setParameter (p, "rate", 0.1f + 19.9f * proportion);
+                    setParameter (p, "depth", proportion);
+                } },
+
+            { "steady-modulation", [] (juce::AudioProcessor& p, int block, int)
+                {
+                    /*Held long enough for the realtime path to record one LFO cycle and play it back*/
+                    if (block == 0)
+                    {
+                        setParameter (p, "rate", 8.0f);
+                        setParameter (p, "depth", 0.8f);
+                        setParameter (p, "feedback", 0.6f);
+                    }
+                } },
+
+            { "jump-feedback-mix", [] (juce::AudioProcessor& p, int block, int)
+                {
+                    /*Abrupt changes every 16 blocks*/
+                    const bool high = (block / 16) % 2 == 1;
+                    setParameter (p, "feedback", high ? 0.95f : 0.05f);
+                    setParameter (p, "drywet", high ? 0.9f : 0.1f);
+                } },
+
+            { "cascade-spread", [] (juce::AudioProcessor& p, int block, int numBlocks)
+                {
+                    /*Three stages with their LFOs spread further and further apart*/
+                    const float proportion = (float) block / (float) juce::jmax (1, numBlocks - 1);
+                    setParameter (p, "stagespread", 0.1f + 0.4f * proportion);
+                },
+                [] (juce::AudioProcessor& p)
+                {
+                    setParameter (p, "stages", 3.0f);
+                    setParameter (p, "rate", 2.0f);
+                    setParameter (p, "depth", 0.8f);
+                    setParameter (p, "feedback", 0.5f);
+                } },
+
+            { "slap-range", [] (juce::AudioProcessor&, int, int) {},
+                [] (juce::AudioProcessor& p)
+                {
+                    /*Delays of 80 to 120 ms*/
+                    setParameter (p, "delayrange", 2.0f);
+                    setParameter (p, "rate", 0.5f);
+                    setParameter (p, "feedback", 0.6f);
+                } },
+        };
+
+        return automations;
+    }
+
+    //==============================================================================
+    /* How the processor is run: the realtime levels and the offline one take different paths */
+    struct Mode
+    {
+        const char* suffix;
+        bool nonRealtime;
+    };
+
+    const std::vector<Mode>& getModes()
+    {
+        /*The realtime cases keep the names they had before offline rendering existed*/
+        static const std::vector<Mode> modes
+        {
+            { "", false },
+            { "_offline", true },
+        };
+
+        return modes;
+    }
+
+    juce::String getCaseName (const TestSignal& signal, const Automation& automation, const Mode& mode)
+    {
+        return juce::String (signal.name) + "_" + automation.name + mode.suffix;
+    }
+
+    /* Renders one case with the base settings applied first, then the automation */
+    juce::AudioBuffer<float> renderCase (const TestSignal& signal, const Automation& automation, const Mode& mode,
+                                         const Render::Settings& settings)
+    {
+        juce::AudioBuffer<float> buffer (referenceChannels, referenceLength);
+        signal.generate (buffer);
+
+        FlanGELVSAudioProcessor processor;
+        Render::applySettings (processor, settings);
+
+        if (automation.setup != nullptr)
+            automation.setup (processor);
+
+        Render::prepareProcessor (processor, referenceChannels, referenceSampleRate, referenceBlockSize, mode.nonRealtime);
+
+        juce::MidiBuffer midi;
+        const int numBlocks = (referenceLength + referenceBlockSize - 1) / referenceBlockSize;
+
+        for (int block = 0; block < numBlocks; ++block)
+        {
+            automation.apply (processor, block, numBlocks);
+
+            const int start = block * referenceBlockSize;
+            const int numSamples = juce::jmin (referenceBlockSize, referenceLength - start);
+            juce::AudioBuffer<float> chunk (buffer.getArrayOfWritePointers(), referenceChannels, start, numSamples);
+            processor.processBlock (chunk, midi);
+        }
+
+        processor.releaseResources();
+        return buffer;
+    }
+
+    //==============================================================================
+    /* Distance in units in the last place between two floats */
+    juce::int64 getUlpDistance (float a, float b)
+    {
+        auto toOrdered = [] (float f)
+        {
+            juce::int32 bits;
+            std::memcpy (&bits, &f, sizeof (bits));
+            return bits < 0 ? (juce::int64) std::numeric_limits<juce::int32>::min() - bits : (juce::int64) bits;
+        };
+
+        return std::abs (toOrdered (a) - toOrdered (b));
+    }
+
+    struct NullTest
+    {
+        juce::int64 maxUlp = 0;
+        double maxDifferenceDb = -400.0;
+        double residualRmsDb = -400.0;
+    };
+
+    NullTest compare (const juce::AudioBuffer<float>& reference, const juce::AudioBuffer<float>& rendered)
+    {
+        NullTest result;
+        double maxDifference = 0, sumOfSquares = 0;
+
+        for (int channel = 0; channel < reference.getNumChannels(); ++channel)
+        {
+            for (int i = 0; i < reference.getNumSamples(); ++i)
+            {
+                const float a = reference.getSample (channel, i), b = rendered.getSample (channel, i);
+                const double difference = std::abs ((double) a - (double) b);
+
+                result.maxUlp = juce::jmax (result.maxUlp, getUlpDistance (a, b));
+                maxDifference = juce::jmax (maxDifference, difference);
+                sumOfSquares += difference * difference;
+            }
+        }
+
+        const double numSamples = (double) reference.getNumChannels() * reference.getNumSamples();
+        result.maxDifferenceDb = juce::Decibels::gainToDecibels (maxDifference, -400.0);
+        result.residualRmsDb = juce::Decibels::gainToDecibels (std::sqrt (sumOfSquares / numSamples), -400.0);
+        return result;
+    }
+
+    juce::File getReferenceFolder (const juce::ArgumentList& args)
+    {
+        return args.containsOption ("--dir") ? args.getFileForOption ("--dir")
+                                             : juce::File::getCurrentWorkingDirectory().getChildFile ("references");
+    }
+}
+
+//==============================================================================
+void runWriteReferences (const juce::ArgumentList& args)
+{
+    juce::ScopedJuceInitialiser_GUI juceInitialiser;
+
+    const auto settings = Render::parseSettings (args);
+    const auto folder = getReferenceFolder (args);
+
+    if (! folder.createDirectory())
+        juce::ConsoleApplication::fail ("Cannot create " + folder.getFullPathName());
+
+    juce::WavAudioFormat wav;
+
+    for (auto& signal : getTestSignals())
+    {
+        for (auto& automation : getAutomations())
+        {
+            for (auto& mode : getModes())
+            {
+                const auto buffer = renderCase (signal, automation, mode, settings);
+                const auto file = folder.getChildFile (getCaseName (signal, automation, mode) + ".wav");
+
+                file.deleteFile();
+                auto stream = std::make_unique<juce::FileOutputStream> (file);
+                std::unique_ptr<juce::AudioFormatWriter> writer (wav.createWriterFor (stream.get(), referenceSampleRate,
+                                                                                      referenceChannels, 32, {}, 0));
+                if (writer == nullptr)
+                    juce::ConsoleApplication::fail ("Cannot write " + file.getFullPathName());
+
+                stream.release();
+                writer->writeFromAudioSampleBuffer (buffer, 0, buffer.getNumSamples());
+                std::cout << "Wrote " << file.getFileName() << std::endl;
+            }
+        }
+    }
+}
+
+void runCheckReferences (const juce::ArgumentList& args)
+{
+    juce::ScopedJuceInitialiser_GUI juceInitialiser;
+
+    const auto settings = Render::parseSettings (args);
+    const auto folder = getReferenceFolder (args);
+
+    /*By default a change must be bit-exact; optimisations that reorder float maths
+      should state the tolerance they need*/
+    const juce::int64 maxUlp = args.containsOption ("--max-ulp") ? args.getValueForOption ("--max-ulp").getLargeIntValue() : 0;
+    const double maxDb = args.containsOption ("--max-db") ? args.getValueForOption ("--max-db").getDoubleValue() : -400.0;
+
+    juce::AudioFormatManager formatManager;
+    formatManager.registerBasicFormats();
+
+    juce::Array<juce::var> cases;
+    int numFailed = 0;
+
+    for (auto& signal : getTestSignals())
+    {
+        for (auto& automation : getAutomations())
+        {
+            for (auto& mode : getModes())
+            {
+                const auto name = getCaseName (signal, automation, mode);
+                const auto file = folder.getChildFile (name + ".wav");
+
+                std::unique_ptr<juce::AudioFormatReader> reader (formatManager.createReaderFor (file));
+
+                if (reader == nullptr || reader->lengthInSamples != referenceLength || (int) reader->numChannels != referenceChannels)
+                    juce::ConsoleApplication::fail ("Missing or malformed reference " + file.getFullPathName()
+                                                     + " (run --write-references first)");
+
+                juce::AudioBuffer<float> reference (referenceChannels, referenceLength);
+                reader->read (&reference, 0, referenceLength, 0, true, true);
+
+                const auto rendered = renderCase (signal, automation, mode, settings);
+                const auto result = compare (reference, rendered);
+                const bool passed = result.maxUlp <= maxUlp || result.maxDifferenceDb <= maxDb;
+
+                numFailed += passed ? 0 : 1;
+
+                auto* entry = new juce::DynamicObject();
+                entry->setProperty ("case", name);
+                entry->setProperty ("maxUlp", result.maxUlp);
+                entry->setProperty ("maxDifferenceDb", result.maxDifferenceDb);
+                entry->setProperty ("residualRmsDb", result.residualRmsDb);
+                entry->setProperty ("passed", passed);
+                cases.add (juce::var (entry));
+
+                std::cerr << (passed ? "PASS " : "FAIL ") << name << ": " << result.maxUlp << " ulp, null residual "
+                          << juce::String (result.residualRmsDb, 1) << " dB RMS, peak " << juce::String (result.maxDifferenceDb, 1) << " dB" << std::endl;
+            }
+        }
+    }
+
+    auto* report = new juce::DynamicObject();
+    report->setProperty ("maxUlp", maxUlp);
+    report->setProperty ("maxDb", maxDb);
+    report->setProperty ("failed", numFailed);
+    report->setProperty ("cases", cases);
+    std::cout << juce::JSON::toString (juce::var (report)) << std::endl;
+
+    if (numFailed > 0)
+        juce::ConsoleApplication::fail (juce::String (numFailed) + " reference case(s) differ", 3);
+}
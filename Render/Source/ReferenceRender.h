@@ -0,0 +1,21 @@
+/*
+  ==============================================================================
+
+    ReferenceRender.h
+    Created: 19 Oct 2026
+    Author:  GELVS
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+
+/* Renders the fixed reference cases (impulse, sweep, noise and silence under several
+   parameter automations, each in realtime and offline mode) into --dir as 32-bit float WAV files */
+void runWriteReferences (const juce::ArgumentList& args);
+
+/* Renders the same cases again (with any --set overrides, e.g. a new engine or mode)
+   and null-tests them against the files in --dir within --max-ulp / --max-db */
+void runCheckReferences (const juce::ArgumentList& args);
@@ -0,0 +1,227 @@
+/*
+  ==============================================================================
+
+    RenderCommon.cpp
+    Created: 19 Oct 2026
+    Author:  GELVS
+
+  ==============================================================================
+*/
+
+#include "RenderCommon.h"
+
+namespace Render
+{
+    //==============================================================================
+    Settings parseSettings (const juce::ArgumentList& args)
+    {
+        Settings settings;
+
+        if (args.containsOption ("--preset"))
+        {
+            const auto presetFile = args.getExistingFileForOption ("--preset");
+            const auto preset = juce::JSON::parse (presetFile);
+
+            if (auto* object = preset.getDynamicObject())
+            {
+                for (auto& property : object->getProperties())
+                    settings.parameters[property.name.toString()] = (float) property.value;
+            }
+            else
+            {
+                juce::ConsoleApplication::fail ("The preset " + presetFile.getFullPathName() + " is not a JSON object");
+            }
+        }
+
+        if (args.containsOption ("--set"))
+        {
+            for (auto& assignment : juce::StringArray::fromTokens (args.getValueForOption ("--set"), ",", {}))
+            {
+                if (! assignment.contains ("="))
+                    juce::ConsoleApplication::fail ("Expected id=value in --set, got " + assignment);
+
+                settings.parameters[assignment.upToFirstOccurrenceOf ("=", false, false).trim()]
+                    = assignment.fromFirstOccurrenceOf ("=", false, false).getFloatValue();
+            }
+        }
+
+        if (args.containsOption ("--block-size"))
+            settings.blockSize = juce::jlimit (1, 1 << 16, args.getValueForOption ("--block-size").getIntValue());
+
+        /*Check the IDs here, on the main thread, rather than in the middle of a render*/
+        FlanGELVSAudioProcessor processor;
+
+        for (auto& value : settings.parameters)
+        {
+            bool found = false;
+
+            for (auto* parameter : processor.getParameters())
+                if (auto* ranged = dynamic_cast<juce::RangedAudioParameter*> (parameter))
+                    found = found || ranged->paramID == value.first;
+
+            if (! found)
+                juce::ConsoleApplication::fail ("Unknown parameter: " + value.first
+                                                    + " (expected one of " + getParameterIDs (processor) + ")");
+        }
+
+        return settings;
+    }
+
+    juce::String getParameterIDs (const juce::AudioProcessor& processor)
+    {
+        juce::StringArray ids;
+
+        for (auto* parameter : processor.getParameters())
+            if (auto* ranged = dynamic_cast<juce::RangedAudioParameter*> (parameter))
+                ids.add (ranged->paramID);
+
+        return ids.joinIntoString (", ");
+    }
+
+    void applySettings (juce::AudioProcessor& processor, const Settings& settings)
+    {
+        for (auto* parameter : processor.getParameters())
+            parameter->setValueNotifyingHost (parameter->getDefaultValue());
+
+        for (auto& value : settings.parameters)
+            for (auto* parameter : processor.getParameters())
+                if (auto* ranged = dynamic_cast<juce::RangedAudioParameter*> (parameter))
+                    if (ranged->paramID == value.first)
+                        ranged->setValueNotifyingHost (ranged->convertTo0to1 (value.second));
+    }
+
+    bool prepareProcessor (FlanGELVSAudioProcessor& processor, int numChannels, double sampleRate, int blockSize,
+                           bool nonRealtime)
+    {
+        if (numChannels < 1 || numChannels > 2)
+            return false;
+
+        const auto set = numChannels == 1 ? juce::AudioChannelSet::mono() : juce::AudioChannelSet::stereo();
+
+        juce::AudioProcessor::BusesLayout layout;
+        layout.inputBuses.add (set);
+        layout.outputBuses.add (set);
+
+        if (! processor.setBusesLayout (layout))
+            return false;
+
+        processor.setNonRealtime (nonRealtime);
+        processor.setRateAndBufferSizeDetails (sampleRate, blockSize);
+        processor.prepareToPlay (sampleRate, blockSize);
+        return true;
+    }
+
+    std::unique_ptr<juce::AudioFormatWriter> createWriterFor (juce::AudioFormatManager& formatManager, const juce::File& output,
+                                                              const juce::AudioFormatReader& source, juce::String& error)
+    {
+        auto* format = formatManager.findFormatForFileExtension (output.getFileExtension());
+
+        if (format == nullptr)
+        {
+            error = "No audio format for " + output.getFileName();
+            return {};
+        }
+
+        /*Keep the source bit depth when the output format supports it, otherwise use its best one*/
+        const auto depths = format->getPossibleBitDepths();
+        const int bitsPerSample = depths.contains ((int) source.bitsPerSample) ? (int) source.bitsPerSample
+                                                                                : depths.getLast();
+
+        output.deleteFile();
+        auto stream = std::make_unique<juce::FileOutputStream> (output);
+
+        if (stream->failedToOpen())
+        {
+            error = "Cannot write " + output.getFullPathName();
+            return {};
+        }
+
+        std::unique_ptr<juce::AudioFormatWriter> writer (format->createWriterFor (stream.get(), source.sampleRate,
+                                                                                  source.numChannels, bitsPerSample,
+                                                                                  source.metadataValues, 0));
+        if (writer == nullptr)
+        {
+            error = "Cannot create a " + format->getFormatName() + " writer for " + output.getFileName();
+            return {};
+        }
+
+        stream.release();   // now owned by the writer
+        return writer;
+    }
+
+    //==============================================================================
+    juce::var FileResult::toVar() const
+    {
+        auto* object = new juce::DynamicObject();
+        object->setProperty ("input", input.getFullPathName());
+        object->setProperty ("output", output.getFullPathName());
+        object->setProperty ("audioSeconds", audioSeconds);
+        object->setProperty ("wallSeconds", wallSeconds);
+        object->setProperty ("realtimeMultiple", getRealtimeMultiple());
+
+        if (error.isNotEmpty())
+            object->setProperty ("error", error);
+
+        return juce::var (object);
+    }
+
+    FileResult renderFile (FlanGELVSAudioProcessor& processor, juce::AudioFormatManager& formatManager,
+                           const juce::File& input, const juce::File& output, const Settings& settings)
+    {
+        FileResult result;
+        result.input = input;
+        result.output = output;
+
+        const double start = juce::Time::getMillisecondCounterHiRes();
+
+        std::unique_ptr<juce::AudioFormatReader> reader (formatManager.createReaderFor (input));
+
+        if (reader == nullptr)
+        {
+            result.error = "Cannot read " + input.getFullPathName();
+            return result;
+        }
+
+        const int numChannels = (int) reader->numChannels;
+
+        applySettings (processor, settings);
+
+        if (! prepareProcessor (processor, numChannels, reader->sampleRate, settings.blockSize))
+        {
+            result.error = "Unsupported channel count: " + juce::String (numChannels);
+            return result;
+        }
+
+        auto writer = createWriterFor (formatManager, output, *reader, result.error);
+
+        if (writer == nullptr)
+            return result;
+
+        juce::AudioBuffer<float> buffer (numChannels, settings.blockSize);
+        juce::MidiBuffer midi;
+
+        for (juce::int64 position = 0; position < reader->lengthInSamples;)
+        {
+            const int numSamples = (int) juce::jmin ((juce::int64) settings.blockSize, reader->lengthInSamples - position);
+
+            reader->read (&buffer, 0, numSamples, position, true, true);
+
+            juce::AudioBuffer<float> chunk (buffer.getArrayOfWritePointers(), numChannels, numSamples);
+            processor.processBlock (chunk, midi);
+
+            if (! writer->writeFromAudioSampleBuffer (chunk, 0, numSamples))
+            {
+                result.error = "Write error on " + output.getFullPathName();
+                break;
+            }
+
+            position += numSamples;
+        }
+
+        processor.releaseResources();
+
+        result.audioSeconds = (double) reader->lengthInSamples / reader->sampleRate;
+        result.wallSeconds = (juce::Time::getMillisecondCounterHiRes() - start) / 1000.0;
+        return result;
+    }
+}
@@ -0,0 +1,62 @@
+/*
+  ==============================================================================
+
+    RenderCommon.h
+    Created: 19 Oct 2026
+    Author:  GELVS
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+#include "../../FlanGELVS/Source/PluginProcessor.h"
+
+namespace Render
+{
+    //==============================================================================
+    /* What to render with: parameter values (real units, keyed by parameter ID) and the chunk size */
+    struct Settings
+    {
+        std::map<juce::String, float> parameters;
+        int blockSize = 4096;
+    };
+
+    /* Reads --preset=file.json (an object of parameter ID -> value), then --set=id=value,id=value
+       and --block-size=N. Calls ConsoleApplication::fail() on malformed input or unknown IDs */
+    Settings parseSettings (const juce::ArgumentList& args);
+
+    /* The IDs accepted by --set and presets, comma separated, in the processor's order */
+    juce::String getParameterIDs (const juce::AudioProcessor& processor);
+
+    /* Resets every parameter to its default, then applies the settings (safe on any thread) */
+    void applySettings (juce::AudioProcessor& processor, const Settings& settings);
+
+    /* Puts the processor in offline mode (unless 'nonRealtime' is false) with a layout matching
+       'numChannels' (1 or 2) and prepares it. Apply the settings first: the delay lines are sized
+       for the range and stages in effect here */
+    bool prepareProcessor (FlanGELVSAudioProcessor& processor, int numChannels, double sampleRate, int blockSize,
+                           bool nonRealtime = true);
+
+    /* Writer for 'output', using the format of its extension and the source's sample rate,
+       channel count and (if supported) bit depth */
+    std::unique_ptr<juce::AudioFormatWriter> createWriterFor (juce::AudioFormatManager& formatManager, const juce::File& output,
+                                                              const juce::AudioFormatReader& source, juce::String& error);
+
+    //==============================================================================
+    struct FileResult
+    {
+        juce::File input, output;
+        double audioSeconds = 0;
+        double wallSeconds = 0;
+        juce::String error;
+
+        double getRealtimeMultiple() const  { return wallSeconds > 0 ? audioSeconds / wallSeconds : 0; }
+        juce::var toVar() const;
+    };
+
+    /* Renders one file through 'processor', chunk by chunk */
+    FileResult renderFile (FlanGELVSAudioProcessor& processor, juce::AudioFormatManager& formatManager,
+                           const juce::File& input, const juce::File& output, const Settings& settings);
+}
@@ -0,0 +1,245 @@
+/*
+  ==============================================================================
+
+    StreamingRender.cpp
+    Created: 19 Oct 2026
+    Author:  GELVS
+
+  ==============================================================================
+*/
+
+#include "StreamingRender.h"
+
+//==============================================================================
+ChunkPipeline::ChunkPipeline (int numChannels, int chunkSize, int numSlots)
+    : slots ((size_t) numSlots)
+{
+    for (auto& slot : slots)
+        slot.buffer.setSize (numChannels, chunkSize);
+}
+
+ChunkPipeline::Slot& ChunkPipeline::waitFor (int chunkIndex, State state)
+{
+    auto& slot = slots[(size_t) chunkIndex % slots.size()];
+
+    std::unique_lock<std::mutex> lock (mutex);
+    stateChanged.wait (lock, [&] { return slot.state == state || aborted; });
+    return slot;
+}
+
+void ChunkPipeline::release (Slot& slot, State newState)
+{
+    {
+        const std::lock_guard<std::mutex> lock (mutex);
+        slot.state = newState;
+    }
+
+    stateChanged.notify_all();
+}
+
+bool ChunkPipeline::run (std::function<int (juce::AudioBuffer<float>&)> read,
+                         std::function<void (juce::AudioBuffer<float>&)> process,
+                         std::function<bool (const juce::AudioBuffer<float>&)> write)
+{
+    std::atomic<bool> writeFailed { false };
+
+    /*A chunk with numSamples == 0 marks the end of the stream for the next stages*/
+    std::thread reader ([&]
+    {
+        for (int chunk = 0;; ++chunk)
+        {
+            auto& slot = waitFor (chunk, State::empty);
+
+            if (aborted)
+                return;
+
+            const int numSamples = read (slot.buffer);
+            slot.numSamples = numSamples;
+            release (slot, State::read);
+
+            if (numSamples == 0)
+                return;
+        }
+    });
+
+    std::thread writer ([&]
+    {
+        for (int chunk = 0;; ++chunk)
+        {
+            auto& slot = waitFor (chunk, State::processed);
+
+            if (aborted || slot.numSamples == 0)
+                return;
+
+            const juce::AudioBuffer<float> view (slot.buffer.getArrayOfWritePointers(), slot.buffer.getNumChannels(), slot.numSamples);
+
+            if (! write (view))
+            {
+                writeFailed = true;
+
+                {
+                    const std::lock_guard<std::mutex> lock (mutex);
+                    aborted = true;
+                }
+
+                stateChanged.notify_all();
+                return;
+            }
+
+            release (slot, State::empty);
+        }
+    });
+
+    for (int chunk = 0;; ++chunk)
+    {
+        auto& slot = waitFor (chunk, State::read);
+
+        if (aborted)
+            break;
+
+        if (slot.numSamples > 0)
+        {
+            juce::AudioBuffer<float> view (slot.buffer.getArrayOfWritePointers(), slot.buffer.getNumChannels(), slot.numSamples);
+            process (view);
+        }
+
+        const bool finished = slot.numSamples == 0;
+        release (slot, State::processed);
+
+        if (finished)
+            break;
+    }
+
+    reader.join();
+    writer.join();
+    return ! writeFailed;
+}
+
+//==============================================================================
+namespace
+{
+    /* Memory-mapped reader for WAV/AIFF, or nullptr for formats that cannot be mapped */
+    std::unique_ptr<juce::MemoryMappedAudioFormatReader> createMappedReader (juce::AudioFormatManager& formatManager,
+                                                                             const juce::File& input)
+    {
+        if (auto* format = formatManager.findFormatForFileExtension (input.getFileExtension()))
+            return std::unique_ptr<juce::MemoryMappedAudioFormatReader> (format->createMemoryMappedReader (input));
+
+        return {};
+    }
+}
+
+Render::FileResult renderFileStreaming (FlanGELVSAudioProcessor& processor, juce::AudioFormatManager& formatManager,
+                                        const juce::File& input, const juce::File& output, const Render::Settings& settings)
+{
+    Render::FileResult result;
+    result.input = input;
+    result.output = output;
+
+    const double start = juce::Time::getMillisecondCounterHiRes();
+
+    /*FLAC cannot be mapped, so it falls back to a normal (buffered) stream reader*/
+    auto mappedReader = createMappedReader (formatManager, input);
+    std::unique_ptr<juce::AudioFormatReader> streamReader;
+
+    if (mappedReader == nullptr)
+        streamReader.reset (formatManager.createReaderFor (input));
+
+    juce::AudioFormatReader* reader = mappedReader != nullptr ? static_cast<juce::AudioFormatReader*> (mappedReader.get())
+                                                              : streamReader.get();
+
+    if (reader == nullptr)
+    {
+        result.error = "Cannot read " + input.getFullPathName();
+        return result;
+    }
+
+    const int numChannels = (int) reader->numChannels;
+    const int chunkSize = settings.blockSize;
+
+    Render::applySettings (processor, settings);
+
+    if (! Render::prepareProcessor (processor, numChannels, reader->sampleRate, chunkSize))
+    {
+        result.error = "Unsupported channel count: " + juce::String (numChannels);
+        return result;
+    }
+
+    auto writer = Render::createWriterFor (formatManager, output, *reader, result.error);
+
+    if (writer == nullptr)
+        return result;
+
+    /*Only a sliding window of the file is mapped, so the mapping stays small too*/
+    const juce::int64 mappedWindow = (juce::int64) chunkSize * 32;
+    const juce::int64 length = reader->lengthInSamples;
+    juce::int64 readPosition = 0;
+
+    auto read = [&] (juce::AudioBuffer<float>& buffer)
+    {
+        const int numSamples = (int) juce::jmin ((juce::int64) chunkSize, length - readPosition);
+
+        if (numSamples <= 0)
+            return 0;
+
+        if (mappedReader != nullptr)
+        {
+            const juce::Range<juce::int64> needed (readPosition, readPosition + numSamples);
+
+            if (! mappedReader->getMappedSection().contains (needed)
+                 && ! mappedReader->mapSectionOfFile ({ readPosition, juce::jmin (length, readPosition + mappedWindow) }))
+                return 0;
+        }
+
+        reader->read (&buffer, 0, numSamples, readPosition, true, true);
+        readPosition += numSamples;
+        return numSamples;
+    };
+
+    juce::MidiBuffer midi;
+    auto process = [&] (juce::AudioBuffer<float>& chunk) { processor.processBlock (chunk, midi); };
+
+    auto write = [&] (const juce::AudioBuffer<float>& chunk)
+    {
+        return writer->writeFromAudioSampleBuffer (chunk, 0, chunk.getNumSamples());
+    };
+
+    ChunkPipeline pipeline (numChannels, chunkSize);
+
+    if (! pipeline.run (read, process, write))
+        result.error = "Write error on " + output.getFullPathName();
+    else if (readPosition < length)
+        result.error = "Could not map " + input.getFullPathName();
+
+    writer.reset();
+    processor.releaseResources();
+
+    result.audioSeconds = (double) length / reader->sampleRate;
+    result.wallSeconds = (juce::Time::getMillisecondCounterHiRes() - start) / 1000.0;
+    return result;
+}
+
+//==============================================================================
+void runStreamingRender (const juce::ArgumentList& args)
+{
+    juce::ScopedJuceInitialiser_GUI juceInitialiser;
+
+    auto settings = Render::parseSettings (args);
+
+    if (! args.containsOption ("--block-size"))
+        settings.blockSize = 65536;
+
+    const auto input = args.getExistingFileForOption ("--input");
+    const auto output = args.getFileForOption ("--output");
+
+    FlanGELVSAudioProcessor processor;
+    juce::AudioFormatManager formatManager;
+    formatManager.registerBasicFormats();
+
+    const auto result = renderFileStreaming (processor, formatManager, input, output, settings);
+
+    std::cout << juce::JSON::toString (result.toVar()) << std::endl;
+
+    if (result.error.isNotEmpty())
+        juce::ConsoleApplication::fail (result.error, 2);
+}
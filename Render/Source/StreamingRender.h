@@ -0,0 +1,65 @@
+/*
+  ==============================================================================
+
+    StreamingRender.h
+    Created: 19 Oct 2026
+    Author:  GELVS
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include "RenderCommon.h"
+
+//==============================================================================
+/**
+    Three-stage read -> process -> write pipeline over a fixed ring of chunk buffers.
+
+    A reader thread fills free slots, the calling thread runs processBlock() on
+    them and a writer thread drains the processed ones, so the three stages
+    overlap while memory stays at 'numSlots' chunks whatever the file length.
+*/
+class ChunkPipeline
+{
+public:
+    ChunkPipeline (int numChannels, int chunkSize, int numSlots = 4);
+
+    /* Pulls the source with 'read' (returns the number of samples it produced, 0 at the end),
+       runs 'process' on each chunk on the calling thread and hands the result to 'write'.
+       Returns false if 'write' failed */
+    bool run (std::function<int (juce::AudioBuffer<float>&)> read,
+              std::function<void (juce::AudioBuffer<float>&)> process,
+              std::function<bool (const juce::AudioBuffer<float>&)> write);
+
+private:
+    enum class State { empty, read, processed };
+
+    struct Slot
+    {
+        juce::AudioBuffer<float> buffer;
+        int numSamples = 0;
+        State state = State::empty;
+    };
+
+    Slot& waitFor (int chunkIndex, State state);
+    void release (Slot& slot, State newState);
+
+    std::vector<Slot> slots;
+    std::mutex mutex;
+    std::condition_variable stateChanged;
+    std::atomic<bool> aborted { false };
+
+    JUCE_DECLARE_NON_COPYABLE (ChunkPipeline)
+};
+
+//==============================================================================
+/* Renders one (possibly multi-hour) file through a memory-mapped reader and the pipeline above */
+Render::FileResult renderFileStreaming (FlanGELVSAudioProcessor& processor, juce::AudioFormatManager& formatManager,
+                                        const juce::File& input, const juce::File& output, const Render::Settings& settings);
+
+void runStreamingRender (const juce::ArgumentList& args);